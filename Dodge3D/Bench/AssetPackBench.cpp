@@ -0,0 +1,467 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "AssetPack.h"
+#include "GlyphAtlas.h"
+#include "RandomStream.h"
+#include "TTFont.h"
+
+#include "BenchUtils.h"
+
+
+/**
+ * @brief ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+ */
+static const int32_t BEGIN_CODE_POINT = 32;
+
+
+/**
+ * @brief ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+ */
+static const int32_t END_CODE_POINT = 127;
+
+
+/**
+ * @brief  ѿ ־ Ȯ ۸ ؽó Ʋ Ʈ ũԴϴ.
+ */
+static const float FONT_SIZE = 32.0f;
+
+
+/**
+ * @brief ġũ д Դϴ.
+ */
+struct SourceFile
+{
+	std::string name;                 //    ̸Դϴ.
+	std::filesystem::path path;       //   Դϴ.
+	std::vector<uint8_t> buffer;      //  Դϴ.
+};
+
+
+/**
+ * @brief   Ʈ մϴ.
+ *
+ * @param buffer  Դϴ.
+ *
+ * @return Ʈ  ȯմϴ.
+ *
+ * @note ε ޸   е       Ƚϴ.
+ */
+uint64_t SumBytes(const BufferView& buffer)
+{
+	uint64_t sum = 0;
+	for (uint8_t value : buffer)
+	{
+		sum += value;
+	}
+
+	return sum;
+}
+
+
+/**
+ * @brief LZ4     ״ ǵ Ȯմϴ.
+ *
+ * @param buffer Ȯ  Դϴ.
+ *
+ * @return  Ǭ ۰   ߸  ۸ źѴٸ true, ׷  false ȯմϴ.
+ */
+bool CheckLz4RoundTrip(const std::vector<uint8_t>& buffer)
+{
+	std::vector<uint8_t> compressedBuffer = AssetPack::CompressLz4(buffer);
+
+	std::vector<uint8_t> decompressedBuffer(buffer.size() + 1);
+	if (!AssetPack::DecompressLz4(compressedBuffer, decompressedBuffer.data(), buffer.size()))
+	{
+		return false;
+	}
+
+	decompressedBuffer.resize(buffer.size());
+	if (decompressedBuffer != buffer)
+	{
+		return false;
+	}
+
+	if (AssetPack::DecompressLz4(BufferView(compressedBuffer.data(), compressedBuffer.size() - 1), decompressedBuffer.data(), buffer.size()))
+	{
+		return false;
+	}
+
+	return buffer.empty() || !AssetPack::DecompressLz4(compressedBuffer, decompressedBuffer.data(), buffer.size() - 1);
+}
+
+
+/**
+ * @brief Է 丮 Ʒ   нϴ.
+ *
+ * @param inputPath Է 丮 Դϴ.
+ * @param outSourceFiles   ߰ Դϴ.
+ */
+void CollectSourceFiles(const std::filesystem::path& inputPath, std::vector<SourceFile>& outSourceFiles)
+{
+	std::error_code errorCode;
+	if (!std::filesystem::is_directory(inputPath, errorCode))
+	{
+		return;
+	}
+
+	std::filesystem::path rootPath = std::filesystem::absolute(inputPath).lexically_normal();
+	std::string rootName = rootPath.has_filename() ? rootPath.filename().generic_string() : rootPath.parent_path().filename().generic_string();
+
+	for (const std::filesystem::directory_entry& entry : std::filesystem::recursive_directory_iterator(rootPath))
+	{
+		if (entry.is_regular_file())
+		{
+			SourceFile sourceFile;
+			sourceFile.name = rootName + "/" + entry.path().lexically_relative(rootPath).generic_string();
+			sourceFile.path = entry.path();
+			sourceFile.buffer = BenchUtils::ReadBufferFromFile(entry.path());
+
+			outSourceFiles.push_back(std::move(sourceFile));
+		}
+	}
+}
+
+
+/**
+ * @brief      ϴ.
+ *
+ * @param sourceFiles  ѿ   Դϴ.
+ * @param bIsCompress LZ4  Դϴ.
+ * @param path     Դϴ.
+ *
+ * @return    ũ⸦ ȯմϴ.
+ */
+std::size_t WritePack(const std::vector<SourceFile>& sourceFiles, bool bIsCompress, const std::filesystem::path& path)
+{
+	std::vector<AssetPack::BuildEntry> entries(sourceFiles.size());
+	for (std::size_t index = 0; index < sourceFiles.size(); ++index)
+	{
+		entries[index].name = sourceFiles[index].name;
+		entries[index].buffer = sourceFiles[index].buffer;
+		entries[index].bIsCompress = bIsCompress;
+	}
+
+	std::vector<uint8_t> packBuffer = AssetPack::Build(entries);
+
+	BenchUtils::WriteBufferToFile(path, packBuffer);
+
+	return packBuffer.size();
+}
+
+
+/**
+ * @brief   Ź   д ð մϴ.
+ *
+ * @note     ǳʶݴϴ.
+ *
+ * @param sourceFiles   Դϴ.
+ * @param countOfIteration ݺ ȽԴϴ.
+ * @param outSum  Ʈ Դϴ.
+ *
+ * @return    д  ɸ  ð   ȯմϴ.
+ */
+double MeasureLooseRead(const std::vector<SourceFile>& sourceFiles, int32_t countOfIteration, uint64_t& outSum)
+{
+	outSum = 0;
+
+	auto startTime = std::chrono::steady_clock::now();
+	for (int32_t iteration = 0; iteration < countOfIteration; ++iteration)
+	{
+		for (const SourceFile& sourceFile : sourceFiles)
+		{
+			if (!sourceFile.path.empty())
+			{
+				outSum += SumBytes(BenchUtils::ReadBufferFromFile(sourceFile.path));
+			}
+		}
+	}
+
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count() / static_cast<double>(countOfIteration);
+}
+
+
+/**
+ * @brief    Ź ؼ   д ð մϴ.
+ *
+ * @note  б  ¸ е     ǳʶݴϴ.
+ *
+ * @param path    Դϴ.
+ * @param sourceFiles   Դϴ.
+ * @param countOfIteration ݺ ȽԴϴ.
+ * @param outSum  Ʈ Դϴ.
+ *
+ * @return    д  ɸ  ð   ȯմϴ.
+ */
+double MeasurePackRead(const std::filesystem::path& path, const std::vector<SourceFile>& sourceFiles, int32_t countOfIteration, uint64_t& outSum)
+{
+	outSum = 0;
+
+	std::vector<uint8_t> decompressBuffer;
+
+	auto startTime = std::chrono::steady_clock::now();
+	for (int32_t iteration = 0; iteration < countOfIteration; ++iteration)
+	{
+		AssetPack assetPack;
+		if (!assetPack.Initialize(path.wstring()))
+		{
+			return 0.0;
+		}
+
+		for (const SourceFile& sourceFile : sourceFiles)
+		{
+			if (!sourceFile.path.empty())
+			{
+				outSum += SumBytes(assetPack.Read(sourceFile.name, decompressBuffer));
+			}
+		}
+
+		assetPack.Release();
+	}
+
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count() / static_cast<double>(countOfIteration);
+}
+
+
+int main(int argc, char** argv)
+{
+	std::vector<std::filesystem::path> inputPaths;
+	std::filesystem::path fontPath;
+	int32_t countOfIteration = 200;
+
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument.rfind("input=", 0) == 0)
+		{
+			inputPaths.push_back(argument.substr(6));
+		}
+		else if (argument.rfind("font=", 0) == 0)
+		{
+			fontPath = argument.substr(5);
+		}
+		else if (argument.rfind("iterations=", 0) == 0)
+		{
+			countOfIteration = std::max<int32_t>(1, std::stoi(argument.substr(11)));
+		}
+		else
+		{
+			std::fprintf(stderr, "usage : Dodge3DAssetPackBench [input=Dodge3D/Resource] [input=GameEngine/Shader] [font=<ttf file>] [iterations=200]\n");
+			return 1;
+		}
+	}
+
+	if (inputPaths.empty())
+	{
+		inputPaths = { "Dodge3D/Resource", "GameEngine/Shader" };
+	}
+
+	std::printf("Dodge3DAssetPackBench\n");
+
+	int32_t countOfMismatch = 0;
+	auto check = [&](const char* name, bool bIsMatch)
+	{
+		if (!bIsMatch)
+		{
+			std::printf("  mismatch %s\n", name);
+			countOfMismatch++;
+		}
+	};
+
+	// LZ4     ռ ۷ Ȯմϴ.
+	RandomStream randomStream(1);
+
+	std::vector<uint8_t> randomBuffer(70000);
+	for (uint8_t& value : randomBuffer)
+	{
+		value = static_cast<uint8_t>(randomStream.NextUInt32() & 0xFF);
+	}
+
+	std::vector<uint8_t> farRepeatBuffer = randomBuffer;
+	farRepeatBuffer.insert(farRepeatBuffer.end(), randomBuffer.begin(), randomBuffer.begin() + 4096);
+
+	std::vector<uint8_t> periodBuffer(100000);
+	for (std::size_t index = 0; index < periodBuffer.size(); ++index)
+	{
+		periodBuffer[index] = static_cast<uint8_t>("abc"[index % 3]);
+	}
+
+	bool bIsSmallMatch = true;
+	for (std::size_t size = 0; size <= 32; ++size)
+	{
+		bIsSmallMatch = bIsSmallMatch && CheckLz4RoundTrip(std::vector<uint8_t>(size, 7));
+	}
+
+	check("lz4 small buffer", bIsSmallMatch);
+	check("lz4 zero buffer", CheckLz4RoundTrip(std::vector<uint8_t>(100000, 0)));
+	check("lz4 overlapped match", CheckLz4RoundTrip(periodBuffer));
+	check("lz4 random buffer", CheckLz4RoundTrip(randomBuffer));
+	check("lz4 far repeat", CheckLz4RoundTrip(farRepeatBuffer));
+	check("lz4 compress repeat", AssetPack::CompressLz4(periodBuffer).size() < periodBuffer.size() / 100);
+
+	std::vector<SourceFile> sourceFiles;
+	for (const std::filesystem::path& inputPath : inputPaths)
+	{
+		CollectSourceFiles(inputPath, sourceFiles);
+	}
+
+	// Ʈ ִٸ Ʈ   Ʋ󽺵  ѿ ־ δ 並 ״ ѱϴ.
+	std::vector<uint8_t> fontBuffer = fontPath.empty() ? std::vector<uint8_t>() : BenchUtils::ReadBufferFromFile(fontPath);
+	GlyphAtlas packedAtlas;
+	if (!fontBuffer.empty())
+	{
+		GlyphAtlas::Pack(fontBuffer, BEGIN_CODE_POINT, END_CODE_POINT, FONT_SIZE, packedAtlas);
+
+		sourceFiles.push_back({ "Font/Font.ttf", fontPath, fontBuffer });
+		sourceFiles.push_back({ "Font/Font.atlas", std::filesystem::path(), packedAtlas.Serialize() });
+	}
+
+	if (sourceFiles.empty())
+	{
+		std::fprintf(stderr, "no input files...\n");
+		return 1;
+	}
+
+	std::size_t totalSize = 0;
+	for (const SourceFile& sourceFile : sourceFiles)
+	{
+		totalSize += sourceFile.buffer.size();
+	}
+
+	std::filesystem::path packPath = std::filesystem::temp_directory_path() / "Dodge3DAssetPackBench.pack";
+	std::filesystem::path storedPackPath = std::filesystem::temp_directory_path() / "Dodge3DAssetPackBench.Stored.pack";
+
+	std::size_t packSize = WritePack(sourceFiles, true, packPath);
+	std::size_t storedPackSize = WritePack(sourceFiles, false, storedPackPath);
+
+	//  ѿ    ϰ ,    ε ޸𸮸 ״ Ű Ȯմϴ.
+	{
+		AssetPack assetPack;
+		AssetPack storedPack;
+		if (!assetPack.Initialize(packPath.wstring()) || !storedPack.Initialize(storedPackPath.wstring()))
+		{
+			std::fprintf(stderr, "failed to open asset pack file...\n");
+			return 1;
+		}
+
+		check("count of entry", assetPack.GetCountOfEntry() == sourceFiles.size() && storedPack.GetCountOfEntry() == sourceFiles.size());
+		check("mapped size", assetPack.GetMappedSize() == packSize && storedPack.GetMappedSize() == storedPackSize);
+		check("missing entry", !assetPack.HasEntry("Missing/Asset.bin"));
+
+		std::size_t countOfCompressed = 0;
+		std::vector<uint8_t> decompressBuffer;
+		for (const SourceFile& sourceFile : sourceFiles)
+		{
+			BufferView buffer = assetPack.Read(sourceFile.name, decompressBuffer);
+			bool bIsSame = assetPack.HasEntry(sourceFile.name) && buffer.GetSize() == sourceFile.buffer.size() && std::equal(buffer.begin(), buffer.end(), sourceFile.buffer.begin());
+
+			BufferView storedBuffer = storedPack.Read(sourceFile.name, decompressBuffer);
+			bool bIsStoredSame = storedBuffer.GetSize() == sourceFile.buffer.size() && std::equal(storedBuffer.begin(), storedBuffer.end(), sourceFile.buffer.begin());
+
+			if (!bIsSame || !bIsStoredSame)
+			{
+				std::printf("  mismatch %s\n", sourceFile.name.c_str());
+				countOfMismatch++;
+			}
+
+			//      ĵ  ޸𸮸 Ѿ մϴ.
+			if (reinterpret_cast<uintptr_t>(storedBuffer.GetData()) % 16 != 0 || storedBuffer.GetData() == decompressBuffer.data())
+			{
+				std::printf("  not zero copy %s\n", sourceFile.name.c_str());
+				countOfMismatch++;
+			}
+		}
+
+		for (uint32_t index = 0; index < assetPack.GetCountOfEntry(); ++index)
+		{
+			AssetPack::EntryInfo info = assetPack.GetEntryInfo(index);
+			countOfCompressed += info.bIsCompressed ? 1 : 0;
+			check("compressed size", !info.bIsCompressed || info.storedSize < info.originalSize);
+		}
+
+		std::printf("  %zu assets, %zu bytes, lz4 pack %zu bytes (%zu compressed), stored pack %zu bytes\n", sourceFiles.size(), totalSize, packSize, countOfCompressed, storedPackSize);
+
+		// Ʈ Ÿ Ʈ δ ε ޸𸮸 ״ Ѱܼ ŷϰų   Ʋ󽺸 нϴ.
+		if (!fontBuffer.empty())
+		{
+			std::vector<uint8_t> fontDecompressBuffer;
+			std::vector<uint8_t> atlasDecompressBuffer;
+			BufferView fontView = storedPack.Read("Font/Font.ttf", fontDecompressBuffer);
+			BufferView atlasView = assetPack.Read("Font/Font.atlas", atlasDecompressBuffer);
+
+			GlyphAtlas bakedAtlas;
+			GlyphAtlas repackedAtlas;
+			check("load baked atlas from pack", TTFont::LoadGlyphAtlasFromBuffer(fontView, atlasView, BEGIN_CODE_POINT, END_CODE_POINT, FONT_SIZE, GlyphAtlas::EType::Bitmap, bakedAtlas));
+			check("repack atlas from pack", !TTFont::LoadGlyphAtlasFromBuffer(fontView, BufferView(), BEGIN_CODE_POINT, END_CODE_POINT, FONT_SIZE, GlyphAtlas::EType::Bitmap, repackedAtlas));
+			check("same atlas", bakedAtlas.Serialize() == packedAtlas.Serialize() && repackedAtlas.Serialize() == packedAtlas.Serialize());
+		}
+
+		storedPack.Release();
+		assetPack.Release();
+	}
+
+	//   ų        ʱȭ ʾƾ մϴ.
+	{
+		std::filesystem::path corruptPackPath = std::filesystem::temp_directory_path() / "Dodge3DAssetPackBench.Corrupt.pack";
+		std::vector<uint8_t> packBuffer = BenchUtils::ReadBufferFromFile(storedPackPath);
+
+		auto isRejected = [&](const std::vector<uint8_t>& corruptBuffer)
+		{
+			AssetPack assetPack;
+			return BenchUtils::WriteBufferToFile(corruptPackPath, corruptBuffer) && !assetPack.Initialize(corruptPackPath.wstring());
+		};
+
+		auto patch = [&](std::size_t offset, auto value)
+		{
+			std::vector<uint8_t> corruptBuffer = packBuffer;
+			std::memcpy(corruptBuffer.data() + offset, &value, sizeof(value));
+			return corruptBuffer;
+		};
+
+		//  ĺ (0), (4),  (8),  ũ(12), (16), ̸ ̺(24), ̸ ̺ ũ(32),  ũ(40) ̰,  48Ʈ մϴ.
+		const std::size_t headerSize = 48;
+		const std::size_t entryOffsetOfOffset = headerSize + 8;
+		const std::size_t entryOffsetOfNameLength = headerSize + 36;
+
+		AssetPack missingPack;
+		check("reject missing pack", !missingPack.Initialize((std::filesystem::temp_directory_path() / "Dodge3DAssetPackBench.Missing.pack").wstring()));
+		check("reject truncated header", isRejected(std::vector<uint8_t>(packBuffer.begin(), packBuffer.begin() + headerSize / 2)));
+		check("reject truncated pack", isRejected(std::vector<uint8_t>(packBuffer.begin(), packBuffer.end() - 1)));
+		check("reject magic", isRejected(patch(0, static_cast<uint32_t>(0))));
+		check("reject version", isRejected(patch(4, static_cast<uint32_t>(0))));
+		check("reject count of entry", isRejected(patch(8, static_cast<uint32_t>(0xFFFFFFFF))));
+		check("reject name table", isRejected(patch(32, static_cast<uint64_t>(0xFFFFFFFFFFFFFFFF))));
+		check("reject entry offset", isRejected(patch(entryOffsetOfOffset, static_cast<uint64_t>(0xFFFFFFFFFFFFFFF0))));
+		check("reject entry name", isRejected(patch(entryOffsetOfNameLength, static_cast<uint32_t>(0xFFFFFFFF))));
+		check("accept valid pack", !isRejected(packBuffer));
+
+		std::error_code errorCode;
+		std::filesystem::remove(corruptPackPath, errorCode);
+	}
+
+	uint64_t looseSum = 0;
+	uint64_t packSum = 0;
+	uint64_t storedPackSum = 0;
+	double looseSeconds = MeasureLooseRead(sourceFiles, countOfIteration, looseSum);
+	double packSeconds = MeasurePackRead(packPath, sourceFiles, countOfIteration, packSum);
+	double storedPackSeconds = MeasurePackRead(storedPackPath, sourceFiles, countOfIteration, storedPackSum);
+
+	check("same read bytes", looseSum == packSum && looseSum == storedPackSum);
+
+	std::printf("  loose files       : %9.3f ms\n", looseSeconds * 1000.0);
+	std::printf("  mapped pack (lz4) : %9.3f ms (%.2fx)\n", packSeconds * 1000.0, looseSeconds / packSeconds);
+	std::printf("  mapped pack       : %9.3f ms (%.2fx)\n", storedPackSeconds * 1000.0, looseSeconds / storedPackSeconds);
+
+	std::error_code errorCode;
+	std::filesystem::remove(packPath, errorCode);
+	std::filesystem::remove(storedPackPath, errorCode);
+
+	std::printf("  result : %s\n", (countOfMismatch == 0) ? "ok" : "mismatch");
+	return (countOfMismatch == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "GlyphAtlas.h"
+
+
+/**
+ * @brief ġũ Բ ϴ  °   մϴ.
+ *
+ * @note   FileUtils Win32 API ϹǷ, 帮 ġũ ǥ ̺귯   մϴ.
+ */
+namespace BenchUtils
+{
+	/**
+	 * @brief  а ۿ մϴ.
+	 *
+	 * @param path  Դϴ.
+	 * @param outBuffer    Դϴ.
+	 *
+	 * @return  оٸ true, ׷  false ȯմϴ.
+	 */
+	inline bool ReadBufferFromFile(const std::filesystem::path& path, std::vector<uint8_t>& outBuffer)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file.is_open())
+		{
+			return false;
+		}
+
+		outBuffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		return true;
+	}
+
+
+	/**
+	 * @brief  нϴ.
+	 *
+	 * @param path  Դϴ.
+	 *
+	 * @return   ȯմϴ.    ٸ  ۸ ȯմϴ.
+	 */
+	inline std::vector<uint8_t> ReadBufferFromFile(const std::filesystem::path& path)
+	{
+		std::vector<uint8_t> buffer;
+		ReadBufferFromFile(path, buffer);
+
+		return buffer;
+	}
+
+
+	/**
+	 * @brief ۸ Ͽ ϴ.
+	 *
+	 * @param path  Դϴ.
+	 * @param buffer Ͽ  Դϴ.
+	 *
+	 * @return  ٸ true, ׷  false ȯմϴ.
+	 */
+	inline bool WriteBufferToFile(const std::filesystem::path& path, const std::vector<uint8_t>& buffer)
+	{
+		std::ofstream file(path, std::ios::binary);
+		if (!file.is_open())
+		{
+			return false;
+		}
+
+		file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+		return file.good();
+	}
+
+
+	/**
+	 * @brief  ۸  迭  ʵ  ˻մϴ.
+	 *
+	 * @param left  ۸  迭Դϴ.
+	 * @param right  ۸  迭Դϴ.
+	 *
+	 * @return  ۸ ʵ尡 ٸ true, ׷  false ȯմϴ.
+	 */
+	inline bool IsSameGlyphs(const std::vector<Glyph>& left, const std::vector<Glyph>& right)
+	{
+		if (left.size() != right.size())
+		{
+			return false;
+		}
+
+		for (std::size_t index = 0; index < left.size(); ++index)
+		{
+			const Glyph& l = left[index];
+			const Glyph& r = right[index];
+
+			if (l.codePoint != r.codePoint
+				|| l.position0.x != r.position0.x || l.position0.y != r.position0.y
+				|| l.position1.x != r.position1.x || l.position1.y != r.position1.y
+				|| l.xoffset != r.xoffset || l.yoffset != r.yoffset
+				|| l.xoffset2 != r.xoffset2 || l.yoffset2 != r.yoffset2
+				|| l.xadvance != r.xadvance)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,433 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "Box3D.h"
+#include "CollisionUtils.h"
+#include "CollisionWorld.h"
+#include "RandomStream.h"
+#include "Sphere3D.h"
+
+
+/**
+ * @brief ġũ  ɼԴϴ.
+ */
+struct BenchOption
+{
+	uint32_t spheres = 4096; // ϰ ˻   Դϴ.
+	uint32_t proxies = 2048; // 浹 忡  Ͻ Դϴ.
+	uint32_t ticks = 60;     // 浹   ƽ Դϴ.
+	uint64_t seed = 1;       //  õԴϴ.
+};
+
+
+/**
+ * @brief ϰ ˻翡  к 迭(SoA)   Դϴ.
+ */
+struct SphereBatch
+{
+	std::vector<float> cx; //   ߽ x ǥ Դϴ.
+	std::vector<float> cy; //   ߽ y ǥ Դϴ.
+	std::vector<float> cz; //   ߽ z ǥ Դϴ.
+	std::vector<float> r;  //    Դϴ.
+
+
+	/**
+	 * @brief   ߰մϴ.
+	 */
+	void Add(float x, float y, float z, float radius)
+	{
+		cx.push_back(x);
+		cy.push_back(y);
+		cz.push_back(z);
+		r.push_back(radius);
+	}
+
+
+	/**
+	 * @brief    ϴ.
+	 */
+	std::size_t GetSize() const { return cx.size(); }
+};
+
+
+/**
+ * @brief  ڷκ ġũ  ɼ нϴ.
+ *
+ * @param argc   Դϴ.
+ * @param argv   Դϴ.
+ * @param outOption   ɼԴϴ.
+ *
+ * @return  ڸ оٸ true, ׷  false ȯմϴ.
+ */
+bool ParseOption(int32_t argc, char** argv, BenchOption& outOption)
+{
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument.rfind("spheres=", 0) == 0)
+		{
+			outOption.spheres = static_cast<uint32_t>(std::stoul(argument.substr(8)));
+		}
+		else if (argument.rfind("proxies=", 0) == 0)
+		{
+			outOption.proxies = static_cast<uint32_t>(std::stoul(argument.substr(8)));
+		}
+		else if (argument.rfind("ticks=", 0) == 0)
+		{
+			outOption.ticks = static_cast<uint32_t>(std::stoul(argument.substr(6)));
+		}
+		else if (argument.rfind("seed=", 0) == 0)
+		{
+			outOption.seed = std::stoull(argument.substr(5));
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return outOption.spheres > 0 && outOption.proxies > 0 && outOption.ticks > 0;
+}
+
+
+/**
+ * @brief SIMD  ̸ ϴ.
+ */
+const char* GetSimdPathName(CollisionUtils::ESimdPath simdPath)
+{
+	switch (simdPath)
+	{
+	case CollisionUtils::ESimdPath::SSE2:
+		return "sse2";
+
+	case CollisionUtils::ESimdPath::AVX2:
+		return "avx2";
+
+	default:
+		return "scalar";
+	}
+}
+
+
+/**
+ * @brief NaN, 0, ϴ Ÿ   ϴ.
+ *
+ * @note     1,  ڴ [-1, 1]^3  մϴ.
+ */
+SphereBatch CreateEdgeBatch()
+{
+	const float nan = std::numeric_limits<float>::quiet_NaN();
+	const float inf = std::numeric_limits<float>::infinity();
+
+	SphereBatch batch;
+	batch.Add(+0.0f, +0.0f, +0.0f, +0.0f);
+	batch.Add(-0.0f, -0.0f, -0.0f, -0.0f);
+	batch.Add(2.0f, 0.0f, 0.0f, 1.0f);                                 //  Ȯ մϴ.
+	batch.Add(std::nextafter(2.0f, 3.0f), 0.0f, 0.0f, 1.0f);           //  ϴ Ÿ  ٴϴ.
+	batch.Add(0.0f, -2.5f, 0.0f, 1.5f);                                 //  Ȯ մϴ.
+	batch.Add(1.5f, 0.0f, 0.0f, 0.5f);                                  //   Ȯ մϴ.
+	batch.Add(std::nextafter(1.5f, 2.0f), 0.0f, 0.0f, 0.5f);           //   ϴ Ÿ  ٴϴ.
+	batch.Add(1.0f, 1.0f, 1.0f, 0.0f);                                  //    ֽϴ.
+	batch.Add(-1.0f, -0.0f, +0.0f, -0.0f);                              //    ֽϴ.
+	batch.Add(nan, 0.0f, 0.0f, 1.0f);
+	batch.Add(0.0f, nan, 0.0f, 1.0f);
+	batch.Add(0.0f, 0.0f, nan, 1.0f);
+	batch.Add(0.0f, 0.0f, 0.0f, nan);
+	batch.Add(inf, 0.0f, 0.0f, 1.0f);
+	batch.Add(0.0f, -inf, 0.0f, inf);
+	batch.Add(-2.0f, -0.0f, 0.0f, -1.0f);                               //   ״ մϴ.
+	batch.Add(0.5f, 0.5f, 0.5f, 0.25f);
+	return batch;
+}
+
+
+/**
+ * @brief ϰ ˻  Sphere3D::Intersect Ҹ  ˻մϴ.
+ *
+ * @param batch ˻   Դϴ.
+ * @param count տ ˻   Դϴ.
+ * @param shape 浹 ˻   Ǵ    Դϴ.
+ *
+ * @return  Ұ  count  Ҹ  ʾҴٸ true, ׷  false ȯմϴ.
+ */
+bool IsSameAsScalar(const SphereBatch& batch, std::size_t count, const IShape3D& shape)
+{
+	const uint8_t UNTOUCHED = 0xCD;
+	std::vector<uint8_t> hits(count + 8, UNTOUCHED);
+
+	if (shape.GetType() == IShape3D::EType::Sphere)
+	{
+		CollisionUtils::IntersectSpheresVsSphere(batch.cx.data(), batch.cy.data(), batch.cz.data(), batch.r.data(), count, static_cast<const Sphere3D&>(shape), hits.data());
+	}
+	else
+	{
+		CollisionUtils::IntersectSpheresVsBox(batch.cx.data(), batch.cy.data(), batch.cz.data(), batch.r.data(), count, static_cast<const Box3D&>(shape), hits.data());
+	}
+
+	for (std::size_t index = 0; index < count; ++index)
+	{
+		Sphere3D sphere(Vector3f(batch.cx[index], batch.cy[index], batch.cz[index]), batch.r[index]);
+		uint8_t expected = sphere.Intersect(&shape) ? 1 : 0;
+		if (hits[index] != expected)
+		{
+			return false;
+		}
+	}
+
+	for (std::size_t index = count; index < hits.size(); ++index)
+	{
+		if (hits[index] != UNTOUCHED)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief  Ͻ   ˻ؼ 浹   ϴ.
+ *
+ * @param shapes Ͻø  Դϴ.
+ * @param layers Ͻø  ̾Դϴ.
+ * @param masks Ͻø  ũԴϴ.
+ *
+ * @return ( Ͻ, ū Ͻ)  ĵ 浹   ȯմϴ.
+ */
+std::vector<uint64_t> ComputeBruteForcePairs(const std::vector<const IShape3D*>& shapes, const std::vector<uint32_t>& layers, const std::vector<uint32_t>& masks)
+{
+	std::vector<uint64_t> pairs;
+	for (uint32_t i = 0; i < shapes.size(); ++i)
+	{
+		for (uint32_t j = i + 1; j < shapes.size(); ++j)
+		{
+			bool bShouldCollide = (layers[i] & masks[j]) != 0 && (layers[j] & masks[i]) != 0;
+			if (bShouldCollide && shapes[i]->Intersect(shapes[j]))
+			{
+				pairs.push_back((static_cast<uint64_t>(i) << 32) | j);
+			}
+		}
+	}
+
+	return pairs;
+}
+
+
+/**
+ * @brief 浹  浹   ĵ Ű  ٲߴϴ.
+ *
+ * @param collisionWorld 浹   浹 Դϴ.
+ *
+ * @return ( Ͻ, ū Ͻ)  ĵ 浹   ȯմϴ.
+ */
+std::vector<uint64_t> GetSortedPairs(const CollisionWorld& collisionWorld)
+{
+	std::vector<uint64_t> pairs;
+	for (const auto& pair : collisionWorld.GetCollisionPairs())
+	{
+		pairs.push_back((static_cast<uint64_t>(pair.proxyA) << 32) | pair.proxyB);
+	}
+
+	std::sort(pairs.begin(), pairs.end());
+	return pairs;
+}
+
+
+int main(int argc, char** argv)
+{
+	BenchOption option;
+	if (!ParseOption(argc, argv, option))
+	{
+		std::fprintf(stderr, "usage : Dodge3DCollisionBench [spheres=4096] [proxies=2048] [ticks=60] [seed=1]\n");
+		return 1;
+	}
+
+	std::printf("Dodge3DCollisionBench\n");
+
+	int32_t countOfMismatch = 0;
+	auto check = [&](const std::string& name, bool bIsMatch)
+	{
+		if (!bIsMatch)
+		{
+			std::printf("  mismatch %s\n", name.c_str());
+			countOfMismatch++;
+		}
+	};
+
+	const CollisionUtils::ESimdPath supportSimdPath = CollisionUtils::GetSupportSimdPath();
+	std::vector<CollisionUtils::ESimdPath> simdPaths = { CollisionUtils::ESimdPath::Scalar };
+	for (CollisionUtils::ESimdPath simdPath : { CollisionUtils::ESimdPath::SSE2, CollisionUtils::ESimdPath::AVX2 })
+	{
+		if (static_cast<int32_t>(simdPath) <= static_cast<int32_t>(supportSimdPath))
+		{
+			simdPaths.push_back(simdPath);
+		}
+		else
+		{
+			std::printf("  skip %s : not supported by this cpu\n", GetSimdPathName(simdPath));
+		}
+	}
+
+	const float nan = std::numeric_limits<float>::quiet_NaN();
+	const std::vector<Sphere3D> querySpheres = {
+		Sphere3D(Vector3f(0.0f, 0.0f, 0.0f), 1.0f),
+		Sphere3D(Vector3f(-0.0f, -0.0f, -0.0f), -0.0f),
+		Sphere3D(Vector3f(0.0f, nan, 0.0f), 1.0f),
+		Sphere3D(Vector3f(0.0f, 0.0f, 0.0f), nan),
+	};
+	const std::vector<Box3D> queryBoxes = {
+		Box3D(Vector3f(0.0f, 0.0f, 0.0f), Vector3f(1.0f, 1.0f, 1.0f)),
+		Box3D(Vector3f(-0.0f, 0.0f, -0.0f), Vector3f(0.0f, 0.0f, 0.0f)),
+		Box3D(Vector3f(nan, 0.0f, 0.0f), Vector3f(1.0f, 1.0f, 1.0f)),
+		Box3D(Vector3f(0.0f, 0.0f, 0.0f), Vector3f(1.0f, nan, 1.0f)),
+	};
+
+	//    տ 谪 ΰ, 4 8  ƴ  ߶  ó Բ ˻մϴ.
+	SphereBatch batch = CreateEdgeBatch();
+	RandomStream random(option.seed);
+	while (batch.GetSize() < option.spheres)
+	{
+		batch.Add(random.NextFloat(-3.0f, 3.0f), random.NextFloat(-3.0f, 3.0f), random.NextFloat(-3.0f, 3.0f), random.NextFloat(0.0f, 1.5f));
+	}
+
+	std::vector<std::size_t> counts = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 11, 12, 13, 15, 16, 17, 23, 31, 33, 63, 65, 127, batch.GetSize() - 1, batch.GetSize() };
+
+	for (CollisionUtils::ESimdPath simdPath : simdPaths)
+	{
+		CollisionUtils::SetSimdPath(simdPath);
+		const std::string pathName = GetSimdPathName(simdPath);
+		check(pathName + " forced", CollisionUtils::GetSimdPath() == simdPath);
+
+		bool bIsSameSphere = true;
+		bool bIsSameBox = true;
+		for (std::size_t count : counts)
+		{
+			for (const auto& sphere : querySpheres)
+			{
+				bIsSameSphere = bIsSameSphere && IsSameAsScalar(batch, count, sphere);
+			}
+
+			for (const auto& box : queryBoxes)
+			{
+				bIsSameBox = bIsSameBox && IsSameAsScalar(batch, count, box);
+			}
+		}
+
+		check(pathName + " spheres vs sphere", bIsSameSphere);
+		check(pathName + " spheres vs box", bIsSameBox);
+	}
+
+	// Ѿó  ̾    ,   ϰ ˻簡  SIMD ο  ˻   ã ˻մϴ.
+	const uint32_t BULLET_LAYER = 1 << 0;
+	const uint32_t PLAYER_LAYER = 1 << 1;
+	const uint32_t WALL_LAYER = 1 << 2;
+	const uint32_t DEBRIS_LAYER = 1 << 3;
+	const float WORLD_EXTENT = 6.0f;
+
+	std::vector<Sphere3D> spheres(option.proxies);
+	std::vector<Box3D> boxes(option.proxies);
+	std::vector<bool> bIsBoxes(option.proxies);
+	std::vector<uint32_t> layers(option.proxies);
+	std::vector<uint32_t> masks(option.proxies);
+
+	double narrowphaseMilliseconds[3] = { 0.0, 0.0, 0.0 };
+	uint64_t countOfPair = 0;
+
+	for (CollisionWorld::EBroadphase broadphase : { CollisionWorld::EBroadphase::UniformGrid, CollisionWorld::EBroadphase::SweepAndPrune })
+	{
+		const std::string broadphaseName = (broadphase == CollisionWorld::EBroadphase::UniformGrid) ? "grid" : "sweep";
+
+		for (CollisionUtils::ESimdPath simdPath : simdPaths)
+		{
+			CollisionUtils::SetSimdPath(simdPath);
+			const std::string pathName = GetSimdPathName(simdPath);
+
+			CollisionWorld collisionWorld;
+			collisionWorld.Initialize(broadphase, Vector3f(-WORLD_EXTENT, -1.0f, -WORLD_EXTENT), Vector3f(+WORLD_EXTENT, +2.0f, +WORLD_EXTENT), 1.0f);
+
+			RandomStream proxyRandom(option.seed, 1);
+			std::vector<uint32_t> proxies(option.proxies);
+			for (uint32_t index = 0; index < option.proxies; ++index)
+			{
+				uint32_t kind = proxyRandom.NextUInt32() % 16;
+				Vector3f center(proxyRandom.NextFloat(-5.0f, 5.0f), proxyRandom.NextFloat(0.0f, 1.0f), proxyRandom.NextFloat(-5.0f, 5.0f));
+
+				bIsBoxes[index] = (kind == 0);
+				if (kind == 0)
+				{
+					layers[index] = WALL_LAYER;
+					masks[index] = BULLET_LAYER | PLAYER_LAYER;
+					boxes[index] = Box3D(center, Vector3f(proxyRandom.NextFloat(0.1f, 1.0f), 0.5f, proxyRandom.NextFloat(0.1f, 1.0f)));
+					proxies[index] = collisionWorld.CreateBoxProxy(boxes[index], layers[index], masks[index], index);
+				}
+				else
+				{
+					layers[index] = (kind == 1) ? PLAYER_LAYER : ((kind == 2) ? DEBRIS_LAYER : BULLET_LAYER);
+					masks[index] = (kind == 1) ? (BULLET_LAYER | WALL_LAYER) : ((kind == 2) ? DEBRIS_LAYER : (PLAYER_LAYER | WALL_LAYER));
+					spheres[index] = Sphere3D(center, proxyRandom.NextFloat(0.05f, 0.4f));
+					proxies[index] = collisionWorld.CreateSphereProxy(spheres[index], layers[index], masks[index], index);
+				}
+			}
+
+			bool bIsSameEveryTick = true;
+			bool bIsSameProxy = true;
+			for (uint32_t tick = 0; tick < option.ticks; ++tick)
+			{
+				std::vector<const IShape3D*> shapes(option.proxies);
+				for (uint32_t index = 0; index < option.proxies; ++index)
+				{
+					bIsSameProxy = bIsSameProxy && (proxies[index] == index);
+					if (bIsBoxes[index])
+					{
+						shapes[index] = &boxes[index];
+						continue;
+					}
+
+					Vector3f center = spheres[index].GetCenter();
+					center.x = std::clamp(center.x + proxyRandom.NextFloat(-0.2f, 0.2f), -5.5f, 5.5f);
+					center.z = std::clamp(center.z + proxyRandom.NextFloat(-0.2f, 0.2f), -5.5f, 5.5f);
+					spheres[index] = Sphere3D(center, spheres[index].GetRadius());
+					collisionWorld.UpdateSphereProxy(proxies[index], center);
+					shapes[index] = &spheres[index];
+				}
+
+				auto startTime = std::chrono::steady_clock::now();
+				collisionWorld.Tick(0.0f);
+				auto endTime = std::chrono::steady_clock::now();
+				if (broadphase == CollisionWorld::EBroadphase::UniformGrid)
+				{
+					narrowphaseMilliseconds[static_cast<int32_t>(simdPath)] += std::chrono::duration<double, std::milli>(endTime - startTime).count();
+				}
+
+				std::vector<uint64_t> pairs = GetSortedPairs(collisionWorld);
+				std::vector<uint64_t> expectedPairs = ComputeBruteForcePairs(shapes, layers, masks);
+				bIsSameEveryTick = bIsSameEveryTick && (pairs == expectedPairs);
+				countOfPair += pairs.size();
+			}
+
+			check(broadphaseName + " " + pathName + " proxy index", bIsSameProxy);
+			check(broadphaseName + " " + pathName + " pairs vs brute force", bIsSameEveryTick);
+
+			collisionWorld.Release();
+		}
+	}
+
+	check("pairs found", countOfPair > 0);
+	CollisionUtils::SetSimdPath(supportSimdPath);
+
+	std::printf("  support simd path %s, spheres %u, proxies %u, ticks %u\n", GetSimdPathName(supportSimdPath), option.spheres, option.proxies, option.ticks);
+	for (CollisionUtils::ESimdPath simdPath : simdPaths)
+	{
+		std::printf("  grid tick %-6s : %7.3f ms/tick\n", GetSimdPathName(simdPath), narrowphaseMilliseconds[static_cast<int32_t>(simdPath)] / static_cast<double>(option.ticks));
+	}
+
+	std::printf("  result : %s\n", (countOfMismatch == 0) ? "ok" : "mismatch");
+	return (countOfMismatch == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,425 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "EntityComponents.h"
+#include "EntityWorld.h"
+#include "GeometryGenerator.h"
+#include "JobSystem.h"
+#include "MathUtils.h"
+#include "ObjectManager.h"
+#include "RandomStream.h"
+#include "ResourceManager.h"
+#include "Sphere3D.h"
+#include "Transform.h"
+
+#include "GameObject.h"
+#include "PlayComponents.h"
+
+using namespace EntityComponents;
+using namespace PlayComponents;
+
+
+/**
+ * @brief ƼƼ  ġũ  ɼԴϴ.
+ */
+struct BenchOption
+{
+	uint32_t frames = 120;   //   Դϴ.
+	uint32_t grain = 2048;   //  ȸ  ۾ ó ƼƼ Դϴ.
+	int32_t workers = -1;    //  带  ۾  Դϴ.   ý ⺻ մϴ.
+};
+
+
+/**
+ * @brief  ӿ ׸ ޽ ϳ Դϴ.
+ */
+struct DrawItem
+{
+	StaticMesh* mesh;     // ׸ ޽Դϴ.
+	Material* material;   // ޽ø ׸   Դϴ.
+	Matrix4x4f world;     // ޽  Դϴ.
+};
+
+
+/**
+ * @brief  Ʈ ƮԴϴ.
+ *
+ * @note ƼƼ   Ÿ Ʈ     Ƿ μ մϴ.
+ */
+struct PrevTransform
+{
+	Transform transform; //  Ʈ ƮԴϴ.
+};
+
+
+/**
+ * @brief Ѿ ̴   ʺԴϴ. 踦  Ѿ ݴ ̵մϴ.
+ */
+static const float ARENA_EXTENT = 50.0f;
+
+
+/**
+ * @brief  ùķ̼ Դϴ.
+ */
+static const float FIXED_DELTA_SECONDS = 1.0f / 60.0f;
+
+
+/**
+ * @brief Ѿ ġ  ܰ ̵մϴ.
+ *
+ * @param location ̵ ġԴϴ.
+ * @param direction ̵ Դϴ.
+ * @param speed ̵ ӷԴϴ.
+ *
+ * @return ̵ ġ ȯմϴ.
+ *
+ * @note Ʈ 𵨰 ƼƼ    ϵ մϴ.
+ */
+inline Vector3f MoveBullet(Vector3f location, const Vector3f& direction, float speed)
+{
+	location.x += FIXED_DELTA_SECONDS * direction.x * speed;
+	location.z += FIXED_DELTA_SECONDS * direction.z * speed;
+
+	if (location.x < -ARENA_EXTENT) location.x += 2.0f * ARENA_EXTENT;
+	if (location.x > +ARENA_EXTENT) location.x -= 2.0f * ARENA_EXTENT;
+	if (location.z < -ARENA_EXTENT) location.z += 2.0f * ARENA_EXTENT;
+	if (location.z > +ARENA_EXTENT) location.z -= 2.0f * ARENA_EXTENT;
+
+	return location;
+}
+
+
+/**
+ * @brief  Ʈ  ѾԴϴ.
+ *
+ * @note  Ʈó Ʈ Ŵ Ҵϰ,  Tick   մϴ.
+ */
+class BenchBullet : public GameObject
+{
+public:
+	/**
+	 * @brief ġũ Ѿ Ʈ Դϴ.
+	 */
+	BenchBullet() = default;
+
+
+	/**
+	 * @brief ġũ Ѿ  ҸԴϴ.
+	 */
+	virtual ~BenchBullet() {}
+
+
+	/**
+	 * @brief ġũ Ѿ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(BenchBullet);
+
+
+	/**
+	 * @brief ġũ Ѿ ʱȭմϴ.
+	 *
+	 * @param location Ѿ ġԴϴ.
+	 * @param direction Ѿ ̵ Դϴ.
+	 * @param speed Ѿ ̵ ӷԴϴ.
+	 * @param mesh Ѿ ޽Դϴ.
+	 * @param material Ѿ Դϴ.
+	 */
+	void Initialize(const Vector3f& location, const Vector3f& direction, float speed, StaticMesh* mesh, Material* material)
+	{
+		transform_ = Transform(location, Vector3f(0.0f, 0.0f, 0.0f), Vector3f(0.2f, 0.2f, 0.2f));
+		prevTransform_ = transform_;
+		boundingVolume_ = Sphere3D(location, 0.2f);
+		direction_ = direction;
+		speed_ = speed;
+		mesh_ = mesh;
+		material_ = material;
+
+		bIsInitialized_ = true;
+	}
+
+
+	/**
+	 * @brief ġũ Ѿ  ܰ ̵մϴ.
+	 *
+	 * @param deltaSeconds Ÿ ð Դϴ.
+	 */
+	virtual void Tick(float deltaSeconds) override
+	{
+		Vector3f location = MoveBullet(transform_.GetLocation(), direction_, speed_);
+
+		transform_.SetLocation(location);
+		boundingVolume_.SetCenter(location);
+	}
+
+
+	/**
+	 * @brief ġũ Ѿ  ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override
+	{
+		bIsInitialized_ = false;
+	}
+
+
+	/**
+	 * @brief ġũ Ѿ   ϴ.
+	 *
+	 * @return ġũ Ѿ   ȯմϴ.
+	 */
+	virtual const IShape3D* GetBoundingVolume() const override { return &boundingVolume_; }
+
+
+private:
+	/**
+	 * @brief ġũ Ѿ  Դϴ.
+	 */
+	Sphere3D boundingVolume_;
+
+
+	/**
+	 * @brief ġũ Ѿ ̵ Դϴ.
+	 */
+	Vector3f direction_;
+
+
+	/**
+	 * @brief ġũ Ѿ ̵ ӷԴϴ.
+	 */
+	float speed_ = 0.0f;
+};
+
+
+/**
+ * @brief  ڸ Ľմϴ.
+ *
+ * @param argc   Դϴ.
+ * @param argv   Դϴ.
+ * @param outOption Ľ  ɼԴϴ.
+ *
+ * @return  ڸ Ľߴٸ true, ׷  false ȯմϴ.
+ */
+bool ParseOption(int32_t argc, char** argv, BenchOption& outOption)
+{
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		std::size_t separator = argument.find('=');
+		if (separator == std::string::npos)
+		{
+			return false;
+		}
+
+		std::string key = argument.substr(0, separator);
+		const char* value = argument.c_str() + separator + 1;
+
+		if (key == "frames")
+		{
+			outOption.frames = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+		}
+		else if (key == "grain")
+		{
+			outOption.grain = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+		}
+		else if (key == "workers")
+		{
+			outOption.workers = static_cast<int32_t>(std::strtol(value, nullptr, 10));
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return outOption.frames > 0 && outOption.grain > 0;
+}
+
+
+/**
+ * @brief  Լ   ϰ Ӵ  ð մϴ.
+ *
+ * @param frames   Դϴ.
+ * @param frame   ϴ ԼԴϴ.
+ *
+ * @return Ӵ  ð(и) ȯմϴ.
+ */
+template <typename TFrame>
+double MeasureFrame(uint32_t frames, TFrame&& frame)
+{
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint32_t count = 0; count < frames; ++count)
+	{
+		frame();
+	}
+	auto endTime = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::milli>(endTime - startTime).count() / static_cast<double>(frames);
+}
+
+
+/**
+ * @brief ׸ ޽  ġ  մϴ.
+ *
+ * @param drawItems ׸ ޽ Դϴ.
+ *
+ * @return ġ  ȯմϴ.       մϴ.
+ */
+double ComputeChecksum(const std::vector<DrawItem>& drawItems)
+{
+	double checksum = 0.0;
+	for (const auto& drawItem : drawItems)
+	{
+		checksum += static_cast<double>(drawItem.world.m[3][0] + drawItem.world.m[3][2]);
+	}
+
+	return checksum;
+}
+
+
+int main(int argc, char** argv)
+{
+	BenchOption option;
+	if (!ParseOption(argc, argv, option))
+	{
+		std::fprintf(stderr, "usage : Dodge3DEntityBench [frames=120] [grain=2048] [workers=-1]\n");
+		return 1;
+	}
+
+	if (option.workers >= 0)
+	{
+		JobSystem::Get().SetCountOfWorker(static_cast<uint32_t>(option.workers));
+	}
+
+	JobSystem::Get().Startup();
+	ResourceManager::Get().Startup();
+	ObjectManager::Get().Startup();
+
+	std::vector<Vertex> vertices;
+	std::vector<uint32_t> indices;
+	GeometryGenerator::CreateSphere(1.0f, 40, vertices, indices);
+
+	StaticMesh* mesh = ResourceManager::Get().CreateResource<StaticMesh>("BulletMesh");
+	mesh->Initialize(vertices, indices);
+
+	Material* material = ResourceManager::Get().CreateResource<Material>("BulletMaterial");
+	material->Initialize(Vector3f(0.19225f, 0.19225f, 0.19225f), Vector3f(0.50754f, 0.50754f, 0.50754f), Vector3f(0.508273f, 0.508273f, 0.508273f), 0.4f * 128.0f);
+
+	std::printf("Dodge3DEntityBench\n");
+	std::printf("  frames             : %u\n", option.frames);
+	std::printf("  job workers        : %u\n", JobSystem::Get().GetCountOfWorker());
+	std::printf("  frame              : move + record prev transform + gather draw list\n");
+
+	static const uint32_t COUNT_OF_BULLETS[] = { 1000, 10000, 100000 };
+	for (const auto& countOfBullet : COUNT_OF_BULLETS)
+	{
+		std::vector<DrawItem> drawItems;
+		drawItems.reserve(countOfBullet);
+
+		// Ʈ  : Ʈ  Tick ȣϰ,  Ʈ ڷ ׸  ϴ.
+		RandomStream objectRandomStream(countOfBullet);
+		std::vector<GameObject*> objects;
+		objects.reserve(countOfBullet);
+
+		for (uint32_t index = 0; index < countOfBullet; ++index)
+		{
+			Vector3f location(objectRandomStream.NextFloat(-ARENA_EXTENT, ARENA_EXTENT), 0.5f, objectRandomStream.NextFloat(-ARENA_EXTENT, ARENA_EXTENT));
+			Vector3f direction = MathUtils::Normalize(Vector3f(objectRandomStream.NextFloat(-1.0f, 1.0f), 0.0f, objectRandomStream.NextFloat(-1.0f, 1.0f)));
+			float speed = objectRandomStream.NextFloat(2.0f, 5.0f);
+
+			BenchBullet* bullet = ObjectManager::Get().CreateObject<BenchBullet>("Bullet_" + std::to_string(index));
+			bullet->Initialize(location, direction, speed, mesh, material);
+			objects.push_back(bullet);
+		}
+
+		double objectMilliseconds = MeasureFrame(option.frames,
+			[&]()
+			{
+				for (auto& object : objects)
+				{
+					object->RecordPrevTransform();
+					object->Tick(FIXED_DELTA_SECONDS);
+				}
+
+				drawItems.clear();
+				for (const auto& object : objects)
+				{
+					drawItems.push_back(DrawItem{ object->GetMesh(), object->GetMaterial(), object->GetTransform().GetWorldMatrix() });
+				}
+			}
+		);
+		double objectChecksum = ComputeChecksum(drawItems);
+
+		for (auto& object : objects)
+		{
+			ObjectManager::Get().DestroyObject(object->GetHandle());
+		}
+		ObjectManager::Get().FlushDestroyedObjects();
+
+		// ƼƼ  :  ͸ ŰŸ 迭 ϰ ý 迭 ʷ ȸմϴ.
+		RandomStream entityRandomStream(countOfBullet);
+		EntityWorld* entityWorld = ObjectManager::Get().CreateObject<EntityWorld>("EntityWorld");
+		entityWorld->Initialize();
+		entityWorld->Reserve<Transform, PrevTransform, Sphere3D, BulletMotion, RenderRef>(countOfBullet);
+
+		for (uint32_t index = 0; index < countOfBullet; ++index)
+		{
+			Vector3f location(entityRandomStream.NextFloat(-ARENA_EXTENT, ARENA_EXTENT), 0.5f, entityRandomStream.NextFloat(-ARENA_EXTENT, ARENA_EXTENT));
+			Vector3f direction = MathUtils::Normalize(Vector3f(entityRandomStream.NextFloat(-1.0f, 1.0f), 0.0f, entityRandomStream.NextFloat(-1.0f, 1.0f)));
+			float speed = entityRandomStream.NextFloat(2.0f, 5.0f);
+
+			Transform transform(location, Vector3f(0.0f, 0.0f, 0.0f), Vector3f(0.2f, 0.2f, 0.2f));
+			entityWorld->CreateEntity(transform, PrevTransform{ transform }, Sphere3D(location, 0.2f), BulletMotion{ direction, speed }, RenderRef{ mesh, material });
+		}
+
+		auto tickEntities = [&](bool bIsParallel)
+		{
+			auto move = [](Transform& transform, PrevTransform& prevTransform, Sphere3D& bound, const BulletMotion& motion)
+			{
+				prevTransform.transform = transform;
+
+				Vector3f location = MoveBullet(transform.GetLocation(), motion.direction, motion.speed);
+				transform.SetLocation(location);
+				bound.SetCenter(location);
+			};
+
+			if (bIsParallel)
+			{
+				entityWorld->ParallelForEach<Transform, PrevTransform, Sphere3D, BulletMotion>(option.grain, move);
+			}
+			else
+			{
+				entityWorld->ForEach<Transform, PrevTransform, Sphere3D, BulletMotion>(move);
+			}
+
+			drawItems.clear();
+			entityWorld->ForEach<Transform, RenderRef>(
+				[&](const Transform& transform, const RenderRef& renderRef)
+				{
+					drawItems.push_back(DrawItem{ renderRef.mesh, renderRef.material, transform.GetWorldMatrix() });
+				}
+			);
+		};
+
+		double entityMilliseconds = MeasureFrame(option.frames, [&]() { tickEntities(false); });
+		double entityChecksum = ComputeChecksum(drawItems);
+
+		double parallelMilliseconds = MeasureFrame(option.frames, [&]() { tickEntities(true); });
+
+		ObjectManager::Get().DestroyObject(entityWorld->GetHandle());
+		ObjectManager::Get().FlushDestroyedObjects();
+
+		std::printf("  bullets %-7u\n", countOfBullet);
+		std::printf("    object model     : %8.3f ms/frame (checksum %.3f)\n", objectMilliseconds, objectChecksum);
+		std::printf("    entity serial    : %8.3f ms/frame (checksum %.3f), %.2fx\n", entityMilliseconds, entityChecksum, objectMilliseconds / entityMilliseconds);
+		std::printf("    entity parallel  : %8.3f ms/frame, %.2fx\n", parallelMilliseconds, objectMilliseconds / parallelMilliseconds);
+	}
+
+	ObjectManager::Get().Shutdown();
+	ResourceManager::Get().Shutdown();
+	JobSystem::Get().Shutdown();
+
+	return 0;
+}
\ No newline at end of file
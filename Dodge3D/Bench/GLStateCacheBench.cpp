@@ -0,0 +1,550 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+
+#include "GLStateCache.h"
+#include "RandomStream.h"
+
+
+/**
+ * @brief OpenGL    GL_TEXTURE_2D Դϴ.
+ */
+static const uint32_t TEXTURE_2D = 0x0DE1;
+
+
+/**
+ * @brief OpenGL    GL_TEXTURE_CUBE_MAP Դϴ.
+ */
+static const uint32_t TEXTURE_CUBE_MAP = 0x8513;
+
+
+/**
+ * @brief OpenGL    GL_ARRAY_BUFFER Դϴ.
+ */
+static const uint32_t ARRAY_BUFFER = 0x8892;
+
+
+/**
+ * @brief OpenGL    GL_COPY_WRITE_BUFFER Դϴ.
+ */
+static const uint32_t COPY_WRITE_BUFFER = 0x8F37;
+
+
+/**
+ * @brief OpenGL    GL_DEPTH_TEST Դϴ.
+ */
+static const uint32_t DEPTH_TEST = 0x0B71;
+
+
+/**
+ * @brief OpenGL    GL_BLEND Դϴ.
+ */
+static const uint32_t BLEND = 0x0BE2;
+
+
+/**
+ * @brief OpenGL    GL_CULL_FACE Դϴ.
+ */
+static const uint32_t CULL_FACE = 0x0B44;
+
+
+/**
+ * @brief OpenGL    GL_LESS Դϴ.
+ */
+static const uint32_t LESS = 0x0201;
+
+
+/**
+ * @brief OpenGL    GL_LEQUAL Դϴ.
+ */
+static const uint32_t LEQUAL = 0x0203;
+
+
+/**
+ * @brief OpenGL    GL_FRONT Դϴ.
+ */
+static const uint32_t FRONT = 0x0404;
+
+
+/**
+ * @brief OpenGL    GL_BACK Դϴ.
+ */
+static const uint32_t BACK = 0x0405;
+
+
+/**
+ * @brief OpenGL      GL_ZERO, GL_ONE, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA Դϴ.
+ */
+static const uint32_t BLEND_FACTORS[4] = { 0x0000, 0x0001, 0x0302, 0x0303 };
+
+
+/**
+ * @brief ¥ OpenGL ؽƮ     ¸ Ÿ Դϴ.
+ */
+static const uint32_t UNSET = 0xFFFFFFFF;
+
+
+/**
+ * @brief ġũ  ɼԴϴ.
+ */
+struct BenchOption
+{
+	uint32_t operations = 200000; //    ȣ Դϴ.
+	uint32_t objects = 512;       //  ӿ ׸ Ʈ Դϴ.
+	uint32_t frames = 240;        //   Դϴ.
+	uint64_t seed = 1;            //    ȣ õԴϴ.
+};
+
+
+/**
+ * @brief OpenGL ¸ 䳻    ȣ  ¥ OpenGL ؽƮԴϴ.
+ *
+ * @note
+ * - ޼ ̸ OpenGL  ĳÿ Ƿ,  ȣ  ĳÿ ¥ ؽƮ ״   ֽϴ.
+ * - ¸ ٲ ʴ ȣ ߺ ȣ ϴ.     ¿  ȣ ߺ ȣ ƴմϴ.
+ * - Ʈ  OpenGL  ε Ʈ 0 ǵ,   α׷   · Ӵϴ.
+ */
+struct MockContext
+{
+	uint32_t program = UNSET;                               //   ̴ α׷Դϴ.
+	uint32_t vertexArray = UNSET;                           // ε  迭 ƮԴϴ.
+	uint32_t framebuffer = UNSET;                           // ε  Դϴ.
+	uint32_t activeTextureUnit = UNSET;                     // Ȱȭ ؽó Դϴ.
+	uint32_t depthFunc = UNSET;                             //   ԼԴϴ.
+	uint32_t cullFace = UNSET;                              // ø Դϴ.
+	uint32_t blendFunc[4] = { UNSET, UNSET, UNSET, UNSET }; //  Դϴ.
+	int32_t viewport[4] = { 0, 0, 0, 0 };                   // ƮԴϴ.
+	bool bIsSetViewport = false;                            // Ʈ ߴ Դϴ.
+	std::map<uint32_t, uint32_t> buffers;                   // 󺰷 ε Դϴ.
+	std::map<uint64_t, uint32_t> textures;                  // ؽó ְ 󺰷 ε ؽóԴϴ.
+	std::map<uint32_t, bool> capabilities;                  // ɺ Ȱȭ Դϴ.
+	uint32_t countOfCall = 0;                               //   ȣ Դϴ.
+	uint32_t countOfRedundantCall = 0;                      // ¸ ٲ  ȣ Դϴ.
+
+	void Record(bool bIsChanged)
+	{
+		countOfCall++;
+		countOfRedundantCall += bIsChanged ? 0 : 1;
+	}
+
+	template <typename TKey, typename TValue>
+	void Set(std::map<TKey, TValue>& states, TKey key, TValue value)
+	{
+		auto state = states.find(key);
+		Record(state == states.end() || state->second != value);
+		states[key] = value;
+	}
+
+	void UseProgram(uint32_t value) { Record(program != value); program = value; }
+	void BindVertexArray(uint32_t value) { Record(vertexArray != value); vertexArray = value; }
+	void BindBuffer(uint32_t target, uint32_t buffer) { Set(buffers, target, buffer); }
+	void ActiveTexture(uint32_t unit) { Record(activeTextureUnit != unit); activeTextureUnit = unit; }
+	void BindTexture(uint32_t target, uint32_t texture) { Set(textures, (static_cast<uint64_t>(activeTextureUnit) << 32) | target, texture); }
+	void BindTexture(uint32_t unit, uint32_t target, uint32_t texture) { ActiveTexture(unit); BindTexture(target, texture); }
+	void BindFramebuffer(uint32_t value) { Record(framebuffer != value); framebuffer = value; }
+	void SetCapability(uint32_t capability, bool bIsEnable) { Set(capabilities, capability, bIsEnable); }
+	void SetDepthFunc(uint32_t value) { Record(depthFunc != value); depthFunc = value; }
+	void SetCullFace(uint32_t value) { Record(cullFace != value); cullFace = value; }
+
+	void SetViewport(int32_t x, int32_t y, int32_t width, int32_t height)
+	{
+		Record(!bIsSetViewport || viewport[0] != x || viewport[1] != y || viewport[2] != width || viewport[3] != height);
+		viewport[0] = x;
+		viewport[1] = y;
+		viewport[2] = width;
+		viewport[3] = height;
+		bIsSetViewport = true;
+	}
+
+	void SetBlendFunc(uint32_t srcRGB, uint32_t dstRGB, uint32_t srcAlpha, uint32_t dstAlpha)
+	{
+		Record(blendFunc[0] != srcRGB || blendFunc[1] != dstRGB || blendFunc[2] != srcAlpha || blendFunc[3] != dstAlpha);
+		blendFunc[0] = srcRGB;
+		blendFunc[1] = dstRGB;
+		blendFunc[2] = srcAlpha;
+		blendFunc[3] = dstAlpha;
+	}
+
+	void DeleteProgram(uint32_t value) { program = (program == value) ? UNSET : program; }
+	void DeleteVertexArray(uint32_t value) { vertexArray = (vertexArray == value) ? 0 : vertexArray; }
+	void DeleteFramebuffer(uint32_t value) { framebuffer = (framebuffer == value) ? 0 : framebuffer; }
+
+	void DeleteBuffer(uint32_t value)
+	{
+		for (auto& binding : buffers)
+		{
+			binding.second = (binding.second == value) ? 0 : binding.second;
+		}
+	}
+
+	void DeleteTexture(uint32_t value)
+	{
+		for (auto& binding : textures)
+		{
+			binding.second = (binding.second == value) ? 0 : binding.second;
+		}
+	}
+};
+
+
+/**
+ * @brief  ĳð ȣϴ ¥ OpenGL ؽƮԴϴ.
+ */
+static MockContext cachedContext;
+
+
+/**
+ * @brief  ĳð ¥ OpenGL ؽƮ ȣϵ ϴ Լ ̺ մϴ.
+ *
+ * @return ¥ OpenGL ؽƮ ȣϴ Լ ̺ ȯմϴ.
+ */
+GLFunctionTable CreateMockFunctionTable()
+{
+	GLFunctionTable functions;
+
+	functions.useProgram = [](uint32_t program) { cachedContext.UseProgram(program); };
+	functions.bindVertexArray = [](uint32_t vertexArray) { cachedContext.BindVertexArray(vertexArray); };
+	functions.bindBuffer = [](uint32_t target, uint32_t buffer) { cachedContext.BindBuffer(target, buffer); };
+	functions.activeTexture = [](uint32_t unit) { cachedContext.ActiveTexture(unit); };
+	functions.bindTexture = [](uint32_t target, uint32_t texture) { cachedContext.BindTexture(target, texture); };
+	functions.bindFramebuffer = [](uint32_t framebuffer) { cachedContext.BindFramebuffer(framebuffer); };
+	functions.viewport = [](int32_t x, int32_t y, int32_t width, int32_t height) { cachedContext.SetViewport(x, y, width, height); };
+	functions.enable = [](uint32_t capability) { cachedContext.SetCapability(capability, true); };
+	functions.disable = [](uint32_t capability) { cachedContext.SetCapability(capability, false); };
+	functions.blendFuncSeparate = [](uint32_t srcRGB, uint32_t dstRGB, uint32_t srcAlpha, uint32_t dstAlpha) { cachedContext.SetBlendFunc(srcRGB, dstRGB, srcAlpha, dstAlpha); };
+	functions.depthFunc = [](uint32_t func) { cachedContext.SetDepthFunc(func); };
+	functions.cullFace = [](uint32_t mode) { cachedContext.SetCullFace(mode); };
+	functions.deleteProgram = [](uint32_t program) { cachedContext.DeleteProgram(program); };
+	functions.deleteVertexArray = [](uint32_t vertexArray) { cachedContext.DeleteVertexArray(vertexArray); };
+	functions.deleteBuffer = [](uint32_t buffer) { cachedContext.DeleteBuffer(buffer); };
+	functions.deleteTexture = [](uint32_t texture) { cachedContext.DeleteTexture(texture); };
+	functions.deleteFramebuffer = [](uint32_t framebuffer) { cachedContext.DeleteFramebuffer(framebuffer); };
+
+	return functions;
+}
+
+
+/**
+ * @brief  ĳø ģ ¥ OpenGL ؽƮ  ȣ ״  ¥ OpenGL ؽƮ °  ˻մϴ.
+ *
+ * @param cached  ĳø ģ ¥ OpenGL ؽƮԴϴ.
+ * @param reference  ȣ ״  ¥ OpenGL ؽƮԴϴ.
+ *
+ * @return Ȱȭ ؽó    ° ٸ true, ׷  false ȯմϴ.
+ *
+ * @note  ĳô ̹ ε ؽó ؽó  Ȱȭ ϹǷ, Ȱȭ ؽó   ٸ  ֽϴ.
+ */
+bool IsSameState(const MockContext& cached, const MockContext& reference)
+{
+	bool bIsSame = cached.program == reference.program
+		&& cached.vertexArray == reference.vertexArray
+		&& cached.framebuffer == reference.framebuffer
+		&& cached.depthFunc == reference.depthFunc
+		&& cached.cullFace == reference.cullFace
+		&& cached.bIsSetViewport == reference.bIsSetViewport
+		&& cached.buffers == reference.buffers
+		&& cached.textures == reference.textures
+		&& cached.capabilities == reference.capabilities;
+
+	for (uint32_t index = 0; index < 4; ++index)
+	{
+		bIsSame = bIsSame && cached.blendFunc[index] == reference.blendFunc[index] && cached.viewport[index] == reference.viewport[index];
+	}
+
+	return bIsSame;
+}
+
+
+/**
+ * @brief    Ӱ     ȣմϴ.
+ *
+ * @param target   ȣ Դϴ.  ĳ̰ų ¥ OpenGL ؽƮԴϴ.
+ * @param countOfObject ε н  н ׸ Ʈ Դϴ.
+ *
+ * @note Ʈ ޽ 4 ޽   ϸ, Ʈ ε  ؽó  0 εմϴ.
+ */
+template <typename TTarget>
+void SubmitFrame(TTarget& target, uint32_t countOfObject)
+{
+	const uint32_t shadowProgram = 1;
+	const uint32_t lightProgram = 2;
+	const uint32_t skyboxProgram = 3;
+	const uint32_t uiProgram = 4;
+	const uint32_t shadowFramebuffer = 1;
+	const uint32_t shadowMap = 1;
+	const uint32_t cubeMap = 2;
+	const uint32_t uiTexture = 3;
+	const uint32_t skyboxVertexArray = 10;
+	const uint32_t uiVertexArray = 11;
+	const uint32_t countOfMesh = 4;
+
+	// ε нԴϴ.
+	target.BindFramebuffer(shadowFramebuffer);
+	target.SetViewport(0, 0, 2048, 2048);
+	target.SetCapability(DEPTH_TEST, true);
+	target.SetCapability(BLEND, false);
+	target.UseProgram(shadowProgram);
+	for (uint32_t object = 0; object < countOfObject; ++object)
+	{
+		target.BindVertexArray(1 + (object * countOfMesh) / countOfObject);
+	}
+	target.BindVertexArray(0);
+	target.UseProgram(0);
+	target.BindFramebuffer(0);
+
+	//  нԴϴ.
+	target.SetViewport(0, 0, 1280, 720);
+	target.UseProgram(lightProgram);
+	for (uint32_t object = 0; object < countOfObject; ++object)
+	{
+		target.BindTexture(0, TEXTURE_2D, shadowMap);
+		target.BindVertexArray(1 + (object * countOfMesh) / countOfObject);
+	}
+	target.BindVertexArray(0);
+	target.UseProgram(0);
+
+	// ī ڽԴϴ.
+	target.SetDepthFunc(LEQUAL);
+	target.UseProgram(skyboxProgram);
+	target.BindTexture(0, TEXTURE_CUBE_MAP, cubeMap);
+	target.BindVertexArray(skyboxVertexArray);
+	target.BindVertexArray(0);
+	target.SetDepthFunc(LESS);
+	target.UseProgram(0);
+
+	// UIԴϴ.
+	target.SetCapability(DEPTH_TEST, false);
+	target.SetCapability(BLEND, true);
+	target.SetBlendFunc(BLEND_FACTORS[2], BLEND_FACTORS[3], BLEND_FACTORS[1], BLEND_FACTORS[0]);
+	target.UseProgram(uiProgram);
+	for (uint32_t index = 0; index < 8; ++index)
+	{
+		target.BindTexture(0, TEXTURE_2D, uiTexture);
+		target.BindVertexArray(uiVertexArray);
+		target.BindVertexArray(0);
+	}
+	target.UseProgram(0);
+	target.SetCapability(DEPTH_TEST, true);
+	target.SetCapability(BLEND, false);
+}
+
+
+/**
+ * @brief   ̳ Ʈ  ϳ ȣմϴ.
+ *
+ * @param target ȣ Դϴ.  ĳ̰ų ¥ OpenGL ؽƮԴϴ.
+ * @param values ȣ  ڸ ϴ  Դϴ.
+ *
+ * @note   ۰ Ƽ  ¸ ٽ ϴ ȣ   մϴ.
+ */
+template <typename TTarget>
+void CallRandomOperation(TTarget& target, const uint32_t values[4])
+{
+	uint32_t value = values[1] % 4;
+
+	switch (values[0] % 20)
+	{
+	case 0:  target.UseProgram(value); break;
+	case 1:  target.BindVertexArray(value); break;
+	case 2:  target.BindBuffer((values[2] % 2 == 0) ? ARRAY_BUFFER : COPY_WRITE_BUFFER, value); break;
+	case 3:
+	case 4:  target.BindTexture(values[2] % 4, (values[3] % 2 == 0) ? TEXTURE_2D : TEXTURE_CUBE_MAP, value); break;
+	case 5:  target.BindFramebuffer(value % 3); break;
+	case 6:  target.SetViewport(0, 0, (value % 2 == 0) ? 1280 : 2048, (value % 2 == 0) ? 720 : 2048); break;
+	case 7:
+	case 8:  target.SetCapability((value == 0) ? DEPTH_TEST : ((value == 1) ? BLEND : CULL_FACE), values[2] % 2 == 0); break;
+	case 9:  target.SetBlendFunc(BLEND_FACTORS[value], BLEND_FACTORS[values[2] % 4], BLEND_FACTORS[1], BLEND_FACTORS[0]); break;
+	case 10: target.SetDepthFunc((value % 2 == 0) ? LESS : LEQUAL); break;
+	case 11: target.SetCullFace((value % 2 == 0) ? BACK : FRONT); break;
+	case 12: target.DeleteProgram(value); break;
+	case 13: target.DeleteVertexArray(value); break;
+	case 14: target.DeleteBuffer(value); break;
+	case 15: target.DeleteTexture(value); break;
+	case 16: target.DeleteFramebuffer(value % 3); break;
+	default: target.BindVertexArray(value); break;
+	}
+}
+
+
+/**
+ * @brief  ڷκ ġũ  ɼ нϴ.
+ *
+ * @param argc   Դϴ.
+ * @param argv   Դϴ.
+ * @param outOption   ɼԴϴ.
+ *
+ * @return  ڸ оٸ true, ׷  false ȯմϴ.
+ */
+bool ParseOption(int32_t argc, char** argv, BenchOption& outOption)
+{
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument.rfind("operations=", 0) == 0)
+		{
+			outOption.operations = static_cast<uint32_t>(std::stoul(argument.substr(11)));
+		}
+		else if (argument.rfind("objects=", 0) == 0)
+		{
+			outOption.objects = static_cast<uint32_t>(std::stoul(argument.substr(8)));
+		}
+		else if (argument.rfind("frames=", 0) == 0)
+		{
+			outOption.frames = static_cast<uint32_t>(std::stoul(argument.substr(7)));
+		}
+		else if (argument.rfind("seed=", 0) == 0)
+		{
+			outOption.seed = std::stoull(argument.substr(5));
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return outOption.objects > 0 && outOption.frames > 0;
+}
+
+
+int main(int argc, char** argv)
+{
+	BenchOption option;
+	if (!ParseOption(argc, argv, option))
+	{
+		std::fprintf(stderr, "usage : Dodge3DGLStateCacheBench [operations=200000] [objects=512] [frames=240] [seed=1]\n");
+		return 1;
+	}
+
+	std::printf("Dodge3DGLStateCacheBench\n");
+
+	int32_t countOfMismatch = 0;
+	auto check = [&](const char* name, bool bIsMatch)
+	{
+		if (!bIsMatch)
+		{
+			std::printf("  mismatch %s\n", name);
+			countOfMismatch++;
+		}
+	};
+
+	GLStateCache& cache = GLStateCache::Get();
+	auto reset = [&]()
+	{
+		cachedContext = MockContext();
+		cache.SetFunctionTable(CreateMockFunctionTable());
+		cache.ResetStatistics();
+	};
+
+	//   ٽ ϸ ϰ, ĳø ʱȭ  ù ȣ  ̾ ؾ մϴ.
+	reset();
+	cache.UseProgram(3);
+	cache.UseProgram(3);
+	cache.SetCapability(DEPTH_TEST, true);
+	cache.SetCapability(DEPTH_TEST, true);
+	cache.SetCapability(DEPTH_TEST, false);
+	check("elide same state", cachedContext.countOfCall == 3 && cache.GetStatistics().countOfCall == 5 && cache.GetStatistics().countOfElided == 2);
+
+	cache.Invalidate();
+	cache.UseProgram(3);
+	cache.SetCapability(DEPTH_TEST, false);
+	check("invalidate forwards first call", cachedContext.countOfCall == 5);
+
+	// ؽó ָ ε ϰ, ̹ ε ؽó ؽó ֵ ٲ ʾƾ մϴ.
+	reset();
+	cache.BindTexture(0, TEXTURE_2D, 10);
+	cache.BindTexture(1, TEXTURE_2D, 11);
+	cache.BindTexture(0, TEXTURE_2D, 10);
+	check("texture unit elide", cachedContext.countOfCall == 4 && cachedContext.activeTextureUnit == 1);
+
+	cache.BindTexture(0, TEXTURE_CUBE_MAP, 10);
+	check("texture target per unit", cachedContext.countOfCall == 6 && cachedContext.activeTextureUnit == 0);
+
+	cache.BindTexture(TEXTURE_2D, 12);
+	cache.BindTexture(0, TEXTURE_2D, 12);
+	check("texture active unit", cachedContext.countOfCall == 7 && cachedContext.textures[TEXTURE_2D] == 12);
+
+	reset();
+	cache.BindTexture(TEXTURE_2D, 12);
+	check("texture unknown active unit", cachedContext.countOfCall == 2 && cachedContext.activeTextureUnit == 0);
+
+	//  Ʈ ε OpenGL  0 ǵư ϰ,  ̸ ٽ εϸ ؾ մϴ.
+	reset();
+	cache.BindVertexArray(5);
+	cache.DeleteVertexArray(5);
+	cache.BindVertexArray(0);
+	cache.BindVertexArray(5);
+	check("delete vertex array", cachedContext.countOfCall == 2 && cachedContext.vertexArray == 5);
+
+	cache.BindTexture(0, TEXTURE_2D, 7);
+	cache.BindTexture(2, TEXTURE_2D, 7);
+	cache.DeleteTexture(7);
+	cache.BindTexture(0, TEXTURE_2D, 0);
+	cache.BindTexture(2, TEXTURE_2D, 7);
+	check("delete texture", cachedContext.countOfCall == 7 && cachedContext.textures[(2ULL << 32) | TEXTURE_2D] == 7);
+
+	cache.UseProgram(3);
+	cache.DeleteProgram(3);
+	cache.UseProgram(3);
+	check("delete program in use", cachedContext.countOfCall == 9);
+
+	cache.BindFramebuffer(2);
+	cache.DeleteFramebuffer(2);
+	cache.BindFramebuffer(0);
+	check("delete framebuffer", cachedContext.countOfCall == 10 && cachedContext.framebuffer == 0);
+
+	//  ȣ ĳÿ ¥ ؽƮ ״ , ĳð ʿ ȣ ߸ų ߺ ȣ  ʴ ˻մϴ.
+	reset();
+	MockContext referenceContext;
+	RandomStream random(option.seed);
+	bool bIsSameEveryOperation = true;
+	for (uint32_t operation = 0; operation < option.operations; ++operation)
+	{
+		const uint32_t values[4] = { random.NextUInt32(), random.NextUInt32(), random.NextUInt32(), random.NextUInt32() };
+		CallRandomOperation(cache, values);
+		CallRandomOperation(referenceContext, values);
+		bIsSameEveryOperation = bIsSameEveryOperation && IsSameState(cachedContext, referenceContext);
+	}
+
+	const GLStateCache::Statistics randomStatistics = cache.GetStatistics();
+	check("random same state", bIsSameEveryOperation);
+	check("random no redundant call", cachedContext.countOfRedundantCall == 0);
+	check("random call count", randomStatistics.countOfCall == referenceContext.countOfCall);
+	check("random forwarded count", randomStatistics.countOfCall - randomStatistics.countOfElided == cachedContext.countOfCall);
+	check("random elide redundant call", randomStatistics.countOfElided >= referenceContext.countOfRedundantCall);
+
+	const uint32_t countOfRandomRedundantCall = referenceContext.countOfRedundantCall;
+
+	//    ݺؼ ĳ  ȣϴ  ĳð OpenGL ϴ  մϴ.
+	reset();
+	referenceContext = MockContext();
+	double uncachedMilliseconds = 0.0;
+	double cachedMilliseconds = 0.0;
+	for (uint32_t frame = 0; frame < option.frames; ++frame)
+	{
+		auto startTime = std::chrono::steady_clock::now();
+		SubmitFrame(referenceContext, option.objects);
+		auto endTime = std::chrono::steady_clock::now();
+		uncachedMilliseconds += std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+		startTime = std::chrono::steady_clock::now();
+		SubmitFrame(cache, option.objects);
+		endTime = std::chrono::steady_clock::now();
+		cachedMilliseconds += std::chrono::duration<double, std::milli>(endTime - startTime).count();
+	}
+
+	const GLStateCache::Statistics frameStatistics = cache.GetStatistics();
+	check("frame same state", IsSameState(cachedContext, referenceContext));
+	check("frame no redundant call", cachedContext.countOfRedundantCall == 0);
+	check("frame call count", frameStatistics.countOfCall == referenceContext.countOfCall);
+	check("frame elide call", cachedContext.countOfCall < referenceContext.countOfCall);
+
+	std::printf("  random operations %u, forwarded %u of %u calls, redundant without cache %u\n", option.operations, randomStatistics.countOfCall - randomStatistics.countOfElided, randomStatistics.countOfCall, countOfRandomRedundantCall);
+	std::printf("  frame objects %u\n", option.objects);
+	std::printf("  without cache : %7u calls/frame, %7.3f ms/frame\n", referenceContext.countOfCall / option.frames, uncachedMilliseconds / static_cast<double>(option.frames));
+	std::printf("  with cache    : %7u calls/frame, %7.3f ms/frame, %u elided/frame\n", cachedContext.countOfCall / option.frames, cachedMilliseconds / static_cast<double>(option.frames), frameStatistics.countOfElided / option.frames);
+
+	std::printf("  result : %s\n", (countOfMismatch == 0) ? "ok" : "mismatch");
+	return (countOfMismatch == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,182 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "GlyphAtlas.h"
+#include "TTFont.h"
+
+#include "BenchUtils.h"
+
+
+/**
+ * @brief ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+ */
+static const int32_t BEGIN_CODE_POINT = 32;
+
+
+/**
+ * @brief ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+ */
+static const int32_t END_CODE_POINT = 127;
+
+
+/**
+ * @brief  ۸ ؽó Ʋ󽺰  ˻մϴ.
+ *
+ * @param left  ۸ ؽó ƲԴϴ.
+ * @param right  ۸ ؽó ƲԴϴ.
+ *
+ * @return ۸ , Ʈ, Ʈ  ٸ true, ׷  false ȯմϴ.
+ */
+bool IsSameGlyphAtlas(const GlyphAtlas& left, const GlyphAtlas& right)
+{
+	return left.sourceHash == right.sourceHash
+		&& left.type == right.type
+		&& left.distanceRange == right.distanceRange
+		&& left.beginCodePoint == right.beginCodePoint
+		&& left.endCodePoint == right.endCodePoint
+		&& left.fontSize == right.fontSize
+		&& left.glyphAtlasSize == right.glyphAtlasSize
+		&& left.ascent == right.ascent
+		&& left.descent == right.descent
+		&& left.lineGap == right.lineGap
+		&& BenchUtils::IsSameGlyphs(left.glyphs, right.glyphs)
+		&& left.bitmap == right.bitmap;
+}
+
+
+int main(int argc, char** argv)
+{
+	std::filesystem::path fontPath = "Dodge3D/Resource/Font/SeoulNamsanEB.ttf";
+
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument.rfind("font=", 0) == 0)
+		{
+			fontPath = argument.substr(5);
+		}
+		else
+		{
+			std::fprintf(stderr, "usage : Dodge3DGlyphAtlasBench [font=Dodge3D/Resource/Font/SeoulNamsanEB.ttf]\n");
+			return 1;
+		}
+	}
+
+	std::printf("Dodge3DGlyphAtlasBench\n");
+
+	int32_t countOfMismatch = 0;
+	auto check = [&](const char* name, bool bIsMatch)
+	{
+		if (!bIsMatch)
+		{
+			std::printf("  mismatch %s\n", name);
+			countOfMismatch++;
+		}
+	};
+
+	check("baked path", TTFont::GetBakedGlyphAtlasPath(L"Resource/Font/SeoulNamsanEB.ttf", 32.0f, GlyphAtlas::EType::Bitmap) == L"Resource/Font/SeoulNamsanEB_32.atlas");
+	check("baked path without extension", TTFont::GetBakedGlyphAtlasPath(L"Resource.v2/Font/Font", 12.5f, GlyphAtlas::EType::Bitmap) == L"Resource.v2/Font/Font_12.5.atlas");
+	check("baked signed distance field path", TTFont::GetBakedGlyphAtlasPath(L"Resource/Font/SeoulNamsanEB.ttf", 64.0f, GlyphAtlas::EType::SignedDistanceField) == L"Resource/Font/SeoulNamsanEB_64_sdf.atlas");
+
+	std::vector<uint8_t> fontBuffer = BenchUtils::ReadBufferFromFile(fontPath);
+	if (fontBuffer.empty())
+	{
+		std::fprintf(stderr, "failed to read true type font file %s...\n", fontPath.string().c_str());
+		return 1;
+	}
+
+	std::filesystem::path bakedDirectory = std::filesystem::temp_directory_path() / "Dodge3DGlyphAtlasBench";
+	std::filesystem::create_directories(bakedDirectory);
+
+	std::printf("  font %s (%zu bytes)\n", fontPath.string().c_str(), fontBuffer.size());
+
+	//    εϴ Ʈ ũ ϴ.
+	const float fontSizes[] = { 32.0f, 64.0f, 128.0f };
+
+	double totalLiveMilliseconds = 0.0;
+	double totalBakedMilliseconds = 0.0;
+	for (const float& fontSize : fontSizes)
+	{
+		std::filesystem::path bakedPath = bakedDirectory / ("Font_" + std::to_string(static_cast<int32_t>(fontSize)) + ".atlas");
+
+		//     ù   Ʈ  а ŷ    ϴ.
+		auto startTime = std::chrono::steady_clock::now();
+		std::vector<uint8_t> buffer = BenchUtils::ReadBufferFromFile(fontPath);
+		GlyphAtlas livePacked;
+		GlyphAtlas::Pack(buffer, BEGIN_CODE_POINT, END_CODE_POINT, fontSize, livePacked);
+		auto endTime = std::chrono::steady_clock::now();
+		double liveMilliseconds = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+		BenchUtils::WriteBufferToFile(bakedPath, livePacked.Serialize());
+
+		//    Ʈ  ؽ  Ȯϰ    нϴ.
+		startTime = std::chrono::steady_clock::now();
+		buffer = BenchUtils::ReadBufferFromFile(fontPath);
+		uint64_t sourceHash = GlyphAtlas::ComputeSourceHash(buffer, BEGIN_CODE_POINT, END_CODE_POINT, fontSize, GlyphAtlas::EType::Bitmap, 0);
+		GlyphAtlas baked;
+		bool bIsBaked = GlyphAtlas::Deserialize(BenchUtils::ReadBufferFromFile(bakedPath), sourceHash, baked);
+		endTime = std::chrono::steady_clock::now();
+		double bakedMilliseconds = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+		totalLiveMilliseconds += liveMilliseconds;
+		totalBakedMilliseconds += bakedMilliseconds;
+
+		std::printf("  size %5.1f atlas %4d : live pack %8.3f ms, baked load %8.3f ms\n", fontSize, livePacked.glyphAtlasSize, liveMilliseconds, bakedMilliseconds);
+
+		check("baked load", bIsBaked);
+		check("baked and live packed atlas", bIsBaked && IsSameGlyphAtlas(livePacked, baked));
+
+		GlyphAtlas repacked;
+		GlyphAtlas::Pack(fontBuffer, BEGIN_CODE_POINT, END_CODE_POINT, fontSize, repacked);
+		check("deterministic pack", IsSameGlyphAtlas(livePacked, repacked));
+
+		TTFont liveFont;
+		liveFont.Initialize(livePacked);
+		TTFont bakedFont;
+		bakedFont.Initialize(baked);
+
+		float liveWidth = 0.0f;
+		float liveHeight = 0.0f;
+		float bakedWidth = 0.0f;
+		float bakedHeight = 0.0f;
+		liveFont.MeasureText(L"Dodge3D Rank 2024-01-01 12:34:56", liveWidth, liveHeight);
+		bakedFont.MeasureText(L"Dodge3D Rank 2024-01-01 12:34:56", bakedWidth, bakedHeight);
+		check("measure text", liveWidth == bakedWidth && liveHeight == bakedHeight && liveFont.GetAscent() == bakedFont.GetAscent());
+
+		liveFont.Release();
+		bakedFont.Release();
+
+		// Ʈ ũ, Ʈ  ,  ջ ٲ     ʾƾ մϴ.
+		GlyphAtlas rejected;
+		std::vector<uint8_t> bakedBuffer = BenchUtils::ReadBufferFromFile(bakedPath);
+		check("reject other font size", !GlyphAtlas::Deserialize(bakedBuffer, GlyphAtlas::ComputeSourceHash(fontBuffer, BEGIN_CODE_POINT, END_CODE_POINT, fontSize + 1.0f, GlyphAtlas::EType::Bitmap, 0), rejected));
+		check("reject other code point range", !GlyphAtlas::Deserialize(bakedBuffer, GlyphAtlas::ComputeSourceHash(fontBuffer, BEGIN_CODE_POINT, END_CODE_POINT - 1, fontSize, GlyphAtlas::EType::Bitmap, 0), rejected));
+		check("reject other atlas type", !GlyphAtlas::Deserialize(bakedBuffer, GlyphAtlas::ComputeSourceHash(fontBuffer, BEGIN_CODE_POINT, END_CODE_POINT, fontSize, GlyphAtlas::EType::SignedDistanceField, TTFont::GetSignedDistanceFieldRange(fontSize)), rejected));
+
+		std::vector<uint8_t> modifiedFont = fontBuffer;
+		modifiedFont[modifiedFont.size() / 2] ^= 0x01;
+		check("reject modified font", !GlyphAtlas::Deserialize(bakedBuffer, GlyphAtlas::ComputeSourceHash(modifiedFont, BEGIN_CODE_POINT, END_CODE_POINT, fontSize, GlyphAtlas::EType::Bitmap, 0), rejected));
+
+		std::vector<uint8_t> truncated(bakedBuffer.begin(), bakedBuffer.end() - 1);
+		check("reject truncated file", !GlyphAtlas::Deserialize(truncated, sourceHash, rejected));
+
+		std::vector<uint8_t> corrupted = bakedBuffer;
+		corrupted[0] ^= 0xFF;
+		check("reject corrupted magic", !GlyphAtlas::Deserialize(corrupted, sourceHash, rejected));
+
+		check("reject empty file", !GlyphAtlas::Deserialize(std::vector<uint8_t>(), sourceHash, rejected));
+	}
+
+	std::printf("  %-22s : live pack %8.3f ms, baked load %8.3f ms\n", "total", totalLiveMilliseconds, totalBakedMilliseconds);
+
+	std::error_code errorCode;
+	std::filesystem::remove_all(bakedDirectory, errorCode);
+
+	std::printf("  result : %s\n", (countOfMismatch == 0) ? "ok" : "mismatch");
+	return (countOfMismatch == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,426 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "GlyphCache.h"
+#include "RandomStream.h"
+
+#include "BenchUtils.h"
+
+
+/**
+ * @brief ۸ ĳ Ʈ ũԴϴ.
+ */
+static const float FONT_SIZE = 32.0f;
+
+
+/**
+ * @brief ռ ۾  Դϴ.
+ */
+static const int32_t COUNT_OF_FRAME = 600;
+
+
+/**
+ * @brief  ӿ ׸ ؽƮ  Դϴ.
+ */
+static const int32_t COUNT_OF_LINE = 8;
+
+
+/**
+ * @brief ؽƮ    Դϴ.
+ */
+static const int32_t COUNT_OF_LINE_CHARACTER = 24;
+
+
+/**
+ * @brief   ڸ  ȮԴϴ.
+ */
+static const float HOT_CHARACTER_RATE = 0.7f;
+
+
+/**
+ * @brief    Դϴ.
+ */
+static const int32_t COUNT_OF_HOT_CHARACTER = 300;
+
+
+/**
+ * @brief ռ ۾  ڵ Ʈ  ϴ.
+ *
+ * @note ƾ  ϰ ѱ    õ   ٸ ڵ Ʈ ϴ.
+ *
+ * @return ڵ Ʈ  ȯմϴ.
+ */
+std::vector<int32_t> MakeCodePoints()
+{
+	std::vector<int32_t> codePoints;
+	for (int32_t codePoint = 0x21; codePoint <= 0x24F; ++codePoint)
+	{
+		if (codePoint < 0x7F || codePoint >= 0xA1)
+		{
+			codePoints.push_back(codePoint);
+		}
+	}
+
+	for (int32_t codePoint = 0xAC00; codePoint < 0xAC00 + 3000; ++codePoint)
+	{
+		codePoints.push_back(codePoint);
+	}
+
+	return codePoints;
+}
+
+
+/**
+ * @brief ĳÿ ġ ۸ Ʈ  Ͷ Ʈʰ  ˻մϴ.
+ *
+ * @param info Ʈ Դϴ.
+ * @param scale Ʈ  ȼ  ٲٴ Դϴ.
+ * @param glyphCache ˻ ۸ ĳԴϴ.
+ * @param cachedGlyph ˻ ۸Դϴ.
+ * @param scratch  Ͷ   Դϴ.
+ *
+ * @return Ʈ ٸ true, ׷  false ȯմϴ.
+ */
+bool IsSameGlyphBitmap(const stbtt_fontinfo& info, float scale, const GlyphCache& glyphCache, const GlyphCache::CachedGlyph& cachedGlyph, std::vector<uint8_t>& scratch)
+{
+	const Glyph& glyph = cachedGlyph.glyph;
+	int32_t width = glyph.position1.x - glyph.position0.x;
+	int32_t height = glyph.position1.y - glyph.position0.y;
+
+	scratch.assign(width * height, 0);
+	stbtt_MakeCodepointBitmap(&info, scratch.data(), width, height, width, scale, scale, glyph.codePoint);
+
+	const std::vector<uint8_t>& bitmap = glyphCache.GetPageBitmap(cachedGlyph.page);
+	for (int32_t y = 0; y < height; ++y)
+	{
+		const uint8_t* rowPtr = bitmap.data() + (glyph.position0.y + y) * glyphCache.GetPageSize() + glyph.position0.x;
+		if (std::memcmp(rowPtr, scratch.data() + y * width, width) != 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief ռ ۾  Դϴ.
+ */
+struct WorkloadResult
+{
+	double milliseconds = 0.0;
+	uint64_t maxUploadPerFrame = 0;
+	int32_t countOfMismatch = 0;
+	GlyphCache::Statistics statistics;
+};
+
+
+/**
+ * @brief ռ ۾ ϰ Ӹ ĳ Һ  ˻մϴ.
+ *
+ * @param fontBuffer Ʈ Ÿ Ʈ ҽ Դϴ.
+ * @param codePoints ۾  ڵ Ʈ Դϴ.
+ * @param pageSize Ʋ    ũԴϴ.
+ * @param maxCountOfPage Ʋ  ִ Դϴ.
+ *
+ * @return ۾   ȯմϴ.
+ */
+WorkloadResult RunWorkload(const std::vector<uint8_t>& fontBuffer, const std::vector<int32_t>& codePoints, int32_t pageSize, int32_t maxCountOfPage)
+{
+	WorkloadResult result;
+
+	GlyphCache glyphCache;
+	glyphCache.Initialize(fontBuffer, FONT_SIZE, pageSize, maxCountOfPage);
+
+	stbtt_fontinfo info;
+	stbtt_InitFont(&info, fontBuffer.data(), stbtt_GetFontOffsetForIndex(fontBuffer.data(), 0));
+	float scale = stbtt_ScaleForPixelHeight(&info, FONT_SIZE);
+
+	RandomStream random(1);
+	std::wstring text(COUNT_OF_LINE_CHARACTER, L' ');
+	std::vector<TextLayout::GlyphVertex> vertices(COUNT_OF_LINE_CHARACTER * 6);
+	std::vector<uint32_t> countOfPageVertices;
+	std::vector<const GlyphCache::CachedGlyph*> frameGlyphs;
+	std::vector<int32_t> frameCodePoints;
+	std::vector<uint8_t> scratch;
+
+	double generateMilliseconds = 0.0;
+	for (int32_t frame = 0; frame < COUNT_OF_FRAME; ++frame)
+	{
+		frameGlyphs.clear();
+		frameCodePoints.clear();
+
+		auto startTime = std::chrono::steady_clock::now();
+		for (int32_t line = 0; line < COUNT_OF_LINE; ++line)
+		{
+			for (wchar_t& character : text)
+			{
+				int32_t bound = (random.NextFloat() < HOT_CHARACTER_RATE) ? COUNT_OF_HOT_CHARACTER : static_cast<int32_t>(codePoints.size());
+				character = static_cast<wchar_t>(codePoints[random.NextInt(0, bound - 1)]);
+			}
+
+			uint32_t vertexCount = glyphCache.GenerateGlyphVertices(text, Vector2f(500.0f, 300.0f), vertices.data(), countOfPageVertices);
+
+			uint32_t countOfPageVertex = 0;
+			for (const uint32_t& count : countOfPageVertices)
+			{
+				countOfPageVertex += count;
+			}
+
+			if (countOfPageVertex != vertexCount)
+			{
+				result.countOfMismatch++;
+			}
+
+			for (const wchar_t& character : text)
+			{
+				const GlyphCache::CachedGlyph* cachedGlyph = glyphCache.FindOrAddGlyph(static_cast<int32_t>(character));
+				frameGlyphs.push_back(cachedGlyph);
+				frameCodePoints.push_back(static_cast<int32_t>(character));
+			}
+		}
+		auto endTime = std::chrono::steady_clock::now();
+		generateMilliseconds += std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+		//  ӿ  ۸    ŵǰų  ʾƾ մϴ.
+		for (std::size_t index = 0; index < frameGlyphs.size(); ++index)
+		{
+			const GlyphCache::CachedGlyph* cachedGlyph = frameGlyphs[index];
+			if (cachedGlyph == nullptr || cachedGlyph->glyph.codePoint != frameCodePoints[index])
+			{
+				result.countOfMismatch++;
+				continue;
+			}
+
+			if (cachedGlyph->page >= 0 && !IsSameGlyphBitmap(info, scale, glyphCache, *cachedGlyph, scratch))
+			{
+				result.countOfMismatch++;
+			}
+		}
+
+		uint64_t countOfUpload = glyphCache.GetStatistics().countOfUpload;
+		glyphCache.Tick();
+		uint64_t countOfFrameUpload = glyphCache.GetStatistics().countOfUpload - countOfUpload;
+
+		result.maxUploadPerFrame = std::max(result.maxUploadPerFrame, countOfFrameUpload);
+		if (countOfFrameUpload > static_cast<uint64_t>(maxCountOfPage))
+		{
+			result.countOfMismatch++;
+		}
+	}
+
+	result.milliseconds = generateMilliseconds;
+	result.statistics = glyphCache.GetStatistics();
+
+	glyphCache.Release();
+	return result;
+}
+
+
+int main(int argc, char** argv)
+{
+	std::filesystem::path fontPath = "Dodge3D/Resource/Font/SeoulNamsanEB.ttf";
+
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument.rfind("font=", 0) == 0)
+		{
+			fontPath = argument.substr(5);
+		}
+		else
+		{
+			std::fprintf(stderr, "usage : Dodge3DGlyphCacheBench [font=Dodge3D/Resource/Font/SeoulNamsanEB.ttf]\n");
+			return 1;
+		}
+	}
+
+	std::printf("Dodge3DGlyphCacheBench\n");
+
+	int32_t countOfMismatch = 0;
+	auto check = [&](const char* name, bool bIsMatch)
+	{
+		if (!bIsMatch)
+		{
+			std::printf("  mismatch %s\n", name);
+			countOfMismatch++;
+		}
+	};
+
+	std::vector<uint8_t> fontBuffer = BenchUtils::ReadBufferFromFile(fontPath);
+	if (fontBuffer.empty())
+	{
+		std::fprintf(stderr, "failed to read true type font file %s...\n", fontPath.string().c_str());
+		return 1;
+	}
+
+	std::vector<int32_t> codePoints = MakeCodePoints();
+	std::printf("  font %s (%zu bytes), %zu distinct code points\n", fontPath.string().c_str(), fontBuffer.size(), codePoints.size());
+
+	//  ڵ Ʈ ̸ ŷѴٸ ʿ ۸ 簢  Դϴ.  Ʋ󽺴 ̺ Ůϴ.
+	stbtt_fontinfo info;
+	stbtt_InitFont(&info, fontBuffer.data(), stbtt_GetFontOffsetForIndex(fontBuffer.data(), 0));
+	float scale = stbtt_ScaleForPixelHeight(&info, FONT_SIZE);
+
+	uint64_t eagerBytes = 0;
+	for (const int32_t& codePoint : codePoints)
+	{
+		int32_t x0 = 0;
+		int32_t y0 = 0;
+		int32_t x1 = 0;
+		int32_t y1 = 0;
+		stbtt_GetCodepointBitmapBox(&info, codePoint, scale, scale, &x0, &y0, &x1, &y1);
+		eagerBytes += static_cast<uint64_t>(x1 - x0 + 1) * static_cast<uint64_t>(y1 - y0 + 1);
+	}
+
+	std::printf("  eager packing lower bound : %8llu bytes\n", static_cast<unsigned long long>(eagerBytes));
+
+	struct Configuration
+	{
+		int32_t pageSize;
+		int32_t maxCountOfPage;
+	};
+
+	const Configuration configurations[] = { { 256, 4 }, { 256, 8 }, { 512, 2 }, { 512, 4 } };
+	for (const Configuration& configuration : configurations)
+	{
+		WorkloadResult result = RunWorkload(fontBuffer, codePoints, configuration.pageSize, configuration.maxCountOfPage);
+		const GlyphCache::Statistics& statistics = result.statistics;
+
+		// Һ  ˻Ϸ ٽ ã û  ϹǷ, ۾ û  ߷ մϴ.
+		uint64_t countOfRequest = static_cast<uint64_t>(COUNT_OF_FRAME) * COUNT_OF_LINE * COUNT_OF_LINE_CHARACTER;
+		double hitRate = 100.0 * (1.0 - static_cast<double>(statistics.countOfMiss) / static_cast<double>(countOfRequest));
+		uint64_t pageBytes = static_cast<uint64_t>(configuration.pageSize) * static_cast<uint64_t>(configuration.pageSize) * static_cast<uint64_t>(configuration.maxCountOfPage);
+
+		std::printf("  pages %d x %4d (%8llu bytes) : hit %5.1f %%, evicted %5llu pages %7llu glyphs, moved %6llu glyphs, overflow %llu, upload %6.1f KiB/frame (max %llu per frame), %7.3f ms/frame\n",
+			configuration.maxCountOfPage,
+			configuration.pageSize,
+			static_cast<unsigned long long>(pageBytes),
+			hitRate,
+			static_cast<unsigned long long>(statistics.countOfEvictedPage),
+			static_cast<unsigned long long>(statistics.countOfEvictedGlyph),
+			static_cast<unsigned long long>(statistics.countOfMovedGlyph),
+			static_cast<unsigned long long>(statistics.countOfOverflow),
+			static_cast<double>(statistics.uploadBytes) / 1024.0 / static_cast<double>(COUNT_OF_FRAME),
+			static_cast<unsigned long long>(result.maxUploadPerFrame),
+			result.milliseconds / static_cast<double>(COUNT_OF_FRAME));
+
+		check("workload invariant", result.countOfMismatch == 0);
+		check("workload overflow", statistics.countOfOverflow == 0);
+		//  ۸   Ʈ ٽ   ϴ.
+		check("workload eviction", eagerBytes <= pageBytes || statistics.countOfEvictedPage > 0);
+	}
+
+	//  ӿ   ۸ ûϸ   ۸ Ű nullptr ȯؾ մϴ.
+	{
+		GlyphCache glyphCache;
+		glyphCache.Initialize(fontBuffer, FONT_SIZE, 64, 3);
+
+		std::vector<const GlyphCache::CachedGlyph*> placed;
+		std::vector<int32_t> placedCodePoints;
+		int32_t samples[3] = { -1, -1, -1 };
+		int32_t overflowCodePoint = -1;
+		for (const int32_t& codePoint : codePoints)
+		{
+			const GlyphCache::CachedGlyph* cachedGlyph = glyphCache.FindOrAddGlyph(codePoint);
+			if (cachedGlyph == nullptr)
+			{
+				overflowCodePoint = codePoint;
+				break;
+			}
+
+			placed.push_back(cachedGlyph);
+			placedCodePoints.push_back(codePoint);
+
+			if (cachedGlyph->page >= 0 && samples[cachedGlyph->page] < 0)
+			{
+				samples[cachedGlyph->page] = codePoint;
+			}
+		}
+
+		check("overflow returns null", overflowCodePoint >= 0 && glyphCache.GetStatistics().countOfOverflow == 1);
+
+		bool bIsKept = true;
+		for (std::size_t index = 0; index < placed.size(); ++index)
+		{
+			bIsKept = bIsKept && placed[index]->glyph.codePoint == placedCodePoints[index];
+		}
+		check("overflow keeps frame glyphs", bIsKept && glyphCache.GetStatistics().countOfEvictedPage == 0);
+		check("overflow fills every page", samples[0] >= 0 && samples[1] >= 0 && samples[2] >= 0);
+		glyphCache.Tick();
+
+		//  1, 2, 0  ϸ  1     ˴ϴ.
+		const int32_t touchOrder[] = { 1, 2, 0 };
+		for (const int32_t& page : touchOrder)
+		{
+			glyphCache.FindOrAddGlyph(samples[page]);
+			glyphCache.Tick();
+		}
+
+		const GlyphCache::CachedGlyph* newGlyph = glyphCache.FindOrAddGlyph(overflowCodePoint);
+		check("lru evict least recently used page", newGlyph != nullptr && newGlyph->page == 1 && glyphCache.GetStatistics().countOfEvictedPage == 1);
+
+		uint64_t countOfMiss = glyphCache.GetStatistics().countOfMiss;
+		glyphCache.FindOrAddGlyph(samples[0]);
+		glyphCache.FindOrAddGlyph(samples[2]);
+		check("lru keep recently used pages", glyphCache.GetStatistics().countOfMiss == countOfMiss);
+
+		glyphCache.FindOrAddGlyph(samples[1]);
+		check("lru drop evicted glyph", glyphCache.GetStatistics().countOfMiss == countOfMiss + 1);
+
+		glyphCache.Release();
+	}
+
+	//  ū ۸ ġ ʾƾ մϴ.
+	{
+		GlyphCache glyphCache;
+		glyphCache.Initialize(fontBuffer, FONT_SIZE, 8, 1);
+
+		check("oversized glyph", glyphCache.FindOrAddGlyph(codePoints.front()) == nullptr && glyphCache.GetStatistics().countOfOverflow == 1);
+
+		glyphCache.Release();
+	}
+
+	//  Ŵó ۸  ûϰ    ص ٷ   ƾ ϸ, 踦 ٽ  ʾƾ մϴ.
+	{
+		GlyphCache glyphCache;
+		glyphCache.Initialize(fontBuffer, FONT_SIZE, 256, 4);
+
+		std::wstring text(COUNT_OF_LINE_CHARACTER, L' ');
+		for (std::size_t index = 0; index < text.size(); ++index)
+		{
+			text[index] = static_cast<wchar_t>(codePoints[index]);
+		}
+
+		std::vector<TextLayout::GlyphVertex> requestedVertices(text.size() * 6);
+		std::vector<TextLayout::GlyphVertex> immediateVertices(text.size() * 6);
+		std::vector<uint32_t> requestedCountOfPageVertices;
+		std::vector<uint32_t> immediateCountOfPageVertices;
+
+		glyphCache.RequestGlyphs(text);
+		glyphCache.Flush();
+
+		uint64_t countOfHit = glyphCache.GetStatistics().countOfHit;
+		uint32_t requestedVertexCount = glyphCache.GenerateRequestedGlyphVertices(text, Vector2f(500.0f, 300.0f), requestedVertices.data(), requestedCountOfPageVertices);
+		check("requested glyphs keep statistics", glyphCache.GetStatistics().countOfHit == countOfHit);
+
+		uint32_t immediateVertexCount = glyphCache.GenerateGlyphVertices(text, Vector2f(500.0f, 300.0f), immediateVertices.data(), immediateCountOfPageVertices);
+		check("requested glyph vertices",
+			requestedVertexCount == immediateVertexCount &&
+			requestedCountOfPageVertices == immediateCountOfPageVertices &&
+			std::memcmp(requestedVertices.data(), immediateVertices.data(), sizeof(TextLayout::GlyphVertex) * requestedVertexCount) == 0
+		);
+
+		glyphCache.Release();
+	}
+
+	std::printf("  result : %s\n", (countOfMismatch == 0) ? "ok" : "mismatch");
+	return (countOfMismatch == 0) ? 0 : 1;
+}
\ No newline at end of file
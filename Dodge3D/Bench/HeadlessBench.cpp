@@ -0,0 +1,503 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "InputManager.h"
+#include "JobSystem.h"
+#include "MathUtils.h"
+#include "ObjectManager.h"
+#include "ResourceManager.h"
+
+#include "BulletPattern.h"
+#include "EntityPlaySimulation.h"
+#include "Player.h"
+#include "PlaySimulation.h"
+
+#include "BenchUtils.h"
+
+
+/**
+ * @brief 帮 ġũ  ɼԴϴ.
+ *
+ * @note  ڴ Ӱ  key=value Դϴ. (ex. seconds=120 spawners=64)
+ */
+struct BenchOption
+{
+	float seconds = 60.0f;       // ùķ̼ ð()Դϴ.
+	float stepRate = 60.0f;      // ʴ  ùķ̼ ܰ Դϴ.
+	int32_t spawners = 4;        // Ѿ  Դϴ.
+	int32_t capacity = 1024;     // Ѿ ʵ忡 ̸ Ȯ Ѿ  Դϴ.
+	int32_t workers = -1;        //  带  ۾  Դϴ.   ý ⺻ մϴ.
+	uint64_t seed = 1;           // ùķ̼  Ʈ õԴϴ.
+	std::string recordPath;      // Է Ʈ  Դϴ.    ʽϴ.
+	std::string replayPath;      //  Է Ʈ Դϴ.    ũƮ Է  մϴ.
+	std::string model = "object"; // ùķ̼ Դϴ. object PlaySimulation, entity EntityPlaySimulation մϴ.
+	std::string patternPath;     //  Ѿ Ⱑ  Ѿ   Դϴ.   Ӱ    մϴ.
+};
+
+
+/**
+ * @brief ũƮ Է  Դϴ.
+ */
+struct ScriptedInput
+{
+	std::array<EVirtualKey, 2> keys; //    ִ  ŰԴϴ. VKEY_NONE մϴ.
+	float duration;                  //  ()Դϴ.
+};
+
+
+/**
+ * @brief ÷̾  ȿ   ũƮ ԷԴϴ.
+ *
+ * @note Է ùķ̼ ܰ θ ǹǷ ึ  Է ϴ.
+ */
+static const std::array<ScriptedInput, 8> SCRIPTED_INPUTS =
+{
+	ScriptedInput{ { EVirtualKey::VKEY_LEFT,  EVirtualKey::VKEY_NONE }, 0.6f },
+	ScriptedInput{ { EVirtualKey::VKEY_LEFT,  EVirtualKey::VKEY_UP   }, 0.4f },
+	ScriptedInput{ { EVirtualKey::VKEY_UP,    EVirtualKey::VKEY_NONE }, 0.6f },
+	ScriptedInput{ { EVirtualKey::VKEY_RIGHT, EVirtualKey::VKEY_UP   }, 0.4f },
+	ScriptedInput{ { EVirtualKey::VKEY_RIGHT, EVirtualKey::VKEY_NONE }, 0.6f },
+	ScriptedInput{ { EVirtualKey::VKEY_RIGHT, EVirtualKey::VKEY_DOWN }, 0.4f },
+	ScriptedInput{ { EVirtualKey::VKEY_DOWN,  EVirtualKey::VKEY_NONE }, 0.6f },
+	ScriptedInput{ { EVirtualKey::VKEY_LEFT,  EVirtualKey::VKEY_DOWN }, 0.4f },
+};
+
+
+/**
+ * @brief  ڸ Ľմϴ.
+ *
+ * @param argc   Դϴ.
+ * @param argv   Դϴ.
+ * @param outOption Ľ  ɼԴϴ.
+ *
+ * @return  ڸ Ľߴٸ true, ׷  false ȯմϴ.
+ */
+bool ParseOption(int32_t argc, char** argv, BenchOption& outOption)
+{
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		std::size_t separator = argument.find('=');
+		if (separator == std::string::npos)
+		{
+			return false;
+		}
+
+		std::string key = argument.substr(0, separator);
+		const char* value = argument.c_str() + separator + 1;
+
+		if (key == "seconds")
+		{
+			outOption.seconds = std::strtof(value, nullptr);
+		}
+		else if (key == "rate")
+		{
+			outOption.stepRate = std::strtof(value, nullptr);
+		}
+		else if (key == "spawners")
+		{
+			outOption.spawners = static_cast<int32_t>(std::strtol(value, nullptr, 10));
+		}
+		else if (key == "capacity")
+		{
+			outOption.capacity = static_cast<int32_t>(std::strtol(value, nullptr, 10));
+		}
+		else if (key == "workers")
+		{
+			outOption.workers = static_cast<int32_t>(std::strtol(value, nullptr, 10));
+		}
+		else if (key == "seed")
+		{
+			outOption.seed = static_cast<uint64_t>(std::strtoull(value, nullptr, 10));
+		}
+		else if (key == "record")
+		{
+			outOption.recordPath = value;
+		}
+		else if (key == "replay")
+		{
+			outOption.replayPath = value;
+		}
+		else if (key == "model")
+		{
+			outOption.model = value;
+		}
+		else if (key == "pattern")
+		{
+			outOption.patternPath = value;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	bool bIsValidModel = (outOption.model == "object") || (outOption.model == "entity");
+	return outOption.seconds > 0.0f && outOption.stepRate > 0.0f && outOption.spawners >= 0 && outOption.capacity >= 0 && bIsValidModel;
+}
+
+
+/**
+ * @brief Ѿ   𼭸     ġմϴ.
+ *
+ * @param countOfSpawner Ѿ  Դϴ.
+ * @param patternSignature  Ѿ Ⱑ  Ѿ  ñ״óԴϴ.      մϴ.
+ *
+ * @return Ѿ  ġ  ȯմϴ.
+ *
+ * @note Ⱑ 4̰   ʾҴٸ  ÷   ġ,   ġ˴ϴ.
+ */
+std::vector<PlaySimulation::BulletSpawnerParam> CreateBulletSpawnerParams(int32_t countOfSpawner, const std::string& patternSignature)
+{
+	const BulletPattern* aimedSlowPattern = ResourceManager::Get().GetResource<BulletPattern>("AimedSlowPattern");
+	const BulletPattern* aimedFastPattern = ResourceManager::Get().GetResource<BulletPattern>("AimedFastPattern");
+	const BulletPattern* overridePattern = patternSignature.empty() ? nullptr : ResourceManager::Get().GetResource<BulletPattern>(patternSignature);
+
+	std::vector<PlaySimulation::BulletSpawnerParam> bulletSpawnerParams;
+
+	float radius = std::sqrt(32.0f);
+	for (int32_t index = 0; index < countOfSpawner; ++index)
+	{
+		float radian = MathUtils::ToRadian(135.0f) - TwoPi * static_cast<float>(index) / static_cast<float>(countOfSpawner);
+		const BulletPattern* pattern = overridePattern ? overridePattern : ((index % 2 == 0) ? aimedSlowPattern : aimedFastPattern);
+
+		bulletSpawnerParams.push_back(PlaySimulation::BulletSpawnerParam{ Vector3f(radius * std::cos(radian), 0.5f, radius * std::sin(radian)), pattern });
+	}
+
+	return bulletSpawnerParams;
+}
+
+
+/**
+ * @brief ũƮ Է Է Ŵ մϴ.
+ *
+ * @param elapsedSeconds ùķ̼    ð()Դϴ.
+ */
+void ApplyScriptedInput(float elapsedSeconds)
+{
+	float cycleSeconds = 0.0f;
+	for (const auto& scriptedInput : SCRIPTED_INPUTS)
+	{
+		cycleSeconds += scriptedInput.duration;
+	}
+
+	float cycleTime = std::fmod(elapsedSeconds, cycleSeconds);
+	const ScriptedInput* currentInput = &SCRIPTED_INPUTS.back();
+	for (const auto& scriptedInput : SCRIPTED_INPUTS)
+	{
+		if (cycleTime < scriptedInput.duration)
+		{
+			currentInput = &scriptedInput;
+			break;
+		}
+
+		cycleTime -= scriptedInput.duration;
+	}
+
+	static const std::array<EVirtualKey, 4> moveKeys = { EVirtualKey::VKEY_LEFT, EVirtualKey::VKEY_UP, EVirtualKey::VKEY_RIGHT, EVirtualKey::VKEY_DOWN };
+	for (const auto& moveKey : moveKeys)
+	{
+		bool bIsPress = (currentInput->keys[0] == moveKey) || (currentInput->keys[1] == moveKey);
+		InputManager::Get().SetVirtualKeyState(moveKey, bIsPress);
+	}
+}
+
+
+/**
+ * @brief  AimedSlow.json, AimedFast.json    մϴ.
+ *
+ * @param signature  Ѿ  ñ״óԴϴ.
+ * @param delay Ѿ ߻ϴ ð ֱԴϴ.
+ *
+ * @note ġũ  ġ ϰ     Json ü  մϴ.
+ */
+void CreateAimedBulletPattern(const std::string& signature, float delay)
+{
+	Json::Value step;
+	step["delay"] = delay;
+	step["shape"] = "aimed";
+	step["count"] = 1;
+	step["speed"].append(2.0f);
+	step["speed"].append(5.0f);
+
+	Json::Value root;
+	root["radius"] = 0.2f;
+	root["steps"].append(step);
+
+	BulletPattern* pattern = ResourceManager::Get().CreateResource<BulletPattern>(signature);
+	pattern->Initialize(root);
+}
+
+
+/**
+ * @brief Ѿ   а մϴ.
+ *
+ * @param path Ѿ   Դϴ.
+ * @param signature  Ѿ  ñ״óԴϴ.
+ *
+ * @return Ѿ  ߴٸ true, ׷  false ȯմϴ.
+ */
+bool LoadBulletPattern(const std::string& path, const std::string& signature)
+{
+	std::vector<uint8_t> buffer;
+	if (!BenchUtils::ReadBufferFromFile(path, buffer))
+	{
+		return false;
+	}
+
+	Json::Value root;
+	Json::Reader reader;
+	if (!reader.parse(std::string(buffer.begin(), buffer.end()), root))
+	{
+		return false;
+	}
+
+	BulletPattern* pattern = ResourceManager::Get().CreateResource<BulletPattern>(signature);
+	pattern->Initialize(root);
+	return true;
+}
+
+
+/**
+ * @brief  Ʈ FNV-1a ؽÿ մϴ.
+ *
+ * @param hash  ؽ Դϴ.
+ * @param value  Դϴ.
+ */
+template <typename T>
+void HashBits(uint64_t& hash, const T& value)
+{
+	uint8_t bytes[sizeof(T)];
+	std::memcpy(bytes, &value, sizeof(T));
+
+	for (const auto& byte : bytes)
+	{
+		hash = (hash ^ byte) * 0x100000001B3ULL;
+	}
+}
+
+
+/**
+ * @brief ĵ ƽ  ð Ͽ   ϴ.
+ *
+ * @param sortedLatencies  ĵ ƽ  ð Դϴ.
+ * @param percentile  Դϴ.  0~100Դϴ.
+ *
+ * @return  ϴ  ð ȯմϴ.
+ */
+double GetPercentile(const std::vector<double>& sortedLatencies, double percentile)
+{
+	if (sortedLatencies.empty())
+	{
+		return 0.0;
+	}
+
+	std::size_t index = static_cast<std::size_t>(std::ceil(percentile / 100.0 * static_cast<double>(sortedLatencies.size())));
+	index = std::clamp<std::size_t>(index, 1, sortedLatencies.size());
+
+	return sortedLatencies[index - 1];
+}
+
+
+/**
+ * @brief  ÷  ùķ̼ ϰ  մϴ.
+ *
+ * @param option ġũ  ɼԴϴ.
+ * @param bIsReplay Է Ʈ ϴ Դϴ.
+ *
+ * @note TSimulation PlaySimulation Ȥ EntityPlaySimulationԴϴ.
+ */
+template <typename TSimulation>
+void RunSimulation(const BenchOption& option, bool bIsReplay)
+{
+	TSimulation simulation;
+	std::string patternSignature = option.patternPath.empty() ? "" : "BenchPattern";
+	simulation.Initialize(CreateBulletSpawnerParams(option.spawners, patternSignature), static_cast<uint32_t>(option.capacity), option.seed);
+
+	Player* player = simulation.GetPlayer();
+
+	float fixedDeltaSeconds = 1.0f / option.stepRate;
+	uint64_t maxCountOfTick = static_cast<uint64_t>(std::llround(static_cast<double>(option.seconds) * static_cast<double>(option.stepRate)));
+
+	std::vector<double> latencies;
+	latencies.reserve(static_cast<std::size_t>(maxCountOfTick));
+
+	uint64_t countOfTick = 0;
+	double simulatedSeconds = 0.0;
+
+	uint32_t peakBullets = 0;
+	uint64_t countOfHit = 0;
+	uint64_t countOfDeath = 0;
+
+	auto benchStartTime = std::chrono::steady_clock::now();
+	while (bIsReplay || countOfTick < maxCountOfTick)
+	{
+		InputManager::Get().Tick(fixedDeltaSeconds);
+
+		if (bIsReplay)
+		{
+			if (!InputManager::Get().IsReplaying())
+			{
+				break;
+			}
+		}
+		else
+		{
+			ApplyScriptedInput(static_cast<float>(countOfTick) * fixedDeltaSeconds);
+		}
+
+		float deltaSeconds = InputManager::Get().GetDeltaSeconds();
+
+		auto tickStartTime = std::chrono::steady_clock::now();
+		simulation.RecordPrevState();
+		simulation.Tick(deltaSeconds);
+		auto tickEndTime = std::chrono::steady_clock::now();
+
+		countOfTick++;
+		simulatedSeconds += static_cast<double>(deltaSeconds);
+
+		latencies.push_back(std::chrono::duration<double, std::micro>(tickEndTime - tickStartTime).count());
+		peakBullets = std::max<uint32_t>(peakBullets, simulation.GetCountOfBullet());
+
+		if (simulation.IsCollisionToPlayer())
+		{
+			countOfHit++;
+		}
+
+		// ÷ °  ʵ ü  Ǹ ٽ äϴ.
+		if (player->GetHP() <= 0)
+		{
+			countOfDeath++;
+			player->SetHP(player->GetMaxHP());
+		}
+	}
+	auto benchEndTime = std::chrono::steady_clock::now();
+
+	if (InputManager::Get().IsRecording())
+	{
+		if (!BenchUtils::WriteBufferToFile(option.recordPath, InputManager::Get().StopRecording()))
+		{
+			std::fprintf(stderr, "failed to write input stream %s...\n", option.recordPath.c_str());
+		}
+	}
+
+	//  Է Ʈ    ÷  ٲ ʾҴ ϱ  ؽԴϴ.
+	uint64_t outcomeHash = 0xCBF29CE484222325ULL;
+	Vector3f playerLocation = player->GetTransform().GetLocation();
+	HashBits(outcomeHash, playerLocation.x);
+	HashBits(outcomeHash, playerLocation.y);
+	HashBits(outcomeHash, playerLocation.z);
+	HashBits(outcomeHash, player->GetPlayTime());
+	HashBits(outcomeHash, simulation.GetCountOfBullet());
+	HashBits(outcomeHash, countOfHit);
+
+	double wallSeconds = std::chrono::duration<double>(benchEndTime - benchStartTime).count();
+	double ticksPerSecond = (wallSeconds > 0.0) ? static_cast<double>(countOfTick) / wallSeconds : 0.0;
+
+	std::sort(latencies.begin(), latencies.end());
+
+	std::printf("Dodge3DHeadlessBench\n");
+	std::printf("  simulated seconds  : %.2f (%llu ticks%s)\n", simulatedSeconds, static_cast<unsigned long long>(countOfTick), bIsReplay ? ", replay" : "");
+	std::printf("  simulation model   : %s\n", option.model.c_str());
+	std::printf("  bullet spawners    : %d\n", option.spawners);
+	std::printf("  bullet pattern     : %s\n", option.patternPath.empty() ? "aimed" : option.patternPath.c_str());
+	std::printf("  job workers        : %u\n", JobSystem::Get().GetCountOfWorker());
+	std::printf("  random seed        : %llu\n", static_cast<unsigned long long>(option.seed));
+	std::printf("  wall seconds       : %.3f\n", wallSeconds);
+	std::printf("  ticks per second   : %.1f\n", ticksPerSecond);
+	std::printf("  tick latency (us)  : p50 %.2f, p90 %.2f, p99 %.2f, max %.2f\n",
+		GetPercentile(latencies, 50.0),
+		GetPercentile(latencies, 90.0),
+		GetPercentile(latencies, 99.0),
+		latencies.empty() ? 0.0 : latencies.back()
+	);
+	std::printf("  peak bullets       : %u\n", peakBullets);
+	std::printf("  player hits        : %llu (%llu refills)\n", static_cast<unsigned long long>(countOfHit), static_cast<unsigned long long>(countOfDeath));
+	std::printf("  outcome hash       : %016llx\n", static_cast<unsigned long long>(outcomeHash));
+
+	simulation.Release();
+	ObjectManager::Get().FlushDestroyedObjects();
+}
+
+
+int main(int argc, char** argv)
+{
+	BenchOption option;
+	if (!ParseOption(argc, argv, option))
+	{
+		std::fprintf(stderr, "usage : Dodge3DHeadlessBench [seconds=60] [rate=60] [spawners=4] [capacity=1024] [workers=-1] [seed=1] [record=<path>] [replay=<path>] [model=object|entity] [pattern=<path>]\n");
+		return 1;
+	}
+
+	if (option.workers >= 0)
+	{
+		JobSystem::Get().SetCountOfWorker(static_cast<uint32_t>(option.workers));
+	}
+
+	InputManager::Get().Startup();
+	JobSystem::Get().Startup();
+	ResourceManager::Get().Startup();
+	ObjectManager::Get().Startup();
+
+	CreateAimedBulletPattern("AimedSlowPattern", 1.5f);
+	CreateAimedBulletPattern("AimedFastPattern", 1.0f);
+
+	if (!option.patternPath.empty() && !LoadBulletPattern(option.patternPath, "BenchPattern"))
+	{
+		std::fprintf(stderr, "failed to load bullet pattern %s...\n", option.patternPath.c_str());
+		return 1;
+	}
+
+	std::vector<uint8_t> replayStream;
+	bool bIsReplay = !option.replayPath.empty();
+	if (bIsReplay)
+	{
+		if (!BenchUtils::ReadBufferFromFile(option.replayPath, replayStream))
+		{
+			std::fprintf(stderr, "failed to read input stream %s...\n", option.replayPath.c_str());
+			return 1;
+		}
+
+		if (!InputManager::Get().StartReplay(replayStream))
+		{
+			std::fprintf(stderr, "invalid input stream %s...\n", option.replayPath.c_str());
+			return 1;
+		}
+
+		option.seed = InputManager::Get().GetInputStreamSeed();
+	}
+	else if (!option.recordPath.empty())
+	{
+		InputManager::Get().StartRecording(option.seed);
+	}
+
+	if (option.model == "entity")
+	{
+		RunSimulation<EntityPlaySimulation>(option, bIsReplay);
+	}
+	else
+	{
+		RunSimulation<PlaySimulation>(option, bIsReplay);
+	}
+
+	bool bHasReplayError = bIsReplay && InputManager::Get().HasReplayError();
+	if (bHasReplayError)
+	{
+		std::fprintf(stderr, "truncated input stream %s...\n", option.replayPath.c_str());
+	}
+
+	ObjectManager::Get().Shutdown();
+	ResourceManager::Get().Shutdown();
+	JobSystem::Get().Shutdown();
+	InputManager::Get().Shutdown();
+
+	return bHasReplayError ? 1 : 0;
+}
\ No newline at end of file
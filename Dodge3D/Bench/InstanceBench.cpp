@@ -0,0 +1,307 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "CollisionWorld.h"
+#include "InstanceBuffer.h"
+#include "JobSystem.h"
+#include "Material.h"
+#include "ObjectManager.h"
+#include "RandomStream.h"
+#include "RecordingRenderBackend.h"
+#include "RenderQueue.h"
+#include "ResourceManager.h"
+#include "StaticMesh.h"
+
+#include "BulletField.h"
+
+
+/**
+ * @brief ġũ  ɼԴϴ.
+ */
+struct BenchOption
+{
+	uint32_t bullets = 4096; // ÿ ִ Ѿ Դϴ.
+	uint32_t frames = 240;   //   Դϴ.
+};
+
+
+/**
+ * @brief 帮 ȯ濡 ̴   ڵԴϴ.
+ *
+ * @note ̴ OpenGL    ϴ.  ť ϴ 鿣 ̴  Ƿ  ٸ ּҸ  ˴ϴ.
+ */
+struct ShaderTag
+{
+	uint64_t tag = 0;
+};
+
+
+/**
+ * @brief  ڷκ ġũ  ɼ нϴ.
+ *
+ * @param argc   Դϴ.
+ * @param argv   Դϴ.
+ * @param outOption   ɼԴϴ.
+ *
+ * @return  ڸ оٸ true, ׷  false ȯմϴ.
+ */
+bool ParseOption(int32_t argc, char** argv, BenchOption& outOption)
+{
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument.rfind("bullets=", 0) == 0)
+		{
+			outOption.bullets = static_cast<uint32_t>(std::stoul(argument.substr(8)));
+		}
+		else if (argument.rfind("frames=", 0) == 0)
+		{
+			outOption.frames = static_cast<uint32_t>(std::stoul(argument.substr(7)));
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return outOption.bullets > 0 && outOption.frames > 0;
+}
+
+
+/**
+ * @brief νϽ  νϽ ִ Ѿ  İ    ˻մϴ.
+ *
+ * @param bulletField ˻ Ѿ ʵԴϴ.
+ * @param interpolationAlpha  Դϴ.
+ * @param instanceBuffer Ѿ ä νϽ Դϴ.
+ *
+ * @return  νϽ ġ    ̵,  а Ʈ  ٸ true, ׷  false ȯմϴ.
+ */
+bool IsSameAsWorldMatrix(const BulletField* bulletField, float interpolationAlpha, const InstanceBuffer& instanceBuffer)
+{
+	const std::vector<Vector4f>& instances = instanceBuffer.GetInstances();
+
+	std::size_t index = 0;
+	for (uint32_t slot = 0; slot < bulletField->GetCountOfSlot(); ++slot)
+	{
+		if (!bulletField->IsAlive(slot))
+		{
+			continue;
+		}
+
+		if (index >= instances.size())
+		{
+			return false;
+		}
+
+		Matrix4x4f world = bulletField->GetWorldMatrix(slot, interpolationAlpha);
+		const float expected[4] = { world.m[3][0], world.m[3][1], world.m[3][2], world.m[0][0] };
+		const float actual[4] = { instances[index].x, instances[index].y, instances[index].z, instances[index].w };
+
+		if (std::memcmp(expected, actual, sizeof(expected)) != 0)
+		{
+			return false;
+		}
+
+		index++;
+	}
+
+	return index == instances.size();
+}
+
+
+int main(int argc, char** argv)
+{
+	BenchOption option;
+	if (!ParseOption(argc, argv, option))
+	{
+		std::fprintf(stderr, "usage : Dodge3DInstanceBench [bullets=4096] [frames=240]\n");
+		return 1;
+	}
+
+	JobSystem::Get().Startup();
+	ResourceManager::Get().Startup();
+	ObjectManager::Get().Startup();
+
+	std::printf("Dodge3DInstanceBench\n");
+
+	int32_t countOfMismatch = 0;
+	auto check = [&](const char* name, bool bIsMatch)
+	{
+		if (!bIsMatch)
+		{
+			std::printf("  mismatch %s\n", name);
+			countOfMismatch++;
+		}
+	};
+
+	CollisionWorld* collisionWorld = ObjectManager::Get().CreateObject<CollisionWorld>("CollisionWorld");
+	collisionWorld->Initialize(CollisionWorld::EBroadphase::UniformGrid, Vector3f(-6.0f, -1.0f, -6.0f), Vector3f(+6.0f, +2.0f, +6.0f), 1.0f);
+
+	BulletField* bulletField = ObjectManager::Get().CreateObject<BulletField>("BulletField");
+	bulletField->Initialize(option.bullets);
+
+	//   ٸ Ѿ ϰ Ϻθ ؼ  ̿   ϴ.
+	RandomStream random(1);
+	for (uint32_t index = 0; index < option.bullets + option.bullets / 4; ++index)
+	{
+		Vector3f location(random.NextFloat(-5.0f, 5.0f), 0.5f, random.NextFloat(-5.0f, 5.0f));
+		Vector3f direction(random.NextFloat(-1.0f, 1.0f), 0.0f, random.NextFloat(-1.0f, 1.0f));
+		bulletField->Spawn(location, direction, random.NextFloat(1.0f, 3.0f), random.NextFloat(0.05f, 0.2f));
+	}
+
+	for (uint32_t slot = 0; slot < bulletField->GetCountOfSlot(); slot += 5)
+	{
+		bulletField->Kill(slot);
+	}
+
+	bulletField->RecordPrevLocations();
+	bulletField->Tick(1.0f / 60.0f);
+
+	InstanceBuffer instanceBuffer;
+	instanceBuffer.Initialize(option.bullets);
+
+	//   νϽ  ġ  Ѿ˸ ׸  İ ƾ մϴ.
+	const float interpolationAlphas[] = { 0.0f, 0.25f, 0.5f, 1.0f };
+	for (const float& interpolationAlpha : interpolationAlphas)
+	{
+		bulletField->PackInstances(interpolationAlpha, instanceBuffer);
+		check("pack same as world matrix", IsSameAsWorldMatrix(bulletField, interpolationAlpha, instanceBuffer));
+	}
+
+	check("pack alive bullets", instanceBuffer.GetCountOfInstance() == bulletField->GetCountOfAlive());
+
+	// ٽ ä  νϽ  ʾƾ մϴ.
+	bulletField->PackInstances(0.5f, instanceBuffer);
+	check("pack clear previous instances", instanceBuffer.GetCountOfInstance() == bulletField->GetCountOfAlive());
+
+	//    ε н  н Ѿ ߰ؼ, Ѿ˸ ׸ İ νϽ ׸  մϴ.
+	ShaderTag shaderTags[4];
+	Shader* shadowShader = reinterpret_cast<Shader*>(&shaderTags[0]);
+	Shader* shadowInstancedShader = reinterpret_cast<Shader*>(&shaderTags[1]);
+	Shader* lightShader = reinterpret_cast<Shader*>(&shaderTags[2]);
+	Shader* lightInstancedShader = reinterpret_cast<Shader*>(&shaderTags[3]);
+	const uint32_t shadowMapID = 7;
+
+	RenderQueue renderQueue;
+	RecordingRenderBackend backend;
+
+	auto submitPerBullet = [&](float interpolationAlpha)
+	{
+		renderQueue.Clear();
+
+		DrawPacket shadowPacket;
+		shadowPacket.pass = ERenderPass::Shadow;
+		shadowPacket.shader = shadowShader;
+		shadowPacket.mesh = bulletField->GetMesh();
+
+		DrawPacket opaquePacket;
+		opaquePacket.pass = ERenderPass::Opaque;
+		opaquePacket.shader = lightShader;
+		opaquePacket.mesh = bulletField->GetMesh();
+		opaquePacket.material = bulletField->GetMaterial();
+		opaquePacket.textureID = shadowMapID;
+
+		for (uint32_t slot = 0; slot < bulletField->GetCountOfSlot(); ++slot)
+		{
+			if (bulletField->IsAlive(slot))
+			{
+				Matrix4x4f world = bulletField->GetWorldMatrix(slot, interpolationAlpha);
+
+				shadowPacket.world = world;
+				renderQueue.Add(shadowPacket);
+
+				opaquePacket.world = world;
+				renderQueue.Add(opaquePacket);
+			}
+		}
+
+		backend.Clear();
+		RenderQueue::Statistics shadowStatistics = renderQueue.Submit(backend, ERenderPass::Shadow);
+		RenderQueue::Statistics opaqueStatistics = renderQueue.Submit(backend, ERenderPass::Opaque);
+		return shadowStatistics.countOfDraw + opaqueStatistics.countOfDraw;
+	};
+
+	auto submitInstanced = [&](float interpolationAlpha)
+	{
+		renderQueue.Clear();
+
+		bulletField->PackInstances(interpolationAlpha, instanceBuffer);
+		instanceBuffer.Upload();
+
+		DrawPacket shadowPacket;
+		shadowPacket.pass = ERenderPass::Shadow;
+		shadowPacket.shader = shadowInstancedShader;
+		shadowPacket.mesh = bulletField->GetMesh();
+		shadowPacket.instanceBuffer = &instanceBuffer;
+		renderQueue.Add(shadowPacket);
+
+		DrawPacket opaquePacket;
+		opaquePacket.pass = ERenderPass::Opaque;
+		opaquePacket.shader = lightInstancedShader;
+		opaquePacket.mesh = bulletField->GetMesh();
+		opaquePacket.material = bulletField->GetMaterial();
+		opaquePacket.textureID = shadowMapID;
+		opaquePacket.instanceBuffer = &instanceBuffer;
+		renderQueue.Add(opaquePacket);
+
+		backend.Clear();
+		RenderQueue::Statistics shadowStatistics = renderQueue.Submit(backend, ERenderPass::Shadow);
+		RenderQueue::Statistics opaqueStatistics = renderQueue.Submit(backend, ERenderPass::Opaque);
+
+		check("instanced instance count", shadowStatistics.countOfInstance == bulletField->GetCountOfAlive() && opaqueStatistics.countOfInstance == bulletField->GetCountOfAlive());
+		return shadowStatistics.countOfDraw + opaqueStatistics.countOfDraw;
+	};
+
+	uint32_t countOfPerBulletDraw = submitPerBullet(0.5f);
+	check("per bullet draw call", countOfPerBulletDraw == 2 * bulletField->GetCountOfAlive());
+
+	uint32_t countOfInstancedDraw = submitInstanced(0.5f);
+	check("instanced draw call", countOfInstancedDraw == 2);
+
+	bool bIsValidInstancedCommand = backend.GetCountOfCommand(RecordingRenderBackend::ECommandType::DrawMeshInstanced) == 2 && backend.GetCountOfCommand(RecordingRenderBackend::ECommandType::DrawMesh) == 0;
+	for (const RecordingRenderBackend::Command& command : backend.GetCommands())
+	{
+		if (command.type == RecordingRenderBackend::ECommandType::DrawMeshInstanced)
+		{
+			bIsValidInstancedCommand = bIsValidInstancedCommand
+				&& command.instanceBuffer == &instanceBuffer
+				&& command.countOfInstance == bulletField->GetCountOfAlive()
+				&& command.indexCount == bulletField->GetMesh()->GetIndexCount();
+		}
+	}
+	check("instanced command stream", bIsValidInstancedCommand);
+
+	double perBulletMilliseconds = 0.0;
+	double instancedMilliseconds = 0.0;
+	for (uint32_t frame = 0; frame < option.frames; ++frame)
+	{
+		float interpolationAlpha = static_cast<float>(frame % 8) / 8.0f;
+
+		auto startTime = std::chrono::steady_clock::now();
+		countOfPerBulletDraw = submitPerBullet(interpolationAlpha);
+		auto endTime = std::chrono::steady_clock::now();
+		perBulletMilliseconds += std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+		startTime = std::chrono::steady_clock::now();
+		countOfInstancedDraw = submitInstanced(interpolationAlpha);
+		endTime = std::chrono::steady_clock::now();
+		instancedMilliseconds += std::chrono::duration<double, std::milli>(endTime - startTime).count();
+	}
+
+	std::printf("  bullets %u, index count %u\n", bulletField->GetCountOfAlive(), bulletField->GetMesh()->GetIndexCount());
+	std::printf("  per bullet : %6u draw calls/frame, %7.3f ms/frame\n", countOfPerBulletDraw, perBulletMilliseconds / static_cast<double>(option.frames));
+	std::printf("  instanced  : %6u draw calls/frame, %7.3f ms/frame, %zu bytes/frame upload\n", countOfInstancedDraw, instancedMilliseconds / static_cast<double>(option.frames), instanceBuffer.GetInstances().size() * sizeof(Vector4f));
+
+	instanceBuffer.Release();
+	ObjectManager::Get().Shutdown();
+	ResourceManager::Get().Shutdown();
+	JobSystem::Get().Shutdown();
+
+	std::printf("  result : %s\n", (countOfMismatch == 0) ? "ok" : "mismatch");
+	return (countOfMismatch == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "JobSystem.h"
+
+
+/**
+ * @brief  ý ġũ  ɼԴϴ.
+ */
+struct BenchOption
+{
+	uint32_t entities = 1000000; //  ƼƼ Դϴ.
+	uint32_t frames = 120;       //   Դϴ.
+	uint32_t grain = 16384;      //  ۾  ƼƼ Դϴ.
+	uint32_t maxThreads = 0;     //  ִ  Դϴ. 0̶ ϵ   մϴ.
+};
+
+
+/**
+ * @brief ռ ƼƼ SoA Դϴ.
+ */
+struct EntityField
+{
+	std::vector<float> positionX;
+	std::vector<float> positionY;
+	std::vector<float> positionZ;
+	std::vector<float> velocityX;
+	std::vector<float> velocityY;
+	std::vector<float> velocityZ;
+};
+
+
+/**
+ * @brief  ڸ Ľմϴ.
+ *
+ * @param argc   Դϴ.
+ * @param argv   Դϴ.
+ * @param outOption Ľ  ɼԴϴ.
+ *
+ * @return  ڸ Ľߴٸ true, ׷  false ȯմϴ.
+ */
+bool ParseOption(int32_t argc, char** argv, BenchOption& outOption)
+{
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		std::size_t separator = argument.find('=');
+		if (separator == std::string::npos)
+		{
+			return false;
+		}
+
+		std::string key = argument.substr(0, separator);
+		uint32_t value = static_cast<uint32_t>(std::strtoul(argument.c_str() + separator + 1, nullptr, 10));
+
+		if (key == "entities")
+		{
+			outOption.entities = value;
+		}
+		else if (key == "frames")
+		{
+			outOption.frames = value;
+		}
+		else if (key == "grain")
+		{
+			outOption.grain = value;
+		}
+		else if (key == "threads")
+		{
+			outOption.maxThreads = value;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return outOption.entities > 0 && outOption.frames > 0 && outOption.grain > 0;
+}
+
+
+/**
+ * @brief ƼƼ   Ӹŭ մϴ.
+ *
+ * @param field  ƼƼԴϴ.
+ * @param begin   Դϴ.
+ * @param end   Դϴ.
+ * @param deltaSeconds Ÿ ðԴϴ.
+ *
+ * @note   ȿ ƨ, ӵ  踦 մϴ.
+ */
+void UpdateEntities(EntityField& field, uint32_t begin, uint32_t end, float deltaSeconds)
+{
+	for (uint32_t index = begin; index < end; ++index)
+	{
+		float x = field.positionX[index] + field.velocityX[index] * deltaSeconds;
+		float y = field.positionY[index] + field.velocityY[index] * deltaSeconds;
+		float z = field.positionZ[index] + field.velocityZ[index] * deltaSeconds;
+
+		field.velocityX[index] = (std::fabs(x) > 100.0f) ? -field.velocityX[index] : field.velocityX[index];
+		field.velocityY[index] = (std::fabs(y) > 100.0f) ? -field.velocityY[index] : field.velocityY[index];
+		field.velocityZ[index] = (std::fabs(z) > 100.0f) ? -field.velocityZ[index] : field.velocityZ[index];
+
+		float speed = std::sqrt(field.velocityX[index] * field.velocityX[index] + field.velocityY[index] * field.velocityY[index] + field.velocityZ[index] * field.velocityZ[index]);
+		float damping = 1.0f / (1.0f + 0.001f * speed * deltaSeconds);
+
+		field.velocityX[index] *= damping;
+		field.velocityY[index] *= damping;
+		field.velocityZ[index] *= damping;
+
+		field.positionX[index] = x;
+		field.positionY[index] = y;
+		field.positionZ[index] = z;
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	BenchOption option;
+	if (!ParseOption(argc, argv, option))
+	{
+		std::fprintf(stderr, "usage : Dodge3DJobBench [entities=1000000] [frames=120] [grain=16384] [threads=<hardware>]\n");
+		return 1;
+	}
+
+	uint32_t maxThreads = option.maxThreads;
+	if (maxThreads == 0)
+	{
+		maxThreads = std::max<uint32_t>(1, std::thread::hardware_concurrency());
+	}
+
+	EntityField field;
+	field.positionX.resize(option.entities);
+	field.positionY.resize(option.entities);
+	field.positionZ.resize(option.entities);
+	field.velocityX.resize(option.entities);
+	field.velocityY.resize(option.entities);
+	field.velocityZ.resize(option.entities);
+
+	std::printf("Dodge3DJobBench\n");
+	std::printf("  entities           : %u\n", option.entities);
+	std::printf("  frames             : %u\n", option.frames);
+	std::printf("  grain              : %u\n", option.grain);
+
+	std::vector<uint32_t> countOfThreads;
+	for (uint32_t countOfThread = 1; countOfThread < maxThreads; countOfThread *= 2)
+	{
+		countOfThreads.push_back(countOfThread);
+	}
+	countOfThreads.push_back(maxThreads);
+
+	double singleThreadMilliseconds = 0.0;
+	for (const auto& countOfThread : countOfThreads)
+	{
+		for (uint32_t index = 0; index < option.entities; ++index)
+		{
+			float phase = static_cast<float>(index);
+			field.positionX[index] = std::sin(phase) * 50.0f;
+			field.positionY[index] = std::cos(phase) * 50.0f;
+			field.positionZ[index] = std::sin(phase * 0.5f) * 50.0f;
+			field.velocityX[index] = std::cos(phase * 0.25f) * 10.0f;
+			field.velocityY[index] = std::sin(phase * 0.75f) * 10.0f;
+			field.velocityZ[index] = std::cos(phase * 1.5f) * 10.0f;
+		}
+
+		JobSystem::Get().SetCountOfWorker(countOfThread - 1);
+		JobSystem::Get().Startup();
+
+		auto startTime = std::chrono::steady_clock::now();
+		for (uint32_t frame = 0; frame < option.frames; ++frame)
+		{
+			JobSystem::Get().ParallelFor(0, option.entities, option.grain,
+				[&](uint32_t begin, uint32_t end)
+				{
+					UpdateEntities(field, begin, end, 1.0f / 60.0f);
+				}
+			);
+		}
+		auto endTime = std::chrono::steady_clock::now();
+
+		JobSystem::Get().Shutdown();
+
+		double milliseconds = std::chrono::duration<double, std::milli>(endTime - startTime).count() / static_cast<double>(option.frames);
+		if (countOfThread == 1)
+		{
+			singleThreadMilliseconds = milliseconds;
+		}
+
+		double checksum = 0.0;
+		for (uint32_t index = 0; index < option.entities; index += 997)
+		{
+			checksum += static_cast<double>(field.positionX[index] + field.positionY[index] + field.positionZ[index]);
+		}
+
+		std::printf("  threads %-3u        : %8.3f ms/frame, speedup %.2fx (checksum %.3f)\n", countOfThread, milliseconds, singleThreadMilliseconds / milliseconds, checksum);
+	}
+
+	return 0;
+}
\ No newline at end of file
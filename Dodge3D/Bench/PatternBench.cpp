@@ -0,0 +1,407 @@
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <json/json.h>
+
+#include "CollisionWorld.h"
+#include "JobSystem.h"
+#include "MathUtils.h"
+#include "ObjectManager.h"
+#include "RandomStream.h"
+#include "ResourceManager.h"
+
+#include "BulletField.h"
+#include "BulletPattern.h"
+
+
+/**
+ * @brief Ѿ  ġũ  ɼԴϴ.
+ */
+struct BenchOption
+{
+	uint32_t events = 2000;   //  ߻ ̺Ʈ Դϴ.
+	uint32_t count = 256;     //  ߻ ̺Ʈ ߻ Ѿ Դϴ.
+};
+
+
+/**
+ * @brief ߻ Ѿ   ذԴϴ.
+ */
+struct ReferenceEmission
+{
+	float directionX;   // Ѿ  x Դϴ.
+	float directionY;   // Ѿ  y Դϴ.
+	float directionZ;   // Ѿ  z Դϴ.
+	float speed;        // Ѿ ӷԴϴ.
+};
+
+
+/**
+ * @brief ذ   ϴ Դϴ.
+ */
+static const float REFERENCE_EPSILON = 1.0e-5f;
+
+
+/**
+ * @brief 45   Դϴ.
+ */
+static const float HALF_SQRT2 = 0.70710678f;
+
+
+/**
+ * @brief  ڸ Ľմϴ.
+ *
+ * @param argc   Դϴ.
+ * @param argv   Դϴ.
+ * @param outOption Ľ  ɼԴϴ.
+ *
+ * @return  ڸ Ľߴٸ true, ׷  false ȯմϴ.
+ */
+bool ParseOption(int32_t argc, char** argv, BenchOption& outOption)
+{
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		std::size_t separator = argument.find('=');
+		if (separator == std::string::npos)
+		{
+			return false;
+		}
+
+		std::string key = argument.substr(0, separator);
+		const char* value = argument.c_str() + separator + 1;
+
+		if (key == "events")
+		{
+			outOption.events = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+		}
+		else if (key == "count")
+		{
+			outOption.count = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return outOption.events > 0 && 0 < outOption.count && outOption.count <= UINT16_MAX;
+}
+
+
+/**
+ * @brief Ѿ  ܰ ϳ  Json ü Ľմϴ.
+ *
+ * @param source Ѿ  Json ڿԴϴ.
+ *
+ * @return Ľ Json ü ȯմϴ.
+ */
+Json::Value ParsePattern(const std::string& source)
+{
+	Json::Value root;
+	Json::Reader reader;
+	reader.parse(source, root);
+
+	return root;
+}
+
+
+/**
+ * @brief Ѿ    ϸ ߻ Ѿ˵ ذ մϴ.
+ *
+ * @param name ˻ ׸ ̸Դϴ.
+ * @param source Ѿ  Json ڿԴϴ.
+ * @param deltaSeconds  Ʈ Ÿ ð Դϴ.
+ * @param countOfEmissions Ʈ ߻Ǿ  Ѿ Դϴ.
+ * @param references ߻   Ѿ˵ ذԴϴ.
+ *
+ * @return  Ѿ ذ ٸ true, ׷  false ȯմϴ.
+ *
+ * @note ߻ ġ (1, 0.5, 2),   (1, 0.5, 7)̹Ƿ   +ZԴϴ.
+ */
+bool CheckPattern(const char* name, const std::string& source, float deltaSeconds, const std::vector<uint32_t>& countOfEmissions, const std::vector<ReferenceEmission>& references)
+{
+	BulletPattern pattern;
+	pattern.Initialize(ParsePattern(source));
+
+	Vector3f origin(1.0f, 0.5f, 2.0f);
+	Vector3f target(1.0f, 0.5f, 7.0f);
+
+	RandomStream randomStream(7);
+	BulletPattern::Cursor cursor;
+	std::vector<BulletPattern::Emission> emissions;
+
+	bool bIsPass = true;
+	for (std::size_t step = 0; step < countOfEmissions.size(); ++step)
+	{
+		std::size_t countOfPrevEmission = emissions.size();
+		pattern.Execute(cursor, deltaSeconds, origin, target, randomStream, emissions);
+
+		if (emissions.size() - countOfPrevEmission != countOfEmissions[step])
+		{
+			std::printf("    %-16s: step %zu emitted %zu bullets, expected %u\n", name, step, emissions.size() - countOfPrevEmission, countOfEmissions[step]);
+			bIsPass = false;
+		}
+	}
+
+	if (emissions.size() != references.size())
+	{
+		std::printf("    %-16s: emitted %zu bullets, expected %zu\n", name, emissions.size(), references.size());
+		return false;
+	}
+
+	for (std::size_t index = 0; index < references.size(); ++index)
+	{
+		const BulletPattern::Emission& emission = emissions[index];
+		const ReferenceEmission& reference = references[index];
+
+		bool bIsSameLocation = emission.location.x == origin.x && emission.location.y == origin.y && emission.location.z == origin.z;
+		bool bIsSameDirection =
+			std::fabs(emission.direction.x - reference.directionX) <= REFERENCE_EPSILON &&
+			std::fabs(emission.direction.y - reference.directionY) <= REFERENCE_EPSILON &&
+			std::fabs(emission.direction.z - reference.directionZ) <= REFERENCE_EPSILON;
+		bool bIsSameSpeed = std::fabs(emission.speed - reference.speed) <= REFERENCE_EPSILON;
+
+		if (!bIsSameLocation || !bIsSameDirection || !bIsSameSpeed)
+		{
+			std::printf("    %-16s: bullet %zu (%.5f, %.5f, %.5f) x %.5f, expected (%.5f, %.5f, %.5f) x %.5f\n",
+				name, index,
+				emission.direction.x, emission.direction.y, emission.direction.z, emission.speed,
+				reference.directionX, reference.directionY, reference.directionZ, reference.speed
+			);
+			bIsPass = false;
+		}
+	}
+
+	std::printf("    %-16s: %s\n", name, bIsPass ? "pass" : "FAIL");
+	return bIsPass;
+}
+
+
+/**
+ * @brief Ѿ   Ÿ̹  ̺ մϴ.
+ *
+ * @return  ׸  ̺ ٸ true, ׷  false ȯմϴ.
+ */
+bool CheckReferenceTables()
+{
+	//  õ  Ʈ  ӷ ذ ϴ.
+	RandomStream referenceRandomStream(7);
+	float randomSpeed0 = referenceRandomStream.NextFloat(2.0f, 5.0f);
+	float randomSpeed1 = referenceRandomStream.NextFloat(2.0f, 5.0f);
+
+	bool bIsPass = true;
+
+	bIsPass &= CheckPattern("ring",
+		R"({ "steps": [ { "delay": 1.0, "shape": "ring", "count": 4, "speed": 3.0 } ] })",
+		0.5f,
+		{ 0, 4, 0, 4 },
+		{
+			{ +1.0f, 0.0f,  0.0f, 3.0f }, {  0.0f, 0.0f, +1.0f, 3.0f }, { -1.0f, 0.0f,  0.0f, 3.0f }, {  0.0f, 0.0f, -1.0f, 3.0f },
+			{ +1.0f, 0.0f,  0.0f, 3.0f }, {  0.0f, 0.0f, +1.0f, 3.0f }, { -1.0f, 0.0f,  0.0f, 3.0f }, {  0.0f, 0.0f, -1.0f, 3.0f },
+		}
+	);
+
+	bIsPass &= CheckPattern("fan",
+		R"({ "steps": [ { "delay": 1.0, "shape": "fan", "count": 3, "angle": 90.0, "spread": 90.0, "speed": 2.0 } ] })",
+		1.0f,
+		{ 3 },
+		{
+			{ +HALF_SQRT2, 0.0f, +HALF_SQRT2, 2.0f }, { 0.0f, 0.0f, +1.0f, 2.0f }, { -HALF_SQRT2, 0.0f, +HALF_SQRT2, 2.0f },
+		}
+	);
+
+	bIsPass &= CheckPattern("aimed",
+		R"({ "steps": [ { "delay": 1.0, "shape": "aimed", "count": 3, "angle": 90.0, "spread": 90.0, "speed": 2.0 } ] })",
+		1.0f,
+		{ 3 },
+		{
+			{ -HALF_SQRT2, 0.0f, +HALF_SQRT2, 2.0f }, { -1.0f, 0.0f, 0.0f, 2.0f }, { -HALF_SQRT2, 0.0f, -HALF_SQRT2, 2.0f },
+		}
+	);
+
+	bIsPass &= CheckPattern("aimed random",
+		R"({ "steps": [ { "delay": 1.0, "shape": "aimed", "count": 1, "speed": [2.0, 5.0] } ] })",
+		1.0f,
+		{ 1, 1 },
+		{
+			{ 0.0f, 0.0f, +1.0f, randomSpeed0 }, { 0.0f, 0.0f, +1.0f, randomSpeed1 },
+		}
+	);
+
+	bIsPass &= CheckPattern("spiral",
+		R"({ "steps": [ { "delay": 0.5, "shape": "spiral", "count": 2, "speed": 1.0, "waves": 3, "duration": 1.0, "turn": 90.0 } ] })",
+		0.5f,
+		{ 2, 2, 2 },
+		{
+			{ +1.0f, 0.0f, 0.0f, 1.0f }, { -1.0f, 0.0f,  0.0f, 1.0f },
+			{  0.0f, 0.0f, +1.0f, 1.0f }, {  0.0f, 0.0f, -1.0f, 1.0f },
+			{ -1.0f, 0.0f, 0.0f, 1.0f }, { +1.0f, 0.0f,  0.0f, 1.0f },
+		}
+	);
+
+	// ̺ ð 0, 0.25, 1.0̰,  1 ڿ  2ʸ ݺ˴ϴ.
+	bIsPass &= CheckPattern("easeIn waves",
+		R"({ "steps": [ { "delay": 1.0, "shape": "ring", "count": 1, "speed": 1.0, "waves": 3, "duration": 1.0, "curve": "easeIn" } ] })",
+		0.25f,
+		{ 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 1 },
+		{
+			{ +1.0f, 0.0f, 0.0f, 1.0f }, { +1.0f, 0.0f, 0.0f, 1.0f }, { +1.0f, 0.0f, 0.0f, 1.0f }, { +1.0f, 0.0f, 0.0f, 1.0f },
+		}
+	);
+
+	return bIsPass;
+}
+
+
+/**
+ * @brief Լ  ð մϴ.
+ *
+ * @param function  ԼԴϴ.
+ *
+ * @return  ð(и) ȯմϴ.
+ */
+template <typename TFunction>
+double MeasureMilliseconds(TFunction&& function)
+{
+	auto startTime = std::chrono::steady_clock::now();
+	function();
+	auto endTime = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::milli>(endTime - startTime).count();
+}
+
+
+int main(int argc, char** argv)
+{
+	BenchOption option;
+	if (!ParseOption(argc, argv, option))
+	{
+		std::fprintf(stderr, "usage : Dodge3DPatternBench [events=2000] [count=256]\n");
+		return 1;
+	}
+
+	JobSystem::Get().Startup();
+	ResourceManager::Get().Startup();
+	ObjectManager::Get().Startup();
+
+	std::printf("Dodge3DPatternBench\n");
+	std::printf("  reference tables\n");
+	bool bIsPass = CheckReferenceTables();
+
+	CollisionWorld* collisionWorld = ObjectManager::Get().CreateObject<CollisionWorld>("CollisionWorld");
+	collisionWorld->Initialize(CollisionWorld::EBroadphase::UniformGrid, Vector3f(-6.0f, -1.0f, -6.0f), Vector3f(+6.0f, +2.0f, +6.0f), 1.0f);
+
+	BulletField* bulletField = ObjectManager::Get().CreateObject<BulletField>("BulletField");
+	bulletField->Initialize(option.count);
+
+	Json::Value step;
+	step["delay"] = 1.0f;
+	step["shape"] = "ring";
+	step["count"] = option.count;
+	step["speed"].append(2.0f);
+	step["speed"].append(5.0f);
+
+	Json::Value root;
+	root["steps"].append(step);
+
+	BulletPattern pattern;
+	pattern.Initialize(root);
+
+	Vector3f origin(0.0f, 0.5f, 0.0f);
+	Vector3f target(3.0f, 0.5f, 4.0f);
+	std::vector<BulletPattern::Emission> emissions;
+	emissions.reserve(option.count);
+
+	// Ʈڵ  :  ̺ о ߻  ӵ ۿ մϴ.
+	RandomStream patternRandomStream(1);
+	BulletPattern::Cursor cursor;
+	double checksum = 0.0;
+	double executeMilliseconds = MeasureMilliseconds(
+		[&]()
+		{
+			for (uint32_t event = 0; event < option.events; ++event)
+			{
+				emissions.clear();
+				pattern.Execute(cursor, 1.0f, origin, target, patternRandomStream, emissions);
+				checksum += static_cast<double>(emissions.back().direction.x * emissions.back().speed);
+			}
+		}
+	);
+
+	//   : Ѿ˸   ϰ ӷ  ̽ϴ.
+	RandomStream legacyRandomStream(1);
+	std::vector<BulletPattern::Emission> legacyEmissions(option.count);
+	double legacyChecksum = 0.0;
+	double legacyMilliseconds = MeasureMilliseconds(
+		[&]()
+		{
+			for (uint32_t event = 0; event < option.events; ++event)
+			{
+				for (uint32_t index = 0; index < option.count; ++index)
+				{
+					float radian = MathUtils::ToRadian(360.0f * static_cast<float>(index) / static_cast<float>(option.count));
+					legacyEmissions[index].location = origin;
+					legacyEmissions[index].direction = Vector3f(std::cos(radian), 0.0f, std::sin(radian));
+					legacyEmissions[index].speed = legacyRandomStream.NextFloat(2.0f, 5.0f);
+				}
+				legacyChecksum += static_cast<double>(legacyEmissions.back().direction.x * legacyEmissions.back().speed);
+			}
+		}
+	);
+
+	// Ѿ ʵ忡   ϴ İ   ϴ  մϴ. ̺Ʈ  Ѿ   մϴ.
+	auto killAll = [&]()
+	{
+		for (uint32_t slot = 0; slot < bulletField->GetCountOfSlot(); ++slot)
+		{
+			bulletField->Kill(slot);
+		}
+	};
+
+	double spawnMilliseconds = MeasureMilliseconds(
+		[&]()
+		{
+			for (uint32_t event = 0; event < option.events; ++event)
+			{
+				for (const auto& emission : emissions)
+				{
+					bulletField->Spawn(emission.location, emission.direction, emission.speed, pattern.GetRadius());
+				}
+				killAll();
+			}
+		}
+	);
+
+	double spawnBatchMilliseconds = MeasureMilliseconds(
+		[&]()
+		{
+			for (uint32_t event = 0; event < option.events; ++event)
+			{
+				bulletField->SpawnBatch(emissions, pattern.GetRadius());
+				killAll();
+			}
+		}
+	);
+
+	double countOfBullet = static_cast<double>(option.events) * static_cast<double>(option.count);
+
+	std::printf("  emission events    : %u x %u bullets\n", option.events, option.count);
+	std::printf("  pattern execute    : %8.3f ms, %7.1f M bullets/s (checksum %.3f)\n", executeMilliseconds, countOfBullet / (executeMilliseconds * 1000.0), checksum);
+	std::printf("  per-bullet trig    : %8.3f ms, %7.1f M bullets/s (checksum %.3f)\n", legacyMilliseconds, countOfBullet / (legacyMilliseconds * 1000.0), legacyChecksum);
+	std::printf("  field spawn        : %8.3f ms\n", spawnMilliseconds);
+	std::printf("  field spawn batch  : %8.3f ms, %.2fx\n", spawnBatchMilliseconds, spawnMilliseconds / spawnBatchMilliseconds);
+	std::printf("  reference result   : %s\n", bIsPass ? "pass" : "FAIL");
+
+	pattern.Release();
+	ObjectManager::Get().Shutdown();
+	ResourceManager::Get().Shutdown();
+	JobSystem::Get().Shutdown();
+
+	return bIsPass ? 0 : 1;
+}
\ No newline at end of file
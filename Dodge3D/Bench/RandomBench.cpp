@@ -0,0 +1,95 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "MathUtils.h"
+#include "RandomStream.h"
+
+
+/**
+ * @brief    ȣ⸶ std::random_device std::mt19937 õ带 ؼ  Ǽ մϴ.
+ *
+ * @param minValue    ּڰԴϴ.
+ * @param maxValue    ִԴϴ.
+ *
+ * @return   Ǽ ȯմϴ.
+ */
+float GenerateRandomFloatPerCallDevice(float minValue, float maxValue)
+{
+	std::random_device randomDevice;
+	std::mt19937 generator(randomDevice());
+	std::uniform_real_distribution<float> distribution(MathUtils::Min<float>(minValue, maxValue), MathUtils::Max<float>(minValue, maxValue));
+
+	return distribution(generator);
+}
+
+
+/**
+ * @brief   count ϰ ȣ    ð մϴ.
+ *
+ * @param name   ̸Դϴ.
+ * @param count    ȽԴϴ.
+ * @param generate  Ǽ ϳ ϴ  Դϴ.
+ */
+template <typename TGenerate>
+void Measure(const char* name, uint64_t count, TGenerate&& generate)
+{
+	float sum = 0.0f;
+
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint64_t index = 0; index < count; ++index)
+	{
+		sum += generate();
+	}
+	auto endTime = std::chrono::steady_clock::now();
+
+	double nanoseconds = std::chrono::duration<double, std::nano>(endTime - startTime).count();
+	std::printf("  %-28s : %10.2f ns/call (checksum %.3f)\n", name, nanoseconds / static_cast<double>(count), sum);
+}
+
+
+int main(int argc, char** argv)
+{
+	uint64_t count = 1000000;
+	if (argc >= 2)
+	{
+		std::string argument = argv[1];
+		if (argument.rfind("count=", 0) != 0)
+		{
+			std::fprintf(stderr, "usage : Dodge3DRandomBench [count=1000000]\n");
+			return 1;
+		}
+
+		count = static_cast<uint64_t>(std::strtoull(argument.c_str() + 6, nullptr, 10));
+	}
+
+	// ȣ⸶ ý  ġ    ſ Ƿ Ƚ ٿ մϴ.
+	uint64_t countOfPerCallDevice = count / 100 + 1;
+
+	std::printf("Dodge3DRandomBench\n");
+	Measure("random_device per call", countOfPerCallDevice, []() { return GenerateRandomFloatPerCallDevice(2.0f, 5.0f); });
+	Measure("MathUtils (thread stream)", count, []() { return MathUtils::GenerateRandomFloat(2.0f, 5.0f); });
+
+	RandomStream randomStream(1);
+	Measure("RandomStream::NextFloat", count, [&]() { return randomStream.NextFloat(2.0f, 5.0f); });
+
+	std::vector<float> values(static_cast<std::size_t>(count));
+	auto startTime = std::chrono::steady_clock::now();
+	randomStream.FillUniform(values.data(), values.size(), 2.0f, 5.0f);
+	auto endTime = std::chrono::steady_clock::now();
+
+	float sum = 0.0f;
+	for (const auto& value : values)
+	{
+		sum += value;
+	}
+
+	double nanoseconds = std::chrono::duration<double, std::nano>(endTime - startTime).count();
+	std::printf("  %-28s : %10.2f ns/call (checksum %.3f)\n", "RandomStream::FillUniform", nanoseconds / static_cast<double>(count), sum);
+
+	return 0;
+}
\ No newline at end of file
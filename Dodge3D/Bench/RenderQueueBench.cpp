@@ -0,0 +1,584 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "Material.h"
+#include "RandomStream.h"
+#include "RecordingRenderBackend.h"
+#include "RenderQueue.h"
+#include "StaticMesh.h"
+
+
+/**
+ * @brief    ۾ Ѿ Դϴ.
+ */
+static const int32_t COUNT_OF_SCENE_BULLET = 512;
+
+
+/**
+ * @brief ġũ  ɼԴϴ.
+ */
+struct BenchOption
+{
+	uint32_t rounds = 64;      //  ۾ ݺ Դϴ.
+	uint32_t packets = 100000; //    ׸  Դϴ.
+	uint32_t sorts = 20;       //   ϴ ݺ Դϴ.
+	uint64_t seed = 1;         //  õԴϴ.
+};
+
+
+/**
+ * @brief  ڷκ ġũ  ɼ нϴ.
+ *
+ * @param argc   Դϴ.
+ * @param argv   Դϴ.
+ * @param outOption   ɼԴϴ.
+ *
+ * @return  ڸ оٸ true, ׷  false ȯմϴ.
+ */
+bool ParseOption(int32_t argc, char** argv, BenchOption& outOption)
+{
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument.rfind("rounds=", 0) == 0)
+		{
+			outOption.rounds = static_cast<uint32_t>(std::stoul(argument.substr(7)));
+		}
+		else if (argument.rfind("packets=", 0) == 0)
+		{
+			outOption.packets = static_cast<uint32_t>(std::stoul(argument.substr(8)));
+		}
+		else if (argument.rfind("sorts=", 0) == 0)
+		{
+			outOption.sorts = static_cast<uint32_t>(std::stoul(argument.substr(6)));
+		}
+		else if (argument.rfind("seed=", 0) == 0)
+		{
+			outOption.seed = std::stoull(argument.substr(5));
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return outOption.packets > 0 && outOption.sorts > 0;
+}
+
+
+/**
+ * @brief 帮 ȯ濡 ̴   ڵԴϴ.
+ *
+ * @note ̴ OpenGL    ϴ.  ť ϴ 鿣 ̴  Ƿ  ٸ ּҸ  ˴ϴ.
+ */
+struct ShaderTag
+{
+	uint64_t tag = 0;
+};
+
+
+/**
+ * @brief ׸    Դϴ.
+ */
+struct StateChangeCount
+{
+	uint32_t countOfShaderChange = 0;
+	uint32_t countOfTextureChange = 0;
+	uint32_t countOfMeshChange = 0;
+	uint32_t countOfMaterialChange = 0;
+};
+
+
+/**
+ * @brief  Ŀ ׸  ε մϴ.
+ *
+ * @param index  ׸  εԴϴ.
+ *
+ * @return ε    ȯմϴ.
+ */
+Matrix4x4f MakeTaggedWorld(uint32_t index)
+{
+	Matrix4x4f world;
+	world.m[0][0] = 1.0f;
+	world.m[1][1] = 1.0f;
+	world.m[2][2] = 1.0f;
+	world.m[3][3] = 1.0f;
+	world.m[3][0] = static_cast<float>(index);
+	return world;
+}
+
+
+/**
+ * @brief  ʰ ߰  ° ٲ  ε     մϴ.
+ *
+ * @param packets ߰  ׸ Դϴ.
+ * @param pass   нԴϴ.
+ *
+ * @return    ȯմϴ.
+ */
+StateChangeCount CountUnsortedStateChange(const std::vector<DrawPacket>& packets, ERenderPass pass)
+{
+	StateChangeCount count;
+
+	const Shader* shader = nullptr;
+	uint32_t textureID = 0;
+	const StaticMesh* mesh = nullptr;
+	const Material* material = nullptr;
+
+	for (const DrawPacket& packet : packets)
+	{
+		if (packet.pass != pass)
+		{
+			continue;
+		}
+
+		if (packet.shader != shader)
+		{
+			shader = packet.shader;
+			material = nullptr;
+			count.countOfShaderChange++;
+		}
+
+		if (packet.textureID != 0 && packet.textureID != textureID)
+		{
+			textureID = packet.textureID;
+			count.countOfTextureChange++;
+		}
+
+		if (packet.mesh != mesh)
+		{
+			mesh = packet.mesh;
+			count.countOfMeshChange++;
+		}
+
+		if (packet.material != nullptr && packet.material != material)
+		{
+			material = packet.material;
+			count.countOfMaterialChange++;
+		}
+	}
+
+	return count;
+}
+
+
+/**
+ * @brief   Ʈ ٽ ϸ鼭  ׸  ùٸ ·   ׷ ˻մϴ.
+ *
+ * @param packets ߰  ׸ Դϴ.
+ * @param pass ˻  нԴϴ.
+ * @param commands   ƮԴϴ.
+ *
+ * @return  ׸  ùٸ ·   ׷ٸ true, ׷  false ȯմϴ.
+ */
+bool IsValidCommandStream(const std::vector<DrawPacket>& packets, ERenderPass pass, const std::vector<RecordingRenderBackend::Command>& commands)
+{
+	if (commands.size() < 2 || commands.front().type != RecordingRenderBackend::ECommandType::Begin || commands.back().type != RecordingRenderBackend::ECommandType::End)
+	{
+		return false;
+	}
+
+	const Shader* shader = nullptr;
+	uint32_t textureID = 0;
+	const StaticMesh* mesh = nullptr;
+	const Material* material = nullptr;
+
+	std::vector<int32_t> countOfDraw(packets.size(), 0);
+	for (const RecordingRenderBackend::Command& command : commands)
+	{
+		switch (command.type)
+		{
+		case RecordingRenderBackend::ECommandType::BindShader:
+			shader = command.shader;
+			material = nullptr;
+			break;
+
+		case RecordingRenderBackend::ECommandType::BindTexture:
+			if (command.unit != 0)
+			{
+				return false;
+			}
+			textureID = command.textureID;
+			break;
+
+		case RecordingRenderBackend::ECommandType::BindMesh:
+			mesh = command.mesh;
+			break;
+
+		case RecordingRenderBackend::ECommandType::SetMaterial:
+			material = command.material;
+			break;
+
+		case RecordingRenderBackend::ECommandType::DrawMesh:
+		{
+			uint32_t index = static_cast<uint32_t>(command.world.m[3][0]);
+			if (index >= packets.size())
+			{
+				return false;
+			}
+
+			const DrawPacket& packet = packets[index];
+			if (packet.pass != pass || packet.shader != shader || packet.mesh != mesh || command.indexCount != mesh->GetIndexCount())
+			{
+				return false;
+			}
+
+			if ((packet.textureID != 0 && packet.textureID != textureID) || (packet.material != nullptr && packet.material != material))
+			{
+				return false;
+			}
+
+			countOfDraw[index]++;
+			break;
+		}
+
+		default:
+			break;
+		}
+	}
+
+	for (std::size_t index = 0; index < packets.size(); ++index)
+	{
+		if (countOfDraw[index] != ((packets[index].pass == pass) ? 1 : 0))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief  ť    Ű     ˻մϴ.
+ *
+ * @param renderQueue ˻  ťԴϴ.
+ *
+ * @return   ٸ true, ׷  false ȯմϴ.
+ */
+bool IsStableSorted(RenderQueue& renderQueue)
+{
+	std::vector<uint32_t> expected(renderQueue.GetCountOfPacket());
+	for (uint32_t index = 0; index < expected.size(); ++index)
+	{
+		expected[index] = index;
+	}
+
+	std::stable_sort(expected.begin(), expected.end(), [&](uint32_t lhs, uint32_t rhs) { return renderQueue.GetSortKey(lhs) < renderQueue.GetSortKey(rhs); });
+
+	return renderQueue.GetSortedIndices() == expected;
+}
+
+
+/**
+ * @brief  ť  谡     ˻մϴ.
+ *
+ * @param statistics ˻  Դϴ.
+ * @param backend    鿣Դϴ.
+ *
+ * @return    ٸ true, ׷  false ȯմϴ.
+ */
+bool IsSameStatistics(const RenderQueue::Statistics& statistics, const RecordingRenderBackend& backend)
+{
+	uint32_t countOfDraw = backend.GetCountOfCommand(RecordingRenderBackend::ECommandType::DrawMesh) + backend.GetCountOfCommand(RecordingRenderBackend::ECommandType::DrawMeshInstanced);
+
+	return statistics.countOfDraw == countOfDraw
+		&& statistics.countOfShaderChange == backend.GetCountOfCommand(RecordingRenderBackend::ECommandType::BindShader)
+		&& statistics.countOfTextureChange == backend.GetCountOfCommand(RecordingRenderBackend::ECommandType::BindTexture)
+		&& statistics.countOfMeshChange == backend.GetCountOfCommand(RecordingRenderBackend::ECommandType::BindMesh)
+		&& statistics.countOfMaterialChange == backend.GetCountOfCommand(RecordingRenderBackend::ECommandType::SetMaterial);
+}
+
+
+int main(int argc, char** argv)
+{
+	BenchOption option;
+	if (!ParseOption(argc, argv, option))
+	{
+		std::fprintf(stderr, "usage : Dodge3DRenderQueueBench [rounds=64] [packets=100000] [sorts=20] [seed=1]\n");
+		return 1;
+	}
+
+	std::printf("Dodge3DRenderQueueBench\n");
+
+	int32_t countOfMismatch = 0;
+	auto check = [&](const char* name, bool bIsMatch)
+	{
+		if (!bIsMatch)
+		{
+			std::printf("  mismatch %s\n", name);
+			countOfMismatch++;
+		}
+	};
+
+	ShaderTag shaderTags[4];
+	Shader* shaders[4];
+	for (uint32_t index = 0; index < 4; ++index)
+	{
+		shaderTags[index].tag = index;
+		shaders[index] = reinterpret_cast<Shader*>(&shaderTags[index]);
+	}
+
+	// ε   ٸ ޽ø  DrawMesh  ε  ޽ø մϴ.
+	std::vector<std::unique_ptr<StaticMesh>> meshes;
+	for (uint32_t index = 0; index < 8; ++index)
+	{
+		meshes.push_back(std::make_unique<StaticMesh>());
+		meshes.back()->Initialize(std::vector<Vertex>(3), std::vector<uint32_t>(3 * (index + 1), 0));
+	}
+
+	std::vector<std::unique_ptr<Material>> materials;
+	for (uint32_t index = 0; index < 8; ++index)
+	{
+		float color = static_cast<float>(index) / 8.0f;
+		materials.push_back(std::make_unique<Material>());
+		materials.back()->Initialize(Vector3f(color, color, color), Vector3f(color, color, color), Vector3f(color, color, color), 32.0f);
+	}
+
+	//    Դϴ. ٴ,  4, ÷̾, Ѿ  4 ڿ Ѿ ߰ϰ, Ѿ  Ѿ ޽ø մϴ.
+	{
+		const uint32_t shadowMapID = 7;
+
+		std::vector<DrawPacket> packets;
+		auto addObject = [&](const StaticMesh* mesh, const Material* material)
+		{
+			DrawPacket packet;
+			packet.mesh = mesh;
+			packet.world = MakeTaggedWorld(static_cast<uint32_t>(packets.size()));
+			packet.pass = ERenderPass::Shadow;
+			packet.shader = shaders[0];
+			packets.push_back(packet);
+
+			packet.world = MakeTaggedWorld(static_cast<uint32_t>(packets.size()));
+			packet.pass = ERenderPass::Opaque;
+			packet.shader = shaders[1];
+			packet.material = material;
+			packet.textureID = shadowMapID;
+			packets.push_back(packet);
+		};
+
+		addObject(meshes[0].get(), materials[0].get());
+		for (uint32_t wall = 0; wall < 4; ++wall)
+		{
+			addObject(meshes[1].get(), materials[1].get());
+		}
+		addObject(meshes[2].get(), materials[2].get());
+		for (uint32_t spawner = 0; spawner < 4; ++spawner)
+		{
+			addObject(meshes[3].get(), materials[3].get());
+		}
+		for (int32_t bullet = 0; bullet < COUNT_OF_SCENE_BULLET; ++bullet)
+		{
+			addObject(meshes[(bullet % 2 == 0) ? 3 : 4].get(), materials[4].get());
+		}
+
+		RenderQueue renderQueue;
+		for (const DrawPacket& packet : packets)
+		{
+			renderQueue.Add(packet);
+		}
+
+		check("scene stable sort", IsStableSorted(renderQueue));
+
+		RecordingRenderBackend backend;
+		RenderQueue::Statistics shadowStatistics = renderQueue.Submit(backend, ERenderPass::Shadow);
+		check("scene shadow command stream", IsValidCommandStream(packets, ERenderPass::Shadow, backend.GetCommands()));
+		check("scene shadow statistics", IsSameStatistics(shadowStatistics, backend));
+		check("scene shadow state change",
+			shadowStatistics.countOfDraw == packets.size() / 2
+			&& shadowStatistics.countOfShaderChange == 1
+			&& shadowStatistics.countOfTextureChange == 0
+			&& shadowStatistics.countOfMeshChange == 5
+			&& shadowStatistics.countOfMaterialChange == 0);
+
+		backend.Clear();
+		RenderQueue::Statistics opaqueStatistics = renderQueue.Submit(backend, ERenderPass::Opaque);
+		check("scene opaque command stream", IsValidCommandStream(packets, ERenderPass::Opaque, backend.GetCommands()));
+		check("scene opaque statistics", IsSameStatistics(opaqueStatistics, backend));
+		// Ѿ  ¦ Ѿ ޽ø  Ƽ ޶  ޽ ȿ Ƽ   ٲ, Ȧ Ѿ  Ƽ ״ մϴ.
+		check("scene opaque state change",
+			opaqueStatistics.countOfDraw == packets.size() / 2
+			&& opaqueStatistics.countOfShaderChange == 1
+			&& opaqueStatistics.countOfTextureChange == 1
+			&& opaqueStatistics.countOfMeshChange == 5
+			&& opaqueStatistics.countOfMaterialChange == 5);
+
+		StateChangeCount unsorted = CountUnsortedStateChange(packets, ERenderPass::Opaque);
+		std::printf("  scene %zu packets, opaque pass : unsorted mesh %u material %u -> sorted mesh %u material %u (per draw binding %u)\n",
+			packets.size(),
+			unsorted.countOfMeshChange,
+			unsorted.countOfMaterialChange,
+			opaqueStatistics.countOfMeshChange,
+			opaqueStatistics.countOfMaterialChange,
+			opaqueStatistics.countOfDraw);
+	}
+
+	// н, ̴, ؽó, ޽, Ƽ   ׸  ϰ,      ʴ ˻մϴ.
+	{
+		RandomStream random(option.seed);
+		RenderQueue renderQueue;
+		RecordingRenderBackend backend;
+
+		StateChangeCount totalUnsorted;
+		StateChangeCount totalSorted;
+
+		for (uint32_t round = 0; round < option.rounds; ++round)
+		{
+			std::vector<DrawPacket> packets(static_cast<std::size_t>(random.NextInt(0, 2000)));
+			for (std::size_t index = 0; index < packets.size(); ++index)
+			{
+				DrawPacket& packet = packets[index];
+				packet.pass = (random.NextInt(0, 1) == 0) ? ERenderPass::Shadow : ERenderPass::Opaque;
+				packet.shader = shaders[random.NextInt(0, 3)];
+				packet.mesh = meshes[random.NextInt(0, 7)].get();
+				packet.material = (random.NextInt(0, 7) == 0) ? nullptr : materials[random.NextInt(0, 7)].get();
+				packet.textureID = static_cast<uint32_t>(random.NextInt(0, 3));
+				packet.world = MakeTaggedWorld(static_cast<uint32_t>(index));
+			}
+
+			renderQueue.Clear();
+			for (const DrawPacket& packet : packets)
+			{
+				renderQueue.Add(packet);
+			}
+
+			check("random stable sort", IsStableSorted(renderQueue));
+
+			const ERenderPass passes[] = { ERenderPass::Shadow, ERenderPass::Opaque };
+			for (const ERenderPass& pass : passes)
+			{
+				backend.Clear();
+				RenderQueue::Statistics statistics = renderQueue.Submit(backend, pass);
+
+				check("random command stream", IsValidCommandStream(packets, pass, backend.GetCommands()));
+				check("random statistics", IsSameStatistics(statistics, backend));
+
+				//  Ű  ׸  ϹǷ,  ´  Ű ո ƾ   ٲϴ.
+				std::set<const Shader*> shaderGroups;
+				std::set<std::pair<const Shader*, uint32_t>> textureGroups;
+				std::set<std::tuple<const Shader*, uint32_t, const StaticMesh*>> meshGroups;
+				std::set<std::tuple<const Shader*, uint32_t, const StaticMesh*, const Material*>> materialGroups;
+				for (const DrawPacket& packet : packets)
+				{
+					if (packet.pass != pass)
+					{
+						continue;
+					}
+
+					shaderGroups.insert(packet.shader);
+					if (packet.textureID != 0)
+					{
+						textureGroups.insert({ packet.shader, packet.textureID });
+					}
+					meshGroups.insert({ packet.shader, packet.textureID, packet.mesh });
+					if (packet.material != nullptr)
+					{
+						materialGroups.insert({ packet.shader, packet.textureID, packet.mesh, packet.material });
+					}
+				}
+
+				check("random shader change", statistics.countOfShaderChange == shaderGroups.size());
+				check("random texture change", statistics.countOfTextureChange <= textureGroups.size());
+				check("random mesh change", statistics.countOfMeshChange <= meshGroups.size());
+				check("random material change", statistics.countOfMaterialChange <= materialGroups.size());
+
+				StateChangeCount unsorted = CountUnsortedStateChange(packets, pass);
+
+				totalUnsorted.countOfShaderChange += unsorted.countOfShaderChange;
+				totalUnsorted.countOfTextureChange += unsorted.countOfTextureChange;
+				totalUnsorted.countOfMeshChange += unsorted.countOfMeshChange;
+				totalUnsorted.countOfMaterialChange += unsorted.countOfMaterialChange;
+				totalSorted.countOfShaderChange += statistics.countOfShaderChange;
+				totalSorted.countOfTextureChange += statistics.countOfTextureChange;
+				totalSorted.countOfMeshChange += statistics.countOfMeshChange;
+				totalSorted.countOfMaterialChange += statistics.countOfMaterialChange;
+			}
+		}
+
+		std::printf("  random %u rounds : shader %u -> %u, texture %u -> %u, mesh %u -> %u, material %u -> %u\n",
+			option.rounds,
+			totalUnsorted.countOfShaderChange, totalSorted.countOfShaderChange,
+			totalUnsorted.countOfTextureChange, totalSorted.countOfTextureChange,
+			totalUnsorted.countOfMeshChange, totalSorted.countOfMeshChange,
+			totalUnsorted.countOfMaterialChange, totalSorted.countOfMaterialChange);
+	}
+
+	//   ť ϸ Begin End ؾ մϴ.
+	{
+		RenderQueue renderQueue;
+		RecordingRenderBackend backend;
+		RenderQueue::Statistics statistics = renderQueue.Submit(backend, ERenderPass::Opaque);
+
+		check("empty queue", statistics.countOfDraw == 0 && backend.GetCommands().size() == 2);
+	}
+
+	//  İ std::stable_sort   մϴ.
+	{
+		RandomStream random(option.seed + 1);
+		std::vector<DrawPacket> packets(option.packets);
+		for (DrawPacket& packet : packets)
+		{
+			packet.pass = (random.NextInt(0, 1) == 0) ? ERenderPass::Shadow : ERenderPass::Opaque;
+			packet.shader = shaders[random.NextInt(0, 3)];
+			packet.mesh = meshes[random.NextInt(0, 7)].get();
+			packet.material = materials[random.NextInt(0, 7)].get();
+		}
+
+		RenderQueue renderQueue;
+		double radixMilliseconds = 0.0;
+		double stableMilliseconds = 0.0;
+		std::vector<uint32_t> indices(option.packets);
+
+		for (uint32_t round = 0; round < option.sorts; ++round)
+		{
+			renderQueue.Clear();
+			for (const DrawPacket& packet : packets)
+			{
+				renderQueue.Add(packet);
+			}
+
+			auto startTime = std::chrono::steady_clock::now();
+			const std::vector<uint32_t>& sortedIndices = renderQueue.GetSortedIndices();
+			auto endTime = std::chrono::steady_clock::now();
+			radixMilliseconds += std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+			for (uint32_t index = 0; index < indices.size(); ++index)
+			{
+				indices[index] = index;
+			}
+
+			startTime = std::chrono::steady_clock::now();
+			std::stable_sort(indices.begin(), indices.end(), [&](uint32_t lhs, uint32_t rhs) { return renderQueue.GetSortKey(lhs) < renderQueue.GetSortKey(rhs); });
+			endTime = std::chrono::steady_clock::now();
+			stableMilliseconds += std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+			check("sort same order", sortedIndices == indices);
+		}
+
+		std::printf("  sort %u packets : radix %7.3f ms, std::stable_sort %7.3f ms\n",
+			option.packets,
+			radixMilliseconds / static_cast<double>(option.sorts),
+			stableMilliseconds / static_cast<double>(option.sorts));
+	}
+
+	for (std::unique_ptr<StaticMesh>& mesh : meshes)
+	{
+		mesh->Release();
+	}
+
+	for (std::unique_ptr<Material>& material : materials)
+	{
+		material->Release();
+	}
+
+	std::printf("  result : %s\n", (countOfMismatch == 0) ? "ok" : "mismatch");
+	return (countOfMismatch == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,251 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GlyphAtlas.h"
+#include "JobSystem.h"
+#include "ResourceManager.h"
+#include "StringUtils.h"
+#include "TTFont.h"
+
+#include "BenchUtils.h"
+
+
+/**
+ * @brief 񵿱 ε ۸ Ʋ Դϴ.
+ */
+struct AtlasOption
+{
+	float fontSize;          // Ʈ ũԴϴ.
+	GlyphAtlas::EType type;  // ۸ ؽó Ʋ Ʈ Դϴ.
+};
+
+
+/**
+ * @brief   εϴ Ʈ Ʋ Դϴ.
+ *
+ * @note    ŷϴ Ʈ  ڵ Ʈ   ũ ŷմϴ.
+ */
+static const AtlasOption ATLAS_OPTIONS[] =
+{
+	{ 64.0f, GlyphAtlas::EType::SignedDistanceField },
+	{ 32.0f, GlyphAtlas::EType::SignedDistanceField },
+	{ 128.0f, GlyphAtlas::EType::Bitmap },
+	{ 96.0f, GlyphAtlas::EType::Bitmap },
+	{ 64.0f, GlyphAtlas::EType::Bitmap },
+	{ 48.0f, GlyphAtlas::EType::Bitmap },
+	{ 32.0f, GlyphAtlas::EType::Bitmap },
+	{ 24.0f, GlyphAtlas::EType::Bitmap },
+};
+
+
+/**
+ * @brief ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+ */
+static const int32_t BEGIN_CODE_POINT = 32;
+
+
+/**
+ * @brief ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+ */
+static const int32_t END_CODE_POINT = 127;
+
+
+/**
+ * @brief   ε  Դϴ.
+ */
+struct LoadResult
+{
+	double wallSeconds = 0.0;                            // ù   ҽ غ  ɸ ðԴϴ.
+	std::vector<std::vector<uint8_t>> atlases;           //  忡  ۸ ؽó Ʋ󽺸 ȭ Դϴ.
+	std::vector<ResourceManager::LoadRecord> records;    // ҽ ε ɸ ð Դϴ.
+	int32_t countOfMismatch = 0;                         // ڵ ҽ °   ȽԴϴ.
+};
+
+
+/**
+ * @brief  ý ۾   ٲ㼭 Ʈ Ʋ󽺸 񵿱 εմϴ.
+ *
+ * @param fontBuffer Ʈ Ÿ Ʈ ҽ Դϴ.
+ * @param countOfWorker  带  ۾  Դϴ. 0̶  ۾  忡 ʷ մϴ.
+ *
+ * @return ε   ȯմϴ.
+ */
+LoadResult RunLoad(const std::vector<uint8_t>& fontBuffer, uint32_t countOfWorker)
+{
+	static const std::size_t COUNT_OF_ATLAS = sizeof(ATLAS_OPTIONS) / sizeof(ATLAS_OPTIONS[0]);
+
+	LoadResult result;
+	result.atlases.resize(COUNT_OF_ATLAS);
+
+	JobSystem::Get().SetCountOfWorker(countOfWorker);
+	JobSystem::Get().Startup();
+	ResourceManager::Get().Startup();
+
+	auto startTime = std::chrono::steady_clock::now();
+
+	std::vector<ResourceManager::LoadHandle<TTFont>> handles;
+	for (std::size_t index = 0; index < COUNT_OF_ATLAS; ++index)
+	{
+		const AtlasOption& option = ATLAS_OPTIONS[index];
+		std::string signature = StringUtils::PrintF("Font%g%s", static_cast<double>(option.fontSize), (option.type == GlyphAtlas::EType::SignedDistanceField) ? "SDF" : "");
+
+		// ۾ 忡 ŷϰ,  忡 ؽó ø  Ʋ󽺸 ȭؼ մϴ.
+		std::vector<uint8_t>* atlasPtr = &result.atlases[index];
+		handles.push_back(ResourceManager::Get().LoadAsync<TTFont>(signature,
+			[&fontBuffer, option](TTFont*)
+			{
+				GlyphAtlas glyphAtlas;
+				if (option.type == GlyphAtlas::EType::SignedDistanceField)
+				{
+					GlyphAtlas::PackSignedDistanceField(fontBuffer, BEGIN_CODE_POINT, END_CODE_POINT, option.fontSize, TTFont::GetSignedDistanceFieldRange(option.fontSize), glyphAtlas);
+				}
+				else
+				{
+					GlyphAtlas::Pack(fontBuffer, BEGIN_CODE_POINT, END_CODE_POINT, option.fontSize, glyphAtlas);
+				}
+
+				return glyphAtlas;
+			},
+			[atlasPtr](TTFont* font, const GlyphAtlas& glyphAtlas)
+			{
+				font->Initialize(glyphAtlas);
+				*atlasPtr = glyphAtlas.Serialize();
+			}
+		));
+	}
+
+	// Ʋ󽺸 ϴ Ʈ Ʋ󽺰 غ ڿ  忡 ٷ ʱȭմϴ.
+	TTFont* atlasFont = handles.front().Wait();
+	TTFont* viewFont = ResourceManager::Get().CreateResource<TTFont>("Font32View");
+	viewFont->Initialize(atlasFont, 32.0f);
+
+	if (viewFont->GetScale() != 0.5f || viewFont->GetGlyphAtlasSize() != atlasFont->GetGlyphAtlasSize())
+	{
+		result.countOfMismatch++;
+	}
+
+	// ȯ  CPU ۾ ̹  ҽ ε  ť մϴ.
+	TTFont* emptyFont = ResourceManager::Get().CreateResource<TTFont>("EmptyFont");
+	int32_t countOfEmptyLoad = 0;
+	ResourceManager::LoadHandle<TTFont> emptyHandle = ResourceManager::Get().LoadAsync("EmptyFont", emptyFont,
+		[&countOfEmptyLoad](TTFont*) { countOfEmptyLoad++; },
+		[&countOfEmptyLoad, atlasFont](TTFont* font)
+		{
+			font->Initialize(atlasFont, 16.0f);
+			countOfEmptyLoad++;
+		}
+	);
+
+	ResourceManager::Get().WaitAsyncLoads();
+	result.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+	for (const ResourceManager::LoadHandle<TTFont>& handle : handles)
+	{
+		if (!handle.IsReady() || !handle.Get()->IsInitialized())
+		{
+			result.countOfMismatch++;
+		}
+	}
+
+	if (!emptyHandle.IsReady() || emptyHandle.Get() != emptyFont || countOfEmptyLoad != 2)
+	{
+		result.countOfMismatch++;
+	}
+
+	if (ResourceManager::Get().GetResource<TTFont>(std::string("Font64SDF")) != atlasFont)
+	{
+		result.countOfMismatch++;
+	}
+
+	result.records = ResourceManager::Get().GetLoadRecords();
+	if (result.records.size() != COUNT_OF_ATLAS + 1)
+	{
+		result.countOfMismatch++;
+	}
+
+	for (const ResourceManager::LoadRecord& record : result.records)
+	{
+		if (record.readySeconds > result.wallSeconds || record.loadSeconds < 0.0 || record.finalizeSeconds < 0.0)
+		{
+			result.countOfMismatch++;
+		}
+	}
+
+	ResourceManager::Get().Shutdown();
+	JobSystem::Get().Shutdown();
+
+	return result;
+}
+
+
+int main(int argc, char** argv)
+{
+	std::filesystem::path fontPath = "Dodge3D/Resource/Font/SeoulNamsanEB.ttf";
+	uint32_t countOfWorker = std::max<uint32_t>(std::thread::hardware_concurrency(), 2) - 1;
+
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument.rfind("font=", 0) == 0)
+		{
+			fontPath = argument.substr(5);
+		}
+		else if (argument.rfind("workers=", 0) == 0)
+		{
+			countOfWorker = static_cast<uint32_t>(std::stoul(argument.substr(8)));
+		}
+		else
+		{
+			std::fprintf(stderr, "usage : Dodge3DResourceLoadBench [font=Dodge3D/Resource/Font/SeoulNamsanEB.ttf] [workers=<hardware threads - 1>]\n");
+			return 1;
+		}
+	}
+
+	std::printf("Dodge3DResourceLoadBench\n");
+
+	std::vector<uint8_t> fontBuffer = BenchUtils::ReadBufferFromFile(fontPath);
+	if (fontBuffer.empty())
+	{
+		std::fprintf(stderr, "failed to read true type font file %s...\n", fontPath.string().c_str());
+		return 1;
+	}
+
+	std::printf("  font %s (%zu bytes), %u hardware threads\n", fontPath.string().c_str(), fontBuffer.size(), std::thread::hardware_concurrency());
+
+	int32_t countOfMismatch = 0;
+	auto check = [&](const char* name, bool bIsMatch)
+	{
+		if (!bIsMatch)
+		{
+			std::printf("  mismatch %s\n", name);
+			countOfMismatch++;
+		}
+	};
+
+	LoadResult serial = RunLoad(fontBuffer, 0);
+	LoadResult parallel = RunLoad(fontBuffer, countOfWorker);
+
+	check("serial load", serial.countOfMismatch == 0);
+	check("parallel load", parallel.countOfMismatch == 0);
+	check("same glyph atlas", serial.atlases == parallel.atlases);
+
+	std::printf("  %-12s %10s %10s %10s\n", "resource", "load ms", "final ms", "ready ms");
+	double totalSeconds = 0.0;
+	for (const ResourceManager::LoadRecord& record : parallel.records)
+	{
+		std::printf("  %-12s %10.3f %10.3f %10.3f\n", record.name.c_str(), record.loadSeconds * 1000.0, record.finalizeSeconds * 1000.0, record.readySeconds * 1000.0);
+		totalSeconds += record.loadSeconds + record.finalizeSeconds;
+	}
+
+	std::printf("  serial   (0 workers) : %9.3f ms\n", serial.wallSeconds * 1000.0);
+	std::printf("  parallel (%u workers) : %9.3f ms (sum of resource time %9.3f ms, %.2fx)\n", countOfWorker, parallel.wallSeconds * 1000.0, totalSeconds * 1000.0, serial.wallSeconds / parallel.wallSeconds);
+
+	std::printf("  result : %s\n", (countOfMismatch == 0) ? "ok" : "mismatch");
+	return (countOfMismatch == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,364 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <stb_truetype.h>
+
+#include "GlyphAtlas.h"
+#include "TTFont.h"
+
+#include "BenchUtils.h"
+
+
+/**
+ * @brief ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+ */
+static const int32_t BEGIN_CODE_POINT = 32;
+
+
+/**
+ * @brief ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+ */
+static const int32_t END_CODE_POINT = 127;
+
+
+/**
+ * @brief ȣ ִ Ÿ Ʋ󽺸  Ʈ ũԴϴ.
+ *
+ * @note   ũ  Ʋ   32, 64, 128 ũ Ʈ  ׸ϴ.
+ */
+static const float SIGNED_DISTANCE_FIELD_FONT_SIZE = 64.0f;
+
+
+/**
+ * @brief ܰ  Ÿ Դϴ.
+ */
+static const float ON_EDGE_VALUE = 128.0f;
+
+
+/**
+ * @brief      ϳ  Դϴ.
+ */
+static const int32_t CURVE_SUBDIVISION = 64;
+
+
+/**
+ * @brief  Ÿ  Ʋ ؼ   Դϴ.
+ *
+ * @note      ڸ  ĵ 1  ʾƾ մϴ.
+ */
+static const int32_t MAX_TEXEL_ERROR = 1;
+
+
+/**
+ * @brief   Ѵ ؼ ִ Դϴ.
+ *
+ * @note stb_truetype   2  Ÿ Ǯ  е Ƿ,  ֺ Ϻ ؼ   ѽϴ.
+ */
+static const double MAX_OUTLIER_RATIO = 0.001;
+
+
+/**
+ * @brief   Ѵ ؼ ۸ ؽó Ʋ ȼ  ִ Ÿ Դϴ.
+ */
+static const double MAX_OUTLIER_DISTANCE = 1.0;
+
+
+/**
+ * @brief ȼ  ۸ ܰ Դϴ.
+ */
+struct Segment
+{
+	float x0;
+	float y0;
+	float x1;
+	float y1;
+};
+
+
+/**
+ * @brief ۸ ܰ ȼ    ϴ.
+ *
+ * @note Ʈ Ʒ ϹǷ y ǥ ϴ.
+ *
+ * @param info Ʈ Դϴ.
+ * @param codePoint ܰ  ڵ ƮԴϴ.
+ * @param scale Ʈ  ȼ  ٲٴ Դϴ.
+ *
+ * @return ȼ    ȯմϴ.
+ */
+std::vector<Segment> FlattenGlyphShape(const stbtt_fontinfo& info, int32_t codePoint, float scale)
+{
+	stbtt_vertex* vertices = nullptr;
+	int32_t countOfVertex = stbtt_GetCodepointShape(&info, codePoint, &vertices);
+
+	std::vector<Segment> segments;
+	float x = 0.0f;
+	float y = 0.0f;
+
+	for (int32_t index = 0; index < countOfVertex; ++index)
+	{
+		const stbtt_vertex& vertex = vertices[index];
+		float vx = static_cast<float>(vertex.x) * scale;
+		float vy = -static_cast<float>(vertex.y) * scale;
+
+		if (vertex.type == STBTT_vline)
+		{
+			segments.push_back(Segment{ x, y, vx, vy });
+		}
+		else if (vertex.type == STBTT_vcurve || vertex.type == STBTT_vcubic)
+		{
+			float cx0 = static_cast<float>(vertex.cx) * scale;
+			float cy0 = -static_cast<float>(vertex.cy) * scale;
+			float cx1 = static_cast<float>(vertex.cx1) * scale;
+			float cy1 = -static_cast<float>(vertex.cy1) * scale;
+
+			float px = x;
+			float py = y;
+			for (int32_t step = 1; step <= CURVE_SUBDIVISION; ++step)
+			{
+				float t = static_cast<float>(step) / static_cast<float>(CURVE_SUBDIVISION);
+				float s = 1.0f - t;
+
+				float nx = 0.0f;
+				float ny = 0.0f;
+				if (vertex.type == STBTT_vcurve)
+				{
+					nx = s * s * x + 2.0f * s * t * cx0 + t * t * vx;
+					ny = s * s * y + 2.0f * s * t * cy0 + t * t * vy;
+				}
+				else
+				{
+					nx = s * s * s * x + 3.0f * s * s * t * cx0 + 3.0f * s * t * t * cx1 + t * t * t * vx;
+					ny = s * s * s * y + 3.0f * s * s * t * cy0 + 3.0f * s * t * t * cy1 + t * t * t * vy;
+				}
+
+				segments.push_back(Segment{ px, py, nx, ny });
+				px = nx;
+				py = ny;
+			}
+		}
+
+		x = vx;
+		y = vy;
+	}
+
+	stbtt_FreeShape(&info, vertices);
+	return segments;
+}
+
+
+/**
+ * @brief  ܰ ȣ ִ Ÿ մϴ.
+ *
+ * @param segments ȼ  ܰ  Դϴ.
+ * @param x  x ǥԴϴ.
+ * @param y  y ǥԴϴ.
+ *
+ * @return 0 ƴ   Ģ ̸ , ٱ̸  ȼ  Ÿ ȯմϴ.
+ */
+double ComputeSignedDistance(const std::vector<Segment>& segments, double x, double y)
+{
+	double minDistance = 1.0e30;
+	int32_t winding = 0;
+
+	for (const Segment& segment : segments)
+	{
+		double dx = segment.x1 - segment.x0;
+		double dy = segment.y1 - segment.y0;
+		double lengthSquared = dx * dx + dy * dy;
+
+		double t = (lengthSquared > 0.0) ? ((x - segment.x0) * dx + (y - segment.y0) * dy) / lengthSquared : 0.0;
+		t = std::clamp(t, 0.0, 1.0);
+
+		double ex = segment.x0 + t * dx - x;
+		double ey = segment.y0 + t * dy - y;
+		minDistance = std::min(minDistance, std::sqrt(ex * ex + ey * ey));
+
+		double cross = dx * (y - segment.y0) - dy * (x - segment.x0);
+		if (segment.y0 <= y && y < segment.y1 && cross > 0.0)
+		{
+			winding++;
+		}
+		else if (segment.y1 <= y && y < segment.y0 && cross < 0.0)
+		{
+			winding--;
+		}
+	}
+
+	return (winding != 0) ? minDistance : -minDistance;
+}
+
+
+int main(int argc, char** argv)
+{
+	std::filesystem::path fontPath = "Dodge3D/Resource/Font/SeoulNamsanEB.ttf";
+
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument.rfind("font=", 0) == 0)
+		{
+			fontPath = argument.substr(5);
+		}
+		else
+		{
+			std::fprintf(stderr, "usage : Dodge3DSignedDistanceFieldBench [font=Dodge3D/Resource/Font/SeoulNamsanEB.ttf]\n");
+			return 1;
+		}
+	}
+
+	std::printf("Dodge3DSignedDistanceFieldBench\n");
+
+	int32_t countOfMismatch = 0;
+	auto check = [&](const char* name, bool bIsMatch)
+	{
+		if (!bIsMatch)
+		{
+			std::printf("  mismatch %s\n", name);
+			countOfMismatch++;
+		}
+	};
+
+	std::vector<uint8_t> fontBuffer = BenchUtils::ReadBufferFromFile(fontPath);
+	if (fontBuffer.empty())
+	{
+		std::fprintf(stderr, "failed to read true type font file %s...\n", fontPath.string().c_str());
+		return 1;
+	}
+
+	std::printf("  font %s (%zu bytes)\n", fontPath.string().c_str(), fontBuffer.size());
+
+	int32_t distanceRange = TTFont::GetSignedDistanceFieldRange(SIGNED_DISTANCE_FIELD_FONT_SIZE);
+
+	auto startTime = std::chrono::steady_clock::now();
+	GlyphAtlas signedDistanceField;
+	GlyphAtlas::PackSignedDistanceField(fontBuffer, BEGIN_CODE_POINT, END_CODE_POINT, SIGNED_DISTANCE_FIELD_FONT_SIZE, distanceRange, signedDistanceField);
+	auto endTime = std::chrono::steady_clock::now();
+	double signedDistanceFieldMilliseconds = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+	// Ʋ ؼ  ۸ ܰ    Ÿ մϴ.
+	stbtt_fontinfo info;
+	stbtt_InitFont(&info, fontBuffer.data(), stbtt_GetFontOffsetForIndex(fontBuffer.data(), 0));
+
+	float scale = stbtt_ScaleForPixelHeight(&info, SIGNED_DISTANCE_FIELD_FONT_SIZE);
+	double pixelDistanceScale = ON_EDGE_VALUE / static_cast<double>(distanceRange);
+
+	int64_t countOfTexel = 0;
+	int64_t countOfOverError = 0;
+	int32_t maxError = 0;
+	double sumOfError = 0.0;
+	for (const Glyph& glyph : signedDistanceField.glyphs)
+	{
+		int32_t width = glyph.position1.x - glyph.position0.x;
+		int32_t height = glyph.position1.y - glyph.position0.y;
+		if (width == 0 || height == 0)
+		{
+			continue;
+		}
+
+		std::vector<Segment> segments = FlattenGlyphShape(info, glyph.codePoint, scale);
+		for (int32_t y = 0; y < height; ++y)
+		{
+			for (int32_t x = 0; x < width; ++x)
+			{
+				double px = static_cast<double>(x) + glyph.xoffset + 0.5;
+				double py = static_cast<double>(y) + glyph.yoffset + 0.5;
+
+				double value = ON_EDGE_VALUE + pixelDistanceScale * ComputeSignedDistance(segments, px, py);
+				int32_t expected = static_cast<int32_t>(std::clamp(value, 0.0, 255.0));
+
+				int32_t texel = signedDistanceField.bitmap[(glyph.position0.y + y) * signedDistanceField.glyphAtlasSize + glyph.position0.x + x];
+				int32_t error = std::abs(texel - expected);
+
+				maxError = std::max(maxError, error);
+				sumOfError += static_cast<double>(error);
+				countOfOverError += (error > MAX_TEXEL_ERROR) ? 1 : 0;
+				countOfTexel++;
+			}
+		}
+	}
+
+	std::printf("  reference distance : %lld texels, max error %d, mean error %.4f, over tolerance %lld\n",
+		static_cast<long long>(countOfTexel), maxError, sumOfError / static_cast<double>(std::max<int64_t>(countOfTexel, 1)), static_cast<long long>(countOfOverError));
+
+	check("reference texels", countOfTexel > 0);
+	check("reference distance ratio", static_cast<double>(countOfOverError) <= MAX_OUTLIER_RATIO * static_cast<double>(countOfTexel));
+	check("reference distance max", static_cast<double>(maxError) <= MAX_OUTLIER_DISTANCE * pixelDistanceScale);
+
+	// ܰ  128, Ÿ ŭ ٱ  𼭸 0̾ մϴ.
+	const Glyph& glyphO = signedDistanceField.glyphs['O' - BEGIN_CODE_POINT];
+	check("padding corner", signedDistanceField.bitmap[glyphO.position0.y * signedDistanceField.glyphAtlasSize + glyphO.position0.x] == 0);
+
+	GlyphAtlas deserialized;
+	bool bIsDeserialized = GlyphAtlas::Deserialize(signedDistanceField.Serialize(), signedDistanceField.sourceHash, deserialized);
+	check("serialize round trip", bIsDeserialized
+		&& deserialized.type == GlyphAtlas::EType::SignedDistanceField
+		&& deserialized.distanceRange == distanceRange
+		&& deserialized.glyphAtlasSize == signedDistanceField.glyphAtlasSize
+		&& BenchUtils::IsSameGlyphs(deserialized.glyphs, signedDistanceField.glyphs)
+		&& deserialized.bitmap == signedDistanceField.bitmap);
+	check("reject bitmap hash", !GlyphAtlas::Deserialize(signedDistanceField.Serialize(),
+		GlyphAtlas::ComputeSourceHash(fontBuffer, BEGIN_CODE_POINT, END_CODE_POINT, SIGNED_DISTANCE_FIELD_FONT_SIZE, GlyphAtlas::EType::Bitmap, 0), deserialized));
+
+	TTFont atlasFont;
+	atlasFont.Initialize(signedDistanceField);
+
+	//    εϴ Ʈ ũ ϴ.
+	const float fontSizes[] = { 32.0f, 64.0f, 128.0f };
+	const wchar_t* text = L"Dodge3D Rank 2024-01-01 12:34:56";
+
+	double bitmapMilliseconds = 0.0;
+	std::size_t bitmapBytes = 0;
+	for (const float& fontSize : fontSizes)
+	{
+		startTime = std::chrono::steady_clock::now();
+		GlyphAtlas bitmap;
+		GlyphAtlas::Pack(fontBuffer, BEGIN_CODE_POINT, END_CODE_POINT, fontSize, bitmap);
+		endTime = std::chrono::steady_clock::now();
+		bitmapMilliseconds += std::chrono::duration<double, std::milli>(endTime - startTime).count();
+		bitmapBytes += bitmap.bitmap.size();
+
+		TTFont bitmapFont;
+		bitmapFont.Initialize(bitmap);
+
+		TTFont view;
+		view.Initialize(&atlasFont, fontSize);
+
+		float bitmapWidth = 0.0f;
+		float bitmapHeight = 0.0f;
+		float viewWidth = 0.0f;
+		float viewHeight = 0.0f;
+		bitmapFont.MeasureText(text, bitmapWidth, bitmapHeight);
+		view.MeasureText(text, viewWidth, viewHeight);
+
+		std::printf("  size %5.1f : bitmap atlas %4d text %6.1f x %5.1f, signed distance field view scale %.3f text %6.1f x %5.1f\n",
+			fontSize, bitmap.glyphAtlasSize, bitmapWidth, bitmapHeight, view.GetScale(), viewWidth, viewHeight);
+
+		// ۸  ڸǷ  ŭ  մϴ.
+		float tolerance = static_cast<float>(std::wcslen(text));
+		check("view scale", view.GetScale() == fontSize / SIGNED_DISTANCE_FIELD_FONT_SIZE);
+		check("view shares atlas", view.GetGlyphAtlasSize() == atlasFont.GetGlyphAtlasSize() && view.GetType() == GlyphAtlas::EType::SignedDistanceField);
+		check("view width", std::fabs(viewWidth - bitmapWidth) <= tolerance);
+		check("view height", std::fabs(viewHeight - bitmapHeight) <= 2.0f * view.GetScale() + 2.0f);
+		check("view ascent", std::fabs(view.GetAscent() - bitmapFont.GetAscent()) <= 1.0f);
+
+		view.Release();
+		bitmapFont.Release();
+	}
+
+	atlasFont.Release();
+
+	std::printf("  %-22s : %8.3f ms, %8zu bytes\n", "bitmap atlas x3", bitmapMilliseconds, bitmapBytes);
+	std::printf("  %-22s : %8.3f ms, %8zu bytes (atlas %d, range %d)\n", "signed distance field", signedDistanceFieldMilliseconds, signedDistanceField.bitmap.size(), signedDistanceField.glyphAtlasSize, distanceRange);
+
+	check("atlas memory", signedDistanceField.bitmap.size() < bitmapBytes);
+
+	std::printf("  result : %s\n", (countOfMismatch == 0) ? "ok" : "mismatch");
+	return (countOfMismatch == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,760 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Box3D.h"
+#include "GeometryGenerator.h"
+#include "InstanceBuffer.h"
+#include "JobSystem.h"
+#include "Material.h"
+#include "MathUtils.h"
+#include "MeshBuffer.h"
+#include "ObjectManager.h"
+#include "RandomStream.h"
+#include "RangeAllocator.h"
+#include "RecordingRenderBackend.h"
+#include "RenderQueue.h"
+#include "ResourceManager.h"
+#include "StaticBatch.h"
+#include "StaticMesh.h"
+#include "Transform.h"
+
+#include "BulletField.h"
+#include "Floor.h"
+#include "PlaySimulation.h"
+
+
+/**
+ * @brief ġũ  ɼԴϴ.
+ */
+struct BenchOption
+{
+	uint32_t transforms = 256;   //   ȯ ˻    Դϴ.
+	uint32_t operations = 20000; //  Ҵڸ ˻  Ҵ,  ȽԴϴ.
+};
+
+
+/**
+ * @brief 帮 ȯ濡 ̴   ڵԴϴ.
+ *
+ * @note ̴ OpenGL    ϴ.  ť ϴ 鿣 ̴  Ƿ  ٸ ּҸ  ˴ϴ.
+ */
+struct ShaderTag
+{
+	uint64_t tag = 0;
+};
+
+
+/**
+ * @brief  ڷκ ġũ  ɼ нϴ.
+ *
+ * @param argc   Դϴ.
+ * @param argv   Դϴ.
+ * @param outOption   ɼԴϴ.
+ *
+ * @return  ڸ оٸ true, ׷  false ȯմϴ.
+ */
+bool ParseOption(int32_t argc, char** argv, BenchOption& outOption)
+{
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument.rfind("transforms=", 0) == 0)
+		{
+			outOption.transforms = static_cast<uint32_t>(std::stoul(argument.substr(11)));
+		}
+		else if (argument.rfind("operations=", 0) == 0)
+		{
+			outOption.operations = static_cast<uint32_t>(std::stoul(argument.substr(11)));
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return outOption.transforms > 0 && outOption.operations > 0;
+}
+
+
+/**
+ * @brief  Ͱ   ȿ  Ȯմϴ.
+ *
+ * @param lhs  Դϴ.
+ * @param rhs  ٸ Դϴ.
+ * @param epsilon  к Դϴ.
+ *
+ * @return   ̰  ϶ true, ׷  false ȯմϴ.
+ */
+bool IsNear(const Vector3f& lhs, const Vector3f& rhs, float epsilon)
+{
+	return std::fabs(lhs.x - rhs.x) <= epsilon && std::fabs(lhs.y - rhs.y) <= epsilon && std::fabs(lhs.z - rhs.z) <= epsilon;
+}
+
+
+/**
+ * @brief  Ͱ Ʈ   Ȯմϴ.
+ *
+ * @param lhs  Դϴ.
+ * @param rhs  ٸ Դϴ.
+ *
+ * @return   Ʈ  ٸ true, ׷  false ȯմϴ.
+ */
+bool IsSame(const Vector3f& lhs, const Vector3f& rhs)
+{
+	return lhs.x == rhs.x && lhs.y == rhs.y && lhs.z == rhs.z;
+}
+
+
+/**
+ * @brief   3x3 κ  е ؼ  ͸ ȯմϴ.
+ *
+ * @param normal ȯ    Դϴ.
+ * @param world ȯ   Դϴ.
+ *
+ * @return ȭ    ͸ ȯմϴ.
+ *
+ * @note   Ծ̹Ƿ n' = n * (M^-1)^T ̸,   n'[j] = sum(n[i] * inverse[j][i]) Դϴ.
+ */
+Vector3f ReferenceTransformNormal(const Vector3f& normal, const Matrix4x4f& world)
+{
+	double m[3][3];
+	for (int32_t row = 0; row < 3; ++row)
+	{
+		for (int32_t col = 0; col < 3; ++col)
+		{
+			m[row][col] = static_cast<double>(world.m[row][col]);
+		}
+	}
+
+	double determinant =
+		m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+		m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+		m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+
+	double inverse[3][3];
+	inverse[0][0] = (m[1][1] * m[2][2] - m[1][2] * m[2][1]) / determinant;
+	inverse[0][1] = (m[0][2] * m[2][1] - m[0][1] * m[2][2]) / determinant;
+	inverse[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) / determinant;
+	inverse[1][0] = (m[1][2] * m[2][0] - m[1][0] * m[2][2]) / determinant;
+	inverse[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) / determinant;
+	inverse[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) / determinant;
+	inverse[2][0] = (m[1][0] * m[2][1] - m[1][1] * m[2][0]) / determinant;
+	inverse[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) / determinant;
+	inverse[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) / determinant;
+
+	const double n[3] = { static_cast<double>(normal.x), static_cast<double>(normal.y), static_cast<double>(normal.z) };
+
+	double transformed[3];
+	for (int32_t col = 0; col < 3; ++col)
+	{
+		transformed[col] = n[0] * inverse[col][0] + n[1] * inverse[col][1] + n[2] * inverse[col][2];
+	}
+
+	double length = std::sqrt(transformed[0] * transformed[0] + transformed[1] * transformed[1] + transformed[2] * transformed[2]);
+	return Vector3f(static_cast<float>(transformed[0] / length), static_cast<float>(transformed[1] / length), static_cast<float>(transformed[2] / length));
+}
+
+
+/**
+ * @brief ȯ ޽ ﰢ  Ͱ 鿡 ̰ ٱ  ϴ ˻մϴ.
+ *
+ * @param vertices    Դϴ.
+ * @param indices ޽ ε Դϴ.
+ * @param world ȯ   Դϴ.
+ *
+ * @return  ﰢ ȯ  Ͱ 鿡 ̰     Ѵٸ true, ׷  false ȯմϴ.
+ *
+ * @note Ľ    ﰢ   Ƿ,  ⵵ Բ  մϴ.
+ */
+bool IsPerpendicularToFace(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, const Matrix4x4f& world)
+{
+	Vector3f row0(world.m[0][0], world.m[0][1], world.m[0][2]);
+	Vector3f row1(world.m[1][0], world.m[1][1], world.m[1][2]);
+	Vector3f row2(world.m[2][0], world.m[2][1], world.m[2][2]);
+	float windingSign = MathUtils::DotProduct(row0, MathUtils::CrossProduct(row1, row2)) < 0.0f ? -1.0f : 1.0f;
+
+	for (std::size_t index = 0; index + 2 < indices.size(); index += 3)
+	{
+		const Vertex& v0 = vertices[indices[index + 0]];
+		const Vertex& v1 = vertices[indices[index + 1]];
+		const Vertex& v2 = vertices[indices[index + 2]];
+
+		float localSign = MathUtils::DotProduct(v0.normal, MathUtils::CrossProduct(v1.position - v0.position, v2.position - v0.position)) < 0.0f ? -1.0f : 1.0f;
+
+		Vector3f p0 = StaticBatch::TransformPosition(v0.position, world);
+		Vector3f p1 = StaticBatch::TransformPosition(v1.position, world);
+		Vector3f p2 = StaticBatch::TransformPosition(v2.position, world);
+		Vector3f faceNormal = MathUtils::Normalize(MathUtils::CrossProduct(p1 - p0, p2 - p0));
+
+		Vector3f normal = StaticBatch::TransformNormal(v0.normal, world);
+		if (std::fabs(MathUtils::DotProduct(normal, p1 - p0)) > 1e-3f || std::fabs(MathUtils::DotProduct(normal, p2 - p0)) > 1e-3f)
+		{
+			return false;
+		}
+
+		if (MathUtils::DotProduct(normal, faceNormal) * localSign * windingSign < 0.99f)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief  ġ  ޽ø   ȯϰ ε ٽ ߴ ˻մϴ.
+ *
+ * @param batch ˻ ġԴϴ.
+ * @param meshes ġ ߰   ޽ Դϴ.
+ * @param worlds  ޽ÿ     Դϴ.
+ *
+ * @return ġ  ε  ޽ø ʷ ȯؼ ̾  Ͱ ٸ true, ׷  false ȯմϴ.
+ */
+bool IsMergedBatch(const StaticBatch::Batch& batch, const std::vector<const StaticMesh*>& meshes, const std::vector<Matrix4x4f>& worlds)
+{
+	std::size_t baseVertex = 0;
+	std::size_t firstIndex = 0;
+
+	for (std::size_t mesh = 0; mesh < meshes.size(); ++mesh)
+	{
+		const std::vector<Vertex>& vertices = meshes[mesh]->GetVertices();
+		const std::vector<uint32_t>& indices = meshes[mesh]->GetIndices();
+
+		if (baseVertex + vertices.size() > batch.vertices.size() || firstIndex + indices.size() > batch.indices.size())
+		{
+			return false;
+		}
+
+		for (std::size_t index = 0; index < vertices.size(); ++index)
+		{
+			const Vertex& merged = batch.vertices[baseVertex + index];
+			if (!IsSame(merged.position, StaticBatch::TransformPosition(vertices[index].position, worlds[mesh]))
+				|| !IsSame(merged.normal, StaticBatch::TransformNormal(vertices[index].normal, worlds[mesh]))
+				|| merged.texture.x != vertices[index].texture.x || merged.texture.y != vertices[index].texture.y)
+			{
+				return false;
+			}
+		}
+
+		for (std::size_t index = 0; index < indices.size(); ++index)
+		{
+			if (batch.indices[firstIndex + index] != static_cast<uint32_t>(baseVertex) + indices[index])
+			{
+				return false;
+			}
+		}
+
+		baseVertex += vertices.size();
+		firstIndex += indices.size();
+	}
+
+	return baseVertex == batch.vertices.size() && firstIndex == batch.indices.size() && batch.countOfMesh == meshes.size();
+}
+
+
+/**
+ * @brief   Ϻ   ڿ  ˻մϴ.
+ *
+ * @param vertices ˻  Դϴ.
+ * @param begin ˻ ù °  ġԴϴ.
+ * @param count ˻  Դϴ.
+ * @param minPosition  ּ ġԴϴ.
+ * @param maxPosition  ִ ġԴϴ.
+ *
+ * @return  ּ, ִ ġ ڿ   ȿ ٸ true, ׷  false ȯմϴ.
+ */
+bool IsSameBound(const std::vector<Vertex>& vertices, std::size_t begin, std::size_t count, const Vector3f& minPosition, const Vector3f& maxPosition)
+{
+	Vector3f minVertex = vertices[begin].position;
+	Vector3f maxVertex = vertices[begin].position;
+	for (std::size_t index = begin; index < begin + count; ++index)
+	{
+		const Vector3f& position = vertices[index].position;
+		minVertex = Vector3f(std::fmin(minVertex.x, position.x), std::fmin(minVertex.y, position.y), std::fmin(minVertex.z, position.z));
+		maxVertex = Vector3f(std::fmax(maxVertex.x, position.x), std::fmax(maxVertex.y, position.y), std::fmax(maxVertex.z, position.z));
+	}
+
+	return IsNear(minVertex, minPosition, 1e-5f) && IsNear(maxVertex, maxPosition, 1e-5f);
+}
+
+
+/**
+ * @brief  Ҵڸ  å Ʈʰ  Ҵ,  մϴ.
+ *
+ * @param capacity ü  ũԴϴ.
+ * @param operations Ҵ,  ȽԴϴ.
+ * @param seed  õԴϴ.
+ *
+ * @return  Ҵ ġ ִ  , ũⰡ Ʈʰ ٸ true, ׷  false ȯմϴ.
+ *
+ * @note ִ  ٷ ġǷ, ù ° ´  Ʈʿ ũⰡ  ù °    ϴ.
+ */
+bool IsSameAsBitmap(uint32_t capacity, uint32_t operations, uint64_t seed)
+{
+	struct Range
+	{
+		uint32_t offset;
+		uint32_t size;
+	};
+
+	RangeAllocator allocator;
+	allocator.Reset(capacity);
+
+	std::vector<bool> bIsUsed(capacity, false);
+	std::vector<Range> allocations;
+	RandomStream random(seed);
+
+	for (uint32_t operation = 0; operation < operations; ++operation)
+	{
+		if (allocations.empty() || random.NextUInt64() % 5 < 3)
+		{
+			uint32_t size = 1 + static_cast<uint32_t>(random.NextUInt64() % 64);
+
+			uint32_t expectedOffset = capacity;
+			for (uint32_t offset = 0, run = 0; offset < capacity; ++offset)
+			{
+				run = bIsUsed[offset] ? 0 : run + 1;
+				if (run == size)
+				{
+					expectedOffset = offset + 1 - size;
+					break;
+				}
+			}
+
+			uint32_t offset = 0;
+			bool bIsAllocated = allocator.Allocate(size, offset);
+			if (bIsAllocated != (expectedOffset != capacity) || (bIsAllocated && offset != expectedOffset))
+			{
+				return false;
+			}
+
+			if (bIsAllocated)
+			{
+				std::fill(bIsUsed.begin() + offset, bIsUsed.begin() + offset + size, true);
+				allocations.push_back(Range{ offset, size });
+			}
+		}
+		else
+		{
+			std::size_t index = static_cast<std::size_t>(random.NextUInt64() % allocations.size());
+			Range range = allocations[index];
+			allocations[index] = allocations.back();
+			allocations.pop_back();
+
+			allocator.Free(range.offset, range.size);
+			std::fill(bIsUsed.begin() + range.offset, bIsUsed.begin() + range.offset + range.size, false);
+		}
+
+		uint32_t freeSize = 0;
+		uint32_t countOfFreeRange = 0;
+		for (uint32_t offset = 0; offset < capacity; ++offset)
+		{
+			if (!bIsUsed[offset])
+			{
+				freeSize++;
+				countOfFreeRange += (offset == 0 || bIsUsed[offset - 1]) ? 1 : 0;
+			}
+		}
+
+		if (allocator.GetFreeSize() != freeSize || allocator.GetCountOfFreeRange() != countOfFreeRange)
+		{
+			return false;
+		}
+	}
+
+	for (const auto& range : allocations)
+	{
+		allocator.Free(range.offset, range.size);
+	}
+
+	return allocator.GetFreeSize() == capacity && allocator.GetCountOfFreeRange() == 1;
+}
+
+
+int main(int argc, char** argv)
+{
+	BenchOption option;
+	if (!ParseOption(argc, argv, option))
+	{
+		std::fprintf(stderr, "usage : Dodge3DStaticBatchBench [transforms=256] [operations=20000]\n");
+		return 1;
+	}
+
+	JobSystem::Get().Startup();
+	ResourceManager::Get().Startup();
+	ObjectManager::Get().Startup();
+
+	std::printf("Dodge3DStaticBatchBench\n");
+
+	int32_t countOfMismatch = 0;
+	auto check = [&](const char* name, bool bIsMatch)
+	{
+		if (!bIsMatch)
+		{
+			std::printf("  mismatch %s\n", name);
+			countOfMismatch++;
+		}
+	};
+
+	// ̵, ȸ,  ,     ķ ġ   ȯ ˻մϴ.
+	std::vector<Vertex> cubeVertices;
+	std::vector<uint32_t> cubeIndices;
+	GeometryGenerator::CreateCube(Vector3f(1.0f, 2.0f, 3.0f), cubeVertices, cubeIndices);
+
+	RandomStream random(1);
+	bool bIsSamePosition = true;
+	bool bIsSameNormal = true;
+	bool bIsPerpendicular = true;
+	for (uint32_t transform = 0; transform < option.transforms; ++transform)
+	{
+		Vector3f location(random.NextFloat(-10.0f, 10.0f), random.NextFloat(-10.0f, 10.0f), random.NextFloat(-10.0f, 10.0f));
+		Vector3f rotate(random.NextFloat(-3.0f, 3.0f), random.NextFloat(-3.0f, 3.0f), random.NextFloat(-3.0f, 3.0f));
+		Vector3f scale(random.NextFloat(0.1f, 4.0f), random.NextFloat(0.1f, 4.0f), random.NextFloat(0.1f, 4.0f));
+		if (transform % 4 == 3)
+		{
+			scale.y = -scale.y;
+		}
+
+		Matrix4x4f world = Transform(location, rotate, scale).GetWorldMatrix();
+		for (const auto& vertex : cubeVertices)
+		{
+			const Vector3f& p = vertex.position;
+			Vector3f expected(
+				static_cast<float>(static_cast<double>(p.x) * world.m[0][0] + static_cast<double>(p.y) * world.m[1][0] + static_cast<double>(p.z) * world.m[2][0] + world.m[3][0]),
+				static_cast<float>(static_cast<double>(p.x) * world.m[0][1] + static_cast<double>(p.y) * world.m[1][1] + static_cast<double>(p.z) * world.m[2][1] + world.m[3][1]),
+				static_cast<float>(static_cast<double>(p.x) * world.m[0][2] + static_cast<double>(p.y) * world.m[1][2] + static_cast<double>(p.z) * world.m[2][2] + world.m[3][2])
+			);
+
+			bIsSamePosition = bIsSamePosition && IsNear(StaticBatch::TransformPosition(p, world), expected, 1e-4f);
+			bIsSameNormal = bIsSameNormal && IsNear(StaticBatch::TransformNormal(vertex.normal, world), ReferenceTransformNormal(vertex.normal, world), 1e-4f);
+		}
+
+		bIsPerpendicular = bIsPerpendicular && IsPerpendicularToFace(cubeVertices, cubeIndices, world);
+	}
+
+	check("transform position", bIsSamePosition);
+	check("transform normal as inverse transpose", bIsSameNormal);
+	check("transformed normal perpendicular to face", bIsPerpendicular);
+	check("degenerate normal is zero", IsSame(StaticBatch::TransformNormal(Vector3f(1.0f, 0.0f, 0.0f), MathUtils::CreateScale(1.0f, 0.0f, 1.0f)), Vector3f(0.0f, 0.0f, 0.0f)));
+	check("identity keeps vertex", IsSame(StaticBatch::TransformPosition(Vector3f(1.5f, -2.0f, 3.25f), Matrix4x4f::GetIdentity()), Vector3f(1.5f, -2.0f, 3.25f)) && IsSame(StaticBatch::TransformNormal(Vector3f(0.0f, 0.0f, -1.0f), Matrix4x4f::GetIdentity()), Vector3f(0.0f, 0.0f, -1.0f)));
+
+	//    ٴڰ  ġ ٴ Ƽ  Ƽ  ġ Ǿ մϴ.
+	PlaySimulation simulation;
+	simulation.Initialize({}, 64, 1);
+
+	Floor* floor = ObjectManager::Get().CreateObject<Floor>("Floor");
+	floor->Initialize();
+
+	std::vector<GameObject*> staticObjects = { floor };
+	staticObjects.insert(staticObjects.end(), simulation.GetStaticMeshObjects().begin(), simulation.GetStaticMeshObjects().end());
+
+	StaticBatch staticBatch;
+	for (const auto& object : staticObjects)
+	{
+		staticBatch.Add(object->GetMesh(), object->GetTransform().GetWorldMatrix(), object->GetMaterial());
+	}
+
+	const std::vector<StaticBatch::Batch>& batches = staticBatch.GetBatches();
+	check("scene batch count", batches.size() == 2);
+
+	if (batches.size() == 2)
+	{
+		std::vector<const StaticMesh*> wallMeshes;
+		std::vector<Matrix4x4f> wallWorlds;
+		for (const auto& object : simulation.GetStaticMeshObjects())
+		{
+			wallMeshes.push_back(object->GetMesh());
+			wallWorlds.push_back(object->GetTransform().GetWorldMatrix());
+		}
+
+		check("floor batch material", batches[0].material == floor->GetMaterial());
+		check("wall batch material", batches[1].material == simulation.GetStaticMeshObjects().front()->GetMaterial());
+		check("floor batch merge", IsMergedBatch(batches[0], { floor->GetMesh() }, { floor->GetTransform().GetWorldMatrix() }));
+		check("wall batch merge", IsMergedBatch(batches[1], wallMeshes, wallWorlds));
+
+		// ٴ y = 0 Ʒ 10x1x10 ̸,  浹 ڿ   ؾ մϴ.
+		check("floor batch bound", IsSameBound(batches[0].vertices, 0, batches[0].vertices.size(), Vector3f(-5.0f, -1.0f, -5.0f), Vector3f(5.0f, 0.0f, 5.0f)));
+
+		bool bIsSameWallBound = true;
+		std::size_t baseVertex = 0;
+		for (const auto& object : simulation.GetStaticMeshObjects())
+		{
+			const Box3D* box = static_cast<const Box3D*>(object->GetBoundingVolume());
+			bIsSameWallBound = bIsSameWallBound && IsSameBound(batches[1].vertices, baseVertex, object->GetMesh()->GetVertices().size(), box->GetMinPosition(), box->GetMaxPosition());
+			baseVertex += object->GetMesh()->GetVertices().size();
+		}
+		check("wall batch bound", bIsSameWallBound);
+	}
+
+	staticBatch.Clear();
+	check("clear batches", staticBatch.GetBatches().empty());
+
+	// Ʈ ׸ İ  ġ ׸  ׸ ȣ  մϴ.
+	for (const auto& object : staticObjects)
+	{
+		staticBatch.Add(object->GetMesh(), object->GetTransform().GetWorldMatrix(), object->GetMaterial());
+	}
+
+	std::vector<StaticMesh*> batchMeshes;
+	for (const auto& batch : staticBatch.GetBatches())
+	{
+		StaticMesh* mesh = ResourceManager::Get().CreateResource<StaticMesh>("StaticBatchMesh_" + std::to_string(batchMeshes.size()));
+		mesh->Initialize(batch.vertices, batch.indices);
+		batchMeshes.push_back(mesh);
+	}
+
+	ShaderTag shaderTags[2];
+	Shader* shadowShader = reinterpret_cast<Shader*>(&shaderTags[0]);
+	Shader* lightShader = reinterpret_cast<Shader*>(&shaderTags[1]);
+	const uint32_t shadowMapID = 7;
+
+	RenderQueue renderQueue;
+	RecordingRenderBackend backend;
+
+	auto submit = [&](const std::vector<const StaticMesh*>& meshes, const std::vector<const Material*>& materials, const std::vector<Matrix4x4f>& worlds, RenderQueue::Statistics& outOpaqueStatistics)
+	{
+		renderQueue.Clear();
+		for (std::size_t index = 0; index < meshes.size(); ++index)
+		{
+			DrawPacket shadowPacket;
+			shadowPacket.pass = ERenderPass::Shadow;
+			shadowPacket.shader = shadowShader;
+			shadowPacket.mesh = meshes[index];
+			shadowPacket.world = worlds[index];
+			renderQueue.Add(shadowPacket);
+
+			DrawPacket opaquePacket;
+			opaquePacket.pass = ERenderPass::Opaque;
+			opaquePacket.shader = lightShader;
+			opaquePacket.mesh = meshes[index];
+			opaquePacket.material = materials[index];
+			opaquePacket.textureID = shadowMapID;
+			opaquePacket.world = worlds[index];
+			renderQueue.Add(opaquePacket);
+		}
+
+		backend.Clear();
+		RenderQueue::Statistics shadowStatistics = renderQueue.Submit(backend, ERenderPass::Shadow);
+		outOpaqueStatistics = renderQueue.Submit(backend, ERenderPass::Opaque);
+		return shadowStatistics.countOfDraw + outOpaqueStatistics.countOfDraw;
+	};
+
+	std::vector<const StaticMesh*> objectMeshes;
+	std::vector<const Material*> objectMaterials;
+	std::vector<Matrix4x4f> objectWorlds;
+	for (const auto& object : staticObjects)
+	{
+		objectMeshes.push_back(object->GetMesh());
+		objectMaterials.push_back(object->GetMaterial());
+		objectWorlds.push_back(object->GetTransform().GetWorldMatrix());
+	}
+
+	std::vector<const StaticMesh*> batchedMeshes(batchMeshes.begin(), batchMeshes.end());
+	std::vector<const Material*> batchedMaterials;
+	for (const auto& batch : staticBatch.GetBatches())
+	{
+		batchedMaterials.push_back(batch.material);
+	}
+	std::vector<Matrix4x4f> batchedWorlds(batchedMeshes.size(), Matrix4x4f::GetIdentity());
+
+	RenderQueue::Statistics objectStatistics;
+	uint32_t countOfObjectDraw = submit(objectMeshes, objectMaterials, objectWorlds, objectStatistics);
+	check("per object draw call", countOfObjectDraw == 2 * staticObjects.size());
+
+	RenderQueue::Statistics batchedStatistics;
+	uint32_t countOfBatchedDraw = submit(batchedMeshes, batchedMaterials, batchedWorlds, batchedStatistics);
+	check("batched draw call", countOfBatchedDraw == 2 * staticBatch.GetBatches().size());
+
+	uint32_t countOfObjectIndex = 0;
+	for (const auto& mesh : objectMeshes)
+	{
+		countOfObjectIndex += mesh->GetIndexCount();
+	}
+
+	uint32_t countOfBatchedIndex = 0;
+	for (const RecordingRenderBackend::Command& command : backend.GetCommands())
+	{
+		countOfBatchedIndex += (command.type == RecordingRenderBackend::ECommandType::DrawMesh) ? command.indexCount : 0;
+	}
+	check("batched index count", countOfBatchedIndex == 2 * countOfObjectIndex);
+
+	// ް ۿ ٴڰ  ޽ø   ε  ġ ʰ,   ٽ ؾ մϴ.
+	MeshBuffer meshBuffer;
+	meshBuffer.Initialize(256, 256);
+
+	std::vector<MeshBuffer::Allocation> allocations;
+	bool bIsAllocated = true;
+	for (const auto& mesh : objectMeshes)
+	{
+		MeshBuffer::Allocation allocation;
+		bIsAllocated = bIsAllocated && meshBuffer.Allocate(mesh->GetVertices(), mesh->GetIndices(), allocation);
+		allocations.push_back(allocation);
+	}
+	check("mesh buffer allocate", bIsAllocated);
+
+	bool bIsPacked = true;
+	uint32_t expectedBaseVertex = 0;
+	uint32_t expectedFirstIndex = 0;
+	for (std::size_t index = 0; index < allocations.size(); ++index)
+	{
+		bIsPacked = bIsPacked
+			&& allocations[index].baseVertex == expectedBaseVertex && allocations[index].countOfVertex == objectMeshes[index]->GetVertices().size()
+			&& allocations[index].firstIndex == expectedFirstIndex && allocations[index].countOfIndex == objectMeshes[index]->GetIndexCount();
+
+		expectedBaseVertex += allocations[index].countOfVertex;
+		expectedFirstIndex += allocations[index].countOfIndex;
+	}
+	check("mesh buffer packed ranges", bIsPacked);
+
+	MeshBuffer::Allocation reused;
+	meshBuffer.Free(allocations[2]);
+	check("mesh buffer reuse freed range", meshBuffer.Allocate(objectMeshes[2]->GetVertices(), objectMeshes[2]->GetIndices(), reused) && reused.baseVertex == allocations[2].baseVertex && reused.firstIndex == allocations[2].firstIndex);
+
+	//    ε  ϸ,  Ҵ   ǵ մϴ.
+	uint32_t freeVertexSize = meshBuffer.GetVertexAllocator().GetFreeSize();
+	uint32_t freeIndexSize = meshBuffer.GetIndexAllocator().GetFreeSize();
+	std::vector<uint32_t> tooManyIndices(freeIndexSize + 1, 0);
+	MeshBuffer::Allocation failed;
+	check("mesh buffer reject overflow", !meshBuffer.Allocate(cubeVertices, tooManyIndices, failed));
+	check("mesh buffer rollback", meshBuffer.GetVertexAllocator().GetFreeSize() == freeVertexSize && meshBuffer.GetIndexAllocator().GetFreeSize() == freeIndexSize);
+
+	allocations[2] = reused;
+	for (const auto& allocation : allocations)
+	{
+		meshBuffer.Free(allocation);
+	}
+	check("mesh buffer free all", meshBuffer.GetVertexAllocator().GetCountOfFreeRange() == 1 && meshBuffer.GetVertexAllocator().GetFreeSize() == 256 && meshBuffer.GetIndexAllocator().GetCountOfFreeRange() == 1 && meshBuffer.GetIndexAllocator().GetFreeSize() == 256);
+
+	//  ó  ġ Ѿ  ޽ø ް  ϳ , н  迭 Ʈ   εϰ   ׷ մϴ.
+	const StaticMesh* bulletMesh = simulation.GetBulletField()->GetMesh();
+
+	uint32_t sceneVertexCapacity = static_cast<uint32_t>(bulletMesh->GetVertices().size());
+	uint32_t sceneIndexCapacity = bulletMesh->GetIndexCount();
+	for (const auto& batch : staticBatch.GetBatches())
+	{
+		sceneVertexCapacity += static_cast<uint32_t>(batch.vertices.size());
+		sceneIndexCapacity += static_cast<uint32_t>(batch.indices.size());
+	}
+
+	MeshBuffer sceneMeshBuffer;
+	sceneMeshBuffer.Initialize(sceneVertexCapacity, sceneIndexCapacity);
+
+	std::vector<MeshBuffer::Allocation> batchAllocations(staticBatch.GetBatches().size());
+	bool bIsSceneAllocated = true;
+	for (std::size_t index = 0; index < batchAllocations.size(); ++index)
+	{
+		const StaticBatch::Batch& batch = staticBatch.GetBatches()[index];
+		bIsSceneAllocated = bIsSceneAllocated && sceneMeshBuffer.Allocate(batch.vertices, batch.indices, batchAllocations[index]);
+	}
+
+	MeshBuffer::Allocation bulletAllocation;
+	bIsSceneAllocated = bIsSceneAllocated && sceneMeshBuffer.Allocate(bulletMesh->GetVertices(), bulletMesh->GetIndices(), bulletAllocation);
+	check("scene mesh buffer allocate", bIsSceneAllocated && sceneMeshBuffer.GetVertexAllocator().GetFreeSize() == 0 && sceneMeshBuffer.GetIndexAllocator().GetFreeSize() == 0);
+
+	ShaderTag instancedShaderTags[2];
+	Shader* shadowInstancedShader = reinterpret_cast<Shader*>(&instancedShaderTags[0]);
+	Shader* lightInstancedShader = reinterpret_cast<Shader*>(&instancedShaderTags[1]);
+
+	InstanceBuffer bulletInstanceBuffer;
+	bulletInstanceBuffer.Initialize(4);
+	bulletInstanceBuffer.Add(Vector3f(1.0f, 0.5f, 1.0f), 0.1f);
+	bulletInstanceBuffer.Add(Vector3f(-1.0f, 0.5f, 2.0f), 0.2f);
+
+	renderQueue.Clear();
+	for (std::size_t index = 0; index < batchAllocations.size(); ++index)
+	{
+		DrawPacket shadowPacket;
+		shadowPacket.pass = ERenderPass::Shadow;
+		shadowPacket.shader = shadowShader;
+		shadowPacket.meshBuffer = &sceneMeshBuffer;
+		shadowPacket.allocation = batchAllocations[index];
+		renderQueue.Add(shadowPacket);
+
+		DrawPacket opaquePacket;
+		opaquePacket.pass = ERenderPass::Opaque;
+		opaquePacket.shader = lightShader;
+		opaquePacket.meshBuffer = &sceneMeshBuffer;
+		opaquePacket.allocation = batchAllocations[index];
+		opaquePacket.material = batchedMaterials[index];
+		opaquePacket.textureID = shadowMapID;
+		renderQueue.Add(opaquePacket);
+	}
+
+	DrawPacket bulletShadowPacket;
+	bulletShadowPacket.pass = ERenderPass::Shadow;
+	bulletShadowPacket.shader = shadowInstancedShader;
+	bulletShadowPacket.meshBuffer = &sceneMeshBuffer;
+	bulletShadowPacket.allocation = bulletAllocation;
+	bulletShadowPacket.instanceBuffer = &bulletInstanceBuffer;
+	renderQueue.Add(bulletShadowPacket);
+
+	DrawPacket bulletOpaquePacket;
+	bulletOpaquePacket.pass = ERenderPass::Opaque;
+	bulletOpaquePacket.shader = lightInstancedShader;
+	bulletOpaquePacket.meshBuffer = &sceneMeshBuffer;
+	bulletOpaquePacket.allocation = bulletAllocation;
+	bulletOpaquePacket.textureID = shadowMapID;
+	bulletOpaquePacket.instanceBuffer = &bulletInstanceBuffer;
+	renderQueue.Add(bulletOpaquePacket);
+
+	backend.Clear();
+	RenderQueue::Statistics sharedShadowStatistics = renderQueue.Submit(backend, ERenderPass::Shadow);
+	RenderQueue::Statistics sharedOpaqueStatistics = renderQueue.Submit(backend, ERenderPass::Opaque);
+
+	bool bIsSharedBind = sharedShadowStatistics.countOfMeshChange == 1 && sharedOpaqueStatistics.countOfMeshChange == 1
+		&& backend.GetCountOfCommand(RecordingRenderBackend::ECommandType::BindMeshBuffer) == 2
+		&& backend.GetCountOfCommand(RecordingRenderBackend::ECommandType::BindMesh) == 0;
+	check("shared mesh buffer bind once per pass", bIsSharedBind);
+
+	bool bIsBaseVertexDraw = backend.GetCountOfCommand(RecordingRenderBackend::ECommandType::DrawMeshBaseVertex) == 2 * batchAllocations.size()
+		&& backend.GetCountOfCommand(RecordingRenderBackend::ECommandType::DrawMeshInstancedBaseVertex) == 2
+		&& backend.GetCountOfCommand(RecordingRenderBackend::ECommandType::DrawMesh) == 0
+		&& backend.GetCountOfCommand(RecordingRenderBackend::ECommandType::DrawMeshInstanced) == 0;
+	for (const RecordingRenderBackend::Command& command : backend.GetCommands())
+	{
+		if (command.type == RecordingRenderBackend::ECommandType::BindMeshBuffer)
+		{
+			bIsBaseVertexDraw = bIsBaseVertexDraw && command.meshBuffer == &sceneMeshBuffer;
+		}
+		else if (command.type == RecordingRenderBackend::ECommandType::DrawMeshBaseVertex)
+		{
+			bool bIsBatchAllocation = false;
+			for (const auto& allocation : batchAllocations)
+			{
+				bIsBatchAllocation = bIsBatchAllocation || (command.allocation.baseVertex == allocation.baseVertex && command.allocation.firstIndex == allocation.firstIndex && command.allocation.countOfIndex == allocation.countOfIndex);
+			}
+			bIsBaseVertexDraw = bIsBaseVertexDraw && bIsBatchAllocation;
+		}
+		else if (command.type == RecordingRenderBackend::ECommandType::DrawMeshInstancedBaseVertex)
+		{
+			bIsBaseVertexDraw = bIsBaseVertexDraw
+				&& command.allocation.baseVertex == bulletAllocation.baseVertex && command.allocation.firstIndex == bulletAllocation.firstIndex
+				&& command.indexCount == bulletMesh->GetIndexCount() && command.countOfInstance == 2;
+		}
+	}
+	check("shared mesh buffer base vertex draw", bIsBaseVertexDraw);
+
+	bulletInstanceBuffer.Release();
+	sceneMeshBuffer.Release();
+
+	check("range allocator same as bitmap", IsSameAsBitmap(1024, option.operations, 1));
+
+	std::printf("  static meshes %zu, batches %zu, indices %u\n", staticObjects.size(), staticBatch.GetBatches().size(), countOfObjectIndex);
+	std::printf("  per object : %2u draw calls/frame, %2u mesh binds/opaque pass\n", countOfObjectDraw, objectStatistics.countOfMeshChange);
+	std::printf("  batched    : %2u draw calls/frame, %2u mesh binds/opaque pass\n", countOfBatchedDraw, batchedStatistics.countOfMeshChange);
+	std::printf("  mesh buffer: %2u draw calls/frame, %2u mesh binds/opaque pass (with bullets)\n", sharedShadowStatistics.countOfDraw + sharedOpaqueStatistics.countOfDraw, sharedOpaqueStatistics.countOfMeshChange);
+
+	meshBuffer.Release();
+	simulation.Release();
+	ObjectManager::Get().Shutdown();
+	ResourceManager::Get().Shutdown();
+	JobSystem::Get().Shutdown();
+
+	std::printf("  result : %s\n", (countOfMismatch == 0) ? "ok" : "mismatch");
+	return (countOfMismatch == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,208 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "IObject.h"
+#include "IResource.h"
+#include "ObjectManager.h"
+#include "ResourceManager.h"
+#include "StringId.h"
+
+static_assert(StringId::Hash("") == 0xCBF29CE484222325ULL, "FNV-1a hash of empty string mismatch...");
+static_assert(StringId::Hash("a") == 0xAF63DC4C8601EC8CULL, "FNV-1a hash of \"a\" mismatch...");
+static_assert(StringId::Hash("foobar") == 0x85944171F73967E8ULL, "FNV-1a hash of \"foobar\" mismatch...");
+static_assert(StringId("Player") == StringId("Player"), "string id must be compile time constant...");
+
+
+/**
+ * @brief ȸ 븸 ϱ   ҽԴϴ.
+ */
+class BenchResource : public IResource
+{
+public:
+	BenchResource() = default;
+	virtual ~BenchResource() {}
+
+	DISALLOW_COPY_AND_ASSIGN(BenchResource);
+
+	virtual void Release() override {}
+};
+
+
+/**
+ * @brief ȸ 븸 ϱ   ƮԴϴ.
+ */
+class BenchObject : public IObject
+{
+public:
+	BenchObject() = default;
+	virtual ~BenchObject() {}
+
+	DISALLOW_COPY_AND_ASSIGN(BenchObject);
+
+	virtual void Tick(float deltaSeconds) override {}
+	virtual void Release() override {}
+};
+
+
+/**
+ * @brief   count ϰ ȸ    ð ʴ ȸ  մϴ.
+ *
+ * @param name   ̸Դϴ.
+ * @param count    ȽԴϴ.
+ * @param lookup ȸ ε ޾ ȸ  ּҸ ȯϴ  Դϴ.
+ *
+ * @return ȸ  ּҸ  üũ ȯմϴ.
+ */
+template <typename TLookup>
+uint64_t Measure(const char* name, uint64_t count, TLookup&& lookup)
+{
+	uint64_t checksum = 0;
+
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint64_t index = 0; index < count; ++index)
+	{
+		checksum += reinterpret_cast<uintptr_t>(lookup(index));
+	}
+	auto endTime = std::chrono::steady_clock::now();
+
+	double nanoseconds = std::chrono::duration<double, std::nano>(endTime - startTime).count();
+	std::printf("  %-32s : %8.2f ns/lookup %8.2f M lookups/s\n", name, nanoseconds / static_cast<double>(count), static_cast<double>(count) / nanoseconds * 1000.0);
+
+	return checksum;
+}
+
+
+int main(int argc, char** argv)
+{
+	uint64_t count = 10000000;
+	uint32_t countOfKey = 512;
+
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument.rfind("count=", 0) == 0)
+		{
+			count = static_cast<uint64_t>(std::strtoull(argument.c_str() + 6, nullptr, 10));
+		}
+		else if (argument.rfind("keys=", 0) == 0)
+		{
+			countOfKey = static_cast<uint32_t>(std::strtoul(argument.c_str() + 5, nullptr, 10));
+		}
+		else
+		{
+			std::fprintf(stderr, "usage : Dodge3DStringIdBench [count=10000000] [keys=512]\n");
+			return 1;
+		}
+	}
+
+	if (countOfKey == 0)
+	{
+		std::fprintf(stderr, "keys must be greater than zero...\n");
+		return 1;
+	}
+
+	ResourceManager::Get().Startup();
+	ObjectManager::Get().Startup();
+
+	//  ñ״ó   ̸ մϴ.
+	std::vector<std::string> signatures(countOfKey);
+	std::vector<StringId> ids(countOfKey);
+	for (uint32_t key = 0; key < countOfKey; ++key)
+	{
+		char buffer[64];
+		std::snprintf(buffer, sizeof(buffer), "GameScene_BenchSignature_%u", key);
+
+		signatures[key] = buffer;
+		ids[key] = StringId(signatures[key]);
+	}
+
+	//    ñ״ó ڿ Ű ϴ ĳԴϴ.
+	std::unordered_map<std::string, std::unique_ptr<IResource>> stringCache;
+	std::vector<IResource*> resources(countOfKey);
+	std::vector<IObject*> objects(countOfKey);
+
+	for (uint32_t key = 0; key < countOfKey; ++key)
+	{
+		resources[key] = ResourceManager::Get().CreateResource<BenchResource>(signatures[key]);
+		objects[key] = ObjectManager::Get().CreateObject<BenchObject>(signatures[key]);
+		stringCache.insert({ signatures[key], std::make_unique<BenchResource>() });
+	}
+
+	int32_t countOfMismatch = 0;
+	for (uint32_t key = 0; key < countOfKey; ++key)
+	{
+		if (ResourceManager::Get().GetResource<BenchResource>(signatures[key]) != resources[key]
+			|| ResourceManager::Get().GetResource<BenchResource>(ids[key]) != resources[key]
+			|| ObjectManager::Get().GetObject<BenchObject>(signatures[key]) != objects[key]
+			|| ObjectManager::Get().GetObject<BenchObject>(ids[key]) != objects[key])
+		{
+			std::printf("  mismatch lookup %s\n", signatures[key].c_str());
+			countOfMismatch++;
+		}
+
+#if defined(DEBUG_MODE)
+		if (StringId::FindString(ids[key]) != signatures[key])
+		{
+			std::printf("  mismatch reverse table %s\n", signatures[key].c_str());
+			countOfMismatch++;
+		}
+#endif
+	}
+
+	//  ñ״ó ڿ ĺ ȸ ο  մϴ.
+	ResourceManager::Get().DestroyResource(signatures[0]);
+	ObjectManager::Get().DestroyObject(ids[0]);
+	ObjectManager::Get().FlushDestroyedObjects();
+	if (ResourceManager::Get().GetResource<BenchResource>(ids[0]) != nullptr || ObjectManager::Get().FindHandle(signatures[0]).IsValid())
+	{
+		std::printf("  mismatch destroy %s\n", signatures[0].c_str());
+		countOfMismatch++;
+	}
+
+	resources[0] = ResourceManager::Get().CreateResource<BenchResource>(signatures[0]);
+	objects[0] = ObjectManager::Get().CreateObject<BenchObject>(signatures[0]);
+
+	std::printf("Dodge3DStringIdBench\n");
+	std::printf("  keys %u, lookups %llu\n", countOfKey, static_cast<unsigned long long>(count));
+
+	uint32_t mask = countOfKey - 1;
+	bool bIsPowerOfTwo = (countOfKey & mask) == 0;
+	auto toKey = [&](uint64_t index) { return bIsPowerOfTwo ? static_cast<uint32_t>(index & mask) : static_cast<uint32_t>(index % countOfKey); };
+
+	std::vector<const char*> literals(countOfKey);
+	for (uint32_t key = 0; key < countOfKey; ++key)
+	{
+		literals[key] = signatures[key].c_str();
+	}
+
+	Measure("string map (literal)", count, [&](uint64_t index) { return stringCache.find(literals[toKey(index)])->second.get(); });
+	Measure("string map (std::string)", count, [&](uint64_t index) { return stringCache.find(signatures[toKey(index)])->second.get(); });
+
+	uint64_t checksumOfString = Measure("ResourceManager (std::string)", count, [&](uint64_t index) { return ResourceManager::Get().GetResource<BenchResource>(signatures[toKey(index)]); });
+	uint64_t checksumOfId = Measure("ResourceManager (StringId)", count, [&](uint64_t index) { return ResourceManager::Get().GetResource<BenchResource>(ids[toKey(index)]); });
+	if (checksumOfString != checksumOfId)
+	{
+		std::printf("  mismatch resource checksum\n");
+		countOfMismatch++;
+	}
+
+	checksumOfString = Measure("ObjectManager (std::string)", count, [&](uint64_t index) { return ObjectManager::Get().GetObject<BenchObject>(signatures[toKey(index)]); });
+	checksumOfId = Measure("ObjectManager (StringId)", count, [&](uint64_t index) { return ObjectManager::Get().GetObject<BenchObject>(ids[toKey(index)]); });
+	if (checksumOfString != checksumOfId)
+	{
+		std::printf("  mismatch object checksum\n");
+		countOfMismatch++;
+	}
+
+	ObjectManager::Get().Shutdown();
+	ResourceManager::Get().Shutdown();
+
+	std::printf("  result : %s\n", (countOfMismatch == 0) ? "ok" : "mismatch");
+	return (countOfMismatch == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,315 @@
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cwchar>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "FixedString.h"
+#include "StringUtils.h"
+
+
+/**
+ * @brief     ۿ ȭ   ǥ ڿ մϴ.
+ *
+ * @param format  ڿԴϴ.
+ * @param ... ڿ Ŀ ϴ Դϴ.
+ *
+ * @return ȭ ǥ ڿ ȯմϴ.
+ */
+std::wstring LegacyPrintF(const wchar_t* format, ...)
+{
+	static wchar_t legacyBuffer[StringUtils::STRING_BUFFER_SIZE];
+
+	va_list args;
+	va_start(args, format);
+	int32_t size = std::vswprintf(legacyBuffer, StringUtils::STRING_BUFFER_SIZE, format, args);
+	va_end(args);
+
+	return std::wstring(legacyBuffer, size);
+}
+
+
+/**
+ * @brief    ڿ պκ ݺؼ  ؽƮ иմϴ.
+ *
+ * @param text и  ڿԴϴ.
+ * @param delimiter и   ڿԴϴ.
+ *
+ * @return и ڿ  ִ ͸ ȯմϴ.
+ */
+std::vector<std::string> LegacySplit(const std::string& text, const std::string& delimiter)
+{
+	std::vector<std::string> tokens;
+	std::size_t position = 0ULL;
+	std::string remain = text;
+
+	while ((position = remain.find(delimiter)) != std::string::npos)
+	{
+		tokens.push_back(remain.substr(0, position));
+		remain.erase(0, position + delimiter.length());
+	}
+
+	tokens.push_back(remain);
+	return tokens;
+}
+
+
+/**
+ * @brief   count ϰ ȣ    ð մϴ.
+ *
+ * @param name   ̸Դϴ.
+ * @param count    ȽԴϴ.
+ * @param run ȣ    ũ⸦ ȯϴ  Դϴ.
+ *
+ * @return ȣ    ð() ȯմϴ.
+ */
+template <typename TRun>
+double Measure(const char* name, uint64_t count, TRun&& run)
+{
+	uint64_t checksum = 0;
+
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint64_t index = 0; index < count; ++index)
+	{
+		checksum += static_cast<uint64_t>(run(index));
+	}
+	auto endTime = std::chrono::steady_clock::now();
+
+	double nanoseconds = std::chrono::duration<double, std::nano>(endTime - startTime).count() / static_cast<double>(count);
+	std::printf("  %-34s : %10.2f ns/call (checksum %llu)\n", name, nanoseconds, static_cast<unsigned long long>(checksum));
+
+	return nanoseconds;
+}
+
+
+/**
+ * @brief ˻  ϰ  Ƚ մϴ.
+ *
+ * @param name ˻ ̸Դϴ.
+ * @param bIsPass ˻縦 ߴ Ȯմϴ.
+ * @param countOfFail  Ƚ   Դϴ.
+ */
+void Check(const char* name, bool bIsPass, int32_t& countOfFail)
+{
+	std::printf("  %-34s : %s\n", name, bIsPass ? "pass" : "FAIL");
+	if (!bIsPass)
+	{
+		countOfFail++;
+	}
+}
+
+
+int main(int argc, char** argv)
+{
+	uint64_t count = 1000000;
+	if (argc >= 2)
+	{
+		std::string argument = argv[1];
+		if (argument.rfind("count=", 0) != 0)
+		{
+			std::fprintf(stderr, "usage : Dodge3DStringUtilsBench [count=1000000]\n");
+			return 1;
+		}
+
+		count = static_cast<uint64_t>(std::strtoull(argument.c_str() + 6, nullptr, 10));
+	}
+
+	int32_t countOfFail = 0;
+	std::printf("Dodge3DStringUtilsBench\n");
+
+	// ȭ   ,  API,  ũ ڿ  ƾ մϴ.
+	{
+		std::wstring legacy = LegacyPrintF(L"%19ls %3d", L"2024-01-02-03-04-05", 42);
+		std::wstring printF = StringUtils::PrintF(L"%19ls %3d", L"2024-01-02-03-04-05", 42);
+
+		FixedWString<64> fixed;
+		fixed.Format(L"%19ls %3d", L"2024-01-02-03-04-05", 42);
+
+		Check("format wide", legacy == printF && printF == std::wstring(fixed.GetView()) && fixed.GetView() == L"2024-01-02-03-04-05  42", countOfFail);
+
+		char buffer[8];
+		std::size_t size = StringUtils::FormatTo(buffer, sizeof(buffer), "TIME : %3d", 123);
+
+		FixedWString<8> truncated;
+		truncated.Format(L"TIME : %3d", 123);
+
+		Check("format truncate", size == 7 && std::string(buffer) == "TIME : " && truncated.GetView() == L"TIME : ", countOfFail);
+	}
+
+	// и    ƾ ϸ,    ڵ ؾ մϴ.
+	{
+		const char* texts[] = { "key=value", "a==b=", "=", "", "no delimiter", "x=y=z" };
+
+		bool bIsPass = true;
+		std::vector<std::string_view> views;
+		for (const char* text : texts)
+		{
+			std::vector<std::string> legacy = LegacySplit(text, "=");
+			std::vector<std::string> tokens = StringUtils::Split(std::string(text), std::string("="));
+			StringUtils::Split(std::string_view(text), std::string_view("="), views);
+
+			bIsPass = bIsPass && legacy == tokens && legacy.size() == views.size();
+			for (std::size_t index = 0; bIsPass && index < views.size(); ++index)
+			{
+				bIsPass = legacy[index] == views[index];
+			}
+		}
+
+		Check("split", bIsPass, countOfFail);
+	}
+
+	// UTF-8 ̵ ڿ  ȯ   պؾ մϴ.
+	{
+		std::string utf8 = "Dodge 3D \xED\x95\x9C\xEA\xB8\x80 \xF0\x9F\x8E\xAE";
+		std::wstring wide = StringUtils::Convert(utf8);
+
+		std::wstring expect = L"Dodge 3D ";
+		expect.push_back(static_cast<wchar_t>(0xD55C));
+		expect.push_back(static_cast<wchar_t>(0xAE00));
+		expect.push_back(L' ');
+		if constexpr (sizeof(wchar_t) == 2)
+		{
+			expect.push_back(static_cast<wchar_t>(0xD83C));
+			expect.push_back(static_cast<wchar_t>(0xDFAE));
+		}
+		else
+		{
+			expect.push_back(static_cast<wchar_t>(0x1F3AE));
+		}
+
+		Check("convert utf-8 round trip", wide == expect && StringUtils::Convert(wide) == utf8, countOfFail);
+		Check("convert invalid utf-8", StringUtils::Convert(std::string("a\xC3")) == std::wstring(L"a") + static_cast<wchar_t>(0xFFFD), countOfFail);
+	}
+
+	{
+		int32_t integer = 0;
+		float floating = 0.0f;
+		bool bIsPass = StringUtils::ToLower(std::string("Dodge3D")) == "dodge3d" && StringUtils::ToUpper(std::wstring(L"Dodge3D")) == L"DODGE3D";
+		bIsPass = bIsPass && StringUtils::ToInt(std::string("-42"), integer) && integer == -42;
+		bIsPass = bIsPass && StringUtils::ToFloat(std::wstring(L"2.5"), floating) && floating == 2.5f;
+		bIsPass = bIsPass && !StringUtils::ToInt(std::string("abc"), integer);
+
+		Check("case and number", bIsPass, countOfFail);
+	}
+
+	//  尡 ÿ ȭص    ʾƾ մϴ.
+	{
+		const int32_t countOfThread = 4;
+		const int32_t countOfIteration = 20000;
+
+		std::vector<int32_t> mismatches(countOfThread, 0);
+		std::vector<std::thread> threads;
+		for (int32_t thread = 0; thread < countOfThread; ++thread)
+		{
+			threads.emplace_back([&mismatches, thread]()
+			{
+				for (int32_t iteration = 0; iteration < countOfIteration; ++iteration)
+				{
+					std::string text = StringUtils::PrintF("thread %d iteration %d", thread, iteration);
+					std::string expect = "thread " + std::to_string(thread) + " iteration " + std::to_string(iteration);
+					if (text != expect)
+					{
+						mismatches[thread]++;
+					}
+				}
+			});
+		}
+
+		int32_t countOfMismatch = 0;
+		for (int32_t thread = 0; thread < countOfThread; ++thread)
+		{
+			threads[thread].join();
+			countOfMismatch += mismatches[thread];
+		}
+
+		Check("thread local format", countOfMismatch == 0, countOfFail);
+	}
+
+	std::printf("\n  format (UIBoard, PlayLogger)\n");
+	Measure("PrintF legacy (global buffer)", count, [](uint64_t index) { return LegacyPrintF(L"TIME : %3d", static_cast<int32_t>(index & 0xFF)).size(); });
+	Measure("PrintF (thread local buffer)", count, [](uint64_t index) { return StringUtils::PrintF(L"TIME : %3d", static_cast<int32_t>(index & 0xFF)).size(); });
+	Measure("FixedWString::Format", count, [](uint64_t index)
+	{
+		FixedWString<32> text;
+		return text.Format(L"TIME : %3d", static_cast<int32_t>(index & 0xFF));
+	});
+
+	std::wstring reuse;
+	Measure("FixedWString + reuse wstring", count, [&reuse](uint64_t index)
+	{
+		FixedWString<32> text;
+		text.Format(L"TIME : %3d", static_cast<int32_t>(index & 0xFF));
+		reuse.assign(text.GetCStr(), text.GetSize());
+		return reuse.size();
+	});
+
+	Measure("PrintF legacy (log row)", count, [](uint64_t index) { return LegacyPrintF(L"%19ls %3d", L"2024-01-02-03-04-05", static_cast<int32_t>(index & 0xFF)).size(); });
+	Measure("FixedWString::Format (log row)", count, [](uint64_t index)
+	{
+		FixedWString<64> text;
+		return text.Format(L"%19ls %3d", L"2024-01-02-03-04-05", static_cast<int32_t>(index & 0xFF));
+	});
+
+	std::printf("\n  split\n");
+	for (int32_t countOfToken : { 4, 256, 4096 })
+	{
+		std::string text;
+		for (int32_t token = 0; token < countOfToken; ++token)
+		{
+			text += (token == 0) ? "" : ",";
+			text += "token" + std::to_string(token);
+		}
+
+		uint64_t countOfRun = count / static_cast<uint64_t>(countOfToken) + 1;
+		char name[64];
+
+		std::snprintf(name, sizeof(name), "Split legacy (%d tokens)", countOfToken);
+		double legacy = Measure(name, countOfRun, [&text](uint64_t) { return LegacySplit(text, ",").size(); });
+
+		std::snprintf(name, sizeof(name), "Split std::string (%d tokens)", countOfToken);
+		Measure(name, countOfRun, [&text](uint64_t) { return StringUtils::Split(text, std::string(",")).size(); });
+
+		std::vector<std::string_view> views;
+		std::snprintf(name, sizeof(name), "Split string_view (%d tokens)", countOfToken);
+		double linear = Measure(name, countOfRun, [&text, &views](uint64_t)
+		{
+			StringUtils::Split(std::string_view(text), std::string_view(","), views);
+			return views.size();
+		});
+
+		std::printf("  %-34s : %10.2fx\n", "speedup", legacy / linear);
+	}
+
+	std::printf("\n  convert\n");
+	std::string path = "D:\\Dodge3D\\Resource\\Texture\\Bullet.png";
+	std::wstring widePath = StringUtils::Convert(path);
+	Measure("Convert string -> wstring", count, [&path](uint64_t) { return StringUtils::Convert(path).size(); });
+	Measure("Convert wstring -> string", count, [&widePath](uint64_t) { return StringUtils::Convert(widePath).size(); });
+
+	std::printf("\n  case and number\n");
+	Measure("ToLower", count, [&path](uint64_t) { return StringUtils::ToLower(path).size(); });
+	Measure("ToUpper", count, [&widePath](uint64_t) { return StringUtils::ToUpper(widePath).size(); });
+
+	std::string integer = "12345";
+	std::wstring floating = L"3.25";
+	Measure("ToInt", count, [&integer](uint64_t)
+	{
+		int32_t value = 0;
+		StringUtils::ToInt(integer, value);
+		return value;
+	});
+	Measure("ToFloat", count, [&floating](uint64_t)
+	{
+		float value = 0.0f;
+		StringUtils::ToFloat(floating, value);
+		return static_cast<int32_t>(value);
+	});
+
+	std::printf("\n  result : %s\n", (countOfFail == 0) ? "pass" : "FAIL");
+	return (countOfFail == 0) ? 0 : 1;
+}
\ No newline at end of file
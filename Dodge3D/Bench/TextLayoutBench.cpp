@@ -0,0 +1,309 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "TextLayout.h"
+#include "TTFont.h"
+
+
+/**
+ * @brief ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+ */
+static const int32_t BEGIN_CODE_POINT = 32;
+
+
+/**
+ * @brief ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+ */
+static const int32_t END_CODE_POINT = 127;
+
+
+/**
+ * @brief  GlyphShader2D ϴ    Դϴ.
+ */
+struct LegacyVertex
+{
+	Vector3f position;
+	Vector2f texture;
+};
+
+
+/**
+ * @brief ҽ  Ʈ Ÿ Ʈ  Ƿ, ڵ Ʈ ũ ġ ٸ ۸ ؽó Ʋ󽺸 ϴ.
+ *
+ * @param glyphAtlasSize ۸ ؽó Ʋ ũԴϴ.
+ * @param scale ۸ ũ Դϴ.
+ *
+ * @return Ʈ  ִ ۸ ؽó Ʋ󽺸 ȯմϴ.
+ */
+GlyphAtlas MakeSyntheticGlyphAtlas(int32_t glyphAtlasSize, int32_t scale)
+{
+	GlyphAtlas glyphAtlas;
+	glyphAtlas.beginCodePoint = BEGIN_CODE_POINT;
+	glyphAtlas.endCodePoint = END_CODE_POINT;
+	glyphAtlas.glyphAtlasSize = glyphAtlasSize;
+	glyphAtlas.fontSize = static_cast<float>(32 * scale);
+
+	std::vector<Glyph>& glyphs = glyphAtlas.glyphs;
+	glyphs.resize(END_CODE_POINT - BEGIN_CODE_POINT + 1);
+
+	int32_t x = 0;
+	int32_t y = 0;
+	int32_t rowHeight = 0;
+	for (std::size_t index = 0; index < glyphs.size(); ++index)
+	{
+		int32_t codePoint = BEGIN_CODE_POINT + static_cast<int32_t>(index);
+		int32_t width = (4 + (codePoint * 7) % 11) * scale;
+		int32_t height = (9 + (codePoint * 5) % 13) * scale;
+
+		if (x + width > glyphAtlasSize)
+		{
+			x = 0;
+			y += rowHeight;
+			rowHeight = 0;
+		}
+
+		Glyph& glyph = glyphs[index];
+		glyph.codePoint = codePoint;
+		glyph.position0 = Vector2i(x, y);
+		glyph.position1 = Vector2i(x + width, y + height);
+		glyph.xoffset = 0.5f * static_cast<float>(codePoint % 3);
+		glyph.yoffset = -static_cast<float>(height) + 0.25f * static_cast<float>(codePoint % 5);
+		glyph.xoffset2 = glyph.xoffset + static_cast<float>(width);
+		glyph.yoffset2 = glyph.yoffset + static_cast<float>(height);
+		glyph.xadvance = static_cast<float>(width) + 1.375f;
+
+		x += width;
+		rowHeight = (height > rowHeight) ? height : rowHeight;
+	}
+
+	return glyphAtlas;
+}
+
+
+/**
+ * @brief  GlyphShader2D::UpdateGlyphVertexBuffer     ϴ.
+ *
+ * @param font Ʈ ҽԴϴ.
+ * @param text ġ ؽƮԴϴ.
+ * @param center ؽƮ ߽ ǥԴϴ.
+ * @param vertices   Դϴ.
+ *
+ * @return ۿ    ȯմϴ.
+ */
+uint32_t GenerateLegacyVertices(const TTFont* font, std::wstring_view text, const Vector2f& center, LegacyVertex* vertices)
+{
+	float glyphAtlasSize = static_cast<float>(font->GetGlyphAtlasSize());
+
+	float textWidth = 0.0f;
+	float textHeight = 0.0f;
+	font->MeasureText(text, textWidth, textHeight);
+
+	Vector2f position(center.x - textWidth / 2.0f, center.y + textHeight / 2.0f);
+
+	uint32_t vertexCount = 0;
+	for (const auto& unicode : text)
+	{
+		const Glyph& glyph = font->GetGlyph(static_cast<int32_t>(unicode));
+
+		float unicodeWidth = static_cast<float>(glyph.position1.x - glyph.position0.x);
+		float unicodeHeight = static_cast<float>(glyph.position1.y - glyph.position0.y);
+
+		vertices[vertexCount + 0].position = Vector3f(position.x + glyph.xoffset, position.y + glyph.yoffset, 0.0f);
+		vertices[vertexCount + 0].texture  = Vector2f(static_cast<float>(glyph.position0.x) / glyphAtlasSize, static_cast<float>(glyph.position0.y) / glyphAtlasSize);
+
+		vertices[vertexCount + 1].position = Vector3f(position.x + glyph.xoffset, position.y + unicodeHeight + glyph.yoffset, 0.0f);
+		vertices[vertexCount + 1].texture  = Vector2f(static_cast<float>(glyph.position0.x) / glyphAtlasSize, static_cast<float>(glyph.position1.y) / glyphAtlasSize);
+
+		vertices[vertexCount + 2].position = Vector3f(position.x + glyph.xoffset + unicodeWidth, position.y + glyph.yoffset, 0.0f);
+		vertices[vertexCount + 2].texture  = Vector2f(static_cast<float>(glyph.position1.x) / glyphAtlasSize, static_cast<float>(glyph.position0.y) / glyphAtlasSize);
+
+		vertices[vertexCount + 3].position = Vector3f(position.x + glyph.xoffset + unicodeWidth, position.y + glyph.yoffset, 0.0f);
+		vertices[vertexCount + 3].texture  = Vector2f(static_cast<float>(glyph.position1.x) / glyphAtlasSize, static_cast<float>(glyph.position0.y) / glyphAtlasSize);
+
+		vertices[vertexCount + 4].position = Vector3f(position.x + glyph.xoffset, position.y + unicodeHeight + glyph.yoffset, 0.0f);
+		vertices[vertexCount + 4].texture  = Vector2f(static_cast<float>(glyph.position0.x) / glyphAtlasSize, static_cast<float>(glyph.position1.y) / glyphAtlasSize);
+
+		vertices[vertexCount + 5].position = Vector3f(position.x + glyph.xoffset + unicodeWidth, position.y + unicodeHeight + glyph.yoffset, 0.0f);
+		vertices[vertexCount + 5].texture  = Vector2f(static_cast<float>(glyph.position1.x) / glyphAtlasSize, static_cast<float>(glyph.position1.y) / glyphAtlasSize);
+
+		position.x += glyph.xadvance;
+		vertexCount += 6;
+	}
+
+	return vertexCount;
+}
+
+
+/**
+ * @brief ̾ƿ ĳõ     Ʈ   ˻մϴ.
+ *
+ * @param name ˻ ̸Դϴ.
+ * @param layout ˻ ؽƮ ̾ƿԴϴ.
+ * @param font Ʈ ҽԴϴ.
+ * @param text ġ ؽƮԴϴ.
+ * @param center ؽƮ ߽ ǥԴϴ.
+ *
+ * @return Ʈ  ٸ true, ׷  false ȯմϴ.
+ */
+bool CheckLayout(const char* name, const TextLayout& layout, const TTFont* font, std::wstring_view text, const Vector2f& center)
+{
+	std::vector<LegacyVertex> legacyVertices(text.size() * 6 + 1);
+	uint32_t legacyCount = GenerateLegacyVertices(font, text, center, legacyVertices.data());
+
+	float width = 0.0f;
+	float height = 0.0f;
+	font->MeasureText(text, width, height);
+
+	const std::vector<TextLayout::GlyphVertex>& vertices = layout.GetVertices();
+	bool bIsMatch = (vertices.size() == legacyCount)
+		&& (std::memcmp(vertices.data(), legacyVertices.data(), sizeof(LegacyVertex) * legacyCount) == 0)
+		&& (width == layout.GetWidth())
+		&& (height == layout.GetHeight());
+
+	std::printf("  %-36s : %4u vertices %s\n", name, legacyCount, bIsMatch ? "ok" : "mismatch");
+	return bIsMatch;
+}
+
+
+int main(int argc, char** argv)
+{
+	uint64_t frame = 200000;
+
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument.rfind("frames=", 0) == 0)
+		{
+			frame = static_cast<uint64_t>(std::strtoull(argument.c_str() + 7, nullptr, 10));
+		}
+		else
+		{
+			std::fprintf(stderr, "usage : Dodge3DTextLayoutBench [frames=200000]\n");
+			return 1;
+		}
+	}
+
+	static_assert(sizeof(LegacyVertex) == sizeof(TextLayout::GlyphVertex), "glyph vertex layout mismatch...");
+
+	TTFont font32;
+	font32.Initialize(MakeSyntheticGlyphAtlas(256, 1));
+
+	TTFont font64;
+	font64.Initialize(MakeSyntheticGlyphAtlas(512, 2));
+
+	std::printf("Dodge3DTextLayoutBench\n");
+
+	int32_t countOfMismatch = 0;
+	auto check = [&](bool bIsMatch) { countOfMismatch += bIsMatch ? 0 : 1; };
+
+	TextLayout layout;
+	Vector2f center(500.0f, 250.0f);
+	std::wstring text = L"2024-01-01 12:34:56  42";
+
+	check(layout.Update(&font32, text, center));
+	check(CheckLayout("initial", layout, &font32, text, center));
+
+	uint64_t countOfBuild = layout.GetCountOfBuild();
+	check(!layout.Update(&font32, text, center) && layout.GetCountOfBuild() == countOfBuild);
+	check(CheckLayout("same inputs", layout, &font32, text, center));
+
+	text = L"Rank";
+	check(layout.Update(&font32, text, center));
+	check(CheckLayout("text changed", layout, &font32, text, center));
+
+	center = Vector2f(123.5f, 777.25f);
+	check(layout.Update(&font32, text, center));
+	check(CheckLayout("center changed", layout, &font32, text, center));
+
+	check(layout.Update(&font64, text, center));
+	check(CheckLayout("font changed", layout, &font64, text, center));
+
+	text = L"";
+	check(layout.Update(&font64, text, center));
+	check(CheckLayout("empty text", layout, &font64, text, center));
+
+	text = L" !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~";
+	check(layout.Update(&font64, text, center));
+	check(CheckLayout("all code points", layout, &font64, text, center));
+
+	layout.Upload();
+	check(!layout.IsDirty());
+
+	layout.Release();
+	check(layout.GetVertices().empty() && layout.GetFont() == nullptr);
+	check(layout.Update(&font64, text, center));
+	check(CheckLayout("after release", layout, &font64, text, center));
+
+	if (countOfMismatch != 0)
+	{
+		std::printf("  cache state mismatch %d\n", countOfMismatch);
+	}
+
+	// ũ ȭ     α 5 ׸  CPU  մϴ.
+	const uint32_t countOfLine = 5;
+	std::vector<std::wstring> lines(countOfLine);
+	std::vector<TextLayout> layouts(countOfLine);
+	for (uint32_t line = 0; line < countOfLine; ++line)
+	{
+		lines[line] = L"2024-01-0" + std::to_wstring(line + 1) + L" 12:34:56  " + std::to_wstring(100 - line);
+	}
+
+	std::vector<LegacyVertex> immediateVertices(1024);
+	uint64_t checksumOfImmediate = 0;
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint64_t index = 0; index < frame; ++index)
+	{
+		for (uint32_t line = 0; line < countOfLine; ++line)
+		{
+			Vector2f lineCenter(500.0f, 250.0f + 40.0f * static_cast<float>(line));
+			checksumOfImmediate += GenerateLegacyVertices(&font32, lines[line], lineCenter, immediateVertices.data());
+		}
+	}
+	auto endTime = std::chrono::steady_clock::now();
+	double immediateNanoseconds = std::chrono::duration<double, std::nano>(endTime - startTime).count();
+
+	uint64_t checksumOfCached = 0;
+	startTime = std::chrono::steady_clock::now();
+	for (uint64_t index = 0; index < frame; ++index)
+	{
+		for (uint32_t line = 0; line < countOfLine; ++line)
+		{
+			Vector2f lineCenter(500.0f, 250.0f + 40.0f * static_cast<float>(line));
+			layouts[line].Update(&font32, lines[line], lineCenter);
+			checksumOfCached += layouts[line].GetVertices().size();
+		}
+	}
+	endTime = std::chrono::steady_clock::now();
+	double cachedNanoseconds = std::chrono::duration<double, std::nano>(endTime - startTime).count();
+
+	uint64_t countOfTotalBuild = 0;
+	for (const auto& lineLayout : layouts)
+	{
+		countOfTotalBuild += lineLayout.GetCountOfBuild();
+	}
+
+	if (checksumOfImmediate != checksumOfCached || countOfTotalBuild != countOfLine)
+	{
+		std::printf("  mismatch frame checksum %llu %llu build %llu\n",
+			static_cast<unsigned long long>(checksumOfImmediate),
+			static_cast<unsigned long long>(checksumOfCached),
+			static_cast<unsigned long long>(countOfTotalBuild)
+		);
+		countOfMismatch++;
+	}
+
+	std::printf("  frames %llu, lines %u\n", static_cast<unsigned long long>(frame), countOfLine);
+	std::printf("  %-36s : %8.2f ns/frame\n", "immediate (GenerateGlyphVertices)", immediateNanoseconds / static_cast<double>(frame));
+	std::printf("  %-36s : %8.2f ns/frame\n", "cached (TextLayout::Update)", cachedNanoseconds / static_cast<double>(frame));
+
+	font64.Release();
+	font32.Release();
+
+	std::printf("  result : %s\n", (countOfMismatch == 0) ? "ok" : "mismatch");
+	return (countOfMismatch == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,212 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Camera3D.h"
+#include "Light.h"
+#include "Material.h"
+#include "MathUtils.h"
+#include "UniformBlock.h"
+#include "UniformBuffer.h"
+
+
+/**
+ * @brief ġũ  ɼԴϴ.
+ */
+struct BenchOption
+{
+	uint32_t materials = 64; // Ӹ  Ƽ  Դϴ.
+	uint32_t frames = 10000; //   Դϴ.
+};
+
+
+/**
+ * @brief  ڷκ ġũ  ɼ нϴ.
+ *
+ * @param argc   Դϴ.
+ * @param argv   Դϴ.
+ * @param outOption   ɼԴϴ.
+ *
+ * @return  ڸ оٸ true, ׷  false ȯմϴ.
+ */
+bool ParseOption(int32_t argc, char** argv, BenchOption& outOption)
+{
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument.rfind("materials=", 0) == 0)
+		{
+			outOption.materials = static_cast<uint32_t>(std::stoul(argument.substr(10)));
+		}
+		else if (argument.rfind("frames=", 0) == 0)
+		{
+			outOption.frames = static_cast<uint32_t>(std::stoul(argument.substr(7)));
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return outOption.materials > 0 && outOption.frames > 0;
+}
+
+
+/**
+ * @brief  Ʈ ¿  ״  ִ ˻մϴ.
+ *
+ * @param block ˻   ּԴϴ.
+ * @param offset ̴  д Ʈ Դϴ.
+ * @param value ¿  ϴ Դϴ.
+ * @param size  Ʈ ũԴϴ.
+ *
+ * @return  Ʈ  ٸ true, ׷  false ȯմϴ.
+ */
+bool IsSameBytes(const void* block, std::size_t offset, const void* value, std::size_t size)
+{
+	return std::memcmp(reinterpret_cast<const uint8_t*>(block) + offset, value, size) == 0;
+}
+
+
+int main(int argc, char** argv)
+{
+	BenchOption option;
+	if (!ParseOption(argc, argv, option))
+	{
+		std::fprintf(stderr, "usage : Dodge3DUniformBlockBench [materials=64] [frames=10000]\n");
+		return 1;
+	}
+
+	std::printf("Dodge3DUniformBlockBench\n");
+
+	int32_t countOfMismatch = 0;
+	auto check = [&](const char* name, bool bIsMatch)
+	{
+		if (!bIsMatch)
+		{
+			std::printf("  mismatch %s\n", name);
+			countOfMismatch++;
+		}
+	};
+
+	// std140 Ģ   Դϴ. vec3 ü 16Ʈ, mat4  16Ʈ 迡 Դϴ.
+	check("vector3 size", sizeof(Vector3f) == 12);
+	check("matrix4x4 size", sizeof(Matrix4x4f) == 64);
+
+	check("light position offset", offsetof(LightUniform, position) == 0);
+	check("light direction offset", offsetof(LightUniform, direction) == 16);
+	check("light ambient offset", offsetof(LightUniform, ambientRGB) == 32);
+	check("light diffuse offset", offsetof(LightUniform, diffuseRGB) == 48);
+	check("light specular offset", offsetof(LightUniform, specularRGB) == 64);
+	check("light size", sizeof(LightUniform) == 80);
+
+	check("frame view offset", offsetof(FrameUniformBlock, view) == 0);
+	check("frame projection offset", offsetof(FrameUniformBlock, projection) == 64);
+	check("frame light view projection offset", offsetof(FrameUniformBlock, lightViewProjection) == 128);
+	check("frame view position offset", offsetof(FrameUniformBlock, viewPosition) == 192);
+	check("frame light offset", offsetof(FrameUniformBlock, light) == 208);
+	check("frame size", sizeof(FrameUniformBlock) == 288);
+
+	check("material ambient offset", offsetof(MaterialUniformBlock, ambientRGB) == 0);
+	check("material diffuse offset", offsetof(MaterialUniformBlock, diffuseRGB) == 16);
+	check("material specular offset", offsetof(MaterialUniformBlock, specularRGB) == 32);
+	check("material shininess offset", offsetof(MaterialUniformBlock, shininess) == 44);
+	check("material size", sizeof(MaterialUniformBlock) == 48);
+
+	check("binding", FrameUniformBlock::BINDING != MaterialUniformBlock::BINDING);
+
+	//    ̴ д Ʈ ¿   մϴ.
+	Camera3D camera;
+	camera.Initialize(Vector3f(0.0f, 10.0f, 10.0f), Vector3f(0.0f, -1.0f, -1.0f), Vector3f(0.0f, 1.0f, 0.0f), MathUtils::ToRadian(45.0f), 16.0f / 9.0f, 0.01f, 100.0f);
+
+	Light light;
+	light.Initialize(
+		Vector3f(10.0f, 10.0f, 10.0f),
+		Vector3f(-1.0f, -1.0f, -1.0f),
+		Vector3f(0.5f, 0.5f, 0.5f),
+		Vector3f(0.7f, 0.7f, 0.7f),
+		Vector3f(1.0f, 1.0f, 1.0f),
+		Vector3f(0.0f, 1.0f, 0.0f),
+		MathUtils::CreateOrtho(-10.0f, +10.0f, -10.0f, +10.0f, 0.1f, 100.0f)
+	);
+
+	Material material;
+	material.Initialize(Vector3f(0.1f, 0.2f, 0.3f), Vector3f(0.4f, 0.5f, 0.6f), Vector3f(0.7f, 0.8f, 0.9f), 32.0f);
+
+	FrameUniformBlock frameBlock = FrameUniformBlock::Create(&camera, &light);
+	Matrix4x4f lightViewProjection = light.GetViewMatrix() * light.GetProjectionMatrix();
+	check("frame view", IsSameBytes(&frameBlock, 0, camera.GetViewMatrix().GetPtr(), sizeof(Matrix4x4f)));
+	check("frame projection", IsSameBytes(&frameBlock, 64, camera.GetProjectionMatrix().GetPtr(), sizeof(Matrix4x4f)));
+	check("frame light view projection", IsSameBytes(&frameBlock, 128, lightViewProjection.GetPtr(), sizeof(Matrix4x4f)));
+	check("frame view position", IsSameBytes(&frameBlock, 192, camera.GetEyePosition().GetPtr(), sizeof(Vector3f)));
+	check("frame light position", IsSameBytes(&frameBlock, 208, light.GetPosition().GetPtr(), sizeof(Vector3f)));
+	check("frame light direction", IsSameBytes(&frameBlock, 224, light.GetDirection().GetPtr(), sizeof(Vector3f)));
+	check("frame light ambient", IsSameBytes(&frameBlock, 240, light.GetAmbientRGB().GetPtr(), sizeof(Vector3f)));
+	check("frame light diffuse", IsSameBytes(&frameBlock, 256, light.GetDiffuseRGB().GetPtr(), sizeof(Vector3f)));
+	check("frame light specular", IsSameBytes(&frameBlock, 272, light.GetSpecularRGB().GetPtr(), sizeof(Vector3f)));
+
+	MaterialUniformBlock materialBlock = MaterialUniformBlock::Create(&material);
+	check("material ambient", IsSameBytes(&materialBlock, 0, material.GetAmbientRGB().GetPtr(), sizeof(Vector3f)));
+	check("material diffuse", IsSameBytes(&materialBlock, 16, material.GetDiffuseRGB().GetPtr(), sizeof(Vector3f)));
+	check("material specular", IsSameBytes(&materialBlock, 32, material.GetSpecularRGB().GetPtr(), sizeof(Vector3f)));
+	float shininess = material.GetShininess();
+	check("material shininess", IsSameBytes(&materialBlock, 44, &shininess, sizeof(float)));
+
+	//        glBindBufferRange  ϳ   ֽϴ.
+	check("aligned size exact", UniformBuffer::GetAlignedSize(256, 256) == 256);
+	check("aligned size round up", UniformBuffer::GetAlignedSize(288, 256) == 512);
+	check("aligned size small", UniformBuffer::GetAlignedSize(48, 16) == 48);
+	check("aligned size pad", UniformBuffer::GetAlignedSize(48, 32) == 64);
+
+	UniformBuffer materialBuffer;
+	materialBuffer.Initialize(MaterialUniformBlock::BINDING, sizeof(MaterialUniformBlock), option.materials);
+	check("buffer stride", materialBuffer.GetBlockStride() == 256 && materialBuffer.GetBlockSize() == sizeof(MaterialUniformBlock));
+	check("buffer count", materialBuffer.GetCountOfBlock() == option.materials && materialBuffer.GetBinding() == MaterialUniformBlock::BINDING);
+	materialBuffer.Release();
+
+	// Ӹ   ϳ Ƽ   ð մϴ.
+	std::vector<Material> materials(option.materials);
+	for (uint32_t index = 0; index < option.materials; ++index)
+	{
+		float value = static_cast<float>(index) / static_cast<float>(option.materials);
+		materials[index].Initialize(Vector3f(value, value, value), Vector3f(value, 0.5f, 0.5f), Vector3f(0.5f, value, 0.5f), 1.0f + value);
+	}
+
+	std::vector<MaterialUniformBlock> materialBlocks(option.materials);
+	float checksum = 0.0f;
+
+	auto startTime = std::chrono::steady_clock::now();
+	for (uint32_t frame = 0; frame < option.frames; ++frame)
+	{
+		frameBlock = FrameUniformBlock::Create(&camera, &light);
+		for (uint32_t index = 0; index < option.materials; ++index)
+		{
+			materialBlocks[index] = MaterialUniformBlock::Create(&materials[index]);
+		}
+
+		checksum += frameBlock.viewPosition.y + materialBlocks[frame % option.materials].shininess;
+	}
+	auto endTime = std::chrono::steady_clock::now();
+	double milliseconds = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+	check("pack checksum", checksum > 0.0f);
+
+	for (auto& element : materials)
+	{
+		element.Release();
+	}
+	material.Release();
+	light.Release();
+	camera.Release();
+
+	std::printf("  frame block %zu bytes, material block %zu bytes\n", sizeof(FrameUniformBlock), sizeof(MaterialUniformBlock));
+	std::printf("  materials %u, upload %zu bytes/frame\n", option.materials, sizeof(FrameUniformBlock) + option.materials * sizeof(MaterialUniformBlock));
+	std::printf("  pack : %7.4f ms/frame\n", milliseconds / static_cast<double>(option.frames));
+
+	std::printf("  result : %s\n", (countOfMismatch == 0) ? "ok" : "mismatch");
+	return (countOfMismatch == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -1,137 +0,0 @@
-#pragma once
-
-#include "GameObject.h"
-#include "Sphere3D.h"
-#include "Vector3.h"
-
-class Sound;
-
-
-/**
- * @brief ÷̾ ؾ  Ѿ ƮԴϴ.
- */
-class Bullet : public GameObject
-{
-public:
-	/**
-	 * @brief ÷̾ ؾ  Ѿ Ʈ ⺻ Դϴ.
-	 *
-	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
-	 */
-	Bullet() = default;
-
-
-	/**
-	 * @brief ÷̾ ؾ  Ѿ Ʈ  ҸԴϴ.
-	 */
-	virtual ~Bullet();
-
-	
-	/**
-	 * @brief ÷̾ ؾ  Ѿ Ʈ  ڿ  ڸ  մϴ.
-	 */
-	DISALLOW_COPY_AND_ASSIGN(Bullet);
-
-
-	/**
-	 * @brief ÷̾ ؾ  Ѿ Ʈ ʱȭմϴ.
-	 *
-	 * @param location Ѿ Ʈ   ġԴϴ.
-	 * @param direction Ѿ Դϴ.
-	 * @param speed Ѿ ӷԴϴ.
-	 * @param boundRadius Ѿ    Դϴ.
-	 */
-	void Initialize(const Vector3f& location, const Vector3f& direction, float speed, float boundRadius);
-
-
-	/**
-	 * @brief ÷̾ ؾ  Ѿ Ʈ Ʈմϴ.
-	 *
-	 * @param deltaSeconds Ÿ ð Դϴ.
-	 */
-	virtual void Tick(float deltaSeconds) override;
-
-
-	/**
-	 * @brief ÷̾ ؾ  Ѿ Ʈ  ҽ Ҵ մϴ.
-	 */
-	virtual void Release() override;
-
-
-	/**
-	 * @brief Ѿ Ʈ   ϴ.
-	 * 
-	 * @return Ѿ Ʈ   ȯմϴ.
-	 */
-	virtual const IShape3D* GetBoundingVolume() const override { return &boundingVolume_; }
-
-
-	/**
-	 * @brief Ѿ  浹ߴ Ȯմϴ.
-	 * 
-	 * @return Ѿ  浹ߴٸ true, ׷  false ȯմϴ.
-	 */
-	bool IsCollisionToWall() const { return bIsCollisionToWall_; }
-
-
-	/**
-	 * @brief Ѿ ÷̾ 浹ߴ Ȯմϴ.
-	 * 
-	 * @return Ѿ ÷̾ 浹ߴٸ true, ׷  false ȯմϴ.
-	 */
-	bool IsCollisionToPlayer() const { return bIsCollisionToPlayer_; }
-
-
-private:
-	/**
-	 * @brief  浹ϴ Ȯմϴ.
-	 * 
-	 * @return  浹Ѵٸ true, ׷  false ȯմϴ.
-	 */
-	bool CheckCollisionToWall();
-
-
-	/**
-	 * @brief ÷̾ 浹ϴ Ȯմϴ.
-	 * 
-	 * @return ÷̾ 浹Ѵٸ true, ׷  false ȯմϴ.
-	 */
-	bool CheckCollisionToPlayer();
-
-
-private:
-	/**
-	 * @brief Ѿ Դϴ.
-	 */
-	Vector3f direction_;
-
-
-	/**
-	 * @brief Ѿ ӷԴϴ.
-	 */
-	float speed_;
-
-
-	/**
-	 * @brief Ѿ  Դϴ.
-	 */
-	Sphere3D boundingVolume_;
-
-
-	/**
-	 * @brief Ѿ  浹ߴ Ȯմϴ.
-	 */
-	bool bIsCollisionToWall_ = false;
-
-
-	/**
-	 * @brief Ѿ ÷̾ 浹ߴ Ȯմϴ.
-	 */
-	bool bIsCollisionToPlayer_ = false;
-
-
-	/**
-	 * @brief Ѿ 浹   Դϴ.
-	 */
-	Sound* hitSound_ = nullptr;
-};
\ No newline at end of file
@@ -0,0 +1,349 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "GameObject.h"
+#include "Matrix4x4.h"
+#include "ObjectHandle.h"
+#include "Vector3.h"
+
+#include "BulletPattern.h"
+
+class CollisionWorld;
+class InstanceBuffer;
+
+
+/**
+ * @brief ÷̾ ؾ  Ѿ˵   ϴ ƮԴϴ.
+ *
+ * @note
+ * - Ѿ ġ, , ӷ, ,  θ ü 迭(SoA) · մϴ.
+ * -  Ѿ   Ʈ Ǿ  Ѿ   ˴ϴ.
+ * -    ÿ ִ Ѿ  ִ  ʽϴ.
+ * -  Ѿ 浹 忡   Ͻ÷ ϵǸ, 浹 ó ResolveCollision   մϴ.
+ */
+class BulletField : public GameObject
+{
+public:
+	/**
+	 * @brief Ѿ ʵ Ʈ ⺻ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	BulletField() = default;
+
+
+	/**
+	 * @brief Ѿ ʵ Ʈ  ҸԴϴ.
+	 */
+	virtual ~BulletField();
+
+
+	/**
+	 * @brief Ѿ ʵ Ʈ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(BulletField);
+
+
+	/**
+	 * @brief Ѿ ʵ Ʈ ʱȭմϴ.
+	 *
+	 * @param capacity ̸ Ȯ Ѿ  Դϴ.
+	 */
+	void Initialize(uint32_t capacity);
+
+
+	/**
+	 * @brief ִ Ѿ˵ ̵Ű 浹  Ͻø մϴ.
+	 *
+	 * @param deltaSeconds Ÿ ð Դϴ.
+	 */
+	virtual void Tick(float deltaSeconds) override;
+
+
+	/**
+	 * @brief 浹 尡  浹  , ÷̾ 浹 Ѿ óմϴ.
+	 *
+	 * @note 浹  Tick Ŀ ȣؾ մϴ.
+	 */
+	void ResolveCollision();
+
+
+	/**
+	 * @brief Ѿ ʵ Ʈ  ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief Ѿ ʵ Ʈ   ϴ.
+	 *
+	 * @return  Ѿ   ϹǷ ׻  ͸ ȯմϴ.
+	 */
+	virtual const IShape3D* GetBoundingVolume() const override { return nullptr; }
+
+
+	/**
+	 * @brief ο Ѿ մϴ.
+	 *
+	 * @param location Ѿ   ġԴϴ.
+	 * @param direction Ѿ Դϴ.
+	 * @param speed Ѿ ӷԴϴ.
+	 * @param radius Ѿ    Դϴ.
+	 *
+	 * @return  Ѿ  ε ȯմϴ.
+	 */
+	uint32_t Spawn(const Vector3f& location, const Vector3f& direction, float speed, float radius);
+
+
+	/**
+	 * @brief Ѿ  ߻ Ѿ˵   մϴ.
+	 *
+	 * @param emissions  Ѿ˵ ߻ Դϴ.
+	 * @param radius Ѿ    Դϴ.
+	 *
+	 * @note
+	 * -  Spawn  ȣ Ͱ   ˴ϴ.
+	 * -  Ʈ ϸ   迭   ø  äϴ.
+	 */
+	void SpawnBatch(const std::vector<BulletPattern::Emission>& emissions, float radius);
+
+
+	/**
+	 * @brief Ѿ ϰ   Ʈ ȯմϴ.
+	 *
+	 * @param slot  Ѿ  εԴϴ.
+	 */
+	void Kill(uint32_t slot);
+
+
+	/**
+	 * @brief  Ѿ մϴ.
+	 *
+	 * @note 浹  Ͻô  Ƿ, 浹  Բ   ؾ մϴ.
+	 */
+	void Clear();
+
+
+	/**
+	 * @brief Ѿ ʵ   ϴ.
+	 *
+	 * @return Ѿ ʵ   ȯմϴ.
+	 *
+	 * @note  ȸ  IsAlive ִ Ѿ Ȯؾ մϴ.
+	 */
+	uint32_t GetCountOfSlot() const { return static_cast<uint32_t>(alives_.size()); }
+
+
+	/**
+	 * @brief ִ Ѿ  ϴ.
+	 *
+	 * @return ִ Ѿ  ȯմϴ.
+	 */
+	uint32_t GetCountOfAlive() const { return countOfAlive_; }
+
+
+	/**
+	 * @brief  Ѿ ִ Ȯմϴ.
+	 *
+	 * @param slot Ȯ  εԴϴ.
+	 *
+	 * @return Ѿ ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsAlive(uint32_t slot) const { return alives_[slot] != 0; }
+
+
+	/**
+	 * @brief  Ѿ ġ ϴ.
+	 *
+	 * @param slot ġ   εԴϴ.
+	 *
+	 * @return Ѿ   ġ ȯմϴ.
+	 */
+	Vector3f GetLocation(uint32_t slot) const { return Vector3f(positionX_[slot], positionY_[slot], positionZ_[slot]); }
+
+
+	/**
+	 * @brief  Ѿ  ̸ ϴ.
+	 *
+	 * @param slot  ̸   εԴϴ.
+	 *
+	 * @return Ѿ    ̸ ȯմϴ.
+	 */
+	float GetRadius(uint32_t slot) const { return radii_[slot]; }
+
+
+	/**
+	 * @brief  Ѿ ġ  ùķ̼ ܰ ġ մϴ.
+	 *
+	 * @note   ùķ̼ ܰ踦 ϱ  ȣؾ մϴ.
+	 */
+	void RecordPrevLocations();
+
+
+	/**
+	 * @brief  Ѿ   ϴ.
+	 *
+	 * @param slot     εԴϴ.
+	 * @param interpolationAlpha  ùķ̼ ܰ  ùķ̼ ܰ   Դϴ.
+	 *
+	 * @return  ġ Ѿ   ȯմϴ.
+	 *
+	 * @note Ѿ ȸ Ƿ ϰ ̵ ȯ Ե˴ϴ.
+	 */
+	Matrix4x4f GetWorldMatrix(uint32_t slot, float interpolationAlpha) const;
+
+
+	/**
+	 * @brief ִ Ѿ˵ νϽ ۿ äϴ.
+	 *
+	 * @param interpolationAlpha  ùķ̼ ܰ  ùķ̼ ܰ   Դϴ.
+	 * @param outInstanceBuffer Ѿ˵ ä νϽ Դϴ.  νϽ  ϴ.
+	 *
+	 * @note νϽ  ̸, ġ  GetWorldMatrix ̵,  а ϴ.
+	 */
+	void PackInstances(float interpolationAlpha, InstanceBuffer& outInstanceBuffer) const;
+
+
+	/**
+	 * @brief ̹ Ʈ ÷̾ 浹 Ѿ ִ Ȯմϴ.
+	 *
+	 * @return ÷̾ 浹 Ѿ ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsCollisionToPlayer() const { return bIsCollisionToPlayer_; }
+
+
+private:
+	/**
+	 * @brief Կ Ѿ ϰ 浹 忡   Ͻø մϴ.
+	 *
+	 * @param slot Ѿ   εԴϴ.
+	 * @param location Ѿ   ġԴϴ.
+	 * @param direction Ѿ Դϴ.
+	 * @param speed Ѿ ӷԴϴ.
+	 * @param radius Ѿ    Դϴ.
+	 */
+	void ActivateSlot(uint32_t slot, const Vector3f& location, const Vector3f& direction, float speed, float radius);
+
+
+private:
+	/**
+	 * @brief Ѿ x ġԴϴ.
+	 */
+	std::vector<float> positionX_;
+
+
+	/**
+	 * @brief Ѿ y ġԴϴ.
+	 */
+	std::vector<float> positionY_;
+
+
+	/**
+	 * @brief Ѿ z ġԴϴ.
+	 */
+	std::vector<float> positionZ_;
+
+
+	/**
+	 * @brief  ùķ̼ ܰ Ѿ x ġԴϴ.
+	 */
+	std::vector<float> prevPositionX_;
+
+
+	/**
+	 * @brief  ùķ̼ ܰ Ѿ y ġԴϴ.
+	 */
+	std::vector<float> prevPositionY_;
+
+
+	/**
+	 * @brief  ùķ̼ ܰ Ѿ z ġԴϴ.
+	 */
+	std::vector<float> prevPositionZ_;
+
+
+	/**
+	 * @brief Ѿ  x Դϴ.
+	 */
+	std::vector<float> directionX_;
+
+
+	/**
+	 * @brief Ѿ  y Դϴ.
+	 */
+	std::vector<float> directionY_;
+
+
+	/**
+	 * @brief Ѿ  z Դϴ.
+	 */
+	std::vector<float> directionZ_;
+
+
+	/**
+	 * @brief Ѿ ӷԴϴ.
+	 */
+	std::vector<float> speeds_;
+
+
+	/**
+	 * @brief Ѿ    Դϴ.
+	 */
+	std::vector<float> radii_;
+
+
+	/**
+	 * @brief Ѿ  Դϴ.
+	 */
+	std::vector<uint8_t> alives_;
+
+
+	/**
+	 * @brief Ѿ 浹  ϽԴϴ.
+	 */
+	std::vector<uint32_t> proxies_;
+
+
+	/**
+	 * @brief ̹ Ʈ Ѿ˰ 浹 Ʈ 浹 ̾ ƮԴϴ.
+	 */
+	std::vector<uint32_t> collisionLayers_;
+
+
+	/**
+	 * @brief ̹ Ʈ 浹 Ѿ  ε Դϴ.
+	 */
+	std::vector<uint32_t> collisionSlots_;
+
+
+	/**
+	 * @brief    ε Դϴ.
+	 */
+	std::vector<uint32_t> freeSlots_;
+
+
+	/**
+	 * @brief ִ Ѿ Դϴ.
+	 */
+	uint32_t countOfAlive_ = 0;
+
+
+	/**
+	 * @brief ̹ Ʈ ÷̾ 浹 Ѿ ִ Ȯմϴ.
+	 */
+	bool bIsCollisionToPlayer_ = false;
+
+
+	/**
+	 * @brief Ѿ   ϵ 浹 Դϴ.
+	 */
+	CollisionWorld* collisionWorld_ = nullptr;
+
+
+	/**
+	 * @brief Ѿ˰ 浹 ó ÷̾ ڵԴϴ.
+	 */
+	ObjectHandle playerHandle_;
+};
\ No newline at end of file
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <json/json.h>
+
+#include "IResource.h"
+#include "RandomStream.h"
+#include "Vector2.h"
+#include "Vector3.h"
+
+
+/**
+ * @brief Json  Ѿ  ź Ʈڵ  ҽԴϴ.
+ *
+ * @note
+ * -  ܰ(step) ̸,  ܰ (ring), (spiral), ä(fan), (aimed)   ϳԴϴ.
+ * -  ܰ  ̺(wave) ݺ  , ̺ ߻ ð Ÿ̹ Ŀ ˴ϴ.
+ * -   (Wait) ߻(Emit) ɾ 迭̸,  ɾ  ó ưϴ.
+ * - ߻  cos, sin     ̺ ̸ ϹǷ  ߿ ﰢ Լ ȣ ʽϴ.
+ * -  (degree) ̸, 0 +X , 90 +Z Դϴ.
+ *
+ * @see
+ * {
+ *   "radius": 0.2,                  // Ѿ   Դϴ. ⺻ 0.2Դϴ.
+ *   "steps": [
+ *     {
+ *       "delay": 1.5,               // ܰ踦 ϱ   ð()Դϴ. ⺻ 0Դϴ.
+ *       "shape": "ring",            // ring, spiral, fan, aimed  ϳԴϴ.
+ *       "count": 24,                //  ̺꿡 ߻ Ѿ Դϴ.
+ *       "angle": 0.0,               // /  , ä ߽ ,    ȸ Դϴ.
+ *       "spread": 60.0,             // äð   ü  Դϴ.
+ *       "speed": [2.0, 5.0],        // Ѿ ӷԴϴ. 迭̶    մϴ.
+ *       "waves": 8,                 // ̺ ݺ ȽԴϴ. ⺻ 1Դϴ.
+ *       "duration": 2.0,            // ù ̺  ̺ ð()Դϴ.
+ *       "curve": "easeIn",          // ̺ ߻ ð Ÿ̹ ĿԴϴ. linear, easeIn, easeOut, easeInOut  ϳԴϴ.
+ *       "turn": 15.0                // ̺긶 ȸ Դϴ.  ⺻ 15,  ܿ 0Դϴ.
+ *     }
+ *   ]
+ * }
+ */
+class BulletPattern : public IResource
+{
+public:
+	/**
+	 * @brief Ѿ  Ʈڵ ɾ Դϴ.
+	 */
+	enum class EOpCode : uint8_t
+	{
+		Wait = 0x00,
+		Emit = 0x01,
+	};
+
+
+	/**
+	 * @brief Ѿ  Ʈڵ ɾԴϴ.
+	 *
+	 * @note  ɾ seconds ϰ, ߻ ɾ  ʵ常 մϴ.
+	 */
+	struct Instruction
+	{
+		EOpCode opCode;            // ɾ Դϴ.
+		bool bIsAimed;             // ߻     ȸϴ Ȯմϴ.
+		uint16_t count;            // ߻ Ѿ Դϴ.
+		uint32_t directionOffset;  //  ̺  ɾ ϴ ù  ġԴϴ.
+		float seconds;             //  ð()Դϴ.
+		float minSpeed;            // Ѿ ӷ ּڰԴϴ.
+		float maxSpeed;            // Ѿ ӷ ִԴϴ. ּڰ ٸ   ʽϴ.
+	};
+
+
+	/**
+	 * @brief Ѿ   ġԴϴ.
+	 *
+	 * @note    Ѿ Ⱑ ϹǷ  ġ Ѿ ⸶  ϴ.
+	 */
+	struct Cursor
+	{
+		uint32_t instruction = 0;  //   ɾ ġԴϴ.
+		float elapsedTime = 0.0f;  //   ɾ  ð()Դϴ.
+	};
+
+
+	/**
+	 * @brief ߻ Ѿ   Դϴ.
+	 */
+	struct Emission
+	{
+		Vector3f location;  // Ѿ   ġԴϴ.
+		Vector3f direction; // Ѿ ̵ Դϴ.
+		float speed;        // Ѿ ӷԴϴ.
+	};
+
+
+public:
+	/**
+	 * @brief Ѿ  Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	BulletPattern() = default;
+
+
+	/**
+	 * @brief Ѿ   ҸԴϴ.
+	 */
+	virtual ~BulletPattern();
+
+
+	/**
+	 * @brief Ѿ   ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(BulletPattern);
+
+
+	/**
+	 * @brief Json ü Ѿ  Ʈڵ մϴ.
+	 *
+	 * @param root Ѿ   Json üԴϴ.
+	 *
+	 * @note Ͽ 0ʺ  Ⱑ ϳ ̻ ־ մϴ.
+	 */
+	void Initialize(const Json::Value& root);
+
+
+	/**
+	 * @brief Ѿ   ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief Ѿ  ϰ, ̹ Ʈ ߻ Ѿ  ڿ ߰մϴ.
+	 *
+	 * @param cursor Ѿ   ġԴϴ.
+	 * @param deltaSeconds Ÿ ð Դϴ.
+	 * @param origin Ѿ ߻Ǵ   ġԴϴ.
+	 * @param target   ܳ   ġԴϴ.
+	 * @param randomStream Ѿ ӷ     ƮԴϴ.
+	 * @param outEmissions ߻ Ѿ ߰ Դϴ.
+	 */
+	void Execute(Cursor& cursor, float deltaSeconds, const Vector3f& origin, const Vector3f& target, RandomStream& randomStream, std::vector<Emission>& outEmissions) const;
+
+
+	/**
+	 * @brief  ġ   ɾ 󸶳 Ǿ ϴ.
+	 *
+	 * @param cursor Ѿ   ġԴϴ.
+	 *
+	 * @return    ȯմϴ.  0.0 ~ 1.0Դϴ.
+	 */
+	float GetWaitRate(const Cursor& cursor) const;
+
+
+	/**
+	 * @brief Ѿ    ϴ.
+	 *
+	 * @return Ѿ    ȯմϴ.
+	 */
+	float GetRadius() const { return radius_; }
+
+
+	/**
+	 * @brief   ֱ  ߻ϴ Ѿ  ϴ.
+	 *
+	 * @return   ֱ  ߻ϴ Ѿ  ȯմϴ.
+	 */
+	uint32_t GetCountOfEmissionPerCycle() const { return countOfEmissionPerCycle_; }
+
+
+	/**
+	 * @brief ϵ Ʈڵ带 ϴ.
+	 *
+	 * @return ϵ Ʈڵ  ڸ ȯմϴ.
+	 */
+	const std::vector<Instruction>& GetInstructions() const { return instructions_; }
+
+
+private:
+	/**
+	 * @brief Json ü  ܰ踦 Ʈڵ մϴ.
+	 *
+	 * @param step  ܰ Json üԴϴ.
+	 */
+	void CompileStep(const Json::Value& step);
+
+
+	/**
+	 * @brief  ɾ ߰մϴ.
+	 *
+	 * @param seconds  ð()Դϴ. 0 ϶ ɾ ߰ ʽϴ.
+	 */
+	void AddWait(float seconds);
+
+
+private:
+	/**
+	 * @brief Ѿ   Դϴ.
+	 */
+	float radius_ = 0.0f;
+
+
+	/**
+	 * @brief   ֱ  ߻ϴ Ѿ Դϴ.
+	 */
+	uint32_t countOfEmissionPerCycle_ = 0;
+
+
+	/**
+	 * @brief ϵ ƮڵԴϴ.
+	 */
+	std::vector<Instruction> instructions_;
+
+
+	/**
+	 * @brief ߻  (cos, sin) ̺Դϴ.
+	 */
+	std::vector<Vector2f> directions_;
+};
\ No newline at end of file
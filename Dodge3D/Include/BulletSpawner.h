@@ -1,7 +1,11 @@
 #pragma once
 
-#include <functional>
+#include <vector>
 
+#include "ObjectHandle.h"
+#include "RandomStream.h"
+
+#include "BulletPattern.h"
 #include "GameObject.h"
 
 class Camera3D;
@@ -37,16 +41,20 @@ public:
 	 * @brief ÷̾ ؾ  Ѿ ϴ Ʈ ʱȭմϴ.
 	 * 
 	 * @param location ÷̾ ؾ  Ѿ ϴ Ʈ   ġԴϴ. 
-	 * @param respawnTime Ѿ ϴ ð ֱԴϴ.
-	 * @param respawnTrigger Ѿ  ̺ƮԴϴ.
+	 * @param pattern Ѿ ߻ϴ Դϴ.
+	 * @param randomStream Ѿ ӷ ϴ  ƮԴϴ.
+	 *
+	 * @note  Ʈ ùķ̼ ϸ, Ѿ ⺸  Ǿ մϴ.
 	 */
-	void Initialize(const Vector3f& location, float respawnTime, const std::function<void()>& respawnTrigger);
+	void Initialize(const Vector3f& location, const BulletPattern* pattern, RandomStream* randomStream);
 
 
 	/**
 	 * @brief ÷̾ ؾ  Ѿ ϴ Ʈ Ʈմϴ.
 	 * 
 	 * @param deltaSeconds Ÿ ð Դϴ.
+	 *
+	 * @note ̹ Ʈ ߻ Ѿ˵ GetEmissions   ֽϴ.
 	 */
 	virtual void Tick(float deltaSeconds) override;
 
@@ -65,25 +73,61 @@ public:
 	virtual const IShape3D* GetBoundingVolume() const override { return nullptr; }
 
 
+	/**
+	 * @brief Ѿ ߻ϴ  ϴ.
+	 *
+	 * @return Ѿ ߻ϴ  ͸ ȯմϴ.
+	 */
+	const BulletPattern* GetPattern() const { return pattern_; }
+
+
+	/**
+	 * @brief  Ʈ ߻ Ѿ˵ ϴ.
+	 *
+	 * @return  Ʈ ߻ Ѿ   ڸ ȯմϴ.
+	 */
+	const std::vector<BulletPattern::Emission>& GetEmissions() const { return emissions_; }
+
+
+#if !defined(HEADLESS_MODE)
 	/**
 	 * @brief ÷̾ ؾ  Ѿ ϴ Ʈ  ð ׸ϴ.
 	 * 
 	 * @param camera 3D ī޶Դϴ.
 	 */
 	void RenderRespawnTime(const Camera3D* camera);
+#endif
 
 
 private:
 	/**
-	 * @brief ÷̾ ؾ  Ѿ ϴ Ʈ  ðԴϴ.
+	 * @brief Ѿ ߻ϴ Դϴ.
 	 */
-	float stepTime_ = 0.0f;
+	const BulletPattern* pattern_ = nullptr;
 
 
 	/**
-	 * @brief Ѿ ϴ ð ֱԴϴ.
+	 * @brief Ѿ ߻ϴ   ġԴϴ.
 	 */
-	float respawnTime_ = 0.0f;
+	BulletPattern::Cursor cursor_;
+
+
+	/**
+	 * @brief Ѿ ӷ ϴ  ƮԴϴ.
+	 */
+	RandomStream* randomStream_ = nullptr;
+
+
+	/**
+	 * @brief   Ѿ ܳ ÷̾ ڵԴϴ.
+	 */
+	ObjectHandle playerHandle_;
+
+
+	/**
+	 * @brief  Ʈ ߻ Ѿ˵Դϴ.
+	 */
+	std::vector<BulletPattern::Emission> emissions_;
 
 
 	/**
@@ -108,10 +152,4 @@ private:
 	 * @brief Ѿ ϴ   Դϴ.
 	 */
 	Vector4f subColor_;
-
-
-	/**
-	 * @brief Ѿ  ̺ƮԴϴ.
-	 */
-	std::function<void()> respawnTrigger_ = nullptr;
 };
\ No newline at end of file
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "EntityComponents.h"
+#include "EntityWorld.h"
+#include "Macro.h"
+#include "RandomStream.h"
+#include "Vector3.h"
+
+#include "BulletPattern.h"
+#include "PlaySimulation.h"
+
+class CollisionWorld;
+class Player;
+
+
+/**
+ * @brief ƼƼ   ϴ  ÷  ùķ̼Դϴ.
+ *
+ * @note
+ * - PlaySimulation  Ģ , , Ѿ , Ѿ ŰŸ  ƼƼ մϴ.
+ * - ÷̾ Է ޴  Ʈ̹Ƿ  Player Ʈ ״ մϴ.
+ * -  õ  Է ־ PlaySimulation   ϴ.
+ * - 浹 , ÷̾, ƼƼ  Ʈ Ŵ ϵǸ, Release ȣ  Ʈ Ŵ ˴ϴ.
+ */
+class EntityPlaySimulation
+{
+public:
+	/**
+	 * @brief ƼƼ   ÷  ùķ̼ ⺻ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	EntityPlaySimulation() = default;
+
+
+	/**
+	 * @brief ƼƼ   ÷  ùķ̼  ҸԴϴ.
+	 *
+	 * @note  Ʈ Ʈ Ŵ ϹǷ Ҹڿ  ʽϴ.
+	 */
+	virtual ~EntityPlaySimulation() {}
+
+
+	/**
+	 * @brief ƼƼ   ÷  ùķ̼  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(EntityPlaySimulation);
+
+
+	/**
+	 * @brief ƼƼ   ÷  ùķ̼ ʱȭմϴ.
+	 *
+	 * @param bulletSpawnerParams Ѿ  ġ Դϴ.
+	 * @param bulletCapacity Ѿ ŰŸԿ ̸ Ȯ ƼƼ Դϴ.
+	 * @param randomSeed ùķ̼  Ʈ õԴϴ.
+	 */
+	void Initialize(const std::vector<PlaySimulation::BulletSpawnerParam>& bulletSpawnerParams, uint32_t bulletCapacity, uint64_t randomSeed);
+
+
+	/**
+	 * @brief ƼƼ   ÷  ùķ̼    ܰ մϴ.
+	 *
+	 * @param fixedDeltaSeconds   Ÿ ðԴϴ.
+	 */
+	void Tick(float fixedDeltaSeconds);
+
+
+	/**
+	 * @brief ƼƼ   ÷  ùķ̼ Ʈ Ʈ Ŵ մϴ.
+	 */
+	void Release();
+
+
+	/**
+	 * @brief ÷̾ Ѿ  ġ  ùķ̼ ܰ ġ մϴ.
+	 */
+	void RecordPrevState();
+
+
+	/**
+	 * @brief ƼƼ   ÷  ùķ̼ ʱȭ  ִ Ȯմϴ.
+	 *
+	 * @return ʱȭ  ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsInitialized() const { return bIsInitialized_; }
+
+
+	/**
+	 * @brief  ܰ迡 ÷̾ Ѿ 浹ߴ Ȯմϴ.
+	 *
+	 * @return ÷̾ 浹 Ѿ ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsCollisionToPlayer() const { return bIsCollisionToPlayer_; }
+
+
+	/**
+	 * @brief ִ Ѿ  ϴ.
+	 *
+	 * @return ִ Ѿ  ȯմϴ.
+	 */
+	uint32_t GetCountOfBullet() const;
+
+
+	/**
+	 * @brief ÷̾   Ʈ ϴ.
+	 *
+	 * @return ÷̾   Ʈ ͸ ȯմϴ.
+	 */
+	Player* GetPlayer() const { return player_; }
+
+
+	/**
+	 * @brief , Ѿ , Ѿ ƼƼ ϴ ƼƼ 带 ϴ.
+	 *
+	 * @return ƼƼ  ͸ ȯմϴ.
+	 */
+	EntityWorld* GetEntityWorld() const { return entityWorld_; }
+
+
+private:
+	/**
+	 * @brief Ѿ ƼƼ ϰ 浹 忡 մϴ.
+	 *
+	 * @param emission Ѿ  ߻ Ѿ Դϴ.
+	 * @param radius Ѿ   Դϴ.
+	 */
+	void SpawnBullet(const BulletPattern::Emission& emission, float radius);
+
+
+	/**
+	 * @brief 浹 尡 ã Ѿ 浹 óմϴ.
+	 *
+	 * @note 浹 Ѿ 浹 忡 ϰ  ûմϴ.
+	 */
+	void ResolveCollision();
+
+
+private:
+	/**
+	 * @brief ƼƼ   ÷  ùķ̼ ʱȭǾ Ȯմϴ.
+	 */
+	bool bIsInitialized_ = false;
+
+
+	/**
+	 * @brief  ܰ迡 ÷̾ 浹 Ѿ ִ Ȯմϴ.
+	 */
+	bool bIsCollisionToPlayer_ = false;
+
+
+	/**
+	 * @brief Ѿ ӷ ϴ  ƮԴϴ.
+	 */
+	RandomStream bulletRandomStream_;
+
+
+	/**
+	 * @brief   Ʈ 浹 ˻ϴ 浹 Դϴ.
+	 */
+	CollisionWorld* collisionWorld_ = nullptr;
+
+
+	/**
+	 * @brief ÷̾   ƮԴϴ.
+	 */
+	Player* player_ = nullptr;
+
+
+	/**
+	 * @brief , Ѿ , Ѿ ƼƼ ϴ ƼƼ Դϴ.
+	 */
+	EntityWorld* entityWorld_ = nullptr;
+
+
+	/**
+	 * @brief ̹ ܰ迡 Ѿ  ߻ Ѿ˵Դϴ.
+	 *
+	 * @note ȸ ߿ ƼƼ   Ƿ ߻  Ƶξٰ ȸ   մϴ.
+	 */
+	std::vector<BulletPattern::Emission> emissions_;
+
+
+	/**
+	 * @brief ̹ ܰ迡 ߻ Ѿ˵   Դϴ. ߻    ˴ϴ.
+	 */
+	std::vector<float> emissionRadii_;
+
+
+	/**
+	 * @brief ̹ ܰ迡 浹 Ѿ ƼƼԴϴ. ó 浹  ˴ϴ.
+	 */
+	std::vector<EntityHandle> collisionBullets_;
+
+
+	/**
+	 * @brief Ѿ ƼƼ ׸  ϴ ҽ Դϴ.
+	 */
+	EntityComponents::RenderRef bulletRenderRef_;
+};
\ No newline at end of file
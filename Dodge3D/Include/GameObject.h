@@ -7,6 +7,17 @@
 #include "Transform.h"
 
 
+/**
+ * @brief 浹 忡 ϵǴ  Ʈ 浹 ̾Դϴ.
+ */
+enum class ECollisionLayer : uint32_t
+{
+	Wall   = 0x01, //  ̾Դϴ.
+	Player = 0x02, // ÷̾ ̾Դϴ.
+	Bullet = 0x04, // Ѿ ̾Դϴ.
+};
+
+
 /**
  * @brief  ƮԴϴ.
  */
@@ -55,6 +66,24 @@ public:
 	const Transform& GetTransform() const { return transform_; }
 
 
+	/**
+	 * @brief  ùķ̼ ܰ Ʈ մϴ.
+	 *
+	 * @note   ùķ̼ ܰ踦 ϱ  ȣؾ մϴ.
+	 */
+	void RecordPrevTransform() { prevTransform_ = transform_; }
+
+
+	/**
+	 * @brief  ùķ̼ ܰ  ùķ̼ ܰ ̸  Ʈ ϴ.
+	 *
+	 * @param interpolationAlpha  Դϴ.
+	 *
+	 * @return  Ʈ ȯմϴ.
+	 */
+	Transform GetInterpolatedTransform(float interpolationAlpha) const { return Transform::Interpolate(prevTransform_, transform_, interpolationAlpha); }
+
+
 	/**
 	 * @brief  Ʈ   ϴ.
 	 * 
@@ -90,4 +119,10 @@ protected:
 	 * @brief  Ʈ ƮԴϴ.
 	 */
 	Transform transform_;
+
+
+	/**
+	 * @brief  ùķ̼ ܰ迡   Ʈ ƮԴϴ.
+	 */
+	Transform prevTransform_;
 };
\ No newline at end of file
@@ -1,33 +1,31 @@
 #pragma once
 
-#include <array>
-#include <list>
 #include <functional>
+#include <vector>
 
 #include "Framebuffer.h"
 #include "GameObject.h"
+#include "InstanceBuffer.h"
 #include "IScene.h"
 #include "PostEffectShader.h"
+#include "RenderQueue.h"
 #include "LightShader.h"
+#include "MeshBuffer.h"
+#include "OpenGLRenderBackend.h"
 #include "UIMouseButton.h"
 #include "UIKeyButton.h"
 #include "Sound.h"
 #include "Skybox.h"
 #include "ShadowMap.h"
 #include "ShadowShader.h"
+#include "UniformBuffer.h"
 
-#include "Bullet.h"
-#include "BulletSpawner.h"
-#include "EastWall.h"
 #include "Floor.h"
 #include "MovableCamera.h"
-#include "NorthWall.h"
-#include "Player.h"
 #include "PlayLogger.h"
-#include "SouthWall.h"
+#include "PlaySimulation.h"
 #include "StaticLight.h"
 #include "UIBoard.h"
-#include "WestWall.h"
 
 
 /**
@@ -75,6 +73,14 @@ public:
 	virtual void Tick(float deltaSeconds) override;
 
 
+	/**
+	 * @brief  ÷  ùķ̼    ܰ մϴ.
+	 *
+	 * @param fixedDeltaSeconds   Ÿ ðԴϴ.
+	 */
+	virtual void FixedTick(float fixedDeltaSeconds) override;
+
+
 	/**
 	 * @brief  ÷  մϴ.
 	 */
@@ -125,7 +131,24 @@ private:
 
 
 	/**
-	 * @brief   Ʈ Ʈմϴ.
+	 * @brief ٴڰ  Ƽ󺰷 ģ  ġ ޽ÿ Ѿ  ޽ø ް  ϳ Ҵմϴ.
+	 *
+	 * @note
+	 * - ٴڰ  ʱȭ   Ƿ,   ķ  ̸ ȯؼ Ĩϴ.
+	 * -  ġ  ޽ð  迭 Ʈ ϳ ϹǷ,  н   迭 Ʈ   εմϴ.
+	 * - ް ۴ Ҵ ޽  ε       ϴ.
+	 */
+	void BuildMeshBuffer();
+
+
+	/**
+	 * @brief   Ʈ  ¸  ùķ̼ ܰ · մϴ.
+	 */
+	void RecordPrevState();
+
+
+	/**
+	 * @brief   UI Ʈ Ʈմϴ.
 	 * 
 	 * @param deltaSeconds Ÿ ðԴϴ.
 	 */
@@ -148,6 +171,14 @@ private:
 	void UpdatePlayStateScene(float deltaSeconds);
 
 
+	/**
+	 * @brief ÷   ùķ̼  ܰ մϴ.
+	 *
+	 * @param fixedDeltaSeconds   Ÿ ðԴϴ.
+	 */
+	void SimulatePlayStateScene(float fixedDeltaSeconds);
+
+
 	/**
 	 * @brief     Ʈմϴ.
 	 *
@@ -164,6 +195,17 @@ private:
 	void UpdateDoneStateScene(float deltaSeconds);
 
 
+	/**
+	 * @brief   Ʈ ִ Ѿ ׸   ť ߰մϴ.
+	 *
+	 * @note
+	 * - Ʈ      ؼ ε н  н Բ մϴ.
+	 * - ٴڰ   ġ ޽÷ Ƽ󸶴   ׸ϴ.
+	 * - Ѿ νϽ  ϳ Ƽ н   ׸ ȣ ׸ϴ.
+	 */
+	void CollectDrawPackets();
+
+
 	/**
 	 * @brief   մϴ.
 	 */
@@ -207,6 +249,12 @@ private:
 	Sound* buttonClick_ = nullptr;
 
 
+	/**
+	 * @brief ÷̾ Ѿ˰ 浹   Դϴ.
+	 */
+	Sound* hitSound_ = nullptr;
+
+
 	/**
 	 * @brief        ؽóԴϴ.
 	 */
@@ -232,135 +280,147 @@ private:
 
 
 	/**
-	 * @brief       ϴ ̴Դϴ.
+	 * @brief Ѿ ʵ尡 ̸ Ҵ Ѿ Դϴ. Ѿ νϽ ۵  ũ մϴ.
 	 */
-	ShadowShader* shadowShader_ = nullptr;
+	const uint32_t BULLET_CAPACITY = 1024;
 
 
 	/**
-	 * @brief      ȿ ϴ ̴Դϴ.
+	 * @brief ִ Ѿ˵ ġ   νϽ Դϴ.
 	 */
-	LightShader* lightShader_ = nullptr;
+	InstanceBuffer* bulletInstanceBuffer_ = nullptr;
 
 
 	/**
-	 * @brief ó ȿ ϱ  ׷  ̴Դϴ.
+	 * @brief ī޶ Ʈ Ӹ     Դϴ.
 	 */
-	PostEffectShader* grayscaleEffectShader_ = nullptr;
+	UniformBuffer* frameUniformBuffer_ = nullptr;
+
 
-	
 	/**
-	 * @brief ó ȿ ϱ  ̵ ȿ ̴Դϴ.
+	 * @brief Ƽ  ۰  Ƽ Դϴ.  ӿ ϴ Ƽ  Ŀ ٽ  ʽϴ.
 	 */
-	PostEffectShader* fadeEffectShader_ = nullptr;
+	const uint32_t MATERIAL_BLOCK_CAPACITY = 64;
 
 
 	/**
-	 * @brief ó ȿ ϱ  þ  ̴Դϴ.
+	 * @brief  鿣尡 Ƽ   Դϴ.
 	 */
-	PostEffectShader* blurEffectShader_ = nullptr;
+	UniformBuffer* materialUniformBuffer_ = nullptr;
 
 
 	/**
-	 * @brief ÷̾ ϴ Ʈ ٴϴ ī޶Դϴ.
+	 * @brief       ϴ ̴Դϴ.
 	 */
-	MovableCamera* camera_ = nullptr;
+	ShadowShader* shadowShader_ = nullptr;
 
 
 	/**
-	 * @brief    ƮԴϴ.
+	 * @brief Ѿ˵     ϴ νϽ ̴Դϴ.
 	 */
-	StaticLight* light_ = nullptr;
+	ShadowShader* shadowInstancedShader_ = nullptr;
 
 
 	/**
-	 * @brief ÷̾   ƮԴϴ.
+	 * @brief      ȿ ϴ ̴Դϴ.
 	 */
-	Player* player_ = nullptr;
+	LightShader* lightShader_ = nullptr;
 
 
 	/**
-	 * @brief ÷̾ ÷  ϴ ƮԴϴ.
+	 * @brief Ѿ˵鿡  ȿ ؼ   ׸ νϽ ̴Դϴ.
 	 */
-	PlayLogger* playLogger_ = nullptr;
+	LightShader* lightInstancedShader_ = nullptr;
 
 
 	/**
-	 * @brief ٴ ƮԴϴ.
+	 * @brief ó ȿ ϱ  ׷  ̴Դϴ.
 	 */
-	Floor* floor_ = nullptr;
+	PostEffectShader* grayscaleEffectShader_ = nullptr;
+
+	
+	/**
+	 * @brief ó ȿ ϱ  ̵ ȿ ̴Դϴ.
+	 */
+	PostEffectShader* fadeEffectShader_ = nullptr;
 
 
 	/**
-	 * @brief ÷̾ ٶ󺸴    Դϴ.
+	 * @brief ó ȿ ϱ  þ  ̴Դϴ.
 	 */
-	NorthWall* northWall_ = nullptr;
+	PostEffectShader* blurEffectShader_ = nullptr;
+
 
-	
 	/**
-	 * @brief ÷̾ ٶ󺸴    Դϴ.
+	 * @brief ÷̾ ϴ Ʈ ٴϴ ī޶Դϴ.
 	 */
-	SouthWall* southWall_ = nullptr;
+	MovableCamera* camera_ = nullptr;
 
 
 	/**
-	 * @brief ÷̾ ٶ󺸴    Դϴ.
+	 * @brief    ƮԴϴ.
 	 */
-	WestWall* westWall_ = nullptr;
+	StaticLight* light_ = nullptr;
 
 
 	/**
-	 * @brief ÷̾ ٶ󺸴    Դϴ.
+	 * @brief ÷̾ ÷  ϴ ƮԴϴ.
 	 */
-	EastWall* eastWall_ = nullptr;
+	PlayLogger* playLogger_ = nullptr;
+
+
+	/**
+	 * @brief ٴ ƮԴϴ.
+	 */
+	Floor* floor_ = nullptr;
 
 
 	/**
-	 * @brief ÷̾ ؾ  Ѿ ϴ ƮԴϴ.
+	 * @brief     ƮԴϴ.  ġ ģ ٴڰ   ʽϴ.
 	 */
-	BulletSpawner* bulletSpawner0_ = nullptr;
+	std::vector<GameObject*> renderObjects_;
 
 
 	/**
-	 * @brief ÷̾ ؾ  Ѿ ϴ ƮԴϴ.
+	 * @brief  ġ ޽ÿ Ѿ  ޽ø Ҵ ް Դϴ.
 	 */
-	BulletSpawner* bulletSpawner1_ = nullptr;
+	MeshBuffer* meshBuffer_ = nullptr;
 
 
 	/**
-	 * @brief ÷̾ ؾ  Ѿ ϴ ƮԴϴ.
+	 * @brief ٴڰ  Ƽ󺰷 ģ  ġ ޽ ް  Դϴ.
 	 */
-	BulletSpawner* bulletSpawner2_ = nullptr;
+	std::vector<MeshBuffer::Allocation> staticBatchAllocations_;
 
 
 	/**
-	 * @brief ÷̾ ؾ  Ѿ ϴ ƮԴϴ.
+	 * @brief  ġ ޽ÿ   ƼԴϴ.
 	 */
-	BulletSpawner* bulletSpawner3_ = nullptr;
+	std::vector<const Material*> staticBatchMaterials_;
 
 
 	/**
-	 * @brief     ƮԴϴ.
+	 * @brief Ѿ  ޽ ް  Դϴ.
 	 */
-	std::array<GameObject*, 10> renderObjects_;
+	MeshBuffer::Allocation bulletAllocation_;
 
 
 	/**
-	 * @brief   Ѿ ƮԴϴ.
+	 * @brief ε н  н ׸  ؼ ϴ  ťԴϴ.
 	 */
-	std::list<Bullet*> bullets_;
+	RenderQueue renderQueue_;
 
 
 	/**
-	 * @brief    Ѿ Ʈ Դϴ.
+	 * @brief  ť ׸  ϴ OpenGL  鿣Դϴ.
 	 */
-	uint32_t countOfbullet_ = 0;
+	OpenGLRenderBackend renderBackend_;
 
 
 	/**
-	 * @brief Ѿ  ̺ƮԴϴ.
+	 * @brief ÷̾, , Ѿ , Ѿ ϴ  ÷  ùķ̼Դϴ.
 	 */
-	std::function<bool(Bullet*)> bulletRemoveEvent_;
+	PlaySimulation simulation_;
 
 
 	/**
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Camera3D.h"
+#include "ObjectHandle.h"
 
 
 /**
@@ -45,6 +46,14 @@ public:
 	virtual void Tick(float deltaSeconds) override;
 
 
+	/**
+	 * @brief  ÷̾ ġ  ī޶ ̵մϴ.
+	 *
+	 * @param interpolationAlpha  ùķ̼ ܰ  ùķ̼ ܰ   Դϴ.
+	 */
+	void FollowPlayer(float interpolationAlpha);
+
+
 	/**
 	 * @brief ÷̾  ̴ ī޶ Ʈ  ҽ Ҵ մϴ.
 	 */
@@ -56,4 +65,10 @@ private:
 	 * @brief ÷̾ ġκ ī޶  ġԴϴ.
 	 */
 	Vector3f relativePosition_;
+
+
+	/**
+	 * @brief ī޶ 󰡴 ÷̾ ڵԴϴ.
+	 */
+	ObjectHandle playerHandle_;
 };
\ No newline at end of file
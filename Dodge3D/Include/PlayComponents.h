@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Vector3.h"
+
+#include "BulletPattern.h"
+
+
+/**
+ * @brief ƼƼ  ű  ÷ ùķ̼(EntityPlaySimulation) ϴ ƮԴϴ.
+ */
+namespace PlayComponents
+{
+	/**
+	 * @brief Ѿ ̵ Դϴ.
+	 */
+	struct BulletMotion
+	{
+		Vector3f direction;   // Ѿ ̵ Դϴ.
+		float speed = 0.0f;   // Ѿ ̵ ӷԴϴ.
+	};
+
+
+	/**
+	 * @brief Ѿ Ⱑ ϴ Ѿ  Դϴ.
+	 */
+	struct PatternCursor
+	{
+		const BulletPattern* pattern = nullptr;  // Ѿ Ⱑ  Ѿ Դϴ.
+		BulletPattern::Cursor cursor;            // Ѿ   ġԴϴ.
+	};
+
+
+	/**
+	 * @brief 浹 忡 ϵ Ͻ Դϴ.
+	 */
+	struct CollisionProxy
+	{
+		uint32_t proxy = 0;       // 浹   Ͻ ȣԴϴ.
+		uint32_t hitLayers = 0;   // ̹ Ʈ 浹  ̾ Ʈ ũԴϴ.
+	};
+}
\ No newline at end of file
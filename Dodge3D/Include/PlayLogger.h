@@ -1,9 +1,11 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "IObject.h"
+#include "TextLayout.h"
 #include "Vector2.h"
 #include "Vector3.h"
 #include "Vector4.h"
@@ -184,4 +186,18 @@ private:
 	 * @brief ȭ鿡 ǥ ִ α Դϴ.
 	 */
 	int32_t maxLogCount_ = 0;
+
+
+	/**
+	 * @brief ũ ŸƲ ؽƮ ̾ƿԴϴ.
+	 */
+	TextLayout rankLayout_;
+
+
+	/**
+	 * @brief ȭ鿡 ǥ α ؽƮ ̾ƿԴϴ.
+	 *
+	 * @note αװ ٲ  ۸  ٽ  ʽϴ.
+	 */
+	std::vector<std::unique_ptr<TextLayout>> logLayouts_;
 };
\ No newline at end of file
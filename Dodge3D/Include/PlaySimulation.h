@@ -0,0 +1,254 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Macro.h"
+#include "RandomStream.h"
+#include "Vector3.h"
+
+class BulletField;
+class BulletPattern;
+class BulletSpawner;
+class CollisionWorld;
+class EastWall;
+class GameObject;
+class NorthWall;
+class Player;
+class SouthWall;
+class WestWall;
+
+
+/**
+ * @brief  ÷  ùķ̼Դϴ.
+ *
+ * @note
+ * - ÷̾, , Ѿ , Ѿ ʵ, 浹 带 ϰ    ܰ辿 մϴ.
+ * - , , 忡  Ƿ  ÷  帮 ġũ Բ մϴ.
+ * -  Ʈ Ʈ Ŵ ϵǸ, Release ȣ  Ʈ Ŵ ˴ϴ.
+ */
+class PlaySimulation
+{
+public:
+	/**
+	 * @brief Ѿ  ġ Դϴ.
+	 */
+	struct BulletSpawnerParam
+	{
+		Vector3f location;             // Ѿ    ġԴϴ.
+		const BulletPattern* pattern;  // Ѿ Ⱑ  Ѿ Դϴ.
+	};
+
+
+public:
+	/**
+	 * @brief  ÷  ùķ̼ ⺻ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	PlaySimulation() = default;
+
+
+	/**
+	 * @brief  ÷  ùķ̼  ҸԴϴ.
+	 *
+	 * @note  Ʈ Ʈ Ŵ ϹǷ Ҹڿ  ʽϴ.
+	 */
+	virtual ~PlaySimulation() {}
+
+
+	/**
+	 * @brief  ÷  ùķ̼  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(PlaySimulation);
+
+
+	/**
+	 * @brief  ÷  ùķ̼ ʱȭմϴ.
+	 *
+	 * @param bulletSpawnerParams Ѿ  ġ Դϴ.
+	 * @param bulletCapacity Ѿ ʵ忡 ̸ Ȯ Ѿ  Դϴ.
+	 * @param randomSeed ùķ̼  Ʈ õԴϴ.
+	 *
+	 * @note  õ  Է ־ ùķ̼ ׻   ϴ.
+	 */
+	void Initialize(const std::vector<BulletSpawnerParam>& bulletSpawnerParams, uint32_t bulletCapacity, uint64_t randomSeed);
+
+
+	/**
+	 * @brief  ÷  ùķ̼    ܰ մϴ.
+	 *
+	 * @param fixedDeltaSeconds   Ÿ ðԴϴ.
+	 */
+	void Tick(float fixedDeltaSeconds);
+
+
+	/**
+	 * @brief  ÷  ùķ̼ Ʈ Ʈ Ŵ մϴ.
+	 */
+	void Release();
+
+
+	/**
+	 * @brief ùķ̼ Ʈ  ¸  ùķ̼ ܰ · մϴ.
+	 */
+	void RecordPrevState();
+
+
+	/**
+	 * @brief  ÷  ùķ̼ ʱȭ  ִ Ȯմϴ.
+	 *
+	 * @return ʱȭ  ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsInitialized() const { return bIsInitialized_; }
+
+
+	/**
+	 * @brief  ܰ迡 ÷̾ Ѿ 浹ߴ Ȯմϴ.
+	 *
+	 * @return ÷̾ 浹 Ѿ ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsCollisionToPlayer() const;
+
+
+	/**
+	 * @brief ִ Ѿ  ϴ.
+	 *
+	 * @return ִ Ѿ  ȯմϴ.
+	 */
+	uint32_t GetCountOfBullet() const;
+
+
+	/**
+	 * @brief ÷̾   Ʈ ϴ.
+	 *
+	 * @return ÷̾   Ʈ ͸ ȯմϴ.
+	 */
+	Player* GetPlayer() const { return player_; }
+
+
+	/**
+	 * @brief Ѿ˵ ϴ Ʈ ϴ.
+	 *
+	 * @return Ѿ˵ ϴ Ʈ ͸ ȯմϴ.
+	 */
+	BulletField* GetBulletField() const { return bulletField_; }
+
+
+	/**
+	 * @brief Ѿ   ϴ.
+	 *
+	 * @return Ѿ    ڸ ȯմϴ.
+	 */
+	const std::vector<BulletSpawner*>& GetBulletSpawners() const { return bulletSpawners_; }
+
+
+	/**
+	 * @brief ޽ø  ùķ̼ Ʈ  ϴ.
+	 *
+	 * @return , Ѿ , ÷̾  Ʈ  ȯմϴ.
+	 */
+	const std::vector<GameObject*>& GetMeshObjects() const { return meshObjects_; }
+
+
+	/**
+	 * @brief ʱȭ   ʴ ޽ Ʈ  ϴ.
+	 *
+	 * @return  Ʈ  ȯմϴ.
+	 */
+	const std::vector<GameObject*>& GetStaticMeshObjects() const { return staticMeshObjects_; }
+
+
+	/**
+	 * @brief ̰ų  ġ ġ ʴ ޽ Ʈ  ϴ.
+	 *
+	 * @return Ѿ , ÷̾  Ʈ  ȯմϴ.
+	 */
+	const std::vector<GameObject*>& GetDynamicMeshObjects() const { return dynamicMeshObjects_; }
+
+
+private:
+	/**
+	 * @brief  ÷  ùķ̼ ʱȭǾ Ȯմϴ.
+	 */
+	bool bIsInitialized_ = false;
+
+
+	/**
+	 * @brief Ѿ ӷ ϴ  ƮԴϴ.
+	 */
+	RandomStream bulletRandomStream_;
+
+
+	/**
+	 * @brief   Ʈ 浹 ˻ϴ 浹 Դϴ.
+	 */
+	CollisionWorld* collisionWorld_ = nullptr;
+
+
+	/**
+	 * @brief ÷̾   ƮԴϴ.
+	 */
+	Player* player_ = nullptr;
+
+
+	/**
+	 * @brief ÷̾ ٶ󺸴    Դϴ.
+	 */
+	NorthWall* northWall_ = nullptr;
+
+
+	/**
+	 * @brief ÷̾ ٶ󺸴    Դϴ.
+	 */
+	SouthWall* southWall_ = nullptr;
+
+
+	/**
+	 * @brief ÷̾ ٶ󺸴    Դϴ.
+	 */
+	WestWall* westWall_ = nullptr;
+
+
+	/**
+	 * @brief ÷̾ ٶ󺸴    Դϴ.
+	 */
+	EastWall* eastWall_ = nullptr;
+
+
+	/**
+	 * @brief   Ѿ˵ ϴ ƮԴϴ.
+	 */
+	BulletField* bulletField_ = nullptr;
+
+
+	/**
+	 * @brief ÷̾ ؾ  Ѿ ϴ ƮԴϴ.
+	 */
+	std::vector<BulletSpawner*> bulletSpawners_;
+
+
+	/**
+	 * @brief ޽ø  ùķ̼ ƮԴϴ.
+	 */
+	std::vector<GameObject*> meshObjects_;
+
+
+	/**
+	 * @brief ʱȭ   ʴ ޽ ƮԴϴ.
+	 */
+	std::vector<GameObject*> staticMeshObjects_;
+
+
+	/**
+	 * @brief ̰ų  ġ ġ ʴ ޽ ƮԴϴ.
+	 */
+	std::vector<GameObject*> dynamicMeshObjects_;
+
+
+	/**
+	 * @brief Ʈ Ŵ  Ʈ ñ״óԴϴ.
+	 */
+	std::vector<std::string> objectSignatures_;
+};
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "Sphere3D.h"
 
 class Camera3D;
+class CollisionWorld;
 
 
 /**
@@ -84,28 +85,42 @@ public:
 	void SetHP(int32_t hp);
 
 
+	/**
+	 * @brief ÷̾ ִ HP ϴ.
+	 *
+	 * @return ÷̾ ִ HP ȯմϴ.
+	 */
+	int32_t GetMaxHP() const { return maxHP_; }
+
+
+#if !defined(HEADLESS_MODE)
 	/**
 	 * @brief ÷̾ HP ׸ϴ.
 	 * 
 	 * @param camera 3D ī޶Դϴ.
+	 * @param interpolationAlpha  ùķ̼ ܰ  ùķ̼ ܰ   Դϴ.
 	 */
-	void RenderHP(const Camera3D* camera);
+	void RenderHP(const Camera3D* camera, float interpolationAlpha);
+#endif
 	
 
 private:
 	/**
-	 * @brief  浹ϴ Ȯմϴ.
-	 *
-	 * @return  浹Ѵٸ true, ׷  false ȯմϴ.
+	 * @brief ÷̾   Ʈ  Դϴ.
 	 */
-	bool CheckCollisionToWall();
+	Sphere3D boundingVolume_;
 
 
-private:
 	/**
-	 * @brief ÷̾   Ʈ  Դϴ.
+	 * @brief ÷̾   ϵ 浹 Դϴ.
 	 */
-	Sphere3D boundingVolume_;
+	CollisionWorld* collisionWorld_ = nullptr;
+
+
+	/**
+	 * @brief 浹 忡 ϵ ÷̾ ϽԴϴ.
+	 */
+	uint32_t proxy_ = 0;
 
 
 	/**
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "UIPanel.h"
+#include "ObjectHandle.h"
 
 class Player; // ÷̾ Ŭ  Դϴ.
 
@@ -50,4 +51,11 @@ private:
 	 * @return  UI ߽ ġ ϴ.
 	 */
 	Vector2f GetCenterFromWindow();
+
+
+private:
+	/**
+	 * @brief ÷ ð ǥ ÷̾ ڵԴϴ.
+	 */
+	ObjectHandle playerHandle_;
 };
\ No newline at end of file
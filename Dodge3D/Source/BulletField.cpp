@@ -0,0 +1,351 @@
+#include <algorithm>
+
+#include "BulletField.h"
+#include "Player.h"
+
+#include "Assertion.h"
+#include "CollisionWorld.h"
+#include "GeometryGenerator.h"
+#include "InstanceBuffer.h"
+#include "JobSystem.h"
+#include "MathUtils.h"
+#include "ObjectManager.h"
+#include "ResourceManager.h"
+#include "Sphere3D.h"
+
+/**
+ * @brief Ѿ ̵  ó   ۾ ô  Դϴ.
+ *
+ * @note     ϶ ۾  ʰ ȣ 忡 óմϴ.
+ */
+static const uint32_t TICK_GRAIN = 2048;
+
+BulletField::~BulletField()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void BulletField::Initialize(uint32_t capacity)
+{
+	ASSERT(!bIsInitialized_, "already initialize bullet field object...");
+
+	mesh_ = ResourceManager::Get().GetResource<StaticMesh>("BulletMesh");
+	if (!mesh_)
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		GeometryGenerator::CreateSphere(1.0f, 40, vertices, indices);
+
+		mesh_ = ResourceManager::Get().CreateResource<StaticMesh>("BulletMesh");
+		mesh_->Initialize(vertices, indices);
+	}
+
+	material_ = ResourceManager::Get().GetResource<Material>("BulletMaterial");
+	if (!material_)
+	{
+		material_ = ResourceManager::Get().CreateResource<Material>("BulletMaterial");
+		material_->Initialize(
+			Vector3f(0.19225f, 0.19225f, 0.19225f),
+			Vector3f(0.50754f, 0.50754f, 0.50754f),
+			Vector3f(0.508273f, 0.508273f, 0.508273f),
+			0.4f * 128.0f
+		);
+	}
+
+	collisionWorld_ = ObjectManager::Get().GetObject<CollisionWorld>("CollisionWorld");
+	playerHandle_ = ObjectManager::Get().FindHandle("Player");
+
+	positionX_.reserve(capacity);
+	positionY_.reserve(capacity);
+	positionZ_.reserve(capacity);
+	prevPositionX_.reserve(capacity);
+	prevPositionY_.reserve(capacity);
+	prevPositionZ_.reserve(capacity);
+	directionX_.reserve(capacity);
+	directionY_.reserve(capacity);
+	directionZ_.reserve(capacity);
+	speeds_.reserve(capacity);
+	radii_.reserve(capacity);
+	alives_.reserve(capacity);
+	proxies_.reserve(capacity);
+	collisionLayers_.reserve(capacity);
+	freeSlots_.reserve(capacity);
+
+	countOfAlive_ = 0;
+	bIsCollisionToPlayer_ = false;
+
+	bIsInitialized_ = true;
+}
+
+void BulletField::Tick(float deltaSeconds)
+{
+	// Ը ڽ ġ ڽ 浹 Ͻø ϹǷ   ó  ֽϴ.
+	JobSystem::Get().ParallelFor(0, GetCountOfSlot(), TICK_GRAIN,
+		[&](uint32_t beginSlot, uint32_t endSlot)
+		{
+			for (uint32_t slot = beginSlot; slot < endSlot; ++slot)
+			{
+				if (!alives_[slot])
+				{
+					continue;
+				}
+
+				positionX_[slot] += deltaSeconds * directionX_[slot] * speeds_[slot];
+				positionZ_[slot] += deltaSeconds * directionZ_[slot] * speeds_[slot];
+
+				collisionWorld_->UpdateSphereProxy(proxies_[slot], GetLocation(slot));
+			}
+		}
+	);
+}
+
+void BulletField::ResolveCollision()
+{
+	bIsCollisionToPlayer_ = false;
+	collisionSlots_.clear();
+
+	uint32_t bulletLayer = static_cast<uint32_t>(ECollisionLayer::Bullet);
+	for (const auto& collisionPair : collisionWorld_->GetCollisionPairs())
+	{
+		uint32_t bulletProxy = collisionPair.proxyA;
+		uint32_t otherProxy = collisionPair.proxyB;
+
+		if (collisionWorld_->GetProxyLayer(bulletProxy) != bulletLayer)
+		{
+			std::swap(bulletProxy, otherProxy);
+
+			if (collisionWorld_->GetProxyLayer(bulletProxy) != bulletLayer)
+			{
+				continue;
+			}
+		}
+
+		uint32_t slot = collisionWorld_->GetProxyUserData(bulletProxy);
+		if (collisionLayers_[slot] == 0)
+		{
+			collisionSlots_.push_back(slot);
+		}
+
+		collisionLayers_[slot] |= collisionWorld_->GetProxyLayer(otherProxy);
+	}
+
+	if (collisionSlots_.empty())
+	{
+		return;
+	}
+
+	Player* player = ObjectManager::Get().Resolve<Player>(playerHandle_);
+	for (const auto& slot : collisionSlots_)
+	{
+		if (collisionLayers_[slot] & static_cast<uint32_t>(ECollisionLayer::Player))
+		{
+			int32_t hp = player->GetHP();
+			player->SetHP(--hp);
+
+			bIsCollisionToPlayer_ = true;
+		}
+
+		collisionLayers_[slot] = 0;
+		Kill(slot);
+	}
+}
+
+void BulletField::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	Clear();
+
+	bIsInitialized_ = false;
+}
+
+uint32_t BulletField::Spawn(const Vector3f& location, const Vector3f& direction, float speed, float radius)
+{
+	uint32_t slot = 0;
+
+	if (!freeSlots_.empty())
+	{
+		slot = freeSlots_.back();
+		freeSlots_.pop_back();
+	}
+	else
+	{
+		slot = GetCountOfSlot();
+
+		positionX_.push_back(0.0f);
+		positionY_.push_back(0.0f);
+		positionZ_.push_back(0.0f);
+		prevPositionX_.push_back(0.0f);
+		prevPositionY_.push_back(0.0f);
+		prevPositionZ_.push_back(0.0f);
+		directionX_.push_back(0.0f);
+		directionY_.push_back(0.0f);
+		directionZ_.push_back(0.0f);
+		speeds_.push_back(0.0f);
+		radii_.push_back(0.0f);
+		alives_.push_back(0);
+		proxies_.push_back(CollisionWorld::INVALID_PROXY);
+		collisionLayers_.push_back(0);
+	}
+
+	ActivateSlot(slot, location, direction, speed, radius);
+	return slot;
+}
+
+void BulletField::SpawnBatch(const std::vector<BulletPattern::Emission>& emissions, float radius)
+{
+	if (emissions.empty())
+	{
+		return;
+	}
+
+	uint32_t countOfEmission = static_cast<uint32_t>(emissions.size());
+	uint32_t countOfFreeSlot = std::min<uint32_t>(countOfEmission, static_cast<uint32_t>(freeSlots_.size()));
+	uint32_t newSlot = GetCountOfSlot();
+
+	if (countOfFreeSlot < countOfEmission)
+	{
+		uint32_t countOfSlot = newSlot + (countOfEmission - countOfFreeSlot);
+
+		positionX_.resize(countOfSlot, 0.0f);
+		positionY_.resize(countOfSlot, 0.0f);
+		positionZ_.resize(countOfSlot, 0.0f);
+		prevPositionX_.resize(countOfSlot, 0.0f);
+		prevPositionY_.resize(countOfSlot, 0.0f);
+		prevPositionZ_.resize(countOfSlot, 0.0f);
+		directionX_.resize(countOfSlot, 0.0f);
+		directionY_.resize(countOfSlot, 0.0f);
+		directionZ_.resize(countOfSlot, 0.0f);
+		speeds_.resize(countOfSlot, 0.0f);
+		radii_.resize(countOfSlot, 0.0f);
+		alives_.resize(countOfSlot, 0);
+		proxies_.resize(countOfSlot, CollisionWorld::INVALID_PROXY);
+		collisionLayers_.resize(countOfSlot, 0);
+	}
+
+	for (const auto& emission : emissions)
+	{
+		uint32_t slot = 0;
+
+		if (!freeSlots_.empty())
+		{
+			slot = freeSlots_.back();
+			freeSlots_.pop_back();
+		}
+		else
+		{
+			slot = newSlot++;
+		}
+
+		ActivateSlot(slot, emission.location, emission.direction, emission.speed, radius);
+	}
+}
+
+void BulletField::Kill(uint32_t slot)
+{
+	ASSERT(slot < GetCountOfSlot(), "out of range bullet slot %d...", slot);
+
+	if (!alives_[slot])
+	{
+		return;
+	}
+
+	alives_[slot] = 0;
+	collisionWorld_->DestroyProxy(proxies_[slot]);
+	proxies_[slot] = CollisionWorld::INVALID_PROXY;
+	freeSlots_.push_back(slot);
+	countOfAlive_--;
+}
+
+void BulletField::Clear()
+{
+	positionX_.clear();
+	positionY_.clear();
+	positionZ_.clear();
+	prevPositionX_.clear();
+	prevPositionY_.clear();
+	prevPositionZ_.clear();
+	directionX_.clear();
+	directionY_.clear();
+	directionZ_.clear();
+	speeds_.clear();
+	radii_.clear();
+	alives_.clear();
+	proxies_.clear();
+	collisionLayers_.clear();
+	collisionSlots_.clear();
+	freeSlots_.clear();
+
+	countOfAlive_ = 0;
+	bIsCollisionToPlayer_ = false;
+}
+
+void BulletField::RecordPrevLocations()
+{
+	prevPositionX_ = positionX_;
+	prevPositionY_ = positionY_;
+	prevPositionZ_ = positionZ_;
+}
+
+Matrix4x4f BulletField::GetWorldMatrix(uint32_t slot, float interpolationAlpha) const
+{
+	float radius = radii_[slot];
+
+	return Matrix4x4f(
+		radius, 0.0f, 0.0f, 0.0f,
+		0.0f, radius, 0.0f, 0.0f,
+		0.0f, 0.0f, radius, 0.0f,
+		MathUtils::Lerp<float>(prevPositionX_[slot], positionX_[slot], interpolationAlpha),
+		MathUtils::Lerp<float>(prevPositionY_[slot], positionY_[slot], interpolationAlpha),
+		MathUtils::Lerp<float>(prevPositionZ_[slot], positionZ_[slot], interpolationAlpha),
+		1.0f
+	);
+}
+
+void BulletField::PackInstances(float interpolationAlpha, InstanceBuffer& outInstanceBuffer) const
+{
+	outInstanceBuffer.Clear();
+
+	for (uint32_t slot = 0; slot < GetCountOfSlot(); ++slot)
+	{
+		if (!alives_[slot])
+		{
+			continue;
+		}
+
+		Vector3f position(
+			MathUtils::Lerp<float>(prevPositionX_[slot], positionX_[slot], interpolationAlpha),
+			MathUtils::Lerp<float>(prevPositionY_[slot], positionY_[slot], interpolationAlpha),
+			MathUtils::Lerp<float>(prevPositionZ_[slot], positionZ_[slot], interpolationAlpha)
+		);
+
+		outInstanceBuffer.Add(position, radii_[slot]);
+	}
+}
+
+void BulletField::ActivateSlot(uint32_t slot, const Vector3f& location, const Vector3f& direction, float speed, float radius)
+{
+	positionX_[slot] = location.x;
+	positionY_[slot] = location.y;
+	positionZ_[slot] = location.z;
+	prevPositionX_[slot] = location.x;
+	prevPositionY_[slot] = location.y;
+	prevPositionZ_[slot] = location.z;
+	directionX_[slot] = direction.x;
+	directionY_[slot] = direction.y;
+	directionZ_[slot] = direction.z;
+	speeds_[slot] = speed;
+	radii_[slot] = radius;
+	alives_[slot] = 1;
+	proxies_[slot] = collisionWorld_->CreateSphereProxy(
+		Sphere3D(location, radius),
+		static_cast<uint32_t>(ECollisionLayer::Bullet),
+		static_cast<uint32_t>(ECollisionLayer::Wall) | static_cast<uint32_t>(ECollisionLayer::Player),
+		slot
+	);
+
+	countOfAlive_++;
+}
\ No newline at end of file
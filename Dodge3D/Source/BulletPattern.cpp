@@ -0,0 +1,307 @@
+#include <cmath>
+#include <string>
+
+#include "BulletPattern.h"
+
+#include "Assertion.h"
+#include "MathUtils.h"
+
+/**
+ * @brief Ѿ  Ͽ    ϴ Ѿ   Դϴ.
+ */
+static const float DEFAULT_RADIUS = 0.2f;
+
+/**
+ * @brief   ܰ迡 ȸ    ̺긶 ȸ Դϴ.
+ */
+static const float DEFAULT_SPIRAL_TURN = 15.0f;
+
+/**
+ * @brief ä  ܰ迡     ϴ  Դϴ.
+ */
+static const float DEFAULT_FAN_SPREAD = 60.0f;
+
+/**
+ * @brief Ѿ  ܰ Դϴ.
+ */
+enum class EShape
+{
+	Ring   = 0x00,
+	Spiral = 0x01,
+	Fan    = 0x02,
+	Aimed  = 0x03,
+};
+
+/**
+ * @brief ̺ ߻ ð Ÿ̹ ĿԴϴ.
+ */
+enum class ETimingCurve
+{
+	Linear    = 0x00,
+	EaseIn    = 0x01,
+	EaseOut   = 0x02,
+	EaseInOut = 0x03,
+};
+
+/**
+ * @brief ڿ ϴ Ѿ  ܰ  ϴ.
+ *
+ * @param shape  ڿԴϴ.
+ *
+ * @return  ڿ ϴ  ȯմϴ.
+ */
+static EShape ParseShape(const std::string& shape)
+{
+	if (shape == "ring")   return EShape::Ring;
+	if (shape == "spiral") return EShape::Spiral;
+	if (shape == "fan")    return EShape::Fan;
+	if (shape == "aimed")  return EShape::Aimed;
+
+	ASSERT(false, "undefined bullet pattern shape %s...", shape.c_str());
+	return EShape::Ring;
+}
+
+/**
+ * @brief ڿ ϴ Ÿ̹ Ŀ긦 ϴ.
+ *
+ * @param curve Ÿ̹ Ŀ ڿԴϴ.
+ *
+ * @return Ÿ̹ Ŀ ڿ ϴ Ÿ̹ Ŀ긦 ȯմϴ.
+ */
+static ETimingCurve ParseTimingCurve(const std::string& curve)
+{
+	if (curve == "linear")    return ETimingCurve::Linear;
+	if (curve == "easeIn")    return ETimingCurve::EaseIn;
+	if (curve == "easeOut")   return ETimingCurve::EaseOut;
+	if (curve == "easeInOut") return ETimingCurve::EaseInOut;
+
+	ASSERT(false, "undefined bullet pattern curve %s...", curve.c_str());
+	return ETimingCurve::Linear;
+}
+
+/**
+ * @brief Ÿ̹ Ŀ긦 մϴ.
+ *
+ * @param curve  Ÿ̹ ĿԴϴ.
+ * @param t 0.0 ~ 1.0   Դϴ.
+ *
+ * @return 0.0 ~ 1.0  Ŀ  ȯմϴ.
+ */
+static float EvaluateTimingCurve(ETimingCurve curve, float t)
+{
+	switch (curve)
+	{
+	case ETimingCurve::EaseIn:
+		return t * t;
+
+	case ETimingCurve::EaseOut:
+		return 1.0f - (1.0f - t) * (1.0f - t);
+
+	case ETimingCurve::EaseInOut:
+		return t * t * (3.0f - 2.0f * t);
+
+	default:
+		return t;
+	}
+}
+
+BulletPattern::~BulletPattern()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void BulletPattern::Initialize(const Json::Value& root)
+{
+	ASSERT(!bIsInitialized_, "already initialize bullet pattern resource...");
+	ASSERT(root.isObject() && root["steps"].isArray(), "bullet pattern must have steps array...");
+
+	radius_ = root.get("radius", DEFAULT_RADIUS).asFloat();
+	countOfEmissionPerCycle_ = 0;
+
+	for (const auto& step : root["steps"])
+	{
+		CompileStep(step);
+	}
+
+	float cycleSeconds = 0.0f;
+	for (const auto& instruction : instructions_)
+	{
+		if (instruction.opCode == EOpCode::Wait)
+		{
+			cycleSeconds += instruction.seconds;
+		}
+	}
+
+	// Ⱑ    Ʈ   ݺǹǷ  ܰ迡 ϴ.
+	ASSERT(cycleSeconds > 0.0f, "bullet pattern must contain at least one wait...");
+
+	bIsInitialized_ = true;
+}
+
+void BulletPattern::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	instructions_.clear();
+	directions_.clear();
+
+	bIsInitialized_ = false;
+}
+
+void BulletPattern::Execute(Cursor& cursor, float deltaSeconds, const Vector3f& origin, const Vector3f& target, RandomStream& randomStream, std::vector<Emission>& outEmissions) const
+{
+	cursor.elapsedTime += deltaSeconds;
+
+	uint32_t countOfInstruction = static_cast<uint32_t>(instructions_.size());
+	while (true)
+	{
+		const Instruction& instruction = instructions_[cursor.instruction];
+
+		if (instruction.opCode == EOpCode::Wait)
+		{
+			if (cursor.elapsedTime < instruction.seconds)
+			{
+				break;
+			}
+
+			cursor.elapsedTime -= instruction.seconds;
+		}
+		else
+		{
+			Vector3f basis(1.0f, 0.0f, 0.0f);
+			if (instruction.bIsAimed)
+			{
+				basis = MathUtils::Normalize(target - origin);
+			}
+
+			std::size_t first = outEmissions.size();
+			outEmissions.resize(first + instruction.count);
+
+			Emission* emissions = &outEmissions[first];
+			const Vector2f* directions = &directions_[instruction.directionOffset];
+			bool bIsRandomSpeed = instruction.minSpeed != instruction.maxSpeed;
+
+			for (uint32_t index = 0; index < instruction.count; ++index)
+			{
+				float cosine = directions[index].x;
+				float sine = directions[index].y;
+
+				emissions[index].location = origin;
+				emissions[index].direction = Vector3f(basis.x * cosine - basis.z * sine, basis.y, basis.x * sine + basis.z * cosine);
+				emissions[index].speed = bIsRandomSpeed ? randomStream.NextFloat(instruction.minSpeed, instruction.maxSpeed) : instruction.minSpeed;
+			}
+		}
+
+		cursor.instruction = (cursor.instruction + 1) % countOfInstruction;
+	}
+}
+
+float BulletPattern::GetWaitRate(const Cursor& cursor) const
+{
+	const Instruction& instruction = instructions_[cursor.instruction];
+	if (instruction.opCode != EOpCode::Wait)
+	{
+		return 0.0f;
+	}
+
+	return MathUtils::Clamp<float>(cursor.elapsedTime / instruction.seconds, 0.0f, 1.0f);
+}
+
+void BulletPattern::CompileStep(const Json::Value& step)
+{
+	EShape shape = ParseShape(step.get("shape", "ring").asString());
+	ETimingCurve curve = ParseTimingCurve(step.get("curve", "linear").asString());
+
+	int32_t count = step.get("count", 1).asInt();
+	int32_t waves = step.get("waves", 1).asInt();
+	ASSERT(0 < count && count <= UINT16_MAX, "out of range bullet pattern count %d...", count);
+	ASSERT(waves > 0, "out of range bullet pattern waves %d...", waves);
+
+	float delay = step.get("delay", 0.0f).asFloat();
+	float duration = step.get("duration", 0.0f).asFloat();
+	float angle = step.get("angle", 0.0f).asFloat();
+	float spread = step.get("spread", (shape == EShape::Fan) ? DEFAULT_FAN_SPREAD : 0.0f).asFloat();
+	float turn = step.get("turn", (shape == EShape::Spiral) ? DEFAULT_SPIRAL_TURN : 0.0f).asFloat();
+
+	float minSpeed = 0.0f;
+	float maxSpeed = 0.0f;
+
+	const Json::Value& speed = step["speed"];
+	if (speed.isArray())
+	{
+		ASSERT(speed.size() == 2, "bullet pattern speed range must have two elements...");
+		minSpeed = speed[0].asFloat();
+		maxSpeed = speed[1].asFloat();
+	}
+	else
+	{
+		minSpeed = speed.asFloat();
+		maxSpeed = minSpeed;
+	}
+
+	AddWait(delay);
+
+	float prevWaveTime = 0.0f;
+	for (int32_t wave = 0; wave < waves; ++wave)
+	{
+		if (waves > 1)
+		{
+			float waveTime = duration * EvaluateTimingCurve(curve, static_cast<float>(wave) / static_cast<float>(waves - 1));
+
+			AddWait(waveTime - prevWaveTime);
+			prevWaveTime = waveTime;
+		}
+
+		Instruction instruction;
+		instruction.opCode = EOpCode::Emit;
+		instruction.bIsAimed = (shape == EShape::Aimed);
+		instruction.count = static_cast<uint16_t>(count);
+		instruction.directionOffset = static_cast<uint32_t>(directions_.size());
+		instruction.seconds = 0.0f;
+		instruction.minSpeed = minSpeed;
+		instruction.maxSpeed = maxSpeed;
+
+		float waveAngle = angle + turn * static_cast<float>(wave);
+		for (int32_t index = 0; index < count; ++index)
+		{
+			double degree = static_cast<double>(waveAngle);
+			if (shape == EShape::Ring || shape == EShape::Spiral)
+			{
+				degree += 360.0 * static_cast<double>(index) / static_cast<double>(count);
+			}
+			else if (count > 1)
+			{
+				degree += static_cast<double>(spread) * (static_cast<double>(index) / static_cast<double>(count - 1) - 0.5);
+			}
+
+			//  ̺     Ƿ е    Դϴ.
+			double radian = degree * 3.14159265358979323846 / 180.0;
+			directions_.push_back(Vector2f(static_cast<float>(std::cos(radian)), static_cast<float>(std::sin(radian))));
+		}
+
+		instructions_.push_back(instruction);
+		countOfEmissionPerCycle_ += static_cast<uint32_t>(count);
+	}
+}
+
+void BulletPattern::AddWait(float seconds)
+{
+	if (seconds <= 0.0f)
+	{
+		return;
+	}
+
+	Instruction instruction;
+	instruction.opCode = EOpCode::Wait;
+	instruction.bIsAimed = false;
+	instruction.count = 0;
+	instruction.directionOffset = 0;
+	instruction.seconds = seconds;
+	instruction.minSpeed = 0.0f;
+	instruction.maxSpeed = 0.0f;
+
+	instructions_.push_back(instruction);
+}
\ No newline at end of file
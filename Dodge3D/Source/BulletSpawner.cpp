@@ -4,9 +4,14 @@
 #include "Camera3D.h"
 #include "GeometryGenerator.h"
 #include "MathUtils.h"
-#include "RenderManager.h"
+#include "ObjectManager.h"
 #include "ResourceManager.h"
-#include "StringUtils.h"
+
+#include "Player.h"
+
+#if !defined(HEADLESS_MODE)
+#include "RenderManager.h"
+#endif
 
 BulletSpawner::~BulletSpawner()
 {
@@ -16,7 +21,7 @@ BulletSpawner::~BulletSpawner()
 	}
 }
 
-void BulletSpawner::Initialize(const Vector3f& location, float respawnTime, const std::function<void()>& respawnTrigger)
+void BulletSpawner::Initialize(const Vector3f& location, const BulletPattern* pattern, RandomStream* randomStream)
 {
 	ASSERT(!bIsInitialized_, "already initialize bullet spawner object...");
 
@@ -45,39 +50,45 @@ void BulletSpawner::Initialize(const Vector3f& location, float respawnTime, cons
 	
 	transform_ = Transform(location, Vector3f(0.0f, 0.0f, 0.0f), Vector3f(1.0f, 1.0f, 1.0f));
 
-	stepTime_ = 0.0f;
-	respawnTime_ = respawnTime;
+	pattern_ = pattern;
+	cursor_ = BulletPattern::Cursor();
+	randomStream_ = randomStream;
+	playerHandle_ = ObjectManager::Get().FindHandle("Player");
+	emissions_.reserve(pattern_->GetCountOfEmissionPerCycle());
+
 	width_ = 1.0f;
 	height_ = 0.2f;
 	mainColor_ = Vector4f(1.0f, 0.0f, 0.0f, 1.0f);
 	subColor_ = Vector4f(0.0f, 0.0f, 0.0f, 1.0f);
-	respawnTrigger_ = respawnTrigger;
 
 	bIsInitialized_ = true;
 }
 
 void BulletSpawner::Tick(float deltaSeconds)
 {
-	stepTime_ += deltaSeconds;
+	emissions_.clear();
 
-	if (stepTime_ >= respawnTime_)
-	{
-		stepTime_ -= respawnTime_;
-		respawnTrigger_();
-	}
+	Player* player = ObjectManager::Get().Resolve<Player>(playerHandle_);
+	pattern_->Execute(cursor_, deltaSeconds, transform_.GetLocation(), player->GetTransform().GetLocation(), *randomStream_, emissions_);
 }
 
 void BulletSpawner::Release()
 {
 	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
 
+	emissions_.clear();
+	pattern_ = nullptr;
+	randomStream_ = nullptr;
+
 	bIsInitialized_ = false;
 }
 
+#if !defined(HEADLESS_MODE)
 void BulletSpawner::RenderRespawnTime(const Camera3D* camera)
 {
 	Matrix4x4f world = transform_.GetWorldMatrix() * MathUtils::CreateTranslation(Vector3f(0.0f, 1.0f, 0.0f));
-	float rate = stepTime_ / respawnTime_;
+	float rate = pattern_->GetWaitRate(cursor_);
 
 	RenderManager::Get().RenderHorizonDividQuad3D(world, camera, width_, height_, rate, mainColor_, subColor_);
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,344 @@
+#include "EntityPlaySimulation.h"
+
+#include "Assertion.h"
+#include "Box3D.h"
+#include "CollisionWorld.h"
+#include "EntityComponents.h"
+#include "GeometryGenerator.h"
+#include "ObjectManager.h"
+#include "ResourceManager.h"
+#include "Sphere3D.h"
+#include "Transform.h"
+
+#include "GameObject.h"
+#include "PlayComponents.h"
+#include "Player.h"
+
+using namespace EntityComponents;
+using namespace PlayComponents;
+
+/**
+ * @brief ùķ̼ õ ȿ Ѿ ӷ  Ʈ ϴ ȣԴϴ.
+ *
+ * @note PlaySimulation      Ʈ ȣ մϴ.
+ */
+static const uint64_t BULLET_SPEED_STREAM = 0;
+
+/**
+ * @brief Ѿ ̵  ó   ۾ ô ƼƼ Դϴ.
+ */
+static const uint32_t TICK_GRAIN = 2048;
+
+/**
+ * @brief  ƼƼ ġ Դϴ.
+ */
+struct WallParam
+{
+	const char* meshSignature;   //  ޽ ñ״óԴϴ.
+	Vector3f location;           //    ġԴϴ.
+	Vector3f size;               //  ũԴϴ.
+};
+
+/**
+ * @brief , , ,    ġ Դϴ.
+ *
+ * @note 浹 Ͻ ȣ PlaySimulation   Ʈ   ϴ.
+ */
+static const WallParam WALL_PARAMS[] =
+{
+	WallParam{ "NorthWallMesh", Vector3f(0.0f, 0.5f, -5.5f), Vector3f(10.0f, 1.0f, 1.0f) },
+	WallParam{ "SouthWallMesh", Vector3f(0.0f, 0.5f, +5.5f), Vector3f(10.0f, 1.0f, 1.0f) },
+	WallParam{ "WestWallMesh",  Vector3f(-5.5f, 0.5f, 0.0f), Vector3f(1.0f, 1.0f, 10.0f) },
+	WallParam{ "EastWallMesh",  Vector3f(+5.5f, 0.5f, 0.0f), Vector3f(1.0f, 1.0f, 10.0f) },
+};
+
+/**
+ * @brief ҽ Ŵ  , ٸ մϴ.
+ *
+ * @param signature  ñ״óԴϴ.
+ * @param ambientRGB  Ambient Դϴ.
+ * @param diffuseRGB  Diffuse Դϴ.
+ * @param specularRGB  Specular Դϴ.
+ * @param shininess  ݻ Դϴ.
+ *
+ * @return  ͸ ȯմϴ.
+ */
+static Material* GetOrCreateMaterial(const std::string& signature, const Vector3f& ambientRGB, const Vector3f& diffuseRGB, const Vector3f& specularRGB, float shininess)
+{
+	Material* material = ResourceManager::Get().GetResource<Material>(signature);
+	if (!material)
+	{
+		material = ResourceManager::Get().CreateResource<Material>(signature);
+		material->Initialize(ambientRGB, diffuseRGB, specularRGB, shininess);
+	}
+
+	return material;
+}
+
+/**
+ * @brief ҽ Ŵ ޽ø , ٸ մϴ.
+ *
+ * @param signature ޽ ñ״óԴϴ.
+ * @param generate ޽  ε ϴ ԼԴϴ.
+ *
+ * @return ޽ ͸ ȯմϴ.
+ */
+template <typename TGenerate>
+static StaticMesh* GetOrCreateMesh(const std::string& signature, TGenerate&& generate)
+{
+	StaticMesh* mesh = ResourceManager::Get().GetResource<StaticMesh>(signature);
+	if (!mesh)
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		generate(vertices, indices);
+
+		mesh = ResourceManager::Get().CreateResource<StaticMesh>(signature);
+		mesh->Initialize(vertices, indices);
+	}
+
+	return mesh;
+}
+
+void EntityPlaySimulation::Initialize(const std::vector<PlaySimulation::BulletSpawnerParam>& bulletSpawnerParams, uint32_t bulletCapacity, uint64_t randomSeed)
+{
+	ASSERT(!bIsInitialized_, "already initialize entity play simulation...");
+
+	bulletRandomStream_.Seed(randomSeed, BULLET_SPEED_STREAM);
+
+	collisionWorld_ = ObjectManager::Get().CreateObject<CollisionWorld>("CollisionWorld");
+	collisionWorld_->Initialize(CollisionWorld::EBroadphase::UniformGrid, Vector3f(-6.0f, -1.0f, -6.0f), Vector3f(+6.0f, +2.0f, +6.0f), 1.0f);
+
+	player_ = ObjectManager::Get().CreateObject<Player>("Player");
+	player_->Initialize();
+
+	entityWorld_ = ObjectManager::Get().CreateObject<EntityWorld>("EntityWorld");
+	entityWorld_->Initialize();
+
+	Material* wallMaterial = GetOrCreateMaterial(
+		"WallMaterial",
+		Vector3f(0.19225f, 0.19225f, 0.19225f),
+		Vector3f(0.50754f, 0.50754f, 0.50754f),
+		Vector3f(0.508273f, 0.508273f, 0.508273f),
+		0.4f * 128.0f
+	);
+
+	for (const auto& wallParam : WALL_PARAMS)
+	{
+		StaticMesh* mesh = GetOrCreateMesh(wallParam.meshSignature,
+			[&](std::vector<Vertex>& outVertices, std::vector<uint32_t>& outIndices)
+			{
+				GeometryGenerator::CreateCube(wallParam.size, outVertices, outIndices);
+			}
+		);
+
+		Box3D bound(wallParam.location, wallParam.size);
+		uint32_t proxy = collisionWorld_->CreateBoxProxy(
+			bound,
+			static_cast<uint32_t>(ECollisionLayer::Wall),
+			static_cast<uint32_t>(ECollisionLayer::Player) | static_cast<uint32_t>(ECollisionLayer::Bullet),
+			0
+		);
+
+		entityWorld_->CreateEntity(
+			Transform(wallParam.location, Vector3f(0.0f, 0.0f, 0.0f), Vector3f(1.0f, 1.0f, 1.0f)),
+			bound,
+			CollisionProxy{ proxy, 0 },
+			RenderRef{ mesh, wallMaterial }
+		);
+	}
+
+	StaticMesh* spawnerMesh = GetOrCreateMesh("BulletSpawnerMesh",
+		[](std::vector<Vertex>& outVertices, std::vector<uint32_t>& outIndices)
+		{
+			GeometryGenerator::CreateCylinder(0.25f, 1.0f, 40, outVertices, outIndices);
+		}
+	);
+
+	Material* spawnerMaterial = GetOrCreateMaterial(
+		"BulletSpawnerMaterial",
+		Vector3f(0.1745f, 0.01175f, 0.01175f),
+		Vector3f(0.61424f, 0.04136f, 0.04136f),
+		Vector3f(0.727811f, 0.626959f, 0.626959f),
+		0.6f * 128.0f
+	);
+
+	for (const auto& bulletSpawnerParam : bulletSpawnerParams)
+	{
+		entityWorld_->CreateEntity(
+			Transform(bulletSpawnerParam.location, Vector3f(0.0f, 0.0f, 0.0f), Vector3f(1.0f, 1.0f, 1.0f)),
+			PatternCursor{ bulletSpawnerParam.pattern, BulletPattern::Cursor() },
+			RenderRef{ spawnerMesh, spawnerMaterial }
+		);
+	}
+
+	bulletRenderRef_.mesh = GetOrCreateMesh("BulletMesh",
+		[](std::vector<Vertex>& outVertices, std::vector<uint32_t>& outIndices)
+		{
+			GeometryGenerator::CreateSphere(1.0f, 40, outVertices, outIndices);
+		}
+	);
+
+	bulletRenderRef_.material = GetOrCreateMaterial(
+		"BulletMaterial",
+		Vector3f(0.19225f, 0.19225f, 0.19225f),
+		Vector3f(0.50754f, 0.50754f, 0.50754f),
+		Vector3f(0.508273f, 0.508273f, 0.508273f),
+		0.4f * 128.0f
+	);
+
+	entityWorld_->Reserve<Sphere3D, PrevLocation, BulletMotion, CollisionProxy, RenderRef>(bulletCapacity);
+
+	std::size_t countOfEmissionPerCycle = 0;
+	for (const auto& bulletSpawnerParam : bulletSpawnerParams)
+	{
+		countOfEmissionPerCycle += bulletSpawnerParam.pattern->GetCountOfEmissionPerCycle();
+	}
+
+	emissions_.reserve(countOfEmissionPerCycle);
+	emissionRadii_.reserve(countOfEmissionPerCycle);
+
+	// ÷̾ ù Ʈ  浹 ˻  ֵ ε ̸ մϴ.
+	collisionWorld_->Tick(0.0f);
+
+	RecordPrevState();
+
+	bIsInitialized_ = true;
+}
+
+void EntityPlaySimulation::Tick(float fixedDeltaSeconds)
+{
+	player_->Tick(fixedDeltaSeconds);
+
+	emissions_.clear();
+	emissionRadii_.clear();
+
+	Vector3f playerLocation = player_->GetTransform().GetLocation();
+	entityWorld_->ForEach<Transform, PatternCursor>(
+		[&](Transform& transform, PatternCursor& patternCursor)
+		{
+			patternCursor.pattern->Execute(patternCursor.cursor, fixedDeltaSeconds, transform.GetLocation(), playerLocation, bulletRandomStream_, emissions_);
+			emissionRadii_.resize(emissions_.size(), patternCursor.pattern->GetRadius());
+		}
+	);
+
+	for (std::size_t index = 0; index < emissions_.size(); ++index)
+	{
+		SpawnBullet(emissions_[index], emissionRadii_[index]);
+	}
+
+	// Ѿ˸ ڽ   ڽ 浹 Ͻø ϹǷ ķ ó  ֽϴ.
+	entityWorld_->ParallelForEach<Sphere3D, BulletMotion, CollisionProxy>(TICK_GRAIN,
+		[&](Sphere3D& bound, const BulletMotion& motion, const CollisionProxy& collisionProxy)
+		{
+			Vector3f center = bound.GetCenter();
+			center.x += fixedDeltaSeconds * motion.direction.x * motion.speed;
+			center.z += fixedDeltaSeconds * motion.direction.z * motion.speed;
+
+			bound.SetCenter(center);
+			collisionWorld_->UpdateSphereProxy(collisionProxy.proxy, center);
+		}
+	);
+
+	collisionWorld_->Tick(fixedDeltaSeconds);
+	ResolveCollision();
+
+	entityWorld_->Tick(fixedDeltaSeconds);
+}
+
+void EntityPlaySimulation::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	ObjectManager::Get().DestroyObject(entityWorld_->GetHandle());
+	ObjectManager::Get().DestroyObject(player_->GetHandle());
+	ObjectManager::Get().DestroyObject(collisionWorld_->GetHandle());
+
+	emissions_.clear();
+	emissionRadii_.clear();
+	collisionBullets_.clear();
+	bulletRenderRef_ = RenderRef();
+
+	collisionWorld_ = nullptr;
+	player_ = nullptr;
+	entityWorld_ = nullptr;
+
+	bIsInitialized_ = false;
+}
+
+void EntityPlaySimulation::RecordPrevState()
+{
+	player_->RecordPrevTransform();
+
+	entityWorld_->ForEach<Sphere3D, PrevLocation>(
+		[](const Sphere3D& bound, PrevLocation& prevLocation)
+		{
+			prevLocation.location = bound.GetCenter();
+		}
+	);
+}
+
+uint32_t EntityPlaySimulation::GetCountOfBullet() const
+{
+	return entityWorld_->GetCountOfEntity<BulletMotion>();
+}
+
+void EntityPlaySimulation::SpawnBullet(const BulletPattern::Emission& emission, float radius)
+{
+	Sphere3D bound(emission.location, radius);
+	EntityHandle bullet = entityWorld_->CreateEntity(bound, PrevLocation{ emission.location }, BulletMotion{ emission.direction, emission.speed }, CollisionProxy{ CollisionWorld::INVALID_PROXY, 0 }, bulletRenderRef_);
+
+	entityWorld_->GetComponent<CollisionProxy>(bullet)->proxy = collisionWorld_->CreateSphereProxy(
+		bound,
+		static_cast<uint32_t>(ECollisionLayer::Bullet),
+		static_cast<uint32_t>(ECollisionLayer::Wall) | static_cast<uint32_t>(ECollisionLayer::Player),
+		bullet.index
+	);
+}
+
+void EntityPlaySimulation::ResolveCollision()
+{
+	bIsCollisionToPlayer_ = false;
+	collisionBullets_.clear();
+
+	uint32_t bulletLayer = static_cast<uint32_t>(ECollisionLayer::Bullet);
+	for (const auto& collisionPair : collisionWorld_->GetCollisionPairs())
+	{
+		uint32_t bulletProxy = collisionPair.proxyA;
+		uint32_t otherProxy = collisionPair.proxyB;
+
+		if (collisionWorld_->GetProxyLayer(bulletProxy) != bulletLayer)
+		{
+			std::swap(bulletProxy, otherProxy);
+
+			if (collisionWorld_->GetProxyLayer(bulletProxy) != bulletLayer)
+			{
+				continue;
+			}
+		}
+
+		EntityHandle bullet = entityWorld_->GetEntityHandle(collisionWorld_->GetProxyUserData(bulletProxy));
+		CollisionProxy* collisionProxy = entityWorld_->GetComponent<CollisionProxy>(bullet);
+		if (collisionProxy->hitLayers == 0)
+		{
+			collisionBullets_.push_back(bullet);
+		}
+
+		collisionProxy->hitLayers |= collisionWorld_->GetProxyLayer(otherProxy);
+	}
+
+	for (const auto& bullet : collisionBullets_)
+	{
+		CollisionProxy* collisionProxy = entityWorld_->GetComponent<CollisionProxy>(bullet);
+		if (collisionProxy->hitLayers & static_cast<uint32_t>(ECollisionLayer::Player))
+		{
+			int32_t hp = player_->GetHP();
+			player_->SetHP(--hp);
+
+			bIsCollisionToPlayer_ = true;
+		}
+
+		collisionWorld_->DestroyProxy(collisionProxy->proxy);
+		entityWorld_->DestroyEntity(bullet);
+	}
+}
\ No newline at end of file
@@ -4,19 +4,18 @@
 #include "GameTimer.h"
 #include "MathUtils.h"
 #include "ObjectManager.h"
-#include "StringUtils.h"
 #include "RenderManager.h"
 #include "ResourceManager.h"
 #include "Sound.h"
+#include "StaticBatch.h"
+#include "UniformBlock.h"
 #include "Window.h"
 
+#include "BulletField.h"
+#include "BulletPattern.h"
 #include "BulletSpawner.h"
-#include "EastWall.h"
 #include "Floor.h"
-#include "NorthWall.h"
 #include "Player.h"
-#include "SouthWall.h"
-#include "WestWall.h"
 
 GameScene::GameScene()
 {
@@ -29,14 +28,26 @@ GameScene::~GameScene()
 void GameScene::Tick(float deltaSeconds)
 {
 	UpdateScene(deltaSeconds);
+	camera_->FollowPlayer(interpolationAlpha_);
 
 	RenderManager::Get().BeginFrame(0.0f, 0.0f, 0.0f, 1.0f);
 	RenderManager::Get().SetDepthMode(true);
+	CollectDrawPackets();
 	RenderDepthScene();
 	RenderScene();
 	RenderManager::Get().EndFrame();
 }
 
+void GameScene::FixedTick(float fixedDeltaSeconds)
+{
+	RecordPrevState();
+
+	if (sceneState_ == ESceneState::Play)
+	{
+		SimulatePlayStateScene(fixedDeltaSeconds);
+	}
+}
+
 void GameScene::EnterScene()
 {
 	sceneState_ = ESceneState::Ready;
@@ -79,11 +90,6 @@ void GameScene::EnterScene()
 	InputManager::Get().AddWindowEventAction("GameScene_ExitResize",    EWindowEvent::ExitResize,    gameScenePauseEvent, true);
 	InputManager::Get().AddWindowEventAction("GameScene_EnterMinimize", EWindowEvent::EnterMinimize, gameScenePauseEvent, true);
 
-	bulletRemoveEvent_ = [](Bullet* bullet)
-	{
-		return bullet->IsCollisionToPlayer() || bullet->IsCollisionToWall();
-	};
-
 	stepTime_ = 0.0f;
 	fadeInStepTime_ = 1.0f;
 
@@ -103,20 +109,11 @@ void GameScene::ExitScene()
 	InputManager::Get().DeleteWindowEventAction("GameScene_ExitResize");
 	InputManager::Get().DeleteWindowEventAction("GameScene_EnterMinimize");
 
-	std::array<std::string, 13> objects = 
+	std::array<std::string, 4> objects = 
 	{
 		"MainCamera",
 		"GlobalLight",
-		"Player",
 		"Floor",
-		"NorthWall",
-		"SouthWall",
-		"WestWall",
-		"EastWall",
-		"BulletSpawner_0",
-		"BulletSpawner_1",
-		"BulletSpawner_2",
-		"BulletSpawner_3",
 		"Board",
 	};
 
@@ -125,12 +122,13 @@ void GameScene::ExitScene()
 		ObjectManager::Get().DestroyObject(object);
 	}
 
-	for (int32_t index = 0; index < countOfbullet_; ++index)
-	{
-		ObjectManager::Get().DestroyObject(StringUtils::PrintF("Bullet_%d", index));
-	}
-	bullets_.clear();
-	countOfbullet_ = 0;
+	ResourceManager::Get().DestroyResource("GameScene_MeshBuffer");
+	meshBuffer_ = nullptr;
+
+	staticBatchAllocations_.clear();
+	staticBatchMaterials_.clear();
+
+	simulation_.Release();
 
 	bIsEnterScene_ = false;
 }
@@ -139,6 +137,7 @@ void GameScene::LoadResources()
 {
 	font32_ = ResourceManager::Get().GetResource<TTFont>("Font32");
 	buttonClick_ = ResourceManager::Get().GetResource<Sound>("ButtonClick");
+	hitSound_ = ResourceManager::Get().GetResource<Sound>("Hit");
 
 	shadowMap_ = ResourceManager::Get().GetResource<ShadowMap>("GameScene_ShadowMap");
 	if(!shadowMap_)
@@ -147,6 +146,29 @@ void GameScene::LoadResources()
 		shadowMap_->Initialize(SHADOW_WIDTH, SHADOW_HEIGHT);
 	}
 
+	bulletInstanceBuffer_ = ResourceManager::Get().GetResource<InstanceBuffer>("GameScene_BulletInstanceBuffer");
+	if (!bulletInstanceBuffer_)
+	{
+		bulletInstanceBuffer_ = ResourceManager::Get().CreateResource<InstanceBuffer>("GameScene_BulletInstanceBuffer");
+		bulletInstanceBuffer_->Initialize(BULLET_CAPACITY);
+	}
+
+	frameUniformBuffer_ = ResourceManager::Get().GetResource<UniformBuffer>("GameScene_FrameUniformBuffer");
+	if (!frameUniformBuffer_)
+	{
+		frameUniformBuffer_ = ResourceManager::Get().CreateResource<UniformBuffer>("GameScene_FrameUniformBuffer");
+		frameUniformBuffer_->Initialize(FrameUniformBlock::BINDING, sizeof(FrameUniformBlock), 1);
+	}
+
+	materialUniformBuffer_ = ResourceManager::Get().GetResource<UniformBuffer>("GameScene_MaterialUniformBuffer");
+	if (!materialUniformBuffer_)
+	{
+		materialUniformBuffer_ = ResourceManager::Get().CreateResource<UniformBuffer>("GameScene_MaterialUniformBuffer");
+		materialUniformBuffer_->Initialize(MaterialUniformBlock::BINDING, sizeof(MaterialUniformBlock), MATERIAL_BLOCK_CAPACITY);
+	}
+
+	renderBackend_.SetMaterialUniformBuffer(materialUniformBuffer_);
+
 	framebuffer_ = ResourceManager::Get().GetResource<Framebuffer>("GameScene_Framebuffer");
 	if (!framebuffer_)
 	{
@@ -159,7 +181,9 @@ void GameScene::LoadResources()
 	}
 
 	shadowShader_ = ResourceManager::Get().GetResource<ShadowShader>("ShadowShader");
+	shadowInstancedShader_ = ResourceManager::Get().GetResource<ShadowShader>("ShadowInstancedShader");
 	lightShader_ = ResourceManager::Get().GetResource<LightShader>("LightShader");
+	lightInstancedShader_ = ResourceManager::Get().GetResource<LightShader>("LightInstancedShader");
 	grayscaleEffectShader_ = ResourceManager::Get().GetResource<PostEffectShader>("GrayscaleEffect");
 	fadeEffectShader_ = ResourceManager::Get().GetResource<PostEffectShader>("FadeEffect");
 	blurEffectShader_ = ResourceManager::Get().GetResource<PostEffectShader>("GaussianBlurEffect");
@@ -167,88 +191,29 @@ void GameScene::LoadResources()
 
 void GameScene::LoadObjects()
 {
+	const BulletPattern* aimedSlowPattern = ResourceManager::Get().GetResource<BulletPattern>("AimedSlowPattern");
+	const BulletPattern* aimedFastPattern = ResourceManager::Get().GetResource<BulletPattern>("AimedFastPattern");
+
+	simulation_.Initialize(
+		{
+			PlaySimulation::BulletSpawnerParam{ Vector3f(-4.0f, 0.5f, +4.0f), aimedSlowPattern },
+			PlaySimulation::BulletSpawnerParam{ Vector3f(+4.0f, 0.5f, +4.0f), aimedFastPattern },
+			PlaySimulation::BulletSpawnerParam{ Vector3f(+4.0f, 0.5f, -4.0f), aimedSlowPattern },
+			PlaySimulation::BulletSpawnerParam{ Vector3f(-4.0f, 0.5f, -4.0f), aimedFastPattern },
+		},
+		BULLET_CAPACITY,
+		MathUtils::GetThreadRandomStream().NextUInt64()
+	);
+
 	camera_ = ObjectManager::Get().CreateObject<MovableCamera>("MainCamera");
 	camera_->Initialize();
 
 	light_ = ObjectManager::Get().CreateObject<StaticLight>("GlobalLight");
 	light_->Initialize();
 
-	player_ = ObjectManager::Get().CreateObject<Player>("Player");
-	player_->Initialize();
-
 	floor_ = ObjectManager::Get().CreateObject<Floor>("Floor");
 	floor_->Initialize();
 
-	northWall_ = ObjectManager::Get().CreateObject<NorthWall>("NorthWall");
-	northWall_->Initialize();
-
-	southWall_ = ObjectManager::Get().CreateObject<SouthWall>("SouthWall");
-	southWall_->Initialize();
-
-	westWall_ = ObjectManager::Get().CreateObject<WestWall>("WestWall");
-	westWall_->Initialize();
-
-	eastWall_ = ObjectManager::Get().CreateObject<EastWall>("EastWall");
-	eastWall_->Initialize();
-
-	bulletSpawner0_ = ObjectManager::Get().CreateObject<BulletSpawner>("BulletSpawner_0");
-	bulletSpawner0_->Initialize(
-		Vector3f(-4.0f, 0.5f, +4.0f), 
-		1.5f, 
-		[&]() {
-			Bullet* bullet = ObjectManager::Get().CreateObject<Bullet>(StringUtils::PrintF("Bullet_%d", countOfbullet_++));
-			Vector3f direction = MathUtils::Normalize(player_->GetTransform().GetLocation() - bulletSpawner0_->GetTransform().GetLocation());
-			float speed = MathUtils::GenerateRandomFloat(2.0f, 5.0f);
-
-			bullet->Initialize(bulletSpawner0_->GetTransform().GetLocation(), direction, speed, 0.2f);
-			bullets_.push_back(bullet);
-		}
-	);
-
-	bulletSpawner1_ = ObjectManager::Get().CreateObject<BulletSpawner>("BulletSpawner_1");
-	bulletSpawner1_->Initialize(
-		Vector3f(+4.0f, 0.5f, +4.0f), 
-		1.0f, 
-		[&]() 
-		{
-			Bullet* bullet = ObjectManager::Get().CreateObject<Bullet>(StringUtils::PrintF("Bullet_%d", countOfbullet_++));
-			Vector3f direction = MathUtils::Normalize(player_->GetTransform().GetLocation() - bulletSpawner1_->GetTransform().GetLocation());
-			float speed = MathUtils::GenerateRandomFloat(2.0f, 5.0f);
-
-			bullet->Initialize(bulletSpawner1_->GetTransform().GetLocation(), direction, speed, 0.2f);
-			bullets_.push_back(bullet);
-		}
-	);
-
-	bulletSpawner2_ = ObjectManager::Get().CreateObject<BulletSpawner>("BulletSpawner_2");
-	bulletSpawner2_->Initialize(
-		Vector3f(+4.0f, 0.5f, -4.0f), 
-		1.5f, 
-		[&]() 
-		{
-			Bullet* bullet = ObjectManager::Get().CreateObject<Bullet>(StringUtils::PrintF("Bullet_%d", countOfbullet_++));
-			Vector3f direction = MathUtils::Normalize(player_->GetTransform().GetLocation() - bulletSpawner2_->GetTransform().GetLocation());
-			float speed = MathUtils::GenerateRandomFloat(2.0f, 5.0f);
-
-			bullet->Initialize(bulletSpawner2_->GetTransform().GetLocation(), direction, speed, 0.2f);
-			bullets_.push_back(bullet);
-		}
-	);
-
-	bulletSpawner3_ = ObjectManager::Get().CreateObject<BulletSpawner>("BulletSpawner_3");
-	bulletSpawner3_->Initialize(
-		Vector3f(-4.0f, 0.5f, -4.0f), 
-		1.0f, 
-		[&]() {
-			Bullet* bullet = ObjectManager::Get().CreateObject<Bullet>(StringUtils::PrintF("Bullet_%d", countOfbullet_++));
-			Vector3f direction = MathUtils::Normalize(player_->GetTransform().GetLocation() - bulletSpawner3_->GetTransform().GetLocation());
-			float speed = MathUtils::GenerateRandomFloat(2.0f, 5.0f);
-
-			bullet->Initialize(bulletSpawner3_->GetTransform().GetLocation(), direction, speed, 0.2f);
-			bullets_.push_back(bullet);
-		}
-	);
-
 	board_ = ObjectManager::Get().CreateObject<UIBoard>("Board");
 	board_->Initialize();
 
@@ -389,18 +354,54 @@ void GameScene::LoadObjects()
 		);
 	}
 
-	renderObjects_ = {
-		floor_,
-		northWall_,
-		southWall_,
-		westWall_,
-		eastWall_,
-		bulletSpawner0_,
-		bulletSpawner1_,
-		bulletSpawner2_,
-		bulletSpawner3_,
-		player_,
-	};
+	BuildMeshBuffer();
+	renderObjects_ = simulation_.GetDynamicMeshObjects();
+
+	RecordPrevState();
+}
+
+void GameScene::BuildMeshBuffer()
+{
+	StaticBatch staticBatch;
+	staticBatch.Add(floor_->GetMesh(), floor_->GetTransform().GetWorldMatrix(), floor_->GetMaterial());
+
+	for (const auto& object : simulation_.GetStaticMeshObjects())
+	{
+		staticBatch.Add(object->GetMesh(), object->GetTransform().GetWorldMatrix(), object->GetMaterial());
+	}
+
+	const std::vector<StaticBatch::Batch>& batches = staticBatch.GetBatches();
+	const StaticMesh* bulletMesh = simulation_.GetBulletField()->GetMesh();
+
+	uint32_t vertexCapacity = static_cast<uint32_t>(bulletMesh->GetVertices().size());
+	uint32_t indexCapacity = bulletMesh->GetIndexCount();
+	for (const auto& batch : batches)
+	{
+		vertexCapacity += static_cast<uint32_t>(batch.vertices.size());
+		indexCapacity += static_cast<uint32_t>(batch.indices.size());
+	}
+
+	meshBuffer_ = ResourceManager::Get().CreateResource<MeshBuffer>("GameScene_MeshBuffer");
+	meshBuffer_->Initialize(vertexCapacity, indexCapacity);
+
+	for (const auto& batch : batches)
+	{
+		MeshBuffer::Allocation allocation;
+		bool bIsAllocated = meshBuffer_->Allocate(batch.vertices, batch.indices, allocation);
+		ASSERT(bIsAllocated, "failed to allocate static batch mesh in mesh buffer...");
+
+		staticBatchAllocations_.push_back(allocation);
+		staticBatchMaterials_.push_back(batch.material);
+	}
+
+	bool bIsAllocated = meshBuffer_->Allocate(bulletMesh->GetVertices(), bulletMesh->GetIndices(), bulletAllocation_);
+	ASSERT(bIsAllocated, "failed to allocate bullet mesh in mesh buffer...");
+}
+
+void GameScene::RecordPrevState()
+{
+	floor_->RecordPrevTransform();
+	simulation_.RecordPrevState();
 }
 
 void GameScene::UpdateScene(float deltaSeconds)
@@ -439,41 +440,31 @@ void GameScene::UpdateReadyStateScene(float deltaSeconds)
 		stepTime_ = 0.0f;
 		sceneState_ = ESceneState::Play;
 	}
-
-	camera_->Tick(deltaSeconds);
 }
 
 void GameScene::UpdatePlayStateScene(float deltaSeconds)
 {
-	player_->Tick(deltaSeconds);
-	camera_->Tick(deltaSeconds);
+	board_->Tick(deltaSeconds);
+	pauseButton_->Tick(deltaSeconds);
+}
 
-	bulletSpawner0_->Tick(deltaSeconds);
-	bulletSpawner1_->Tick(deltaSeconds);
-	bulletSpawner2_->Tick(deltaSeconds);
-	bulletSpawner3_->Tick(deltaSeconds);
+void GameScene::SimulatePlayStateScene(float fixedDeltaSeconds)
+{
+	simulation_.Tick(fixedDeltaSeconds);
 
-	bIsCollisionToPlayer_ = false;
-	for (auto& bullet : bullets_)
+	bIsCollisionToPlayer_ = simulation_.IsCollisionToPlayer();
+	if (bIsCollisionToPlayer_)
 	{
-		bullet->Tick(deltaSeconds);
-
-		if (bullet->IsCollisionToPlayer())
-		{
-			bIsCollisionToPlayer_ = true;
-		}
+		hitSound_->Reset();
+		hitSound_->Play();
 	}
 
-	board_->Tick(deltaSeconds);
-	pauseButton_->Tick(deltaSeconds);
-
-	if (player_->GetHP() <= 0)
+	Player* player = simulation_.GetPlayer();
+	if (player->GetHP() <= 0)
 	{
 		sceneState_ = ESceneState::Done;
-		playLogger_->RecordPlayLog(GameTimer::GetCurrentSystemTime(), player_->GetPlayTime());
+		playLogger_->RecordPlayLog(GameTimer::GetCurrentSystemTime(), player->GetPlayTime());
 	}
-
-	bullets_.remove_if(bulletRemoveEvent_);
 }
 
 void GameScene::UpdatePauseStateScene(float deltaSeconds)
@@ -492,25 +483,85 @@ void GameScene::UpdateDoneStateScene(float deltaSeconds)
 	board_->Tick(deltaSeconds);
 }
 
-void GameScene::RenderDepthScene()
+void GameScene::CollectDrawPackets()
 {
-	RenderManager::Get().SetViewport(0, 0, SHADOW_WIDTH, SHADOW_HEIGHT);
-	shadowMap_->Bind();
-	shadowMap_->Clear();
+	renderQueue_.Clear();
 
-	shadowShader_->Bind();
-	shadowShader_->SetLight(light_);
+	DrawPacket shadowPacket;
+	shadowPacket.pass = ERenderPass::Shadow;
+	shadowPacket.shader = shadowShader_;
+
+	DrawPacket opaquePacket;
+	opaquePacket.pass = ERenderPass::Opaque;
+	opaquePacket.shader = lightShader_;
+	opaquePacket.textureID = shadowMap_->GetShadowMapID();
+
+	for (std::size_t index = 0; index < staticBatchAllocations_.size(); ++index)
+	{
+		shadowPacket.meshBuffer = meshBuffer_;
+		shadowPacket.allocation = staticBatchAllocations_[index];
+		shadowPacket.world = Matrix4x4f::GetIdentity();
+		renderQueue_.Add(shadowPacket);
+
+		opaquePacket.meshBuffer = meshBuffer_;
+		opaquePacket.allocation = staticBatchAllocations_[index];
+		opaquePacket.material = staticBatchMaterials_[index];
+		opaquePacket.world = Matrix4x4f::GetIdentity();
+		renderQueue_.Add(opaquePacket);
+	}
+
+	shadowPacket.meshBuffer = nullptr;
+	opaquePacket.meshBuffer = nullptr;
 
 	for (const auto& object : renderObjects_)
 	{
-		shadowShader_->DrawMesh3D(object->GetTransform().GetWorldMatrix(), object->GetMesh());
+		Matrix4x4f world = object->GetInterpolatedTransform(interpolationAlpha_).GetWorldMatrix();
+
+		shadowPacket.mesh = object->GetMesh();
+		shadowPacket.world = world;
+		renderQueue_.Add(shadowPacket);
+
+		opaquePacket.mesh = object->GetMesh();
+		opaquePacket.material = object->GetMaterial();
+		opaquePacket.world = world;
+		renderQueue_.Add(opaquePacket);
 	}
 
-	for (const auto& bullet : bullets_)
+	const BulletField* bulletField = simulation_.GetBulletField();
+	bulletField->PackInstances(interpolationAlpha_, *bulletInstanceBuffer_);
+	if (bulletInstanceBuffer_->GetCountOfInstance() == 0)
 	{
-		shadowShader_->DrawMesh3D(bullet->GetTransform().GetWorldMatrix(), bullet->GetMesh());
+		return;
 	}
 
+	bulletInstanceBuffer_->Upload();
+
+	shadowPacket.shader = shadowInstancedShader_;
+	shadowPacket.meshBuffer = meshBuffer_;
+	shadowPacket.allocation = bulletAllocation_;
+	shadowPacket.instanceBuffer = bulletInstanceBuffer_;
+	renderQueue_.Add(shadowPacket);
+
+	opaquePacket.shader = lightInstancedShader_;
+	opaquePacket.meshBuffer = meshBuffer_;
+	opaquePacket.allocation = bulletAllocation_;
+	opaquePacket.material = bulletField->GetMaterial();
+	opaquePacket.instanceBuffer = bulletInstanceBuffer_;
+	renderQueue_.Add(opaquePacket);
+}
+
+void GameScene::RenderDepthScene()
+{
+	RenderManager::Get().SetViewport(0, 0, SHADOW_WIDTH, SHADOW_HEIGHT);
+	shadowMap_->Bind();
+	shadowMap_->Clear();
+
+	// ε н  н ̴   ε  Ƿ, ī޶ Ʈ Ӹ   ϴ.
+	frameUniformBuffer_->SetBlock(0, FrameUniformBlock::Create(camera_, light_));
+	frameUniformBuffer_->Bind(0);
+
+	renderQueue_.Submit(renderBackend_, ERenderPass::Shadow);
+
 	shadowShader_->Unbind();
 	shadowMap_->Unbind();
 }
@@ -525,28 +576,15 @@ void GameScene::RenderScene()
 		framebuffer_->Clear(0.0f, 0.0f, 0.0f, 1.0f);
 	}
 
-	lightShader_->Bind();
-	lightShader_->SetLight(light_);
-	lightShader_->SetCamera(camera_);
-
-	for (const auto& object : renderObjects_)
-	{
-		lightShader_->SetMaterial(object->GetMaterial());
-		lightShader_->DrawMesh3D(object->GetTransform().GetWorldMatrix(), object->GetMesh(), shadowMap_);
-	}
-
-	for (const auto& bullet : bullets_)
-	{
-		lightShader_->DrawMesh3D(bullet->GetTransform().GetWorldMatrix(), bullet->GetMesh(), shadowMap_);
-	}
+	renderQueue_.Submit(renderBackend_, ERenderPass::Opaque);
 
 	lightShader_->Unbind();
 	
-	player_->RenderHP(camera_);
-	bulletSpawner0_->RenderRespawnTime(camera_);
-	bulletSpawner1_->RenderRespawnTime(camera_);
-	bulletSpawner2_->RenderRespawnTime(camera_);
-	bulletSpawner3_->RenderRespawnTime(camera_);
+	simulation_.GetPlayer()->RenderHP(camera_, interpolationAlpha_);
+	for (const auto& bulletSpawner : simulation_.GetBulletSpawners())
+	{
+		bulletSpawner->RenderRespawnTime(camera_);
+	}
 
 	if (sceneState_ != ESceneState::Play)
 	{
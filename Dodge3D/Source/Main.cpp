@@ -1,5 +1,7 @@
 #include "IApplication.h"
 
+#include "AssetPack.h"
+#include "BulletPattern.h"
 #include "Config.h"
 #include "GameScene.h"
 #include "RankScene.h"
@@ -40,6 +42,7 @@ public:
 	{
 		IApplication::SetProperties(WINDOW_TITLE, WINDOW_X, WINDOW_Y, WINDOW_W, WINDOW_H, WINDOW_RESIZE, WINDOW_FULLSCREEN, WINDOW_VSYNC, WINDOW_IMGUI);
 		IApplication::Setup();
+		IApplication::SetFixedTimestep(FIXED_STEP_RATE, MAX_STEPS_PER_FRAME);
 
 		clientPath_ = rootPath_ + L"Dodge3D/";
 
@@ -47,6 +50,7 @@ public:
 
 		LoadResources();
 		LoadScenes();
+		SetupInputStream();
 	}
 
 
@@ -56,6 +60,12 @@ public:
 	virtual void Shutdown() override
 	{
 		IApplication::Shutdown();
+
+		// 尡   ε ޸𸮸 ϹǷ, ҽ   ڿ   մϴ.
+		if (assetPack_.IsInitialized())
+		{
+			assetPack_.Release();
+		}
 	}
 
 
@@ -71,16 +81,35 @@ public:
 		while (!bIsDoneLoop_)
 		{
 			timer_.Tick();
-			InputManager::Get().Tick();
+			InputManager::Get().Tick(timer_.GetDeltaSeconds());
 
-			currentScene->Tick(timer_.GetDeltaSeconds());
+			TickScene(currentScene, InputManager::Get().GetDeltaSeconds());
 
 			if (currentScene->DetectSwitchScene())
 			{
 				currentScene->ExitScene();
+				ObjectManager::Get().FlushDestroyedObjects();
+
 				currentScene = currentScene->GetNextScene();
 				currentScene->EnterScene();
 			}
+
+			ObjectManager::Get().FlushDestroyedObjects();
+
+			if (bIsReplayInput_ && !InputManager::Get().IsReplaying())
+			{
+				bIsDoneLoop_ = true;
+			}
+		}
+
+		if (bIsReplayInput_ && InputManager::Get().HasReplayError())
+		{
+			MessageBoxW(nullptr, L"Replay input stream is truncated...", L"Error", MB_OK);
+		}
+
+		if (InputManager::Get().IsRecording())
+		{
+			FileUtils::WriteBufferToFile(recordInputPath_, InputManager::Get().StopRecording());
 		}
 	}
 
@@ -88,27 +117,181 @@ public:
 private:
 	/**
 	 * @brief ҽ εմϴ.
+	 *
+	 * @note
+	 * - Ʈ Ʋ ŷ,  ڵ,   Ľ ۾ 忡 մϴ.
+	 * -   ٸ   Ŵ  ̴ ϰ, غ Ʈ Ʋ󽺸 ؽó øϴ.
+	 * -  Ŀ ŷ  ִٸ   Ʈ Ʋ󽺿 ڵ PCM 带 εմϴ.
+	 * - ŷ   ִٸ   ؼ, Ʈ, , ̴,      ε ޸𸮿 нϴ.
 	 */
 	void LoadResources()
 	{
-		std::wstring resourcePath = clientPath_ + L"Resource/";
+		bool bIsCooked = !IApplication::GetCookedPath().empty();
+		std::wstring resourcePath = bIsCooked ? IApplication::GetCookedPath() + L"Resource/" : clientPath_ + L"Resource/";
+		std::wstring soundExtension = bIsCooked ? L".wav" : L".mp3";
+		std::wstring fontPath = resourcePath + L"Font/SeoulNamsanEB.ttf";
+
+		std::wstring assetPackPath = IApplication::GetCookedPath() + L"Dodge3D.pack";
+		if (bIsCooked && FileUtils::IsValidPath(assetPackPath))
+		{
+			if (assetPack_.Initialize(assetPackPath))
+			{
+				RenderManager::Get().SetAssetPack(&assetPack_);
+			}
+			else
+			{
+				MessageBoxW(nullptr, L"Invalid asset pack file, load cooked asset files instead...", L"Error", MB_OK);
+			}
+		}
+
+		bool bIsPacked = assetPack_.IsInitialized();
+
+		// ȣ ִ Ÿ Ʋ    ũ Ʈ մϴ.
+		ResourceManager::LoadHandle<TTFont> fontAtlas = ResourceManager::Get().LoadAsync<TTFont>("FontAtlas",
+			[this, bIsPacked, fontPath](TTFont*)
+			{
+				if (!bIsPacked)
+				{
+					return TTFont::LoadGlyphAtlas(fontPath, 32, 127, 64.0f, GlyphAtlas::EType::SignedDistanceField);
+				}
+
+				std::string fontName = "Resource/Font/SeoulNamsanEB.ttf";
+				std::string atlasName = StringUtils::Convert(TTFont::GetBakedGlyphAtlasPath(StringUtils::Convert(fontName), 64.0f, GlyphAtlas::EType::SignedDistanceField));
+
+				std::vector<uint8_t> fontDecompressBuffer;
+				std::vector<uint8_t> atlasDecompressBuffer;
+				BufferView fontBuffer = assetPack_.Read(fontName, fontDecompressBuffer);
+				BufferView atlasBuffer = assetPack_.HasEntry(atlasName) ? assetPack_.Read(atlasName, atlasDecompressBuffer) : BufferView();
+
+				GlyphAtlas glyphAtlas;
+				TTFont::LoadGlyphAtlasFromBuffer(fontBuffer, atlasBuffer, 32, 127, 64.0f, GlyphAtlas::EType::SignedDistanceField, glyphAtlas);
+				return glyphAtlas;
+			},
+			[](TTFont* font, const GlyphAtlas& glyphAtlas) { font->Initialize(glyphAtlas); }
+		);
+
+		const std::array<std::pair<std::string, std::wstring>, 2> sounds = {
+			std::make_pair("ButtonClick", L"Sound/ButtonClick"),
+			std::make_pair("Hit",         L"Sound/Hit"),
+		};
+
+		//  ۸ ϸ鼭 ڵϹǷ,  ѿ  Ǭ ۴ 庸  մϴ.
+		soundDecompressBuffers_.resize(sounds.size());
+
+		for (std::size_t index = 0; index < sounds.size(); ++index)
+		{
+			const auto& soundFile = sounds[index];
+			std::wstring soundPath = resourcePath + soundFile.second + soundExtension;
+			std::string soundName = StringUtils::Convert(L"Resource/" + soundFile.second + soundExtension);
+			std::vector<uint8_t>& soundDecompressBuffer = soundDecompressBuffers_[index];
+
+			ResourceManager::Get().LoadAsync<Sound>(soundFile.first,
+				[this, bIsPacked, soundPath, soundName, &soundDecompressBuffer](Sound* sound)
+				{
+					if (bIsPacked)
+					{
+						sound->Initialize(assetPack_.Read(soundName, soundDecompressBuffer));
+					}
+					else
+					{
+						sound->Initialize(soundPath);
+					}
+				},
+				[](Sound* sound) { sound->SetLooping(false); }
+			);
+		}
+
+		const std::array<std::pair<std::string, std::wstring>, 5> patterns = {
+			std::make_pair("AimedSlowPattern",   L"Pattern/AimedSlow.json"),
+			std::make_pair("AimedFastPattern",   L"Pattern/AimedFast.json"),
+			std::make_pair("RingBurstPattern",   L"Pattern/RingBurst.json"),
+			std::make_pair("SpiralStormPattern", L"Pattern/SpiralStorm.json"),
+			std::make_pair("FanWavePattern",     L"Pattern/FanWave.json"),
+		};
+
+		for (const auto& patternFile : patterns)
+		{
+			std::wstring patternPath = resourcePath + patternFile.second;
+			std::string patternName = StringUtils::Convert(L"Resource/" + patternFile.second);
+
+			ResourceManager::Get().LoadAsync<BulletPattern>(patternFile.first,
+				[this, bIsPacked, patternPath, patternName](BulletPattern*)
+				{
+					if (!bIsPacked)
+					{
+						return FileUtils::ReadJsonFromFile(patternPath);
+					}
+
+					std::vector<uint8_t> patternDecompressBuffer;
+					return FileUtils::ReadJsonFromBuffer(assetPack_.Read(patternName, patternDecompressBuffer));
+				},
+				[](BulletPattern* bulletPattern, const Json::Value& root) { bulletPattern->Initialize(root); }
+			);
+		}
+
+		TTFont* atlasFont = fontAtlas.Wait();
 
 		TTFont* font32 = ResourceManager::Get().CreateResource<TTFont>("Font32");
-		font32->Initialize(resourcePath + L"Font/SeoulNamsanEB.ttf", 32, 127, 32.0f);
+		font32->Initialize(atlasFont, 32.0f);
 
 		TTFont* font64 = ResourceManager::Get().CreateResource<TTFont>("Font64");
-		font64->Initialize(resourcePath + L"Font/SeoulNamsanEB.ttf", 32, 127, 64.0f);
+		font64->Initialize(atlasFont, 64.0f);
 
 		TTFont* font128 = ResourceManager::Get().CreateResource<TTFont>("Font128");
-		font128->Initialize(resourcePath + L"Font/SeoulNamsanEB.ttf", 32, 127, 128.0f);
+		font128->Initialize(atlasFont, 128.0f);
+
+		ResourceManager::Get().WaitAsyncLoads();
 
-		Sound* buttonClickSound = ResourceManager::Get().CreateResource<Sound>("ButtonClick");
-		buttonClickSound->Initialize(resourcePath + L"Sound/ButtonClick.mp3");
-		buttonClickSound->SetLooping(false);
+#if defined(DEBUG_MODE) || defined(RELEASE_MODE) || defined(DEVELOPMENT_MODE)
+		double totalSeconds = 0.0;
+		double readySeconds = 0.0;
+		for (const auto& record : ResourceManager::Get().GetLoadRecords())
+		{
+			DebugPrintF("[LoadResources] %-20s load %8.3f ms, finalize %8.3f ms, ready at %8.3f ms\n", record.name.c_str(), record.loadSeconds * 1000.0, record.finalizeSeconds * 1000.0, record.readySeconds * 1000.0);
 
-		Sound* hitSound = ResourceManager::Get().CreateResource<Sound>("Hit");
-		hitSound->Initialize(resourcePath + L"Sound/Hit.mp3");
-		hitSound->SetLooping(false);
+			totalSeconds += record.loadSeconds + record.finalizeSeconds;
+			readySeconds = std::max(readySeconds, record.readySeconds);
+		}
+
+		DebugPrintF("[LoadResources] serial %8.3f ms, parallel %8.3f ms\n", totalSeconds * 1000.0, readySeconds * 1000.0);
+#endif
+	}
+
+
+	/**
+	 * @brief  ڿ  Է Ʈ  Ȥ  մϴ.
+	 *
+	 * @note
+	 * - recordInput=<> : ÷ Է°  õ带 ϰ   Ϸ մϴ.
+	 * - replayInput=<> :  Է ϸ,     մϴ.
+	 * -  ߿ ϵ Ÿ ð ϹǷ  ȭ  ִ ӵ մϴ.
+	 * -  Է Ʈ ùٸ ʴٸ  ˸   ٷ մϴ.
+	 */
+	void SetupInputStream()
+	{
+		std::wstring replayInputPath;
+		if (CommandLineUtils::GetStringValue(L"replayInput", replayInputPath))
+		{
+			bIsReplayInput_ = true;
+
+			if (!InputManager::Get().StartReplay(FileUtils::ReadBufferFromFile(replayInputPath)))
+			{
+				MessageBoxW(nullptr, L"Invalid replay input stream...", L"Error", MB_OK);
+				return;
+			}
+
+			MathUtils::SetRandomSeed(InputManager::Get().GetInputStreamSeed());
+			RenderManager::Get().SetVsyncMode(false);
+			return;
+		}
+
+		if (CommandLineUtils::GetStringValue(L"recordInput", recordInputPath_))
+		{
+			uint64_t randomSeed = MathUtils::GetThreadRandomStream().NextUInt64();
+
+			MathUtils::SetRandomSeed(randomSeed);
+			InputManager::Get().StartRecording(randomSeed);
+		}
 	}
 
 
@@ -148,6 +331,34 @@ private:
 	GameTimer timer_;
 
 
+	/**
+	 * @brief Է Ʈ  Դϴ.
+	 */
+	std::wstring recordInputPath_;
+
+
+	/**
+	 * @brief ϵ Է Ʈ   Ȯմϴ.
+	 */
+	bool bIsReplayInput_ = false;
+
+
+	/**
+	 * @brief ŷ    Դϴ.
+	 *
+	 * @note ŷ   ٸ ʱȭ ʰ,   εմϴ.
+	 */
+	AssetPack assetPack_;
+
+
+	/**
+	 * @brief  ѿ  Ǭ  Դϴ.
+	 *
+	 * @note  ۸  ʰ ϸ鼭 ڵϹǷ, 带   մϴ.
+	 */
+	std::vector<std::vector<uint8_t>> soundDecompressBuffers_;
+
+
 	/**
 	 * @brief    ̺ƮԴϴ.
 	 */
@@ -12,6 +12,7 @@ MovableCamera::~MovableCamera() {}
 void MovableCamera::Initialize()
 {
 	relativePosition_ = Vector3f(0.0f, 7.0f, 7.0f);
+	playerHandle_ = ObjectManager::Get().FindHandle("Player");
 
 	Window* window = RenderManager::Get().GetRenderTargetWindow();
 	Camera3D::Initialize(
@@ -22,8 +23,13 @@ void MovableCamera::Initialize()
 
 void MovableCamera::Tick(float deltaSeconds)
 {
-	Player* player = ObjectManager::Get().GetObject<Player>("Player");
-	Vector3f playerPosition = player->GetTransform().GetLocation();
+	FollowPlayer(1.0f);
+}
+
+void MovableCamera::FollowPlayer(float interpolationAlpha)
+{
+	Player* player = ObjectManager::Get().Resolve<Player>(playerHandle_);
+	Vector3f playerPosition = player->GetInterpolatedTransform(interpolationAlpha).GetLocation();
 
 	SetEyePosition(playerPosition + relativePosition_);
 }
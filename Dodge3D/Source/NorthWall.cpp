@@ -1,7 +1,9 @@
 #include "NorthWall.h"
 
 #include "Assertion.h"
+#include "CollisionWorld.h"
 #include "GeometryGenerator.h"
+#include "ObjectManager.h"
 #include "ResourceManager.h"
 
 NorthWall::~NorthWall()
@@ -27,10 +29,10 @@ void NorthWall::Initialize()
 		mesh_->Initialize(vertices, indices);
 	}
 
-	material_ = ResourceManager::Get().GetResource<Material>("NorthWallMaterial");
+	material_ = ResourceManager::Get().GetResource<Material>("WallMaterial");
 	if (!material_)
 	{
-		material_ = ResourceManager::Get().CreateResource<Material>("NorthWallMaterial");
+		material_ = ResourceManager::Get().CreateResource<Material>("WallMaterial");
 		material_->Initialize(
 			Vector3f(0.19225f, 0.19225f, 0.19225f),
 			Vector3f(0.50754f, 0.50754f, 0.50754f),
@@ -42,6 +44,14 @@ void NorthWall::Initialize()
 	transform_ = Transform(Vector3f(0.0f, 0.5f, -5.5f), Vector3f(0.0f, 0.0f, 0.0f), Vector3f(1.0f, 1.0f, 1.0f));
 	boundingVolume_ = Box3D(transform_.GetLocation(), Vector3f(10.0f, 1.0f, 1.0f));
 
+	CollisionWorld* collisionWorld = ObjectManager::Get().GetObject<CollisionWorld>("CollisionWorld");
+	collisionWorld->CreateBoxProxy(
+		boundingVolume_,
+		static_cast<uint32_t>(ECollisionLayer::Wall),
+		static_cast<uint32_t>(ECollisionLayer::Player) | static_cast<uint32_t>(ECollisionLayer::Bullet),
+		0
+	);
+
 	bIsInitialized_ = true;
 }
 
@@ -5,8 +5,8 @@
 #include "Assertion.h"
 #include "CommandLineUtils.h"
 #include "FileUtils.h"
+#include "FixedString.h"
 #include "IApplication.h"
-#include "StringUtils.h"
 #include "RenderManager.h"
 #include "ResourceManager.h"
 #include "TTFont.h"
@@ -48,6 +48,12 @@ void PlayLogger::Initialize()
 
 	maxLogCount_ = 5;
 
+	logLayouts_.resize(maxLogCount_);
+	for (auto& logLayout : logLayouts_)
+	{
+		logLayout = std::make_unique<TextLayout>();
+	}
+
 	bIsInitialized_ = true;
 }
 
@@ -57,15 +63,19 @@ void PlayLogger::Tick(float deltaSeconds)
 
 void PlayLogger::Render()
 {
-	RenderManager::Get().RenderText2D(font64_, L"Rank", rankCenter_, Vector4f(1.0f, 1.0f, 1.0f, 1.0f));
+	rankLayout_.Update(font64_, L"Rank", rankCenter_);
+	RenderManager::Get().RenderTextLayout(rankLayout_, Vector4f(1.0f, 1.0f, 1.0f, 1.0f));
 
 	Vector2f center = logCenter_;
 	for (std::size_t index = 0; index < playLog_.size() && index < maxLogCount_; ++index)
 	{
 		Vector4f color = (playLog_[index].day == recentPlayLog.day && playLog_[index].time == recentPlayLog.time) ? logRecentColor_ : logColor_;
-		std::wstring logText = StringUtils::PrintF(L"%19s %3d", playLog_[index].day.c_str(), static_cast<int32_t>(playLog_[index].time));
+		FixedWString<64> logText;
+		logText.Format(L"%19ls %3d", playLog_[index].day.c_str(), static_cast<int32_t>(playLog_[index].time));
 		
-		RenderManager::Get().RenderText2D(font32_, logText, center, color);
+		TextLayout* logLayout = logLayouts_[index].get();
+		logLayout->Update(font32_, logText, center);
+		RenderManager::Get().RenderTextLayout(*logLayout, color);
 
 		center.y += logStride_;
 	}
@@ -77,6 +87,13 @@ void PlayLogger::Release()
 
 	WriteLogFile();
 
+	rankLayout_.Release();
+	for (auto& logLayout : logLayouts_)
+	{
+		logLayout->Release();
+	}
+	logLayouts_.clear();
+
 	bIsInitialized_ = false;
 }
 
@@ -0,0 +1,139 @@
+#include "PlaySimulation.h"
+
+#include "Assertion.h"
+#include "CollisionWorld.h"
+#include "ObjectManager.h"
+
+#include "BulletField.h"
+#include "BulletPattern.h"
+#include "BulletSpawner.h"
+#include "EastWall.h"
+#include "NorthWall.h"
+#include "Player.h"
+#include "SouthWall.h"
+#include "WestWall.h"
+
+/**
+ * @brief ùķ̼ õ ȿ Ѿ ӷ  Ʈ ϴ ȣԴϴ.
+ *
+ * @note  ϴ  ý ߰Ǹ  ٸ Ʈ ȣ ؾ մϴ.
+ */
+static const uint64_t BULLET_SPEED_STREAM = 0;
+
+void PlaySimulation::Initialize(const std::vector<BulletSpawnerParam>& bulletSpawnerParams, uint32_t bulletCapacity, uint64_t randomSeed)
+{
+	ASSERT(!bIsInitialized_, "already initialize play simulation...");
+
+	bulletRandomStream_.Seed(randomSeed, BULLET_SPEED_STREAM);
+
+	collisionWorld_ = ObjectManager::Get().CreateObject<CollisionWorld>("CollisionWorld");
+	collisionWorld_->Initialize(CollisionWorld::EBroadphase::UniformGrid, Vector3f(-6.0f, -1.0f, -6.0f), Vector3f(+6.0f, +2.0f, +6.0f), 1.0f);
+
+	player_ = ObjectManager::Get().CreateObject<Player>("Player");
+	player_->Initialize();
+
+	northWall_ = ObjectManager::Get().CreateObject<NorthWall>("NorthWall");
+	northWall_->Initialize();
+
+	southWall_ = ObjectManager::Get().CreateObject<SouthWall>("SouthWall");
+	southWall_->Initialize();
+
+	westWall_ = ObjectManager::Get().CreateObject<WestWall>("WestWall");
+	westWall_->Initialize();
+
+	eastWall_ = ObjectManager::Get().CreateObject<EastWall>("EastWall");
+	eastWall_->Initialize();
+
+	bulletField_ = ObjectManager::Get().CreateObject<BulletField>("BulletField");
+	bulletField_->Initialize(bulletCapacity);
+
+	objectSignatures_ = { "CollisionWorld", "Player", "NorthWall", "SouthWall", "WestWall", "EastWall", "BulletField" };
+	staticMeshObjects_ = { northWall_, southWall_, westWall_, eastWall_ };
+
+	bulletSpawners_.clear();
+	dynamicMeshObjects_.clear();
+	for (std::size_t index = 0; index < bulletSpawnerParams.size(); ++index)
+	{
+		std::string signature = "BulletSpawner_" + std::to_string(index);
+
+		BulletSpawner* bulletSpawner = ObjectManager::Get().CreateObject<BulletSpawner>(signature);
+		bulletSpawner->Initialize(bulletSpawnerParams[index].location, bulletSpawnerParams[index].pattern, &bulletRandomStream_);
+
+		bulletSpawners_.push_back(bulletSpawner);
+		dynamicMeshObjects_.push_back(bulletSpawner);
+		objectSignatures_.push_back(signature);
+	}
+
+	dynamicMeshObjects_.push_back(player_);
+
+	meshObjects_ = staticMeshObjects_;
+	meshObjects_.insert(meshObjects_.end(), dynamicMeshObjects_.begin(), dynamicMeshObjects_.end());
+
+	// ÷̾ ù Ʈ  浹 ˻  ֵ ε ̸ մϴ.
+	collisionWorld_->Tick(0.0f);
+
+	RecordPrevState();
+
+	bIsInitialized_ = true;
+}
+
+void PlaySimulation::Tick(float fixedDeltaSeconds)
+{
+	player_->Tick(fixedDeltaSeconds);
+
+	for (auto& bulletSpawner : bulletSpawners_)
+	{
+		bulletSpawner->Tick(fixedDeltaSeconds);
+		bulletField_->SpawnBatch(bulletSpawner->GetEmissions(), bulletSpawner->GetPattern()->GetRadius());
+	}
+
+	bulletField_->Tick(fixedDeltaSeconds);
+	collisionWorld_->Tick(fixedDeltaSeconds);
+	bulletField_->ResolveCollision();
+}
+
+void PlaySimulation::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	for (auto signature = objectSignatures_.rbegin(); signature != objectSignatures_.rend(); ++signature)
+	{
+		ObjectManager::Get().DestroyObject(*signature);
+	}
+
+	objectSignatures_.clear();
+	meshObjects_.clear();
+	staticMeshObjects_.clear();
+	dynamicMeshObjects_.clear();
+	bulletSpawners_.clear();
+
+	collisionWorld_ = nullptr;
+	player_ = nullptr;
+	northWall_ = nullptr;
+	southWall_ = nullptr;
+	westWall_ = nullptr;
+	eastWall_ = nullptr;
+	bulletField_ = nullptr;
+
+	bIsInitialized_ = false;
+}
+
+void PlaySimulation::RecordPrevState()
+{
+	for (auto& object : meshObjects_)
+	{
+		object->RecordPrevTransform();
+	}
+
+	bulletField_->RecordPrevLocations();
+}
+
+bool PlaySimulation::IsCollisionToPlayer() const
+{
+	return bulletField_->IsCollisionToPlayer();
+}
+
+uint32_t PlaySimulation::GetCountOfBullet() const
+{
+	return bulletField_->GetCountOfAlive();
+}
\ No newline at end of file
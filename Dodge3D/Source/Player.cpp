@@ -1,18 +1,18 @@
 #include "Player.h"
-#include "EastWall.h"
-#include "NorthWall.h"
-#include "SouthWall.h"
-#include "WestWall.h"
 
 #include "Assertion.h"
 #include "Camera3D.h"
+#include "CollisionWorld.h"
 #include "GeometryGenerator.h"
 #include "InputManager.h"
 #include "ObjectManager.h"
 #include "MathUtils.h"
-#include "RenderManager.h"
 #include "ResourceManager.h"
 
+#if !defined(HEADLESS_MODE)
+#include "RenderManager.h"
+#endif
+
 Player::~Player()
 {
 	if (bIsInitialized_)
@@ -50,6 +50,15 @@ void Player::Initialize()
 
 	transform_ = Transform(Vector3f(0.0f, 0.5f, 0.0f), Vector3f(0.0f, 0.0f, 0.0f), Vector3f(1.0f, 1.0f, 1.0f));
 	boundingVolume_ = Sphere3D(transform_.GetLocation(), 0.25f);
+
+	collisionWorld_ = ObjectManager::Get().GetObject<CollisionWorld>("CollisionWorld");
+	proxy_ = collisionWorld_->CreateSphereProxy(
+		boundingVolume_,
+		static_cast<uint32_t>(ECollisionLayer::Player),
+		static_cast<uint32_t>(ECollisionLayer::Wall) | static_cast<uint32_t>(ECollisionLayer::Bullet),
+		0
+	);
+
 	currentHP_ = maxHP_;
 	playTime_ = 0.0f;
 	hpWidth_ = 1.0f;
@@ -88,7 +97,7 @@ void Player::Tick(float deltaSeconds)
 
 	boundingVolume_.SetCenter(position);
 
-	if (!CheckCollisionToWall())
+	if (!collisionWorld_->QueryOverlap(&boundingVolume_, static_cast<uint32_t>(ECollisionLayer::Wall)))
 	{
 		transform_.SetLocation(position);
 	}
@@ -96,6 +105,8 @@ void Player::Tick(float deltaSeconds)
 	{
 		boundingVolume_.SetCenter(transform_.GetLocation());
 	}
+
+	collisionWorld_->UpdateSphereProxy(proxy_, boundingVolume_.GetCenter());
 }
 
 void Player::Release()
@@ -110,20 +121,12 @@ void Player::SetHP(int32_t hp)
 	currentHP_ = MathUtils::Clamp<int32_t>(hp, minHP_, maxHP_);
 }
 
-void Player::RenderHP(const Camera3D* camera)
+#if !defined(HEADLESS_MODE)
+void Player::RenderHP(const Camera3D* camera, float interpolationAlpha)
 {
-	Matrix4x4f world = transform_.GetWorldMatrix() * MathUtils::CreateTranslation(Vector3f(0.0f, 1.0f, 0.0f));
+	Matrix4x4f world = GetInterpolatedTransform(interpolationAlpha).GetWorldMatrix() * MathUtils::CreateTranslation(Vector3f(0.0f, 1.0f, 0.0f));
 	float rate = static_cast<float>(currentHP_) / static_cast<float>(maxHP_ - minHP_);
 
 	RenderManager::Get().RenderHorizonDividQuad3D(world, camera, hpWidth_, hpHeight_, rate, hpColor_, backgroundColor_);
 }
-
-bool Player::CheckCollisionToWall()
-{
-	NorthWall* northWall = ObjectManager::Get().GetObject<NorthWall>("NorthWall");
-	SouthWall* southWall = ObjectManager::Get().GetObject<SouthWall>("SouthWall");
-	WestWall* westWall = ObjectManager::Get().GetObject<WestWall>("WestWall");
-	EastWall* eastWall = ObjectManager::Get().GetObject<EastWall>("EastWall");
-
-	return IsCollision(northWall) || IsCollision(southWall) || IsCollision(westWall) || IsCollision(eastWall);
-}
\ No newline at end of file
+#endif
\ No newline at end of file
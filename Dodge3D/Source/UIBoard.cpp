@@ -1,10 +1,10 @@
 #include "UIBoard.h"
 #include "Player.h"
 
+#include "FixedString.h"
 #include "RenderManager.h"
 #include "ResourceManager.h"
 #include "ObjectManager.h"
-#include "StringUtils.h"
 #include "TTFont.h"
 #include "Window.h"
 
@@ -40,14 +40,20 @@ void UIBoard::Initialize()
 	};
 	
 	UIPanel::Initialize(param);
+
+	playerHandle_ = ObjectManager::Get().FindHandle("Player");
 }
 
 void UIBoard::Tick(float deltaSeconds)
 {
-	Player* player = ObjectManager::Get().GetObject<Player>("Player");
+	Player* player = ObjectManager::Get().Resolve<Player>(playerHandle_);
 
 	center_ = GetCenterFromWindow();
-	text_ = StringUtils::PrintF(L"TIME : %3d", static_cast<int32_t>(player->GetPlayTime()));
+
+	//   ϹǷ  ũ ۿ ȭϰ, ؽƮ  뷮 ؼ մϴ.
+	FixedWString<32> timeText;
+	timeText.Format(L"TIME : %3d", static_cast<int32_t>(player->GetPlayTime()));
+	text_.assign(timeText.GetCStr(), timeText.GetSize());
 }
 
 Vector2f UIBoard::GetCenterFromWindow()
@@ -0,0 +1,1184 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <json/json.h>
+#include <miniaudio.h>
+#include <stb_image.h>
+#include <stb_truetype.h>
+
+#include "AssetPack.h"
+#include "GlyphAtlas.h"
+#include "JobSystem.h"
+#include "MipChain.h"
+#include "StringId.h"
+#include "StringUtils.h"
+#include "TTFont.h"
+
+
+/**
+ * @brief  Ŀ Դϴ.
+ *
+ * @note ŷ ̳   ٲ   ÷  ŷ   ٽ ŷմϴ.
+ */
+static const uint32_t ASSET_COOKER_VERSION = 1;
+
+
+/**
+ * @brief  丮 ϴ ŷ Ŵ佺Ʈ  ̸Դϴ.
+ */
+static const char* COOK_MANIFEST_FILE_NAME = "AssetCookManifest.json";
+
+
+/**
+ * @brief ŷ  PCM  Դϴ.
+ */
+static const ma_format COOKED_SOUND_FORMAT = ma_format_s16;
+
+
+/**
+ * @brief 带 ڵ     PCM  Դϴ.
+ */
+static const ma_uint64 DECODE_FRAME_CHUNK = 4096;
+
+
+/**
+ * @brief   ŷ ĢԴϴ.
+ */
+enum class ECookRule : int32_t
+{
+	Font    = 0x00, // Ʈ Ÿ Ʈ ϰ ۸ ؽó Ʋ󽺸   Ӵϴ.
+	Sound   = 0x01, //  带 ڵؼ PCM WAV Ϸ մϴ.
+	Texture = 0x02, // ̹ ڵϰ Ӹ ü ؼ .mips Ϸ մϴ.
+	Shader  = 0x03, // ̴ ҽ ϰ ּ   ؼ մϴ.
+	Copy    = 0x04, // ״ մϴ.
+};
+
+
+/**
+ * @brief  Ŀ ŷ Դϴ.
+ *
+ * @note ⺻    εϴ Ʈ Ʋ󽺿 ϴ.
+ */
+struct CookSettings
+{
+	int32_t fontBeginCodePoint = 32;                                    // ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+	int32_t fontEndCodePoint = 127;                                     // ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+	float fontSize = 64.0f;                                             // ۸ ؽó Ʋ Ʈ ũԴϴ.
+	GlyphAtlas::EType fontType = GlyphAtlas::EType::SignedDistanceField; // ۸ ؽó Ʋ Ʈ Դϴ.
+};
+
+
+/**
+ * @brief ŷ  Դϴ.
+ */
+struct CookedFile
+{
+	std::string name;              //  丮  ̸Դϴ. ex. "Resource/Sound/Hit.wav"
+	uint64_t size = 0;             //  ũԴϴ.
+	uint64_t hash = 0;             //   ؽ Դϴ.
+};
+
+
+/**
+ * @brief   ϳ ŷ ۾Դϴ.
+ */
+struct CookJob
+{
+	std::string name;                  //  ̸Դϴ. Է 丮 ̸ մϴ. ex. "Resource/Sound/Hit.mp3"
+	std::filesystem::path path;        //   Դϴ.
+	ECookRule rule = ECookRule::Copy;  //   ŷ ĢԴϴ.
+	uint64_t sourceHash = 0;           //    ؽ Դϴ.
+	uint64_t ruleHash = 0;             // Ŀ , ŷ Ģ, ŷ  ؽ Դϴ.
+	bool bIsCooked = false;            // ̹ ࿡ ŷߴ Դϴ. false   ״ մϴ.
+	bool bIsSuccess = false;           // ŷ ߴ Դϴ.
+	std::string error;                 // ŷ  Դϴ.
+	std::vector<CookedFile> outputs;   // ŷ  ϵԴϴ.
+	double seconds = 0.0;              // ŷ ɸ ðԴϴ.
+};
+
+
+/**
+ * @brief  ࿡ ŷ  Դϴ.
+ */
+struct CookRecord
+{
+	uint64_t sourceHash = 0;           // ŷ     ؽ Դϴ.
+	uint64_t ruleHash = 0;             // ŷ  Ŀ , ŷ Ģ, ŷ  ؽ Դϴ.
+	std::vector<CookedFile> outputs;   // ŷ  ϵԴϴ.
+};
+
+
+/**
+ * @brief   ؽ  մϴ.
+ *
+ * @param buffer ؽ   Դϴ.
+ *
+ * @return   FNV-1a 64Ʈ ؽ  ȯմϴ.
+ */
+uint64_t HashBuffer(const BufferView& buffer)
+{
+	return StringId::Hash(buffer.GetStringView());
+}
+
+
+/**
+ * @brief ؽ  Ŵ佺Ʈ  16ڸ 16 ڿ ٲߴϴ.
+ *
+ * @param hash ٲ ؽ Դϴ.
+ *
+ * @return 16 ڿ ȯմϴ.
+ */
+std::string ToHexString(uint64_t hash)
+{
+	return StringUtils::PrintF("%016llx", static_cast<unsigned long long>(hash));
+}
+
+
+/**
+ * @brief 16ڸ 16 ڿ ؽ  ٲߴϴ.
+ *
+ * @param text ٲ 16 ڿԴϴ.
+ *
+ * @return ؽ  ȯմϴ. ùٸ 16 ڿ ƴ϶ 0 ȯմϴ.
+ */
+uint64_t FromHexString(const std::string& text)
+{
+	uint64_t hash = 0;
+	for (char character : text)
+	{
+		uint64_t digit = 0;
+		if (character >= '0' && character <= '9')
+		{
+			digit = static_cast<uint64_t>(character - '0');
+		}
+		else if (character >= 'a' && character <= 'f')
+		{
+			digit = static_cast<uint64_t>(character - 'a' + 10);
+		}
+		else
+		{
+			return 0;
+		}
+
+		hash = (hash << 4) | digit;
+	}
+
+	return hash;
+}
+
+
+/**
+ * @brief  нϴ.
+ *
+ * @param path   Դϴ.
+ * @param outBuffer  Դϴ.
+ *
+ * @return  оٸ true, ׷  false ȯմϴ.
+ */
+bool ReadBuffer(const std::filesystem::path& path, std::vector<uint8_t>& outBuffer)
+{
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	outBuffer.resize(static_cast<std::size_t>(file.tellg()));
+	file.seekg(0, std::ios::beg);
+	file.read(reinterpret_cast<char*>(outBuffer.data()), static_cast<std::streamsize>(outBuffer.size()));
+
+	return file.good() || outBuffer.empty();
+}
+
+
+/**
+ * @brief Ͽ ۸ ϴ.
+ *
+ * @param path   Դϴ.
+ * @param buffer Ͽ  Դϴ.
+ *
+ * @return  ٸ true, ׷  false ȯմϴ.
+ */
+bool WriteBuffer(const std::filesystem::path& path, const BufferView& buffer)
+{
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	file.write(reinterpret_cast<const char*>(buffer.GetData()), static_cast<std::streamsize>(buffer.GetSize()));
+	return file.good();
+}
+
+
+/**
+ * @brief  ̸ Ȯڸ ٲߴϴ.
+ *
+ * @param name Ȯڸ ٲ  ̸Դϴ.
+ * @param extension  ȮԴϴ. ex. ".wav"
+ *
+ * @return Ȯڸ ٲ  ̸ ȯմϴ.
+ */
+std::string ReplaceExtension(const std::string& name, const char* extension)
+{
+	std::size_t lastSlash = name.find_last_of('/');
+	std::size_t offset = name.rfind('.');
+	if (offset == std::string::npos || (lastSlash != std::string::npos && offset < lastSlash))
+	{
+		offset = name.size();
+	}
+
+	return name.substr(0, offset) + extension;
+}
+
+
+/**
+ * @brief   Ȯڷ ŷ Ģ ãϴ.
+ *
+ * @param path   Դϴ.
+ *
+ * @return   ŷ Ģ ȯմϴ.
+ */
+ECookRule FindCookRule(const std::filesystem::path& path)
+{
+	std::string extension = StringUtils::ToLower(path.extension().string());
+
+	if (extension == ".ttf")
+	{
+		return ECookRule::Font;
+	}
+
+	if (extension == ".mp3" || extension == ".wav" || extension == ".flac")
+	{
+		return ECookRule::Sound;
+	}
+
+	if (extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga" || extension == ".bmp")
+	{
+		return ECookRule::Texture;
+	}
+
+	if (extension == ".vert" || extension == ".geom" || extension == ".frag")
+	{
+		return ECookRule::Shader;
+	}
+
+	return ECookRule::Copy;
+}
+
+
+/**
+ * @brief Ŀ , ŷ Ģ, Ģ  ִ ŷ  ؽ  մϴ.
+ *
+ * @param rule ŷ ĢԴϴ.
+ * @param settings ŷ Դϴ.
+ *
+ * @return  ؽ  ȯմϴ.   ٲ   Ƶ ٽ ŷմϴ.
+ */
+uint64_t ComputeRuleHash(const ECookRule& rule, const CookSettings& settings)
+{
+	std::string key = StringUtils::PrintF("AssetCooker %u, rule %d", ASSET_COOKER_VERSION, static_cast<int32_t>(rule));
+
+	if (rule == ECookRule::Font)
+	{
+		key += StringUtils::PrintF(", font %d-%d, %g, %d", settings.fontBeginCodePoint, settings.fontEndCodePoint, static_cast<double>(settings.fontSize), static_cast<int32_t>(settings.fontType));
+	}
+
+	return StringId::Hash(key);
+}
+
+
+/**
+ * @brief Ʈ Ÿ Ʈ ŷմϴ.
+ *
+ * @param job ŷ ۾Դϴ.
+ * @param buffer Ʈ Ÿ Ʈ  Դϴ.
+ * @param settings ŷ Դϴ.
+ * @param outFiles   ̸ Դϴ.
+ *
+ * @return ŷ ߴٸ true, ׷  false ȯմϴ.
+ *
+ * @note Ÿ Ʈ  ؽ    Ʋ󽺸 ϹǷ, Ʈ ϵ Բ մϴ.
+ */
+bool CookFont(CookJob& job, const std::vector<uint8_t>& buffer, const CookSettings& settings, std::vector<std::pair<std::string, std::vector<uint8_t>>>& outFiles)
+{
+	int32_t fontOffset = buffer.empty() ? -1 : stbtt_GetFontOffsetForIndex(buffer.data(), 0);
+
+	stbtt_fontinfo info;
+	if (fontOffset < 0 || !stbtt_InitFont(&info, buffer.data(), fontOffset))
+	{
+		job.error = "invalid true type font file";
+		return false;
+	}
+
+	GlyphAtlas glyphAtlas;
+	TTFont::LoadGlyphAtlasFromBuffer(buffer, BufferView(), settings.fontBeginCodePoint, settings.fontEndCodePoint, settings.fontSize, settings.fontType, glyphAtlas);
+
+	std::wstring bakedPath = TTFont::GetBakedGlyphAtlasPath(StringUtils::Convert(job.name), settings.fontSize, settings.fontType);
+
+	outFiles.emplace_back(job.name, buffer);
+	outFiles.emplace_back(StringUtils::Convert(bakedPath), glyphAtlas.Serialize());
+	return true;
+}
+
+
+/**
+ * @brief ڵ PCM ÷ WAV  ۸ ϴ.
+ *
+ * @param samples 16Ʈ  PCM Դϴ. ä  ġǾ ֽϴ.
+ * @param channels ä Դϴ.
+ * @param sampleRate ø ƮԴϴ.
+ *
+ * @return WAV  ۸ ȯմϴ.
+ */
+std::vector<uint8_t> BuildWaveBuffer(const std::vector<int16_t>& samples, uint32_t channels, uint32_t sampleRate)
+{
+	uint32_t dataSize = static_cast<uint32_t>(samples.size() * sizeof(int16_t));
+	uint16_t blockAlign = static_cast<uint16_t>(channels * sizeof(int16_t));
+
+	std::vector<uint8_t> buffer;
+	buffer.reserve(44 + dataSize);
+
+	auto append = [&](const void* bytesPtr, std::size_t size)
+		{
+			const uint8_t* bytePtr = reinterpret_cast<const uint8_t*>(bytesPtr);
+			buffer.insert(buffer.end(), bytePtr, bytePtr + size);
+		};
+	auto append16 = [&](uint16_t value) { append(&value, sizeof(uint16_t)); };
+	auto append32 = [&](uint32_t value) { append(&value, sizeof(uint32_t)); };
+
+	append("RIFF", 4);
+	append32(36 + dataSize);
+	append("WAVE", 4);
+
+	append("fmt ", 4);
+	append32(16);
+	append16(1);
+	append16(static_cast<uint16_t>(channels));
+	append32(sampleRate);
+	append32(sampleRate * blockAlign);
+	append16(blockAlign);
+	append16(16);
+
+	append("data", 4);
+	append32(dataSize);
+	append(samples.data(), dataSize);
+
+	return buffer;
+}
+
+
+/**
+ * @brief 带 PCM ڵؼ ŷմϴ.
+ *
+ * @param job ŷ ۾Դϴ.
+ * @param buffer   Դϴ.
+ * @param outFiles   ̸ Դϴ.
+ *
+ * @return ŷ ߴٸ true, ׷  false ȯմϴ.
+ *
+ * @note  ä  ø Ʈ ϰ, ø 16Ʈ  ٲߴϴ.
+ */
+bool CookSound(CookJob& job, const std::vector<uint8_t>& buffer, std::vector<std::pair<std::string, std::vector<uint8_t>>>& outFiles)
+{
+	ma_decoder_config config = ma_decoder_config_init(COOKED_SOUND_FORMAT, 0, 0);
+
+	// Ȯڷ ڴ ؼ ٸ ڴ  Ž ʵ մϴ.
+	std::string extension = StringUtils::ToLower(job.path.extension().string());
+	if (extension == ".mp3")
+	{
+		config.encodingFormat = ma_encoding_format_mp3;
+	}
+	else if (extension == ".wav")
+	{
+		config.encodingFormat = ma_encoding_format_wav;
+	}
+	else if (extension == ".flac")
+	{
+		config.encodingFormat = ma_encoding_format_flac;
+	}
+
+	ma_decoder decoder;
+	if (ma_decoder_init_memory(buffer.data(), buffer.size(), &config, &decoder) != MA_SUCCESS)
+	{
+		job.error = "failed to initialize sound decoder";
+		return false;
+	}
+
+	uint32_t channels = decoder.outputChannels;
+	uint32_t sampleRate = decoder.outputSampleRate;
+
+	std::vector<int16_t> samples;
+	std::vector<int16_t> chunk(static_cast<std::size_t>(DECODE_FRAME_CHUNK) * channels);
+
+	ma_result result = MA_SUCCESS;
+	while (result == MA_SUCCESS)
+	{
+		ma_uint64 countOfReadFrame = 0;
+		result = ma_decoder_read_pcm_frames(&decoder, chunk.data(), DECODE_FRAME_CHUNK, &countOfReadFrame);
+
+		samples.insert(samples.end(), chunk.begin(), chunk.begin() + static_cast<std::ptrdiff_t>(countOfReadFrame * channels));
+	}
+
+	ma_decoder_uninit(&decoder);
+
+	if (result != MA_AT_END || samples.empty())
+	{
+		job.error = "failed to decode sound";
+		return false;
+	}
+
+	outFiles.emplace_back(ReplaceExtension(job.name, ".wav"), BuildWaveBuffer(samples, channels, sampleRate));
+	return true;
+}
+
+
+/**
+ * @brief ̹ ڵϰ Ӹ ü ؼ ŷմϴ.
+ *
+ * @param job ŷ ۾Դϴ.
+ * @param buffer ̹  Դϴ.
+ * @param outFiles   ̸ Դϴ.
+ *
+ * @return ŷ ߴٸ true, ׷  false ȯմϴ.
+ *
+ * @note ؽó  ʴ 2ä ̹ 4äη ٲߴϴ.
+ */
+bool CookTexture(CookJob& job, const std::vector<uint8_t>& buffer, std::vector<std::pair<std::string, std::vector<uint8_t>>>& outFiles)
+{
+	int32_t width = 0;
+	int32_t height = 0;
+	int32_t channels = 0;
+	if (!stbi_info_from_memory(buffer.data(), static_cast<int32_t>(buffer.size()), &width, &height, &channels))
+	{
+		job.error = StringUtils::PrintF("failed to load image (%s)", stbi_failure_reason());
+		return false;
+	}
+
+	int32_t desiredChannels = (channels == 2) ? 4 : channels;
+
+	uint8_t* pixelsPtr = stbi_load_from_memory(buffer.data(), static_cast<int32_t>(buffer.size()), &width, &height, &channels, desiredChannels);
+	if (pixelsPtr == nullptr)
+	{
+		job.error = StringUtils::PrintF("failed to load image (%s)", stbi_failure_reason());
+		return false;
+	}
+
+	MipChain mipChain;
+	MipChain::Generate(pixelsPtr, width, height, desiredChannels, mipChain);
+	stbi_image_free(pixelsPtr);
+
+	outFiles.emplace_back(ReplaceExtension(job.name, ".mips"), mipChain.Serialize());
+	return true;
+}
+
+
+/**
+ * @brief ̴ ҽ ϰ ּ,   ,   մϴ.
+ *
+ * @param job ŷ ۾Դϴ.  ϸ   ȣ Բ  մϴ.
+ * @param source ̴ ҽԴϴ.
+ * @param outSource ó ̴ ҽԴϴ.
+ *
+ * @return  ߴٸ true, ׷  false ȯմϴ.
+ *
+ * @note
+ * -  ӽſ OpenGL ؽƮ Ƿ  ʰ, ù  #version, ó ù, ȣ ¦, main Լ ˻մϴ.
+ * - #if 迭 ù  ڵ嵵  ˻մϴ.
+ */
+bool PreprocessShader(CookJob& job, std::string_view source, std::string& outSource)
+{
+	std::vector<std::pair<int32_t, std::string>> lines(1, std::make_pair(1, std::string()));
+	int32_t line = 1;
+
+	for (std::size_t index = 0; index < source.size(); ++index)
+	{
+		char character = source[index];
+		char next = (index + 1 < source.size()) ? source[index + 1] : '\0';
+
+		if (character == '/' && next == '/')
+		{
+			while (index + 1 < source.size() && source[index + 1] != '\n')
+			{
+				++index;
+			}
+			continue;
+		}
+
+		if (character == '/' && next == '*')
+		{
+			std::size_t end = source.find("*/", index + 2);
+			if (end == std::string_view::npos)
+			{
+				job.error = StringUtils::PrintF("line %d : unterminated block comment", line);
+				return false;
+			}
+
+			line += static_cast<int32_t>(std::count(source.begin() + index, source.begin() + end, '\n'));
+			lines.back().second += ' ';
+			if (lines.back().first != line)
+			{
+				lines.emplace_back(line, std::string());
+			}
+
+			index = end + 1;
+			continue;
+		}
+
+		if (character == '\n')
+		{
+			++line;
+			lines.emplace_back(line, std::string());
+			continue;
+		}
+
+		if (character != '\r')
+		{
+			lines.back().second += character;
+		}
+	}
+
+	std::vector<std::pair<int32_t, std::string>> codes;
+	for (auto& sourceLine : lines)
+	{
+		std::string& text = sourceLine.second;
+		std::size_t begin = text.find_first_not_of(" \t");
+		std::size_t end = text.find_last_not_of(" \t");
+		if (begin == std::string::npos)
+		{
+			continue;
+		}
+
+		codes.emplace_back(sourceLine.first, text.substr(begin, end - begin + 1));
+	}
+
+	if (codes.empty() || codes.front().second.rfind("#version ", 0) != 0)
+	{
+		job.error = "#version must be the first line";
+		return false;
+	}
+
+	static const std::vector<std::string> directives = {
+		"version", "define", "undef", "if", "ifdef", "ifndef", "else", "elif", "endif", "extension", "line", "pragma", "error",
+	};
+
+	std::string brackets;
+	int32_t conditionDepth = 0;
+	bool bIsFoundMain = false;
+
+	for (std::size_t index = 0; index < codes.size(); ++index)
+	{
+		int32_t codeLine = codes[index].first;
+		const std::string& text = codes[index].second;
+
+		if (text[0] == '#')
+		{
+			std::size_t begin = text.find_first_not_of(" \t", 1);
+			std::size_t end = (begin == std::string::npos) ? std::string::npos : text.find_first_of(" \t(", begin);
+			std::string directive = (begin == std::string::npos) ? std::string() : text.substr(begin, end - begin);
+
+			if (std::find(directives.begin(), directives.end(), directive) == directives.end())
+			{
+				job.error = StringUtils::PrintF("line %d : unknown preprocessor directive '#%s'", codeLine, directive.c_str());
+				return false;
+			}
+
+			if (directive == "version" && index != 0)
+			{
+				job.error = StringUtils::PrintF("line %d : #version must appear only once", codeLine);
+				return false;
+			}
+
+			if (directive == "if" || directive == "ifdef" || directive == "ifndef")
+			{
+				++conditionDepth;
+			}
+			else if ((directive == "else" || directive == "elif" || directive == "endif") && conditionDepth == 0)
+			{
+				job.error = StringUtils::PrintF("line %d : #%s without #if", codeLine, directive.c_str());
+				return false;
+			}
+			else if (directive == "endif")
+			{
+				--conditionDepth;
+			}
+
+			continue;
+		}
+
+		for (char character : text)
+		{
+			if (character == '(' || character == '{' || character == '[')
+			{
+				brackets += character;
+			}
+			else if (character == ')' || character == '}' || character == ']')
+			{
+				char open = (character == ')') ? '(' : ((character == '}') ? '{' : '[');
+				if (brackets.empty() || brackets.back() != open)
+				{
+					job.error = StringUtils::PrintF("line %d : unmatched '%c'", codeLine, character);
+					return false;
+				}
+
+				brackets.pop_back();
+			}
+		}
+
+		std::size_t mainOffset = text.find("main");
+		if (brackets.size() <= 1 && mainOffset != std::string::npos && text.rfind("void", mainOffset) != std::string::npos)
+		{
+			std::size_t open = text.find_first_not_of(" \t", mainOffset + 4);
+			bIsFoundMain = bIsFoundMain || (open != std::string::npos && text[open] == '(');
+		}
+	}
+
+	if (conditionDepth != 0)
+	{
+		job.error = "unterminated #if";
+		return false;
+	}
+
+	if (!brackets.empty())
+	{
+		job.error = StringUtils::PrintF("unclosed '%c'", brackets.back());
+		return false;
+	}
+
+	if (!bIsFoundMain)
+	{
+		job.error = "can't find void main()";
+		return false;
+	}
+
+	outSource.clear();
+	for (const auto& code : codes)
+	{
+		outSource += code.second;
+		outSource += '\n';
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief ̴ ҽ ϰ óؼ ŷմϴ.
+ *
+ * @param job ŷ ۾Դϴ.
+ * @param buffer ̴ ҽ  Դϴ.
+ * @param outFiles   ̸ Դϴ.
+ *
+ * @return ŷ ߴٸ true, ׷  false ȯմϴ.
+ */
+bool CookShader(CookJob& job, const std::vector<uint8_t>& buffer, std::vector<std::pair<std::string, std::vector<uint8_t>>>& outFiles)
+{
+	std::string source;
+	if (!PreprocessShader(job, BufferView(buffer).GetStringView(), source))
+	{
+		return false;
+	}
+
+	outFiles.emplace_back(job.name, std::vector<uint8_t>(source.begin(), source.end()));
+	return true;
+}
+
+
+/**
+ * @brief  ŷ   ȿ Ȯմϴ.
+ *
+ * @param job ŷ ۾Դϴ.  ؽ  Ģ ؽ  Ǿ ־ մϴ.
+ * @param record   ŷ Դϴ.
+ * @param outputPath  丮 Դϴ.
+ *
+ * @return ؽ       ũ  ִٸ true, ׷  false ȯմϴ.
+ */
+bool IsUpToDate(const CookJob& job, const CookRecord& record, const std::filesystem::path& outputPath)
+{
+	if (record.sourceHash != job.sourceHash || record.ruleHash != job.ruleHash || record.outputs.empty())
+	{
+		return false;
+	}
+
+	for (const CookedFile& output : record.outputs)
+	{
+		std::error_code errorCode;
+		uint64_t size = std::filesystem::file_size(outputPath / output.name, errorCode);
+		if (errorCode || size != output.size)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief   ϳ ŷϰ   ϴ.
+ *
+ * @param job ŷ ۾Դϴ.
+ * @param records   ŷ Դϴ. ۾ 忡 б⸸ մϴ.
+ * @param outputPath  丮 Դϴ.
+ * @param settings ŷ Դϴ.
+ * @param bIsForce   ȿص ٽ ŷ Դϴ.
+ *
+ * @note ۾ 忡 ¸ ȣϹǷ job ̿ ¸   ˴ϴ.
+ */
+void RunCookJob(CookJob& job, const std::map<std::string, CookRecord>& records, const std::filesystem::path& outputPath, const CookSettings& settings, bool bIsForce)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	std::vector<uint8_t> buffer;
+	if (!ReadBuffer(job.path, buffer))
+	{
+		job.error = "failed to read file";
+		return;
+	}
+
+	job.sourceHash = HashBuffer(buffer);
+	job.ruleHash = ComputeRuleHash(job.rule, settings);
+
+	auto record = records.find(job.name);
+	if (!bIsForce && record != records.end() && IsUpToDate(job, record->second, outputPath))
+	{
+		job.outputs = record->second.outputs;
+		job.bIsSuccess = true;
+		return;
+	}
+
+	std::vector<std::pair<std::string, std::vector<uint8_t>>> files;
+	bool bIsSuccess = false;
+	switch (job.rule)
+	{
+	case ECookRule::Font:
+		bIsSuccess = CookFont(job, buffer, settings, files);
+		break;
+
+	case ECookRule::Sound:
+		bIsSuccess = CookSound(job, buffer, files);
+		break;
+
+	case ECookRule::Texture:
+		bIsSuccess = CookTexture(job, buffer, files);
+		break;
+
+	case ECookRule::Shader:
+		bIsSuccess = CookShader(job, buffer, files);
+		break;
+
+	default:
+		files.emplace_back(job.name, std::move(buffer));
+		bIsSuccess = true;
+		break;
+	}
+
+	if (!bIsSuccess)
+	{
+		return;
+	}
+
+	for (const auto& file : files)
+	{
+		if (!WriteBuffer(outputPath / file.first, file.second))
+		{
+			job.error = StringUtils::PrintF("failed to write %s", file.first.c_str());
+			return;
+		}
+
+		job.outputs.push_back(CookedFile{ file.first, static_cast<uint64_t>(file.second.size()), HashBuffer(file.second) });
+	}
+
+	job.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	job.bIsCooked = true;
+	job.bIsSuccess = true;
+}
+
+
+/**
+ * @brief Է 丮 Ʒ  Ϸ ŷ ۾ ϴ.
+ *
+ * @param inputPath Է 丮 Դϴ.
+ * @param outJobs ŷ ۾ ߰ Դϴ.
+ *
+ * @return Է 丮 ִٸ true, ׷  false ȯմϴ.
+ *
+ * @note  ̸ Է 丮 ̸  θ '/'  ڿԴϴ.
+ */
+bool CollectCookJobs(const std::filesystem::path& inputPath, std::vector<CookJob>& outJobs)
+{
+	std::error_code errorCode;
+	if (!std::filesystem::is_directory(inputPath, errorCode))
+	{
+		std::fprintf(stderr, "%s is not directory...\n", inputPath.string().c_str());
+		return false;
+	}
+
+	std::filesystem::path rootPath = std::filesystem::absolute(inputPath).lexically_normal();
+	std::string rootName = rootPath.has_filename() ? rootPath.filename().generic_string() : rootPath.parent_path().filename().generic_string();
+
+	for (const std::filesystem::directory_entry& entry : std::filesystem::recursive_directory_iterator(rootPath))
+	{
+		if (!entry.is_regular_file())
+		{
+			continue;
+		}
+
+		CookJob job;
+		job.name = rootName + "/" + entry.path().lexically_relative(rootPath).generic_string();
+		job.path = entry.path();
+		job.rule = FindCookRule(entry.path());
+
+		outJobs.push_back(std::move(job));
+	}
+
+	return true;
+}
+
+
+/**
+ * @brief ŷ Ŵ佺Ʈ нϴ.
+ *
+ * @param path ŷ Ŵ佺Ʈ  Դϴ.
+ *
+ * @return  ̸ Ű ϴ ŷ  ȯմϴ.  ų  ٸ   ȯմϴ.
+ */
+std::map<std::string, CookRecord> ReadCookManifest(const std::filesystem::path& path)
+{
+	std::map<std::string, CookRecord> records;
+
+	std::vector<uint8_t> buffer;
+	if (!ReadBuffer(path, buffer))
+	{
+		return records;
+	}
+
+	Json::Value root;
+	Json::Reader reader;
+	const char* beginPtr = reinterpret_cast<const char*>(buffer.data());
+	if (!reader.parse(beginPtr, beginPtr + buffer.size(), root) || !root.isObject() || root["version"].asUInt() != ASSET_COOKER_VERSION)
+	{
+		return records;
+	}
+
+	const Json::Value& assets = root["assets"];
+	for (const std::string& name : assets.getMemberNames())
+	{
+		const Json::Value& asset = assets[name];
+
+		CookRecord record;
+		record.sourceHash = FromHexString(asset["sourceHash"].asString());
+		record.ruleHash = FromHexString(asset["ruleHash"].asString());
+
+		for (const Json::Value& output : asset["outputs"])
+		{
+			record.outputs.push_back(CookedFile{ output["name"].asString(), output["size"].asUInt64(), FromHexString(output["hash"].asString()) });
+		}
+
+		records.insert({ name, record });
+	}
+
+	return records;
+}
+
+
+/**
+ * @brief ŷ Ŵ佺Ʈ ϴ.
+ *
+ * @param path ŷ Ŵ佺Ʈ  Դϴ.
+ * @param jobs ŷ ۾Դϴ.  ۾ ϹǷ,    ࿡ ٽ ŷմϴ.
+ *
+ * @return  ٸ true, ׷  false ȯմϴ.
+ */
+bool WriteCookManifest(const std::filesystem::path& path, const std::vector<CookJob>& jobs)
+{
+	Json::Value root(Json::objectValue);
+	root["version"] = ASSET_COOKER_VERSION;
+
+	Json::Value& assets = root["assets"];
+	assets = Json::Value(Json::objectValue);
+
+	for (const CookJob& job : jobs)
+	{
+		if (!job.bIsSuccess)
+		{
+			continue;
+		}
+
+		Json::Value asset(Json::objectValue);
+		asset["sourceHash"] = ToHexString(job.sourceHash);
+		asset["ruleHash"] = ToHexString(job.ruleHash);
+		asset["outputs"] = Json::Value(Json::arrayValue);
+
+		for (const CookedFile& cookedFile : job.outputs)
+		{
+			Json::Value output(Json::objectValue);
+			output["name"] = cookedFile.name;
+			output["size"] = Json::UInt64(cookedFile.size);
+			output["hash"] = ToHexString(cookedFile.hash);
+			asset["outputs"].append(output);
+		}
+
+		assets[job.name] = asset;
+	}
+
+	Json::StreamWriterBuilder builder;
+	builder["indentation"] = "\t";
+	std::string text = Json::writeString(builder, root);
+
+	return WriteBuffer(path, BufferView(reinterpret_cast<const uint8_t*>(text.data()), text.size()));
+}
+
+
+/**
+ * @brief ŷ       ϳ ϴ.
+ *
+ * @param packPath    Դϴ.
+ * @param outputPath  丮 Դϴ.
+ * @param jobs ŷ ۾Դϴ.
+ *
+ * @return    ٸ true, ׷  false ȯմϴ.
+ */
+bool WriteAssetPack(const std::filesystem::path& packPath, const std::filesystem::path& outputPath, const std::vector<CookJob>& jobs)
+{
+	std::vector<std::string> names;
+	for (const CookJob& job : jobs)
+	{
+		for (const CookedFile& output : job.outputs)
+		{
+			names.push_back(output.name);
+		}
+	}
+
+	std::sort(names.begin(), names.end());
+
+	std::vector<std::vector<uint8_t>> buffers(names.size());
+	std::vector<AssetPack::BuildEntry> entries(names.size());
+	for (std::size_t index = 0; index < names.size(); ++index)
+	{
+		if (!ReadBuffer(outputPath / names[index], buffers[index]))
+		{
+			std::fprintf(stderr, "failed to read %s cooked file...\n", names[index].c_str());
+			return false;
+		}
+
+		entries[index].name = names[index];
+		entries[index].buffer = buffers[index];
+	}
+
+	std::vector<uint8_t> packBuffer = AssetPack::Build(entries);
+	if (!WriteBuffer(packPath, packBuffer))
+	{
+		std::fprintf(stderr, "failed to write %s file...\n", packPath.string().c_str());
+		return false;
+	}
+
+	std::printf("AssetCooker : %zu cooked files -> %s (%zu bytes)\n", names.size(), packPath.string().c_str(), packBuffer.size());
+	return true;
+}
+
+
+int main(int argc, char** argv)
+{
+	std::vector<std::filesystem::path> inputPaths;
+	std::filesystem::path outputPath;
+	std::filesystem::path packPath;
+	CookSettings settings;
+	bool bIsForce = false;
+	int32_t countOfWorker = -1;
+	bool bIsValidArgument = true;
+
+	for (int32_t index = 1; index < argc && bIsValidArgument; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument.rfind("input=", 0) == 0)
+		{
+			inputPaths.push_back(argument.substr(6));
+		}
+		else if (argument.rfind("output=", 0) == 0)
+		{
+			outputPath = argument.substr(7);
+		}
+		else if (argument.rfind("pack=", 0) == 0)
+		{
+			packPath = argument.substr(5);
+		}
+		else if (argument.rfind("workers=", 0) == 0)
+		{
+			countOfWorker = std::atoi(argument.c_str() + 8);
+		}
+		else if (argument == "force=on" || argument == "force=off")
+		{
+			bIsForce = (argument == "force=on");
+		}
+		else if (argument.rfind("fontSize=", 0) == 0)
+		{
+			settings.fontSize = static_cast<float>(std::atof(argument.c_str() + 9));
+			bIsValidArgument = (settings.fontSize > 0.0f);
+		}
+		else if (argument.rfind("fontRange=", 0) == 0)
+		{
+			bIsValidArgument = std::sscanf(argument.c_str() + 10, "%d-%d", &settings.fontBeginCodePoint, &settings.fontEndCodePoint) == 2
+				&& 0 <= settings.fontBeginCodePoint && settings.fontBeginCodePoint <= settings.fontEndCodePoint;
+		}
+		else if (argument == "fontType=sdf" || argument == "fontType=bitmap")
+		{
+			settings.fontType = (argument == "fontType=sdf") ? GlyphAtlas::EType::SignedDistanceField : GlyphAtlas::EType::Bitmap;
+		}
+		else
+		{
+			bIsValidArgument = false;
+		}
+	}
+
+	if (!bIsValidArgument || inputPaths.empty() || outputPath.empty())
+	{
+		std::fprintf(stderr, "usage : AssetCooker input=<directory> [input=<directory> ...] output=<directory> [pack=<file.pack>] [workers=<count>] [force=on|off] [fontSize=64] [fontRange=32-127] [fontType=sdf|bitmap]\n");
+		return 1;
+	}
+
+	std::vector<CookJob> jobs;
+	for (const std::filesystem::path& inputPath : inputPaths)
+	{
+		if (!CollectCookJobs(inputPath, jobs))
+		{
+			return 1;
+		}
+	}
+
+	std::sort(jobs.begin(), jobs.end(), [](const CookJob& lhs, const CookJob& rhs) { return lhs.name < rhs.name; });
+
+	for (std::size_t index = 1; index < jobs.size(); ++index)
+	{
+		if (jobs[index - 1].name == jobs[index].name)
+		{
+			std::fprintf(stderr, "duplicate %s asset, input directories must have different names...\n", jobs[index].name.c_str());
+			return 1;
+		}
+	}
+
+	// ۾   丮 ÿ  ʵ  丮  ̸ ϴ.
+	std::error_code errorCode;
+	for (const CookJob& job : jobs)
+	{
+		std::filesystem::create_directories((outputPath / job.name).parent_path(), errorCode);
+		if (errorCode)
+		{
+			std::fprintf(stderr, "failed to create %s directory...\n", (outputPath / job.name).parent_path().string().c_str());
+			return 1;
+		}
+	}
+
+	std::filesystem::path manifestPath = outputPath / COOK_MANIFEST_FILE_NAME;
+	std::map<std::string, CookRecord> records = ReadCookManifest(manifestPath);
+
+	if (countOfWorker >= 0)
+	{
+		JobSystem::Get().SetCountOfWorker(static_cast<uint32_t>(countOfWorker));
+	}
+	JobSystem::Get().Startup();
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	JobSystem::Get().ParallelFor(0, static_cast<uint32_t>(jobs.size()), 1, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t index = begin; index < end; ++index)
+			{
+				RunCookJob(jobs[index], records, outputPath, settings, bIsForce);
+			}
+		}
+	);
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	uint32_t countOfWorkerUsed = JobSystem::Get().GetCountOfWorker();
+	JobSystem::Get().Shutdown();
+
+	int32_t countOfCooked = 0;
+	int32_t countOfFailed = 0;
+	std::map<std::string, std::string> outputOwners;
+
+	for (CookJob& job : jobs)
+	{
+		if (!job.bIsSuccess)
+		{
+			std::fprintf(stderr, "  failed    %-40s : %s\n", job.name.c_str(), job.error.c_str());
+			countOfFailed++;
+			continue;
+		}
+
+		for (const CookedFile& output : job.outputs)
+		{
+			auto owner = outputOwners.insert({ output.name, job.name });
+			if (!owner.second)
+			{
+				std::fprintf(stderr, "  failed    %-40s : %s is also cooked from %s\n", job.name.c_str(), output.name.c_str(), owner.first->second.c_str());
+				job.bIsSuccess = false;
+			}
+		}
+
+		if (!job.bIsSuccess)
+		{
+			countOfFailed++;
+		}
+		else if (job.bIsCooked)
+		{
+			std::printf("  cooked    %-40s %8.3f ms ->", job.name.c_str(), job.seconds * 1000.0);
+			for (const CookedFile& output : job.outputs)
+			{
+				std::printf(" %s (%llu bytes)", output.name.c_str(), static_cast<unsigned long long>(output.size));
+			}
+			std::printf("\n");
+			countOfCooked++;
+		}
+	}
+
+	// Է¿ ų  ̸ ٲ    ϴ.       Ӵϴ.
+	for (const auto& record : records)
+	{
+		auto job = std::lower_bound(jobs.begin(), jobs.end(), record.first, [](const CookJob& lhs, const std::string& name) { return lhs.name < name; });
+		if (job != jobs.end() && job->name == record.first && !job->bIsSuccess)
+		{
+			continue;
+		}
+
+		for (const CookedFile& output : record.second.outputs)
+		{
+			if (outputOwners.find(output.name) == outputOwners.end())
+			{
+				std::filesystem::remove(outputPath / output.name, errorCode);
+				std::printf("  removed   %s\n", output.name.c_str());
+			}
+		}
+	}
+
+	if (!WriteCookManifest(manifestPath, jobs))
+	{
+		std::fprintf(stderr, "failed to write %s file...\n", manifestPath.string().c_str());
+		return 1;
+	}
+
+	std::printf("AssetCooker : %zu assets, %d cooked, %d up to date, %d failed, %.3f ms (%u workers)\n",
+		jobs.size(), countOfCooked, static_cast<int32_t>(jobs.size()) - countOfCooked - countOfFailed, countOfFailed, seconds * 1000.0, countOfWorkerUsed);
+
+	if (countOfFailed != 0)
+	{
+		return 1;
+	}
+
+	if (!packPath.empty() && !WriteAssetPack(packPath, outputPath, jobs))
+	{
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,174 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "AssetPack.h"
+
+
+/**
+ * @brief  ѿ  Դϴ.
+ */
+struct SourceFile
+{
+	std::string name;              //    ̸Դϴ. Է 丮 ̸ մϴ. ex. "Resource/Sound/Hit.mp3"
+	std::vector<uint8_t> buffer;   //  Դϴ.
+};
+
+
+/**
+ * @brief  нϴ.
+ *
+ * @param path   Դϴ.
+ * @param outBuffer  Դϴ.
+ *
+ * @return  оٸ true, ׷  false ȯմϴ.
+ */
+bool ReadBuffer(const std::filesystem::path& path, std::vector<uint8_t>& outBuffer)
+{
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	outBuffer.resize(static_cast<std::size_t>(file.tellg()));
+	file.seekg(0, std::ios::beg);
+	file.read(reinterpret_cast<char*>(outBuffer.data()), static_cast<std::streamsize>(outBuffer.size()));
+
+	return file.good() || outBuffer.empty();
+}
+
+
+/**
+ * @brief Է 丮 Ʒ   нϴ.
+ *
+ * @param inputPath Է 丮 Դϴ.
+ * @param outSourceFiles   ߰ Դϴ.
+ *
+ * @return   оٸ true, ׷  false ȯմϴ.
+ *
+ * @note    ̸ Է 丮 ̸  θ '/'  ڿԴϴ.
+ */
+bool CollectSourceFiles(const std::filesystem::path& inputPath, std::vector<SourceFile>& outSourceFiles)
+{
+	std::error_code errorCode;
+	if (!std::filesystem::is_directory(inputPath, errorCode))
+	{
+		std::fprintf(stderr, "%s is not directory...\n", inputPath.string().c_str());
+		return false;
+	}
+
+	std::filesystem::path rootPath = std::filesystem::absolute(inputPath).lexically_normal();
+	std::string rootName = rootPath.has_filename() ? rootPath.filename().generic_string() : rootPath.parent_path().filename().generic_string();
+
+	for (const std::filesystem::directory_entry& entry : std::filesystem::recursive_directory_iterator(rootPath))
+	{
+		if (!entry.is_regular_file())
+		{
+			continue;
+		}
+
+		SourceFile sourceFile;
+		sourceFile.name = rootName + "/" + entry.path().lexically_relative(rootPath).generic_string();
+
+		if (!ReadBuffer(entry.path(), sourceFile.buffer))
+		{
+			std::fprintf(stderr, "failed to read %s file...\n", entry.path().string().c_str());
+			return false;
+		}
+
+		outSourceFiles.push_back(std::move(sourceFile));
+	}
+
+	return true;
+}
+
+
+int main(int argc, char** argv)
+{
+	std::vector<std::filesystem::path> inputPaths;
+	std::filesystem::path outputPath;
+	bool bIsCompress = true;
+
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument.rfind("input=", 0) == 0)
+		{
+			inputPaths.push_back(argument.substr(6));
+		}
+		else if (argument.rfind("output=", 0) == 0)
+		{
+			outputPath = argument.substr(7);
+		}
+		else if (argument == "compress=on" || argument == "compress=off")
+		{
+			bIsCompress = (argument == "compress=on");
+		}
+		else
+		{
+			inputPaths.clear();
+			break;
+		}
+	}
+
+	if (inputPaths.empty() || outputPath.empty())
+	{
+		std::fprintf(stderr, "usage : AssetPackBuilder input=<directory> [input=<directory> ...] output=<file.pack> [compress=on|off]\n");
+		return 1;
+	}
+
+	std::vector<SourceFile> sourceFiles;
+	for (const std::filesystem::path& inputPath : inputPaths)
+	{
+		if (!CollectSourceFiles(inputPath, sourceFiles))
+		{
+			return 1;
+		}
+	}
+
+	std::sort(sourceFiles.begin(), sourceFiles.end(), [](const SourceFile& lhs, const SourceFile& rhs) { return lhs.name < rhs.name; });
+
+	for (std::size_t index = 1; index < sourceFiles.size(); ++index)
+	{
+		if (sourceFiles[index - 1].name == sourceFiles[index].name)
+		{
+			std::fprintf(stderr, "duplicate %s asset, input directories must have different names...\n", sourceFiles[index].name.c_str());
+			return 1;
+		}
+	}
+
+	std::vector<AssetPack::BuildEntry> entries(sourceFiles.size());
+	for (std::size_t index = 0; index < sourceFiles.size(); ++index)
+	{
+		entries[index].name = sourceFiles[index].name;
+		entries[index].buffer = sourceFiles[index].buffer;
+		entries[index].bIsCompress = bIsCompress;
+	}
+
+	std::vector<uint8_t> packBuffer = AssetPack::Build(entries);
+
+	std::ofstream file(outputPath, std::ios::binary | std::ios::trunc);
+	if (!file.is_open() || !file.write(reinterpret_cast<const char*>(packBuffer.data()), static_cast<std::streamsize>(packBuffer.size())))
+	{
+		std::fprintf(stderr, "failed to write %s file...\n", outputPath.string().c_str());
+		return 1;
+	}
+
+	std::size_t totalSize = 0;
+	for (const SourceFile& sourceFile : sourceFiles)
+	{
+		std::vector<uint8_t> compressedBuffer = bIsCompress ? AssetPack::CompressLz4(sourceFile.buffer) : std::vector<uint8_t>();
+		bool bIsCompressed = bIsCompress && !sourceFile.buffer.empty() && compressedBuffer.size() < sourceFile.buffer.size();
+
+		std::printf("  %-40s %10zu -> %10zu%s\n", sourceFile.name.c_str(), sourceFile.buffer.size(), bIsCompressed ? compressedBuffer.size() : sourceFile.buffer.size(), bIsCompressed ? " (lz4)" : "");
+		totalSize += sourceFile.buffer.size();
+	}
+
+	std::printf("AssetPackBuilder : %zu assets, %zu bytes -> %s (%zu bytes)\n", sourceFiles.size(), totalSize, outputPath.string().c_str(), packBuffer.size());
+	return 0;
+}
\ No newline at end of file
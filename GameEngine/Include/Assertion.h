@@ -5,7 +5,24 @@
 #include <cstdio>
 #include <cstring>
 #include <string>
+
+#if defined(_WIN32)
 #include <windows.h>
+#else
+#include <cstdlib>
+#include <cwchar>
+
+/**
+ * @brief Windows ̿ ÷(ex. 帮 ġũ)  ߴܰ μ Ḧ üմϴ.
+ */
+#ifndef __debugbreak
+#define __debugbreak() std::abort()
+#endif
+
+#ifndef ExitProcess
+#define ExitProcess(ExitCode) std::exit(ExitCode)
+#endif
+#endif
 
 
 #if defined(DEBUG_MODE) || defined(RELEASE_MODE) || defined(DEVELOPMENT_MODE)
@@ -26,10 +43,17 @@ inline void DebugPrintF(const char* format, ...)
 
 	va_list args;
 	va_start(args, format);
+#if defined(_WIN32)
 	int32_t size = _vsnprintf_s(buffer, BUFFER_SIZE, BUFFER_SIZE, format, args);
 	va_end(args);
 
 	OutputDebugStringA(buffer);
+#else
+	vsnprintf(buffer, BUFFER_SIZE, format, args);
+	va_end(args);
+
+	fputs(buffer, stderr);
+#endif
 }
 
 
@@ -50,10 +74,17 @@ inline void DebugPrintF(const wchar_t* format, ...)
 
 	va_list args;
 	va_start(args, format);
+#if defined(_WIN32)
 	int32_t size = _vsnwprintf_s(buffer, BUFFER_SIZE, format, args);
 	va_end(args);
 
 	OutputDebugStringW(buffer);
+#else
+	vswprintf(buffer, BUFFER_SIZE, format, args);
+	va_end(args);
+
+	fputws(buffer, stderr);
+#endif
 }
 #endif
 
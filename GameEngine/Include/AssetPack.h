@@ -0,0 +1,227 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "BufferView.h"
+#include "IResource.h"
+
+
+/**
+ * @brief    ϳ     ޸𸮿 ؼ д ҽԴϴ.
+ *
+ * @note
+ * -    , ̸ ؽ  ĵ , ̸ ̺, ĵ     ˴ϴ.
+ * -  ü   ޸𸮿 ϰ,    ε ޸𸮸 ״ Ű  нϴ.
+ * - LZ4     ȣڰ ѱ ۿ  Ǯ нϴ.
+ * - б ޼  ¸ ٲ Ƿ  ۾ 忡 ÿ ȣ  ֽϴ.
+ * -  ѿ     ϱ  ȿմϴ.
+ */
+class AssetPack : public IResource
+{
+public:
+	/**
+	 * @brief      Դϴ.
+	 */
+	struct BuildEntry
+	{
+		std::string name;          //  ã   ̸Դϴ. ex. "Sound/Hit.mp3"
+		BufferView buffer;         //   Դϴ.
+		bool bIsCompress = true;   // LZ4  Դϴ. ص ũⰡ    ʰ մϴ.
+	};
+
+
+	/**
+	 * @brief     Դϴ.
+	 */
+	struct EntryInfo
+	{
+		std::string_view name;       //  ̸Դϴ.
+		uint64_t storedSize;         //  ѿ  ũԴϴ.
+		uint64_t originalSize;       //  Ǭ  ũԴϴ.
+		bool bIsCompressed;          // LZ4 Ǿ ִ Դϴ.
+	};
+
+
+public:
+	/**
+	 * @brief   Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	AssetPack() = default;
+
+
+	/**
+	 * @brief    ҸԴϴ.
+	 *
+	 * @note   ο Ҵ Ҹ ϱ ؼ ݵ Release ȣؾ մϴ.
+	 */
+	virtual ~AssetPack();
+
+
+	/**
+	 * @brief    ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(AssetPack);
+
+
+	/**
+	 * @brief    ޸𸮿 ϰ ʱȭմϴ.
+	 *
+	 * @param path    Դϴ.
+	 *
+	 * @note
+	 * - Windows MapViewOfFile,   ÷ mmap  մϴ.
+	 * -  ų  ߰ų,       ϰ ʱȭ ʽϴ.
+	 *
+	 * @return ʱȭ ߴٸ true, ׷  false ȯմϴ.
+	 *
+	 * @see
+	 * - https://learn.microsoft.com/ko-kr/windows/win32/api/memoryapi/nf-memoryapi-mapviewoffile
+	 */
+	bool Initialize(const std::wstring& path);
+
+
+	/**
+	 * @brief   ޸  մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief µ     ȭմϴ.
+	 *
+	 * @param entries  ѿ   Դϴ. ̸ ߺǸ  ˴ϴ.
+	 *
+	 * @return   Ͽ  ۸ ȯմϴ.
+	 */
+	static std::vector<uint8_t> Build(const std::vector<BuildEntry>& entries);
+
+
+	/**
+	 * @brief  ѿ  ִ Ȯմϴ.
+	 *
+	 * @param name Ȯ  ̸Դϴ.
+	 *
+	 * @return  ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool HasEntry(std::string_view name) const { return FindEntry(name) != INVALID_ENTRY_INDEX; }
+
+
+	/**
+	 * @brief   нϴ.
+	 *
+	 * @param name   ̸Դϴ.
+	 * @param outDecompressBuffer    Ǯ Դϴ.   ̶  ʽϴ.
+	 *
+	 * @return   ̶ ε ޸𸮸,  ̶ outDecompressBuffer Ű 並 ȯմϴ.
+	 */
+	BufferView Read(std::string_view name, std::vector<uint8_t>& outDecompressBuffer) const;
+
+
+	/**
+	 * @brief      ϴ.
+	 *
+	 * @return      ȯմϴ.
+	 */
+	uint32_t GetCountOfEntry() const { return countOfEntry_; }
+
+
+	/**
+	 * @brief      ϴ.
+	 *
+	 * @param index  εԴϴ.  ̸ ؽ  ĵǾ ֽϴ.
+	 *
+	 * @return   ȯմϴ.
+	 */
+	EntryInfo GetEntryInfo(uint32_t index) const;
+
+
+	/**
+	 * @brief ޸𸮿 ε    ũ⸦ ϴ.
+	 *
+	 * @return ޸𸮿 ε    ũ⸦ ȯմϴ.
+	 */
+	std::size_t GetMappedSize() const { return mappedSize_; }
+
+
+	/**
+	 * @brief    LZ4   ۸ մϴ.
+	 *
+	 * @param buffer  Դϴ.
+	 *
+	 * @return  ۸ ȯմϴ.
+	 *
+	 * @see https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+	 */
+	static std::vector<uint8_t> CompressLz4(const BufferView& buffer);
+
+
+	/**
+	 * @brief LZ4      Ǳϴ.
+	 *
+	 * @param buffer  Դϴ.
+	 * @param outBufferPtr  Ǭ    Դϴ.
+	 * @param outBufferSize  Ǭ  ũԴϴ.
+	 *
+	 * @return  Ǭ ũⰡ  ũ     ʾҴٸ true, ׷  false ȯմϴ.
+	 */
+	static bool DecompressLz4(const BufferView& buffer, uint8_t* outBufferPtr, std::size_t outBufferSize);
+
+
+private:
+	/**
+	 * @brief  ã   εԴϴ.
+	 */
+	static const uint32_t INVALID_ENTRY_INDEX = 0xFFFFFFFF;
+
+
+	/**
+	 * @brief ̸  ε ãϴ.
+	 *
+	 * @param name ã  ̸Դϴ.
+	 *
+	 * @return  ε ȯմϴ.  ٸ INVALID_ENTRY_INDEX ȯմϴ.
+	 *
+	 * @note ĵ  ̸ ؽ   Žϰ, ؽ    ̸ մϴ.
+	 */
+	uint32_t FindEntry(std::string_view name) const;
+
+
+	/**
+	 * @brief ε      ùٸ Ȯմϴ.
+	 *
+	 * @note ĺ  ,  ũ⸦ Ȯϰ,  ̸ ̺,      ȿ ִ Ȯմϴ.
+	 *
+	 * @return   ùٸٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsValidTableOfContents() const;
+
+
+	/**
+	 * @brief    ޸  մϴ.
+	 */
+	void UnmapFile();
+
+
+private:
+	/**
+	 * @brief ޸𸮿 ε     Դϴ.
+	 */
+	const uint8_t* mappedPtr_ = nullptr;
+
+
+	/**
+	 * @brief ޸𸮿 ε    ũԴϴ.
+	 */
+	std::size_t mappedSize_ = 0;
+
+
+	/**
+	 * @brief     Դϴ.
+	 */
+	uint32_t countOfEntry_ = 0;
+};
\ No newline at end of file
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+
+/**
+ * @brief ٸ   Ʈ ۸   Ű б  Դϴ.
+ *
+ * @note
+ * -  ۸  Ƿ, ۰ 亸  ǰų ҴǸ  ˴ϴ.
+ * - std::vector<uint8_t> Ͻ ȯǹǷ,  ۸ ޴ Լ ״ ѱ  ֽϴ.
+ */
+class BufferView
+{
+public:
+	/**
+	 * @brief   並 մϴ.
+	 */
+	BufferView() = default;
+
+
+	/**
+	 * @brief Ʈ 迭 Ű  並 մϴ.
+	 *
+	 * @param data Ʈ 迭 Դϴ.
+	 * @param size Ʈ 迭 ũԴϴ.
+	 */
+	BufferView(const uint8_t* data, std::size_t size) : data_(data), size_(size) {}
+
+
+	/**
+	 * @brief  ͸ Ű  並 մϴ.
+	 *
+	 * @param buffer ų  Դϴ.
+	 */
+	BufferView(const std::vector<uint8_t>& buffer) : data_(buffer.data()), size_(buffer.size()) {}
+
+
+	/**
+	 * @brief Ʈ 迭 ͸ ϴ.
+	 *
+	 * @return Ʈ 迭 ͸ ȯմϴ.
+	 */
+	const uint8_t* GetData() const { return data_; }
+
+
+	/**
+	 * @brief Ʈ 迭 ũ⸦ ϴ.
+	 *
+	 * @return Ʈ 迭 ũ⸦ ȯմϴ.
+	 */
+	std::size_t GetSize() const { return size_; }
+
+
+	/**
+	 * @brief  䰡  ִ Ȯմϴ.
+	 *
+	 * @return  䰡  ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsEmpty() const { return size_ == 0; }
+
+
+	/**
+	 * @brief  Ϻθ Ű 並 ϴ.
+	 *
+	 * @param offset  κ Դϴ.
+	 * @param size ų Ʈ Դϴ.      ŵϴ.
+	 *
+	 * @return  Ϻθ Ű 並 ȯմϴ.      並 ȯմϴ.
+	 */
+	BufferView GetSubView(std::size_t offset, std::size_t size) const
+	{
+		if (offset >= size_)
+		{
+			return BufferView();
+		}
+
+		return BufferView(data_ + offset, (size < size_ - offset) ? size : size_ - offset);
+	}
+
+
+	/**
+	 * @brief ۸ ڿ ؼ 並 ϴ.
+	 *
+	 * @return ۸ Ű ڿ 並 ȯմϴ.
+	 */
+	std::string_view GetStringView() const { return std::string_view(reinterpret_cast<const char*>(data_), size_); }
+
+
+	/**
+	 * @brief   for    ݺڸ ϴ.
+	 *
+	 * @return Ʈ 迭  ͸ ȯմϴ.
+	 */
+	const uint8_t* begin() const { return data_; }
+
+
+	/**
+	 * @brief   for    ݺڸ ϴ.
+	 *
+	 * @return Ʈ 迭  ͸ ȯմϴ.
+	 */
+	const uint8_t* end() const { return data_ + size_; }
+
+
+private:
+	/**
+	 * @brief Ʈ 迭 Դϴ.
+	 */
+	const uint8_t* data_ = nullptr;
+
+
+	/**
+	 * @brief Ʈ 迭 ũԴϴ.
+	 */
+	std::size_t size_ = 0;
+};
\ No newline at end of file
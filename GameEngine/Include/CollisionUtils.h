@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Box3D.h"
+#include "Sphere3D.h"
+
+
+/**
+ * @brief       ˻ϴ 浹 ˻ Ȯ  մϴ.
+ *
+ * @note
+ * -   ߽ ǥ  к 迭(SoA) ޹޽ϴ.
+ * - CPU ϴ   SIMD (AVX2, SSE2)  ð ϸ,   Į θ մϴ.
+ * -  δ Sphere3D::Intersect    ϹǷ  Ʈ  ġմϴ.
+ */
+namespace CollisionUtils
+{
+	/**
+	 * @brief 浹 ˻翡  SIMD Դϴ.
+	 */
+	enum class ESimdPath : int32_t
+	{
+		Scalar = 0x00, // SIMD  ʽϴ.
+		SSE2   = 0x01, // 4     ˻մϴ.
+		AVX2   = 0x02, // 8     ˻մϴ.
+	};
+
+
+	/**
+	 * @brief CPU ü ϴ   SIMD θ ϴ.
+	 *
+	 * @return ϴ   SIMD θ ȯմϴ.
+	 */
+	ESimdPath GetSupportSimdPath();
+
+
+	/**
+	 * @brief  浹 ˻翡   SIMD θ ϴ.
+	 *
+	 * @return    SIMD θ ȯմϴ.
+	 */
+	ESimdPath GetSimdPath();
+
+
+	/**
+	 * @brief 浹 ˻翡  SIMD θ մϴ.
+	 *
+	 * @param simdPath  SIMD Դϴ.
+	 *
+	 * @note  ʴ θ ϸ ϴ   η ˴ϴ.
+	 */
+	void SetSimdPath(ESimdPath simdPath);
+
+
+	/**
+	 * @brief     ٸ   浹ϴ ˻մϴ.
+	 *
+	 * @param cx   ߽ x ǥ 迭Դϴ.
+	 * @param cy   ߽ y ǥ 迭Դϴ.
+	 * @param cz   ߽ z ǥ 迭Դϴ.
+	 * @param r    迭Դϴ.
+	 * @param n ˻   Դϴ.
+	 * @param sphere 浹 ˻  Դϴ.
+	 * @param outHits 浹 θ  迭Դϴ. 浹ϸ 1, ׷  0 մϴ.
+	 */
+	void IntersectSpheresVsSphere(const float* cx, const float* cy, const float* cz, const float* r, std::size_t n, const Sphere3D& sphere, uint8_t* outHits);
+
+
+	/**
+	 * @brief        ڿ 浹ϴ ˻մϴ.
+	 *
+	 * @param cx   ߽ x ǥ 迭Դϴ.
+	 * @param cy   ߽ y ǥ 迭Դϴ.
+	 * @param cz   ߽ z ǥ 迭Դϴ.
+	 * @param r    迭Դϴ.
+	 * @param n ˻   Դϴ.
+	 * @param box 浹 ˻    Դϴ.
+	 * @param outHits 浹 θ  迭Դϴ. 浹ϸ 1, ׷  0 մϴ.
+	 */
+	void IntersectSpheresVsBox(const float* cx, const float* cy, const float* cz, const float* r, std::size_t n, const Box3D& box, uint8_t* outHits);
+}
\ No newline at end of file
@@ -0,0 +1,512 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Box3D.h"
+#include "IObject.h"
+#include "Sphere3D.h"
+#include "Vector3.h"
+
+
+/**
+ * @brief 浹  3D (Ͻ) ϰ,  ġ    ã 浹 Դϴ.
+ *
+ * @note
+ * - Ͻô  (Sphere3D) Ȥ    (Box3D)  ؼ մϴ.
+ * - ε  (Uniform Grid)   (Sweep And Prune)  ϳ   ֽϴ.
+ * - ġ  Tick ȣ    Ǹ, GetCollisionPairs   ֽϴ.
+ * -  Ͻô (A ̾ & B ũ) (B ̾ & A ũ)  0 ƴ  ˻մϴ.
+ */
+class CollisionWorld : public IObject
+{
+public:
+	/**
+	 * @brief 浹  ε Դϴ.
+	 */
+	enum class EBroadphase : int32_t
+	{
+		UniformGrid   = 0x00, //    ũ   ˻մϴ.
+		SweepAndPrune = 0x01, // X ּڰ     ġ Ͻø ˻մϴ.
+	};
+
+
+	/**
+	 * @brief  ġ Ͻ Դϴ.
+	 *
+	 * @note proxyA ׻ proxyB ۽ϴ.
+	 */
+	struct CollisionPair
+	{
+		uint32_t proxyA;
+		uint32_t proxyB;
+	};
+
+
+	/**
+	 * @brief ȿ  Ͻ Դϴ.
+	 */
+	static const uint32_t INVALID_PROXY = 0xFFFFFFFF;
+
+
+public:
+	/**
+	 * @brief 浹  Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	CollisionWorld() = default;
+
+
+	/**
+	 * @brief 浹   ҸԴϴ.
+	 *
+	 * @note 浹   ҽ Ҵ ϱ ؼ Release ޼带 ȣؾ մϴ.
+	 */
+	virtual ~CollisionWorld();
+
+
+	/**
+	 * @brief 浹      ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(CollisionWorld);
+
+
+	/**
+	 * @brief 浹 带 ʱȭմϴ.
+	 *
+	 * @param broadphase 浹  ε Դϴ.
+	 * @param minPosition 浹   ּڰԴϴ.
+	 * @param maxPosition 浹   ִԴϴ.
+	 * @param cellSize    ũԴϴ.
+	 *
+	 * @note   Ͻô     ϵǹǷ  ʽϴ.
+	 */
+	void Initialize(EBroadphase broadphase, const Vector3f& minPosition, const Vector3f& maxPosition, float cellSize);
+
+
+	/**
+	 * @brief ε ϰ  ġ Ͻ  մϴ.
+	 *
+	 * @param deltaSeconds Ÿ ð Դϴ.
+	 */
+	virtual void Tick(float deltaSeconds) override;
+
+
+	/**
+	 * @brief 浹   ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief   Ͻø մϴ.
+	 *
+	 * @param sphere Ͻ  Դϴ.
+	 * @param layer Ͻð  ̾ ƮԴϴ.
+	 * @param mask Ͻð ˻ ̾ Ʈ ũԴϴ.
+	 * @param userData Ͻÿ   Դϴ.
+	 *
+	 * @return  Ͻ  ȯմϴ.
+	 */
+	uint32_t CreateSphereProxy(const Sphere3D& sphere, uint32_t layer, uint32_t mask, uint32_t userData);
+
+
+	/**
+	 * @brief     Ͻø մϴ.
+	 *
+	 * @param box Ͻ    Դϴ.
+	 * @param layer Ͻð  ̾ ƮԴϴ.
+	 * @param mask Ͻð ˻ ̾ Ʈ ũԴϴ.
+	 * @param userData Ͻÿ   Դϴ.
+	 *
+	 * @return  Ͻ  ȯմϴ.
+	 */
+	uint32_t CreateBoxProxy(const Box3D& box, uint32_t layer, uint32_t mask, uint32_t userData);
+
+
+	/**
+	 * @brief Ͻø մϴ.
+	 *
+	 * @param proxy  Ͻ Դϴ.
+	 *
+	 * @note  Ͻ   Ǵ Ͻÿ ˴ϴ.
+	 */
+	void DestroyProxy(uint32_t proxy);
+
+
+	/**
+	 * @brief   Ͻ ߽ ǥ մϴ.
+	 *
+	 * @param proxy  Ͻ Դϴ.
+	 * @param center    ߽ ǥԴϴ.
+	 */
+	void UpdateSphereProxy(uint32_t proxy, const Vector3f& center);
+
+
+	/**
+	 * @brief     Ͻ ߽ ǥ մϴ.
+	 *
+	 * @param proxy  Ͻ Դϴ.
+	 * @param center      ߽ ǥԴϴ.
+	 */
+	void UpdateBoxProxy(uint32_t proxy, const Vector3f& center);
+
+
+	/**
+	 * @brief Ͻ ̾ Ʈ ϴ.
+	 *
+	 * @param proxy ̾ Ʈ  Ͻ Դϴ.
+	 *
+	 * @return Ͻ ̾ Ʈ ȯմϴ.
+	 */
+	uint32_t GetProxyLayer(uint32_t proxy) const { return proxies_[proxy].layer; }
+
+
+	/**
+	 * @brief Ͻ  ͸ ϴ.
+	 *
+	 * @param proxy  ͸  Ͻ Դϴ.
+	 *
+	 * @return Ͻ  ͸ ȯմϴ.
+	 */
+	uint32_t GetProxyUserData(uint32_t proxy) const { return proxies_[proxy].userData; }
+
+
+	/**
+	 * @brief  Tick   ġ Ͻ   ϴ.
+	 *
+	 * @return  ġ Ͻ   ȯմϴ.
+	 */
+	const std::vector<CollisionPair>& GetCollisionPairs() const { return collisionPairs_; }
+
+
+	/**
+	 * @brief 3D ¿ ġ Ͻð ִ Ȯմϴ.
+	 *
+	 * @param shape ˻ 3D Դϴ.
+	 * @param mask ˻ Ͻ ̾ Ʈ ũԴϴ.
+	 *
+	 * @return ġ Ͻð ִٸ true, ׷  false ȯմϴ.
+	 *
+	 * @note
+	 * -  Tick  ε ϹǷ, Ŀ ǰų ̵ Ͻô   ֽϴ.
+	 * -    ʴ Ͻø ˻  ؾ մϴ.
+	 */
+	bool QueryOverlap(const IShape3D* shape, uint32_t mask) const;
+
+
+	/**
+	 * @brief 浹  ε  ϴ.
+	 *
+	 * @return 浹  ε  ȯմϴ.
+	 */
+	EBroadphase GetBroadphase() const { return broadphase_; }
+
+
+	/**
+	 * @brief 浹  ε  մϴ.
+	 *
+	 * @param broadphase  ε Դϴ.
+	 *
+	 * @note  Tick ˴ϴ.
+	 */
+	void SetBroadphase(EBroadphase broadphase) { broadphase_ = broadphase; }
+
+
+private:
+	/**
+	 * @brief 浹 忡 ϵ ϽԴϴ.
+	 */
+	struct Proxy
+	{
+		IShape3D::EType type = IShape3D::EType::None;
+		Sphere3D sphere;
+		Box3D box;
+		Vector3f minPosition;
+		Vector3f maxPosition;
+		uint32_t layer = 0;
+		uint32_t mask = 0;
+		uint32_t userData = 0;
+		bool bIsActive = false;
+	};
+
+
+	/**
+	 * @brief     ε Դϴ.
+	 */
+	struct CellRange
+	{
+		int32_t minX;
+		int32_t minY;
+		int32_t minZ;
+		int32_t maxX;
+		int32_t maxY;
+		int32_t maxZ;
+	};
+
+
+	/**
+	 * @brief      ̾ Ͻð  ִ Դϴ.
+	 */
+	struct CellGroup
+	{
+		uint32_t begin;
+		uint32_t end;
+		bool bIsSphereOnly;
+		bool bIsSelfCollision;
+	};
+
+
+private:
+	/**
+	 * @brief ο Ͻ  Ҵմϴ.
+	 *
+	 * @return Ҵ Ͻ  ȯմϴ.
+	 */
+	uint32_t AllocateProxy();
+
+
+	/**
+	 * @brief Ͻ 3D ¸ ϴ.
+	 *
+	 * @param proxy 3D ¸  ϽԴϴ.
+	 *
+	 * @return Ͻ 3D ¸ ȯմϴ.
+	 */
+	const IShape3D* GetProxyShape(const Proxy& proxy) const;
+
+
+	/**
+	 * @brief  Ͻø ˻ؾ ϴ Ȯմϴ.
+	 *
+	 * @param lhs ˻ ϽԴϴ.
+	 * @param rhs ˻ ٸ ϽԴϴ.
+	 *
+	 * @return ˻ؾ Ѵٸ true, ׷  false ȯմϴ.
+	 */
+	bool ShouldCollide(const Proxy& lhs, const Proxy& rhs) const;
+
+
+	/**
+	 * @brief  Ͻð ġ Ȯϰ, ġ 浹  Ͽ ߰մϴ.
+	 *
+	 * @param proxyA ˻ Ͻ Դϴ.
+	 * @param proxyB ˻ ٸ Ͻ Դϴ.
+	 */
+	void TestCollisionPair(uint32_t proxyA, uint32_t proxyB);
+
+
+	/**
+	 * @brief  Ͻ   ġ Ȯմϴ.
+	 *
+	 * @param lhs ˻ ϽԴϴ.
+	 * @param rhs ˻ ٸ ϽԴϴ.
+	 *
+	 * @return   ģٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsOverlapBounds(const Proxy& lhs, const Proxy& rhs) const;
+
+
+	/**
+	 * @brief  Ͻ  ˻  Ȯմϴ.
+	 *
+	 * @param cell Ȯ   εԴϴ.
+	 * @param lhs ˻ ϽԴϴ.
+	 * @param rhs ˻ ٸ ϽԴϴ.
+	 *
+	 * @return    ּڰ  ū   Ѵٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsOwnerCell(int32_t cell, const Proxy& lhs, const Proxy& rhs) const;
+
+
+	/**
+	 * @brief    Ͻø ˻ϰ, ġ 浹  Ͽ ߰մϴ.
+	 *
+	 * @param cell ˻    εԴϴ.
+	 * @param proxyA ˻ Ͻ Դϴ.
+	 * @param proxyB ˻ ٸ Ͻ Դϴ.
+	 */
+	void TestCollisionPairInCell(int32_t cell, uint32_t proxyA, uint32_t proxyB);
+
+
+	/**
+	 * @brief     ׷ ٸ ׷ Ͻÿ SIMD ϰ ˻ϰ, ġ 浹  Ͽ ߰մϴ.
+	 *
+	 * @param cell ˻    εԴϴ.
+	 * @param sphereGroup ϰ ˻   ׷Դϴ.
+	 * @param otherGroup   ׷ ˻ ٸ ׷Դϴ.
+	 */
+	void TestCollisionBatchInCell(int32_t cell, const CellGroup& sphereGroup, const CellGroup& otherGroup);
+
+
+	/**
+	 * @brief ġ ϴ  ε մϴ.
+	 *
+	 * @param position   ġԴϴ.
+	 * @param outX  X εԴϴ.
+	 * @param outY  Y εԴϴ.
+	 * @param outZ  Z εԴϴ.
+	 *
+	 * @note    ġ     ˴ϴ.
+	 */
+	void ComputeCell(const Vector3f& position, int32_t& outX, int32_t& outY, int32_t& outZ) const;
+
+
+	/**
+	 * @brief    ִ  ε  մϴ.
+	 *
+	 * @param minPosition   ּڰԴϴ.
+	 * @param maxPosition   ִԴϴ.
+	 *
+	 * @return  ε  ȯմϴ.
+	 */
+	CellRange ComputeCellRange(const Vector3f& minPosition, const Vector3f& maxPosition) const;
+
+
+	/**
+	 * @brief  X/Y/Z ε  ε ȯմϴ.
+	 *
+	 * @param x  X εԴϴ.
+	 * @param y  Y εԴϴ.
+	 * @param z  Z εԴϴ.
+	 *
+	 * @return   ε ȯմϴ.
+	 */
+	int32_t GetCellIndex(int32_t x, int32_t y, int32_t z) const { return (z * countOfCellY_ + y) * countOfCellX_ + x; }
+
+
+	/**
+	 * @brief  ڸ ϰ  ġ Ͻ  մϴ.
+	 */
+	void UpdateUniformGrid();
+
+
+	/**
+	 * @brief     ϰ  ġ Ͻ  մϴ.
+	 */
+	void UpdateSweepAndPrune();
+
+
+private:
+	/**
+	 * @brief 浹  ε Դϴ.
+	 */
+	EBroadphase broadphase_ = EBroadphase::UniformGrid;
+
+
+	/**
+	 * @brief  Tick  ε Դϴ.
+	 */
+	EBroadphase builtBroadphase_ = EBroadphase::UniformGrid;
+
+
+	/**
+	 * @brief 浹 忡 ϵ Ͻ Դϴ.
+	 */
+	std::vector<Proxy> proxies_;
+
+
+	/**
+	 * @brief   Ͻ  Դϴ.
+	 */
+	std::vector<uint32_t> freeProxies_;
+
+
+	/**
+	 * @brief  ġ Ͻ  Դϴ.
+	 */
+	std::vector<CollisionPair> collisionPairs_;
+
+
+	/**
+	 * @brief    ּڰԴϴ.
+	 */
+	Vector3f gridMinPosition_;
+
+
+	/**
+	 * @brief    ũԴϴ.
+	 */
+	float cellSize_ = 1.0f;
+
+
+	/**
+	 * @brief   X  Դϴ.
+	 */
+	int32_t countOfCellX_ = 0;
+
+
+	/**
+	 * @brief   Y  Դϴ.
+	 */
+	int32_t countOfCellY_ = 0;
+
+
+	/**
+	 * @brief   Z  Դϴ.
+	 */
+	int32_t countOfCellZ_ = 0;
+
+
+	/**
+	 * @brief  ϵ Ͻ   ġԴϴ.
+	 *
+	 * @note  i Ͻô cellProxies_[cellStarts_[i]]  cellProxies_[cellStarts_[i + 1]] Դϴ.
+	 */
+	std::vector<uint32_t> cellStarts_;
+
+
+	/**
+	 * @brief   ĵ Ͻ Դϴ.
+	 */
+	std::vector<uint32_t> cellProxies_;
+
+
+	/**
+	 * @brief  ڿ ϵ Ͻ ̾ Դϴ.  ƽ  ٽ äϴ.
+	 */
+	std::vector<uint32_t> gridLayers_;
+
+
+	/**
+	 * @brief X ּڰ  ĵ Ͻ Դϴ.
+	 */
+	std::vector<uint32_t> sortedProxies_;
+
+
+	/**
+	 * @brief ˻   ̾ ׷ Դϴ.
+	 */
+	std::vector<CellGroup> cellGroups_;
+
+
+	/**
+	 * @brief ϰ ˻   ߽ x ǥ Դϴ.
+	 */
+	std::vector<float> batchCenterX_;
+
+
+	/**
+	 * @brief ϰ ˻   ߽ y ǥ Դϴ.
+	 */
+	std::vector<float> batchCenterY_;
+
+
+	/**
+	 * @brief ϰ ˻   ߽ z ǥ Դϴ.
+	 */
+	std::vector<float> batchCenterZ_;
+
+
+	/**
+	 * @brief ϰ ˻    Դϴ.
+	 */
+	std::vector<float> batchRadius_;
+
+
+	/**
+	 * @brief ϰ ˻  Դϴ.
+	 */
+	std::vector<uint8_t> batchHits_;
+};
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Vector3.h"
+
+class Material;
+class StaticMesh;
+
+
+/**
+ * @brief ƼƼ 忡  ϴ ƮԴϴ.
+ *
+ * @note Transform, Sphere3D, Box3D ״ Ʈ   Ƿ ⿡  ʽϴ.
+ */
+namespace EntityComponents
+{
+	/**
+	 * @brief ƼƼ ׸  ϴ ҽ Դϴ.
+	 *
+	 * @note ҽ ҽ Ŵ ϹǷ Ʈ ͸ ϴ.
+	 */
+	struct RenderRef
+	{
+		StaticMesh* mesh = nullptr;     // ƼƼ ׸ ޽Դϴ.
+		Material* material = nullptr;   // ƼƼ ׸   Դϴ.
+	};
+
+
+	/**
+	 * @brief  Ʈ ƼƼ ġԴϴ.
+	 *
+	 * @note  ð  Ʈ ̸ ؼ   մϴ.
+	 */
+	struct PrevLocation
+	{
+		Vector3f location;   //  Ʈ   ġԴϴ.
+	};
+}
\ No newline at end of file
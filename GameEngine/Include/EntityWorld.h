@@ -0,0 +1,685 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Assertion.h"
+#include "IObject.h"
+#include "JobSystem.h"
+
+
+/**
+ * @brief ƼƼ 尡 ϴ ƼƼ Ű ڵԴϴ.
+ *
+ * @note ƼƼ Ҵ Ǹ   ϹǷ,  ƼƼ ڵ  ƼƼ Ű ʽϴ.
+ */
+struct EntityHandle
+{
+	/**
+	 * @brief  ƼƼ Ű ʴ ƼƼ εԴϴ.
+	 */
+	static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+
+	/**
+	 * @brief ڵ ƼƼ Ű Ȯմϴ.
+	 *
+	 * @return ڵ ƼƼ Ųٸ true, ׷  false ȯմϴ.
+	 *
+	 * @note ƼƼ Ű ̹  ƼƼ ڵ  ֽϴ.
+	 */
+	bool IsValid() const { return index != INVALID_INDEX; }
+
+
+	uint32_t index = INVALID_INDEX; // ƼƼ   ƼƼ εԴϴ.
+	uint32_t generation = 0;        // ƼƼ ε  ƼƼ  Դϴ.
+};
+
+
+/**
+ * @brief Ʈ (ŰŸ) Ʈ ӵ 迭 ϴ ƼƼ Դϴ.
+ *
+ * @note
+ * - Ʈ    Ÿ̸,  ŰŸ ƼƼ Ʈ ŸԸ ϳ 迭 մϴ.
+ * - ý ForEach/ParallelForEach ϴ Ʈ   ŰŸ 迭 ȸմϴ.
+ * - ȸ ߿ ƼƼ ϰų Ʈ ߰/  ϴ.  DestroyEntity û  FlushDestroyedEntities ó˴ϴ.
+ * - Ʈ Ÿ ִ MAX_COMPONENT_TYPE   ֽϴ.
+ */
+class EntityWorld : public IObject
+{
+public:
+	/**
+	 * @brief   ִ Ʈ Ÿ ִ Դϴ.
+	 */
+	static constexpr uint32_t MAX_COMPONENT_TYPE = 64;
+
+
+public:
+	/**
+	 * @brief ƼƼ  Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	EntityWorld() = default;
+
+
+	/**
+	 * @brief ƼƼ   ҸԴϴ.
+	 *
+	 * @note ƼƼ  ο Ҵ Ҹ ϱ ؼ ݵ Release ȣؾ մϴ.
+	 */
+	virtual ~EntityWorld();
+
+
+	/**
+	 * @brief ƼƼ   ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(EntityWorld);
+
+
+	/**
+	 * @brief ƼƼ 带 ʱȭմϴ.
+	 */
+	void Initialize();
+
+
+	/**
+	 * @brief ƼƼ 带 Ʈմϴ.
+	 *
+	 * @param deltaSeconds Ÿ ð Դϴ.
+	 *
+	 * @note  û ƼƼ Ҵ մϴ. ý ƼƼ 带  ʿ ؾ մϴ.
+	 */
+	virtual void Tick(float deltaSeconds) override;
+
+
+	/**
+	 * @brief ƼƼ    ƼƼ ŰŸ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief Ʈ Ÿ  ȣ ϴ.
+	 *
+	 * @return Ʈ Ÿ  ȣ ȯմϴ.
+	 *
+	 * @note ó ȣ  ȣ ߱޵Ǹ, α׷   ٲ ʽϴ.
+	 */
+	template <typename TComponent>
+	static uint32_t GetComponentTypeID()
+	{
+		static const uint32_t componentTypeID = AllocateComponentTypeID();
+		return componentTypeID;
+	}
+
+
+	/**
+	 * @brief Ʈ  ƼƼ մϴ.
+	 *
+	 * @param components ƼƼ ߰ ƮԴϴ.  Ÿ Ʈ     ϴ.
+	 *
+	 * @return  ƼƼ ڵ ȯմϴ.
+	 */
+	template <typename... TComponents>
+	EntityHandle CreateEntity(const TComponents&... components)
+	{
+		uint64_t mask = GetComponentMask<TComponents...>();
+		uint32_t archetypeIndex = FindOrCreateArchetype<TComponents...>(mask);
+
+		EntityHandle handle = AllocateEntity();
+		Archetype& archetype = *archetypes_[archetypeIndex];
+
+		EntityRecord& record = entities_[handle.index];
+		record.archetype = archetypeIndex;
+		record.row = static_cast<uint32_t>(archetype.entities.size());
+
+		archetype.entities.push_back(handle.index);
+		(GetColumn<TComponents>(archetype).components.push_back(components), ...);
+
+		return handle;
+	}
+
+
+	/**
+	 * @brief Ʈ  ŰŸԿ ƼƼ   ̸ Ȯմϴ.
+	 *
+	 * @param countOfEntity ̸ Ȯ ƼƼ Դϴ.
+	 */
+	template <typename... TComponents>
+	void Reserve(uint32_t countOfEntity)
+	{
+		Archetype& archetype = *archetypes_[FindOrCreateArchetype<TComponents...>(GetComponentMask<TComponents...>())];
+
+		archetype.entities.reserve(countOfEntity);
+		(GetColumn<TComponents>(archetype).components.reserve(countOfEntity), ...);
+	}
+
+
+	/**
+	 * @brief ƼƼ  ûմϴ.
+	 *
+	 * @param handle  ƼƼ ڵԴϴ.
+	 *
+	 * @note ƼƼ FlushDestroyedEntities ȣ  Ҵ ǹǷ, ȸ ߿ ȣص մϴ.
+	 */
+	void DestroyEntity(const EntityHandle& handle);
+
+
+	/**
+	 * @brief  û ƼƼ û  Ҵ մϴ.
+	 */
+	void FlushDestroyedEntities();
+
+
+	/**
+	 * @brief ڵ ִ ƼƼ Ű Ȯմϴ.
+	 *
+	 * @param handle Ȯ ƼƼ ڵԴϴ.
+	 *
+	 * @return ƼƼ ִٸ true, ׷  false ȯմϴ.  û ƼƼ Ҵ   ֽϴ.
+	 */
+	bool IsAlive(const EntityHandle& handle) const
+	{
+		return handle.index < entities_.size() && entities_[handle.index].bIsAlive && entities_[handle.index].generation == handle.generation;
+	}
+
+
+	/**
+	 * @brief ƼƼ ε ϴ ִ ƼƼ ڵ ϴ.
+	 *
+	 * @param entityIndex ƼƼ εԴϴ.
+	 *
+	 * @return ƼƼ ε ϴ ڵ ȯմϴ. ִ ƼƼ ٸ ȿ  ڵ ȯմϴ.
+	 *
+	 * @note 浹 Ͻ  ó 32Ʈ    ִ  ƼƼ ã  մϴ.
+	 */
+	EntityHandle GetEntityHandle(uint32_t entityIndex) const;
+
+
+	/**
+	 * @brief ƼƼ Ʈ ϴ.
+	 *
+	 * @param handle ƼƼ ڵԴϴ.
+	 *
+	 * @return ƼƼ Ʈ ͸ ȯմϴ. ƼƼ ų Ʈ   ʴٸ  ͸ ȯմϴ.
+	 *
+	 * @note ȯ ʹ  ŰŸԿ ƼƼ ǰų Ǹ ȿ ʽϴ.
+	 */
+	template <typename TComponent>
+	TComponent* GetComponent(const EntityHandle& handle)
+	{
+		if (!IsAlive(handle))
+		{
+			return nullptr;
+		}
+
+		const EntityRecord& record = entities_[handle.index];
+		Archetype& archetype = *archetypes_[record.archetype];
+
+		IComponentColumn* column = archetype.columns[GetComponentTypeID<TComponent>()].get();
+		if (!column)
+		{
+			return nullptr;
+		}
+
+		return &static_cast<ComponentColumn<TComponent>*>(column)->components[record.row];
+	}
+
+
+	/**
+	 * @brief ƼƼ Ʈ ߰մϴ.
+	 *
+	 * @param handle Ʈ ߰ ƼƼ ڵԴϴ.
+	 * @param component ߰ ƮԴϴ.
+	 *
+	 * @note
+	 * - ̹  Ÿ Ʈ ִٸ  ϴ.
+	 * - ƼƼ  Ʈ  ŰŸ Űϴ.
+	 */
+	template <typename TComponent>
+	void AddComponent(const EntityHandle& handle, const TComponent& component)
+	{
+		ASSERT(IsAlive(handle), "invalid entity handle %d...", handle.index);
+
+		TComponent* existComponent = GetComponent<TComponent>(handle);
+		if (existComponent)
+		{
+			*existComponent = component;
+			return;
+		}
+
+		uint32_t componentTypeID = GetComponentTypeID<TComponent>();
+		EntityRecord& record = entities_[handle.index];
+		uint64_t mask = archetypes_[record.archetype]->mask | (1ULL << componentTypeID);
+
+		uint32_t archetypeIndex = FindOrCreateArchetype(mask, record.archetype, componentTypeID, std::make_unique<ComponentColumn<TComponent>>());
+		MoveEntity(handle.index, archetypeIndex);
+
+		GetColumn<TComponent>(*archetypes_[archetypeIndex]).components.push_back(component);
+	}
+
+
+	/**
+	 * @brief ƼƼ Ʈ մϴ.
+	 *
+	 * @param handle Ʈ  ƼƼ ڵԴϴ.
+	 *
+	 * @note ƼƼ  Ʈ  ŰŸ Űϴ. Ʈ ٸ ƹ ۵  ʽϴ.
+	 */
+	template <typename TComponent>
+	void RemoveComponent(const EntityHandle& handle)
+	{
+		ASSERT(IsAlive(handle), "invalid entity handle %d...", handle.index);
+
+		if (!GetComponent<TComponent>(handle))
+		{
+			return;
+		}
+
+		uint32_t componentTypeID = GetComponentTypeID<TComponent>();
+		EntityRecord& record = entities_[handle.index];
+		uint64_t mask = archetypes_[record.archetype]->mask & ~(1ULL << componentTypeID);
+
+		uint32_t archetypeIndex = FindOrCreateArchetype(mask, record.archetype, componentTypeID, nullptr);
+		MoveEntity(handle.index, archetypeIndex);
+	}
+
+
+	/**
+	 * @brief Ʈ   ƼƼ ȸմϴ.
+	 *
+	 * @param function ƼƼ ȣ ԼԴϴ. Ʈ (TComponents&...) ڷ ޽ϴ.
+	 *
+	 * @note ŰŸԸ Ʈ 迭   ã, 迭 տ ʷ ȸմϴ.
+	 */
+	template <typename... TComponents, typename TFunction>
+	void ForEach(TFunction&& function)
+	{
+		uint64_t mask = GetComponentMask<TComponents...>();
+		for (auto& archetype : archetypes_)
+		{
+			if ((archetype->mask & mask) != mask || archetype->entities.empty())
+			{
+				continue;
+			}
+
+			ForEachInRange<TComponents...>(*archetype, 0, static_cast<uint32_t>(archetype->entities.size()), function);
+		}
+	}
+
+
+	/**
+	 * @brief Ʈ   ƼƼ  ý  ķ ȸմϴ.
+	 *
+	 * @param grain  ۾ ó ƼƼ Դϴ.
+	 * @param function ƼƼ ȣ ԼԴϴ. Ʈ (TComponents&...) ڷ ޽ϴ.
+	 *
+	 * @note
+	 * -  ٸ ƼƼ ÿ ó  Ƿ function ڷ  Ʈ  ͸   ˴ϴ.
+	 * - ŰŸ  óϸ,  ƼƼ ó   ȯմϴ.
+	 */
+	template <typename... TComponents, typename TFunction>
+	void ParallelForEach(uint32_t grain, TFunction&& function)
+	{
+		uint64_t mask = GetComponentMask<TComponents...>();
+		for (auto& archetype : archetypes_)
+		{
+			if ((archetype->mask & mask) != mask || archetype->entities.empty())
+			{
+				continue;
+			}
+
+			Archetype& target = *archetype;
+			JobSystem::Get().ParallelFor(0, static_cast<uint32_t>(target.entities.size()), grain,
+				[&](uint32_t begin, uint32_t end)
+				{
+					ForEachInRange<TComponents...>(target, begin, end, function);
+				}
+			);
+		}
+	}
+
+
+	/**
+	 * @brief Ʈ   ƼƼ  ϴ.
+	 *
+	 * @return Ʈ   ƼƼ  ȯմϴ. Ʈ    ƼƼ  ȯմϴ.
+	 */
+	template <typename... TComponents>
+	uint32_t GetCountOfEntity() const
+	{
+		uint64_t mask = GetComponentMask<TComponents...>();
+		uint32_t countOfEntity = 0;
+
+		for (const auto& archetype : archetypes_)
+		{
+			if ((archetype->mask & mask) == mask)
+			{
+				countOfEntity += static_cast<uint32_t>(archetype->entities.size());
+			}
+		}
+
+		return countOfEntity;
+	}
+
+
+	/**
+	 * @brief ƼƼ   ŰŸ  ϴ.
+	 *
+	 * @return ƼƼ   ŰŸ  ȯմϴ.
+	 */
+	uint32_t GetCountOfArchetype() const { return static_cast<uint32_t>(archetypes_.size()); }
+
+
+private:
+	/**
+	 * @brief Ÿ  Ʈ 迭 ̽Դϴ.
+	 */
+	class IComponentColumn
+	{
+	public:
+		/**
+		 * @brief Ʈ 迭 ̽ Ʈ Դϴ.
+		 */
+		IComponentColumn() = default;
+
+
+		/**
+		 * @brief Ʈ 迭 ̽  ҸԴϴ.
+		 */
+		virtual ~IComponentColumn() {}
+
+
+		/**
+		 * @brief Ʈ 迭 ̽  ڿ  ڸ  մϴ.
+		 */
+		DISALLOW_COPY_AND_ASSIGN(IComponentColumn);
+
+
+		/**
+		 * @brief  Ÿ  Ʈ 迭 մϴ.
+		 *
+		 * @return   Ʈ 迭 ȯմϴ.
+		 */
+		virtual std::unique_ptr<IComponentColumn> CreateEmpty() const = 0;
+
+
+		/**
+		 * @brief ٸ 迭 Ʈ  迭  űϴ.
+		 *
+		 * @param source Ʈ   Ÿ 迭Դϴ.
+		 * @param row ű Ʈ ġԴϴ.
+		 */
+		virtual void MoveFrom(IComponentColumn& source, uint32_t row) = 0;
+
+
+		/**
+		 * @brief Ʈ  Ʈ ٲ  մϴ.
+		 *
+		 * @param row  Ʈ ġԴϴ.
+		 */
+		virtual void SwapRemove(uint32_t row) = 0;
+	};
+
+
+	/**
+	 * @brief  Ÿ Ʈ ӵ ޸𸮿 ϴ 迭Դϴ.
+	 */
+	template <typename TComponent>
+	class ComponentColumn : public IComponentColumn
+	{
+	public:
+		/**
+		 * @brief Ʈ 迭 Ʈ Դϴ.
+		 */
+		ComponentColumn() = default;
+
+
+		/**
+		 * @brief Ʈ 迭  ҸԴϴ.
+		 */
+		virtual ~ComponentColumn() {}
+
+
+		/**
+		 * @brief Ʈ 迭  ڿ  ڸ  մϴ.
+		 */
+		DISALLOW_COPY_AND_ASSIGN(ComponentColumn);
+
+
+		/**
+		 * @brief  Ÿ  Ʈ 迭 մϴ.
+		 *
+		 * @return   Ʈ 迭 ȯմϴ.
+		 */
+		virtual std::unique_ptr<IComponentColumn> CreateEmpty() const override
+		{
+			return std::make_unique<ComponentColumn<TComponent>>();
+		}
+
+
+		/**
+		 * @brief ٸ 迭 Ʈ  迭  űϴ.
+		 *
+		 * @param source Ʈ   Ÿ 迭Դϴ.
+		 * @param row ű Ʈ ġԴϴ.
+		 */
+		virtual void MoveFrom(IComponentColumn& source, uint32_t row) override
+		{
+			components.push_back(std::move(static_cast<ComponentColumn<TComponent>&>(source).components[row]));
+		}
+
+
+		/**
+		 * @brief Ʈ  Ʈ ٲ  մϴ.
+		 *
+		 * @param row  Ʈ ġԴϴ.
+		 */
+		virtual void SwapRemove(uint32_t row) override
+		{
+			if (row + 1 < components.size())
+			{
+				components[row] = std::move(components.back());
+			}
+
+			components.pop_back();
+		}
+
+
+		/**
+		 * @brief ŰŸ  ƼƼ   ƮԴϴ.
+		 */
+		std::vector<TComponent> components;
+	};
+
+
+	/**
+	 * @brief  Ʈ   ƼƼ Դϴ.
+	 */
+	struct Archetype
+	{
+		uint64_t mask = 0;                                                                   // ŰŸ  Ʈ ŸԵ Ʈ ũԴϴ.
+		std::array<std::unique_ptr<IComponentColumn>, MAX_COMPONENT_TYPE> columns;           // Ʈ Ÿ ȣ ϴ Ʈ 迭Դϴ.
+		std::vector<uint32_t> entities;                                                      // (row)  ƼƼ εԴϴ.
+	};
+
+
+	/**
+	 * @brief ƼƼ ϳ Դϴ.
+	 */
+	struct EntityRecord
+	{
+		uint32_t generation = 0;          // ƼƼ ε  Դϴ. ƼƼ Ҵ   մϴ.
+		uint32_t archetype = 0;           // ƼƼ  ŰŸ εԴϴ.
+		uint32_t row = 0;                 // ŰŸ  ƼƼ Դϴ.
+		bool bIsAlive = false;            // ƼƼ ִ Ȯմϴ.
+		bool bIsPendingDestroy = false;   //  ûǾ Ҵ  ٸ Ȯմϴ.
+	};
+
+
+private:
+	/**
+	 * @brief  Ʈ Ÿ ȣ ߱մϴ.
+	 *
+	 * @return ߱޵ Ʈ Ÿ ȣ ȯմϴ.
+	 */
+	static uint32_t AllocateComponentTypeID();
+
+
+	/**
+	 * @brief Ʈ ŸԵ Ʈ ũ ϴ.
+	 *
+	 * @return Ʈ ŸԵ Ʈ ũ ȯմϴ.
+	 */
+	template <typename... TComponents>
+	static uint64_t GetComponentMask()
+	{
+		return (0ULL | ... | (1ULL << GetComponentTypeID<TComponents>()));
+	}
+
+
+	/**
+	 * @brief ŰŸ Ʈ 迭 ϴ.
+	 *
+	 * @param archetype Ʈ 迭  ŰŸԴϴ.
+	 *
+	 * @return ŰŸ Ʈ 迭 ڸ ȯմϴ.
+	 */
+	template <typename TComponent>
+	static ComponentColumn<TComponent>& GetColumn(Archetype& archetype)
+	{
+		return *static_cast<ComponentColumn<TComponent>*>(archetype.columns[GetComponentTypeID<TComponent>()].get());
+	}
+
+
+	/**
+	 * @brief ŰŸ [begin, end)  ȸմϴ.
+	 *
+	 * @param archetype ȸ ŰŸԴϴ.
+	 * @param begin ȸ   Դϴ.
+	 * @param end ȸ   Դϴ.
+	 * @param function ƼƼ ȣ ԼԴϴ.
+	 */
+	template <typename... TComponents, typename TFunction>
+	static void ForEachInRange(Archetype& archetype, uint32_t begin, uint32_t end, TFunction& function)
+	{
+		std::tuple<TComponents*...> arrays(GetColumn<TComponents>(archetype).components.data()...);
+
+		for (uint32_t row = begin; row < end; ++row)
+		{
+			function(std::get<TComponents*>(arrays)[row]...);
+		}
+	}
+
+
+	/**
+	 * @brief Ʈ ŸԵ  ŰŸ ã, ٸ մϴ.
+	 *
+	 * @param mask Ʈ ŸԵ Ʈ ũԴϴ.
+	 *
+	 * @return ŰŸ ε ȯմϴ.
+	 */
+	template <typename... TComponents>
+	uint32_t FindOrCreateArchetype(uint64_t mask)
+	{
+		auto iter = archetypeIndex_.find(mask);
+		if (iter != archetypeIndex_.end())
+		{
+			return iter->second;
+		}
+
+		std::unique_ptr<Archetype> archetype = std::make_unique<Archetype>();
+		archetype->mask = mask;
+		((archetype->columns[GetComponentTypeID<TComponents>()] = std::make_unique<ComponentColumn<TComponents>>()), ...);
+
+		return RegisterArchetype(std::move(archetype));
+	}
+
+
+	/**
+	 * @brief  ŰŸԿ Ʈ ϳ ϰų  ŰŸ ã, ٸ մϴ.
+	 *
+	 * @param mask ã ŰŸ Ʈ ũԴϴ.
+	 * @param baseArchetype  Ǵ ŰŸ εԴϴ.
+	 * @param componentTypeID ϰų  Ʈ Ÿ ȣԴϴ.
+	 * @param addColumn  Ʈ  迭Դϴ. Ʈ ٸ  Դϴ.
+	 *
+	 * @return ŰŸ ε ȯմϴ.
+	 */
+	uint32_t FindOrCreateArchetype(uint64_t mask, uint32_t baseArchetype, uint32_t componentTypeID, std::unique_ptr<IComponentColumn> addColumn);
+
+
+	/**
+	 * @brief ŰŸ մϴ.
+	 *
+	 * @param archetype  ŰŸԴϴ.
+	 *
+	 * @return ϵ ŰŸ ε ȯմϴ.
+	 */
+	uint32_t RegisterArchetype(std::unique_ptr<Archetype> archetype);
+
+
+	/**
+	 * @brief ƼƼ ε Ҵմϴ.
+	 *
+	 * @return Ҵ ƼƼ ڵ ȯմϴ.
+	 */
+	EntityHandle AllocateEntity();
+
+
+	/**
+	 * @brief ƼƼ ٸ ŰŸ űϴ.
+	 *
+	 * @param entityIndex ű ƼƼ εԴϴ.
+	 * @param archetypeIndex Űܰ ŰŸ εԴϴ.
+	 *
+	 * @note Űܰ ŰŸԿ ִ Ʈ 迭 ȣ ʿ ä մϴ.
+	 */
+	void MoveEntity(uint32_t entityIndex, uint32_t archetypeIndex);
+
+
+	/**
+	 * @brief ŰŸԿ  ϰ,   ƼƼ  ڸ űϴ.
+	 *
+	 * @param archetype   ŰŸԴϴ.
+	 * @param row  Դϴ.
+	 */
+	void RemoveRow(Archetype& archetype, uint32_t row);
+
+
+private:
+	/**
+	 * @brief ƼƼ   ŰŸԵԴϴ.
+	 */
+	std::vector<std::unique_ptr<Archetype>> archetypes_;
+
+
+	/**
+	 * @brief Ʈ Ʈ ũ ŰŸ ε Դϴ.
+	 */
+	std::unordered_map<uint64_t, uint32_t> archetypeIndex_;
+
+
+	/**
+	 * @brief ƼƼ ε ϴ ƼƼ  Դϴ.
+	 */
+	std::vector<EntityRecord> entities_;
+
+
+	/**
+	 * @brief   ƼƼ ε Դϴ.
+	 */
+	std::vector<uint32_t> freeEntities_;
+
+
+	/**
+	 * @brief  û ƼƼ ε Դϴ. û  Ҵ մϴ.
+	 */
+	std::vector<uint32_t> pendingDestroys_;
+};
\ No newline at end of file
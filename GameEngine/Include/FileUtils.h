@@ -6,6 +6,8 @@
 
 #include <json/json.h>
 
+#include "BufferView.h"
+
 
 /**
  * @brief   丮  Ȯ  մϴ.
@@ -212,4 +214,14 @@ namespace FileUtils
 	 * @return Json ü ȯմϴ.
 	 */
 	Json::Value ReadJsonFromFile(const std::wstring& path);
+
+
+	/**
+	 * @brief ޸𸮿 ִ Json   Json ü ϴ.
+	 *
+	 * @param buffer Json  Դϴ. ڿ  ʰ ״ Ľմϴ.
+	 *
+	 * @return Json ü ȯմϴ.
+	 */
+	Json::Value ReadJsonFromBuffer(const BufferView& buffer);
 };
\ No newline at end of file
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdint>
+#include <string_view>
+
+#include "StringUtils.h"
+
+
+/**
+ * @brief  ũ  ۿ ڿ ϴ ڿԴϴ.
+ *
+ * @note
+ * -  Ҵ  Ƿ   ȭϴ ؽƮ մϴ.
+ * - 뷮  ڿ ߶ ϸ,  ڿ ׻  ڷ ϴ.
+ * - 뷮  ڸ   Դϴ.
+ */
+template <typename TChar, std::size_t Capacity>
+class BasicFixedString
+{
+public:
+	static_assert(Capacity > 0, "fixed string capacity must be greater than zero...");
+
+
+public:
+	/**
+	 * @brief   ũ ڿ մϴ.
+	 */
+	BasicFixedString() { buffer_[0] = TChar(0); }
+
+
+	/**
+	 * @brief ڿ ؼ  ũ ڿ մϴ.
+	 *
+	 * @param text  ڿԴϴ.
+	 */
+	explicit BasicFixedString(std::basic_string_view<TChar> text) { Assign(text); }
+
+
+	/**
+	 * @brief ȭ ڿ  ۿ ϴ.
+	 *
+	 * @param format  ڿԴϴ.
+	 * @param ... ڿ Ŀ ϴ Դϴ.
+	 *
+	 * @return  ۿ  ڿ ̸ ȯմϴ.
+	 */
+	std::size_t Format(const TChar* format, ...)
+	{
+		va_list args;
+		va_start(args, format);
+		size_ = StringUtils::VFormatTo(buffer_, Capacity, format, args);
+		va_end(args);
+
+		return size_;
+	}
+
+
+	/**
+	 * @brief ڿ  ۿ մϴ.
+	 *
+	 * @param text  ڿԴϴ.
+	 */
+	void Assign(std::basic_string_view<TChar> text)
+	{
+		size_ = std::min<std::size_t>(text.size(), Capacity - 1);
+		std::copy(text.data(), text.data() + size_, buffer_);
+		buffer_[size_] = TChar(0);
+	}
+
+
+	/**
+	 * @brief  ۸  ڿ ϴ.
+	 */
+	void Clear()
+	{
+		size_ = 0;
+		buffer_[0] = TChar(0);
+	}
+
+
+	/**
+	 * @brief  ڷ  ڿ ͸ ϴ.
+	 *
+	 * @return  ڷ  ڿ ͸ ȯմϴ.
+	 */
+	const TChar* GetCStr() const { return buffer_; }
+
+
+	/**
+	 * @brief ڿ 並 ϴ.
+	 *
+	 * @return  ۸ Ű ڿ 並 ȯմϴ.
+	 */
+	std::basic_string_view<TChar> GetView() const { return std::basic_string_view<TChar>(buffer_, size_); }
+
+
+	/**
+	 * @brief ڿ ̸ ϴ.
+	 *
+	 * @return  ڸ  ڿ ̸ ȯմϴ.
+	 */
+	std::size_t GetSize() const { return size_; }
+
+
+	/**
+	 * @brief ڿ  ִ Ȯմϴ.
+	 *
+	 * @return ڿ  ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsEmpty() const { return size_ == 0; }
+
+
+	/**
+	 * @brief ڿ  ȯմϴ.
+	 *
+	 * @return  ۸ Ű ڿ 並 ȯմϴ.
+	 */
+	operator std::basic_string_view<TChar>() const { return GetView(); }
+
+
+private:
+	/**
+	 * @brief ڿ ϴ  Դϴ.
+	 */
+	TChar buffer_[Capacity];
+
+
+	/**
+	 * @brief  ڸ  ڿ Դϴ.
+	 */
+	std::size_t size_ = 0;
+};
+
+
+/**
+ * @brief char ڿ ϴ  ũ ڿԴϴ.
+ */
+template <std::size_t Capacity>
+using FixedString = BasicFixedString<char, Capacity>;
+
+
+/**
+ * @brief wchar_t ڿ ϴ  ũ ڿԴϴ.
+ */
+template <std::size_t Capacity>
+using FixedWString = BasicFixedString<wchar_t, Capacity>;
\ No newline at end of file
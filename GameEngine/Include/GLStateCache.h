@@ -0,0 +1,383 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+
+#include "Macro.h"
+
+
+/**
+ * @brief OpenGL  ĳð  ¸ ٲ  ȣϴ Լ ̺Դϴ.
+ *
+ * @note
+ * - ⺻ ̺ OpenGL Լ ȣմϴ. ׽Ʈ ȣ ϴ ̺ ٲ㼭   ֽϴ.
+ * - ؽó  GL_TEXTURE0   0 ϴ ȣ ѱϴ.
+ */
+struct GLFunctionTable
+{
+	void (*useProgram)(uint32_t program) = nullptr;                                                              // glUseProgramԴϴ.
+	void (*bindVertexArray)(uint32_t vertexArray) = nullptr;                                                     // glBindVertexArrayԴϴ.
+	void (*bindBuffer)(uint32_t target, uint32_t buffer) = nullptr;                                              // glBindBufferԴϴ.
+	void (*activeTexture)(uint32_t unit) = nullptr;                                                              // glActiveTextureԴϴ.
+	void (*bindTexture)(uint32_t target, uint32_t texture) = nullptr;                                            // glBindTextureԴϴ.
+	void (*bindFramebuffer)(uint32_t framebuffer) = nullptr;                                                     // GL_FRAMEBUFFER  glBindFramebufferԴϴ.
+	void (*viewport)(int32_t x, int32_t y, int32_t width, int32_t height) = nullptr;                             // glViewportԴϴ.
+	void (*enable)(uint32_t capability) = nullptr;                                                               // glEnableԴϴ.
+	void (*disable)(uint32_t capability) = nullptr;                                                              // glDisableԴϴ.
+	void (*blendFuncSeparate)(uint32_t srcRGB, uint32_t dstRGB, uint32_t srcAlpha, uint32_t dstAlpha) = nullptr; // glBlendFuncSeparateԴϴ.
+	void (*depthFunc)(uint32_t func) = nullptr;                                                                  // glDepthFuncԴϴ.
+	void (*cullFace)(uint32_t mode) = nullptr;                                                                   // glCullFaceԴϴ.
+	void (*deleteProgram)(uint32_t program) = nullptr;                                                           // glDeleteProgramԴϴ.
+	void (*deleteVertexArray)(uint32_t vertexArray) = nullptr;                                                   // Ʈ ϳ ϴ glDeleteVertexArraysԴϴ.
+	void (*deleteBuffer)(uint32_t buffer) = nullptr;                                                             // Ʈ ϳ ϴ glDeleteBuffersԴϴ.
+	void (*deleteTexture)(uint32_t texture) = nullptr;                                                           // Ʈ ϳ ϴ glDeleteTexturesԴϴ.
+	void (*deleteFramebuffer)(uint32_t framebuffer) = nullptr;                                                   // Ʈ ϳ ϴ glDeleteFramebuffersԴϴ.
+};
+
+
+/**
+ * @brief   OpenGL ¸ ϰ,  ٲ ʴ ȣ ϴ  ĳԴϴ.
+ *
+ * @note
+ * -  Ŭ ̱Դϴ.
+ * - α׷,  迭 Ʈ, , ؽó ֺ ؽó,  , Ʈ, //ø ¸ մϴ.
+ * - ĳð 𸣴 ´    ΰ,    ¿  ù ȣ ׻ OpenGL մϴ.
+ * - ĳø ġ ʰ ¸ ٲٴ ڵ(ܺ ̺귯 )  ڿ ݵ Invalidate ȣؾ մϴ.
+ * - ϴ Ʈ ݵ ĳ Delete 迭 ޼ ؾ մϴ.  ̸ Ǿ ĳð ߳ ʽϴ.
+ * - GL_ELEMENT_ARRAY_BUFFER  迭 Ʈ ̹Ƿ BindBuffer ĳ ʽϴ.
+ */
+class GLStateCache
+{
+public:
+	/**
+	 * @brief  ĳ ȣ Դϴ.
+	 */
+	struct Statistics
+	{
+		uint32_t countOfCall = 0;   // ĳÿ û   ȣ Դϴ.
+		uint32_t countOfElided = 0; //  ٲ ʾ OpenGL   ȣ Դϴ.
+	};
+
+
+public:
+	/**
+	 * @brief OpenGL  ĳ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(GLStateCache);
+
+
+	/**
+	 * @brief OpenGL  ĳ  νϽ ϴ.
+	 *
+	 * @return OpenGL  ĳ ڸ ȯմϴ.
+	 */
+	static GLStateCache& Get()
+	{
+		static GLStateCache instance;
+		return instance;
+	}
+
+
+	/**
+	 * @brief ¸ ٲ  ȣ Լ ̺ մϴ.
+	 *
+	 * @param functions  Լ ̺Դϴ.
+	 *
+	 * @note Լ ̺ ٲٸ ĳ ¸     ʱȭմϴ.
+	 */
+	void SetFunctionTable(const GLFunctionTable& functions);
+
+
+	/**
+	 * @brief ĳ ¸     ʱȭմϴ.
+	 *
+	 * @note OpenGL ؽƮ  ڳ, ĳø ġ ʰ ¸ ٲٴ ڵ带  ڿ ȣմϴ.
+	 */
+	void Invalidate();
+
+
+	/**
+	 * @brief ̴ α׷ մϴ.
+	 *
+	 * @param program  ̴ α׷Դϴ.
+	 */
+	void UseProgram(uint32_t program);
+
+
+	/**
+	 * @brief  迭 Ʈ εմϴ.
+	 *
+	 * @param vertexArray ε  迭 ƮԴϴ.
+	 */
+	void BindVertexArray(uint32_t vertexArray);
+
+
+	/**
+	 * @brief ۸  εմϴ.
+	 *
+	 * @param target ε Դϴ. GL_ARRAY_BUFFERó  迭 Ʈ  ʴ ̾ մϴ.
+	 * @param buffer ε Դϴ.
+	 */
+	void BindBuffer(uint32_t target, uint32_t buffer);
+
+
+	/**
+	 * @brief Ȱȭ ؽó  մϴ.
+	 *
+	 * @param unit Ȱȭ ؽó Դϴ. GL_TEXTURE0   0 ϴ ȣԴϴ.
+	 */
+	void ActiveTexture(uint32_t unit);
+
+
+	/**
+	 * @brief ؽó   ؽó εմϴ.
+	 *
+	 * @param unit ε ؽó Դϴ. GL_TEXTURE0   0 ϴ ȣԴϴ.
+	 * @param target ε ؽó Դϴ.
+	 * @param texture ε ؽóԴϴ.
+	 *
+	 * @note ̹ εǾ  ؽó ֵ ٲ ʽϴ.
+	 */
+	void BindTexture(uint32_t unit, uint32_t target, uint32_t texture);
+
+
+	/**
+	 * @brief  Ȱȭ ؽó   ؽó εմϴ.
+	 *
+	 * @param target ε ؽó Դϴ.
+	 * @param texture ε ؽóԴϴ.
+	 *
+	 * @note Ȱȭ ؽó     0 ؽó  մϴ.
+	 */
+	void BindTexture(uint32_t target, uint32_t texture);
+
+
+	/**
+	 * @brief  ۸ GL_FRAMEBUFFER  εմϴ.
+	 *
+	 * @param framebuffer ε  Դϴ. 0̸ ⺻  Դϴ.
+	 */
+	void BindFramebuffer(uint32_t framebuffer);
+
+
+	/**
+	 * @brief Ʈ մϴ.
+	 *
+	 * @param x Ʈ 簢  ϴ x ǥԴϴ.
+	 * @param y Ʈ 簢  ϴ y ǥԴϴ.
+	 * @param width Ʈ  ũԴϴ.
+	 * @param height Ʈ  ũԴϴ.
+	 */
+	void SetViewport(int32_t x, int32_t y, int32_t width, int32_t height);
+
+
+	/**
+	 * @brief OpenGL  Ȱȭϰų Ȱȭմϴ.
+	 *
+	 * @param capability  Դϴ. GL_DEPTH_TEST, GL_BLEND, GL_CULL_FACE Դϴ.
+	 * @param bIsEnable  Ȱȭ Դϴ.
+	 */
+	void SetCapability(uint32_t capability, bool bIsEnable);
+
+
+	/**
+	 * @brief  Լ մϴ.
+	 *
+	 * @param srcRGB ҽ RGB  Դϴ.
+	 * @param dstRGB  RGB  Դϴ.
+	 * @param srcAlpha ҽ   Դϴ.
+	 * @param dstAlpha    Դϴ.
+	 */
+	void SetBlendFunc(uint32_t srcRGB, uint32_t dstRGB, uint32_t srcAlpha, uint32_t dstAlpha);
+
+
+	/**
+	 * @brief   Լ մϴ.
+	 *
+	 * @param func    ԼԴϴ.
+	 */
+	void SetDepthFunc(uint32_t func);
+
+
+	/**
+	 * @brief ø  մϴ.
+	 *
+	 * @param mode ø Դϴ. GL_BACK, GL_FRONT, GL_FRONT_AND_BACK  ϳԴϴ.
+	 */
+	void SetCullFace(uint32_t mode);
+
+
+	/**
+	 * @brief ̴ α׷ մϴ.
+	 *
+	 * @param program  ̴ α׷Դϴ.
+	 */
+	void DeleteProgram(uint32_t program);
+
+
+	/**
+	 * @brief  迭 Ʈ մϴ.
+	 *
+	 * @param vertexArray   迭 ƮԴϴ.
+	 */
+	void DeleteVertexArray(uint32_t vertexArray);
+
+
+	/**
+	 * @brief ۸ մϴ.
+	 *
+	 * @param buffer  Դϴ.
+	 */
+	void DeleteBuffer(uint32_t buffer);
+
+
+	/**
+	 * @brief ؽó մϴ.
+	 *
+	 * @param texture  ؽóԴϴ.
+	 */
+	void DeleteTexture(uint32_t texture);
+
+
+	/**
+	 * @brief  ۸ մϴ.
+	 *
+	 * @param framebuffer   Դϴ.
+	 */
+	void DeleteFramebuffer(uint32_t framebuffer);
+
+
+	/**
+	 * @brief  ĳ ȣ 踦 ϴ.
+	 *
+	 * @return  ĳ ȣ 踦 ȯմϴ.
+	 */
+	const Statistics& GetStatistics() const { return statistics_; }
+
+
+	/**
+	 * @brief  ĳ ȣ 踦 ʱȭմϴ.
+	 */
+	void ResetStatistics() { statistics_ = Statistics(); }
+
+
+private:
+	/**
+	 * @brief OpenGL  ĳ Դϴ.
+	 *
+	 * @note HEADLESS_MODE ƴϸ OpenGL Լ ȣϴ ⺻ Լ ̺ մϴ.
+	 */
+	GLStateCache();
+
+
+	/**
+	 * @brief OpenGL  ĳ  ҸԴϴ.
+	 */
+	virtual ~GLStateCache() {}
+
+
+	/**
+	 * @brief   ȣ 迡 մϴ.
+	 *
+	 * @param bIsElided ȣ ߴ Դϴ.
+	 *
+	 * @return ȣ   true ȯմϴ.
+	 */
+	bool Record(bool bIsElided);
+
+
+	/**
+	 * @brief ؽó ְ  ϳ ĳ Ű ϴ.
+	 *
+	 * @param unit ؽó Դϴ.
+	 * @param target ؽó Դϴ.
+	 *
+	 * @return ؽó ĳ Ű ȯմϴ.
+	 */
+	static uint64_t GetTextureKey(uint32_t unit, uint32_t target) { return (static_cast<uint64_t>(unit) << 32) | target; }
+
+
+private:
+	/**
+	 * @brief ¸ ٲ  ȣ Լ ̺Դϴ.
+	 */
+	GLFunctionTable functions_;
+
+
+	/**
+	 * @brief   ̴ α׷Դϴ.
+	 */
+	uint32_t program_ = 0;
+
+
+	/**
+	 * @brief ε  迭 ƮԴϴ.
+	 */
+	uint32_t vertexArray_ = 0;
+
+
+	/**
+	 * @brief ε  Դϴ.
+	 */
+	uint32_t framebuffer_ = 0;
+
+
+	/**
+	 * @brief Ȱȭ ؽó Դϴ.
+	 */
+	uint32_t activeTextureUnit_ = 0;
+
+
+	/**
+	 * @brief    ԼԴϴ.
+	 */
+	uint32_t depthFunc_ = 0;
+
+
+	/**
+	 * @brief  ø Դϴ.
+	 */
+	uint32_t cullFace_ = 0;
+
+
+	/**
+	 * @brief   Լ ҽ RGB,  RGB, ҽ ,   Դϴ.
+	 */
+	uint32_t blendFunc_[4] = { 0, 0, 0, 0 };
+
+
+	/**
+	 * @brief  Ʈ x, y, ,  ũԴϴ.
+	 */
+	int32_t viewport_[4] = { 0, 0, 0, 0 };
+
+
+	/**
+	 * @brief Ʈ ˰ ִ Դϴ.
+	 */
+	bool bIsKnownViewport_ = false;
+
+
+	/**
+	 * @brief 󺰷 ε Դϴ. Ű     Դϴ.
+	 */
+	std::unordered_map<uint32_t, uint32_t> buffers_;
+
+
+	/**
+	 * @brief ؽó ְ 󺰷 ε ؽóԴϴ. Ű     Դϴ.
+	 */
+	std::unordered_map<uint64_t, uint32_t> textures_;
+
+
+	/**
+	 * @brief ɺ Ȱȭ Դϴ. Ű     Դϴ.
+	 */
+	std::unordered_map<uint32_t, bool> capabilities_;
+
+
+	/**
+	 * @brief  ĳ ȣ Դϴ.
+	 */
+	Statistics statistics_;
+};
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "BufferView.h"
+#include "Vector2.h"
+
+
+/**
+ * @brief ؽó Ʋ󽺿 ǥõ ۸Դϴ.
+ */
+struct Glyph
+{
+	int32_t codePoint;
+	Vector2i position0;
+	Vector2i position1;
+	float xoffset;
+	float yoffset;
+	float xoffset2;
+	float yoffset2;
+	float xadvance;
+};
+
+
+/**
+ * @brief Ʈ Ÿ Ʈ ŷ ۸ ؽó ƲԴϴ.
+ *
+ * @note
+ * - ۸ , 8Ʈ  ä Ʈ, Ʈ Ʈ Բ  Ϸ ȭ  ֽϴ.
+ * - ȭ Ͽ Ʈ Ÿ Ʈ   ŷ ڷ  ؽ  ϵ˴ϴ.
+ * - ؽ  ٸų  ջǾٸ ȭ ϹǷ, ٽ ŷؾ մϴ.
+ * - ȣ ִ Ÿ(Signed Distance Field) Ʋ󽺴    ũ ؽƮ ׸  ֽϴ.
+ */
+struct GlyphAtlas
+{
+	/**
+	 * @brief ۸ ؽó Ʋ Ʈ Դϴ.
+	 */
+	enum class EType : int32_t
+	{
+		Bitmap              = 0x00, // ۸ Ŀ մϴ. ŷ ũθ ϰ ׸  ֽϴ.
+		SignedDistanceField = 0x01, // ۸ ܰ ȣ ִ Ÿ մϴ. ܰ   128Դϴ.
+	};
+
+
+	/**
+	 * @brief Ʈ Ÿ Ʈ   ŷ ڷ  ؽ  մϴ.
+	 *
+	 * @param buffer Ʈ Ÿ Ʈ ҽ Դϴ.
+	 * @param beginCodePoint ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+	 * @param endCodePoint ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+	 * @param fontSize Ʈ ũԴϴ.
+	 * @param type ۸ ؽó Ʋ Ʈ Դϴ.
+	 * @param distanceRange ȣ ִ Ÿ Ÿ Դϴ. Ʈ Ʋ󽺶 0Դϴ.
+	 *
+	 * @return   ؽ  ȯմϴ.
+	 */
+	static uint64_t ComputeSourceHash(const BufferView& buffer, int32_t beginCodePoint, int32_t endCodePoint, float fontSize, EType type, int32_t distanceRange);
+
+
+	/**
+	 * @brief Ʈ Ÿ Ʈ ŷؼ ۸ ؽó Ʋ󽺸 մϴ.
+	 *
+	 * @note
+	 * - ۸ ؽó Ʋ   ũ ϴ.
+	 * - 16 ؼ  ۸   ũ⸦  辿 øϴ.
+	 *
+	 * @param buffer Ʈ Ÿ Ʈ ҽ Դϴ.
+	 * @param beginCodePoint ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+	 * @param endCodePoint ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+	 * @param fontSize Ʈ ũԴϴ.
+	 * @param outGlyphAtlas  ۸ ؽó ƲԴϴ.
+	 */
+	static void Pack(const BufferView& buffer, int32_t beginCodePoint, int32_t endCodePoint, float fontSize, GlyphAtlas& outGlyphAtlas);
+
+
+	/**
+	 * @brief Ʈ Ÿ Ʈ ۸ ȣ ִ Ÿ ϰ ŷؼ ۸ ؽó Ʋ󽺸 մϴ.
+	 *
+	 * @note
+	 * - ۸ 簢 ܰ ٱ Ÿ ŭ  ϴ.
+	 * - ܰ   128̸, Ÿ ŭ ٱ̸ 0Դϴ.  128 Ůϴ.
+	 *
+	 * @param buffer Ʈ Ÿ Ʈ ҽ Դϴ.
+	 * @param beginCodePoint ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+	 * @param endCodePoint ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+	 * @param fontSize Ÿ  Ʈ ũԴϴ.
+	 * @param distanceRange Ÿ ǥϴ ȼ  Ÿ Դϴ.
+	 * @param outGlyphAtlas  ۸ ؽó ƲԴϴ.
+	 */
+	static void PackSignedDistanceField(const BufferView& buffer, int32_t beginCodePoint, int32_t endCodePoint, float fontSize, int32_t distanceRange, GlyphAtlas& outGlyphAtlas);
+
+
+	/**
+	 * @brief ۸ ؽó Ʋ󽺸 Ͽ  ۷ ȭմϴ.
+	 *
+	 * @return ȭ ۸ ȯմϴ.
+	 */
+	std::vector<uint8_t> Serialize() const;
+
+
+	/**
+	 * @brief ȭ ۷κ ۸ ؽó Ʋ󽺸 нϴ.
+	 *
+	 * @param buffer ȭ Դϴ.
+	 * @param sourceHash ϴ  ؽ Դϴ.
+	 * @param outGlyphAtlas  ۸ ؽó ƲԴϴ.
+	 *
+	 * @return ۰ ȿϰ  ؽ  ٸ true, ׷  false ȯմϴ.
+	 */
+	static bool Deserialize(const BufferView& buffer, uint64_t sourceHash, GlyphAtlas& outGlyphAtlas);
+
+
+	uint64_t sourceHash = 0;       // Ʈ Ÿ Ʈ   ŷ ڷ   ؽ Դϴ.
+	EType type = EType::Bitmap;    // ۸ ؽó Ʋ Ʈ Դϴ.
+	int32_t distanceRange = 0;     // ȣ ִ Ÿ ȼ  Ÿ Դϴ. Ʈ Ʋ󽺶 0Դϴ.
+	int32_t beginCodePoint = 0;    // ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+	int32_t endCodePoint = 0;      // ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+	float fontSize = 0.0f;         // Ʈ ũԴϴ.
+	int32_t glyphAtlasSize = 0;    // ۸ ؽó Ʋ   ũԴϴ.
+	float ascent = 0.0f;           // ؼ   ۸ ʱ ȼ  ŸԴϴ.
+	float descent = 0.0f;          // ؼ   ۸ Ʒʱ ȼ  ŸԴϴ.  Դϴ.
+	float lineGap = 0.0f;          //   ȼ  Դϴ.
+	std::vector<Glyph> glyphs;     //   ڵ Ʈ   ۸ Դϴ.
+	std::vector<uint8_t> bitmap;   // ۸ ؽó Ʋ 8Ʈ  ä ƮԴϴ.
+};
\ No newline at end of file
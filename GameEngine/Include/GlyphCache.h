@@ -0,0 +1,464 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <stb_rect_pack.h>
+#include <stb_truetype.h>
+
+#include "GlyphAtlas.h"
+#include "IResource.h"
+#include "TextLayout.h"
+#include "Vector2.h"
+
+
+/**
+ * @brief ó   ۸ Ͷؼ  ũ Ʋ  ġϴ  ۸ ĳԴϴ.
+ *
+ * @note
+ * - ڵ Ʈ  ̸ ŷ Ƿ, ѱ̳ ü ڵ ؽƮ  ޸𸮷 ׸  ֽϴ.
+ * -        ٽ մϴ.
+ * - stb_rect_pack  簢   Ƿ,  ٽ    ӿ  ۸  ȿ ٽ ġϰ  ۸ մϴ.
+ * - ٽ ġ ۸ Ʋ ǥ ٲ ʹ ˴ϴ.
+ * -  Ͷ   ϳ 簢 Ҵٰ Flush   ؽó ϴ.
+ * -  Ŵ ϸ,   ؽƮ ۸ û ξٰ     Flush  ؽƮ ׸ Tickմϴ.
+ * - HEADLESS_MODE ؽó  ʰ, CPU Ʈʰ ġ    մϴ.
+ */
+class GlyphCache : public IResource
+{
+public:
+	/**
+	 * @brief ĳÿ ġ ۸Դϴ.
+	 */
+	struct CachedGlyph
+	{
+		Glyph glyph;                //   ġ Ʈ  ۸Դϴ. Ʈ  ۸ ġ (0, 0)Դϴ.
+		int32_t page = -1;          // ۸ ġ  εԴϴ. ó Ʈ  ۸ -1Դϴ.
+		uint64_t lastUsedFrame = 0; // ۸    ȣԴϴ.
+	};
+
+
+	/**
+	 * @brief ۸ ĳ Դϴ.
+	 */
+	struct Statistics
+	{
+		uint64_t countOfHit = 0;          // ĳÿ ã ۸ û Դϴ.
+		uint64_t countOfMiss = 0;         // Ͷ ۸ û Դϴ.
+		uint64_t countOfOverflow = 0;     //  ӿ  ۸     ġ  ۸ û Դϴ.
+		uint64_t countOfEvictedPage = 0;  // ٽ   Դϴ.
+		uint64_t countOfEvictedGlyph = 0; //  ٽ ϸ鼭  ۸ Դϴ.
+		uint64_t countOfMovedGlyph = 0;   //  ٽ ϸ鼭 ٽ ġ   ۸ Դϴ.
+		uint64_t countOfUpload = 0;       // ؽó  簢 Դϴ.
+		uint64_t uploadBytes = 0;         // ؽó  Ʈ Դϴ.
+	};
+
+
+public:
+	/**
+	 * @brief ۸ ĳ ⺻ Դϴ.
+	 *
+	 * @note ʱȭ ϱ ؼ ݵ  ʱȭ ޼带 ȣؾ մϴ.
+	 */
+	GlyphCache() = default;
+
+
+	/**
+	 * @brief ۸ ĳ  ҸԴϴ.
+	 *
+	 * @note  ϱ ؼ ݵ Release ޼带 ȣؾ մϴ.
+	 */
+	virtual ~GlyphCache();
+
+
+	/**
+	 * @brief ۸ ĳ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(GlyphCache);
+
+
+#if !defined(HEADLESS_MODE)
+	/**
+	 * @brief Ʈ Ÿ Ʈ  а ۸ ĳø ʱȭմϴ.
+	 *
+	 * @param path Ʈ Ÿ Ʈ  Դϴ.
+	 * @param fontSize Ʈ ũԴϴ.
+	 * @param pageSize Ʋ    ũԴϴ.
+	 * @param maxCountOfPage Ʋ  ִ Դϴ.
+	 */
+	void Initialize(const std::wstring& path, float fontSize, int32_t pageSize, int32_t maxCountOfPage);
+#endif
+
+
+	/**
+	 * @brief Ʈ Ÿ Ʈ ҽ ۷ ۸ ĳø ʱȭմϴ.
+	 *
+	 * @note ۸ Ͷϴ  ۸ ϹǷ, ۸ ĳð ۸ ؼ ϴ.
+	 *
+	 * @param buffer Ʈ Ÿ Ʈ ҽ Դϴ.
+	 * @param fontSize Ʈ ũԴϴ.
+	 * @param pageSize Ʋ    ũԴϴ.
+	 * @param maxCountOfPage Ʋ  ִ Դϴ.
+	 */
+	void Initialize(const std::vector<uint8_t>& buffer, float fontSize, int32_t pageSize, int32_t maxCountOfPage);
+
+
+	/**
+	 * @brief ۸ ĳ  ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief ڵ Ʈ ۸ ã, ĳÿ ٸ Ͷؼ  ġմϴ.
+	 *
+	 * @note
+	 * - ۸ ۸ ġ   ӿ   մϴ.
+	 * - ȯ ʹ     ȿ,  ӿ  ٽ ϸ Ʋ ǥ ٲ  ֽϴ.
+	 *
+	 * @param codePoint ã ۸ ڵ ƮԴϴ.
+	 *
+	 * @return ĳÿ ġ ۸ ȯմϴ.  ũų  ӿ  ۸    áٸ nullptr ȯմϴ.
+	 */
+	const CachedGlyph* FindOrAddGlyph(int32_t codePoint);
+
+
+	/**
+	 * @brief ؽƮ ۸ 簢    մϴ.
+	 *
+	 * @note
+	 * - ؽƮ ũ ؼ TTFont   մϴ.
+	 * -  0  ʷ ϹǷ,    ׸  ֽϴ.
+	 * -  ۸ ã ڿ  Ƿ, ã ߿ ٽ ġ ۸ ٲ Ʋ ǥ ׸ϴ.
+	 * - ĳÿ ġ  ۸ ǳʶݴϴ.
+	 *
+	 * @param text ġ ؽƮԴϴ.
+	 * @param center ؽƮ ߽ ǥԴϴ.
+	 * @param outVertices    Դϴ. ؽƮ  6 ̻̾ մϴ.
+	 * @param outCountOfPageVertices    Դϴ. ũ  ִ  ˴ϴ.
+	 *
+	 * @return    ȯմϴ.
+	 */
+	uint32_t GenerateGlyphVertices(std::wstring_view text, const Vector2f& center, TextLayout::GlyphVertex* outVertices, std::vector<uint32_t>& outCountOfPageVertices);
+
+
+	/**
+	 * @brief ؽƮ ۸ ã, ĳÿ ٸ Ͷؼ  ġմϴ.
+	 *
+	 * @note   Ƿ,   GenerateRequestedGlyphVertices  մϴ.
+	 *
+	 * @param text ۸ û ؽƮԴϴ.
+	 */
+	void RequestGlyphs(std::wstring_view text);
+
+
+	/**
+	 * @brief RequestGlyphs û ؽƮ ۸ 簢    մϴ.
+	 *
+	 * @note
+	 * - ĳø ٲ ʰ 赵  Ƿ,  ӿ û ؽƮ ٽ ġ Ʋ ǥ ׸  ֽϴ.
+	 * - ĳÿ  ۸ ǳʶݴϴ.
+	 *
+	 * @param text ġ ؽƮԴϴ.
+	 * @param center ؽƮ ߽ ǥԴϴ.
+	 * @param outVertices    Դϴ. ؽƮ  6 ̻̾ մϴ.
+	 * @param outCountOfPageVertices    Դϴ. ũ  ִ  ˴ϴ.
+	 *
+	 * @return    ȯմϴ.
+	 */
+	uint32_t GenerateRequestedGlyphVertices(std::wstring_view text, const Vector2f& center, TextLayout::GlyphVertex* outVertices, std::vector<uint32_t>& outCountOfPageVertices);
+
+
+	/**
+	 * @brief    Ͷ  ؽó ϴ.
+	 *
+	 * @note     ǳʶٹǷ,  ۸ ٸ ƹ͵  ʽϴ.
+	 */
+	void Flush();
+
+
+	/**
+	 * @brief   Ѿϴ.
+	 *
+	 * @note  Ͷ  ؽó , ķδ  ӿ  ۸   ֽϴ.
+	 */
+	void Tick();
+
+
+	/**
+	 * @brief Ʈ ũ⸦ ϴ.
+	 *
+	 * @return Ʈ ũ⸦ ȯմϴ.
+	 */
+	float GetFontSize() const { return fontSize_; }
+
+
+	/**
+	 * @brief Ʋ    ũ⸦ ϴ.
+	 *
+	 * @return Ʋ    ũ⸦ ȯմϴ.
+	 */
+	int32_t GetPageSize() const { return pageSize_; }
+
+
+	/**
+	 * @brief Ʋ  ִ  ϴ.
+	 *
+	 * @return Ʋ  ִ  ȯմϴ.
+	 */
+	int32_t GetMaxCountOfPage() const { return static_cast<int32_t>(pages_.size()); }
+
+
+	/**
+	 * @brief Ʋ  8Ʈ  ä Ʈ ϴ.
+	 *
+	 * @param page Ʋ  εԴϴ.
+	 *
+	 * @return Ʋ  Ʈ ȯմϴ.
+	 */
+	const std::vector<uint8_t>& GetPageBitmap(int32_t page) const { return pages_[page].bitmap; }
+
+
+	/**
+	 * @brief Ʋ  ؽó ̵ ϴ.
+	 *
+	 * @param page Ʋ  εԴϴ.
+	 *
+	 * @return Ʋ  ؽó ̵ ȯմϴ. HEADLESS_MODE ׻ 0Դϴ.
+	 */
+	uint32_t GetPageTextureID(int32_t page) const { return pages_[page].textureID; }
+
+
+	/**
+	 * @brief ĳÿ ִ ۸  ϴ.
+	 *
+	 * @return ĳÿ ִ ۸  ȯմϴ.
+	 */
+	std::size_t GetCountOfGlyph() const { return glyphs_.size(); }
+
+
+	/**
+	 * @brief   ȣ ϴ.
+	 *
+	 * @return Tick ȣ  1 ϴ  ȣ ȯմϴ.
+	 */
+	uint64_t GetFrame() const { return frame_; }
+
+
+	/**
+	 * @brief ۸ ĳ 踦 ϴ.
+	 *
+	 * @return ۸ ĳ 踦 ȯմϴ.
+	 */
+	const Statistics& GetStatistics() const { return statistics_; }
+
+
+private:
+	/**
+	 * @brief ۸ ġϴ  ũ Ʋ Դϴ.
+	 */
+	struct Page
+	{
+		stbrp_context packContext;       //  簢 ŷ Դϴ.   ŰǷ  ű ٽ ʱȭؾ մϴ.
+		std::vector<stbrp_node> nodes;   // 簢 ŷ ϴ  Դϴ.
+		std::vector<uint8_t> bitmap;     //  8Ʈ  ä ƮԴϴ.
+		std::vector<int32_t> codePoints; //  ġ ۸ ڵ Ʈ Դϴ.
+		uint32_t textureID = 0;          //  ؽó ̵Դϴ.
+		uint64_t lastUsedOrder = 0;      //    Դϴ.
+		bool bIsDirty = false;           // ؽó    ִ Ȯմϴ.
+		Vector2i dirtyMin;               // ؽó    ּ ǥԴϴ.
+		Vector2i dirtyMax;               // ؽó    ִ ǥԴϴ.  ǥ  Ե ʽϴ.
+	};
+
+
+	/**
+	 * @brief ã  ؽƮ ۸  ۸ 簢    մϴ.
+	 *
+	 * @param center ؽƮ ߽ ǥԴϴ.
+	 * @param outVertices    Դϴ.
+	 * @param outCountOfPageVertices    Դϴ.
+	 *
+	 * @return    ȯմϴ.
+	 */
+	uint32_t WriteGlyphVertices(const Vector2f& center, TextLayout::GlyphVertex* outVertices, std::vector<uint32_t>& outCountOfPageVertices);
+
+
+	/**
+	 * @brief  簢 ŷ ¿ Ʈ ϴ.
+	 *
+	 * @param page  Դϴ.
+	 */
+	void ResetPage(Page& page);
+
+
+	/**
+	 * @brief  簢 ġմϴ.
+	 *
+	 * @param page 簢 ġ Դϴ.
+	 * @param width ġ 簢  ũԴϴ.
+	 * @param height ġ 簢  ũԴϴ.
+	 * @param outPosition ġ 簢   ǥԴϴ.
+	 *
+	 * @return ġ ߴٸ true,   ٸ false ȯմϴ.
+	 */
+	bool PackRect(Page& page, int32_t width, int32_t height, Vector2i& outPosition);
+
+
+	/**
+	 * @brief     ٽ ؼ 簢 ġմϴ.
+	 *
+	 * @param width ġ 簢  ũԴϴ.
+	 * @param height ġ 簢  ũԴϴ.
+	 * @param outPosition ġ 簢   ǥԴϴ.
+	 *
+	 * @return 簢 ġ  ε ȯմϴ. ٽ   ִ  ٸ -1 ȯմϴ.
+	 */
+	int32_t RecycleLeastRecentlyUsedPage(int32_t width, int32_t height, Vector2i& outPosition);
+
+
+	/**
+	 * @brief  ӿ  ۸ ٽ ġϰ  ۸   簢 ġմϴ.
+	 *
+	 * @note ӽ ŷ ·  ġ ,  簢    ٲߴϴ.
+	 *
+	 * @param page ٽ  Դϴ.
+	 * @param width ġ 簢  ũԴϴ.
+	 * @param height ġ 簢  ũԴϴ.
+	 * @param outPosition ġ 簢   ǥԴϴ.
+	 *
+	 * @return  ٽ ߴٸ true,  ۸ ų 簢  ʴ´ٸ false ȯմϴ.
+	 */
+	bool RecyclePage(Page& page, int32_t width, int32_t height, Vector2i& outPosition);
+
+
+	/**
+	 * @brief   ֱٿ   մϴ.
+	 *
+	 * @param page   εԴϴ.
+	 */
+	void TouchPage(int32_t page);
+
+
+private:
+	/**
+	 * @brief ۸ Ͷϴ  ϴ Ʈ Ÿ Ʈ ҽ Դϴ.
+	 */
+	std::vector<uint8_t> buffer_;
+
+
+	/**
+	 * @brief Ʈ Ÿ Ʈ Դϴ.
+	 */
+	stbtt_fontinfo info_;
+
+
+	/**
+	 * @brief Ʈ ũԴϴ.
+	 */
+	float fontSize_ = 0.0f;
+
+
+	/**
+	 * @brief Ʈ  ȼ  ٲٴ Դϴ.
+	 */
+	float scale_ = 0.0f;
+
+
+	/**
+	 * @brief Ʋ    ũԴϴ.
+	 */
+	int32_t pageSize_ = 0;
+
+
+	/**
+	 * @brief Ʋ  Դϴ.
+	 */
+	std::vector<Page> pages_;
+
+
+	/**
+	 * @brief ۸ ġϱ   Դϴ.
+	 *
+	 * @note       ִٸ   ʰ   մϴ.
+	 */
+	int32_t countOfOpenPage_ = 0;
+
+
+	/**
+	 * @brief ڵ Ʈ ã ĳõ ۸ Դϴ.
+	 */
+	std::unordered_map<int32_t, CachedGlyph> glyphs_;
+
+
+	/**
+	 * @brief  ϴ  ؽƮ ۸  δ Դϴ.
+	 *
+	 * @note    ޸𸮸 Ҵ ʵ մϴ.
+	 */
+	std::vector<const CachedGlyph*> textGlyphs_;
+
+
+	/**
+	 * @brief  ϴ      ġ  δ Դϴ.
+	 */
+	std::vector<uint32_t> pageVertexOffsets_;
+
+
+	/**
+	 * @brief  ٽ    ġ  ӽ ŷ Դϴ.
+	 */
+	stbrp_context repackContext_;
+
+
+	/**
+	 * @brief ӽ ŷ ° ϴ  Դϴ.
+	 */
+	std::vector<stbrp_node> repackNodes_;
+
+
+	/**
+	 * @brief  ٽ   ġ 簢 Դϴ.
+	 *
+	 * @note  簢  ۸ 簢̰,  簢 ̵  ڵ Ʈ  εԴϴ.
+	 */
+	std::vector<stbrp_rect> repackRects_;
+
+
+	/**
+	 * @brief  ٽ ϱ  ڵ Ʈ Դϴ.
+	 */
+	std::vector<int32_t> repackCodePoints_;
+
+
+	/**
+	 * @brief  ٽ ϱ  ƮԴϴ.
+	 */
+	std::vector<uint8_t> repackBitmap_;
+
+
+	/**
+	 * @brief      ε Դϴ.
+	 */
+	std::vector<int32_t> pageOrder_;
+
+
+	/**
+	 * @brief   ȣԴϴ.
+	 */
+	uint64_t frame_ = 1;
+
+
+	/**
+	 * @brief   Դϴ.
+	 */
+	uint64_t order_ = 0;
+
+
+	/**
+	 * @brief ۸ ĳ Դϴ.
+	 */
+	Statistics statistics_;
+};
\ No newline at end of file
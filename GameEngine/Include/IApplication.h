@@ -18,6 +18,7 @@
 #include "GameTimer.h"
 #include "GeometryGenerator.h"
 #include "InputManager.h"
+#include "JobSystem.h"
 #include "IManager.h"
 #include "IObject.h"
 #include "IScene.h"
@@ -108,6 +109,14 @@ public:
 	static const std::wstring& GetEnginePath() { return enginePath_; }
 
 
+	/**
+	 * @brief  Ŀ ŷ  θ ϴ.
+	 * 
+	 * @return ŷ  θ ȯմϴ. ŷ  ٸ  ڿ ȯմϴ.
+	 */
+	static const std::wstring& GetCookedPath() { return cookedPath_; }
+
+
 protected:
 	/**
 	 * @brief ø̼ Ӽ մϴ.
@@ -134,6 +143,30 @@ protected:
 		bool bIsImGui
 	);
 
+
+	/**
+	 * @brief   ùķ̼ Ӽ մϴ.
+	 *
+	 * @param stepRate ʴ ùķ̼ ܰ Դϴ.
+	 * @param maxStepsPerFrame  ӿ   ִ ִ ùķ̼ ܰ Դϴ.
+	 *
+	 * @note   60Hz,   ִ 5ܰ ùķ̼մϴ.
+	 */
+	void SetFixedTimestep(float stepRate, int32_t maxStepsPerFrame);
+
+
+	/**
+	 * @brief    մϴ.
+	 *
+	 * @param scene   Դϴ.
+	 * @param deltaSeconds Ÿ ðԴϴ.
+	 *
+	 * @note 
+	 * -  ðŭ  FixedTick   ȣ ,   ϰ Tick ȣմϴ.
+	 * -   ùķ̼ ܰ  ִ ܰ   и ð ϴ.
+	 */
+	void TickScene(IScene* scene, float deltaSeconds);
+
 	
 protected:
 	/**
@@ -208,6 +241,24 @@ protected:
 	bool bIsDoneLoop_ = false;
 
 
+	/**
+	 * @brief   ùķ̼ Ÿ ðԴϴ.
+	 */
+	float fixedDeltaSeconds_ = 1.0f / 60.0f;
+
+
+	/**
+	 * @brief  ӿ   ִ ִ ùķ̼ ܰ Դϴ.
+	 */
+	int32_t maxStepsPerFrame_ = 5;
+
+
+	/**
+	 * @brief  ùķ̼   ðԴϴ.
+	 */
+	float accumulatedSeconds_ = 0.0f;
+
+
 	/**
 	 * @brief Ʈ Դϴ.
 	 */
@@ -220,6 +271,14 @@ protected:
 	static std::wstring enginePath_;
 
 
+	/**
+	 * @brief  Ŀ ŷ  Դϴ.
+	 *
+	 * @note Ʈ ο Cooked 丮 ٸ  ڿ̸,   εմϴ.
+	 */
+	static std::wstring cookedPath_;
+
+
 	/**
 	 * @brief  Դϴ.
 	 */
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Macro.h"
+#include "ObjectHandle.h"
 
 
 /**
@@ -59,9 +60,30 @@ public:
 	bool IsInitialized() const { return bIsInitialized_; }
 
 
+	/**
+	 * @brief Ʈ Ŵ ߱ Ʈ ڵ ϴ.
+	 *
+	 * @return Ʈ ڵ ȯմϴ. Ʈ Ŵ   Ʈ ȿ  ڵ ȯմϴ.
+	 */
+	ObjectHandle GetHandle() const { return handle_; }
+
+
 protected:
 	/**
 	 * @brief Ʈ ʱȭǾ Ȯմϴ.
 	 */
 	bool bIsInitialized_ = false;
+
+
+private:
+	/**
+	 * @brief Ʈ Ŵ Ʈ ڵ   ֵ մϴ.
+	 */
+	friend class ObjectManager;
+
+
+	/**
+	 * @brief Ʈ Ŵ ߱ Ʈ ڵԴϴ.
+	 */
+	ObjectHandle handle_;
 };
\ No newline at end of file
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Macro.h"
+#include "Matrix4x4.h"
+#include "MeshBuffer.h"
+
+class Shader;         // ̴ ҽ ϱ  漱 Դϴ.
+class StaticMesh;     //  ޽ ҽ ϱ  漱 Դϴ.
+class Material;       // ͸ ҽ ϱ  漱 Դϴ.
+class InstanceBuffer; // νϽ  ҽ ϱ  漱 Դϴ.
+
+
+/**
+ * @brief  ť  ׸   ϴ  鿣 ̽Դϴ.
+ *
+ * @note
+ * -  ť ° ٲ  ε ޼带 ȣϹǷ, 鿣   ٽ ˻ ʾƵ ˴ϴ.
+ * - ̴ ε Begin End ̿ ȿϸ, Ƽ    ε ̴ մϴ.
+ */
+class IRenderBackend
+{
+public:
+	/**
+	 * @brief  鿣 ̽ Ʈ Դϴ.
+	 */
+	IRenderBackend() = default;
+
+
+	/**
+	 * @brief  鿣 ̽  ҸԴϴ.
+	 */
+	virtual ~IRenderBackend() {}
+
+
+	/**
+	 * @brief  鿣 ̽  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(IRenderBackend);
+
+
+	/**
+	 * @brief ׸   մϴ.
+	 */
+	virtual void Begin() = 0;
+
+
+	/**
+	 * @brief ׸   , ε ¸ մϴ.
+	 */
+	virtual void End() = 0;
+
+
+	/**
+	 * @brief ̴ εմϴ.
+	 *
+	 * @param shader ε ̴Դϴ.
+	 */
+	virtual void BindShader(Shader* shader) = 0;
+
+
+	/**
+	 * @brief ؽó ؽó ֿ εմϴ.
+	 *
+	 * @param unit ε ؽó Դϴ.
+	 * @param textureID ε ؽó IDԴϴ.
+	 */
+	virtual void BindTexture(uint32_t unit, uint32_t textureID) = 0;
+
+
+	/**
+	 * @brief ޽  迭 Ʈ εմϴ.
+	 *
+	 * @param mesh ε ޽Դϴ.
+	 */
+	virtual void BindMesh(const StaticMesh* mesh) = 0;
+
+
+	/**
+	 * @brief ް   迭 Ʈ εմϴ.
+	 *
+	 * @param meshBuffer ε ް Դϴ.
+	 */
+	virtual void BindMeshBuffer(const MeshBuffer* meshBuffer) = 0;
+
+
+	/**
+	 * @brief ε ̴ Ƽ մϴ.
+	 *
+	 * @param material  ƼԴϴ.
+	 */
+	virtual void SetMaterial(const Material* material) = 0;
+
+
+	/**
+	 * @brief ε ޽ø  ķ ׸ϴ.
+	 *
+	 * @param world ޽  Դϴ.
+	 * @param indexCount ׸ ޽ ε Դϴ.
+	 */
+	virtual void DrawMesh(const Matrix4x4f& world, uint32_t indexCount) = 0;
+
+
+	/**
+	 * @brief ε ޽ø νϽ   νϽ    ׸ϴ.
+	 *
+	 * @param instanceBuffer ׸ νϽ Դϴ.
+	 * @param indexCount ׸ ޽ ε Դϴ.
+	 */
+	virtual void DrawMeshInstanced(const InstanceBuffer* instanceBuffer, uint32_t indexCount) = 0;
+
+
+	/**
+	 * @brief ε ް ۿ Ҵ ޽ø   ؼ  ķ ׸ϴ.
+	 *
+	 * @param world ޽  Դϴ.
+	 * @param allocation ׸ ޽  ε Դϴ.
+	 */
+	virtual void DrawMeshBaseVertex(const Matrix4x4f& world, const MeshBuffer::Allocation& allocation) = 0;
+
+
+	/**
+	 * @brief ε ް ۿ Ҵ ޽ø   ؼ νϽ   νϽ    ׸ϴ.
+	 *
+	 * @param instanceBuffer ׸ νϽ Դϴ.
+	 * @param allocation ׸ ޽  ε Դϴ.
+	 */
+	virtual void DrawMeshInstancedBaseVertex(const InstanceBuffer* instanceBuffer, const MeshBuffer::Allocation& allocation) = 0;
+};
\ No newline at end of file
@@ -33,10 +33,30 @@ public:
 	 * @brief    մϴ.
 	 *
 	 * @param deltaSeconds Ÿ ðԴϴ.
+	 *
+	 * @note Ӹ   ȣǸ, Է° UI ó   մϴ.
 	 */
 	virtual void Tick(float deltaSeconds) = 0;
 
 
+	/**
+	 * @brief  ùķ̼    ܰ մϴ.
+	 *
+	 * @param fixedDeltaSeconds   Ÿ ðԴϴ.
+	 *
+	 * @note  ӿ   ȣǰų ȣ   , ׻ ش  Tick  ȣ˴ϴ.
+	 */
+	virtual void FixedTick(float fixedDeltaSeconds) {}
+
+
+	/**
+	 * @brief     մϴ.
+	 *
+	 * @param interpolationAlpha  ùķ̼ ܰ  ùķ̼ ܰ   Դϴ.
+	 */
+	void SetInterpolationAlpha(float interpolationAlpha) { interpolationAlpha_ = interpolationAlpha; }
+
+
 	/**
 	 * @brief  մϴ.
 	 */
@@ -90,4 +110,12 @@ protected:
 	 * @brief   Դϴ.
 	 */
 	IScene* nextScene_ = nullptr;
+
+
+	/**
+	 * @brief  ùķ̼ ܰ  ùķ̼ ܰ   Դϴ.
+	 *
+	 * @note 0̸  ܰ, 1̸  ܰ · մϴ.
+	 */
+	float interpolationAlpha_ = 1.0f;
 };
\ No newline at end of file
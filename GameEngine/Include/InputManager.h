@@ -5,7 +5,11 @@
 #include <functional>
 #include <string>
 #include <unordered_map>
+#include <vector>
+
+#if !defined(HEADLESS_MODE)
 #include <windows.h>
+#endif
 
 #include "IManager.h"
 #include "Vector2.h"
@@ -270,6 +274,7 @@ public:
 	 *
 	 * @note
 	 * -  ޼ ȣ  Է ó  Ǵ  ͸ ؾ մϴ.
+	 * - HEADLESS_MODE   ϸ, Ű Է SetVirtualKeyStateθ ޵˴ϴ.
 	 * -  ޼   ȣǾ մϴ.
 	 */
 	virtual void Startup() override;
@@ -287,8 +292,91 @@ public:
 
 	/**
 	 * @brief Է ¸ Ʈմϴ.
+	 *
+	 * @param deltaSeconds ̹  Ÿ ðԴϴ.
+	 *
+	 * @note
+	 * - HEADLESS_MODE  ̺Ʈ Ű带  ʰ  Ű ¸  Ű · ѱ⸸ մϴ.
+	 * - Է Ʈ  ̶   Է Ʈ Ű , Ŀ ġ,  ̺Ʈ, Ÿ ð մϴ.
+	 * - ̹ ӿ  Ÿ ð GetDeltaSeconds  մϴ.
+	 */
+	void Tick(float deltaSeconds);
+
+
+	/**
+	 * @brief ̹ ӿ  Ÿ ð ϴ.
+	 *
+	 * @return Է Ʈ  ̶ ϵ Ÿ ð, ׷  Tick  Ÿ ð ȯմϴ.
+	 */
+	float GetDeltaSeconds() const { return deltaSeconds_; }
+
+
+	/**
+	 * @brief Է Ʈ  մϴ.
+	 *
+	 * @param randomSeed Է Ʈ Բ   õԴϴ.
+	 *
+	 * @note
+	 * -  Tick Ӹ ٲ  Ű , Ŀ ġ ȭ,  ̺Ʈ, Ÿ ð մϴ.
+	 * -  ߿    ϴ.
+	 */
+	void StartRecording(uint64_t randomSeed);
+
+
+	/**
+	 * @brief Է Ʈ  մϴ.
+	 *
+	 * @return ϵ Է Ʈ ȯմϴ.
+	 */
+	std::vector<uint8_t> StopRecording();
+
+
+	/**
+	 * @brief Է Ʈ  մϴ.
+	 *
+	 * @param inputStream  Է ƮԴϴ.
+	 *
+	 * @return  ߴٸ true, ĺڳ  ٸų  ߷ȴٸ false ȯմϴ.
+	 *
+	 * @note
+	 * -  Tick Ű  ̺Ʈ ϴ  Է Ʈ  Ӿ нϴ.
+	 * -  ߿   ̺Ʈ  Close óմϴ.
+	 * - Է Ʈ    ڵ ˴ϴ.
+	 * -  ߸ Է Ʈ  ӿ  ϸ, HasReplayError Ȯ  ֽϴ.
+	 */
+	bool StartReplay(const std::vector<uint8_t>& inputStream);
+
+
+	/**
+	 * @brief Է Ʈ   Ȯմϴ.
+	 *
+	 * @return  ̶ true, ׷  false ȯմϴ.
+	 */
+	bool IsRecording() const { return bIsRecording_; }
+
+
+	/**
+	 * @brief Է Ʈ   Ȯմϴ.
+	 *
+	 * @return  ̶ true, ׷  false ȯմϴ.
+	 */
+	bool IsReplaying() const { return bIsReplaying_; }
+
+
+	/**
+	 * @brief   ߸ Է Ʈ  ߰ Ǿ Ȯմϴ.
+	 *
+	 * @return Է Ʈ   ϰ  ߴٸ true, ׷  false ȯմϴ.
+	 */
+	bool HasReplayError() const { return bHasReplayError_; }
+
+
+	/**
+	 * @brief  ̰ų   Է Ʈ  õ带 ϴ.
+	 *
+	 * @return Է Ʈ  õ带 ȯմϴ.
 	 */
-	void Tick();
+	uint64_t GetInputStreamSeed() const { return inputStreamSeed_; }
 
 
 	/**
@@ -325,6 +413,19 @@ public:
 	EPressState GetVirtualKeyPressState(const EVirtualKey& virtualKey);
 
 
+	/**
+	 * @brief  Ʈ(Tick)  Ű Է ¸  մϴ.
+	 *
+	 * @param virtualKey Է ¸   Ű Դϴ.
+	 * @param bIsPress  Ű ȴ Դϴ.
+	 *
+	 * @note
+	 * - Tick Ŀ ȣؾ ϸ,  忡  Tick Ű   ϴ.
+	 * - 帮 ࿡ ũƮ Է   մϴ.
+	 */
+	void SetVirtualKeyState(const EVirtualKey& virtualKey, bool bIsPress);
+
+
 	/**
 	 * @brief Tick ȣ  Ŀ ġ ϴ.
 	 *
@@ -391,6 +492,8 @@ public:
 	void ExecuteWindowEventAction(const EWindowEvent& windowEvent);
 
 
+#if !defined(HEADLESS_MODE)
+
 	/**
 	 * @brief  ޽ óմϴ.
 	 *
@@ -423,6 +526,7 @@ public:
 	 * - ProcessWindowMessage ο ޽ ó  0 ȯ
 	 */
 	static LRESULT CALLBACK WindowProc(HWND windowHandle, uint32_t message, WPARAM wParam, LPARAM lParam);
+#endif
 
 
 private:
@@ -443,10 +547,12 @@ private:
 	};
 
 
+#if !defined(HEADLESS_MODE)
 	/**
 	 * @brief  ̺Ʈ Ǯ մϴ.
 	 */
 	void PollWindowEvents();
+#endif
 
 
 	/**
@@ -460,12 +566,38 @@ private:
 	bool IsPressKey(const uint8_t* keyBufferPtr, const EVirtualKey& virtualKey) const;
 
 
+	/**
+	 * @brief   Է ¸ Է Ʈ մϴ.
+	 *
+	 * @note 帮 ࿡ Tick Ŀ  Էµ ϵǵ  Tick Ȥ StopRecording ȣմϴ.
+	 */
+	void WriteInputFrame();
+
+
+	/**
+	 * @brief Է Ʈ   Է ¸ о մϴ.
+	 *
+	 * @return  оٸ true,  ߷ȴٸ false ȯմϴ.
+	 *
+	 * @note Է Ʈ  Ʈ ϳ ̻    ȣմϴ.
+	 */
+	bool ReadInputFrame();
+
+
+	/**
+	 * @brief Է Ʈ  ϰ Է Ʈ ϴ.
+	 */
+	void StopReplay();
+
+
+#if !defined(HEADLESS_MODE)
 	/**
 	 * @brief  콺 ġ ϴ.
 	 * 
 	 * @return  ǥ  콺 ġ ȯմϴ.
 	 */
 	Vector2i GetCurrentCursorPosition();
+#endif
 
 
 private:
@@ -527,4 +659,76 @@ private:
 	 * @brief  ̺Ʈ ϴ ׼Դϴ.
 	 */
 	std::unordered_map<std::string, WindowEventAction> windowEventActions_;
+
+
+	/**
+	 * @brief ̹ ӿ  Ÿ ðԴϴ.
+	 */
+	float deltaSeconds_ = 0.0f;
+
+
+	/**
+	 * @brief Է Ʈ   Ȯմϴ.
+	 */
+	bool bIsRecording_ = false;
+
+
+	/**
+	 * @brief Է Ʈ   Ȯմϴ.
+	 */
+	bool bIsReplaying_ = false;
+
+
+	/**
+	 * @brief   ߸ Է Ʈ  ߰ Ǿ Ȯմϴ.
+	 */
+	bool bHasReplayError_ = false;
+
+
+	/**
+	 * @brief    ִ Ȯմϴ.
+	 */
+	bool bHasPendingFrame_ = false;
+
+
+	/**
+	 * @brief  ̰ų   Է ƮԴϴ.
+	 */
+	std::vector<uint8_t> inputStream_;
+
+
+	/**
+	 * @brief   Է Ʈ   ġԴϴ.
+	 */
+	std::size_t inputStreamOffset_ = 0;
+
+
+	/**
+	 * @brief Է Ʈ  õԴϴ.
+	 */
+	uint64_t inputStreamSeed_ = 0;
+
+
+	/**
+	 * @brief Է Ʈ    Ű  Դϴ.
+	 */
+	std::array<uint8_t, VIRTUAL_KEY_BUFFER_SIZE> recordKeyboardState_ = {};
+
+
+	/**
+	 * @brief Է Ʈ   Ŀ ġԴϴ.
+	 */
+	Vector2i recordCursorPosition_;
+
+
+	/**
+	 * @brief Է Ʈ  ߰ų Է Ʈ   Ÿ ðԴϴ.
+	 */
+	float streamDeltaSeconds_ = 0.0f;
+
+
+	/**
+	 * @brief ̹ ӿ ߻  ̺Ʈ   ̺ƮԴϴ.
+	 */
+	std::vector<EWindowEvent> frameWindowEvents_;
 };
\ No newline at end of file
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <vector>
+
+#include "IResource.h"
+#include "Vector3.h"
+#include "Vector4.h"
+
+
+/**
+ * @brief  ޽ø   ׸ ȣ   ׸  νϽ  ҽԴϴ.
+ *
+ * @note
+ * - νϽ ġ(xyz)  (w) Vector4f ϳ ϹǷ, ȸ ʴ ޽ø ׸  ֽϴ.
+ * - CPU νϽ   Upload GPU ۿ   ϴ. GPU ۰ ϸ  辿 øϴ.
+ * - HEADLESS_MODE GPU ۸  ʰ CPU νϽ ϸ մϴ.
+ */
+class InstanceBuffer : public IResource
+{
+public:
+	/**
+	 * @brief νϽ  Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	InstanceBuffer() = default;
+
+
+	/**
+	 * @brief νϽ   ҸԴϴ.
+	 *
+	 * @note νϽ  ο Ҵ Ҹ ϱ ؼ ݵ Release ȣؾ մϴ.
+	 */
+	virtual ~InstanceBuffer();
+
+
+	/**
+	 * @brief νϽ   ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(InstanceBuffer);
+
+
+	/**
+	 * @brief νϽ ۸ մϴ.
+	 *
+	 * @param capacity ̸ Ҵ νϽ Դϴ.
+	 */
+	void Initialize(uint32_t capacity);
+
+
+	/**
+	 * @brief νϽ   ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief CPU νϽ  ϴ.
+	 */
+	void Clear() { instances_.clear(); }
+
+
+	/**
+	 * @brief CPU νϽ Ͽ νϽ ߰մϴ.
+	 *
+	 * @param position νϽ  ġԴϴ.
+	 * @param scale νϽ  Դϴ.
+	 */
+	void Add(const Vector3f& position, float scale) { instances_.push_back(Vector4f(position.x, position.y, position.z, scale)); }
+
+
+	/**
+	 * @brief CPU νϽ  GPU ۿ ϴ.
+	 *
+	 * @note HEADLESS_MODE ƹ ۾  ʽϴ.
+	 */
+	void Upload();
+
+
+	/**
+	 * @brief ε  迭 Ʈ νϽ Ӽ մϴ.
+	 *
+	 * @note νϽ Ӽ  ̴ 3 Է̸, νϽ   нϴ.
+	 */
+	void Attach() const;
+
+
+	/**
+	 * @brief ε  迭 Ʈ νϽ Ӽ  մϴ.
+	 *
+	 * @note  ޽ø νϽ  ׸  νϽ Ӽ  ʵ ׸ ڿ ݵ ȣؾ մϴ.
+	 */
+	void Detach() const;
+
+
+	/**
+	 * @brief CPU νϽ  ϴ.
+	 *
+	 * @return CPU νϽ  ȯմϴ.
+	 */
+	uint32_t GetCountOfInstance() const { return static_cast<uint32_t>(instances_.size()); }
+
+
+	/**
+	 * @brief CPU νϽ  ϴ.
+	 *
+	 * @return ġ(xyz) (w)  νϽ  ȯմϴ.
+	 */
+	const std::vector<Vector4f>& GetInstances() const { return instances_; }
+
+
+private:
+	/**
+	 * @brief CPU νϽ Դϴ.
+	 */
+	std::vector<Vector4f> instances_;
+
+
+	/**
+	 * @brief GPU ۿ   ִ νϽ Դϴ.
+	 */
+	uint32_t bufferCapacity_ = 0;
+
+
+	/**
+	 * @brief GPU  νϽ  ƮԴϴ.
+	 */
+	uint32_t instanceBufferObject_ = 0;
+};
\ No newline at end of file
@@ -0,0 +1,340 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "IManager.h"
+
+
+/**
+ * @brief ۾ 鿡 ۾ йϴ  ýԴϴ.
+ *
+ * @note
+ * -  Ŭ ̱Դϴ.
+ * - ۾ 帶 ۾ ť(deque) , ڽ ť ڿ    ٸ ť տ Ŀɴϴ.
+ * -   0 ť ϸ, Wait ߿  嵵 ۾ մϴ.
+ */
+class JobSystem : public IManager
+{
+public:
+	class JobCounter; // ۾ ϴ ī 漱 Դϴ.
+
+
+private:
+	/**
+	 * @brief  ۾Դϴ.
+	 *
+	 * @note    ۾   īͿ ǹǷ, ۾ ť  ۾ ٷ   ֽϴ.
+	 */
+	struct Job
+	{
+		std::function<void()> task; //  ۾Դϴ.
+		JobCounter* counter;        // ۾   īԴϴ.
+	};
+
+
+public:
+	/**
+	 * @brief    ۾   īԴϴ.
+	 *
+	 * @note
+	 * - Schedule ϸ ۾   īͰ մϴ.
+	 * - ٸ ۾  (dependency) ϸ īͰ 0  ڿ ۾ ˴ϴ.
+	 * -     ۾ ۾ ť  ʰ īͿ ߴٰ, īͰ 0   ۾ ť ֽϴ.
+	 */
+	class JobCounter
+	{
+	public:
+		/**
+		 * @brief ۾ ī ⺻ Դϴ.
+		 */
+		JobCounter() = default;
+
+
+		/**
+		 * @brief ۾ ī  ҸԴϴ.
+		 */
+		virtual ~JobCounter() {}
+
+
+		/**
+		 * @brief ۾ ī  ڿ  ڸ  մϴ.
+		 */
+		DISALLOW_COPY_AND_ASSIGN(JobCounter);
+
+
+		/**
+		 * @brief īͿ  ۾   Ȯմϴ.
+		 *
+		 * @return  ۾ ٸ true, ׷  false ȯմϴ.
+		 */
+		bool IsDone() const { return count_.load(std::memory_order_acquire) == 0; }
+
+
+	private:
+		/**
+		 * @brief  ý ī͸   ֵ մϴ.
+		 */
+		friend class JobSystem;
+
+
+		/**
+		 * @brief    ۾ Դϴ.
+		 */
+		std::atomic<int32_t> count_ = 0;
+
+
+		/**
+		 * @brief īͰ 0 Ǳ⸦ ٸ ۾  ȣϴ ؽԴϴ.
+		 *
+		 * @note   ޵Ǵ īʹ ̹Ƿ, ٸ ۾  mutable մϴ.
+		 */
+		mutable std::mutex waitingMutex_;
+
+
+		/**
+		 * @brief īͰ 0 Ǳ⸦ ٸ ۾ Դϴ.
+		 */
+		mutable std::vector<Job> waitingJobs_;
+	};
+
+
+public:
+	/**
+	 * @brief  ý  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(JobSystem);
+
+
+	/**
+	 * @brief  ý  νϽ ϴ.
+	 *
+	 * @return  ý ڸ ȯմϴ.
+	 */
+	static JobSystem& Get()
+	{
+		static JobSystem instance;
+		return instance;
+	}
+
+
+	/**
+	 * @brief  ý  ϰ ۾  մϴ.
+	 *
+	 * @note
+	 * - ۾   ٲٷ  ޼ ȣ  SetCountOfWorker ȣؾ մϴ.
+	 * -  ޼   ȣǾ մϴ.
+	 */
+	virtual void Startup() override;
+
+
+	/**
+	 * @brief  ý  ϰ ۾  մϴ.
+	 *
+	 * @note
+	 * - ø̼    ޼带 ݵ ȣؾ մϴ.
+	 * -   ۾ ϴ.
+	 */
+	virtual void Shutdown() override;
+
+
+	/**
+	 * @brief  带  ۾   մϴ.
+	 *
+	 * @param countOfWorker  带  ۾  Դϴ. 0̸  ۾ ȣ 忡 մϴ.
+	 *
+	 * @note ⺻ (ϵ   - 1)Դϴ.
+	 */
+	void SetCountOfWorker(uint32_t countOfWorker);
+
+
+	/**
+	 * @brief  带  ۾   ϴ.
+	 *
+	 * @return  带  ۾   ȯմϴ.
+	 */
+	uint32_t GetCountOfWorker() const { return countOfWorker_; }
+
+
+	/**
+	 * @brief ۾ մϴ.
+	 *
+	 * @param job  ۾Դϴ.
+	 * @param counter ۾   īԴϴ.  Ͷ մϴ.
+	 * @param dependency ۾   0 Ǿ ϴ īԴϴ.  Ͷ մϴ.
+	 *
+	 * @note ۾ 尡 ٸ   ٸ  ȣ 忡 ٷ մϴ.
+	 */
+	void Schedule(const std::function<void()>& job, JobCounter* counter = nullptr, const JobCounter* dependency = nullptr);
+
+
+	/**
+	 * @brief īͿ  ۾    ٸϴ.
+	 *
+	 * @param counter ٸ īԴϴ.
+	 *
+	 * @note ٸ  ȣ 嵵  ۾ ϸ,  ۾  īͰ 0 ǰų ۾   ϴ.
+	 */
+	void Wait(const JobCounter& counter);
+
+
+	/**
+	 * @brief [begin, end)  grain ũ   ķ óմϴ.
+	 *
+	 * @param begin ó  Դϴ.
+	 * @param end ó  Դϴ.
+	 * @param grain  ۾ ó  ũԴϴ.
+	 * @param function  ۰ (chunkBegin, chunkEnd) ޾Ƽ ó ԼԴϴ.
+	 *
+	 * @note
+	 * -   ó   ȯմϴ.
+	 * -  grain ̰ų ۾ 尡 ٸ ȣ 忡   óմϴ.
+	 * -   ٸ 忡 ÿ ó  Ƿ function   ͸   ˴ϴ.
+	 */
+	template <typename TFunction>
+	void ParallelFor(uint32_t begin, uint32_t end, uint32_t grain, TFunction&& function)
+	{
+		if (begin >= end)
+		{
+			return;
+		}
+
+		grain = (grain == 0) ? 1 : grain;
+		if (!bIsStartup_ || countOfWorker_ == 0 || end - begin <= grain)
+		{
+			function(begin, end);
+			return;
+		}
+
+		JobCounter counter;
+		for (uint32_t chunkBegin = begin; chunkBegin < end; chunkBegin += grain)
+		{
+			uint32_t chunkEnd = (end - chunkBegin > grain) ? chunkBegin + grain : end;
+			Schedule([&function, chunkBegin, chunkEnd]() { function(chunkBegin, chunkEnd); }, &counter);
+		}
+
+		Wait(counter);
+	}
+
+
+private:
+	/**
+	 * @brief  ýۿ Ʈ ڿ   Ҹڸ մϴ.
+	 */
+	DEFAULT_CONSTRUCTOR_AND_VIRTUAL_DESTRUCTOR(JobSystem);
+
+
+	/**
+	 * @brief  ϳ ϴ ۾ ťԴϴ.
+	 */
+	struct WorkQueue
+	{
+		std::mutex mutex;     // ۾ ť ȣϴ ؽԴϴ.
+		std::deque<Job> jobs; //  ۾Դϴ.   ڿ, ٸ  տ ϴ.
+	};
+
+
+	/**
+	 * @brief ۾   մϴ.
+	 *
+	 * @param workerIndex ۾ 尡 ϴ ۾ ť εԴϴ.
+	 */
+	void RunWorker(uint32_t workerIndex);
+
+
+	/**
+	 * @brief ۾ ϳ  մϴ.
+	 *
+	 * @param workerIndex ȣ 尡 ϴ ۾ ť εԴϴ.
+	 *
+	 * @return ۾ ߴٸ true, ׷  false ȯմϴ.
+	 */
+	bool TryExecuteJob(uint32_t workerIndex);
+
+
+	/**
+	 * @brief ڽ ۾ ť ۾ ,  ִٸ ٸ ۾ ť Ŀɴϴ.
+	 *
+	 * @param workerIndex ȣ 尡 ϴ ۾ ť εԴϴ.
+	 * @param outJob  ۾Դϴ.
+	 *
+	 * @return ۾ ´ٸ true, ׷  false ȯմϴ.
+	 */
+	bool PopJob(uint32_t workerIndex, Job& outJob);
+
+
+	/**
+	 * @brief ۾  īͿ ˸ϴ.
+	 *
+	 * @param counter  īԴϴ.
+	 *
+	 * @note īͰ 0 Ǹ ٸ ۾ ۾ ť ְ, Wait  带 ϴ.
+	 */
+	void FinishJob(JobCounter& counter);
+
+
+	/**
+	 * @brief ۾ ۾ ť ְ  ۾ 带 ϴ.
+	 *
+	 * @param workerIndex ۾  ۾ ť εԴϴ.
+	 * @param job  ۾Դϴ.
+	 * @param bIsBack ۾ ť ڿ  Դϴ. false ٸ 尡  İ տ ֽϴ.
+	 */
+	void PushJob(uint32_t workerIndex, Job&& job, bool bIsBack);
+
+
+private:
+	/**
+	 * @brief  带  ۾  Դϴ.
+	 */
+	uint32_t countOfWorker_ = 0;
+
+
+	/**
+	 * @brief ۾   Ǿ Ȯմϴ.
+	 */
+	bool bIsSetCountOfWorker_ = false;
+
+
+	/**
+	 * @brief ۾ Դϴ.
+	 */
+	std::vector<std::thread> workers_;
+
+
+	/**
+	 * @brief 帶 ϴ ۾ ťԴϴ. 0   ۾ ťԴϴ.
+	 */
+	std::vector<std::unique_ptr<WorkQueue>> workQueues_;
+
+
+	/**
+	 * @brief ۾ ť鿡  ִ ۾ Դϴ.
+	 */
+	std::atomic<int32_t> countOfQueuedJob_ = 0;
+
+
+	/**
+	 * @brief ۾  ؾ ϴ Ȯմϴ.
+	 */
+	std::atomic<bool> bIsStop_ = false;
+
+
+	/**
+	 * @brief ۾   ۾  Wait  带  ؽԴϴ.
+	 */
+	std::mutex sleepMutex_;
+
+
+	/**
+	 * @brief ۾ ǰų īͰ 0 Ǹ  带   Դϴ.
+	 */
+	std::condition_variable sleepCondition_;
+};
\ No newline at end of file
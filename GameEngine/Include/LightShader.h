@@ -2,17 +2,17 @@
 
 #include "Shader.h"
 
-class Light;      // Ʈ Ʈ ϱ  漱 Դϴ.
-class Camera3D;   // ī޶ Ʈ ϱ  漱 Դϴ.
-class Material;   // ͸ ҽ ϱ  漱 Դϴ.
-class StaticMesh; //  ޽ ҽ ϱ  漱 Դϴ.
-class ShadowMap;  // ε  ҽ ϱ  漱 Դϴ. 
+class StaticMesh;     //  ޽ ҽ ϱ  漱 Դϴ.
+class ShadowMap;      // ε  ҽ ϱ  漱 Դϴ. 
+class InstanceBuffer; // νϽ  ҽ ϱ  漱 Դϴ.
 
 
 /**
  * @brief Ʈ ȿ ϴ ̴Դϴ.
  * 
- * @note  ̴  ο ϴ ̴Դϴ. ܺο ʱȭϸ ȵ˴ϴ.
+ * @note
+ * -  ̴  ο ϴ ̴Դϴ. ܺο ʱȭϸ ȵ˴ϴ.
+ * - ī޶ Ʈ FrameUniformBlock, Ƽ MaterialUniformBlock  ۷ մϴ.
  */
 class LightShader : public Shader
 {
@@ -40,35 +40,49 @@ public:
 
 
 	/**
-	 * @brief Ʈ ̴ ͸ õ  ۸ մϴ.
-	 * 
-	 * @param material  ͸ Դϴ.
+	 * @brief ̴ ο ̴ ҽ ۸ ޴ ʱȭ ޼带  մϴ.
 	 */
-	void SetMaterial(const Material* material);
+	using Shader::Initialize;
 
 
 	/**
-	 * @brief Ʈ ̴ Ʈ õ  ۸ մϴ.
-	 * 
-	 * @param light  Ʈ Դϴ.
+	 * @brief ޸𸮿 ִ GLSL ̴ ҽ ϰ ̴ α׷ մϴ.
+	 *
+	 * @param vsSource ؽ ̴ ҽ Դϴ.
+	 * @param fsSource ׸Ʈ ̴ ҽ Դϴ.
+	 *
+	 * @note    ڵ ãƵΰ, ̴   ũⰡ UniformBlock.h ü  ˻մϴ.
 	 */
-	void SetLight(const Light* light);
+	virtual void Initialize(const BufferView& vsSource, const BufferView& fsSource) override;
 
 
 	/**
-	 * @brief Ʈ ̴ ī޶ õ  ۸ մϴ.
+	 * @brief ޽ÿ  ȿ մϴ.
 	 * 
-	 * @param camera  ī޶ Դϴ.
+	 * @param world ޽  Դϴ.
+	 * @param mesh  ȿ  ޽Դϴ.
+	 * @param shadowMap ε Դϴ.
 	 */
-	void SetCamera(const Camera3D* camera);
+	void DrawMesh3D(const Matrix4x4f& world, const StaticMesh* mesh, const ShadowMap* shadowMap);
 
 
 	/**
-	 * @brief ޽ÿ  ȿ մϴ.
-	 * 
-	 * @param world ޽  Դϴ.
+	 * @brief ޽  νϽ  ȿ ؼ   ȣ ׸ϴ.
+	 *
 	 * @param mesh  ȿ  ޽Դϴ.
+	 * @param instanceBuffer ׸ νϽ Դϴ.
 	 * @param shadowMap ε Դϴ.
+	 *
+	 * @note LightInstanced.vert ʱȭ ̴ ȣؾ մϴ.
 	 */
-	void DrawMesh3D(const Matrix4x4f& world, const StaticMesh* mesh, const ShadowMap* shadowMap);
+	void DrawMeshInstanced3D(const StaticMesh* mesh, const InstanceBuffer* instanceBuffer, const ShadowMap* shadowMap);
+
+
+private:
+	/**
+	 * @brief    ڵԴϴ.
+	 *
+	 * @note νϽ ̴    Ƿ ȿ ڵԴϴ.
+	 */
+	UniformHandle worldHandle_;
 };
\ No newline at end of file
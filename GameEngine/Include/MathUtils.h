@@ -8,6 +8,7 @@
 #include "Matrix2x2.h"
 #include "Matrix3x3.h"
 #include "Matrix4x4.h"
+#include "RandomStream.h"
 #include "Vector2.h"
 #include "Vector3.h"
 #include "Vector4.h"
@@ -245,6 +246,38 @@ namespace MathUtils
 	}
 
 
+	/**
+	 * @brief    մϴ.
+	 *
+	 * @param start   Դϴ.
+	 * @param end   Դϴ.
+	 * @param t  Դϴ. 0̸  , 1̸  Դϴ.
+	 *
+	 * @return    ȯմϴ.
+	 */
+	template <typename T>
+	inline T Lerp(const T& start, const T& end, float t)
+	{
+		return start * (1.0f - t) + end * t;
+	}
+
+
+	/**
+	 * @brief  3 ͸  մϴ.
+	 *
+	 * @param start   Դϴ.
+	 * @param end   Դϴ.
+	 * @param t  Դϴ. 0̸  , 1̸  Դϴ.
+	 *
+	 * @return   ͸ ȯմϴ.
+	 */
+	template <typename T>
+	inline Vector3<T> Lerp(const Vector3<T>& start, const Vector3<T>& end, float t)
+	{
+		return Vector3<T>(Lerp<T>(start.x, end.x, t), Lerp<T>(start.y, end.y, t), Lerp<T>(start.z, end.z, t));
+	}
+
+
 	/**
 	 * @brief 2    մϴ.
 	 *
@@ -379,7 +412,7 @@ namespace MathUtils
 	inline float Length(const Vector2<T>& v)
 	{
 		float lengthSquare = static_cast<float>(LengthSquare<T>(v));
-		return std::sqrtf(lengthSquare);
+		return std::sqrt(lengthSquare);
 	}
 
 
@@ -394,7 +427,7 @@ namespace MathUtils
 	inline float Length(const Vector3<T>& v)
 	{
 		float lengthSquare = static_cast<float>(LengthSquare<T>(v));
-		return std::sqrtf(lengthSquare);
+		return std::sqrt(lengthSquare);
 	}
 
 
@@ -409,7 +442,7 @@ namespace MathUtils
 	inline float Length(const Vector4<T>& v)
 	{
 		float lengthSquare = static_cast<float>(LengthSquare<T>(v));
-		return std::sqrtf(lengthSquare);
+		return std::sqrt(lengthSquare);
 	}
 
 
@@ -455,6 +488,33 @@ namespace MathUtils
 	}
 
 
+	/**
+	 * @brief   ⺻  Ʈ ϴ.
+	 *
+	 * @return   ⺻  Ʈ ڸ ȯմϴ.
+	 *
+	 * @note
+	 * - 帶 ó ȣ    std::random_device õ带 մϴ.
+	 * -    ʿϴٸ SetRandomSeed ȣϰų  RandomStream ؾ մϴ.
+	 */
+	inline RandomStream& GetThreadRandomStream()
+	{
+		thread_local RandomStream randomStream((static_cast<uint64_t>(std::random_device()()) << 32) ^ static_cast<uint64_t>(std::random_device()()));
+		return randomStream;
+	}
+
+
+	/**
+	 * @brief   ⺻  Ʈ õ带 մϴ.
+	 *
+	 * @param seed  õԴϴ.
+	 */
+	inline void SetRandomSeed(uint64_t seed)
+	{
+		GetThreadRandomStream().Seed(seed);
+	}
+
+
 	/**
 	 * @brief   մϴ.
 	 *
@@ -462,14 +522,12 @@ namespace MathUtils
 	 * @param maxValue    ִԴϴ.
 	 *
 	 * @return    ȯմϴ.
+	 *
+	 * @note   ⺻  Ʈ մϴ.
 	 */
 	inline int32_t GenerateRandomInt(int32_t minValue, int32_t maxValue)
 	{
-		std::random_device randomDevice;
-		std::mt19937 generator(randomDevice());
-		std::uniform_int_distribution<int32_t> distribution(Min<int32_t>(minValue, maxValue), Max<int32_t>(minValue, maxValue));
-
-		return distribution(generator);
+		return GetThreadRandomStream().NextInt(minValue, maxValue);
 	}
 
 
@@ -480,14 +538,12 @@ namespace MathUtils
 	 * @param maxValue    ִԴϴ.
 	 *
 	 * @return   Ǽ ȯմϴ.
+	 *
+	 * @note   ⺻  Ʈ մϴ.
 	 */
 	inline float GenerateRandomFloat(float minValue, float maxValue)
 	{
-		std::random_device randomDevice;
-		std::mt19937 generator(randomDevice());
-		std::uniform_real_distribution<float> distribution(Min<float>(minValue, maxValue), Max<float>(minValue, maxValue));
-
-		return distribution(generator);
+		return GetThreadRandomStream().NextFloat(minValue, maxValue);
 	}
 
 
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <vector>
+
+#include "IResource.h"
+#include "RangeAllocator.h"
+#include "Vertex.h"
+
+
+/**
+ * @brief  ޽  ε ϳ  迭 Ʈ Ƶδ ް  ҽԴϴ.
+ *
+ * @note
+ * -  ۿ ε ۸ ó  ũ , ޽ø     Ҵڷ  ݴϴ.
+ * - ε ޽    ״ ϰ, ׸  Ҵ    ġ   ѱϴ.
+ * -  ޽ð  迭 Ʈ ϳ ϹǷ, ޽ø ٲ ׸   迭 Ʈ ٽ ε ʽϴ.
+ * -  ũ þ ʽϴ.   ϸ Ҵ翡 մϴ.
+ * - HEADLESS_MODE GPU ۸  ʰ  Ҵ縸 մϴ.
+ */
+class MeshBuffer : public IResource
+{
+public:
+	/**
+	 * @brief ް ۿ Ҵ ޽  ε Դϴ.
+	 */
+	struct Allocation
+	{
+		uint32_t baseVertex = 0;    // ޽ ù °  ġԴϴ.
+		uint32_t countOfVertex = 0; // ޽  Դϴ.
+		uint32_t firstIndex = 0;    // ޽ ù ° ε ġԴϴ.
+		uint32_t countOfIndex = 0;  // ޽ ε Դϴ.
+	};
+
+
+public:
+	/**
+	 * @brief ް  Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	MeshBuffer() = default;
+
+
+	/**
+	 * @brief ް   ҸԴϴ.
+	 *
+	 * @note ް  ο Ҵ Ҹ ϱ ؼ ݵ Release ȣؾ մϴ.
+	 */
+	virtual ~MeshBuffer();
+
+
+	/**
+	 * @brief ް   ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(MeshBuffer);
+
+
+	/**
+	 * @brief ް ۸ մϴ.
+	 *
+	 * @param vertexCapacity  ۿ   ִ  Դϴ.
+	 * @param indexCapacity ε ۿ   ִ ε Դϴ.
+	 */
+	void Initialize(uint32_t vertexCapacity, uint32_t indexCapacity);
+
+
+	/**
+	 * @brief ް   ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief ޽  ε  Ҵϰ GPU ۿ ϴ.
+	 *
+	 * @param vertices ޽  Դϴ.
+	 * @param indices ޽    ε Դϴ.
+	 * @param outAllocation Ҵ  ε Դϴ.
+	 *
+	 * @return Ҵ翡 ϸ true, ̳ ε   ϸ false ȯմϴ.
+	 */
+	bool Allocate(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, Allocation& outAllocation);
+
+
+	/**
+	 * @brief Ҵ ޽  ε  մϴ.
+	 *
+	 * @param allocation   ε Դϴ.
+	 */
+	void Free(const Allocation& allocation);
+
+
+	/**
+	 * @brief ް   迭 Ʈ εմϴ.
+	 */
+	void Bind() const;
+
+
+	/**
+	 * @brief ް   迭 Ʈ ε մϴ.
+	 */
+	void Unbind() const;
+
+
+	/**
+	 * @brief Ҵ ޽ø   ؼ ׸ϴ.
+	 *
+	 * @param allocation ׸ ޽  ε Դϴ.
+	 *
+	 * @note ް   迭 Ʈ ε ¿ մϴ.
+	 */
+	void Draw(const Allocation& allocation) const;
+
+
+	/**
+	 * @brief   Ҵڸ ϴ.
+	 *
+	 * @return   Ҵ  ڸ ȯմϴ.
+	 */
+	const RangeAllocator& GetVertexAllocator() const { return vertexAllocator_; }
+
+
+	/**
+	 * @brief ε  Ҵڸ ϴ.
+	 *
+	 * @return ε  Ҵ  ڸ ȯմϴ.
+	 */
+	const RangeAllocator& GetIndexAllocator() const { return indexAllocator_; }
+
+
+	/**
+	 * @brief ް   迭 Ʈ ϴ.
+	 *
+	 * @return ް   迭 Ʈ ȯմϴ.
+	 */
+	uint32_t GetVertexArrayObject() const { return vertexArrayObject_; }
+
+
+private:
+	/**
+	 * @brief    ҴԴϴ.   Ҵմϴ.
+	 */
+	RangeAllocator vertexAllocator_;
+
+
+	/**
+	 * @brief ε   ҴԴϴ. ε  Ҵմϴ.
+	 */
+	RangeAllocator indexAllocator_;
+
+
+	/**
+	 * @brief  ޽ð ϴ  迭 ƮԴϴ.
+	 */
+	uint32_t vertexArrayObject_ = 0;
+
+
+	/**
+	 * @brief GPU    ƮԴϴ.
+	 */
+	uint32_t vertexBufferObject_ = 0;
+
+
+	/**
+	 * @brief GPU  ε  ƮԴϴ.
+	 */
+	uint32_t indexBufferObject_ = 0;
+};
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "BufferView.h"
+
+
+/**
+ * @brief ̸   ؽó Ӹ üԴϴ.
+ *
+ * @note
+ * - 0   ̸̹,    ũⰡ (ּ 1) Ǿ 1x1  ϴ.
+ * -   ȼ pixels 0  ƴ ̾ մϴ.
+ * -  Ŀ ο ؼ .mips Ϸ ȭϸ, ؽó glGenerateMipmap   ״ øϴ.
+ */
+struct MipChain
+{
+	/**
+	 * @brief Ӹ ü  ϳԴϴ.
+	 */
+	struct Level
+	{
+		int32_t width;      //   ũԴϴ.
+		int32_t height;     //   ũԴϴ.
+		uint64_t offset;    // pixels   ȼ  Դϴ.
+	};
+
+
+	/**
+	 * @brief ̹κ Ӹ ü մϴ.
+	 *
+	 * @param pixelsPtr 0  ̹ ȼ Դϴ.  ̿   մϴ.
+	 * @param width ̹  ũԴϴ.
+	 * @param height ̹  ũԴϴ.
+	 * @param channels ̹ ȼ ä Դϴ. 1, 3, 4 մϴ.
+	 * @param outMipChain  Ӹ üԴϴ.
+	 *
+	 * @note   ٷ   stb_image_resize ؼ ϴ.
+	 */
+	static void Generate(const uint8_t* pixelsPtr, int32_t width, int32_t height, int32_t channels, MipChain& outMipChain);
+
+
+	/**
+	 * @brief Ӹ ü Ͽ  ۷ ȭմϴ.
+	 *
+	 * @return ȭ ۸ ȯմϴ.
+	 */
+	std::vector<uint8_t> Serialize() const;
+
+
+	/**
+	 * @brief ȭ ۷κ Ӹ ü нϴ.
+	 *
+	 * @param buffer ȭ Դϴ.
+	 * @param outMipChain  Ӹ üԴϴ.
+	 *
+	 * @return ۰ ȿϴٸ true, ׷  false ȯմϴ.
+	 */
+	static bool Deserialize(const BufferView& buffer, MipChain& outMipChain);
+
+
+	/**
+	 * @brief  ȼ Ʈ  մϴ.
+	 *
+	 * @param level Ʈ    εԴϴ.
+	 *
+	 * @return  ȼ Ʈ  ȯմϴ.
+	 */
+	std::size_t GetLevelSize(std::size_t level) const;
+
+
+	int32_t channels = 0;          // ȼ ä Դϴ.
+	std::vector<Level> levels;     // 0  1x1   Դϴ.
+	std::vector<uint8_t> pixels;   //   ȼԴϴ.
+};
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+
+
+/**
+ * @brief Ʈ Ŵ ϴ Ʈ Ű ڵԴϴ.
+ *
+ * @note
+ * - ڵ  ε (generation)  ˴ϴ.
+ * - Ʈ Ǹ    ϹǷ,  Ʈ ڵ   Ʈ Ű ʽϴ.
+ * - ڵ Ʈ ٲٷ ObjectManager::Resolve ؾ մϴ.
+ */
+struct ObjectHandle
+{
+	/**
+	 * @brief  Ʈ Ű ʴ  εԴϴ.
+	 */
+	static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+
+	/**
+	 * @brief ڵ  Ű Ȯմϴ.
+	 *
+	 * @return ڵ  Ųٸ true, ׷  false ȯմϴ.
+	 *
+	 * @note  Ű ̹  Ʈ ڵ  ֽϴ.
+	 */
+	bool IsValid() const { return index != INVALID_INDEX; }
+
+
+	/**
+	 * @brief  ڵ  Ȯմϴ.
+	 *
+	 * @param handle  ڵԴϴ.
+	 *
+	 * @return  ڵ  ε    ٸ true, ׷  false ȯմϴ.
+	 */
+	bool operator==(const ObjectHandle& handle) const { return index == handle.index && generation == handle.generation; }
+
+
+	/**
+	 * @brief  ڵ ٸ Ȯմϴ.
+	 *
+	 * @param handle  ڵԴϴ.
+	 *
+	 * @return  ڵ  ε   ٸٸ true, ׷  false ȯմϴ.
+	 */
+	bool operator!=(const ObjectHandle& handle) const { return !(*this == handle); }
+
+
+	uint32_t index = INVALID_INDEX; // Ʈ Ŵ   εԴϴ.
+	uint32_t generation = 0;        //   Ʈ  Դϴ.
+};
\ No newline at end of file
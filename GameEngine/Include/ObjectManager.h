@@ -3,17 +3,28 @@
 #include <cstdint>
 #include <string>
 #include <memory>
+#include <typeindex>
+#include <typeinfo>
 #include <unordered_map>
+#include <vector>
 
 #include "Assertion.h"
 #include "IManager.h"
 #include "IObject.h"
+#include "ObjectHandle.h"
+#include "ObjectPool.h"
+#include "StringId.h"
 
 
 /**
  * @brief Ʈ  ϴ ŴԴϴ.
  *
- * @note  Ŭ ̱Դϴ.
+ * @note
+ * -  Ŭ ̱Դϴ.
+ * - Ʈ ŸԸ ϳ ִ Ǯ(ObjectPool) Ҵǰ,  ̺ ڵ(ObjectHandle) O(1) մϴ.
+ * - ñ״ó  ε  ȸ  ̸,   ȣǴ ڵ ڵ ؾ մϴ.
+ * - ñ״ó  ñ״ó ڿ ؽ ĺ(StringId) Ű մϴ.
+ * - Ʈ  Ǹ, FlushDestroyedObjects ȣ   Ҵ ˴ϴ.
  */
 class ObjectManager : public IManager
 {
@@ -60,6 +71,7 @@ public:
 	 * @note
 	 * - Ʈ Ŵ ʱȭ  Ƿ, ȯϴ   ̿ؼ ʱȭ  ؾ մϴ.
 	 * - Ʈ ñ״ó  ߺ  ʽϴ.
+	 * -  Ʈ ڵ IObject::GetHandle   ֽϴ.
 	 *
 	 * @param signature Ŵ ο Ʈ  ñ״ó Դϴ.
 	 *
@@ -68,40 +80,159 @@ public:
 	template <typename TObject>
 	TObject* CreateObject(const std::string& signature)
 	{
-		ASSERT(!IsValidObjectKey(signature), "already exist object signature %s key...", signature.c_str());
+#if defined(DEBUG_MODE)
+		StringId id = StringId::Register(signature);
+#else
+		StringId id(signature);
+#endif
+		ASSERT(!IsValidObjectKey(id), "already exist object signature %s key...", signature.c_str());
 
-		std::unique_ptr<TObject> object = std::make_unique<TObject>();
-		objectCache_.insert({ signature, std::move(object) });
+		std::unique_ptr<IObjectPool>& pool = objectPools_[std::type_index(typeid(TObject))];
+		if (!pool)
+		{
+			pool = std::make_unique<ObjectPool<TObject>>();
+		}
+
+		TObject* object = static_cast<ObjectPool<TObject>*>(pool.get())->Allocate();
+		object->handle_ = AllocateSlot(object, pool.get(), id);
+
+		return object;
+	}
+
+
+	/**
+	 * @brief ڵ Ű Ʈ ϴ.
+	 *
+	 * @param handle Ʈ ڵԴϴ.
+	 *
+	 * @return ڵ Ű Ʈ ͸ ȯմϴ. Ʈ ̹ Ҵ Ǿٸ  ͸ ȯմϴ.
+	 *
+	 * @note  û Ʈ FlushDestroyedObjects ȣǱ    ֽϴ.
+	 */
+	IObject* Resolve(const ObjectHandle& handle) const
+	{
+		if (handle.index >= slots_.size())
+		{
+			return nullptr;
+		}
 
-		return reinterpret_cast<TObject*>(objectCache_.at(signature).get());
+		const ObjectSlot& slot = slots_[handle.index];
+		return (slot.generation == handle.generation) ? slot.object : nullptr;
 	}
 
 
+	/**
+	 * @brief ڵ Ű Ʈ ϴ.
+	 *
+	 * @param handle Ʈ ڵԴϴ.
+	 *
+	 * @return ڵ Ű Ʈ ͸ ȯմϴ. Ʈ ̹ Ҵ Ǿٸ  ͸ ȯմϴ.
+	 */
+	template <typename TObject>
+	TObject* Resolve(const ObjectHandle& handle) const
+	{
+		return static_cast<TObject*>(Resolve(handle));
+	}
+
+
+	/**
+	 * @brief ñ״ó ĺڿ ϴ Ʈ ڵ ϴ.
+	 *
+	 * @param id Ŵ ο Ʈ  ñ״ó ĺԴϴ.
+	 *
+	 * @return ĺڿ ϴ Ʈ ڵ ȯմϴ. ϴ Ʈ  ȿ  ڵ ȯմϴ.
+	 *
+	 * @note ؽ ̺ ȸ̹Ƿ ε  ڵ ΰ,  ӿ Resolve ؾ մϴ.
+	 */
+	ObjectHandle FindHandle(const StringId& id) const;
+
+
+	/**
+	 * @brief ñ״ó  ϴ Ʈ ڵ ϴ.
+	 *
+	 * @param signature Ŵ ο Ʈ  ñ״ó Դϴ.
+	 *
+	 * @return ñ״ó  ϴ Ʈ ڵ ȯմϴ. ϴ Ʈ  ȿ  ڵ ȯմϴ.
+	 *
+	 * @note ȣ  ñ״ó ڿ ؽ  մϴ.
+	 */
+	ObjectHandle FindHandle(const std::string& signature) const { return FindHandle(StringId(signature)); }
+
+
 	/**
 	 * @brief Ʈ Ŵ ϴ Ʈ ϴ.
 	 *
 	 * @param signature Ŵ ο Ʈ  ñ״ó Դϴ.
 	 *
 	 * @return ñ״ó ϴ Ʈ ͸ ϴ. ñ״ó  ϴ Ʈ   ͸ ȯմϴ.
+	 *
+	 * @note ڿ ȸ̹Ƿ   ȣǴ ڵ忡 ڵ Resolve ؾ մϴ.
 	 */
 	template <typename TObject>
 	TObject* GetObject(const std::string& signature)
 	{
-		if (!IsValidObjectKey(signature))
-		{
-			return nullptr;
-		}
+		return Resolve<TObject>(FindHandle(signature));
+	}
+
 
-		return reinterpret_cast<TObject*>(objectCache_.at(signature).get());
+	/**
+	 * @brief Ʈ Ŵ ϴ Ʈ ϴ.
+	 *
+	 * @param id Ŵ ο Ʈ  ñ״ó ĺԴϴ.
+	 *
+	 * @return ĺڿ ϴ Ʈ ͸ ϴ. ĺڿ ϴ Ʈ   ͸ ȯմϴ.
+	 */
+	template <typename TObject>
+	TObject* GetObject(const StringId& id)
+	{
+		return Resolve<TObject>(FindHandle(id));
 	}
 
 
 	/**
-	 * @brief Ʈ Ŵ ϴ Ʈ մϴ.
+	 * @brief Ʈ Ŵ ϴ Ʈ  ûմϴ.
 	 *
 	 * @param signature  Ʈ ñ״ó Դϴ.
+	 *
+	 * @note
+	 * - ñ״ó   ǹǷ  ñ״ó  Ʈ ٷ   ֽϴ.
+	 * - Ʈ FlushDestroyedObjects ȣ  Ҵ ˴ϴ.
+	 */
+	void DestroyObject(const std::string& signature) { DestroyObject(FindHandle(signature)); }
+
+
+	/**
+	 * @brief Ʈ Ŵ ϴ Ʈ  ûմϴ.
+	 *
+	 * @param id  Ʈ ñ״ó ĺԴϴ.
+	 *
+	 * @note
+	 * - ñ״ó   ǹǷ  ñ״ó  Ʈ ٷ   ֽϴ.
+	 * - Ʈ FlushDestroyedObjects ȣ  Ҵ ˴ϴ.
+	 */
+	void DestroyObject(const StringId& id) { DestroyObject(FindHandle(id)); }
+
+
+	/**
+	 * @brief Ʈ Ŵ ϴ Ʈ  ûմϴ.
+	 *
+	 * @param handle  Ʈ ڵԴϴ.
+	 *
+	 * @note
+	 * - ñ״ó   ǹǷ  ñ״ó  Ʈ ٷ   ֽϴ.
+	 * - Ʈ FlushDestroyedObjects ȣ  Ҵ ˴ϴ.
 	 */
-	void DestroyObject(const std::string& signature);
+	void DestroyObject(const ObjectHandle& handle);
+
+
+	/**
+	 * @brief  û Ʈ û  Ҵ մϴ.
+	 *
+	 * @note
+	 * - Ʈ ȸ ߿  ʵ   ȣؾ մϴ.
+	 * - Ҵ  Ʈ ڵ  ̻ Ʈ Ű ʽϴ.
+	 */
+	void FlushDestroyedObjects();
 
 
 private:
@@ -118,12 +249,62 @@ private:
 	 *
 	 * @return Ű  ϴ Ʈ ϸ true, ׷  false ȯմϴ.
 	 */
-	bool IsValidObjectKey(const std::string& key);
+	bool IsValidObjectKey(const StringId& key) const;
+
+
+	/**
+	 * @brief Ʈ  Կ ϰ ڵ ߱մϴ.
+	 *
+	 * @param object  ƮԴϴ.
+	 * @param pool Ʈ Ҵ ǮԴϴ.
+	 * @param id Ʈ ñ״ó ĺԴϴ.
+	 *
+	 * @return ߱޵ Ʈ ڵ ȯմϴ.
+	 */
+	ObjectHandle AllocateSlot(IObject* object, IObjectPool* pool, const StringId& id);
 
 
 private:
 	/**
-	 * @brief Ʈ Ŵ  Ʈ ĳԴϴ.
+	 * @brief Ʈ ϳ ϴ Դϴ.
+	 */
+	struct ObjectSlot
+	{
+		IObject* object = nullptr;       // Կ ϵ ƮԴϴ.  ̶  Դϴ.
+		IObjectPool* pool = nullptr;     // Ʈ Ҵ ǮԴϴ.
+		uint32_t generation = 0;         //   Դϴ. Ʈ Ҵ   մϴ.
+		bool bIsPendingDestroy = false;  //  ûǾ Ҵ  ٸ Ȯմϴ.
+		StringId signature;              // Ʈ ñ״ó ĺԴϴ.
+	};
+
+
+private:
+	/**
+	 * @brief Ʈ ŸԸ ϳ ִ Ʈ ǮԴϴ.
+	 */
+	std::unordered_map<std::type_index, std::unique_ptr<IObjectPool>> objectPools_;
+
+
+	/**
+	 * @brief Ʈ  ̺Դϴ. ڵ  ε մϴ.
+	 */
+	std::vector<ObjectSlot> slots_;
+
+
+	/**
+	 * @brief    ε Դϴ.
+	 */
+	std::vector<uint32_t> freeSlots_;
+
+
+	/**
+	 * @brief ñ״ó ĺڿ  ε Դϴ.
+	 */
+	std::unordered_map<StringId, uint32_t, StringId::Hasher> signatureIndex_;
+
+
+	/**
+	 * @brief  û Ʈ  ε Դϴ. û  Ҵ մϴ.
 	 */
-	std::unordered_map<std::string, std::unique_ptr<IObject>> objectCache_;
+	std::vector<uint32_t> pendingDestroys_;
 };
\ No newline at end of file
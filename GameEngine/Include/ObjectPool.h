@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "Macro.h"
+
+class IObject;
+
+
+/**
+ * @brief Ʈ ޸𸮸 Ҵϰ ϴ Ǯ ̽Դϴ.
+ *
+ * @note Ʈ Ŵ ŸԸ ϳ Ǯ մϴ.
+ */
+class IObjectPool
+{
+public:
+	/**
+	 * @brief Ʈ Ǯ ̽ Ʈ Դϴ.
+	 */
+	IObjectPool() = default;
+
+
+	/**
+	 * @brief Ʈ Ǯ ̽  ҸԴϴ.
+	 */
+	virtual ~IObjectPool() {}
+
+
+	/**
+	 * @brief Ʈ Ǯ ̽  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(IObjectPool);
+
+
+	/**
+	 * @brief Ǯ Ҵ Ʈ ҸŰ ޸𸮸 Ǯ ȯմϴ.
+	 *
+	 * @param object ȯ ƮԴϴ. ݵ  Ǯ Ҵ Ʈ մϴ.
+	 */
+	virtual void Deallocate(IObject* object) = 0;
+};
+
+
+/**
+ * @brief  Ÿ Ʈ (slab)  Ҵϴ ǮԴϴ.
+ *
+ * @note
+ * -  Ʈ SLAB_SIZE  ӵ ޸̸,   Ҵ  Ǯ Ҹ   ʽϴ.
+ * -  Ҵ Ʈ ּҴ Ʈ ȯ  ٲ ʽϴ.
+ * - ȯ ޸𸮴  Ͽ ߴٰ  Ҵ翡 մϴ.
+ */
+template <typename TObject>
+class ObjectPool : public IObjectPool
+{
+public:
+	/**
+	 * @brief  ϳ  Ʈ Դϴ.
+	 */
+	static constexpr uint32_t SLAB_SIZE = 32;
+
+
+public:
+	/**
+	 * @brief Ʈ Ǯ Ʈ Դϴ.
+	 */
+	ObjectPool() = default;
+
+
+	/**
+	 * @brief Ʈ Ǯ  ҸԴϴ.
+	 *
+	 * @note Ǯ Ҹϱ  Ҵ Ʈ  ȯؾ մϴ.
+	 */
+	virtual ~ObjectPool() {}
+
+
+	/**
+	 * @brief Ʈ Ǯ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(ObjectPool);
+
+
+	/**
+	 * @brief Ǯ ޸𸮸 Ҵϰ Ʈ ڷ Ʈ մϴ.
+	 *
+	 * @return  Ʈ ͸ ȯմϴ.
+	 */
+	TObject* Allocate()
+	{
+		if (freeList_.empty())
+		{
+			std::unique_ptr<Slab> slab = std::make_unique<Slab>();
+			for (uint32_t index = SLAB_SIZE; index > 0; --index)
+			{
+				freeList_.push_back(&slab->storage[index - 1]);
+			}
+
+			slabs_.push_back(std::move(slab));
+		}
+
+		Storage* storage = freeList_.back();
+		freeList_.pop_back();
+
+		return new (storage) TObject();
+	}
+
+
+	/**
+	 * @brief Ǯ Ҵ Ʈ ҸŰ ޸𸮸 Ǯ ȯմϴ.
+	 *
+	 * @param object ȯ ƮԴϴ. ݵ  Ǯ Ҵ Ʈ մϴ.
+	 */
+	virtual void Deallocate(IObject* object) override
+	{
+		TObject* target = static_cast<TObject*>(object);
+		target->~TObject();
+
+		freeList_.push_back(reinterpret_cast<Storage*>(target));
+	}
+
+
+private:
+	/**
+	 * @brief Ʈ ϳ  ޸Դϴ.
+	 */
+	struct Storage
+	{
+		alignas(TObject) unsigned char bytes[sizeof(TObject)];
+	};
+
+
+	/**
+	 * @brief Ʈ SLAB_SIZE  ӵ ޸Դϴ.
+	 */
+	struct Slab
+	{
+		Storage storage[SLAB_SIZE];
+	};
+
+
+private:
+	/**
+	 * @brief Ǯ Ҵ Դϴ.
+	 */
+	std::vector<std::unique_ptr<Slab>> slabs_;
+
+
+	/**
+	 * @brief   ޸ Դϴ.
+	 */
+	std::vector<Storage*> freeList_;
+};
\ No newline at end of file
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <unordered_map>
+
+#include "IRenderBackend.h"
+#include "Shader.h"
+
+class UniformBuffer; //   ҽ ϱ  漱 Դϴ.
+
+
+/**
+ * @brief  ť ׸  OpenGL ϴ  鿣Դϴ.
+ *
+ * @note
+ * - ̴ ε Shader::Bind ϸ,   ε  ãƵ  ڵ մϴ.
+ * - Ƽ ⸶ ó   Ƽ    ϳ , Ŀ   ε  Ḹ մϴ.
+ */
+class OpenGLRenderBackend : public IRenderBackend
+{
+public:
+	/**
+	 * @brief OpenGL  鿣 Ʈ Դϴ.
+	 */
+	OpenGLRenderBackend() = default;
+
+
+	/**
+	 * @brief OpenGL  鿣  ҸԴϴ.
+	 */
+	virtual ~OpenGLRenderBackend() {}
+
+
+	/**
+	 * @brief OpenGL  鿣  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(OpenGLRenderBackend);
+
+
+	/**
+	 * @brief Ƽ   ۸ մϴ.
+	 *
+	 * @param materialUniformBuffer MaterialUniformBlock ũ    Դϴ.
+	 */
+	void SetMaterialUniformBuffer(UniformBuffer* materialUniformBuffer) { materialUniformBuffer_ = materialUniformBuffer; }
+
+
+	/**
+	 * @brief ׸   մϴ.
+	 *
+	 * @note  ⿡ Ƽ    ϴ.
+	 */
+	virtual void Begin() override;
+
+
+	/**
+	 * @brief  迭 Ʈ ̴ ε մϴ.
+	 */
+	virtual void End() override;
+
+
+	/**
+	 * @brief ̴ εմϴ.
+	 *
+	 * @param shader ε ̴Դϴ.
+	 */
+	virtual void BindShader(Shader* shader) override;
+
+
+	/**
+	 * @brief ؽó ؽó ֿ εմϴ.
+	 *
+	 * @param unit ε ؽó Դϴ.
+	 * @param textureID ε ؽó IDԴϴ.
+	 */
+	virtual void BindTexture(uint32_t unit, uint32_t textureID) override;
+
+
+	/**
+	 * @brief ޽  迭 Ʈ εմϴ.
+	 *
+	 * @param mesh ε ޽Դϴ.
+	 */
+	virtual void BindMesh(const StaticMesh* mesh) override;
+
+
+	/**
+	 * @brief ް   迭 Ʈ εմϴ.
+	 *
+	 * @param meshBuffer ε ް Դϴ.
+	 */
+	virtual void BindMeshBuffer(const MeshBuffer* meshBuffer) override;
+
+
+	/**
+	 * @brief Ƽ   ε  մϴ.
+	 *
+	 * @param material  ƼԴϴ.
+	 */
+	virtual void SetMaterial(const Material* material) override;
+
+
+	/**
+	 * @brief ε ̴   ϰ, ε ޽ø ׸ϴ.
+	 *
+	 * @param world ޽  Դϴ.
+	 * @param indexCount ׸ ޽ ε Դϴ.
+	 */
+	virtual void DrawMesh(const Matrix4x4f& world, uint32_t indexCount) override;
+
+
+	/**
+	 * @brief ε ޽ÿ νϽ ۸ ϰ,  νϽ   ȣ ׸ϴ.
+	 *
+	 * @param instanceBuffer ׸ νϽ Դϴ.
+	 * @param indexCount ׸ ޽ ε Դϴ.
+	 */
+	virtual void DrawMeshInstanced(const InstanceBuffer* instanceBuffer, uint32_t indexCount) override;
+
+
+	/**
+	 * @brief ε ̴   ϰ, ް ۿ Ҵ ޽ø glDrawElementsBaseVertex ׸ϴ.
+	 *
+	 * @param world ޽  Դϴ.
+	 * @param allocation ׸ ޽  ε Դϴ.
+	 */
+	virtual void DrawMeshBaseVertex(const Matrix4x4f& world, const MeshBuffer::Allocation& allocation) override;
+
+
+	/**
+	 * @brief ε ް ۿ νϽ ۸ ϰ, Ҵ ޽  νϽ glDrawElementsInstancedBaseVertex ׸ϴ.
+	 *
+	 * @param instanceBuffer ׸ νϽ Դϴ.
+	 * @param allocation ׸ ޽  ε Դϴ.
+	 */
+	virtual void DrawMeshInstancedBaseVertex(const InstanceBuffer* instanceBuffer, const MeshBuffer::Allocation& allocation) override;
+
+
+private:
+	/**
+	 * @brief  ε ̴Դϴ.
+	 */
+	Shader* shader_ = nullptr;
+
+
+	/**
+	 * @brief  ε ̴    ڵԴϴ.
+	 */
+	UniformHandle worldHandle_;
+
+
+	/**
+	 * @brief Ƽ   Դϴ.
+	 */
+	UniformBuffer* materialUniformBuffer_ = nullptr;
+
+
+	/**
+	 * @brief ̹ ⿡ Ƽ     εԴϴ.
+	 */
+	std::unordered_map<const Material*, uint32_t> materialBlocks_;
+};
\ No newline at end of file
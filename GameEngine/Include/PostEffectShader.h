@@ -36,12 +36,18 @@ public:
 
 
 	/**
-	 * @brief GLSL ̴ ҽ  ϰ ̴ α׷ մϴ.
+	 * @brief ̴ ο ̴ ҽ ۸ ޴ ʱȭ ޼带  մϴ.
+	 */
+	using Shader::Initialize;
+
+
+	/**
+	 * @brief ޸𸮿 ִ GLSL ̴ ҽ ϰ ̴ α׷ մϴ.
 	 *
-	 * @param vsFile ؽ ̴ Ȯ(.vert)  Դϴ.
-	 * @param fsFile ׸Ʈ ̴ Ȯ(.frag)  Դϴ.
+	 * @param vsSource ؽ ̴ ҽ Դϴ.
+	 * @param fsSource ׸Ʈ ̴ ҽ Դϴ.
 	 */
-	virtual void Initialize(const std::wstring& vsPath, const std::wstring& fsPath) override;
+	virtual void Initialize(const BufferView& vsSource, const BufferView& fsSource) override;
 
 
 	/**
@@ -0,0 +1,318 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+
+/**
+ * @brief  õ带   ִ ǻ  ƮԴϴ.
+ *
+ * @note
+ * -   xoshiro256**̸, õ splitmix64 Ȯؼ 256Ʈ ¸ äϴ.
+ * -  õ  Ʈ ȣ  Ʈ ÷  ׻   մϴ.
+ * - Ʈ ȣ ٸ  2^128   Ƿ,  ý۸  Ʈ   ֽϴ.
+ * -   Ƿ 帶  Ʈ ؾ մϴ.
+ */
+class RandomStream
+{
+public:
+	/**
+	 * @brief õ带  ʾ  ϴ ⺻ õԴϴ.
+	 */
+	static const uint64_t DEFAULT_SEED = 0x853C49E6748FEA9BULL;
+
+
+public:
+	/**
+	 * @brief  Ʈ Դϴ.
+	 *
+	 * @param seed  Ʈ õԴϴ.
+	 * @param stream  õ ȿ Ʈ ϴ ȣԴϴ.
+	 */
+	explicit RandomStream(uint64_t seed = DEFAULT_SEED, uint64_t stream = 0) { Seed(seed, stream); }
+
+
+	/**
+	 * @brief  Ʈ  ҸԴϴ.
+	 */
+	virtual ~RandomStream() = default;
+
+
+	/**
+	 * @brief  Ʈ  Դϴ.
+	 *
+	 * @note  Ʈ    ̾ մϴ.
+	 */
+	RandomStream(const RandomStream&) = default;
+
+
+	/**
+	 * @brief  Ʈ  Դϴ.
+	 *
+	 * @return  ü ڸ ȯմϴ.
+	 */
+	RandomStream& operator=(const RandomStream&) = default;
+
+
+	/**
+	 * @brief  Ʈ õ带 ٽ մϴ.
+	 *
+	 * @param seed  Ʈ õԴϴ.
+	 * @param stream  õ ȿ Ʈ ϴ ȣԴϴ.
+	 *
+	 * @note Ʈ ȣŭ Jump ϹǷ, Ʈ ȣ  ý     ؾ մϴ.
+	 */
+	void Seed(uint64_t seed, uint64_t stream = 0)
+	{
+		uint64_t splitMixState = seed;
+		for (auto& state : state_)
+		{
+			state = SplitMix64(splitMixState);
+		}
+
+		for (uint64_t count = 0; count < stream; ++count)
+		{
+			Jump();
+		}
+	}
+
+
+	/**
+	 * @brief  2^128 ܰ踸ŭ ǳʶݴϴ.
+	 *
+	 * @note  Ʈ   Jump ȣϸ  ġ ʴ  Ʈ   ֽϴ.
+	 */
+	void Jump()
+	{
+		static const uint64_t JUMP[] = { 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+
+		std::array<uint64_t, 4> jumpState = { 0, 0, 0, 0 };
+		for (const auto& jump : JUMP)
+		{
+			for (int32_t bit = 0; bit < 64; ++bit)
+			{
+				if (jump & (1ULL << bit))
+				{
+					jumpState[0] ^= state_[0];
+					jumpState[1] ^= state_[1];
+					jumpState[2] ^= state_[2];
+					jumpState[3] ^= state_[3];
+				}
+
+				NextUInt64();
+			}
+		}
+
+		state_ = jumpState;
+	}
+
+
+	/**
+	 * @brief 64Ʈ ȣ   մϴ.
+	 *
+	 * @return  64Ʈ ȣ   ȯմϴ.
+	 */
+	uint64_t NextUInt64()
+	{
+		uint64_t result = RotateLeft(state_[1] * 5, 7) * 9;
+		uint64_t t = state_[1] << 17;
+
+		state_[2] ^= state_[0];
+		state_[3] ^= state_[1];
+		state_[1] ^= state_[2];
+		state_[0] ^= state_[3];
+
+		state_[2] ^= t;
+		state_[3] = RotateLeft(state_[3], 45);
+
+		return result;
+	}
+
+
+	/**
+	 * @brief 32Ʈ ȣ   մϴ.
+	 *
+	 * @return  32Ʈ ȣ   ȯմϴ.
+	 */
+	uint32_t NextUInt32()
+	{
+		return static_cast<uint32_t>(NextUInt64() >> 32);
+	}
+
+
+	/**
+	 * @brief [minValue, maxValue]    մϴ.
+	 *
+	 * @param minValue    ּڰԴϴ.
+	 * @param maxValue    ִԴϴ.
+	 *
+	 * @return    ȯմϴ.
+	 *
+	 * @note    ٲ ־   ּڰ մϴ.
+	 */
+	int32_t NextInt(int32_t minValue, int32_t maxValue)
+	{
+		if (minValue > maxValue)
+		{
+			std::swap(minValue, maxValue);
+		}
+
+		uint32_t range = static_cast<uint32_t>(static_cast<int64_t>(maxValue) - static_cast<int64_t>(minValue)) + 1;
+		if (range == 0) // [INT32_MIN, INT32_MAX] Դϴ.
+		{
+			return static_cast<int32_t>(NextUInt32());
+		}
+
+		return static_cast<int32_t>(static_cast<int64_t>(minValue) + static_cast<int64_t>(NextBounded(range)));
+	}
+
+
+	/**
+	 * @brief [0, 1)   Ǽ մϴ.
+	 *
+	 * @return   Ǽ ȯմϴ.
+	 */
+	float NextFloat()
+	{
+		return static_cast<float>(NextUInt64() >> 40) * FLOAT_UNIT;
+	}
+
+
+	/**
+	 * @brief [minValue, maxValue)   Ǽ մϴ.
+	 *
+	 * @param minValue    ּڰԴϴ.
+	 * @param maxValue    ִԴϴ.
+	 *
+	 * @return   Ǽ ȯմϴ.
+	 *
+	 * @note    ٲ ־   ּڰ մϴ.
+	 */
+	float NextFloat(float minValue, float maxValue)
+	{
+		if (minValue > maxValue)
+		{
+			std::swap(minValue, maxValue);
+		}
+
+		return minValue + (maxValue - minValue) * NextFloat();
+	}
+
+
+	/**
+	 * @brief [minValue, maxValue)   Ǽ ۸ äϴ.
+	 *
+	 * @param outValues  ä Դϴ.
+	 * @param count ä  Դϴ.
+	 * @param minValue    ּڰԴϴ.
+	 * @param maxValue    ִԴϴ.
+	 *
+	 * @note NextFloat count ȣ Ͱ   մϴ.
+	 */
+	void FillUniform(float* outValues, std::size_t count, float minValue, float maxValue)
+	{
+		if (minValue > maxValue)
+		{
+			std::swap(minValue, maxValue);
+		}
+
+		float range = maxValue - minValue;
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			outValues[index] = minValue + range * (static_cast<float>(NextUInt64() >> 40) * FLOAT_UNIT);
+		}
+	}
+
+
+	/**
+	 * @brief [minValue, maxValue]    ۸ äϴ.
+	 *
+	 * @param outValues  ä Դϴ.
+	 * @param count ä  Դϴ.
+	 * @param minValue    ּڰԴϴ.
+	 * @param maxValue    ִԴϴ.
+	 *
+	 * @note NextInt count ȣ Ͱ   մϴ.
+	 */
+	void FillUniform(int32_t* outValues, std::size_t count, int32_t minValue, int32_t maxValue)
+	{
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			outValues[index] = NextInt(minValue, maxValue);
+		}
+	}
+
+
+private:
+	/**
+	 * @brief 64Ʈ   ȸմϴ.
+	 *
+	 * @param value ȸ Դϴ.
+	 * @param shift ȸ Ʈ Դϴ.
+	 *
+	 * @return ȸ  ȯմϴ.
+	 */
+	static uint64_t RotateLeft(uint64_t value, int32_t shift)
+	{
+		return (value << shift) | (value >> (64 - shift));
+	}
+
+
+	/**
+	 * @brief splitmix64 õ带 Ȯմϴ.
+	 *
+	 * @param state splitmix64 Դϴ. ȣ  ŵ˴ϴ.
+	 *
+	 * @return Ȯ 64Ʈ  ȯմϴ.
+	 */
+	static uint64_t SplitMix64(uint64_t& state)
+	{
+		uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		return z ^ (z >> 31);
+	}
+
+
+	/**
+	 * @brief [0, range)     մϴ.
+	 *
+	 * @param range   ũԴϴ. 0 ƴϾ մϴ.
+	 *
+	 * @return   ȯմϴ.
+	 *
+	 * @note Lemire    ϹǷ κ    ϴ.
+	 */
+	uint32_t NextBounded(uint32_t range)
+	{
+		uint64_t product = static_cast<uint64_t>(NextUInt32()) * static_cast<uint64_t>(range);
+		uint32_t low = static_cast<uint32_t>(product);
+
+		if (low < range)
+		{
+			uint32_t threshold = (0u - range) % range;
+			while (low < threshold)
+			{
+				product = static_cast<uint64_t>(NextUInt32()) * static_cast<uint64_t>(range);
+				low = static_cast<uint32_t>(product);
+			}
+		}
+
+		return static_cast<uint32_t>(product >> 32);
+	}
+
+
+private:
+	/**
+	 * @brief  24Ʈ [0, 1)  Ǽ ٲ  ϴ (2^-24)Դϴ.
+	 */
+	static constexpr float FLOAT_UNIT = 1.0f / 16777216.0f;
+
+
+	/**
+	 * @brief xoshiro256** 256Ʈ Դϴ.
+	 */
+	std::array<uint64_t, 4> state_;
+};
\ No newline at end of file
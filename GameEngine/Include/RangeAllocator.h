@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+
+#include "Macro.h"
+
+
+/**
+ * @brief  ũ     ִ  ҴԴϴ.
+ *
+ * @note
+ * - ִ    ϰ, û ũⰡ  ù °  Ҵմϴ.
+ * -   յ ִ  ٷ ļ ȭ Դϴ.
+ * - ޸𸮸  ٷ ʰ ¸ ϹǷ, GPU ó CPU  ʴ ޸    ֽϴ.
+ */
+class RangeAllocator
+{
+public:
+	/**
+	 * @brief  Ҵ Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	RangeAllocator() = default;
+
+
+	/**
+	 * @brief  Ҵ  ҸԴϴ.
+	 */
+	virtual ~RangeAllocator() {}
+
+
+	/**
+	 * @brief  Ҵ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(RangeAllocator);
+
+
+	/**
+	 * @brief ü  ִ · ʱȭմϴ.
+	 *
+	 * @param capacity ü  ũԴϴ.
+	 */
+	void Reset(uint32_t capacity);
+
+
+	/**
+	 * @brief  Ҵմϴ.
+	 *
+	 * @param size Ҵ  ũԴϴ. 0 Ŀ մϴ.
+	 * @param outOffset Ҵ   Դϴ.
+	 *
+	 * @return Ҵ翡 ϸ true, ũⰡ ´ ִ   false ȯմϴ.
+	 */
+	bool Allocate(uint32_t size, uint32_t& outOffset);
+
+
+	/**
+	 * @brief Ҵ  մϴ.
+	 *
+	 * @param offset    Դϴ.
+	 * @param size   ũԴϴ.
+	 *
+	 * @note   ü  ȿ ־ ϸ, ִ  ġ  ˴ϴ.
+	 */
+	void Free(uint32_t offset, uint32_t size);
+
+
+	/**
+	 * @brief ü  ũ⸦ ϴ.
+	 *
+	 * @return ü  ũ⸦ ȯմϴ.
+	 */
+	uint32_t GetCapacity() const { return capacity_; }
+
+
+	/**
+	 * @brief ִ  ũ  ϴ.
+	 *
+	 * @return ִ  ũ  ȯմϴ.
+	 */
+	uint32_t GetFreeSize() const { return freeSize_; }
+
+
+	/**
+	 * @brief ִ   ϴ.
+	 *
+	 * @return    ִ   ȯմϴ.
+	 */
+	uint32_t GetCountOfFreeRange() const { return static_cast<uint32_t>(freeRanges_.size()); }
+
+
+private:
+	/**
+	 * @brief ü  ũԴϴ.
+	 */
+	uint32_t capacity_ = 0;
+
+
+	/**
+	 * @brief ִ  ũ Դϴ.
+	 */
+	uint32_t freeSize_ = 0;
+
+
+	/**
+	 * @brief   Ű ϴ ִ  ũԴϴ.
+	 */
+	std::map<uint32_t, uint32_t> freeRanges_;
+};
\ No newline at end of file
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <vector>
+
+#include "IRenderBackend.h"
+
+
+/**
+ * @brief  ׸  GPU ȣ  ϴ  鿣Դϴ.
+ *
+ * @note GPU  ȯ(HEADLESS_MODE)  ť     ˻  մϴ.
+ */
+class RecordingRenderBackend : public IRenderBackend
+{
+public:
+	/**
+	 * @brief   Դϴ.
+	 */
+	enum class ECommandType : int32_t
+	{
+		Begin                       = 0x00,
+		End                         = 0x01,
+		BindShader                  = 0x02,
+		BindTexture                 = 0x03,
+		BindMesh                    = 0x04,
+		SetMaterial                 = 0x05,
+		DrawMesh                    = 0x06,
+		DrawMeshInstanced           = 0x07,
+		BindMeshBuffer              = 0x08,
+		DrawMeshBaseVertex          = 0x09,
+		DrawMeshInstancedBaseVertex = 0x0A,
+	};
+
+
+	/**
+	 * @brief  Դϴ.
+	 *
+	 * @note    ʵ ⺻ մϴ.
+	 */
+	struct Command
+	{
+		ECommandType type = ECommandType::Begin;        //  Դϴ.
+		const Shader* shader = nullptr;                 // BindShader  ̴Դϴ.
+		uint32_t unit = 0;                              // BindTexture  ؽó Դϴ.
+		uint32_t textureID = 0;                         // BindTexture  ؽó IDԴϴ.
+		const StaticMesh* mesh = nullptr;               // BindMesh  ޽Դϴ.
+		const Material* material = nullptr;             // SetMaterial  ƼԴϴ.
+		uint32_t indexCount = 0;                        //  ׸  ε Դϴ.
+		Matrix4x4f world;                               // DrawMesh, DrawMeshBaseVertex   Դϴ.
+		const InstanceBuffer* instanceBuffer = nullptr; // DrawMeshInstanced, DrawMeshInstancedBaseVertex  νϽ Դϴ.
+		uint32_t countOfInstance = 0;                   // DrawMeshInstanced, DrawMeshInstancedBaseVertex    νϽ Դϴ.
+		const MeshBuffer* meshBuffer = nullptr;         // BindMeshBuffer  ް Դϴ.
+		MeshBuffer::Allocation allocation;              // DrawMeshBaseVertex, DrawMeshInstancedBaseVertex   ε Դϴ.
+	};
+
+
+public:
+	/**
+	 * @brief ϴ  鿣 Ʈ Դϴ.
+	 */
+	RecordingRenderBackend() = default;
+
+
+	/**
+	 * @brief ϴ  鿣  ҸԴϴ.
+	 */
+	virtual ~RecordingRenderBackend() {}
+
+
+	/**
+	 * @brief ϴ  鿣  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(RecordingRenderBackend);
+
+
+	/**
+	 * @brief Begin  մϴ.
+	 */
+	virtual void Begin() override;
+
+
+	/**
+	 * @brief End  մϴ.
+	 */
+	virtual void End() override;
+
+
+	/**
+	 * @brief BindShader  մϴ.
+	 *
+	 * @param shader ε ̴Դϴ.
+	 */
+	virtual void BindShader(Shader* shader) override;
+
+
+	/**
+	 * @brief BindTexture  մϴ.
+	 *
+	 * @param unit ε ؽó Դϴ.
+	 * @param textureID ε ؽó IDԴϴ.
+	 */
+	virtual void BindTexture(uint32_t unit, uint32_t textureID) override;
+
+
+	/**
+	 * @brief BindMesh  մϴ.
+	 *
+	 * @param mesh ε ޽Դϴ.
+	 */
+	virtual void BindMesh(const StaticMesh* mesh) override;
+
+
+	/**
+	 * @brief BindMeshBuffer  մϴ.
+	 *
+	 * @param meshBuffer ε ް Դϴ.
+	 */
+	virtual void BindMeshBuffer(const MeshBuffer* meshBuffer) override;
+
+
+	/**
+	 * @brief SetMaterial  մϴ.
+	 *
+	 * @param material  ƼԴϴ.
+	 */
+	virtual void SetMaterial(const Material* material) override;
+
+
+	/**
+	 * @brief DrawMesh  մϴ.
+	 *
+	 * @param world ޽  Դϴ.
+	 * @param indexCount ׸ ޽ ε Դϴ.
+	 */
+	virtual void DrawMesh(const Matrix4x4f& world, uint32_t indexCount) override;
+
+
+	/**
+	 * @brief DrawMeshInstanced  մϴ.
+	 *
+	 * @param instanceBuffer ׸ νϽ Դϴ.
+	 * @param indexCount ׸ ޽ ε Դϴ.
+	 */
+	virtual void DrawMeshInstanced(const InstanceBuffer* instanceBuffer, uint32_t indexCount) override;
+
+
+	/**
+	 * @brief DrawMeshBaseVertex  մϴ.
+	 *
+	 * @param world ޽  Դϴ.
+	 * @param allocation ׸ ޽  ε Դϴ.
+	 */
+	virtual void DrawMeshBaseVertex(const Matrix4x4f& world, const MeshBuffer::Allocation& allocation) override;
+
+
+	/**
+	 * @brief DrawMeshInstancedBaseVertex  մϴ.
+	 *
+	 * @param instanceBuffer ׸ νϽ Դϴ.
+	 * @param allocation ׸ ޽  ε Դϴ.
+	 */
+	virtual void DrawMeshInstancedBaseVertex(const InstanceBuffer* instanceBuffer, const MeshBuffer::Allocation& allocation) override;
+
+
+	/**
+	 * @brief    մϴ.
+	 */
+	void Clear() { commands_.clear(); }
+
+
+	/**
+	 * @brief    ϴ.
+	 *
+	 * @return     ȯմϴ.
+	 */
+	const std::vector<Command>& GetCommands() const { return commands_; }
+
+
+	/**
+	 * @brief    Ư    ϴ.
+	 *
+	 * @param type    Դϴ.
+	 *
+	 * @return    type    ȯմϴ.
+	 */
+	uint32_t GetCountOfCommand(const ECommandType& type) const;
+
+
+private:
+	/**
+	 * @brief    Դϴ.
+	 */
+	std::vector<Command> commands_;
+};
\ No newline at end of file
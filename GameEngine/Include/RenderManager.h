@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 #include <windows.h>
@@ -13,13 +14,17 @@
 #include "Matrix2x2.h"
 #include "Matrix3x3.h"
 #include "Matrix4x4.h"
+#include "StringId.h"
 
+class AssetPack;
 class Camera3D;
+class GlyphCache;
 class Window;
 class Shader;
 class Skybox;
 class StaticMesh;
 class Texture2D;
+class TextLayout;
 class TTFont;
 
 
@@ -54,6 +59,7 @@ public:
 	 * 
 	 * @note 
 	 * -  ޼ ȣ    Ǵ  ͸ ؾ մϴ.
+	 * - ̴  ҽ Ŵ 񵿱 ε ϹǷ, ׸  ҽ Ŵ WaitAsyncLoads ȣؾ մϴ.
 	 * -  ޼   ȣǾ մϴ.
 	 */
 	virtual void Startup() override;
@@ -100,10 +106,30 @@ public:
 
 	/**
 	 * @brief ۿ Ʈ ۸ մϴ.
+	 *
+	 * @note ϱ  ϵ ۸ ĳø   Flushϰ,   û ۸ ĳ ؽƮ ׸  Tickմϴ.
 	 */
 	void EndFrame();
 
 
+	/**
+	 * @brief Ӹ ؽó    ѱ ۸ ĳø մϴ.
+	 *
+	 * @param glyphCache  ۸ ĳԴϴ.
+	 */
+	void RegisterGlyphCache(GlyphCache* glyphCache);
+
+
+	/**
+	 * @brief ϵ ۸ ĳø մϴ.
+	 *
+	 * @note ۸ ĳø Releaseϱ  ȣؾ ϸ,  ׸  ۸ ĳ ؽƮ Բ ϴ.
+	 *
+	 * @param glyphCache   ۸ ĳԴϴ.
+	 */
+	void UnregisterGlyphCache(GlyphCache* glyphCache);
+
+
 	/**
 	 * @brief  Ʈ մϴ.
 	 * 
@@ -171,6 +197,18 @@ public:
 	void SetShaderPath(const std::wstring& shaderPath) { shaderPath_ = shaderPath; }
 
 
+	/**
+	 * @brief  ̴    մϴ.
+	 *
+	 * @note
+	 * -   Ǿ ִٸ ̴ ҽ     "Shader/≮>" ¿ нϴ.
+	 * - ̴ ҽ Ŵ  ۾ Ƿ, WaitAsyncLoads ȣϱ  ؾ մϴ.
+	 *
+	 * @param assetPack ̴   Դϴ. ̴ ε   ȿؾ մϴ.
+	 */
+	void SetAssetPack(const AssetPack* assetPack) { assetPack_ = assetPack; }
+
+
 	/**
 	 * @brief  ũ   ο  ũ õ Ҹ Ʈմϴ.
 	 */
@@ -545,7 +583,34 @@ public:
 	 * @param center ؽƮ ߽ ǥԴϴ.
 	 * @param color ؽƮ RGBA Դϴ.
 	 */
-	void RenderText2D(const TTFont* font, const std::wstring& text, const Vector2f& center, const Vector4f& color);
+	void RenderText2D(const TTFont* font, std::wstring_view text, const Vector2f& center, const Vector4f& color);
+
+
+	/**
+	 * @brief  ۸ ĳ÷ 2D ؽƮ ȭ鿡 ׸ϴ.
+	 *
+	 * @note
+	 * - ѱó ڵ Ʈ   ؽƮ ׸  մϴ.
+	 * - ۸ ĳô RegisterGlyphCache ϵǾ ־ մϴ.
+	 * - ۸ ȣ  ûϰ, ؽƮ EndFrame ۸ ĳø   Flush  ȣ  ٸ 2D   ׸ϴ.
+	 *
+	 * @param glyphCache  ۸ ĳԴϴ.
+	 * @param text  ؽƮԴϴ.
+	 * @param center ؽƮ ߽ ǥԴϴ.
+	 * @param color ؽƮ RGBA Դϴ.
+	 */
+	void RenderText2D(GlyphCache* glyphCache, std::wstring_view text, const Vector2f& center, const Vector4f& color);
+
+
+	/**
+	 * @brief ĳõ ؽƮ ̾ƿ ȭ鿡 ׸ϴ.
+	 *
+	 * @note    ؽƮ ׸ٸ RenderText2D  մϴ.
+	 *
+	 * @param layout  ؽƮ ̾ƿԴϴ.
+	 * @param color ؽƮ RGBA Դϴ.
+	 */
+	void RenderTextLayout(TextLayout& layout, const Vector4f& color);
 
 
 	/**
@@ -713,6 +778,38 @@ public:
 	void RenderSkybox3D(const Camera3D* camera, const Skybox* skybox);
 
 	
+private:
+	/**
+	 * @brief EndFrame ׸ ۸ ĳ ؽƮԴϴ.
+	 */
+	struct GlyphCacheText
+	{
+		GlyphCache* glyphCache; // ؽƮ ׸ ۸ ĳԴϴ.
+		std::size_t textOffset; // ؽƮ ۿ ؽƮ ϴ ġԴϴ.
+		std::size_t textLength; // ؽƮ Դϴ.
+		Vector2f center;        // ؽƮ ߽ ǥԴϴ.
+		Vector4f color;         // ؽƮ RGBA Դϴ.
+	};
+
+
+	/**
+	 * @brief  ̴ ׸Ʈ ̴ ҽ о ̴ ʱȭմϴ.
+	 *
+	 * @note   Ǿ ִٸ  ѿ, ׷  ̴  Ͽ нϴ.
+	 *
+	 * @param shader ʱȭ ̴ ҽԴϴ.
+	 * @param vsName  ̴ ̸Դϴ.
+	 * @param fsName ׸Ʈ ̴ ̸Դϴ.
+	 */
+	void InitializeShader(Shader* shader, const std::wstring& vsName, const std::wstring& fsName);
+
+
+	/**
+	 * @brief ϵ ۸ ĳø   Flushϰ,   û ۸ ĳ ؽƮ ׸  Tickմϴ.
+	 */
+	void FlushGlyphCaches();
+
+
 private:
 	/**
 	 * @brief  ó ϴ Ŵ Ʈ ڿ   Ҹڸ մϴ.
@@ -774,15 +871,43 @@ private:
 	 */
 	std::wstring shaderPath_;
 
+
+	/**
+	 * @brief ̴   Դϴ.  ʾҴٸ ̴   нϴ.
+	 */
+	const AssetPack* assetPack_ = nullptr;
+
 	
 	/**
 	 * @brief  Ŵ  ̴ ĳԴϴ.
+	 *
+	 * @note  ׸ ȣ⸶ ȸϹǷ    ̴ ̸ ĺڸ Ű մϴ.
 	 */
-	std::unordered_map<std::wstring, Shader*> shaderCache_;
+	std::unordered_map<StringId, Shader*, StringId::Hasher> shaderCache_;
 
 
 	/**
 	 * @brief  ũ ϴ   Դϴ.
 	 */
 	Matrix4x4f screenOrtho_;
+
+
+	/**
+	 * @brief Ӹ ؽó    ѱ ۸ ĳ Դϴ.
+	 */
+	std::vector<GlyphCache*> glyphCaches_;
+
+
+	/**
+	 * @brief EndFrame ׸ ۸ ĳ ؽƮ Դϴ.
+	 */
+	std::vector<GlyphCacheText> glyphCacheTexts_;
+
+
+	/**
+	 * @brief ۸ ĳ ؽƮ ڿ ̾  Դϴ.
+	 *
+	 * @note ؽƮ ڿ Ҵ ʵ Ӹ  մϴ.
+	 */
+	std::wstring glyphCacheTextBuffer_;
 };
\ No newline at end of file
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Macro.h"
+#include "Matrix4x4.h"
+#include "MeshBuffer.h"
+
+class IRenderBackend; //  鿣带 ϱ  漱 Դϴ.
+class InstanceBuffer; // νϽ  ҽ ϱ  漱 Դϴ.
+class Shader;         // ̴ ҽ ϱ  漱 Դϴ.
+class StaticMesh;     //  ޽ ҽ ϱ  漱 Դϴ.
+class Material;       // ͸ ҽ ϱ  漱 Դϴ.
+
+
+/**
+ * @brief  ť  нԴϴ.
+ *
+ * @note  Ű ֻ Ʈ Ƿ,   н ׸ϴ.
+ */
+enum class ERenderPass : uint32_t
+{
+	Shadow = 0x00, // ε ʿ   ϴ нԴϴ.
+	Opaque = 0x01, //  ޽ÿ  ϴ нԴϴ.
+};
+
+
+/**
+ * @brief  ť ߰ ׸ Դϴ.
+ */
+struct DrawPacket
+{
+	ERenderPass pass = ERenderPass::Opaque;         // ׸   нԴϴ.
+	Shader* shader = nullptr;                       // ޽ø ׸ ̴Դϴ.
+	const StaticMesh* mesh = nullptr;               // ׸ ޽Դϴ. ް ۰ ִٸ  ʽϴ.
+	const MeshBuffer* meshBuffer = nullptr;         // ׸ ޽ø Ҵ ް Դϴ. nullptr̸ mesh ׸ϴ.
+	MeshBuffer::Allocation allocation;              // ް ۿ Ҵ ޽  ε Դϴ.
+	const Material* material = nullptr;             // ޽ ƼԴϴ. nullptr̸ Ƽ  ʽϴ.
+	uint32_t textureID = 0;                         // 0 ؽó ֿ ε ؽó IDԴϴ. 0̸ ؽó ε ʽϴ.
+	Matrix4x4f world;                               // ޽  Դϴ. νϽ ۰ ִٸ  ʽϴ.
+	const InstanceBuffer* instanceBuffer = nullptr; // ޽ø νϽ ׸ νϽ Դϴ. nullptr̸  ķ   ׸ϴ.
+};
+
+
+/**
+ * @brief ׸  Ҵٰ   ּҰ ǵ ؼ  鿣忡 ϴ  ťԴϴ.
+ *
+ * @note
+ * - ׸ ɸ 64Ʈ  Ű ϴ.  Ʈ н, ̴, ؽó, ޽, Ƽ Դϴ.
+ * - ̴, ؽó, ޽, Ƽ ť ó ߰  12Ʈ  ε οؼ Ű ֽϴ.
+ * - ް ۿ Ҵ ޽ô ް ۸ ޽ Ű ϹǷ,  ް  ޽ô  迭 Ʈ   εϰ   ׸ϴ.
+ * -  8Ʈ  LSD  ̸,  Ű  Ŷ  ڸ ǳʶݴϴ.
+ * -    ̹Ƿ, Ű  ׸  ߰  մϴ.
+ * -  ť ° ٲ  鿣 ε ޼带 ȣϰ,     ȯմϴ.
+ */
+class RenderQueue
+{
+public:
+	/**
+	 * @brief  ť  Դϴ.
+	 */
+	struct Statistics
+	{
+		uint32_t countOfDraw = 0;           // ׸ ȣ Դϴ. νϽ ۰ ִ ׸ ɵ  Դϴ.
+		uint32_t countOfInstance = 0;       // ׸ ޽ νϽ Դϴ.
+		uint32_t countOfShaderChange = 0;   // ̴ ε Դϴ.
+		uint32_t countOfTextureChange = 0;  // ؽó ε Դϴ.
+		uint32_t countOfMeshChange = 0;     // ޽ó ް   迭 Ʈ ε Դϴ.
+		uint32_t countOfMaterialChange = 0; // Ƽ  Դϴ.
+	};
+
+
+public:
+	/**
+	 * @brief  ť Ʈ Դϴ.
+	 */
+	RenderQueue() = default;
+
+
+	/**
+	 * @brief  ť  ҸԴϴ.
+	 */
+	virtual ~RenderQueue() {}
+
+
+	/**
+	 * @brief  ť  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(RenderQueue);
+
+
+	/**
+	 * @brief  ť  ׸  մϴ.
+	 *
+	 * @note   ޸𸮴  ӿ ٽ ϱ  մϴ.
+	 */
+	void Clear();
+
+
+	/**
+	 * @brief  ť ׸  ߰մϴ.
+	 *
+	 * @param packet ߰ ׸ Դϴ.
+	 */
+	void Add(const DrawPacket& packet);
+
+
+	/**
+	 * @brief  н ׸  ؼ  鿣忡 մϴ.
+	 *
+	 * @param backend ׸    鿣Դϴ.
+	 * @param pass   нԴϴ.
+	 *
+	 * @return  ׸    踦 ȯմϴ.
+	 *
+	 * @note   ڿ ׸  ߰Ǿ  ٽ մϴ.
+	 */
+	Statistics Submit(IRenderBackend& backend, ERenderPass pass);
+
+
+	/**
+	 * @brief  ť ׸   ϴ.
+	 *
+	 * @return  ť ׸   ȯմϴ.
+	 */
+	std::size_t GetCountOfPacket() const { return packets_.size(); }
+
+
+	/**
+	 * @brief   ׸  ε  ϴ.
+	 *
+	 * @return ߰   ϴ ׸  ε  Ű  ȯմϴ.
+	 */
+	const std::vector<uint32_t>& GetSortedIndices();
+
+
+	/**
+	 * @brief ׸   Ű ϴ.
+	 *
+	 * @param index ߰   ϴ ׸  εԴϴ.
+	 *
+	 * @return ׸  64Ʈ  Ű ȯմϴ.
+	 */
+	uint64_t GetSortKey(uint32_t index) const { return sortKeys_[index]; }
+
+
+private:
+	/**
+	 * @brief  Ű   ε ϴ.
+	 *
+	 * @param indices Ű  ε  Դϴ.
+	 * @param key  ε  ŰԴϴ.
+	 *
+	 * @return Ű  ε ȯմϴ. ó ϴ Ű ο ε οմϴ.
+	 */
+	template <typename T>
+	static uint64_t GetDenseIndex(std::unordered_map<T, uint32_t>& indices, T key);
+
+
+	/**
+	 * @brief ׸   迭 Ʈ   ϴ.
+	 *
+	 * @param packet   ׸ Դϴ.
+	 *
+	 * @return ް ۰ ִٸ ް ۸, ٸ ޽ø ȯմϴ.
+	 */
+	static const void* GetVertexSource(const DrawPacket& packet);
+
+
+	/**
+	 * @brief ׸   Ű   մϴ.
+	 */
+	void Sort();
+
+
+private:
+	/**
+	 * @brief ߰  ׸ Դϴ.
+	 */
+	std::vector<DrawPacket> packets_;
+
+
+	/**
+	 * @brief ߰  ׸   ŰԴϴ.
+	 */
+	std::vector<uint64_t> sortKeys_;
+
+
+	/**
+	 * @brief  Ű  ׸  εԴϴ.
+	 */
+	std::vector<uint32_t> sortedIndices_;
+
+
+	/**
+	 * @brief   ڸ   ӽ ε Դϴ.
+	 */
+	std::vector<uint32_t> scratchIndices_;
+
+
+	/**
+	 * @brief sortedIndices_  ׸    Ȯմϴ.
+	 */
+	bool bIsSorted_ = true;
+
+
+	/**
+	 * @brief ̴  εԴϴ.
+	 */
+	std::unordered_map<const Shader*, uint32_t> shaderIndices_;
+
+
+	/**
+	 * @brief ؽó ID  εԴϴ.
+	 */
+	std::unordered_map<uint32_t, uint32_t> textureIndices_;
+
+
+	/**
+	 * @brief ޽  εԴϴ. ް ۿ Ҵ ޽ô ް ۸ Ű մϴ.
+	 */
+	std::unordered_map<const void*, uint32_t> meshIndices_;
+
+
+	/**
+	 * @brief Ƽ  εԴϴ.
+	 */
+	std::unordered_map<const Material*, uint32_t> materialIndices_;
+};
\ No newline at end of file
@@ -1,21 +1,142 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
+#include "Assertion.h"
 #include "IManager.h"
 #include "IResource.h"
+#include "JobSystem.h"
+#include "StringId.h"
 
 
 /**
  * @brief ҽ  ϴ ŴԴϴ.
  * 
- * @note  Ŭ ̱Դϴ.
+ * @note
+ * -  Ŭ ̱Դϴ.
+ * - ҽ ñ״ó ڿ ؽ ĺ(StringId) Ű մϴ.
+ * -  ȸϴ ҽ   ĺڸ ϸ ڿ ؽ   ȸ  ֽϴ.
+ * - LoadAsync  ҽ CPU ۾ ۾ 忡 ϰ, GPU ε   ۾   ť մϴ.
  */
 class ResourceManager : public IManager
 {
+private:
+	/**
+	 * @brief 񵿱 ε  ҽ ۾Դϴ.
+	 */
+	struct LoadTask
+	{
+		std::string name;                   // ð Ͽ ҽ  ̸Դϴ.
+		JobSystem::JobCounter counter;      // ۾  CPU ۾  0 Ǵ īԴϴ.
+		std::function<void()> finalize;     //  忡   ۾Դϴ.
+		double loadSeconds = 0.0;           // ۾ 忡 CPU ۾ ɸ ðԴϴ.
+		bool bIsFinalized = false;          //  ۾  Ȯմϴ.  忡 а ϴ.
+	};
+
+
+public:
+	/**
+	 * @brief 񵿱 εϴ ҽ ڵԴϴ.
+	 *
+	 * @note
+	 * - std::futureó ҽ غǾ Ȯϰų غ  ٸ  ֽϴ.
+	 * -  忡 ؾ մϴ.
+	 */
+	template <typename TResource>
+	class LoadHandle
+	{
+	public:
+		/**
+		 * @brief  ִ ڵ մϴ.
+		 */
+		LoadHandle() = default;
+
+
+		/**
+		 * @brief ҽ  ۾    ִ Ȯմϴ.
+		 *
+		 * @return ҽ   ִٸ true, ׷  false ȯմϴ.
+		 */
+		bool IsReady() const { return task_ != nullptr && task_->bIsFinalized; }
+
+
+		/**
+		 * @brief غ ҽ ϴ.
+		 *
+		 * @return ҽ ͸ ȯմϴ.
+		 */
+		TResource* Get() const
+		{
+			ASSERT(IsReady(), "resource is not ready yet...");
+			return resource_;
+		}
+
+
+		/**
+		 * @brief ҽ غ  ٸϴ.
+		 *
+		 * @note ٸ    ٸ ҽ  ۾̳  ۾ մϴ.
+		 *
+		 * @return غ ҽ ͸ ȯմϴ.
+		 */
+		TResource* Wait() const
+		{
+			ASSERT(task_ != nullptr, "invalid resource load handle...");
+			ResourceManager::Get().WaitAsyncLoad(*task_);
+			return resource_;
+		}
+
+
+	private:
+		/**
+		 * @brief ҽ Ŵ ڵ   ֵ մϴ.
+		 */
+		friend class ResourceManager;
+
+
+		/**
+		 * @brief ε ۾ ҽ ڵ մϴ.
+		 *
+		 * @param task ҽ ε ۾Դϴ.
+		 * @param resource ε  ҽԴϴ.
+		 */
+		LoadHandle(const std::shared_ptr<LoadTask>& task, TResource* resource) : task_(task), resource_(resource) {}
+
+
+	private:
+		/**
+		 * @brief ҽ ε ۾Դϴ.
+		 */
+		std::shared_ptr<LoadTask> task_ = nullptr;
+
+
+		/**
+		 * @brief ε  ҽԴϴ.
+		 */
+		TResource* resource_ = nullptr;
+	};
+
+
+	/**
+	 * @brief 񵿱 ε ҽ ð Դϴ.
+	 */
+	struct LoadRecord
+	{
+		std::string name;             // ҽ ̸Դϴ. ñ״ó  ҽ ñ״óԴϴ.
+		double loadSeconds = 0.0;     // ۾ 忡 CPU ۾ ɸ ðԴϴ.
+		double finalizeSeconds = 0.0; //  忡  ۾ ɸ ðԴϴ.
+		double readySeconds = 0.0;    // ε   ҽ غ  ɸ ðԴϴ.
+	};
+
+
 public:
 	/**
 	 * @brief ҽ  ϴ Ŵ  ڿ  ڸ  մϴ.
@@ -67,40 +188,178 @@ public:
 	template <typename TResource>
 	TResource* CreateResource(const std::string& signature)
 	{
-		ASSERT(!IsValidResourceKey(signature), "already exist resource signature %s key...", signature.c_str());
+#if defined(DEBUG_MODE)
+		StringId id = StringId::Register(signature);
+#else
+		StringId id(signature);
+#endif
+		ASSERT(!IsValidResourceKey(id), "already exist resource signature %s key...", signature.c_str());
 
 		std::unique_ptr<TResource> resource = std::make_unique<TResource>();
-		resourceCache_.insert({ signature, std::move(resource) });
+		TResource* resourcePtr = resource.get();
+
+		resourceCache_.insert({ id, std::move(resource) });
 
-		return reinterpret_cast<TResource*>(resourceCache_.at(signature).get());
+		return resourcePtr;
 	}
 
 
 	/**
-	 * @brief ҽ Ŵ ϴ ҽ ϴ.
+	 * @brief  ҽ ϰ 񵿱 ε մϴ.
+	 *
+	 * @note
+	 * - load ۾ 忡 ҽ Բ ȣǹǷ,  б⳪ ڵó OpenGL ؽƮ ʿ  CPU ۾ ؾ մϴ.
+	 * - finalize  忡 ҽ  load ȯ Բ ȣǹǷ, OpenGL ȣ   ۾ մϴ.
+	 * - load ƹ͵ ȯ ʴ´ٸ finalize ҽ ޹޽ϴ.
+	 * -  ۾   ҽ ϸ  ˴ϴ.
+	 * -  ۾ FinalizeAsyncLoads, WaitAsyncLoads, ڵ Wait ȣ  մϴ.
 	 *
 	 * @param signature Ŵ ο ҽ  ñ״ó Դϴ.
+	 * @param load ۾ 忡  CPU ۾Դϴ.
+	 * @param finalize  忡   ۾Դϴ.
 	 *
-	 * @return ñ״ó ϴ ҽ ͸ ϴ. ñ״ó  ϴ ҽ   ͸ ȯմϴ.
+	 * @return ε  ҽ ڵ ȯմϴ.
+	 */
+	template <typename TResource, typename TLoad, typename TFinalize>
+	LoadHandle<TResource> LoadAsync(const std::string& signature, TLoad&& load, TFinalize&& finalize)
+	{
+		return LoadAsync(signature, CreateResource<TResource>(signature), std::forward<TLoad>(load), std::forward<TFinalize>(finalize));
+	}
+
+
+	/**
+	 * @brief ̹  ҽ 񵿱 ε մϴ.
+	 *
+	 * @note ۾   忡 ϴ ۾ ñ״ó ҽ ϴ LoadAsync ϴ.
+	 *
+	 * @param name ð Ͽ ҽ  ̸Դϴ.
+	 * @param resource ε ҽԴϴ.
+	 * @param load ۾ 忡  CPU ۾Դϴ.
+	 * @param finalize  忡   ۾Դϴ.
+	 *
+	 * @return ε  ҽ ڵ ȯմϴ.
+	 */
+	template <typename TResource, typename TLoad, typename TFinalize>
+	LoadHandle<TResource> LoadAsync(const std::string& name, TResource* resource, TLoad&& load, TFinalize&& finalize)
+	{
+		using TPayload = std::invoke_result_t<TLoad, TResource*>;
+
+		std::shared_ptr<LoadTask> task = std::make_shared<LoadTask>();
+		task->name = name;
+
+		if (pendingLoadTasks_.empty())
+		{
+			loadStartTime_ = std::chrono::steady_clock::now();
+		}
+		pendingLoadTasks_.push_back(task);
+
+		if constexpr (std::is_void_v<TPayload>)
+		{
+			task->finalize = [resource, finalize]() { finalize(resource); };
+			JobSystem::Get().Schedule([this, task, resource, load]()
+				{
+					auto startTime = std::chrono::steady_clock::now();
+					load(resource);
+					task->loadSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+					PushFinalizeTask(task);
+				}, &task->counter);
+		}
+		else
+		{
+			std::shared_ptr<TPayload> payload = std::make_shared<TPayload>();
+
+			task->finalize = [resource, payload, finalize]() { finalize(resource, *payload); };
+			JobSystem::Get().Schedule([this, task, resource, payload, load]()
+				{
+					auto startTime = std::chrono::steady_clock::now();
+					*payload = load(resource);
+					task->loadSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+					PushFinalizeTask(task);
+				}, &task->counter);
+		}
+
+		return LoadHandle<TResource>(task, resource);
+	}
+
+
+	/**
+	 * @brief CPU ۾  ҽ  ۾  忡 մϴ.
+	 *
+	 * @note     ȣϸ ε ȭ ׸鼭 ҽ غ  ֽϴ.
+	 *
+	 * @return  ۾  ҽ  ȯմϴ.
+	 */
+	uint32_t FinalizeAsyncLoads();
+
+
+	/**
+	 * @brief   ҽ غ  ٸϴ.
+	 *
+	 * @note ٸ      ҽ  ۾̳  ۾ մϴ.
+	 */
+	void WaitAsyncLoads();
+
+
+	/**
+	 * @brief 񵿱 ε ҽ ð  ϴ.
+	 *
+	 * @return ҽ غ  ĵ ð  ȯմϴ.
+	 */
+	const std::vector<LoadRecord>& GetLoadRecords() const { return loadRecords_; }
+
+
+	/**
+	 * @brief ҽ Ŵ ϴ ҽ ϴ.
+	 *
+	 * @param id Ŵ ο ҽ  ñ״ó ĺԴϴ.
+	 *
+	 * @return ĺڿ ϴ ҽ ͸ ϴ. ĺڿ ϴ ҽ   ͸ ȯմϴ.
 	 */
 	template <typename TResource>
-	TResource* GetResource(const std::string& signature)
+	TResource* GetResource(const StringId& id)
 	{
-		if (!IsValidResourceKey(signature))
+		auto iter = resourceCache_.find(id);
+		if (iter == resourceCache_.end())
 		{
 			return nullptr;
 		}
 
-		return reinterpret_cast<TResource*>(resourceCache_.at(signature).get());
+		return reinterpret_cast<TResource*>(iter->second.get());
+	}
+
+
+	/**
+	 * @brief ҽ Ŵ ϴ ҽ ϴ.
+	 *
+	 * @param signature Ŵ ο ҽ  ñ״ó Դϴ.
+	 *
+	 * @return ñ״ó ϴ ҽ ͸ ϴ. ñ״ó  ϴ ҽ   ͸ ȯմϴ.
+	 *
+	 * @note ȣ  ñ״ó ڿ ؽ  մϴ.
+	 */
+	template <typename TResource>
+	TResource* GetResource(const std::string& signature)
+	{
+		return GetResource<TResource>(StringId(signature));
 	}
 
 
+	/**
+	 * @brief ҽ Ŵ ϴ ҽ մϴ.
+	 *
+	 * @param id  ҽ ñ״ó ĺԴϴ.
+	 */
+	void DestroyResource(const StringId& id);
+
+
 	/**
 	 * @brief ҽ Ŵ ϴ ҽ մϴ.
 	 *
 	 * @param signature  ҽ ñ״ó Դϴ.
 	 */
-	void DestroyResource(const std::string& signature);
+	void DestroyResource(const std::string& signature) { DestroyResource(StringId(signature)); }
 
 
 private:
@@ -117,12 +376,60 @@ private:
 	 * 
 	 * @return Ű  ϴ ҽ ϸ true, ׷  false ȯմϴ.
 	 */
-	bool IsValidResourceKey(const std::string& key);
+	bool IsValidResourceKey(const StringId& key);
+
+
+	/**
+	 * @brief CPU ۾  ε ۾  ť ֽϴ.
+	 *
+	 * @note ۾ 忡 ȣ˴ϴ.
+	 *
+	 * @param task CPU ۾  ε ۾Դϴ.
+	 */
+	void PushFinalizeTask(const std::shared_ptr<LoadTask>& task);
+
+
+	/**
+	 * @brief ε ۾   ٸϴ.
+	 *
+	 * @param task ٸ ε ۾Դϴ.
+	 */
+	void WaitAsyncLoad(const LoadTask& task);
 
 
 private:
 	/**
 	 * @brief ҽ Ŵ  ҽ ĳԴϴ.
 	 */
-	std::unordered_map<std::string, std::unique_ptr<IResource>> resourceCache_;
+	std::unordered_map<StringId, std::unique_ptr<IResource>, StringId::Hasher> resourceCache_;
+
+
+	/**
+	 * @brief  ٸ  ε ۾ Դϴ.
+	 */
+	std::vector<std::shared_ptr<LoadTask>> pendingLoadTasks_;
+
+
+	/**
+	 * @brief  ť ȣϴ ؽԴϴ.
+	 */
+	std::mutex finalizeMutex_;
+
+
+	/**
+	 * @brief CPU ۾     ۾ ٸ ε ۾ ťԴϴ.
+	 */
+	std::vector<std::shared_ptr<LoadTask>> finalizeTasks_;
+
+
+	/**
+	 * @brief ٸ ε ۾   ó  Դϴ.
+	 */
+	std::chrono::steady_clock::time_point loadStartTime_;
+
+
+	/**
+	 * @brief 񵿱 ε ҽ ð Դϴ.
+	 */
+	std::vector<LoadRecord> loadRecords_;
 };
\ No newline at end of file
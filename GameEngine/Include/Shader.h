@@ -1,8 +1,9 @@
 #pragma once
 
 #include <string>
-#include <map>
+#include <unordered_map>
 
+#include "BufferView.h"
 #include "IResource.h"
 #include "Matrix2x2.h"
 #include "Matrix3x3.h"
@@ -12,6 +13,25 @@
 #include "Vector4.h"
 
 
+/**
+ * @brief ̴ α׷ ũ  ãƵ   ڵԴϴ.
+ *
+ * @note ڿ  ڵ   ϸ Ź ̸ ˻ ʽϴ. ̴    ڵ ȿϸ, ص ƹ ۾  ʽϴ.
+ */
+struct UniformHandle
+{
+	/**
+	 * @brief ڵ ȿ Ȯմϴ.
+	 *
+	 * @return ̴    ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsValid() const { return location >= 0; }
+
+
+	int32_t location = -1; // ̴    ġԴϴ.
+};
+
+
 /**
  * @brief GLSL ̴ ϰ ̴ α׷ մϴ.
  */
@@ -57,8 +77,10 @@ public:
 	 * 
 	 * @param vsFile ؽ ̴ Ȯ(.vert)  Դϴ.
 	 * @param fsFile ׸Ʈ ̴ Ȯ(.frag)  Դϴ.
+	 *
+	 * @note    ̴ ҽ ۸ ޴ Initialize ȣմϴ.
 	 */
-	virtual void Initialize(const std::wstring& vsPath, const std::wstring& fsPath);
+	void Initialize(const std::wstring& vsPath, const std::wstring& fsPath);
 
 
 	/**
@@ -67,8 +89,31 @@ public:
 	 * @param vsFile ؽ ̴ Ȯ(.vert)  Դϴ.
 	 * @param gsFile Ʈ ̴ Ȯ(.geom)  Դϴ.
 	 * @param fsFile ׸Ʈ ̴ Ȯ(.frag)  Դϴ.
+	 *
+	 * @note    ̴ ҽ ۸ ޴ Initialize ȣմϴ.
+	 */
+	void Initialize(const std::wstring& vsPath, const std::wstring& gsPath, const std::wstring& fsPath);
+
+
+	/**
+	 * @brief ޸𸮿 ִ GLSL ̴ ҽ ϰ ̴ α׷ մϴ.
+	 *
+	 * @param vsSource ؽ ̴ ҽ Դϴ.   ε ޸𸮸 ״ ѱ  ֽϴ.
+	 * @param fsSource ׸Ʈ ̴ ҽ Դϴ.
+	 *
+	 * @note ̴ ӹ޴ Ŭ  ޼带 ؼ ߰ ʱȭ մϴ.
+	 */
+	virtual void Initialize(const BufferView& vsSource, const BufferView& fsSource);
+
+
+	/**
+	 * @brief ޸𸮿 ִ GLSL ̴ ҽ ϰ ̴ α׷ մϴ.
+	 *
+	 * @param vsSource ؽ ̴ ҽ Դϴ.
+	 * @param gsSource Ʈ ̴ ҽ Դϴ.
+	 * @param fsSource ׸Ʈ ̴ ҽ Դϴ.
 	 */
-	virtual void Initialize(const std::wstring& vsPath, const std::wstring& gsPath, const std::wstring& fsPath);
+	virtual void Initialize(const BufferView& vsSource, const BufferView& gsSource, const BufferView& fsSource);
 
 
 	/**
@@ -263,6 +308,136 @@ public:
 	void SetUniform(const std::string& name, const Matrix4x4f& value);
 
 
+	/**
+	 * @brief ڵ ̴  boolean Ÿ   մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, bool value);
+
+
+	/**
+	 * @brief ڵ ̴  int Ÿ   մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, int32_t value);
+
+
+	/**
+	 * @brief ڵ ̴  float Ÿ   մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, float value);
+
+
+	/**
+	 * @brief ڵ ̴  2  Ÿ   մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Vector2f& value);
+
+
+	/**
+	 * @brief ڵ ̴  2  Ÿ   մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Vector2i& value);
+
+
+	/**
+	 * @brief ڵ ̴  3  Ÿ   մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Vector3f& value);
+
+
+	/**
+	 * @brief ڵ ̴  3  Ÿ   մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Vector3i& value);
+
+
+	/**
+	 * @brief ڵ ̴  4  Ÿ   մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Vector4f& value);
+
+
+	/**
+	 * @brief ڵ ̴  4  Ÿ   մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Vector4i& value);
+
+
+	/**
+	 * @brief ڵ ̴  2x2 Ÿ    մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Matrix2x2f& value);
+
+
+	/**
+	 * @brief ڵ ̴  3x3 Ÿ    մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Matrix3x3f& value);
+
+
+	/**
+	 * @brief ڵ ̴  4x4 Ÿ    մϴ.
+	 *
+	 * @param handle   ڵԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(const UniformHandle& handle, const Matrix4x4f& value);
+
+
+	/**
+	 * @brief ̴ α׷ ũ  ãƵ   ڵ ϴ.
+	 *
+	 * @param name   ̸Դϴ. 迭  "name" "name[0]"  ã  ֽϴ.
+	 *
+	 * @return   ڵ ȯմϴ. ã ϸ ȿ ڵ ȯմϴ.
+	 *
+	 * @note   ϴ   ʱȭ  ڵ   ΰ ؾ մϴ.
+	 */
+	UniformHandle GetUniformHandle(const std::string& name) const;
+
+
+	/**
+	 * @brief ̴ α׷ ũ  ãƵ   Ʈ ũ⸦ ϴ.
+	 *
+	 * @param blockName   ̸Դϴ.
+	 *
+	 * @return   Ʈ ũ⸦ ȯմϴ. ̴  ʴ ̸ 0 ȯմϴ.
+	 */
+	uint32_t GetUniformBlockSize(const std::string& blockName) const;
+
+
 	/**
 	 * @brief ̴   ü ġ ϴ.
 	 *
@@ -293,11 +468,19 @@ private:
 	 * @note ̴ ü  ϸ 0 ƴ  ȯմϴ.
 	 *
 	 * @param type ̴ ŸԴϴ.
-	 * @param source ̴ ҽԴϴ.
+	 * @param source ̴ ҽ Դϴ.  ڷ  ʾƵ ˴ϴ.
 	 *
 	 * @return ϵ ̴ ü ̵ ȯմϴ.
 	 */
-	uint32_t CreateAndCompileShader(const EType& type, const std::string& source);
+	uint32_t CreateAndCompileShader(const EType& type, const BufferView& source);
+
+
+	/**
+	 * @brief ũ ̴ α׷   ġ   ũ⸦ ãƵӴϴ.
+	 *
+	 * @see https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGetProgramInterface.xhtml
+	 */
+	void ReflectProgram();
 
 
 private:
@@ -308,7 +491,13 @@ private:
 
 
 	/**
-	 * @brief   ġԴϴ.
+	 * @brief ̴ α׷ ũ  ãƵ   ġԴϴ.
+	 */
+	std::unordered_map<std::string, int32_t> uniformLocations_;
+
+
+	/**
+	 * @brief ̴ α׷ ũ  ãƵ   Ʈ ũԴϴ.
 	 */
-	std::map<std::string, uint32_t> uniformLocationCache_;
+	std::unordered_map<std::string, uint32_t> uniformBlockSizes_;
 };
\ No newline at end of file
@@ -72,6 +72,14 @@ public:
 	void Active(uint32_t unit) const;
 
 
+	/**
+	 * @brief ε  ̰ ؽó ID ϴ.
+	 *
+	 * @return ε  ̰ ؽó ID ȯմϴ.
+	 */
+	uint32_t GetShadowMapID() const { return shadowMapID_; }
+
+
 private:
 	/**
 	 * @brief ε  ε Ǿ Ȯմϴ.
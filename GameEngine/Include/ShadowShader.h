@@ -2,14 +2,16 @@
 
 #include "Shader.h"
 
-class StaticMesh; //  ޽ ҽ ϱ  漱 Դϴ.
-class Light;      // Ʈ Ʈ ϱ  漱 Դϴ.
+class StaticMesh;     //  ޽ ҽ ϱ  漱 Դϴ.
+class InstanceBuffer; // νϽ  ҽ ϱ  漱 Դϴ.
 
 
 /**
  * @brief ε ȿ ϴ ̴Դϴ.
  * 
- * @note  ̴  ο ϴ ̴Դϴ. ܺο ʱȭϸ ȵ˴ϴ.
+ * @note
+ * -  ̴  ο ϴ ̴Դϴ. ܺο ʱȭϸ ȵ˴ϴ.
+ * - Ʈ  ȯ FrameUniformBlock  ۷ մϴ.
  */
 class ShadowShader : public Shader
 {
@@ -37,11 +39,20 @@ public:
 
 
 	/**
-	 * @brief ε ̴ Ʈ õ  ۸ մϴ.
-	 * 
-	 * @param light  Ʈ Դϴ.
+	 * @brief ̴ ο ̴ ҽ ۸ ޴ ʱȭ ޼带  մϴ.
 	 */
-	void SetLight(const Light* light);
+	using Shader::Initialize;
+
+
+	/**
+	 * @brief ޸𸮿 ִ GLSL ̴ ҽ ϰ ̴ α׷ մϴ.
+	 *
+	 * @param vsSource ؽ ̴ ҽ Դϴ.
+	 * @param fsSource ׸Ʈ ̴ ҽ Դϴ.
+	 *
+	 * @note    ڵ ãƵΰ, ̴   ũⰡ UniformBlock.h ü  ˻մϴ.
+	 */
+	virtual void Initialize(const BufferView& vsSource, const BufferView& fsSource) override;
 
 
 	/**
@@ -51,4 +62,24 @@ public:
 	 * @param mesh  ȿ  ޽Դϴ.
 	 */
 	void DrawMesh3D(const Matrix4x4f& world, const StaticMesh* mesh);
+
+
+	/**
+	 * @brief  ۿ ޽  νϽ     ȣ մϴ.
+	 *
+	 * @param mesh  ޽Դϴ.
+	 * @param instanceBuffer  νϽ Դϴ.
+	 *
+	 * @note ShadowMapInstanced.vert ʱȭ ̴ ȣؾ մϴ.
+	 */
+	void DrawMeshInstanced3D(const StaticMesh* mesh, const InstanceBuffer* instanceBuffer);
+
+
+private:
+	/**
+	 * @brief    ڵԴϴ.
+	 *
+	 * @note νϽ ̴    Ƿ ȿ ڵԴϴ.
+	 */
+	UniformHandle worldHandle_;
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 
+#include "BufferView.h"
 #include "IResource.h"
 
 #include <miniaudio.h>
@@ -44,6 +45,18 @@ public:
 	void Initialize(const std::wstring& path);
 
 
+	/**
+	 * @brief ޸𸮿 ִ    带 ʱȭմϴ.
+	 *
+	 * @param buffer   Դϴ.   ε ޸𸮸 ״ ѱ  ֽϴ.
+	 *
+	 * @note
+	 * - ۸  ʰ ϸ鼭 ڵϹǷ, ۴ 带   ȿؾ մϴ.
+	 * -  ѿ  Ǯ  ۶ 庸  ؾ մϴ.
+	 */
+	void Initialize(const BufferView& buffer);
+
+
 	/**
 	 * @brief   ҽ Ҵ մϴ.
 	 */
@@ -133,4 +146,12 @@ private:
 	 * @brief miniaudio  ҽԴϴ.
 	 */
 	std::unique_ptr<ma_sound> sound_ = nullptr;
+
+
+	/**
+	 * @brief ޸𸮿 ִ   ڵϴ miniaudio ڴԴϴ.
+	 *
+	 * @note  η ʱȭ   ʽϴ.
+	 */
+	std::unique_ptr<ma_decoder> decoder_ = nullptr;
 };
\ No newline at end of file
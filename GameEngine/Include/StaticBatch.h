@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Macro.h"
+#include "Matrix4x4.h"
+#include "Vertex.h"
+
+class Material;   // ͸ ҽ ϱ  漱 Դϴ.
+class StaticMesh; //  ޽ ҽ ϱ  漱 Դϴ.
+
+
+/**
+ * @brief  ʴ ޽õ Ƽ󺰷 ϳ ޽÷ ġ  ġ Դϴ.
+ *
+ * @note
+ * - ߰ ޽   ķ ̸ ȯϹǷ, ģ ޽ô    ķ ؼ ׸ϴ.
+ * -  ʹ   3x3 κ ġ ķ ȯϰ ٽ ȭմϴ.  Ͽ 鿡   մϴ.
+ * - ε ġ    ŭ ؼ ġ   Ű ٽ մϴ.
+ * - ġ Ƽ ó ߰  , ġ   ε ߰  մϴ.
+ */
+class StaticBatch
+{
+public:
+	/**
+	 * @brief  Ƽ ϴ ޽õ ģ ġԴϴ.
+	 */
+	struct Batch
+	{
+		const Material* material = nullptr; // ġ ƼԴϴ.
+		uint32_t countOfMesh = 0;           // ġ ģ ޽ Դϴ.
+		std::vector<Vertex> vertices;       //   ȯ  Դϴ.
+		std::vector<uint32_t> indices;      // ġ   Ű ٽ  ε Դϴ.
+	};
+
+
+public:
+	/**
+	 * @brief  ġ  Ʈ Դϴ.
+	 */
+	StaticBatch() = default;
+
+
+	/**
+	 * @brief  ġ   ҸԴϴ.
+	 */
+	virtual ~StaticBatch() {}
+
+
+	/**
+	 * @brief  ġ   ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(StaticBatch);
+
+
+	/**
+	 * @brief  ġ մϴ.
+	 */
+	void Clear() { batches_.clear(); }
+
+
+	/**
+	 * @brief  ε    ȯؼ Ƽ ġ ߰մϴ.
+	 *
+	 * @param vertices ߰ ޽    Դϴ.
+	 * @param indices ߰ ޽ ε Դϴ.
+	 * @param world ߰ ޽  Դϴ.
+	 * @param material ߰ ޽ ƼԴϴ.
+	 */
+	void Add(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, const Matrix4x4f& world, const Material* material);
+
+
+	/**
+	 * @brief  ޽ø   ȯؼ Ƽ ġ ߰մϴ.
+	 *
+	 * @param mesh ߰  ޽Դϴ. ޽ð ϴ CPU  ε  մϴ.
+	 * @param world ߰ ޽  Դϴ.
+	 * @param material ߰ ޽ ƼԴϴ.
+	 */
+	void Add(const StaticMesh* mesh, const Matrix4x4f& world, const Material* material);
+
+
+	/**
+	 * @brief Ƽ󺰷 ģ ġ  ϴ.
+	 *
+	 * @return Ƽ ó ߰  ġ  ȯմϴ.
+	 */
+	const std::vector<Batch>& GetBatches() const { return batches_; }
+
+
+	/**
+	 * @brief   ġ  ķ ȯմϴ.
+	 *
+	 * @param position ȯ   ġԴϴ.
+	 * @param world ȯ   Դϴ.
+	 *
+	 * @return   ġ ȯմϴ.
+	 */
+	static Vector3f TransformPosition(const Vector3f& position, const Matrix4x4f& world);
+
+
+	/**
+	 * @brief    ͸   ġ ķ ȯմϴ.
+	 *
+	 * @param normal ȯ    Դϴ.
+	 * @param world ȯ   Դϴ.
+	 *
+	 * @return ȭ    ͸ ȯմϴ. ȯ   ̰ 0̸  ͸ ȯմϴ.
+	 *
+	 * @note   μ  ϰ Ľ ȣ ݿϹǷ, Ľ  ʽϴ.
+	 */
+	static Vector3f TransformNormal(const Vector3f& normal, const Matrix4x4f& world);
+
+
+private:
+	/**
+	 * @brief Ƽ ó ߰  ġ Դϴ.
+	 */
+	std::vector<Batch> batches_;
+};
\ No newline at end of file
@@ -39,6 +39,10 @@ public:
 	 * 
 	 * @param vertices ޽  Դϴ.
 	 * @param indices ޽ ε Դϴ.
+	 * 
+	 * @note
+	 * -  Īó CPU ޽  ٽ   ֵ  ε  纻 մϴ.
+	 * - HEADLESS_MODE GPU ۸  ʰ CPU  ε ϸ մϴ.
 	 */
 	void Initialize(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
 
@@ -57,6 +61,22 @@ public:
 	uint32_t GetIndexCount() const { return indexCount_; }
 
 
+	/**
+	 * @brief ޽ CPU   ϴ.
+	 * 
+	 * @return ޽ CPU   ȯմϴ.
+	 */
+	const std::vector<Vertex>& GetVertices() const { return vertices_; }
+
+
+	/**
+	 * @brief ޽ CPU ε  ϴ.
+	 * 
+	 * @return ޽ CPU ε  ȯմϴ.
+	 */
+	const std::vector<uint32_t>& GetIndices() const { return indices_; }
+
+
 	/**
 	 * @brief ޽  迭 Ʈ ϴ.
 	 * 
@@ -84,6 +104,18 @@ private:
 	uint32_t indexCount_ = 0;
 
 
+	/**
+	 * @brief GPU ۿ    CPU 纻Դϴ.
+	 */
+	std::vector<Vertex> vertices_;
+
+
+	/**
+	 * @brief GPU ۿ  ε  CPU 纻Դϴ.
+	 */
+	std::vector<uint32_t> indices_;
+
+
 	/**
 	 * @brief  ͸ ϴ  ʿ  Դϴ.
 	 * 
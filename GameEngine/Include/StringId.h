@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+
+/**
+ * @brief ڿ 64Ʈ FNV-1a ؽ  ٲ ĺԴϴ.
+ *
+ * @note
+ * - ڰ constexpr̹Ƿ   ĺڴ   ؽ  ˴ϴ.
+ * - ҽ Ŵ Ʈ Ŵ ñ״ó ڿ   ĺ ؽ  Ű մϴ.
+ * -  忡 ϵ ڿ  ̺ ϰ,  ٸ ڿ ؽ 浹 ˻մϴ.
+ */
+struct StringId
+{
+	/**
+	 * @brief FNV-1a 64Ʈ ؽ ʱ Դϴ.
+	 */
+	static constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325ULL;
+
+
+	/**
+	 * @brief FNV-1a 64Ʈ ؽ Ҽ Դϴ.
+	 */
+	static constexpr uint64_t FNV_PRIME = 0x100000001B3ULL;
+
+
+	/**
+	 * @brief  ڿ ĺڸ մϴ.
+	 */
+	constexpr StringId() = default;
+
+
+	/**
+	 * @brief ڿ ĺڸ մϴ.
+	 *
+	 * @param string ؽ   ڿԴϴ.
+	 */
+	explicit constexpr StringId(std::string_view string) : hash(Hash(string)) {}
+
+
+	/**
+	 * @brief ڿ FNV-1a 64Ʈ ؽ  մϴ.
+	 *
+	 * @param string ؽ   ڿԴϴ.
+	 *
+	 * @return  ؽ  ȯմϴ.
+	 */
+	static constexpr uint64_t Hash(std::string_view string)
+	{
+		uint64_t value = FNV_OFFSET_BASIS;
+		for (char character : string)
+		{
+			value ^= static_cast<uint64_t>(static_cast<uint8_t>(character));
+			value *= FNV_PRIME;
+		}
+
+		return value;
+	}
+
+
+	/**
+	 * @brief  ĺڰ  Ȯմϴ.
+	 *
+	 * @param id  ĺԴϴ.
+	 *
+	 * @return  ĺ ؽ  ٸ true, ׷  false ȯմϴ.
+	 */
+	constexpr bool operator==(const StringId& id) const { return hash == id.hash; }
+
+
+	/**
+	 * @brief  ĺڰ ٸ Ȯմϴ.
+	 *
+	 * @param id  ĺԴϴ.
+	 *
+	 * @return  ĺ ؽ  ٸٸ true, ׷  false ȯմϴ.
+	 */
+	constexpr bool operator!=(const StringId& id) const { return hash != id.hash; }
+
+
+	/**
+	 * @brief ĺڸ ؽ ̳ Ű ϱ  ؽ Լ üԴϴ.
+	 *
+	 * @note ĺڴ ̹ ؽ ̹Ƿ ٽ ؽ ʽϴ.
+	 */
+	struct Hasher
+	{
+		std::size_t operator()(const StringId& id) const { return static_cast<std::size_t>(id.hash); }
+	};
+
+
+#if defined(DEBUG_MODE)
+	/**
+	 * @brief ĺ  ڿ  ̺ մϴ.
+	 *
+	 * @param string   ڿԴϴ.
+	 *
+	 * @return ϵ ڿ ĺڸ ȯմϴ.
+	 *
+	 * @note
+	 * -  忡   ֽϴ.
+	 * -  ؽ  ٸ ڿ ̹ ϵǾ ִٸ ؽ 浹 Ǵϰ ˻翡 մϴ.
+	 */
+	static StringId Register(std::string_view string);
+
+
+	/**
+	 * @brief  ̺ ĺ  ڿ ãϴ.
+	 *
+	 * @param id  ڿ ã ĺԴϴ.
+	 *
+	 * @return ϵ  ڿ ȯմϴ. ϵ  ĺڶ  ڿ ȯմϴ.
+	 *
+	 * @note  忡   ֽϴ.
+	 */
+	static std::string FindString(const StringId& id);
+#endif
+
+
+	uint64_t hash = FNV_OFFSET_BASIS; // ڿ FNV-1a 64Ʈ ؽ Դϴ.
+};
\ No newline at end of file
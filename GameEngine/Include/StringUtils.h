@@ -1,14 +1,19 @@
 #pragma once
 
-#include <vector>
-#include <string>
 #include <cstdarg>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
 
 
 /**
  * @brief ڿ Ȯ  մϴ.
  *
- * @note ڿ std::string, std::wstring ǥ ڿ Դϴ.
+ * @note
+ * - ڿ std::string, std::wstring ǥ ڿ Դϴ.
+ * -  ڿ ۴ 帶  Ƿ  Լ  忡 ÿ ȣ  ֽϴ.
+ * -   ȣǴ ڵ ȣ ۿ  FormatTo FixedString ؾ մϴ.
  */
 namespace StringUtils
 {
@@ -18,6 +23,67 @@ namespace StringUtils
 	const int32_t STRING_BUFFER_SIZE = 1024;
 
 
+	/**
+	 * @brief ȭ ڿ ȣ ۿ ϴ.
+	 *
+	 * @note
+	 * -  Ҵ  , ۺ  ڿ ߶ ϴ.
+	 * -  ũⰡ 0 ũٸ  ׻  ڷ ϴ.
+	 *
+	 * @param buffer ȭ ڿ  Դϴ.
+	 * @param bufferSize  ڸ   ũԴϴ.
+	 * @param format  ڿԴϴ.
+	 * @param ... ڿ Ŀ ϴ Դϴ.
+	 *
+	 * @return ۿ  ڿ ̸ ȯմϴ.  ڴ  ʽϴ.
+	 */
+	std::size_t FormatTo(char* buffer, std::size_t bufferSize, const char* format, ...);
+
+
+	/**
+	 * @brief ȭ ڿ ȣ ۿ ϴ.
+	 *
+	 * @note
+	 * -  Ҵ  , ۺ  ڿ ߶ ϴ.
+	 * -  ũⰡ 0 ũٸ  ׻  ڷ ϴ.
+	 * - MSVC ǥ C %s ؼ ٸǷ, ÷  wchar_t ڿ ڴ %ls  ؾ մϴ.
+	 *
+	 * @param buffer ȭ ڿ  Դϴ.
+	 * @param bufferSize  ڸ   ũԴϴ.
+	 * @param format  ڿԴϴ.
+	 * @param ... ڿ Ŀ ϴ Դϴ.
+	 *
+	 * @return ۿ  ڿ ̸ ȯմϴ.  ڴ  ʽϴ.
+	 */
+	std::size_t FormatTo(wchar_t* buffer, std::size_t bufferSize, const wchar_t* format, ...);
+
+
+	/**
+	 * @brief   ȭ ڿ ȣ ۿ ϴ.
+	 *
+	 * @param buffer ȭ ڿ  Դϴ.
+	 * @param bufferSize  ڸ   ũԴϴ.
+	 * @param format  ڿԴϴ.
+	 * @param args ڿ Ŀ ϴ  Դϴ.
+	 *
+	 * @return ۿ  ڿ ̸ ȯմϴ.  ڴ  ʽϴ.
+	 */
+	std::size_t VFormatTo(char* buffer, std::size_t bufferSize, const char* format, va_list args);
+
+
+	/**
+	 * @brief   ȭ ڿ ȣ ۿ ϴ.
+	 *
+	 * @param buffer ȭ ڿ  Դϴ.
+	 * @param bufferSize  ڸ   ũԴϴ.
+	 * @param format  ڿԴϴ.
+	 * @param args ڿ Ŀ ϴ  Դϴ.
+	 *
+	 * @return ۿ  ڿ ̸ ȯմϴ.  ڴ  ʽϴ.
+	 */
+	std::size_t VFormatTo(wchar_t* buffer, std::size_t bufferSize, const wchar_t* format, va_list args);
+
+
 	/**
 	 * @brief ȭ ڿ ȯմϴ.
 	 *
@@ -41,6 +107,7 @@ namespace StringUtils
 	 * @note
 	 * -  ޼ snprintf  Լ üϱ  Դϴ.
 	 * - ڿ ̴ ִ 1024 Դϴ.
+	 * - MSVC ǥ C %s ؼ ٸǷ, ÷  wchar_t ڿ ڴ %ls  ؾ մϴ.
 	 *
 	 * @param format  ڿԴϴ.
 	 * @param ... ڿ Ŀ ϴ Դϴ.
@@ -75,9 +142,39 @@ namespace StringUtils
 
 
 	/**
-	 * @brief char ڿ wchar_t ڿ ȯմϴ.
+	 * @brief Ư ڿ  ؽƮ иϰ, и  ȣ Ϳ ϴ.
 	 *
-	 * @see https://en.cppreference.com/w/cpp/string/multibyte/mbstowcs
+	 * @note
+	 * - ؽƮ   ȸϸ,  뷮 ϴٸ  Ҵ  ʽϴ.
+	 * - и   ؽƮ ŰǷ  ؽƮ  ϸ  ˴ϴ.
+	 *
+	 * @param text и  ڿԴϴ.
+	 * @param delimiter и   ڿԴϴ.  ڿ̸ ؽƮ ü ϳ  ϴ.
+	 * @param outTokens и   Դϴ.  Ҵ ϴ.
+	 */
+	void Split(std::string_view text, std::string_view delimiter, std::vector<std::string_view>& outTokens);
+
+
+	/**
+	 * @brief Ư ڿ  ؽƮ иϰ, и  ȣ Ϳ ϴ.
+	 *
+	 * @note
+	 * - ؽƮ   ȸϸ,  뷮 ϴٸ  Ҵ  ʽϴ.
+	 * - и   ؽƮ ŰǷ  ؽƮ  ϸ  ˴ϴ.
+	 *
+	 * @param text и  ڿԴϴ.
+	 * @param delimiter и   ڿԴϴ.  ڿ̸ ؽƮ ü ϳ  ϴ.
+	 * @param outTokens и   Դϴ.  Ҵ ϴ.
+	 */
+	void Split(std::wstring_view text, std::wstring_view delimiter, std::vector<std::wstring_view>& outTokens);
+
+
+	/**
+	 * @brief UTF-8 char ڿ wchar_t ڿ ȯմϴ.
+	 *
+	 * @note
+	 * - Ͽ  , wchar_t 2Ʈ ÷ UTF-16, 4Ʈ ÷ UTF-32 ȯմϴ.
+	 * - ߸ UTF-8 Ʈ ü (U+FFFD) ȯմϴ.
 	 *
 	 * @param text ȯ ǥ ؽƮԴϴ.
 	 *
@@ -87,9 +184,11 @@ namespace StringUtils
 
 
 	/**
-	 * @brief wchar_t ڿ char ڿ ȯմϴ.
+	 * @brief wchar_t ڿ UTF-8 char ڿ ȯմϴ.
 	 *
-	 * @see https://en.cppreference.com/w/cpp/string/multibyte/wcstombs
+	 * @note
+	 * - Ͽ  , wchar_t 2Ʈ ÷ UTF-16, 4Ʈ ÷ UTF-32 ؼմϴ.
+	 * - ¦  ʴ ΰƮ   ڵ Ʈ ü (U+FFFD) ȯմϴ.
 	 *
 	 * @param text ȯ ǥ ؽƮԴϴ.
 	 *
@@ -191,17 +290,21 @@ namespace StringUtils
 
 
 	/**
-	 * @brief char ڿ  ͸ ϴ.
+	 * @brief   char ڿ  ͸ ϴ.
+	 *
+	 * @note  ũ STRING_BUFFER_SIZE̸,    StringUtils ȣ   ˴ϴ.
 	 *
-	 * @return char ڿ  ͸ ȯմϴ.
+	 * @return   char ڿ  ͸ ȯմϴ.
 	 */
 	char* GetCharBufferPtr();
 
 
 	/**
-	 * @brief wchar_t ڿ  ͸ ϴ.
+	 * @brief   wchar_t ڿ  ͸ ϴ.
+	 *
+	 * @note  ũ STRING_BUFFER_SIZE̸,    StringUtils ȣ   ˴ϴ.
 	 *
-	 * @return wchar_t ڿ  ͸ ȯմϴ.
+	 * @return   wchar_t ڿ  ͸ ȯմϴ.
 	 */
 	wchar_t* GetWideCharBufferPtr();
 };
\ No newline at end of file
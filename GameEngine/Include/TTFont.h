@@ -2,32 +2,37 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <memory>
 
+#include "GlyphAtlas.h"
 #include "IResource.h"
 #include "Vector2.h"
+#include "Vector4.h"
 
 
 /**
- * @brief ؽó Ʋ󽺿 ǥõ ۸Դϴ.
+ * @brief ȣ ִ Ÿ Ʈ ׸ ؽƮ ܰ ׸ ȿԴϴ.
+ *
+ * @note    0̸ ش ȿ  ʽϴ. Ʈ Ʈ  ʽϴ.
  */
-struct Glyph
+struct TextEffect
 {
-	int32_t codePoint;
-	Vector2i position0;
-	Vector2i position1;
-	float xoffset;
-	float yoffset;
-	float xoffset2;
-	float yoffset2;
-	float xadvance;
+	Vector4f outlineColor = Vector4f(0.0f, 0.0f, 0.0f, 0.0f); // ܰ RGBA Դϴ.
+	float outlineThickness = 0.0f;                             // ۸ ؽó Ʋ ȼ  ܰ βԴϴ. Ÿ  ۾ƾ մϴ.
+	Vector4f shadowColor = Vector4f(0.0f, 0.0f, 0.0f, 0.0f);  // ׸ RGBA Դϴ.
+	Vector2f shadowOffset = Vector2f(0.0f, 0.0f);              // ۸ ؽó Ʋ ȼ  ׸ ġԴϴ. Ÿ  ۾ƾ մϴ.
 };
 
 
 /**
  * @brief Ʈ Ÿ Ʈ  εϰ ؽƮ ؽó Ʋ󽺸   մϴ.
  *
- * @note Ʈ Ÿ Ʈ  Ȯڴ .ttf  մϴ.
+ * @note
+ * - Ʈ Ÿ Ʈ  Ȯڴ .ttf  մϴ.
+ * - ȣ ִ Ÿ Ʈ ٸ Ʈ ҽ  Ʋ󽺸 ؼ ٸ ũ ׸  ֽϴ.
+ * - ŷ ۸ ؽó Ʋ󽺴 Ʈ   .atlas Ϸ  ΰ,  ʹ ٽ ŷ ʰ нϴ.
+ * - HEADLESS_MODE Ʈ Ÿ Ʈ   ʰ, ۸ θ ʱȭ   ؽó Ʋ󽺸  ʽϴ.
  */
 class TTFont : public IResource
 {
@@ -54,19 +59,107 @@ public:
 	DISALLOW_COPY_AND_ASSIGN(TTFont);
 
 
+#if !defined(HEADLESS_MODE)
 	/**
 	 * @brief Ʈ Ÿ Ʈ  εϰ ۸ Ʋ󽺸 մϴ.
 	 *
 	 * @param path Ʈ Ÿ Ʈ  Դϴ.
 	 * @param beginCodePoint ۸ ؽó Ʋ ڵ Ʈ Դϴ.
 	 * @param endCodePoint ۸ ؽó Ʋ ڵ Ʈ Դϴ.
-	 * @param fontSize Ʈ ũԴϴ.
+	 * @param fontSize Ʈ ũԴϴ. ȣ ִ Ÿ Ʈ Ÿ   ũԴϴ.
+	 * @param type ۸ ؽó Ʋ Ʈ Դϴ.
 	 *
 	 * @note
 	 * - ۸ ؽó Ʋ  ۰  ڵ Ʈ մϴ.
 	 * - Ʈ Ÿ Ʈ  Ȯڴ .ttf  մϴ.
+	 * -   .atlas   ؽ  Ʈ    ڿ ٸ ŷ ʰ ״ մϴ.
+	 * -    ų ȿ ʴٸ ٽ ŷϰ,   .atlas Ͽ ϴ.
+	 */
+	void Initialize(const std::wstring& path, int32_t beginCodePoint, int32_t endCodePoint, float fontSize, const GlyphAtlas::EType& type = GlyphAtlas::EType::Bitmap);
+
+
+	/**
+	 * @brief Ʈ Ÿ Ʈ Ϸ ۸ ؽó Ʋ󽺸 غմϴ.
+	 *
+	 * @param path Ʈ Ÿ Ʈ  Դϴ.
+	 * @param beginCodePoint ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+	 * @param endCodePoint ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+	 * @param fontSize Ʈ ũԴϴ. ȣ ִ Ÿ Ʈ Ÿ   ũԴϴ.
+	 * @param type ۸ ؽó Ʋ Ʈ Դϴ.
+	 *
+	 * @note
+	 * -    аų ŷϴ CPU ۾ ϹǷ ۾ 忡 ȣ  ֽϴ.
+	 * - غ Ʋ󽺴  忡 Initialize(const GlyphAtlas&) ؽó øϴ.
+	 *
+	 * @return غ ۸ ؽó Ʋ󽺸 ȯմϴ.
+	 */
+	static GlyphAtlas LoadGlyphAtlas(const std::wstring& path, int32_t beginCodePoint, int32_t endCodePoint, float fontSize, const GlyphAtlas::EType& type = GlyphAtlas::EType::Bitmap);
+#endif
+
+
+	/**
+	 * @brief ޸𸮿 ִ Ʈ Ÿ Ʈ   Ʋ󽺷 ۸ ؽó Ʋ󽺸 غմϴ.
+	 *
+	 * @param buffer Ʈ Ÿ Ʈ ҽ Դϴ.   ε ޸𸮸 ״ ѱ  ֽϴ.
+	 * @param bakedBuffer   ۸ ؽó Ʋ Դϴ. ٸ  並 ѱϴ.
+	 * @param beginCodePoint ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+	 * @param endCodePoint ۸ ؽó Ʋ ڵ Ʈ Դϴ.
+	 * @param fontSize Ʈ ũԴϴ. ȣ ִ Ÿ Ʈ Ÿ   ũԴϴ.
+	 * @param type ۸ ؽó Ʋ Ʈ Դϴ.
+	 * @param outGlyphAtlas غ ۸ ؽó ƲԴϴ.
+	 *
+	 * @note
+	 * -   Ʋ  ؽ  Ʈ   ڿ ٸ ŷ ʰ ״ մϴ.
+	 * -  аų  ʴ CPU ۾̹Ƿ ۾  HEADLESS_MODE ȣ  ֽϴ.
+	 *
+	 * @return   Ʋ󽺸 ߴٸ true, ٽ ŷߴٸ false ȯմϴ.
+	 */
+	static bool LoadGlyphAtlasFromBuffer(const BufferView& buffer, const BufferView& bakedBuffer, int32_t beginCodePoint, int32_t endCodePoint, float fontSize, const GlyphAtlas::EType& type, GlyphAtlas& outGlyphAtlas);
+
+
+	/**
+	 * @brief ̸  ۸ ؽó Ʋ󽺷 Ʈ ʱȭմϴ.
+	 *
+	 * @param glyphAtlas ۸ , Ʈ, Ʈ Ʈ  ۸ ؽó ƲԴϴ.
+	 *
+	 * @note HEADLESS_MODE Ʈ  Ƿ Ʈ  ־ ˴ϴ.
+	 */
+	void Initialize(const GlyphAtlas& glyphAtlas);
+
+
+	/**
+	 * @brief ȣ ִ Ÿ Ʈ ۸ ؽó Ʋ󽺸 ؼ ٸ ũ Ʈ ʱȭմϴ.
+	 *
+	 * @param atlasFont ۸ ؽó Ʋ󽺸  ȣ ִ Ÿ ƮԴϴ.
+	 * @param fontSize ׸ Ʈ ũԴϴ.
+	 *
+	 * @note
+	 * - ۸ ؽó Ʋ󽺸   Ƿ, Ʋ󽺸  Ʈ  Ǿ մϴ.
+	 * - Ҵ    ۸ ؽó Ʋ󽺴  ʽϴ.
+	 */
+	void Initialize(const TTFont* atlasFont, float fontSize);
+
+
+	/**
+	 * @brief   ۸ ؽó Ʋ  θ ϴ.
+	 *
+	 * @param path Ʈ Ÿ Ʈ  Դϴ.
+	 * @param fontSize Ʈ ũԴϴ.
+	 * @param type ۸ ؽó Ʋ Ʈ Դϴ.
+	 *
+	 * @return Ʈ ϰ   ִ .atlas  θ ȯմϴ.
 	 */
-	void Initialize(const std::wstring& path, int32_t beginCodePoint, int32_t endCodePoint, float fontSize);
+	static std::wstring GetBakedGlyphAtlasPath(const std::wstring& path, float fontSize, const GlyphAtlas::EType& type);
+
+
+	/**
+	 * @brief Ʈ ũ⿡ ´ ȣ ִ Ÿ Ÿ  ϴ.
+	 *
+	 * @param fontSize Ÿ  Ʈ ũԴϴ.
+	 *
+	 * @return ȼ  Ÿ  ȯմϴ.
+	 */
+	static int32_t GetSignedDistanceFieldRange(float fontSize);
 
 
 	/**
@@ -101,6 +194,80 @@ public:
 	int32_t GetGlyphAtlasSize() const { return glyphAtlasSize_; }
 
 
+	/**
+	 * @brief ۸ ؽó Ʋ Ʈ  ϴ.
+	 *
+	 * @return ۸ ؽó Ʋ Ʈ  ȯմϴ.
+	 */
+	GlyphAtlas::EType GetType() const { return type_; }
+
+
+	/**
+	 * @brief ȣ ִ Ÿ Ÿ  ϴ.
+	 *
+	 * @return ۸ ؽó Ʋ ȼ  Ÿ  ȯմϴ. Ʈ Ʈ 0Դϴ.
+	 */
+	int32_t GetDistanceRange() const { return distanceRange_; }
+
+
+	/**
+	 * @brief Ʈ ũ⸦ ϴ.
+	 *
+	 * @return Ʈ ũ⸦ ȯմϴ.
+	 */
+	float GetFontSize() const { return fontSize_; }
+
+
+	/**
+	 * @brief ۸ ؽó Ʋ ũ⿡  Ʈ ũ  ϴ.
+	 *
+	 * @return ۸ ؽó Ʋ ũ⿡  Ʈ ũ  ȯմϴ. Ʈ Ʈ ׻ 1Դϴ.
+	 */
+	float GetScale() const { return scale_; }
+
+
+	/**
+	 * @brief ؽƮ ܰ ׸ ȿ ϴ.
+	 *
+	 * @return ؽƮ ܰ ׸ ȿ ȯմϴ.
+	 */
+	const TextEffect& GetTextEffect() const { return textEffect_; }
+
+
+	/**
+	 * @brief ؽƮ ܰ ׸ ȿ մϴ.
+	 *
+	 * @param textEffect  ܰ ׸ ȿԴϴ.
+	 *
+	 * @note ȣ ִ Ÿ Ʈ ˴ϴ.
+	 */
+	void SetTextEffect(const TextEffect& textEffect) { textEffect_ = textEffect; }
+
+
+	/**
+	 * @brief ؼ   ۸ ʱ Ÿ ϴ.
+	 *
+	 * @return ؼ   ۸ ʱ ȼ  Ÿ ȯմϴ.
+	 */
+	float GetAscent() const { return ascent_; }
+
+
+	/**
+	 * @brief ؼ   ۸ Ʒʱ Ÿ ϴ.
+	 *
+	 * @return ؼ   ۸ Ʒʱ ȼ  Ÿ ȯմϴ.  Դϴ.
+	 */
+	float GetDescent() const { return descent_; }
+
+
+	/**
+	 * @brief    ϴ.
+	 *
+	 * @return   ȼ   ȯմϴ.
+	 */
+	float GetLineGap() const { return lineGap_; }
+
+
 	/**
 	 * @brief ڵ Ʈ ȿ Ȯմϴ.
 	 *
@@ -120,34 +287,11 @@ public:
 	 * @param outWidth  ؽƮ  ũԴϴ.
 	 * @param outHeight  ؽƮ  ũԴϴ.
 	 */
-	void MeasureText(const std::wstring& text, float& outWidth, float& outHeight) const;
+	void MeasureText(std::wstring_view text, float& outWidth, float& outHeight) const;
 
 
 private:
-	/**
-	 * @brief ۸ ؽó Ʋ Ʈ մϴ.
-	 *
-	 * @note ۸ ؽó Ʋ   ũ ϴ.
-	 *
-	 * @param buffer Ʈ Ÿ Ʈ ҽ Դϴ.
-	 * @param beginCodePoint  ؽó Ʋ ڵ Ʈ Դϴ.
-	 * @param endCodePoint  ؽó Ʋ ڵ Ʈ Դϴ.
-	 * @param fontSize Ʈ ũԴϴ.
-	 * @param outGlyphs ؽó Ʋ  ڵ Ʈ ϴ  ġ  ũ Դϴ.
-	 * @param outGlyphAtlasSize ۸ ؽó Ʋ ũԴϴ.
-	 *
-	 * @return  ۸ ؽó Ʋ Ʈ ȯմϴ.
-	 */
-	std::shared_ptr<uint8_t[]> GenerateGlyphAtlasBitmap(
-		const std::vector<uint8_t>& buffer,
-		int32_t beginCodePoint,
-		int32_t endCodePoint,
-		float fontSize,
-		std::vector<Glyph>& outGlyphs,
-		int32_t& outGlyphAtlasSize
-	);
-
-
+#if !defined(HEADLESS_MODE)
 	/**
 	 * @brief ؽó Ʋ Ʈ  ؽó ҽ մϴ.
 	 *
@@ -157,9 +301,10 @@ private:
 	 * @return ؽó ҽ ID  ȭմϴ.
 	 */
 	uint32_t CreateGlyphAtlasFromBitmap(
-		const std::shared_ptr<uint8_t[]>& bitmap,
+		const uint8_t* bitmap,
 		const int32_t& glyphAtlasSize
 	);
+#endif
 
 
 private:
@@ -185,6 +330,24 @@ private:
 	int32_t glyphAtlasSize_ = 0;
 
 
+	/**
+	 * @brief ؼ   ۸ ʱ ȼ  ŸԴϴ.
+	 */
+	float ascent_ = 0.0f;
+
+
+	/**
+	 * @brief ؼ   ۸ Ʒʱ ȼ  ŸԴϴ.
+	 */
+	float descent_ = 0.0f;
+
+
+	/**
+	 * @brief   ȼ  Դϴ.
+	 */
+	float lineGap_ = 0.0f;
+
+
 	/**
 	 * @brief ۸ ؽó Ʋ  ڵ Ʈ ϴ  ġ  ũ Դϴ.
 	 */
@@ -195,4 +358,42 @@ private:
 	 * @brief ۸ ؽó Ʋ IDԴϴ.
 	 */
 	uint32_t glyphAtlasID_ = 0;
+
+
+	/**
+	 * @brief ۸ ؽó Ʋ󽺸  Ʈ ߴ Ȯմϴ.
+	 *
+	 * @note ٸ Ʈ Ʋ󽺸 Ѵٸ falseԴϴ.
+	 */
+	bool bIsAtlasOwner_ = false;
+
+
+	/**
+	 * @brief ۸ ؽó Ʋ Ʈ Դϴ.
+	 */
+	GlyphAtlas::EType type_ = GlyphAtlas::EType::Bitmap;
+
+
+	/**
+	 * @brief ȣ ִ Ÿ ۸ ؽó Ʋ ȼ  Ÿ Դϴ.
+	 */
+	int32_t distanceRange_ = 0;
+
+
+	/**
+	 * @brief Ʈ ũԴϴ.
+	 */
+	float fontSize_ = 0.0f;
+
+
+	/**
+	 * @brief ۸ ؽó Ʋ ũ⿡  Ʈ ũ Դϴ.
+	 */
+	float scale_ = 1.0f;
+
+
+	/**
+	 * @brief ؽƮ ܰ ׸ ȿԴϴ.
+	 */
+	TextEffect textEffect_;
 };
\ No newline at end of file
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Macro.h"
+#include "Vector2.h"
+#include "Vector3.h"
+
+class TTFont; // TTFont ϱ   Դϴ.
+
+
+/**
+ * @brief ۸ 簢   ũ⸦ ϴ ؽƮ ̾ƿԴϴ.
+ *
+ * @note
+ * - Ʈ, ؽƮ, ߽ ǥ ٲ   ٽ  GPU ۿ ٽ ϴ.
+ * - ̾ƿ  ۸ Ƿ ׸       εմϴ.
+ * -  GlyphShader2D  ׸ ο Ʈ  ϴ.
+ * - HEADLESS_MODE GPU ۸  ʰ  մϴ.
+ */
+class TextLayout
+{
+public:
+	/**
+	 * @brief ۸ 簢 Դϴ.
+	 */
+	struct GlyphVertex
+	{
+		/**
+		 * @brief  Ʈ   ϴ.
+		 *
+		 * @return  Ʈ (Stride)  ȯմϴ.
+		 */
+		static uint32_t GetStride()
+		{
+			return sizeof(GlyphVertex);
+		}
+
+
+		Vector3f position; //   ǥ ġԴϴ.
+		Vector2f texture;  //  ۸ ؽó Ʋ ǥԴϴ.
+	};
+
+
+public:
+	/**
+	 * @brief ؽƮ ̾ƿ Ʈ Դϴ.
+	 */
+	TextLayout() = default;
+
+
+	/**
+	 * @brief ؽƮ ̾ƿ  ҸԴϴ.
+	 *
+	 * @note GPU ۰  ִٸ Ҵ մϴ.
+	 */
+	virtual ~TextLayout();
+
+
+	/**
+	 * @brief ؽƮ ̾ƿ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(TextLayout);
+
+
+	/**
+	 * @brief ̾ƿ Է ϰ, Է ٲٸ ۸  ٽ ϴ.
+	 *
+	 * @param font Ʈ ҽԴϴ.
+	 * @param text ġ ؽƮԴϴ.
+	 * @param center ؽƮ ߽ ǥԴϴ.
+	 *
+	 * @return ۸  ٽ ٸ true, Է Ƽ ĳø ߴٸ false ȯմϴ.
+	 */
+	bool Update(const TTFont* font, std::wstring_view text, const Vector2f& center);
+
+
+	/**
+	 * @brief ٽ  ۸  GPU ۿ ϴ.
+	 *
+	 * @note
+	 * -  ٲ ʾҴٸ ƹ͵  ʽϴ.
+	 * - ó ȣ   ۿ    մϴ.
+	 */
+	void Upload();
+
+
+	/**
+	 * @brief ؽƮ ̾ƿ GPU ۸ Ҵ մϴ.
+	 *
+	 * @note ĳõ Է°  Ƿ,  Update ٽ ϴ.
+	 */
+	void Release();
+
+
+	/**
+	 * @brief ؽƮ ۸ 簢  ϴ.
+	 *
+	 * @param font Ʈ ҽԴϴ.
+	 * @param text ġ ؽƮԴϴ.
+	 * @param center ؽƮ ߽ ǥԴϴ.
+	 * @param outVertices   Դϴ.  ϳ  6 ʿմϴ.
+	 * @param outWidth  ؽƮ  ũԴϴ.
+	 * @param outHeight  ؽƮ  ũԴϴ.
+	 *
+	 * @return ۿ    ȯմϴ.
+	 */
+	static uint32_t GenerateGlyphVertices(const TTFont* font, std::wstring_view text, const Vector2f& center, GlyphVertex* outVertices, float& outWidth, float& outHeight);
+
+
+	/**
+	 * @brief ̾ƿ Ʈ ҽ ϴ.
+	 *
+	 * @return ̾ƿ Ʈ ҽ ȯմϴ.
+	 */
+	const TTFont* GetFont() const { return font_; }
+
+
+	/**
+	 * @brief ̾ƿ ؽƮ ϴ.
+	 *
+	 * @return ̾ƿ ؽƮ ȯմϴ.
+	 */
+	const std::wstring& GetText() const { return text_; }
+
+
+	/**
+	 * @brief  ؽƮ  ũ⸦ ϴ.
+	 *
+	 * @return  ؽƮ  ũ⸦ ȯմϴ.
+	 */
+	float GetWidth() const { return width_; }
+
+
+	/**
+	 * @brief  ؽƮ  ũ⸦ ϴ.
+	 *
+	 * @return  ؽƮ  ũ⸦ ȯմϴ.
+	 */
+	float GetHeight() const { return height_; }
+
+
+	/**
+	 * @brief ĳõ ۸   ϴ.
+	 *
+	 * @return ĳõ ۸    ڸ ȯմϴ.
+	 */
+	const std::vector<GlyphVertex>& GetVertices() const { return vertices_; }
+
+
+	/**
+	 * @brief    Ʈ ϴ.
+	 *
+	 * @return    Ʈ ȯմϴ. Upload ȣϱ ̶ 0 ȯմϴ.
+	 */
+	uint32_t GetVertexArrayObject() const { return vertexArrayObject_; }
+
+
+	/**
+	 * @brief ۸  ٽ  Ƚ ϴ.
+	 *
+	 * @return ۸  ٽ  Ƚ ȯմϴ.
+	 */
+	uint64_t GetCountOfBuild() const { return countOfBuild_; }
+
+
+	/**
+	 * @brief GPU ۿ    ִ Ȯմϴ.
+	 *
+	 * @return GPU ۿ    ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsDirty() const { return bIsDirty_; }
+
+
+private:
+	/**
+	 * @brief ̾ƿ Ʈ ҽԴϴ.
+	 */
+	const TTFont* font_ = nullptr;
+
+
+	/**
+	 * @brief ̾ƿ ؽƮԴϴ.
+	 */
+	std::wstring text_;
+
+
+	/**
+	 * @brief ؽƮ ߽ ǥԴϴ.
+	 */
+	Vector2f center_;
+
+
+	/**
+	 * @brief  ؽƮ  ũԴϴ.
+	 */
+	float width_ = 0.0f;
+
+
+	/**
+	 * @brief  ؽƮ  ũԴϴ.
+	 */
+	float height_ = 0.0f;
+
+
+	/**
+	 * @brief ĳõ ۸  Դϴ.
+	 */
+	std::vector<GlyphVertex> vertices_;
+
+
+	/**
+	 * @brief GPU ۿ    ִ Ȯմϴ.
+	 */
+	bool bIsDirty_ = false;
+
+
+	/**
+	 * @brief ۸  ٽ  ȽԴϴ.
+	 */
+	uint64_t countOfBuild_ = 0;
+
+
+	/**
+	 * @brief  ۿ Ҵ  Դϴ.
+	 */
+	uint32_t vertexBufferCapacity_ = 0;
+
+
+	/**
+	 * @brief   ƮԴϴ.
+	 */
+	uint32_t vertexBufferObject_ = 0;
+
+
+	/**
+	 * @brief    ƮԴϴ.
+	 */
+	uint32_t vertexArrayObject_ = 0;
+};
\ No newline at end of file
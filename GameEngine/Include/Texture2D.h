@@ -2,6 +2,7 @@
 
 #include <string>
 
+#include "BufferView.h"
 #include "IResource.h"
 
 
@@ -50,10 +51,22 @@ public:
 	 * - ASTC   Ȯڴ .astc Ǿ ־ մϴ.
 	 * - DXT   ݵ texconv.exe ̿ؼ  ̿ մϴ.
 	 * - DXT   Ȯڴ .dds Ǿ ־ մϴ.
+	 * -  Ŀ ̸  Ӹ ü .mips Ȯڷ Ǿ ־ մϴ.
 	 */
 	void Initialize(const std::wstring& path);
 
 
+	/**
+	 * @brief ޸𸮿 ִ ̹   ؽó ҽ մϴ.
+	 *
+	 * @param path ̹   Ȥ    ̸Դϴ. Ȯڿ  ̸  Ǻմϴ.
+	 * @param buffer ̹  Դϴ.   ε ޸𸮸 ״ ѱ  ֽϴ.
+	 *
+	 * @note  ؽó ۸  ʰ ״ ؽó øϴ.
+	 */
+	void Initialize(const std::wstring& path, const BufferView& buffer);
+
+
 	/**
 	 * @brief ؽó  ҽ Ҵ մϴ.
 	 */
@@ -73,30 +86,46 @@ private:
 	 * @brief  ؽó ҽ մϴ.
 	 * 
 	 * @param path ̹  Դϴ.
+	 * @param buffer ̹  Դϴ.
 	 * 
 	 * @return ؽó ҽ ID ȯմϴ.
 	 */
-	uint32_t CreateNonCompressionTexture(const std::wstring& path);
+	uint32_t CreateNonCompressionTexture(const std::wstring& path, const BufferView& buffer);
 
 
 	/**
 	 * @brief ASTC  ؽó ҽ մϴ.
 	 * 
 	 * @param path ̹  Դϴ.
+	 * @param buffer ̹  Դϴ.
 	 *
 	 * @return ؽó ҽ ID ȯմϴ.
 	 */
-	uint32_t CreateAstcCompressionTexture(const std::wstring& path);
+	uint32_t CreateAstcCompressionTexture(const std::wstring& path, const BufferView& buffer);
 
 
 	/**
 	 * @brief DXT  ؽó ҽ մϴ.
 	 * 
 	 * @param path ̹  Դϴ.
+	 * @param buffer ̹  Դϴ.
+	 * 
+	 * @return ؽó ҽ ID ȯմϴ.
+	 */
+	uint32_t CreateDxtCompressionTexture(const std::wstring& path, const BufferView& buffer);
+
+
+	/**
+	 * @brief ̸  Ӹ ü  ؽó ҽ մϴ.
+	 * 
+	 * @param path Ӹ ü  Դϴ.
+	 * @param buffer Ӹ ü  Դϴ.
 	 * 
 	 * @return ؽó ҽ ID ȯմϴ.
+	 *
+	 * @note glGenerateMipmap ȣ ʰ   ״ øϴ.
 	 */
-	uint32_t CreateDxtCompressionTexture(const std::wstring& path);
+	uint32_t CreateMipChainTexture(const std::wstring& path, const BufferView& buffer);
 
 
 private:
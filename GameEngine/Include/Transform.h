@@ -204,6 +204,20 @@ public:
 	void SetProperties(const Vector3f& location, const Vector3f& rotate, const Vector3f& scale);
 
 
+	/**
+	 * @brief  Ʈ ġ, ȸ, ũ⸦  մϴ.
+	 *
+	 * @param start   ƮԴϴ.
+	 * @param end   ƮԴϴ.
+	 * @param t  Դϴ. 0̸  Ʈ, 1̸  ƮԴϴ.
+	 *
+	 * @return   Ʈ ȯմϴ.
+	 *
+	 * @note   ŵǴ Ʈ      մϴ.
+	 */
+	static Transform Interpolate(const Transform& start, const Transform& end, float t);
+
+
 private:
 	/**
 	 * @brief   մϴ.
@@ -5,6 +5,7 @@
 
 #include "IObject.h"
 #include "InputManager.h"
+#include "TextLayout.h"
 #include "Vector2.h"
 #include "Vector3.h"
 #include "Vector4.h"
@@ -310,6 +311,14 @@ private:
     TTFont* font_;
 
 
+    /**
+     * @brief UI Ű ư Ʈ ؽƮ ġ ؽƮ ̾ƿԴϴ.
+     *
+     * @note ؽƮ, Ʈ, ߽ ǥ ٲ  ۸  ٽ ϴ.
+     */
+    TextLayout textLayout_;
+
+
     /**
      * @brief UI Ű ư Ʈ ܰ Դϴ.
      */
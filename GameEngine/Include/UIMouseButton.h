@@ -5,6 +5,7 @@
 
 #include "IObject.h"
 #include "InputManager.h"
+#include "TextLayout.h"
 #include "Vector2.h"
 #include "Vector3.h"
 #include "Vector4.h"
@@ -377,6 +378,14 @@ private:
 	TTFont* font_;
 
 
+	/**
+	 * @brief UI ư Ʈ ؽƮ ġ ؽƮ ̾ƿԴϴ.
+	 *
+	 * @note ؽƮ, Ʈ, ߽ ǥ ٲ  ۸  ٽ ϴ.
+	 */
+	TextLayout textLayout_;
+
+
 	/**
 	 * @brief UI ư Ʈ ܰ Դϴ.
 	 */
@@ -3,6 +3,7 @@
 #include <string>
 
 #include "IObject.h"
+#include "TextLayout.h"
 #include "Vector2.h"
 #include "Vector3.h"
 #include "Vector4.h"
@@ -306,6 +307,14 @@ protected:
 	TTFont* font_;
 
 
+	/**
+	 * @brief UI г Ʈ ؽƮ ġ ؽƮ ̾ƿԴϴ.
+	 *
+	 * @note ؽƮ, Ʈ, ߽ ǥ ٲ  ۸  ٽ ϴ.
+	 */
+	TextLayout textLayout_;
+
+
 	/**
 	 * @brief UI г Ʈ ܰ Դϴ.
 	 */
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Matrix4x4.h"
+#include "Vector3.h"
+
+class Camera3D; // ī޶ Ʈ ϱ  漱 Դϴ.
+class Light;    // Ʈ Ʈ ϱ  漱 Դϴ.
+class Material; // ͸ ҽ ϱ  漱 Դϴ.
+
+
+/**
+ * @brief std140 ̾ƿ Ʈ üԴϴ. ̴ Light ü   մϴ.
+ *
+ * @note std140 vec3 16Ʈ 迡 ̹Ƿ,   ڿ 4Ʈ е Ӵϴ. ü ũ 80ƮԴϴ.
+ */
+struct LightUniform
+{
+	Vector3f position;    //  0Դϴ.
+	float padding0;       //  12Դϴ.
+	Vector3f direction;   //  16Դϴ.
+	float padding1;       //  28Դϴ.
+	Vector3f ambientRGB;  //  32Դϴ.
+	float padding2;       //  44Դϴ.
+	Vector3f diffuseRGB;  //  48Դϴ.
+	float padding3;       //  60Դϴ.
+	Vector3f specularRGB; //  64Դϴ.
+	float padding4;       //  76Դϴ.
+};
+
+
+/**
+ * @brief Ӹ    std140 ̾ƿ  Դϴ. ̴ FrameBlock   մϴ.
+ *
+ * @note
+ * - Ʈ ̴ ε ̴  ε  ϹǷ, ̴ ī޶ Ʈ  ʽϴ.
+ * -     ϸ, ġ ʰ  ̴     ȯ ˴ϴ.
+ * -  ũ 288ƮԴϴ.
+ */
+struct FrameUniformBlock
+{
+	/**
+	 * @brief ̴ FrameBlock ϴ ε Դϴ.
+	 */
+	static const uint32_t BINDING = 0;
+
+
+	/**
+	 * @brief ī޶ Ʈ    մϴ.
+	 *
+	 * @param camera þ ,  ,  ġ  ī޶Դϴ.
+	 * @param light Ʈ  ȯ Ʈ   ƮԴϴ.
+	 *
+	 * @return     ȯմϴ.
+	 */
+	static FrameUniformBlock Create(const Camera3D* camera, const Light* light);
+
+
+	Matrix4x4f view;                //  0Դϴ.
+	Matrix4x4f projection;          //  64Դϴ.
+	Matrix4x4f lightViewProjection; //  128Դϴ. Ʈ þ İ   ̸  Դϴ.
+	Vector3f viewPosition;          //  192Դϴ.
+	float padding0;                 //  204Դϴ.
+	LightUniform light;             //  208Դϴ. ü 16Ʈ 迡 Դϴ.
+};
+
+
+/**
+ * @brief Ƽ󸶴  std140 ̾ƿ  Դϴ. ̴ MaterialBlock   մϴ.
+ *
+ * @note  vec3   4Ʈ float Ƿ, shininess е   44 Դϴ.  ũ 48ƮԴϴ.
+ */
+struct MaterialUniformBlock
+{
+	/**
+	 * @brief ̴ MaterialBlock ϴ ε Դϴ.
+	 */
+	static const uint32_t BINDING = 1;
+
+
+	/**
+	 * @brief Ƽ Ƽ   մϴ.
+	 *
+	 * @param material    ƼԴϴ.
+	 *
+	 * @return  Ƽ   ȯմϴ.
+	 */
+	static MaterialUniformBlock Create(const Material* material);
+
+
+	Vector3f ambientRGB;  //  0Դϴ.
+	float padding0;       //  12Դϴ.
+	Vector3f diffuseRGB;  //  16Դϴ.
+	float padding1;       //  28Դϴ.
+	Vector3f specularRGB; //  32Դϴ.
+	float shininess;      //  44Դϴ.
+};
\ No newline at end of file
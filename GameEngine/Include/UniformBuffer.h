@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Assertion.h"
+#include "IResource.h"
+
+
+/**
+ * @brief ̴  Ͽ ͸ ϴ   ҽԴϴ.
+ *
+ * @note
+ * -  ũ    ϳ GPU ۿ , Bind   ϳ ε  մϴ.
+ * -    GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT  ϴ.
+ * - HEADLESS_MODE GPU ۸  ʰ  ũ ݸ մϴ.
+ */
+class UniformBuffer : public IResource
+{
+public:
+	/**
+	 * @brief   Ʈ Դϴ.
+	 *
+	 * @note  ̿ ޼忡  ʱȭ ؾ մϴ.
+	 */
+	UniformBuffer() = default;
+
+
+	/**
+	 * @brief    ҸԴϴ.
+	 *
+	 * @note   ο Ҵ Ҹ ϱ ؼ ݵ Release ȣؾ մϴ.
+	 */
+	virtual ~UniformBuffer();
+
+
+	/**
+	 * @brief    ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(UniformBuffer);
+
+
+	/**
+	 * @brief  ۸ մϴ.
+	 *
+	 * @param binding   ̴ ε Դϴ.
+	 * @param blockSize  ϳ Ʈ ũԴϴ.
+	 * @param countOfBlock ۿ   Դϴ.
+	 */
+	void Initialize(uint32_t binding, uint32_t blockSize, uint32_t countOfBlock);
+
+
+	/**
+	 * @brief    ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief  ϳ GPU ۿ ϴ.
+	 *
+	 * @param index   εԴϴ.
+	 * @param data  ũ⸸ŭ Դϴ.
+	 *
+	 * @note HEADLESS_MODE ε ˻մϴ.
+	 */
+	void SetBlock(uint32_t index, const void* data);
+
+
+	/**
+	 * @brief  ü ϳ GPU ۿ ϴ.
+	 *
+	 * @param index   εԴϴ.
+	 * @param block  ũ  ũ üԴϴ.
+	 */
+	template <typename TBlock>
+	void SetBlock(uint32_t index, const TBlock& block)
+	{
+		ASSERT(sizeof(TBlock) == blockSize_, "uniform block size mismatch...");
+		SetBlock(index, reinterpret_cast<const void*>(&block));
+	}
+
+
+	/**
+	 * @brief  ϳ ̴ ε  մϴ.
+	 *
+	 * @param index   εԴϴ.
+	 */
+	void Bind(uint32_t index) const;
+
+
+	/**
+	 * @brief  ũ⸦     øϴ.
+	 *
+	 * @param blockSize  ϳ Ʈ ũԴϴ.
+	 * @param alignment   Դϴ.
+	 *
+	 * @return    ø    ȯմϴ.
+	 */
+	static uint32_t GetAlignedSize(uint32_t blockSize, uint32_t alignment);
+
+
+	/**
+	 * @brief ̴ ε  ϴ.
+	 *
+	 * @return ̴ ε  ȯմϴ.
+	 */
+	uint32_t GetBinding() const { return binding_; }
+
+
+	/**
+	 * @brief  ϳ Ʈ ũ⸦ ϴ.
+	 *
+	 * @return  ϳ Ʈ ũ⸦ ȯմϴ.
+	 */
+	uint32_t GetBlockSize() const { return blockSize_; }
+
+
+	/**
+	 * @brief   Ʈ  ϴ.
+	 *
+	 * @return   Ʈ  ȯմϴ.
+	 */
+	uint32_t GetBlockStride() const { return blockStride_; }
+
+
+	/**
+	 * @brief ۿ   ִ   ϴ.
+	 *
+	 * @return ۿ   ִ   ȯմϴ.
+	 */
+	uint32_t GetCountOfBlock() const { return countOfBlock_; }
+
+
+private:
+	/**
+	 * @brief ̴ ε Դϴ.
+	 */
+	uint32_t binding_ = 0;
+
+
+	/**
+	 * @brief  ϳ Ʈ ũԴϴ.
+	 */
+	uint32_t blockSize_ = 0;
+
+
+	/**
+	 * @brief   Ʈ Դϴ.
+	 */
+	uint32_t blockStride_ = 0;
+
+
+	/**
+	 * @brief ۿ   ִ  Դϴ.
+	 */
+	uint32_t countOfBlock_ = 0;
+
+
+	/**
+	 * @brief GPU    ƮԴϴ.
+	 */
+	uint32_t uniformBufferObject_ = 0;
+};
\ No newline at end of file
@@ -325,7 +325,7 @@ struct Vector3
 	 * @note
 	 * - x, y, z ַ   ǥ Ÿ  մϴ.
 	 * - r, g, b ַ  Ÿ  մϴ.
-	 * - s, t, r ַ ؽó ǥ Ÿ  մϴ(OpenGL ).
+	 * - s, t, p ַ ؽó ǥ Ÿ  մϴ(OpenGL ).
 	 */
 	union
 	{
@@ -345,7 +345,7 @@ struct Vector3
 		{
 			T s;
 			T t;
-			T r;
+			T p;
 		};
 		T data[3];
 	};
@@ -340,7 +340,7 @@ struct Vector4
 	 * @note
 	 * - x, y, z, w ַ   ǥ Ÿ  մϴ.
 	 * - r, g, b, a ַ  Ÿ  մϴ.
-	 * - s, t, r, q ַ ؽó ǥ Ÿ  մϴ(OpenGL ).
+	 * - s, t, p, q ַ ؽó ǥ Ÿ  մϴ(OpenGL ).
 	 */
 	union
 	{
@@ -362,7 +362,7 @@ struct Vector4
 		{
 			T s;
 			T t;
-			T r;
+			T p;
 			T q;
 		};
 		T data[4];
@@ -8,8 +8,51 @@ layout(binding = 0) uniform sampler2D glyphAtlasMap;
 
 uniform vec4 glyphColor;
 
+uniform bool bIsSignedDistanceField;
+uniform float distanceScale; // 0.0f ~ 1.0f texel value per glyph atlas pixel...
+uniform vec4 outlineColor;
+uniform float outlineThickness; // glyph atlas pixel...
+uniform vec4 shadowColor;
+uniform vec2 shadowOffset; // texture coordinates...
+
+const float ON_EDGE_VALUE = 128.0f / 255.0f;
+
+float ComputeCoverage(float distance, float edge)
+{
+	float smoothing = max(fwidth(distance), 1.0e-4f);
+	return smoothstep(edge - smoothing, edge + smoothing, distance);
+}
+
+vec4 BlendOver(vec4 src, vec4 dst)
+{
+	float alpha = src.a + dst.a * (1.0f - src.a);
+	vec3 color = (src.rgb * src.a + dst.rgb * dst.a * (1.0f - src.a)) / max(alpha, 1.0e-4f);
+	return vec4(color, alpha);
+}
+
 void main()
 {
-	float alpha = glyphColor.a * texture(glyphAtlasMap, inTexCoords).r;
-	outColor = vec4(glyphColor.rgb, alpha);
+	if (!bIsSignedDistanceField)
+	{
+		float alpha = glyphColor.a * texture(glyphAtlasMap, inTexCoords).r;
+		outColor = vec4(glyphColor.rgb, alpha);
+		return;
+	}
+
+	float distance = texture(glyphAtlasMap, inTexCoords).r;
+	float outlineEdge = ON_EDGE_VALUE - outlineThickness * distanceScale;
+
+	vec4 color = vec4(shadowColor.rgb, 0.0f);
+	if (shadowColor.a > 0.0f)
+	{
+		float shadowDistance = texture(glyphAtlasMap, inTexCoords - shadowOffset).r;
+		color.a = shadowColor.a * ComputeCoverage(shadowDistance, min(outlineEdge, ON_EDGE_VALUE));
+	}
+
+	if (outlineColor.a > 0.0f)
+	{
+		color = BlendOver(vec4(outlineColor.rgb, outlineColor.a * ComputeCoverage(distance, outlineEdge)), color);
+	}
+
+	outColor = BlendOver(vec4(glyphColor.rgb, glyphColor.a * ComputeCoverage(distance, ON_EDGE_VALUE)), color);
 }
\ No newline at end of file
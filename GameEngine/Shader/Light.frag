@@ -25,13 +25,23 @@ struct Light // Directional Light...
 	vec3 specularRGB;
 };
 
+layout(std140, binding = 0) uniform FrameBlock // FrameUniformBlock in UniformBlock.h...
+{
+	mat4 view;
+	mat4 projection;
+	mat4 lightViewProjection;
+	vec3 viewPosition;
+	Light light;
+};
+
+layout(std140, binding = 1) uniform MaterialBlock // MaterialUniformBlock in UniformBlock.h...
+{
+	Material material;
+};
+
 float ComputeShadow(vec4 worldPositionInLightSpace);
 vec3 ComputeLight(in Light light, in Material material, in vec3 normal, in vec3 worldPosition, in vec3 viewDirection, in vec4 worldPositionInLightSpace);
 
-uniform vec3 viewPosition;
-uniform Material material;
-uniform Light light;
-
 void main()
 {
 	vec3 norm = normalize(inNormal);
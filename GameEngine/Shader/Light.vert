@@ -7,17 +7,31 @@ layout(location = 0) out vec3 outWorldPosition;
 layout(location = 1) out vec3 outNormal;
 layout(location = 2) out vec4 outWorldPositionInLightSpace;
 
+struct Light // Directional Light...
+{
+	vec3 position;
+	vec3 direction;
+	vec3 ambientRGB;
+	vec3 diffuseRGB;
+	vec3 specularRGB;
+};
+
+layout(std140, binding = 0) uniform FrameBlock // FrameUniformBlock in UniformBlock.h...
+{
+	mat4 view;
+	mat4 projection;
+	mat4 lightViewProjection;
+	vec3 viewPosition;
+	Light light;
+};
+
 uniform mat4 world;
-uniform mat4 view;
-uniform mat4 projection;
-uniform mat4 lightView;
-uniform mat4 lightProjection;
 
 void main()
 {
 	outWorldPosition = vec3(world * vec4(inPosition, 1.0f));
 	outNormal = mat3(transpose(inverse(world))) * inNormal;
-	outWorldPositionInLightSpace = lightProjection * lightView * vec4(outWorldPosition, 1.0f);
+	outWorldPositionInLightSpace = lightViewProjection * vec4(outWorldPosition, 1.0f);
 	
 	gl_Position = projection * view * world * vec4(inPosition, 1.0f);
 }
\ No newline at end of file
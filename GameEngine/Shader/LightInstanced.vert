@@ -0,0 +1,36 @@
+#version 460 core
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+layout(location = 3) in vec4 inInstance; // xyz : world position, w : uniform scale...
+
+layout(location = 0) out vec3 outWorldPosition;
+layout(location = 1) out vec3 outNormal;
+layout(location = 2) out vec4 outWorldPositionInLightSpace;
+
+struct Light // Directional Light...
+{
+	vec3 position;
+	vec3 direction;
+	vec3 ambientRGB;
+	vec3 diffuseRGB;
+	vec3 specularRGB;
+};
+
+layout(std140, binding = 0) uniform FrameBlock // FrameUniformBlock in UniformBlock.h...
+{
+	mat4 view;
+	mat4 projection;
+	mat4 lightViewProjection;
+	vec3 viewPosition;
+	Light light;
+};
+
+void main()
+{
+	outWorldPosition = inInstance.xyz + inInstance.w * inPosition;
+	outNormal = inNormal;
+	outWorldPositionInLightSpace = lightViewProjection * vec4(outWorldPosition, 1.0f);
+	
+	gl_Position = projection * view * vec4(outWorldPosition, 1.0f);
+}
\ No newline at end of file
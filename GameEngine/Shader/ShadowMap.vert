@@ -2,11 +2,27 @@
 
 layout(location = 0) in vec3 inPosition;
 
+struct Light // Directional Light...
+{
+	vec3 position;
+	vec3 direction;
+	vec3 ambientRGB;
+	vec3 diffuseRGB;
+	vec3 specularRGB;
+};
+
+layout(std140, binding = 0) uniform FrameBlock // FrameUniformBlock in UniformBlock.h...
+{
+	mat4 view;
+	mat4 projection;
+	mat4 lightViewProjection;
+	vec3 viewPosition;
+	Light light;
+};
+
 uniform mat4 world;
-uniform mat4 lightView;
-uniform mat4 lightProjection;
 
 void main()
 {
-	gl_Position = lightProjection * lightView * world * vec4(inPosition, 1.0f);
+	gl_Position = lightViewProjection * world * vec4(inPosition, 1.0f);
 }
\ No newline at end of file
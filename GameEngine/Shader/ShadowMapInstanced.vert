@@ -0,0 +1,27 @@
+#version 460 core
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 3) in vec4 inInstance; // xyz : world position, w : uniform scale...
+
+struct Light // Directional Light...
+{
+	vec3 position;
+	vec3 direction;
+	vec3 ambientRGB;
+	vec3 diffuseRGB;
+	vec3 specularRGB;
+};
+
+layout(std140, binding = 0) uniform FrameBlock // FrameUniformBlock in UniformBlock.h...
+{
+	mat4 view;
+	mat4 projection;
+	mat4 lightViewProjection;
+	vec3 viewPosition;
+	Light light;
+};
+
+void main()
+{
+	gl_Position = lightViewProjection * vec4(inInstance.xyz + inInstance.w * inPosition, 1.0f);
+}
\ No newline at end of file
@@ -0,0 +1,728 @@
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "AssetPack.h"
+#include "Assertion.h"
+#include "StringId.h"
+#include "StringUtils.h"
+
+
+/**
+ * @brief    ĺ Դϴ. 'APAK'Դϴ.
+ */
+static const uint32_t ASSET_PACK_MAGIC = 0x4B415041;
+
+
+/**
+ * @brief     Դϴ.
+ *
+ * @note   ٲ   ÷   ȿȭմϴ.
+ */
+static const uint32_t ASSET_PACK_VERSION = 1;
+
+
+/**
+ * @brief     ũԴϴ.
+ *
+ * @note ε ޸𸮸 ״ ؽó   ü ؼ  ֵ   մϴ.
+ */
+static const uint64_t ASSET_PACK_ALIGNMENT = 16;
+
+
+/**
+ * @brief  LZ4   Ǿ  Ÿ ÷Դϴ.
+ */
+static const uint32_t ASSET_PACK_ENTRY_LZ4 = 1 << 0;
+
+
+/**
+ * @brief LZ4  Ŀ ġ  ּ Դϴ.
+ */
+static const std::size_t LZ4_MIN_MATCH = 4;
+
+
+/**
+ * @brief LZ4  Ŀ   ͷ ܾ ϴ Ʈ Դϴ.
+ */
+static const std::size_t LZ4_LAST_LITERALS = 5;
+
+
+/**
+ * @brief LZ4  Ŀ  ġ    ִ  κ ּ ŸԴϴ.
+ */
+static const std::size_t LZ4_MATCH_FIND_LIMIT = 12;
+
+
+/**
+ * @brief LZ4  Ŀ ġ    ִ ִ ŸԴϴ.
+ */
+static const std::size_t LZ4_MAX_OFFSET = 65535;
+
+
+/**
+ * @brief LZ4 ࿡ ġ  ã ؽ ̺ ũ Ʈ Դϴ.
+ */
+static const uint32_t LZ4_HASH_BITS = 16;
+
+
+/**
+ * @brief    Դϴ.
+ *
+ * @note  ڿ , ̸ ̺, ĵ     ̾ϴ.
+ */
+struct AssetPackHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t countOfEntry;
+	uint32_t alignment;
+	uint64_t entryOffset;
+	uint64_t nameOffset;
+	uint64_t nameSize;
+	uint64_t fileSize;
+};
+
+
+/**
+ * @brief     ׸Դϴ.
+ *
+ * @note  ̸ ؽ , ̸  ĵǾ ֽϴ.
+ */
+struct AssetPackEntry
+{
+	uint64_t nameHash;
+	uint64_t offset;
+	uint64_t storedSize;
+	uint64_t originalSize;
+	uint32_t nameOffset;
+	uint32_t nameLength;
+	uint32_t flags;
+	uint32_t reserved;
+};
+
+
+/**
+ * @brief      ũ⿡ ϴ.
+ *
+ * @param offset  Դϴ.
+ *
+ * @return ĵ  ȯմϴ.
+ */
+static uint64_t AlignOffset(uint64_t offset)
+{
+	return (offset + ASSET_PACK_ALIGNMENT - 1) & ~(ASSET_PACK_ALIGNMENT - 1);
+}
+
+
+/**
+ * @brief ¿ ϴ ũ⸸ŭ  Ѱ ȿ ִ Ȯմϴ.
+ *
+ * @note Ͽ   ϴٰ ÷ο찡  ʵ  մϴ.
+ *
+ * @param offset   Դϴ.
+ * @param size  ũԴϴ.
+ * @param limit  ѰԴϴ.
+ *
+ * @return  Ѱ ȿ ִٸ true, ׷  false ȯմϴ.
+ */
+static bool IsValidRange(uint64_t offset, uint64_t size, uint64_t limit)
+{
+	return offset <= limit && size <= limit - offset;
+}
+
+
+/**
+ * @brief ε     ϴ.
+ *
+ * @param mappedPtr ε     Դϴ.
+ *
+ * @return     ȯմϴ.
+ */
+static const AssetPackHeader& GetHeader(const uint8_t* mappedPtr)
+{
+	return *reinterpret_cast<const AssetPackHeader*>(mappedPtr);
+}
+
+
+/**
+ * @brief ε     ϴ.
+ *
+ * @param mappedPtr ε     Դϴ.
+ *
+ * @return  ù ׸ ͸ ȯմϴ.
+ */
+static const AssetPackEntry* GetEntries(const uint8_t* mappedPtr)
+{
+	return reinterpret_cast<const AssetPackEntry*>(mappedPtr + GetHeader(mappedPtr).entryOffset);
+}
+
+
+/**
+ * @brief ε   Ͽ  ̸ ϴ.
+ *
+ * @param mappedPtr ε     Դϴ.
+ * @param entry ̸   ׸Դϴ.
+ *
+ * @return ̸ ̺ Ű ڿ 並 ȯմϴ.
+ */
+static std::string_view GetEntryName(const uint8_t* mappedPtr, const AssetPackEntry& entry)
+{
+	const char* namePtr = reinterpret_cast<const char*>(mappedPtr + GetHeader(mappedPtr).nameOffset + entry.nameOffset);
+	return std::string_view(namePtr, entry.nameLength);
+}
+
+
+/**
+ * @brief ĵ  ּҿ 4Ʈ нϴ.
+ *
+ * @param bufferPtr  ּԴϴ.
+ *
+ * @return  4Ʈ  ȯմϴ.
+ */
+static uint32_t ReadUint32(const uint8_t* bufferPtr)
+{
+	uint32_t value;
+	std::memcpy(&value, bufferPtr, sizeof(uint32_t));
+	return value;
+}
+
+
+/**
+ * @brief LZ4 ࿡ 4Ʈ  ؽ ̺ ε մϴ.
+ *
+ * @param value ؽ   4Ʈ Դϴ.
+ *
+ * @return ؽ ̺ ε ȯմϴ.
+ */
+static uint32_t HashLz4Sequence(uint32_t value)
+{
+	return (value * 2654435761U) >> (32 - LZ4_HASH_BITS);
+}
+
+
+/**
+ * @brief LZ4    Ȯ Ʈ ϴ.
+ *
+ * @param length ū 4Ʈ   Դϴ.
+ * @param outBuffer  Ȯ Ʈ  Դϴ.
+ */
+static void WriteLz4Length(std::size_t length, std::vector<uint8_t>& outBuffer)
+{
+	while (length >= 255)
+	{
+		outBuffer.push_back(255);
+		length -= 255;
+	}
+
+	outBuffer.push_back(static_cast<uint8_t>(length));
+}
+
+
+/**
+ * @brief LZ4    ϳ ϴ.
+ *
+ * @param literalPtr ͷ  Դϴ.
+ * @param literalLength ͷ Դϴ.
+ * @param offset ġ  ŸԴϴ.   0Դϴ.
+ * @param matchLength ġ  Դϴ.   0Դϴ.
+ * @param outBuffer   Դϴ.
+ */
+static void WriteLz4Sequence(const uint8_t* literalPtr, std::size_t literalLength, std::size_t offset, std::size_t matchLength, std::vector<uint8_t>& outBuffer)
+{
+	std::size_t matchCode = (matchLength == 0) ? 0 : matchLength - LZ4_MIN_MATCH;
+
+	uint8_t token = static_cast<uint8_t>((std::min<std::size_t>(literalLength, 15) << 4) | std::min<std::size_t>(matchCode, 15));
+	outBuffer.push_back(token);
+
+	if (literalLength >= 15)
+	{
+		WriteLz4Length(literalLength - 15, outBuffer);
+	}
+
+	outBuffer.insert(outBuffer.end(), literalPtr, literalPtr + literalLength);
+
+	if (matchLength == 0)
+	{
+		return;
+	}
+
+	outBuffer.push_back(static_cast<uint8_t>(offset & 0xFF));
+	outBuffer.push_back(static_cast<uint8_t>((offset >> 8) & 0xFF));
+
+	if (matchCode >= 15)
+	{
+		WriteLz4Length(matchCode - 15, outBuffer);
+	}
+}
+
+
+/**
+ * @brief LZ4    Ȯ Ʈ нϴ.
+ *
+ * @param bufferPtr   Դϴ.
+ * @param bufferSize   ũԴϴ.
+ * @param outIndex  ġԴϴ.   ġ ŵ˴ϴ.
+ * @param outLength  Ȯ Ʈ  Դϴ.
+ *
+ * @return    оٸ true, ׷  false ȯմϴ.
+ */
+static bool ReadLz4Length(const uint8_t* bufferPtr, std::size_t bufferSize, std::size_t& outIndex, std::size_t& outLength)
+{
+	uint8_t value = 255;
+	while (value == 255)
+	{
+		if (outIndex >= bufferSize)
+		{
+			return false;
+		}
+
+		value = bufferPtr[outIndex++];
+		outLength += value;
+	}
+
+	return true;
+}
+
+AssetPack::~AssetPack()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+bool AssetPack::Initialize(const std::wstring& path)
+{
+	ASSERT(!bIsInitialized_, "already initialize asset pack resource...");
+
+#if defined(_WIN32)
+	HANDLE fileHandle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (fileHandle == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(fileHandle, &fileSize) || static_cast<uint64_t>(fileSize.QuadPart) < sizeof(AssetPackHeader))
+	{
+		CloseHandle(fileHandle);
+		return false;
+	}
+
+	//   ü  ϹǷ,  ڵ ٷ ݾƵ  ˴ϴ.
+	HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(fileHandle);
+
+	if (mappingHandle == nullptr)
+	{
+		return false;
+	}
+
+	// ε 䰡   ü ϹǷ, ڵ ٷ ݾƵ  ˴ϴ.
+	void* mappedPtr = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mappingHandle);
+
+	if (mappedPtr == nullptr)
+	{
+		return false;
+	}
+
+	mappedSize_ = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+	std::string convertPath = StringUtils::Convert(path);
+
+	int32_t fileDescriptor = open(convertPath.c_str(), O_RDONLY);
+	if (fileDescriptor == -1)
+	{
+		return false;
+	}
+
+	struct stat fileStat;
+	if (fstat(fileDescriptor, &fileStat) != 0 || static_cast<uint64_t>(fileStat.st_size) < sizeof(AssetPackHeader))
+	{
+		close(fileDescriptor);
+		return false;
+	}
+
+	//   ũͿ  ǹǷ ٷ ݽϴ.
+	void* mappedPtr = mmap(nullptr, static_cast<std::size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+	close(fileDescriptor);
+
+	if (mappedPtr == MAP_FAILED)
+	{
+		return false;
+	}
+
+	mappedSize_ = static_cast<std::size_t>(fileStat.st_size);
+#endif
+
+	mappedPtr_ = reinterpret_cast<const uint8_t*>(mappedPtr);
+
+	if (!IsValidTableOfContents())
+	{
+		UnmapFile();
+		return false;
+	}
+
+	countOfEntry_ = GetHeader(mappedPtr_).countOfEntry;
+
+	bIsInitialized_ = true;
+	return true;
+}
+
+void AssetPack::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	UnmapFile();
+	countOfEntry_ = 0;
+
+	bIsInitialized_ = false;
+}
+
+std::vector<uint8_t> AssetPack::Build(const std::vector<BuildEntry>& entries)
+{
+	std::vector<uint64_t> nameHashes(entries.size());
+	for (std::size_t index = 0; index < entries.size(); ++index)
+	{
+		nameHashes[index] = StringId::Hash(entries[index].name);
+	}
+
+	std::vector<uint32_t> order(entries.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::sort(order.begin(), order.end(),
+		[&](uint32_t lhs, uint32_t rhs)
+		{
+			if (nameHashes[lhs] != nameHashes[rhs])
+			{
+				return nameHashes[lhs] < nameHashes[rhs];
+			}
+
+			return entries[lhs].name < entries[rhs].name;
+		}
+	);
+
+	AssetPackHeader header;
+	header.magic = ASSET_PACK_MAGIC;
+	header.version = ASSET_PACK_VERSION;
+	header.countOfEntry = static_cast<uint32_t>(entries.size());
+	header.alignment = static_cast<uint32_t>(ASSET_PACK_ALIGNMENT);
+	header.entryOffset = sizeof(AssetPackHeader);
+	header.nameOffset = header.entryOffset + entries.size() * sizeof(AssetPackEntry);
+	header.nameSize = 0;
+
+	std::vector<AssetPackEntry> packEntries(entries.size());
+	std::vector<std::vector<uint8_t>> compressedBuffers(entries.size());
+	std::string names;
+
+	for (std::size_t index = 0; index < order.size(); ++index)
+	{
+		const BuildEntry& entry = entries[order[index]];
+		ASSERT(index == 0 || entries[order[index - 1]].name != entry.name, "duplicate %s asset in asset pack...", entry.name.c_str());
+
+		AssetPackEntry& packEntry = packEntries[index];
+		packEntry.nameHash = nameHashes[order[index]];
+		packEntry.nameOffset = static_cast<uint32_t>(names.size());
+		packEntry.nameLength = static_cast<uint32_t>(entry.name.size());
+		packEntry.storedSize = entry.buffer.GetSize();
+		packEntry.originalSize = entry.buffer.GetSize();
+		packEntry.flags = 0;
+		packEntry.reserved = 0;
+
+		names += entry.name;
+
+		if (entry.bIsCompress && !entry.buffer.IsEmpty())
+		{
+			std::vector<uint8_t> compressedBuffer = CompressLz4(entry.buffer);
+			if (compressedBuffer.size() < entry.buffer.GetSize())
+			{
+				packEntry.storedSize = compressedBuffer.size();
+				packEntry.flags |= ASSET_PACK_ENTRY_LZ4;
+				compressedBuffers[index] = std::move(compressedBuffer);
+			}
+		}
+	}
+
+	header.nameSize = names.size();
+
+	uint64_t offset = header.nameOffset + header.nameSize;
+	for (AssetPackEntry& packEntry : packEntries)
+	{
+		packEntry.offset = AlignOffset(offset);
+		offset = packEntry.offset + packEntry.storedSize;
+	}
+
+	header.fileSize = offset;
+
+	std::vector<uint8_t> buffer(static_cast<std::size_t>(header.fileSize), 0);
+	std::memcpy(buffer.data(), &header, sizeof(AssetPackHeader));
+	std::memcpy(buffer.data() + header.entryOffset, packEntries.data(), packEntries.size() * sizeof(AssetPackEntry));
+	std::memcpy(buffer.data() + header.nameOffset, names.data(), names.size());
+
+	for (std::size_t index = 0; index < packEntries.size(); ++index)
+	{
+		const AssetPackEntry& packEntry = packEntries[index];
+		const uint8_t* storedPtr = (packEntry.flags & ASSET_PACK_ENTRY_LZ4) ? compressedBuffers[index].data() : entries[order[index]].buffer.GetData();
+
+		std::memcpy(buffer.data() + packEntry.offset, storedPtr, static_cast<std::size_t>(packEntry.storedSize));
+	}
+
+	return buffer;
+}
+
+BufferView AssetPack::Read(std::string_view name, std::vector<uint8_t>& outDecompressBuffer) const
+{
+	uint32_t index = FindEntry(name);
+	ASSERT(index != INVALID_ENTRY_INDEX, "can't find %.*s asset in asset pack...", static_cast<int32_t>(name.size()), name.data());
+
+	const AssetPackEntry& entry = GetEntries(mappedPtr_)[index];
+	BufferView storedBuffer(mappedPtr_ + entry.offset, static_cast<std::size_t>(entry.storedSize));
+
+	if ((entry.flags & ASSET_PACK_ENTRY_LZ4) == 0)
+	{
+		return storedBuffer;
+	}
+
+	outDecompressBuffer.resize(static_cast<std::size_t>(entry.originalSize));
+	ASSERT(DecompressLz4(storedBuffer, outDecompressBuffer.data(), outDecompressBuffer.size()), "failed to decompress %.*s asset...", static_cast<int32_t>(name.size()), name.data());
+
+	return BufferView(outDecompressBuffer);
+}
+
+AssetPack::EntryInfo AssetPack::GetEntryInfo(uint32_t index) const
+{
+	ASSERT(index < countOfEntry_, "out of range asset pack entry index : %d", index);
+
+	const AssetPackEntry& entry = GetEntries(mappedPtr_)[index];
+
+	EntryInfo info;
+	info.name = GetEntryName(mappedPtr_, entry);
+	info.storedSize = entry.storedSize;
+	info.originalSize = entry.originalSize;
+	info.bIsCompressed = (entry.flags & ASSET_PACK_ENTRY_LZ4) != 0;
+
+	return info;
+}
+
+std::vector<uint8_t> AssetPack::CompressLz4(const BufferView& buffer)
+{
+	const uint8_t* bufferPtr = buffer.GetData();
+	std::size_t bufferSize = buffer.GetSize();
+
+	std::vector<uint8_t> compressedBuffer;
+	compressedBuffer.reserve(bufferSize + bufferSize / 255 + 16);
+
+	std::size_t anchor = 0;
+	if (bufferSize > LZ4_MATCH_FIND_LIMIT)
+	{
+		// ؽ ̺ ġ + 1 ؼ 0  ĭ մϴ.
+		std::vector<uint32_t> hashTable(static_cast<std::size_t>(1) << LZ4_HASH_BITS, 0);
+
+		std::size_t matchStartLimit = bufferSize - LZ4_MATCH_FIND_LIMIT;
+		std::size_t matchEndLimit = bufferSize - LZ4_LAST_LITERALS;
+
+		std::size_t position = 0;
+		while (position < matchStartLimit)
+		{
+			uint32_t sequence = ReadUint32(bufferPtr + position);
+			uint32_t& slot = hashTable[HashLz4Sequence(sequence)];
+			std::size_t candidate = slot;
+			slot = static_cast<uint32_t>(position + 1);
+
+			if (candidate == 0 || position - (candidate - 1) > LZ4_MAX_OFFSET || ReadUint32(bufferPtr + candidate - 1) != sequence)
+			{
+				position++;
+				continue;
+			}
+
+			std::size_t reference = candidate - 1;
+			std::size_t matchLength = LZ4_MIN_MATCH;
+			while (position + matchLength < matchEndLimit && bufferPtr[reference + matchLength] == bufferPtr[position + matchLength])
+			{
+				matchLength++;
+			}
+
+			WriteLz4Sequence(bufferPtr + anchor, position - anchor, position - reference, matchLength, compressedBuffer);
+
+			position += matchLength;
+			anchor = position;
+
+			if (position - 2 < matchStartLimit)
+			{
+				hashTable[HashLz4Sequence(ReadUint32(bufferPtr + position - 2))] = static_cast<uint32_t>(position - 2 + 1);
+			}
+		}
+	}
+
+	WriteLz4Sequence(bufferPtr + anchor, bufferSize - anchor, 0, 0, compressedBuffer);
+
+	return compressedBuffer;
+}
+
+bool AssetPack::DecompressLz4(const BufferView& buffer, uint8_t* outBufferPtr, std::size_t outBufferSize)
+{
+	const uint8_t* bufferPtr = buffer.GetData();
+	std::size_t bufferSize = buffer.GetSize();
+
+	std::size_t inputIndex = 0;
+	std::size_t outputIndex = 0;
+
+	while (inputIndex < bufferSize)
+	{
+		uint8_t token = bufferPtr[inputIndex++];
+
+		std::size_t literalLength = token >> 4;
+		if (literalLength == 15 && !ReadLz4Length(bufferPtr, bufferSize, inputIndex, literalLength))
+		{
+			return false;
+		}
+
+		if (literalLength > bufferSize - inputIndex || literalLength > outBufferSize - outputIndex)
+		{
+			return false;
+		}
+
+		std::memcpy(outBufferPtr + outputIndex, bufferPtr + inputIndex, literalLength);
+		inputIndex += literalLength;
+		outputIndex += literalLength;
+
+		if (inputIndex == bufferSize)
+		{
+			return outputIndex == outBufferSize;
+		}
+
+		if (bufferSize - inputIndex < 2)
+		{
+			return false;
+		}
+
+		std::size_t offset = static_cast<std::size_t>(bufferPtr[inputIndex]) | (static_cast<std::size_t>(bufferPtr[inputIndex + 1]) << 8);
+		inputIndex += 2;
+
+		if (offset == 0 || offset > outputIndex)
+		{
+			return false;
+		}
+
+		std::size_t matchLength = token & 0x0F;
+		if (matchLength == 15 && !ReadLz4Length(bufferPtr, bufferSize, inputIndex, matchLength))
+		{
+			return false;
+		}
+
+		matchLength += LZ4_MIN_MATCH;
+		if (matchLength > outBufferSize - outputIndex)
+		{
+			return false;
+		}
+
+		uint8_t* matchPtr = outBufferPtr + outputIndex - offset;
+		if (offset >= matchLength)
+		{
+			std::memcpy(outBufferPtr + outputIndex, matchPtr, matchLength);
+		}
+		else
+		{
+			// ġ     ġ տ  Ʈ ؼ ݺ  ϴ.
+			for (std::size_t index = 0; index < matchLength; ++index)
+			{
+				outBufferPtr[outputIndex + index] = matchPtr[index];
+			}
+		}
+
+		outputIndex += matchLength;
+	}
+
+	return false;
+}
+
+uint32_t AssetPack::FindEntry(std::string_view name) const
+{
+	if (!bIsInitialized_)
+	{
+		return INVALID_ENTRY_INDEX;
+	}
+
+	uint64_t nameHash = StringId::Hash(name);
+
+	const AssetPackEntry* beginEntry = GetEntries(mappedPtr_);
+	const AssetPackEntry* endEntry = beginEntry + countOfEntry_;
+
+	const AssetPackEntry* entry = std::lower_bound(beginEntry, endEntry, nameHash,
+		[](const AssetPackEntry& packEntry, uint64_t hash)
+		{
+			return packEntry.nameHash < hash;
+		}
+	);
+
+	for (; entry != endEntry && entry->nameHash == nameHash; ++entry)
+	{
+		if (GetEntryName(mappedPtr_, *entry) == name)
+		{
+			return static_cast<uint32_t>(entry - beginEntry);
+		}
+	}
+
+	return INVALID_ENTRY_INDEX;
+}
+
+bool AssetPack::IsValidTableOfContents() const
+{
+	const AssetPackHeader& header = GetHeader(mappedPtr_);
+	if (header.magic != ASSET_PACK_MAGIC || header.version != ASSET_PACK_VERSION || header.fileSize != mappedSize_)
+	{
+		return false;
+	}
+
+	//   ڿ ĵ ġ ؾ ϰ, ̸ ̺ ġ ʾƾ մϴ.
+	uint64_t entrySize = static_cast<uint64_t>(header.countOfEntry) * sizeof(AssetPackEntry);
+	if (header.entryOffset < sizeof(AssetPackHeader) || header.entryOffset % alignof(AssetPackEntry) != 0 || !IsValidRange(header.entryOffset, entrySize, header.nameOffset))
+	{
+		return false;
+	}
+
+	if (!IsValidRange(header.nameOffset, header.nameSize, mappedSize_))
+	{
+		return false;
+	}
+
+	const AssetPackEntry* entries = GetEntries(mappedPtr_);
+	for (uint32_t index = 0; index < header.countOfEntry; ++index)
+	{
+		const AssetPackEntry& entry = entries[index];
+		if (!IsValidRange(entry.offset, entry.storedSize, mappedSize_) || !IsValidRange(entry.nameOffset, entry.nameLength, header.nameSize))
+		{
+			return false;
+		}
+
+		//    ε ޸𸮸 ״ Ƿ  ũ  ũⰡ ƾ մϴ.
+		if ((entry.flags & ASSET_PACK_ENTRY_LZ4) == 0 && entry.originalSize != entry.storedSize)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void AssetPack::UnmapFile()
+{
+#if defined(_WIN32)
+	UnmapViewOfFile(mappedPtr_);
+#else
+	munmap(const_cast<uint8_t*>(mappedPtr_), mappedSize_);
+#endif
+
+	mappedPtr_ = nullptr;
+	mappedSize_ = 0;
+}
\ No newline at end of file
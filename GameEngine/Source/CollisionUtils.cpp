@@ -0,0 +1,293 @@
+#include "CollisionUtils.h"
+
+#include "MathUtils.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define COLLISION_UTILS_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+static CollisionUtils::ESimdPath DetectSimdPath()
+{
+#if defined(COLLISION_UTILS_X86)
+	bool bHasSSE2 = false;
+	bool bHasAVX2 = false;
+
+#if defined(_MSC_VER)
+	int32_t cpuInfo[4];
+	__cpuid(cpuInfo, 0);
+	int32_t countOfId = cpuInfo[0];
+
+	__cpuid(cpuInfo, 1);
+	bHasSSE2 = (cpuInfo[3] & (1 << 26)) != 0;
+
+	bool bHasOSXSAVE = (cpuInfo[2] & (1 << 27)) != 0;
+	bool bHasAVX = (cpuInfo[2] & (1 << 28)) != 0;
+	bool bIsEnableYMM = bHasOSXSAVE && bHasAVX && ((_xgetbv(0) & 0x6) == 0x6);
+
+	if (countOfId >= 7 && bIsEnableYMM)
+	{
+		__cpuidex(cpuInfo, 7, 0);
+		bHasAVX2 = (cpuInfo[1] & (1 << 5)) != 0;
+	}
+#else
+	__builtin_cpu_init();
+	bHasSSE2 = __builtin_cpu_supports("sse2");
+	bHasAVX2 = __builtin_cpu_supports("avx2");
+#endif
+
+	if (bHasAVX2)
+	{
+		return CollisionUtils::ESimdPath::AVX2;
+	}
+
+	if (bHasSSE2)
+	{
+		return CollisionUtils::ESimdPath::SSE2;
+	}
+#endif
+
+	return CollisionUtils::ESimdPath::Scalar;
+}
+
+static CollisionUtils::ESimdPath supportSimdPath = DetectSimdPath();
+static CollisionUtils::ESimdPath currentSimdPath = supportSimdPath;
+
+static void IntersectSpheresVsSphereScalar(const float* cx, const float* cy, const float* cz, const float* r, std::size_t begin, std::size_t n, const Sphere3D& sphere, uint8_t* outHits)
+{
+	Vector3f center = sphere.GetCenter();
+	float radius = sphere.GetRadius();
+
+	for (std::size_t index = begin; index < n; ++index)
+	{
+		float dx = cx[index] - center.x;
+		float dy = cy[index] - center.y;
+		float dz = cz[index] - center.z;
+
+		float lengthSq = dx * dx + dy * dy + dz * dz;
+		float sumRadius = r[index] + radius;
+
+		outHits[index] = (lengthSq <= (sumRadius * sumRadius)) ? 1 : 0;
+	}
+}
+
+static void IntersectSpheresVsBoxScalar(const float* cx, const float* cy, const float* cz, const float* r, std::size_t begin, std::size_t n, const Box3D& box, uint8_t* outHits)
+{
+	Vector3f minPos = box.GetMinPosition();
+	Vector3f maxPos = box.GetMaxPosition();
+
+	for (std::size_t index = begin; index < n; ++index)
+	{
+		float dx = cx[index] - MathUtils::Clamp<float>(cx[index], minPos.x, maxPos.x);
+		float dy = cy[index] - MathUtils::Clamp<float>(cy[index], minPos.y, maxPos.y);
+		float dz = cz[index] - MathUtils::Clamp<float>(cz[index], minPos.z, maxPos.z);
+
+		float distSquare = dx * dx + dy * dy + dz * dz;
+		float radiusSquare = r[index] * r[index];
+
+		outHits[index] = (distSquare <= radiusSquare) ? 1 : 0;
+	}
+}
+
+#if defined(COLLISION_UTILS_X86)
+// MathUtils::Clamp(value, lower, upper) Min(upper, Max(lower, value))̸,
+// _mm_max_ps(value, lower) _mm_min_ps(upper, ...)    Ƿ NaN 0  ϴ.
+static std::size_t IntersectSpheresVsSphereSSE2(const float* cx, const float* cy, const float* cz, const float* r, std::size_t n, const Sphere3D& sphere, uint8_t* outHits)
+{
+	Vector3f center = sphere.GetCenter();
+
+	__m128 sx = _mm_set1_ps(center.x);
+	__m128 sy = _mm_set1_ps(center.y);
+	__m128 sz = _mm_set1_ps(center.z);
+	__m128 sr = _mm_set1_ps(sphere.GetRadius());
+
+	std::size_t index = 0;
+	for (; index + 4 <= n; index += 4)
+	{
+		__m128 dx = _mm_sub_ps(_mm_loadu_ps(cx + index), sx);
+		__m128 dy = _mm_sub_ps(_mm_loadu_ps(cy + index), sy);
+		__m128 dz = _mm_sub_ps(_mm_loadu_ps(cz + index), sz);
+
+		__m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+		__m128 sumRadius = _mm_add_ps(_mm_loadu_ps(r + index), sr);
+
+		int32_t hits = _mm_movemask_ps(_mm_cmple_ps(lengthSq, _mm_mul_ps(sumRadius, sumRadius)));
+		for (int32_t lane = 0; lane < 4; ++lane)
+		{
+			outHits[index + lane] = static_cast<uint8_t>((hits >> lane) & 1);
+		}
+	}
+
+	return index;
+}
+
+static std::size_t IntersectSpheresVsBoxSSE2(const float* cx, const float* cy, const float* cz, const float* r, std::size_t n, const Box3D& box, uint8_t* outHits)
+{
+	Vector3f minPos = box.GetMinPosition();
+	Vector3f maxPos = box.GetMaxPosition();
+
+	__m128 minX = _mm_set1_ps(minPos.x);
+	__m128 minY = _mm_set1_ps(minPos.y);
+	__m128 minZ = _mm_set1_ps(minPos.z);
+	__m128 maxX = _mm_set1_ps(maxPos.x);
+	__m128 maxY = _mm_set1_ps(maxPos.y);
+	__m128 maxZ = _mm_set1_ps(maxPos.z);
+
+	std::size_t index = 0;
+	for (; index + 4 <= n; index += 4)
+	{
+		__m128 x = _mm_loadu_ps(cx + index);
+		__m128 y = _mm_loadu_ps(cy + index);
+		__m128 z = _mm_loadu_ps(cz + index);
+		__m128 radius = _mm_loadu_ps(r + index);
+
+		__m128 dx = _mm_sub_ps(x, _mm_min_ps(maxX, _mm_max_ps(x, minX)));
+		__m128 dy = _mm_sub_ps(y, _mm_min_ps(maxY, _mm_max_ps(y, minY)));
+		__m128 dz = _mm_sub_ps(z, _mm_min_ps(maxZ, _mm_max_ps(z, minZ)));
+
+		__m128 distSquare = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+		__m128 radiusSquare = _mm_mul_ps(radius, radius);
+
+		int32_t hits = _mm_movemask_ps(_mm_cmple_ps(distSquare, radiusSquare));
+		for (int32_t lane = 0; lane < 4; ++lane)
+		{
+			outHits[index + lane] = static_cast<uint8_t>((hits >> lane) & 1);
+		}
+	}
+
+	return index;
+}
+
+TARGET_AVX2 static std::size_t IntersectSpheresVsSphereAVX2(const float* cx, const float* cy, const float* cz, const float* r, std::size_t n, const Sphere3D& sphere, uint8_t* outHits)
+{
+	Vector3f center = sphere.GetCenter();
+
+	__m256 sx = _mm256_set1_ps(center.x);
+	__m256 sy = _mm256_set1_ps(center.y);
+	__m256 sz = _mm256_set1_ps(center.z);
+	__m256 sr = _mm256_set1_ps(sphere.GetRadius());
+
+	std::size_t index = 0;
+	for (; index + 8 <= n; index += 8)
+	{
+		__m256 dx = _mm256_sub_ps(_mm256_loadu_ps(cx + index), sx);
+		__m256 dy = _mm256_sub_ps(_mm256_loadu_ps(cy + index), sy);
+		__m256 dz = _mm256_sub_ps(_mm256_loadu_ps(cz + index), sz);
+
+		__m256 lengthSq = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz));
+		__m256 sumRadius = _mm256_add_ps(_mm256_loadu_ps(r + index), sr);
+
+		int32_t hits = _mm256_movemask_ps(_mm256_cmp_ps(lengthSq, _mm256_mul_ps(sumRadius, sumRadius), _CMP_LE_OQ));
+		for (int32_t lane = 0; lane < 8; ++lane)
+		{
+			outHits[index + lane] = static_cast<uint8_t>((hits >> lane) & 1);
+		}
+	}
+
+	return index;
+}
+
+TARGET_AVX2 static std::size_t IntersectSpheresVsBoxAVX2(const float* cx, const float* cy, const float* cz, const float* r, std::size_t n, const Box3D& box, uint8_t* outHits)
+{
+	Vector3f minPos = box.GetMinPosition();
+	Vector3f maxPos = box.GetMaxPosition();
+
+	__m256 minX = _mm256_set1_ps(minPos.x);
+	__m256 minY = _mm256_set1_ps(minPos.y);
+	__m256 minZ = _mm256_set1_ps(minPos.z);
+	__m256 maxX = _mm256_set1_ps(maxPos.x);
+	__m256 maxY = _mm256_set1_ps(maxPos.y);
+	__m256 maxZ = _mm256_set1_ps(maxPos.z);
+
+	std::size_t index = 0;
+	for (; index + 8 <= n; index += 8)
+	{
+		__m256 x = _mm256_loadu_ps(cx + index);
+		__m256 y = _mm256_loadu_ps(cy + index);
+		__m256 z = _mm256_loadu_ps(cz + index);
+		__m256 radius = _mm256_loadu_ps(r + index);
+
+		__m256 dx = _mm256_sub_ps(x, _mm256_min_ps(maxX, _mm256_max_ps(x, minX)));
+		__m256 dy = _mm256_sub_ps(y, _mm256_min_ps(maxY, _mm256_max_ps(y, minY)));
+		__m256 dz = _mm256_sub_ps(z, _mm256_min_ps(maxZ, _mm256_max_ps(z, minZ)));
+
+		__m256 distSquare = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz));
+		__m256 radiusSquare = _mm256_mul_ps(radius, radius);
+
+		int32_t hits = _mm256_movemask_ps(_mm256_cmp_ps(distSquare, radiusSquare, _CMP_LE_OQ));
+		for (int32_t lane = 0; lane < 8; ++lane)
+		{
+			outHits[index + lane] = static_cast<uint8_t>((hits >> lane) & 1);
+		}
+	}
+
+	return index;
+}
+#endif
+
+CollisionUtils::ESimdPath CollisionUtils::GetSupportSimdPath()
+{
+	return supportSimdPath;
+}
+
+CollisionUtils::ESimdPath CollisionUtils::GetSimdPath()
+{
+	return currentSimdPath;
+}
+
+void CollisionUtils::SetSimdPath(ESimdPath simdPath)
+{
+	currentSimdPath = (static_cast<int32_t>(simdPath) <= static_cast<int32_t>(supportSimdPath)) ? simdPath : supportSimdPath;
+}
+
+void CollisionUtils::IntersectSpheresVsSphere(const float* cx, const float* cy, const float* cz, const float* r, std::size_t n, const Sphere3D& sphere, uint8_t* outHits)
+{
+	std::size_t index = 0;
+
+#if defined(COLLISION_UTILS_X86)
+	switch (currentSimdPath)
+	{
+	case ESimdPath::AVX2:
+		index = IntersectSpheresVsSphereAVX2(cx, cy, cz, r, n, sphere, outHits);
+		break;
+
+	case ESimdPath::SSE2:
+		index = IntersectSpheresVsSphereSSE2(cx, cy, cz, r, n, sphere, outHits);
+		break;
+
+	default:
+		break;
+	}
+#endif
+
+	IntersectSpheresVsSphereScalar(cx, cy, cz, r, index, n, sphere, outHits);
+}
+
+void CollisionUtils::IntersectSpheresVsBox(const float* cx, const float* cy, const float* cz, const float* r, std::size_t n, const Box3D& box, uint8_t* outHits)
+{
+	std::size_t index = 0;
+
+#if defined(COLLISION_UTILS_X86)
+	switch (currentSimdPath)
+	{
+	case ESimdPath::AVX2:
+		index = IntersectSpheresVsBoxAVX2(cx, cy, cz, r, n, box, outHits);
+		break;
+
+	case ESimdPath::SSE2:
+		index = IntersectSpheresVsBoxSSE2(cx, cy, cz, r, n, box, outHits);
+		break;
+
+	default:
+		break;
+	}
+#endif
+
+	IntersectSpheresVsBoxScalar(cx, cy, cz, r, index, n, box, outHits);
+}
\ No newline at end of file
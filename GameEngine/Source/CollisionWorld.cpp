@@ -0,0 +1,574 @@
+#include "CollisionWorld.h"
+
+#include "Assertion.h"
+#include "CollisionUtils.h"
+#include "MathUtils.h"
+
+/**
+ * @brief     SIMD ϰ ˻縦  ּ   Դϴ.
+ */
+static const uint32_t MIN_COUNT_OF_BATCH = 8;
+
+const uint32_t CollisionWorld::INVALID_PROXY;
+
+CollisionWorld::~CollisionWorld()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void CollisionWorld::Initialize(EBroadphase broadphase, const Vector3f& minPosition, const Vector3f& maxPosition, float cellSize)
+{
+	ASSERT(!bIsInitialized_, "already initialize collision world object...");
+	ASSERT(cellSize > 0.0f, "invalid collision world cell size %f...", cellSize);
+
+	broadphase_ = broadphase;
+	builtBroadphase_ = broadphase;
+	gridMinPosition_ = minPosition;
+	cellSize_ = cellSize;
+
+	Vector3f size = maxPosition - minPosition;
+	countOfCellX_ = MathUtils::Max<int32_t>(1, static_cast<int32_t>(std::ceil(size.x / cellSize_)));
+	countOfCellY_ = MathUtils::Max<int32_t>(1, static_cast<int32_t>(std::ceil(size.y / cellSize_)));
+	countOfCellZ_ = MathUtils::Max<int32_t>(1, static_cast<int32_t>(std::ceil(size.z / cellSize_)));
+
+	cellStarts_ = std::vector<uint32_t>(countOfCellX_ * countOfCellY_ * countOfCellZ_ + 1, 0);
+
+	bIsInitialized_ = true;
+}
+
+void CollisionWorld::Tick(float deltaSeconds)
+{
+	collisionPairs_.clear();
+
+	switch (broadphase_)
+	{
+	case EBroadphase::UniformGrid:
+		UpdateUniformGrid();
+		break;
+
+	case EBroadphase::SweepAndPrune:
+		UpdateSweepAndPrune();
+		break;
+
+	default:
+		ASSERT(false, "undefined %d broadphase type...", static_cast<int32_t>(broadphase_));
+		break;
+	}
+
+	builtBroadphase_ = broadphase_;
+}
+
+void CollisionWorld::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	proxies_.clear();
+	freeProxies_.clear();
+	collisionPairs_.clear();
+	cellStarts_.clear();
+	cellProxies_.clear();
+	gridLayers_.clear();
+	sortedProxies_.clear();
+	cellGroups_.clear();
+	batchCenterX_.clear();
+	batchCenterY_.clear();
+	batchCenterZ_.clear();
+	batchRadius_.clear();
+	batchHits_.clear();
+
+	bIsInitialized_ = false;
+}
+
+uint32_t CollisionWorld::CreateSphereProxy(const Sphere3D& sphere, uint32_t layer, uint32_t mask, uint32_t userData)
+{
+	uint32_t proxy = AllocateProxy();
+
+	Proxy& target = proxies_[proxy];
+	target.type = IShape3D::EType::Sphere;
+	target.sphere = sphere;
+	target.layer = layer;
+	target.mask = mask;
+	target.userData = userData;
+
+	UpdateSphereProxy(proxy, sphere.GetCenter());
+	return proxy;
+}
+
+uint32_t CollisionWorld::CreateBoxProxy(const Box3D& box, uint32_t layer, uint32_t mask, uint32_t userData)
+{
+	uint32_t proxy = AllocateProxy();
+
+	Proxy& target = proxies_[proxy];
+	target.type = IShape3D::EType::Box;
+	target.box = box;
+	target.layer = layer;
+	target.mask = mask;
+	target.userData = userData;
+
+	UpdateBoxProxy(proxy, box.GetCenter());
+	return proxy;
+}
+
+void CollisionWorld::DestroyProxy(uint32_t proxy)
+{
+	ASSERT(proxy < proxies_.size(), "out of range collision proxy %d...", proxy);
+
+	Proxy& target = proxies_[proxy];
+	if (!target.bIsActive)
+	{
+		return;
+	}
+
+	target.type = IShape3D::EType::None;
+	target.bIsActive = false;
+	freeProxies_.push_back(proxy);
+}
+
+void CollisionWorld::UpdateSphereProxy(uint32_t proxy, const Vector3f& center)
+{
+	Proxy& target = proxies_[proxy];
+	ASSERT(target.type == IShape3D::EType::Sphere, "collision proxy %d is not sphere...", proxy);
+
+	float radius = target.sphere.GetRadius();
+
+	target.sphere.SetCenter(center);
+	target.minPosition = Vector3f(center.x - radius, center.y - radius, center.z - radius);
+	target.maxPosition = Vector3f(center.x + radius, center.y + radius, center.z + radius);
+}
+
+void CollisionWorld::UpdateBoxProxy(uint32_t proxy, const Vector3f& center)
+{
+	Proxy& target = proxies_[proxy];
+	ASSERT(target.type == IShape3D::EType::Box, "collision proxy %d is not box...", proxy);
+
+	target.box.SetCenter(center);
+	target.minPosition = target.box.GetMinPosition();
+	target.maxPosition = target.box.GetMaxPosition();
+}
+
+bool CollisionWorld::QueryOverlap(const IShape3D* shape, uint32_t mask) const
+{
+	Vector3f minPosition;
+	Vector3f maxPosition;
+
+	if (shape->GetType() == IShape3D::EType::Sphere)
+	{
+		const Sphere3D* sphere = reinterpret_cast<const Sphere3D*>(shape);
+		Vector3f center = sphere->GetCenter();
+		float radius = sphere->GetRadius();
+
+		minPosition = Vector3f(center.x - radius, center.y - radius, center.z - radius);
+		maxPosition = Vector3f(center.x + radius, center.y + radius, center.z + radius);
+	}
+	else if (shape->GetType() == IShape3D::EType::Box)
+	{
+		const Box3D* box = reinterpret_cast<const Box3D*>(shape);
+
+		minPosition = box->GetMinPosition();
+		maxPosition = box->GetMaxPosition();
+	}
+	else
+	{
+		return false;
+	}
+
+	auto overlap = [&](uint32_t proxy)
+	{
+		const Proxy& target = proxies_[proxy];
+		if (!target.bIsActive || (target.layer & mask) == 0)
+		{
+			return false;
+		}
+
+		if (minPosition.x > target.maxPosition.x || maxPosition.x < target.minPosition.x ||
+			minPosition.y > target.maxPosition.y || maxPosition.y < target.minPosition.y ||
+			minPosition.z > target.maxPosition.z || maxPosition.z < target.minPosition.z)
+		{
+			return false;
+		}
+
+		return shape->Intersect(GetProxyShape(target));
+	};
+
+	if (builtBroadphase_ == EBroadphase::UniformGrid)
+	{
+		CellRange range = ComputeCellRange(minPosition, maxPosition);
+
+		for (int32_t z = range.minZ; z <= range.maxZ; ++z)
+		{
+			for (int32_t y = range.minY; y <= range.maxY; ++y)
+			{
+				for (int32_t x = range.minX; x <= range.maxX; ++x)
+				{
+					int32_t cell = GetCellIndex(x, y, z);
+
+					for (uint32_t index = cellStarts_[cell]; index < cellStarts_[cell + 1]; ++index)
+					{
+						if (overlap(cellProxies_[index]))
+						{
+							return true;
+						}
+					}
+				}
+			}
+		}
+	}
+	else // builtBroadphase_ == EBroadphase::SweepAndPrune
+	{
+		for (const auto& proxy : sortedProxies_)
+		{
+			if (proxies_[proxy].minPosition.x > maxPosition.x)
+			{
+				break;
+			}
+
+			if (overlap(proxy))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+uint32_t CollisionWorld::AllocateProxy()
+{
+	uint32_t proxy = 0;
+
+	if (!freeProxies_.empty())
+	{
+		proxy = freeProxies_.back();
+		freeProxies_.pop_back();
+	}
+	else
+	{
+		proxy = static_cast<uint32_t>(proxies_.size());
+		proxies_.push_back(Proxy());
+	}
+
+	proxies_[proxy].bIsActive = true;
+	return proxy;
+}
+
+const IShape3D* CollisionWorld::GetProxyShape(const Proxy& proxy) const
+{
+	if (proxy.type == IShape3D::EType::Sphere)
+	{
+		return &proxy.sphere;
+	}
+	else
+	{
+		return &proxy.box;
+	}
+}
+
+bool CollisionWorld::ShouldCollide(const Proxy& lhs, const Proxy& rhs) const
+{
+	return (lhs.layer & rhs.mask) != 0 && (rhs.layer & lhs.mask) != 0;
+}
+
+bool CollisionWorld::IsOverlapBounds(const Proxy& lhs, const Proxy& rhs) const
+{
+	return !(lhs.minPosition.x > rhs.maxPosition.x || lhs.maxPosition.x < rhs.minPosition.x ||
+		lhs.minPosition.y > rhs.maxPosition.y || lhs.maxPosition.y < rhs.minPosition.y ||
+		lhs.minPosition.z > rhs.maxPosition.z || lhs.maxPosition.z < rhs.minPosition.z);
+}
+
+void CollisionWorld::TestCollisionPair(uint32_t proxyA, uint32_t proxyB)
+{
+	const Proxy& lhs = proxies_[proxyA];
+	const Proxy& rhs = proxies_[proxyB];
+
+	if (!ShouldCollide(lhs, rhs))
+	{
+		return;
+	}
+
+	if (!IsOverlapBounds(lhs, rhs))
+	{
+		return;
+	}
+
+	if (GetProxyShape(lhs)->Intersect(GetProxyShape(rhs)))
+	{
+		collisionPairs_.push_back(CollisionPair{ MathUtils::Min<uint32_t>(proxyA, proxyB), MathUtils::Max<uint32_t>(proxyA, proxyB) });
+	}
+}
+
+void CollisionWorld::ComputeCell(const Vector3f& position, int32_t& outX, int32_t& outY, int32_t& outZ) const
+{
+	outX = static_cast<int32_t>(std::floor((position.x - gridMinPosition_.x) / cellSize_));
+	outY = static_cast<int32_t>(std::floor((position.y - gridMinPosition_.y) / cellSize_));
+	outZ = static_cast<int32_t>(std::floor((position.z - gridMinPosition_.z) / cellSize_));
+
+	outX = MathUtils::Clamp<int32_t>(outX, 0, countOfCellX_ - 1);
+	outY = MathUtils::Clamp<int32_t>(outY, 0, countOfCellY_ - 1);
+	outZ = MathUtils::Clamp<int32_t>(outZ, 0, countOfCellZ_ - 1);
+}
+
+CollisionWorld::CellRange CollisionWorld::ComputeCellRange(const Vector3f& minPosition, const Vector3f& maxPosition) const
+{
+	CellRange range;
+
+	ComputeCell(minPosition, range.minX, range.minY, range.minZ);
+	ComputeCell(maxPosition, range.maxX, range.maxY, range.maxZ);
+
+	return range;
+}
+
+void CollisionWorld::UpdateUniformGrid()
+{
+	std::fill(cellStarts_.begin(), cellStarts_.end(), 0);
+
+	gridLayers_.clear();
+	uint32_t countOfEntry = 0;
+
+	for (const auto& proxy : proxies_)
+	{
+		if (!proxy.bIsActive)
+		{
+			continue;
+		}
+
+		if (std::find(gridLayers_.begin(), gridLayers_.end(), proxy.layer) == gridLayers_.end())
+		{
+			gridLayers_.push_back(proxy.layer);
+		}
+
+		CellRange range = ComputeCellRange(proxy.minPosition, proxy.maxPosition);
+		for (int32_t z = range.minZ; z <= range.maxZ; ++z)
+		{
+			for (int32_t y = range.minY; y <= range.maxY; ++y)
+			{
+				for (int32_t x = range.minX; x <= range.maxX; ++x)
+				{
+					cellStarts_[GetCellIndex(x, y, z)]++;
+					countOfEntry++;
+				}
+			}
+		}
+	}
+
+	for (std::size_t cell = 1; cell < cellStarts_.size(); ++cell)
+	{
+		cellStarts_[cell] += cellStarts_[cell - 1];
+	}
+
+	cellProxies_.resize(countOfEntry);
+
+	//   Ͻð ̾   ֵ ̾  äϴ.
+	for (const auto& layer : gridLayers_)
+	{
+		for (uint32_t proxy = 0; proxy < proxies_.size(); ++proxy)
+		{
+			const Proxy& target = proxies_[proxy];
+			if (!target.bIsActive || target.layer != layer)
+			{
+				continue;
+			}
+
+			CellRange range = ComputeCellRange(target.minPosition, target.maxPosition);
+			for (int32_t z = range.minZ; z <= range.maxZ; ++z)
+			{
+				for (int32_t y = range.minY; y <= range.maxY; ++y)
+				{
+					for (int32_t x = range.minX; x <= range.maxX; ++x)
+					{
+						cellProxies_[--cellStarts_[GetCellIndex(x, y, z)]] = proxy;
+					}
+				}
+			}
+		}
+	}
+
+	int32_t countOfCell = static_cast<int32_t>(cellStarts_.size()) - 1;
+	for (int32_t cell = 0; cell < countOfCell; ++cell)
+	{
+		uint32_t begin = cellStarts_[cell];
+		uint32_t end = cellStarts_[cell + 1];
+
+		cellGroups_.clear();
+		for (uint32_t i = begin; i < end;)
+		{
+			CellGroup group;
+			group.begin = i;
+			group.bIsSphereOnly = true;
+			group.bIsSelfCollision = false;
+
+			uint32_t layer = proxies_[cellProxies_[i]].layer;
+			for (; i < end && proxies_[cellProxies_[i]].layer == layer; ++i)
+			{
+				const Proxy& target = proxies_[cellProxies_[i]];
+				group.bIsSphereOnly = group.bIsSphereOnly && (target.type == IShape3D::EType::Sphere);
+				group.bIsSelfCollision = group.bIsSelfCollision || ((target.layer & target.mask) != 0);
+			}
+
+			group.end = i;
+			cellGroups_.push_back(group);
+		}
+
+		for (std::size_t groupA = 0; groupA < cellGroups_.size(); ++groupA)
+		{
+			const CellGroup& lhs = cellGroups_[groupA];
+
+			//  ̾ 浹 ʴ´ٸ  ̾ ׷ δ ǳʶݴϴ.
+			if (lhs.bIsSelfCollision)
+			{
+				for (uint32_t i = lhs.begin; i < lhs.end; ++i)
+				{
+					for (uint32_t j = i + 1; j < lhs.end; ++j)
+					{
+						TestCollisionPairInCell(cell, cellProxies_[i], cellProxies_[j]);
+					}
+				}
+			}
+
+			for (std::size_t groupB = groupA + 1; groupB < cellGroups_.size(); ++groupB)
+			{
+				const CellGroup& rhs = cellGroups_[groupB];
+
+				uint32_t countOfLhs = lhs.end - lhs.begin;
+				uint32_t countOfRhs = rhs.end - rhs.begin;
+				bool bCanBatchLhs = lhs.bIsSphereOnly && countOfLhs >= MIN_COUNT_OF_BATCH;
+				bool bCanBatchRhs = rhs.bIsSphereOnly && countOfRhs >= MIN_COUNT_OF_BATCH;
+
+				if (bCanBatchLhs && (!bCanBatchRhs || countOfLhs >= countOfRhs))
+				{
+					TestCollisionBatchInCell(cell, lhs, rhs);
+				}
+				else if (bCanBatchRhs)
+				{
+					TestCollisionBatchInCell(cell, rhs, lhs);
+				}
+				else
+				{
+					for (uint32_t i = lhs.begin; i < lhs.end; ++i)
+					{
+						for (uint32_t j = rhs.begin; j < rhs.end; ++j)
+						{
+							TestCollisionPairInCell(cell, cellProxies_[i], cellProxies_[j]);
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+bool CollisionWorld::IsOwnerCell(int32_t cell, const Proxy& lhs, const Proxy& rhs) const
+{
+	int32_t x = 0;
+	int32_t y = 0;
+	int32_t z = 0;
+	ComputeCell(
+		Vector3f(
+			MathUtils::Max<float>(lhs.minPosition.x, rhs.minPosition.x),
+			MathUtils::Max<float>(lhs.minPosition.y, rhs.minPosition.y),
+			MathUtils::Max<float>(lhs.minPosition.z, rhs.minPosition.z)
+		),
+		x, y, z
+	);
+
+	return GetCellIndex(x, y, z) == cell;
+}
+
+void CollisionWorld::TestCollisionPairInCell(int32_t cell, uint32_t proxyA, uint32_t proxyB)
+{
+	//   ģ  ߺ ˻ ʵ,    ּڰ  ū    ˻մϴ.
+	if (IsOwnerCell(cell, proxies_[proxyA], proxies_[proxyB]))
+	{
+		TestCollisionPair(proxyA, proxyB);
+	}
+}
+
+void CollisionWorld::TestCollisionBatchInCell(int32_t cell, const CellGroup& sphereGroup, const CellGroup& otherGroup)
+{
+	uint32_t countOfSphere = sphereGroup.end - sphereGroup.begin;
+
+	batchCenterX_.resize(countOfSphere);
+	batchCenterY_.resize(countOfSphere);
+	batchCenterZ_.resize(countOfSphere);
+	batchRadius_.resize(countOfSphere);
+	batchHits_.resize(countOfSphere);
+
+	for (uint32_t index = 0; index < countOfSphere; ++index)
+	{
+		const Sphere3D& sphere = proxies_[cellProxies_[sphereGroup.begin + index]].sphere;
+		Vector3f center = sphere.GetCenter();
+
+		batchCenterX_[index] = center.x;
+		batchCenterY_[index] = center.y;
+		batchCenterZ_[index] = center.z;
+		batchRadius_[index] = sphere.GetRadius();
+	}
+
+	for (uint32_t other = otherGroup.begin; other < otherGroup.end; ++other)
+	{
+		uint32_t proxyB = cellProxies_[other];
+		const Proxy& rhs = proxies_[proxyB];
+
+		if (rhs.type == IShape3D::EType::Sphere)
+		{
+			CollisionUtils::IntersectSpheresVsSphere(batchCenterX_.data(), batchCenterY_.data(), batchCenterZ_.data(), batchRadius_.data(), countOfSphere, rhs.sphere, batchHits_.data());
+		}
+		else
+		{
+			CollisionUtils::IntersectSpheresVsBox(batchCenterX_.data(), batchCenterY_.data(), batchCenterZ_.data(), batchRadius_.data(), countOfSphere, rhs.box, batchHits_.data());
+		}
+
+		for (uint32_t index = 0; index < countOfSphere; ++index)
+		{
+			if (batchHits_[index] == 0)
+			{
+				continue;
+			}
+
+			uint32_t proxyA = cellProxies_[sphereGroup.begin + index];
+			const Proxy& lhs = proxies_[proxyA];
+
+			if (ShouldCollide(lhs, rhs) && IsOverlapBounds(lhs, rhs) && IsOwnerCell(cell, lhs, rhs))
+			{
+				collisionPairs_.push_back(CollisionPair{ MathUtils::Min<uint32_t>(proxyA, proxyB), MathUtils::Max<uint32_t>(proxyA, proxyB) });
+			}
+		}
+	}
+}
+
+void CollisionWorld::UpdateSweepAndPrune()
+{
+	sortedProxies_.clear();
+
+	for (uint32_t proxy = 0; proxy < proxies_.size(); ++proxy)
+	{
+		if (proxies_[proxy].bIsActive)
+		{
+			sortedProxies_.push_back(proxy);
+		}
+	}
+
+	std::sort(
+		sortedProxies_.begin(),
+		sortedProxies_.end(),
+		[&](uint32_t lhs, uint32_t rhs) { return proxies_[lhs].minPosition.x < proxies_[rhs].minPosition.x; }
+	);
+
+	for (std::size_t i = 0; i < sortedProxies_.size(); ++i)
+	{
+		const Proxy& lhs = proxies_[sortedProxies_[i]];
+
+		for (std::size_t j = i + 1; j < sortedProxies_.size(); ++j)
+		{
+			const Proxy& rhs = proxies_[sortedProxies_[j]];
+			if (rhs.minPosition.x > lhs.maxPosition.x)
+			{
+				break;
+			}
+
+			TestCollisionPair(sortedProxies_[i], sortedProxies_[j]);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,201 @@
+#include <atomic>
+
+#include "EntityWorld.h"
+
+EntityWorld::~EntityWorld()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void EntityWorld::Initialize()
+{
+	ASSERT(!bIsInitialized_, "already initialize entity world...");
+
+	archetypes_.clear();
+	archetypeIndex_.clear();
+	entities_.clear();
+	freeEntities_.clear();
+	pendingDestroys_.clear();
+
+	bIsInitialized_ = true;
+}
+
+void EntityWorld::Tick(float deltaSeconds)
+{
+	FlushDestroyedEntities();
+}
+
+void EntityWorld::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+	archetypes_.clear();
+	archetypeIndex_.clear();
+	entities_.clear();
+	freeEntities_.clear();
+	pendingDestroys_.clear();
+
+	bIsInitialized_ = false;
+}
+
+void EntityWorld::DestroyEntity(const EntityHandle& handle)
+{
+	if (!IsAlive(handle) || entities_[handle.index].bIsPendingDestroy)
+	{
+		return;
+	}
+
+	entities_[handle.index].bIsPendingDestroy = true;
+	pendingDestroys_.push_back(handle.index);
+}
+
+void EntityWorld::FlushDestroyedEntities()
+{
+	for (const auto& entityIndex : pendingDestroys_)
+	{
+		EntityRecord& record = entities_[entityIndex];
+		RemoveRow(*archetypes_[record.archetype], record.row);
+
+		record.generation++;
+		record.bIsAlive = false;
+		record.bIsPendingDestroy = false;
+
+		freeEntities_.push_back(entityIndex);
+	}
+
+	pendingDestroys_.clear();
+}
+
+EntityHandle EntityWorld::GetEntityHandle(uint32_t entityIndex) const
+{
+	EntityHandle handle;
+
+	if (entityIndex < entities_.size() && entities_[entityIndex].bIsAlive)
+	{
+		handle.index = entityIndex;
+		handle.generation = entities_[entityIndex].generation;
+	}
+
+	return handle;
+}
+
+uint32_t EntityWorld::AllocateComponentTypeID()
+{
+	static std::atomic<uint32_t> countOfComponentType = 0;
+
+	uint32_t componentTypeID = countOfComponentType.fetch_add(1);
+	ASSERT(componentTypeID < MAX_COMPONENT_TYPE, "overflow component type %d...", componentTypeID);
+
+	return componentTypeID;
+}
+
+uint32_t EntityWorld::FindOrCreateArchetype(uint64_t mask, uint32_t baseArchetype, uint32_t componentTypeID, std::unique_ptr<IComponentColumn> addColumn)
+{
+	auto iter = archetypeIndex_.find(mask);
+	if (iter != archetypeIndex_.end())
+	{
+		return iter->second;
+	}
+
+	const Archetype& base = *archetypes_[baseArchetype];
+
+	std::unique_ptr<Archetype> archetype = std::make_unique<Archetype>();
+	archetype->mask = mask;
+
+	for (uint32_t typeID = 0; typeID < MAX_COMPONENT_TYPE; ++typeID)
+	{
+		if (typeID != componentTypeID && base.columns[typeID])
+		{
+			archetype->columns[typeID] = base.columns[typeID]->CreateEmpty();
+		}
+	}
+
+	if (addColumn)
+	{
+		archetype->columns[componentTypeID] = std::move(addColumn);
+	}
+
+	return RegisterArchetype(std::move(archetype));
+}
+
+uint32_t EntityWorld::RegisterArchetype(std::unique_ptr<Archetype> archetype)
+{
+	uint32_t archetypeIndex = static_cast<uint32_t>(archetypes_.size());
+
+	archetypeIndex_.insert({ archetype->mask, archetypeIndex });
+	archetypes_.push_back(std::move(archetype));
+
+	return archetypeIndex;
+}
+
+EntityHandle EntityWorld::AllocateEntity()
+{
+	uint32_t entityIndex = 0;
+	if (freeEntities_.empty())
+	{
+		entityIndex = static_cast<uint32_t>(entities_.size());
+		entities_.push_back(EntityRecord());
+	}
+	else
+	{
+		entityIndex = freeEntities_.back();
+		freeEntities_.pop_back();
+	}
+
+	EntityRecord& record = entities_[entityIndex];
+	record.bIsAlive = true;
+	record.bIsPendingDestroy = false;
+
+	EntityHandle handle;
+	handle.index = entityIndex;
+	handle.generation = record.generation;
+
+	return handle;
+}
+
+void EntityWorld::MoveEntity(uint32_t entityIndex, uint32_t archetypeIndex)
+{
+	EntityRecord& record = entities_[entityIndex];
+	Archetype& source = *archetypes_[record.archetype];
+	Archetype& destination = *archetypes_[archetypeIndex];
+
+	for (uint32_t typeID = 0; typeID < MAX_COMPONENT_TYPE; ++typeID)
+	{
+		if (source.columns[typeID] && destination.columns[typeID])
+		{
+			destination.columns[typeID]->MoveFrom(*source.columns[typeID], record.row);
+		}
+	}
+
+	uint32_t row = static_cast<uint32_t>(destination.entities.size());
+	destination.entities.push_back(entityIndex);
+
+	RemoveRow(source, record.row);
+
+	record.archetype = archetypeIndex;
+	record.row = row;
+}
+
+void EntityWorld::RemoveRow(Archetype& archetype, uint32_t row)
+{
+	for (auto& column : archetype.columns)
+	{
+		if (column)
+		{
+			column->SwapRemove(row);
+		}
+	}
+
+	uint32_t lastRow = static_cast<uint32_t>(archetype.entities.size()) - 1;
+	if (row != lastRow)
+	{
+		uint32_t movedEntity = archetype.entities[lastRow];
+		archetype.entities[row] = movedEntity;
+		entities_[movedEntity].row = row;
+	}
+
+	archetype.entities.pop_back();
+}
\ No newline at end of file
@@ -166,11 +166,11 @@ std::wstring FileUtils::GetFileExtension(const std::wstring& path)
 Json::Value FileUtils::ReadJsonFromFile(const std::string& path)
 {
 	std::vector<uint8_t> jsonBuffer = ReadBufferFromFile(path);
-	std::string jsonString(jsonBuffer.begin(), jsonBuffer.end());
+	const char* jsonPtr = reinterpret_cast<const char*>(jsonBuffer.data());
 
 	Json::Value root;
 	Json::Reader reader;
-	ASSERT(reader.parse(jsonString, root), "failed to parse %s json file...", path.c_str());
+	ASSERT(reader.parse(jsonPtr, jsonPtr + jsonBuffer.size(), root), "failed to parse %s json file...", path.c_str());
 
 	return root;
 }
@@ -178,11 +178,22 @@ Json::Value FileUtils::ReadJsonFromFile(const std::string& path)
 Json::Value FileUtils::ReadJsonFromFile(const std::wstring& path)
 {
 	std::vector<uint8_t> jsonBuffer = ReadBufferFromFile(path);
-	std::string jsonString(jsonBuffer.begin(), jsonBuffer.end());
+	const char* jsonPtr = reinterpret_cast<const char*>(jsonBuffer.data());
 
 	Json::Value root;
 	Json::Reader reader;
-	ASSERT(reader.parse(jsonString, root), L"failed to parse %s json file...", path.c_str());
+	ASSERT(reader.parse(jsonPtr, jsonPtr + jsonBuffer.size(), root), L"failed to parse %s json file...", path.c_str());
+
+	return root;
+}
+
+Json::Value FileUtils::ReadJsonFromBuffer(const BufferView& buffer)
+{
+	std::string_view json = buffer.GetStringView();
+
+	Json::Value root;
+	Json::Reader reader;
+	ASSERT(reader.parse(json.data(), json.data() + json.size(), root), "failed to parse json buffer...");
 
 	return root;
 }
\ No newline at end of file
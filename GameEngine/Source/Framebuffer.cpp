@@ -2,6 +2,7 @@
 
 #include "Assertion.h"
 #include "Framebuffer.h"
+#include "GLStateCache.h"
 
 Framebuffer::~Framebuffer()
 {
@@ -17,10 +18,10 @@ void Framebuffer::Initialize(int32_t bufferWidth, int32_t bufferHeight)
 	ASSERT((bufferWidth >= 0 && bufferHeight >= 0), "invalid frame buffer size : %d, %d", bufferWidth, bufferHeight);
 
 	GL_ASSERT(glGenFramebuffers(1, &framebufferID_), "failed to generate framebuffer object...");
-	GL_ASSERT(glBindFramebuffer(GL_FRAMEBUFFER, framebufferID_), "failed to bind frame buffer object...");
+	GL_ASSERT(GLStateCache::Get().BindFramebuffer(framebufferID_), "failed to bind frame buffer object...");
 
 	GL_ASSERT(glGenTextures(1, &colorBufferID_), "failed to generate color buffer object...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, colorBufferID_), "failed to bind color buffer object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, colorBufferID_), "failed to bind color buffer object...");
 	GL_ASSERT(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, bufferWidth, bufferHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr), "failed to allows elements of an image array to be read by shaders.");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE), "failed to set texture object warp s...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE), "failed to set texture object warp t...");
@@ -36,7 +37,7 @@ void Framebuffer::Initialize(int32_t bufferWidth, int32_t bufferHeight)
 	GLenum state = glCheckFramebufferStatus(GL_FRAMEBUFFER);
 	ASSERT(state == GL_FRAMEBUFFER_COMPLETE, "not complete framebuffer state : %x...", static_cast<int32_t>(state));
 
-	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	GLStateCache::Get().BindFramebuffer(0);
 	bIsInitialized_ = true;
 }
 
@@ -45,8 +46,8 @@ void Framebuffer::Release()
 	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
 
 	GL_ASSERT(glDeleteRenderbuffers(1, &depthStencilBufferID_), "failed to delete depth stencil buffer object...");
-	GL_ASSERT(glDeleteTextures(1, &colorBufferID_), "failed to delete color buffer object...");
-	GL_ASSERT(glDeleteFramebuffers(1, &framebufferID_), "failed to delete frame buffer object...");
+	GL_ASSERT(GLStateCache::Get().DeleteTexture(colorBufferID_), "failed to delete color buffer object...");
+	GL_ASSERT(GLStateCache::Get().DeleteFramebuffer(framebufferID_), "failed to delete frame buffer object...");
 
 	bIsInitialized_ = false;
 }
@@ -69,7 +70,7 @@ void Framebuffer::Bind()
 	if (!bIsBind_)
 	{
 		bIsBind_ = true;
-		glBindFramebuffer(GL_FRAMEBUFFER, framebufferID_);
+		GLStateCache::Get().BindFramebuffer(framebufferID_);
 	}
 }
 
@@ -78,12 +79,11 @@ void Framebuffer::Unbind()
 	if (bIsBind_)
 	{
 		bIsBind_ = false;
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		GLStateCache::Get().BindFramebuffer(0);
 	}
 }
 
 void Framebuffer::Active(uint32_t unit)
 {
-	GL_ASSERT(glActiveTexture(GL_TEXTURE0 + unit), "failed to active texture unit : %d", (GL_TEXTURE0 + unit));
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, colorBufferID_), "failed to bind color buffer object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(unit, GL_TEXTURE_2D, colorBufferID_), "failed to bind color buffer object...");
 }
\ No newline at end of file
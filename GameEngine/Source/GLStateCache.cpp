@@ -0,0 +1,304 @@
+#if !defined(HEADLESS_MODE)
+#include <glad/glad.h>
+#endif
+
+#include "Assertion.h"
+#include "GLStateCache.h"
+
+/**
+ * @brief ĳð     ¸ Ÿ Դϴ. OpenGL Ʈ ̸    ʽϴ.
+ */
+static const uint32_t UNKNOWN_STATE = 0xFFFFFFFF;
+
+/**
+ * @brief  ĳð ⺻  Լ ̺ մϴ.
+ *
+ * @return HEADLESS_MODE ƴϸ OpenGL Լ ȣϰ, HEADLESS_MODE̸ ƹ ۵  ʴ Լ ̺ ȯմϴ.
+ */
+static GLFunctionTable CreateDefaultFunctionTable()
+{
+	GLFunctionTable functions;
+
+#if !defined(HEADLESS_MODE)
+	functions.useProgram = [](uint32_t program) { glUseProgram(program); };
+	functions.bindVertexArray = [](uint32_t vertexArray) { glBindVertexArray(vertexArray); };
+	functions.bindBuffer = [](uint32_t target, uint32_t buffer) { glBindBuffer(target, buffer); };
+	functions.activeTexture = [](uint32_t unit) { glActiveTexture(GL_TEXTURE0 + unit); };
+	functions.bindTexture = [](uint32_t target, uint32_t texture) { glBindTexture(target, texture); };
+	functions.bindFramebuffer = [](uint32_t framebuffer) { glBindFramebuffer(GL_FRAMEBUFFER, framebuffer); };
+	functions.viewport = [](int32_t x, int32_t y, int32_t width, int32_t height) { glViewport(x, y, width, height); };
+	functions.enable = [](uint32_t capability) { glEnable(capability); };
+	functions.disable = [](uint32_t capability) { glDisable(capability); };
+	functions.blendFuncSeparate = [](uint32_t srcRGB, uint32_t dstRGB, uint32_t srcAlpha, uint32_t dstAlpha) { glBlendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha); };
+	functions.depthFunc = [](uint32_t func) { glDepthFunc(func); };
+	functions.cullFace = [](uint32_t mode) { glCullFace(mode); };
+	functions.deleteProgram = [](uint32_t program) { glDeleteProgram(program); };
+	functions.deleteVertexArray = [](uint32_t vertexArray) { glDeleteVertexArrays(1, &vertexArray); };
+	functions.deleteBuffer = [](uint32_t buffer) { glDeleteBuffers(1, &buffer); };
+	functions.deleteTexture = [](uint32_t texture) { glDeleteTextures(1, &texture); };
+	functions.deleteFramebuffer = [](uint32_t framebuffer) { glDeleteFramebuffers(1, &framebuffer); };
+#else
+	functions.useProgram = [](uint32_t) {};
+	functions.bindVertexArray = [](uint32_t) {};
+	functions.bindBuffer = [](uint32_t, uint32_t) {};
+	functions.activeTexture = [](uint32_t) {};
+	functions.bindTexture = [](uint32_t, uint32_t) {};
+	functions.bindFramebuffer = [](uint32_t) {};
+	functions.viewport = [](int32_t, int32_t, int32_t, int32_t) {};
+	functions.enable = [](uint32_t) {};
+	functions.disable = [](uint32_t) {};
+	functions.blendFuncSeparate = [](uint32_t, uint32_t, uint32_t, uint32_t) {};
+	functions.depthFunc = [](uint32_t) {};
+	functions.cullFace = [](uint32_t) {};
+	functions.deleteProgram = [](uint32_t) {};
+	functions.deleteVertexArray = [](uint32_t) {};
+	functions.deleteBuffer = [](uint32_t) {};
+	functions.deleteTexture = [](uint32_t) {};
+	functions.deleteFramebuffer = [](uint32_t) {};
+#endif
+
+	return functions;
+}
+
+GLStateCache::GLStateCache()
+{
+	SetFunctionTable(CreateDefaultFunctionTable());
+}
+
+void GLStateCache::SetFunctionTable(const GLFunctionTable& functions)
+{
+	functions_ = functions;
+	Invalidate();
+}
+
+void GLStateCache::Invalidate()
+{
+	program_ = UNKNOWN_STATE;
+	vertexArray_ = UNKNOWN_STATE;
+	framebuffer_ = UNKNOWN_STATE;
+	activeTextureUnit_ = UNKNOWN_STATE;
+	depthFunc_ = UNKNOWN_STATE;
+	cullFace_ = UNKNOWN_STATE;
+
+	for (uint32_t index = 0; index < 4; ++index)
+	{
+		blendFunc_[index] = UNKNOWN_STATE;
+	}
+
+	bIsKnownViewport_ = false;
+
+	buffers_.clear();
+	textures_.clear();
+	capabilities_.clear();
+}
+
+void GLStateCache::UseProgram(uint32_t program)
+{
+	if (Record(program_ == program))
+	{
+		functions_.useProgram(program);
+		program_ = program;
+	}
+}
+
+void GLStateCache::BindVertexArray(uint32_t vertexArray)
+{
+	if (Record(vertexArray_ == vertexArray))
+	{
+		functions_.bindVertexArray(vertexArray);
+		vertexArray_ = vertexArray;
+	}
+}
+
+void GLStateCache::BindBuffer(uint32_t target, uint32_t buffer)
+{
+	auto binding = buffers_.find(target);
+	if (Record(binding != buffers_.end() && binding->second == buffer))
+	{
+		functions_.bindBuffer(target, buffer);
+		buffers_[target] = buffer;
+	}
+}
+
+void GLStateCache::ActiveTexture(uint32_t unit)
+{
+	if (Record(activeTextureUnit_ == unit))
+	{
+		functions_.activeTexture(unit);
+		activeTextureUnit_ = unit;
+	}
+}
+
+void GLStateCache::BindTexture(uint32_t unit, uint32_t target, uint32_t texture)
+{
+	auto binding = textures_.find(GetTextureKey(unit, target));
+	if (binding != textures_.end() && binding->second == texture)
+	{
+		// ĳð  ؽó  Ȱȭ ε  ȣϹǷ,  ȣ   մϴ.
+		Record(true);
+		Record(true);
+		return;
+	}
+
+	ActiveTexture(unit);
+	BindTexture(target, texture);
+}
+
+void GLStateCache::BindTexture(uint32_t target, uint32_t texture)
+{
+	if (activeTextureUnit_ == UNKNOWN_STATE)
+	{
+		ActiveTexture(0);
+	}
+
+	uint64_t key = GetTextureKey(activeTextureUnit_, target);
+	auto binding = textures_.find(key);
+	if (Record(binding != textures_.end() && binding->second == texture))
+	{
+		functions_.bindTexture(target, texture);
+		textures_[key] = texture;
+	}
+}
+
+void GLStateCache::BindFramebuffer(uint32_t framebuffer)
+{
+	if (Record(framebuffer_ == framebuffer))
+	{
+		functions_.bindFramebuffer(framebuffer);
+		framebuffer_ = framebuffer;
+	}
+}
+
+void GLStateCache::SetViewport(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+	bool bIsSame = bIsKnownViewport_ && viewport_[0] == x && viewport_[1] == y && viewport_[2] == width && viewport_[3] == height;
+	if (Record(bIsSame))
+	{
+		functions_.viewport(x, y, width, height);
+
+		viewport_[0] = x;
+		viewport_[1] = y;
+		viewport_[2] = width;
+		viewport_[3] = height;
+		bIsKnownViewport_ = true;
+	}
+}
+
+void GLStateCache::SetCapability(uint32_t capability, bool bIsEnable)
+{
+	auto state = capabilities_.find(capability);
+	if (Record(state != capabilities_.end() && state->second == bIsEnable))
+	{
+		if (bIsEnable)
+		{
+			functions_.enable(capability);
+		}
+		else
+		{
+			functions_.disable(capability);
+		}
+
+		capabilities_[capability] = bIsEnable;
+	}
+}
+
+void GLStateCache::SetBlendFunc(uint32_t srcRGB, uint32_t dstRGB, uint32_t srcAlpha, uint32_t dstAlpha)
+{
+	bool bIsSame = blendFunc_[0] == srcRGB && blendFunc_[1] == dstRGB && blendFunc_[2] == srcAlpha && blendFunc_[3] == dstAlpha;
+	if (Record(bIsSame))
+	{
+		functions_.blendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha);
+
+		blendFunc_[0] = srcRGB;
+		blendFunc_[1] = dstRGB;
+		blendFunc_[2] = srcAlpha;
+		blendFunc_[3] = dstAlpha;
+	}
+}
+
+void GLStateCache::SetDepthFunc(uint32_t func)
+{
+	if (Record(depthFunc_ == func))
+	{
+		functions_.depthFunc(func);
+		depthFunc_ = func;
+	}
+}
+
+void GLStateCache::SetCullFace(uint32_t mode)
+{
+	if (Record(cullFace_ == mode))
+	{
+		functions_.cullFace(mode);
+		cullFace_ = mode;
+	}
+}
+
+void GLStateCache::DeleteProgram(uint32_t program)
+{
+	functions_.deleteProgram(program);
+
+	//   α׷  ǥø ǰ  ǹǷ,  ̸       Ӵϴ.
+	if (program_ == program)
+	{
+		program_ = UNKNOWN_STATE;
+	}
+}
+
+void GLStateCache::DeleteVertexArray(uint32_t vertexArray)
+{
+	functions_.deleteVertexArray(vertexArray);
+
+	if (vertexArray_ == vertexArray)
+	{
+		vertexArray_ = 0;
+	}
+}
+
+void GLStateCache::DeleteBuffer(uint32_t buffer)
+{
+	functions_.deleteBuffer(buffer);
+
+	for (auto& binding : buffers_)
+	{
+		if (binding.second == buffer)
+		{
+			binding.second = 0;
+		}
+	}
+}
+
+void GLStateCache::DeleteTexture(uint32_t texture)
+{
+	functions_.deleteTexture(texture);
+
+	for (auto& binding : textures_)
+	{
+		if (binding.second == texture)
+		{
+			binding.second = 0;
+		}
+	}
+}
+
+void GLStateCache::DeleteFramebuffer(uint32_t framebuffer)
+{
+	functions_.deleteFramebuffer(framebuffer);
+
+	if (framebuffer_ == framebuffer)
+	{
+		framebuffer_ = 0;
+	}
+}
+
+bool GLStateCache::Record(bool bIsElided)
+{
+	statistics_.countOfCall++;
+
+	if (bIsElided)
+	{
+		statistics_.countOfElided++;
+	}
+
+	return !bIsElided;
+}
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "Assertion.h"
 #include "GeometryShader2D.h"
+#include "GLStateCache.h"
 #include "MathUtils.h"
 
 GeometryShader2D::~GeometryShader2D()
@@ -12,17 +13,17 @@ GeometryShader2D::~GeometryShader2D()
 	}
 }
 
-void GeometryShader2D::Initialize(const std::wstring& vsPath, const std::wstring& fsPath)
+void GeometryShader2D::Initialize(const BufferView& vsSource, const BufferView& fsSource)
 {
 	ASSERT(!bIsInitialized_, "already initialize geometry shader 2d resource...");
 
-	Shader::Initialize(vsPath, fsPath);
+	Shader::Initialize(vsSource, fsSource);
 
 	GL_ASSERT(glGenVertexArrays(1, &vertexArrayObject_), "failed to generate 2d geometry vertex array...");
 	GL_ASSERT(glGenBuffers(1, &vertexBufferObject_), "failed to generate 2d geometry vertex buffer...");
 
-	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind 2d geometry vertex array...");
-	GL_ASSERT(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind 2d geometry vertex buffer...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(vertexArrayObject_), "failed to bind 2d geometry vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind 2d geometry vertex buffer...");
 	GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, VertexPositionColor::GetStride() * vertices_.size(), reinterpret_cast<const void*>(vertices_.data()), GL_DYNAMIC_DRAW),
 		"failed to create a new data store for a 2d geometry buffer object...");
 
@@ -34,7 +35,7 @@ void GeometryShader2D::Initialize(const std::wstring& vsPath, const std::wstring
 		"failed to specify the location and data format of the array of generic vertex attributes at index...");
 	GL_ASSERT(glEnableVertexAttribArray(1), "failed to enable vertex attrib array...");
 
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind 2d geometry vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(0), "failed to unbind 2d geometry vertex array...");
 }
 
 void GeometryShader2D::Release()
@@ -43,8 +44,8 @@ void GeometryShader2D::Release()
 
 	Shader::Release();
 
-	GL_ASSERT(glDeleteBuffers(1, &vertexBufferObject_), "failed to delete 2d geomety vertex buffer...");
-	GL_ASSERT(glDeleteVertexArrays(1, &vertexArrayObject_), "failed to delete 2d geometry vertex array object...");
+	GL_ASSERT(GLStateCache::Get().DeleteBuffer(vertexBufferObject_), "failed to delete 2d geomety vertex buffer...");
+	GL_ASSERT(GLStateCache::Get().DeleteVertexArray(vertexArrayObject_), "failed to delete 2d geometry vertex array object...");
 }
 
 void GeometryShader2D::DrawPoints2D(const Matrix4x4f& ortho, const std::vector<Vector2f>& positions, const Vector4f& color, float pointSize)
@@ -297,9 +298,9 @@ void GeometryShader2D::DrawGeometry2D(const Matrix4x4f& transform, const Matrix4
 	Shader::SetUniform("transform", transform);
 	Shader::SetUniform("ortho", ortho);
 
-	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind 2d geometry vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(vertexArrayObject_), "failed to bind 2d geometry vertex array...");
 	GL_ASSERT(glDrawArrays(static_cast<GLenum>(drawType), 0, vertexCount), "failed to draw 2d geometry...");
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind 2d geometry vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(0), "failed to unbind 2d geometry vertex array...");
 
 	Shader::Unbind();
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "Assertion.h"
 #include "GeometryShader3D.h"
+#include "GLStateCache.h"
 #include "MathUtils.h"
 
 GeometryShader3D::~GeometryShader3D()
@@ -12,17 +13,17 @@ GeometryShader3D::~GeometryShader3D()
 	}
 }
 
-void GeometryShader3D::Initialize(const std::wstring& vsPath, const std::wstring& fsPath)
+void GeometryShader3D::Initialize(const BufferView& vsSource, const BufferView& fsSource)
 {
 	ASSERT(!bIsInitialized_, "already initialize geometry shader 3d resource...");
 
-	Shader::Initialize(vsPath, fsPath);
+	Shader::Initialize(vsSource, fsSource);
 
 	GL_ASSERT(glGenVertexArrays(1, &vertexArrayObject_), "failed to generate 3d geometry vertex array...");
 	GL_ASSERT(glGenBuffers(1, &vertexBufferObject_), "failed to generate 3d geometry vertex buffer...");
 
-	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind 3d geometry vertex array...");
-	GL_ASSERT(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind 3d geometry vertex buffer...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(vertexArrayObject_), "failed to bind 3d geometry vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind 3d geometry vertex buffer...");
 	GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, VertexPositionColor::GetStride() * vertices_.size(), reinterpret_cast<const void*>(vertices_.data()), GL_DYNAMIC_DRAW),
 		"failed to create a new data store for a 3d geometry buffer object...");
 
@@ -34,7 +35,7 @@ void GeometryShader3D::Initialize(const std::wstring& vsPath, const std::wstring
 		"failed to specify the location and data format of the array of generic vertex attributes at index...");
 	GL_ASSERT(glEnableVertexAttribArray(1), "failed to enable vertex attrib array...");
 
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind 3d geometry vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(0), "failed to unbind 3d geometry vertex array...");
 }
 
 void GeometryShader3D::Release()
@@ -43,8 +44,8 @@ void GeometryShader3D::Release()
 
 	Shader::Release();
 
-	GL_ASSERT(glDeleteBuffers(1, &vertexBufferObject_), "failed to delete 3d geomety vertex buffer...");
-	GL_ASSERT(glDeleteVertexArrays(1, &vertexArrayObject_), "failed to delete 3d geometry vertex array object...");
+	GL_ASSERT(GLStateCache::Get().DeleteBuffer(vertexBufferObject_), "failed to delete 3d geomety vertex buffer...");
+	GL_ASSERT(GLStateCache::Get().DeleteVertexArray(vertexArrayObject_), "failed to delete 3d geometry vertex array object...");
 }
 
 void GeometryShader3D::DrawPoints3D(const Matrix4x4f& view, const Matrix4x4f& projection, const std::vector<Vector3f>& positions, const Vector4f& color)
@@ -300,9 +301,9 @@ void GeometryShader3D::DrawGeometry3D(const Matrix4x4f& world, const Matrix4x4f&
 	Shader::SetUniform("view", view);
 	Shader::SetUniform("projection", projection);
 
-	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind 3d geometry vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(vertexArrayObject_), "failed to bind 3d geometry vertex array...");
 	GL_ASSERT(glDrawArrays(static_cast<GLenum>(drawType), 0, vertexCount), "failed to draw 3d geometry...");
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind 3d geometry vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(0), "failed to unbind 3d geometry vertex array...");
 
 	Shader::Unbind();
 }
\ No newline at end of file
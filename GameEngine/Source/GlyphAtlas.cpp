@@ -0,0 +1,440 @@
+#include <cstring>
+#include <type_traits>
+
+#include <stb_rect_pack.h>
+#include <stb_truetype.h>
+
+#include "Assertion.h"
+#include "GlyphAtlas.h"
+#include "StringId.h"
+
+
+/**
+ * @brief ȭ ۸ ؽó Ʋ  ĺ Դϴ. 'GATL'Դϴ.
+ */
+static const uint32_t GLYPH_ATLAS_MAGIC = 0x4C544147;
+
+
+/**
+ * @brief ȭ ۸ ؽó Ʋ   Դϴ.
+ *
+ * @note  ̳ ŷ  ٲ   ÷   ȿȭմϴ.
+ */
+static const uint32_t GLYPH_ATLAS_VERSION = 2;
+
+
+/**
+ * @brief ȣ ִ Ÿ忡 ۸ ܰ  Դϴ.
+ */
+static const uint8_t SIGNED_DISTANCE_FIELD_ON_EDGE_VALUE = 128;
+
+
+/**
+ * @brief ȣ ִ Ÿ Ʋ󽺿 ۸ 簢  Դϴ.
+ *
+ * @note  ͸ ̿ ۸ Ÿ   ʵ մϴ.
+ */
+static const int32_t SIGNED_DISTANCE_FIELD_SPACING = 1;
+
+
+/**
+ * @brief ȭ ۸ ؽó Ʋ  Դϴ.
+ *
+ * @note  ڿ ۸  迭 Ʈ  ̾ϴ.
+ */
+struct GlyphAtlasHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint64_t sourceHash;
+	int32_t type;
+	int32_t distanceRange;
+	int32_t beginCodePoint;
+	int32_t endCodePoint;
+	float fontSize;
+	int32_t glyphAtlasSize;
+	float ascent;
+	float descent;
+	float lineGap;
+	uint32_t countOfGlyph;
+};
+
+
+/**
+ * @brief ȭ ۸ ؽó Ʋ Ͽ ϴ ۸ Դϴ.
+ *
+ * @note
+ * - Glyph Vector2i Ƿ ڸϰ   ϴ.  Ͽ  ü ٲ㼭 ϰ,   ʵ  Glyph մϴ.
+ * - ʵ  ũ   İ Ƿ   ٲ ʽϴ.
+ */
+struct GlyphRecord
+{
+	int32_t codePoint;
+	int32_t x0;
+	int32_t y0;
+	int32_t x1;
+	int32_t y1;
+	float xoffset;
+	float yoffset;
+	float xoffset2;
+	float yoffset2;
+	float xadvance;
+};
+
+static_assert(std::is_trivially_copyable_v<GlyphAtlasHeader>, "glyph atlas header must be trivially copyable...");
+static_assert(std::is_trivially_copyable_v<GlyphRecord>, "glyph record must be trivially copyable...");
+
+
+/**
+ * @brief Ʈ 迭 ؽ  ̾ մϴ.
+ *
+ * @note
+ * - Ʈ   MB   Ƿ, 8Ʈ  FNV-1a ϰ  Ʈ 1Ʈ  óմϴ.
+ * -   ٲ Ȯϴ 뵵̹Ƿ StringId ؽ   ʿ ϴ.
+ *
+ * @param bufferPtr ؽ   Ʈ 迭 Դϴ.
+ * @param size Ʈ 迭 ũԴϴ.
+ * @param hash   ؽ Դϴ.
+ *
+ * @return  ؽ  ȯմϴ.
+ */
+static uint64_t HashBytes(const void* bufferPtr, std::size_t size, uint64_t hash)
+{
+	const uint8_t* bytePtr = reinterpret_cast<const uint8_t*>(bufferPtr);
+
+	std::size_t index = 0;
+	for (; index + sizeof(uint64_t) <= size; index += sizeof(uint64_t))
+	{
+		uint64_t word = 0;
+		std::memcpy(&word, bytePtr + index, sizeof(uint64_t));
+
+		hash ^= word;
+		hash *= StringId::FNV_PRIME;
+	}
+
+	for (; index < size; ++index)
+	{
+		hash ^= static_cast<uint64_t>(bytePtr[index]);
+		hash *= StringId::FNV_PRIME;
+	}
+
+	return hash;
+}
+
+
+/**
+ * @brief Ʈ ũ⿡    Ʈ Ʈ մϴ.
+ *
+ * @param info ʱȭ stb_truetype Ʈ Դϴ.
+ * @param fontSize Ʈ ũԴϴ.
+ * @param outGlyphAtlas Ʈ Ʈ  ۸ ؽó ƲԴϴ.
+ */
+static void SetFontVerticalMetrics(const stbtt_fontinfo& info, float fontSize, GlyphAtlas& outGlyphAtlas)
+{
+	int32_t ascent = 0;
+	int32_t descent = 0;
+	int32_t lineGap = 0;
+	stbtt_GetFontVMetrics(&info, &ascent, &descent, &lineGap);
+
+	float scale = stbtt_ScaleForPixelHeight(&info, fontSize);
+	outGlyphAtlas.ascent = scale * static_cast<float>(ascent);
+	outGlyphAtlas.descent = scale * static_cast<float>(descent);
+	outGlyphAtlas.lineGap = scale * static_cast<float>(lineGap);
+}
+
+uint64_t GlyphAtlas::ComputeSourceHash(const BufferView& buffer, int32_t beginCodePoint, int32_t endCodePoint, float fontSize, EType type, int32_t distanceRange)
+{
+	uint64_t hash = HashBytes(buffer.GetData(), buffer.GetSize(), StringId::FNV_OFFSET_BASIS);
+	hash = HashBytes(&GLYPH_ATLAS_VERSION, sizeof(uint32_t), hash);
+	hash = HashBytes(&beginCodePoint, sizeof(int32_t), hash);
+	hash = HashBytes(&endCodePoint, sizeof(int32_t), hash);
+	hash = HashBytes(&fontSize, sizeof(float), hash);
+	hash = HashBytes(&type, sizeof(EType), hash);
+	hash = HashBytes(&distanceRange, sizeof(int32_t), hash);
+
+	return hash;
+}
+
+void GlyphAtlas::Pack(const BufferView& buffer, int32_t beginCodePoint, int32_t endCodePoint, float fontSize, GlyphAtlas& outGlyphAtlas)
+{
+	const unsigned char* bufferPtr = reinterpret_cast<const unsigned char*>(buffer.GetData());
+
+	stbtt_fontinfo info;
+	ASSERT((stbtt_InitFont(&info, bufferPtr, stbtt_GetFontOffsetForIndex(bufferPtr, 0)) != 0), "failed to initialize stb_truetype...");
+
+	std::vector<stbtt_packedchar> packedchars(endCodePoint - beginCodePoint + 1);
+	outGlyphAtlas.glyphs.resize(endCodePoint - beginCodePoint + 1);
+
+	int32_t success = 0;
+	stbtt_pack_context packContext;
+
+	for (int32_t size = 16; size < 8192; size *= 2)
+	{
+		outGlyphAtlas.bitmap.assign(size * size, 0);
+		success = stbtt_PackBegin(&packContext, outGlyphAtlas.bitmap.data(), size, size, 0, 1, nullptr);
+		stbtt_PackSetOversampling(&packContext, 1, 1);
+
+		success = stbtt_PackFontRange(
+			&packContext,
+			bufferPtr,
+			0,
+			fontSize,
+			beginCodePoint,
+			static_cast<int>(packedchars.size()),
+			&packedchars[0]
+		);
+
+		stbtt_PackEnd(&packContext);
+
+		if (success)
+		{
+			outGlyphAtlas.glyphAtlasSize = size;
+			break;
+		}
+	}
+
+	ASSERT(success, "failed to pack true type font glyph atlas...");
+
+	for (std::size_t index = 0; index < packedchars.size(); ++index)
+	{
+		Glyph& glyph = outGlyphAtlas.glyphs[index];
+
+		glyph.codePoint = static_cast<int32_t>(index + beginCodePoint);
+
+		glyph.position0 = Vector2i(packedchars[index].x0, packedchars[index].y0);
+		glyph.position1 = Vector2i(packedchars[index].x1, packedchars[index].y1);
+
+		glyph.xoffset = packedchars[index].xoff;
+		glyph.yoffset = packedchars[index].yoff;
+
+		glyph.xoffset2 = packedchars[index].xoff2;
+		glyph.yoffset2 = packedchars[index].yoff2;
+
+		glyph.xadvance = packedchars[index].xadvance;
+	}
+
+	SetFontVerticalMetrics(info, fontSize, outGlyphAtlas);
+
+	outGlyphAtlas.sourceHash = ComputeSourceHash(buffer, beginCodePoint, endCodePoint, fontSize, EType::Bitmap, 0);
+	outGlyphAtlas.type = EType::Bitmap;
+	outGlyphAtlas.distanceRange = 0;
+	outGlyphAtlas.beginCodePoint = beginCodePoint;
+	outGlyphAtlas.endCodePoint = endCodePoint;
+	outGlyphAtlas.fontSize = fontSize;
+}
+
+void GlyphAtlas::PackSignedDistanceField(const BufferView& buffer, int32_t beginCodePoint, int32_t endCodePoint, float fontSize, int32_t distanceRange, GlyphAtlas& outGlyphAtlas)
+{
+	ASSERT(distanceRange > 0, "invalid signed distance field range %d...", distanceRange);
+
+	const unsigned char* bufferPtr = reinterpret_cast<const unsigned char*>(buffer.GetData());
+
+	stbtt_fontinfo info;
+	ASSERT((stbtt_InitFont(&info, bufferPtr, stbtt_GetFontOffsetForIndex(bufferPtr, 0)) != 0), "failed to initialize stb_truetype...");
+
+	float scale = stbtt_ScaleForPixelHeight(&info, fontSize);
+	float pixelDistanceScale = static_cast<float>(SIGNED_DISTANCE_FIELD_ON_EDGE_VALUE) / static_cast<float>(distanceRange);
+
+	int32_t countOfGlyph = endCodePoint - beginCodePoint + 1;
+	std::vector<unsigned char*> distanceFields(countOfGlyph, nullptr);
+	std::vector<stbrp_rect> rects(countOfGlyph);
+	outGlyphAtlas.glyphs.resize(countOfGlyph);
+
+	for (int32_t index = 0; index < countOfGlyph; ++index)
+	{
+		int32_t codePoint = beginCodePoint + index;
+
+		int32_t width = 0;
+		int32_t height = 0;
+		int32_t xoffset = 0;
+		int32_t yoffset = 0;
+		distanceFields[index] = stbtt_GetCodepointSDF(&info, scale, codePoint, distanceRange, SIGNED_DISTANCE_FIELD_ON_EDGE_VALUE, pixelDistanceScale, &width, &height, &xoffset, &yoffset);
+
+		int32_t advanceWidth = 0;
+		int32_t leftSideBearing = 0;
+		stbtt_GetCodepointHMetrics(&info, codePoint, &advanceWidth, &leftSideBearing);
+
+		Glyph& glyph = outGlyphAtlas.glyphs[index];
+		glyph.codePoint = codePoint;
+		glyph.xoffset = static_cast<float>(xoffset);
+		glyph.yoffset = static_cast<float>(yoffset);
+		glyph.xoffset2 = static_cast<float>(xoffset + width);
+		glyph.yoffset2 = static_cast<float>(yoffset + height);
+		glyph.xadvance = scale * static_cast<float>(advanceWidth);
+
+		rects[index].id = index;
+		rects[index].w = (distanceFields[index] != nullptr) ? (width + SIGNED_DISTANCE_FIELD_SPACING) : 0;
+		rects[index].h = (distanceFields[index] != nullptr) ? (height + SIGNED_DISTANCE_FIELD_SPACING) : 0;
+	}
+
+	int32_t success = 0;
+	for (int32_t size = 16; size < 8192; size *= 2)
+	{
+		std::vector<stbrp_node> nodes(size);
+
+		stbrp_context packContext;
+		stbrp_init_target(&packContext, size, size, nodes.data(), static_cast<int>(nodes.size()));
+
+		success = stbrp_pack_rects(&packContext, rects.data(), static_cast<int>(rects.size()));
+		if (success)
+		{
+			outGlyphAtlas.glyphAtlasSize = size;
+			break;
+		}
+	}
+
+	ASSERT(success, "failed to pack signed distance field glyph atlas...");
+
+	int32_t glyphAtlasSize = outGlyphAtlas.glyphAtlasSize;
+	outGlyphAtlas.bitmap.assign(glyphAtlasSize * glyphAtlasSize, 0);
+
+	for (int32_t index = 0; index < countOfGlyph; ++index)
+	{
+		Glyph& glyph = outGlyphAtlas.glyphs[index];
+		if (distanceFields[index] == nullptr)
+		{
+			glyph.position0 = Vector2i(0, 0);
+			glyph.position1 = Vector2i(0, 0);
+			continue;
+		}
+
+		int32_t width = rects[index].w - SIGNED_DISTANCE_FIELD_SPACING;
+		int32_t height = rects[index].h - SIGNED_DISTANCE_FIELD_SPACING;
+
+		glyph.position0 = Vector2i(rects[index].x, rects[index].y);
+		glyph.position1 = Vector2i(rects[index].x + width, rects[index].y + height);
+
+		for (int32_t y = 0; y < height; ++y)
+		{
+			uint8_t* rowPtr = outGlyphAtlas.bitmap.data() + (rects[index].y + y) * glyphAtlasSize + rects[index].x;
+			std::memcpy(rowPtr, distanceFields[index] + y * width, width);
+		}
+
+		stbtt_FreeSDF(distanceFields[index], nullptr);
+	}
+
+	SetFontVerticalMetrics(info, fontSize, outGlyphAtlas);
+
+	outGlyphAtlas.sourceHash = ComputeSourceHash(buffer, beginCodePoint, endCodePoint, fontSize, EType::SignedDistanceField, distanceRange);
+	outGlyphAtlas.type = EType::SignedDistanceField;
+	outGlyphAtlas.distanceRange = distanceRange;
+	outGlyphAtlas.beginCodePoint = beginCodePoint;
+	outGlyphAtlas.endCodePoint = endCodePoint;
+	outGlyphAtlas.fontSize = fontSize;
+}
+
+std::vector<uint8_t> GlyphAtlas::Serialize() const
+{
+	GlyphAtlasHeader header;
+	header.magic = GLYPH_ATLAS_MAGIC;
+	header.version = GLYPH_ATLAS_VERSION;
+	header.sourceHash = sourceHash;
+	header.type = static_cast<int32_t>(type);
+	header.distanceRange = distanceRange;
+	header.beginCodePoint = beginCodePoint;
+	header.endCodePoint = endCodePoint;
+	header.fontSize = fontSize;
+	header.glyphAtlasSize = glyphAtlasSize;
+	header.ascent = ascent;
+	header.descent = descent;
+	header.lineGap = lineGap;
+	header.countOfGlyph = static_cast<uint32_t>(glyphs.size());
+
+	std::size_t glyphByteSize = sizeof(GlyphRecord) * glyphs.size();
+	std::vector<uint8_t> buffer(sizeof(GlyphAtlasHeader) + glyphByteSize + bitmap.size());
+
+	uint8_t* bufferPtr = buffer.data();
+	std::memcpy(bufferPtr, &header, sizeof(GlyphAtlasHeader));
+	bufferPtr += sizeof(GlyphAtlasHeader);
+
+	for (const auto& glyph : glyphs)
+	{
+		GlyphRecord record;
+		record.codePoint = glyph.codePoint;
+		record.x0 = glyph.position0.x;
+		record.y0 = glyph.position0.y;
+		record.x1 = glyph.position1.x;
+		record.y1 = glyph.position1.y;
+		record.xoffset = glyph.xoffset;
+		record.yoffset = glyph.yoffset;
+		record.xoffset2 = glyph.xoffset2;
+		record.yoffset2 = glyph.yoffset2;
+		record.xadvance = glyph.xadvance;
+
+		std::memcpy(bufferPtr, &record, sizeof(GlyphRecord));
+		bufferPtr += sizeof(GlyphRecord);
+	}
+
+	std::memcpy(bufferPtr, bitmap.data(), bitmap.size());
+
+	return buffer;
+}
+
+bool GlyphAtlas::Deserialize(const BufferView& buffer, uint64_t sourceHash, GlyphAtlas& outGlyphAtlas)
+{
+	if (buffer.GetSize() < sizeof(GlyphAtlasHeader))
+	{
+		return false;
+	}
+
+	GlyphAtlasHeader header;
+	std::memcpy(&header, buffer.GetData(), sizeof(GlyphAtlasHeader));
+
+	if (header.magic != GLYPH_ATLAS_MAGIC || header.version != GLYPH_ATLAS_VERSION || header.sourceHash != sourceHash)
+	{
+		return false;
+	}
+
+	if (header.type != static_cast<int32_t>(EType::Bitmap) && header.type != static_cast<int32_t>(EType::SignedDistanceField))
+	{
+		return false;
+	}
+
+	if (header.beginCodePoint > header.endCodePoint
+		|| header.countOfGlyph != static_cast<uint32_t>(header.endCodePoint - header.beginCodePoint + 1)
+		|| header.glyphAtlasSize <= 0 || header.glyphAtlasSize >= 8192)
+	{
+		return false;
+	}
+
+	std::size_t glyphByteSize = sizeof(GlyphRecord) * static_cast<std::size_t>(header.countOfGlyph);
+	std::size_t bitmapByteSize = static_cast<std::size_t>(header.glyphAtlasSize) * static_cast<std::size_t>(header.glyphAtlasSize);
+	if (buffer.GetSize() != sizeof(GlyphAtlasHeader) + glyphByteSize + bitmapByteSize)
+	{
+		return false;
+	}
+
+	const uint8_t* bufferPtr = buffer.GetData() + sizeof(GlyphAtlasHeader);
+
+	outGlyphAtlas.glyphs.resize(header.countOfGlyph);
+	for (auto& glyph : outGlyphAtlas.glyphs)
+	{
+		GlyphRecord record;
+		std::memcpy(&record, bufferPtr, sizeof(GlyphRecord));
+		bufferPtr += sizeof(GlyphRecord);
+
+		glyph.codePoint = record.codePoint;
+		glyph.position0 = Vector2i(record.x0, record.y0);
+		glyph.position1 = Vector2i(record.x1, record.y1);
+		glyph.xoffset = record.xoffset;
+		glyph.yoffset = record.yoffset;
+		glyph.xoffset2 = record.xoffset2;
+		glyph.yoffset2 = record.yoffset2;
+		glyph.xadvance = record.xadvance;
+	}
+
+	outGlyphAtlas.bitmap.assign(bufferPtr, bufferPtr + bitmapByteSize);
+
+	outGlyphAtlas.sourceHash = header.sourceHash;
+	outGlyphAtlas.type = static_cast<EType>(header.type);
+	outGlyphAtlas.distanceRange = header.distanceRange;
+	outGlyphAtlas.beginCodePoint = header.beginCodePoint;
+	outGlyphAtlas.endCodePoint = header.endCodePoint;
+	outGlyphAtlas.fontSize = header.fontSize;
+	outGlyphAtlas.glyphAtlasSize = header.glyphAtlasSize;
+	outGlyphAtlas.ascent = header.ascent;
+	outGlyphAtlas.descent = header.descent;
+	outGlyphAtlas.lineGap = header.lineGap;
+
+	return true;
+}
\ No newline at end of file
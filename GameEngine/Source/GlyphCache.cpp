@@ -0,0 +1,502 @@
+#include <algorithm>
+
+#if !defined(HEADLESS_MODE)
+#include <glad/glad.h>
+#endif
+
+#include "Assertion.h"
+#include "GLStateCache.h"
+#include "GlyphCache.h"
+
+#if !defined(HEADLESS_MODE)
+#include "FileUtils.h"
+#endif
+
+
+/**
+ * @brief Ʋ  ۸ 簢  Դϴ.
+ *
+ * @note  ͸ ̿ ۸ ȼ  ʵ մϴ.
+ */
+static const int32_t GLYPH_SPACING = 1;
+
+GlyphCache::~GlyphCache()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+#if !defined(HEADLESS_MODE)
+void GlyphCache::Initialize(const std::wstring& path, float fontSize, int32_t pageSize, int32_t maxCountOfPage)
+{
+	Initialize(FileUtils::ReadBufferFromFile(path), fontSize, pageSize, maxCountOfPage);
+}
+#endif
+
+void GlyphCache::Initialize(const std::vector<uint8_t>& buffer, float fontSize, int32_t pageSize, int32_t maxCountOfPage)
+{
+	ASSERT(!bIsInitialized_, "already initialize glyph cache resource...");
+	ASSERT(!buffer.empty(), "invalid true type font buffer...");
+	ASSERT(pageSize > 0 && maxCountOfPage > 0, "invalid glyph cache page %d x %d...", pageSize, maxCountOfPage);
+
+	buffer_ = buffer;
+
+	const unsigned char* bufferPtr = reinterpret_cast<const unsigned char*>(buffer_.data());
+	ASSERT((stbtt_InitFont(&info_, bufferPtr, stbtt_GetFontOffsetForIndex(bufferPtr, 0)) != 0), "failed to initialize stb_truetype...");
+
+	fontSize_ = fontSize;
+	scale_ = stbtt_ScaleForPixelHeight(&info_, fontSize);
+	pageSize_ = pageSize;
+
+	repackNodes_.resize(pageSize_);
+	repackBitmap_.resize(pageSize_ * pageSize_);
+
+	pages_.resize(maxCountOfPage);
+	for (Page& page : pages_)
+	{
+		page.nodes.resize(pageSize_);
+		page.bitmap.assign(pageSize_ * pageSize_, 0);
+		ResetPage(page);
+
+#if !defined(HEADLESS_MODE)
+		GL_ASSERT(glGenTextures(1, &page.textureID), "failed to generate glyph cache page...");
+		GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, page.textureID), "failed to bind glyph cache page...");
+
+		GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE), "failed to set glyph cache page warp s...");
+		GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE), "failed to set glyph cache page warp t...");
+		GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR), "failed to set glyph cache page min filter...");
+		GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR), "failed to set glyph cache page mag filter...");
+
+		//  Ӹ Ϻ  ٽ Ƿ, Ӹ  ʽϴ.
+		GL_ASSERT(glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, pageSize_, pageSize_, 0, GL_RED, GL_UNSIGNED_BYTE, reinterpret_cast<const void*>(page.bitmap.data())),
+			"failed to allows elements of an image array to be read by shaders...");
+
+		GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, 0), "failed to unbind glyph cache page...");
+#endif
+	}
+
+	countOfOpenPage_ = 0;
+	frame_ = 1;
+	order_ = 0;
+	statistics_ = Statistics();
+
+	bIsInitialized_ = true;
+}
+
+void GlyphCache::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+#if !defined(HEADLESS_MODE)
+	for (Page& page : pages_)
+	{
+		GL_ASSERT(GLStateCache::Get().DeleteTexture(page.textureID), "failed to delete glyph cache page...");
+	}
+#endif
+
+	pages_.clear();
+	glyphs_.clear();
+	repackNodes_.clear();
+	repackBitmap_.clear();
+	buffer_.clear();
+
+	bIsInitialized_ = false;
+}
+
+const GlyphCache::CachedGlyph* GlyphCache::FindOrAddGlyph(int32_t codePoint)
+{
+	auto it = glyphs_.find(codePoint);
+	if (it != glyphs_.end())
+	{
+		statistics_.countOfHit++;
+		it->second.lastUsedFrame = frame_;
+
+		if (it->second.page >= 0)
+		{
+			TouchPage(it->second.page);
+		}
+
+		return &it->second;
+	}
+
+	statistics_.countOfMiss++;
+
+	int32_t advanceWidth = 0;
+	int32_t leftSideBearing = 0;
+	stbtt_GetCodepointHMetrics(&info_, codePoint, &advanceWidth, &leftSideBearing);
+
+	int32_t x0 = 0;
+	int32_t y0 = 0;
+	int32_t x1 = 0;
+	int32_t y1 = 0;
+	stbtt_GetCodepointBitmapBox(&info_, codePoint, scale_, scale_, &x0, &y0, &x1, &y1);
+
+	int32_t width = x1 - x0;
+	int32_t height = y1 - y0;
+
+	CachedGlyph cachedGlyph;
+	cachedGlyph.glyph.codePoint = codePoint;
+	cachedGlyph.glyph.position0 = Vector2i(0, 0);
+	cachedGlyph.glyph.position1 = Vector2i(0, 0);
+	cachedGlyph.glyph.xoffset = static_cast<float>(x0);
+	cachedGlyph.glyph.yoffset = static_cast<float>(y0);
+	cachedGlyph.glyph.xoffset2 = static_cast<float>(x1);
+	cachedGlyph.glyph.yoffset2 = static_cast<float>(y1);
+	cachedGlyph.glyph.xadvance = scale_ * static_cast<float>(advanceWidth);
+	cachedGlyph.lastUsedFrame = frame_;
+
+	if (width > 0 && height > 0)
+	{
+		if (width + GLYPH_SPACING > pageSize_ || height + GLYPH_SPACING > pageSize_)
+		{
+			statistics_.countOfOverflow++;
+			return nullptr;
+		}
+
+		int32_t pageIndex = -1;
+		Vector2i position;
+
+		for (int32_t index = 0; index < countOfOpenPage_; ++index)
+		{
+			if (PackRect(pages_[index], width, height, position))
+			{
+				pageIndex = index;
+				break;
+			}
+		}
+
+		if (pageIndex < 0 && countOfOpenPage_ < static_cast<int32_t>(pages_.size()))
+		{
+			pageIndex = countOfOpenPage_++;
+
+			bool bIsPacked = PackRect(pages_[pageIndex], width, height, position);
+			ASSERT(bIsPacked, "failed to pack glyph %d into empty page...", codePoint);
+		}
+
+		if (pageIndex < 0)
+		{
+			//      ٸ     ٽ մϴ.
+			pageIndex = RecycleLeastRecentlyUsedPage(width, height, position);
+			if (pageIndex < 0)
+			{
+				statistics_.countOfOverflow++;
+				return nullptr;
+			}
+		}
+
+		Page& page = pages_[pageIndex];
+		uint8_t* bitmapPtr = page.bitmap.data() + position.y * pageSize_ + position.x;
+		stbtt_MakeCodepointBitmap(&info_, bitmapPtr, width, height, pageSize_, scale_, scale_, codePoint);
+
+		cachedGlyph.glyph.position0 = position;
+		cachedGlyph.glyph.position1 = Vector2i(position.x + width, position.y + height);
+		cachedGlyph.page = pageIndex;
+
+		if (page.bIsDirty)
+		{
+			page.dirtyMin = Vector2i(std::min(page.dirtyMin.x, position.x), std::min(page.dirtyMin.y, position.y));
+			page.dirtyMax = Vector2i(std::max(page.dirtyMax.x, position.x + width), std::max(page.dirtyMax.y, position.y + height));
+		}
+		else
+		{
+			page.bIsDirty = true;
+			page.dirtyMin = cachedGlyph.glyph.position0;
+			page.dirtyMax = cachedGlyph.glyph.position1;
+		}
+
+		page.codePoints.push_back(codePoint);
+		TouchPage(pageIndex);
+	}
+
+	return &glyphs_.emplace(codePoint, cachedGlyph).first->second;
+}
+
+uint32_t GlyphCache::GenerateGlyphVertices(std::wstring_view text, const Vector2f& center, TextLayout::GlyphVertex* outVertices, std::vector<uint32_t>& outCountOfPageVertices)
+{
+	textGlyphs_.clear();
+	for (const auto& unicode : text)
+	{
+		textGlyphs_.push_back(FindOrAddGlyph(static_cast<int32_t>(unicode)));
+	}
+
+	return WriteGlyphVertices(center, outVertices, outCountOfPageVertices);
+}
+
+void GlyphCache::RequestGlyphs(std::wstring_view text)
+{
+	for (const auto& unicode : text)
+	{
+		FindOrAddGlyph(static_cast<int32_t>(unicode));
+	}
+}
+
+uint32_t GlyphCache::GenerateRequestedGlyphVertices(std::wstring_view text, const Vector2f& center, TextLayout::GlyphVertex* outVertices, std::vector<uint32_t>& outCountOfPageVertices)
+{
+	textGlyphs_.clear();
+	for (const auto& unicode : text)
+	{
+		auto it = glyphs_.find(static_cast<int32_t>(unicode));
+		textGlyphs_.push_back(it != glyphs_.end() ? &it->second : nullptr);
+	}
+
+	return WriteGlyphVertices(center, outVertices, outCountOfPageVertices);
+}
+
+uint32_t GlyphCache::WriteGlyphVertices(const Vector2f& center, TextLayout::GlyphVertex* outVertices, std::vector<uint32_t>& outCountOfPageVertices)
+{
+	outCountOfPageVertices.assign(pages_.size(), 0);
+
+	int32_t textWidth = 0;
+	int32_t textHeight = -1;
+
+	for (const CachedGlyph* cachedGlyph : textGlyphs_)
+	{
+		if (cachedGlyph == nullptr)
+		{
+			continue;
+		}
+
+		const Glyph& glyph = cachedGlyph->glyph;
+		textWidth += static_cast<int32_t>(glyph.xadvance);
+		textHeight = std::max(textHeight, glyph.position1.y - glyph.position0.y);
+
+		if (cachedGlyph->page >= 0)
+		{
+			outCountOfPageVertices[cachedGlyph->page] += 6;
+		}
+	}
+
+	pageVertexOffsets_.assign(pages_.size(), 0);
+	uint32_t vertexCount = 0;
+	for (std::size_t page = 0; page < pages_.size(); ++page)
+	{
+		pageVertexOffsets_[page] = vertexCount;
+		vertexCount += outCountOfPageVertices[page];
+	}
+
+	float pageSize = static_cast<float>(pageSize_);
+	Vector2f position(center.x - static_cast<float>(textWidth) / 2.0f, center.y + static_cast<float>(textHeight) / 2.0f);
+
+	for (const CachedGlyph* cachedGlyph : textGlyphs_)
+	{
+		if (cachedGlyph == nullptr)
+		{
+			continue;
+		}
+
+		const Glyph& glyph = cachedGlyph->glyph;
+		if (cachedGlyph->page >= 0)
+		{
+			TextLayout::GlyphVertex* vertices = outVertices + pageVertexOffsets_[cachedGlyph->page];
+			pageVertexOffsets_[cachedGlyph->page] += 6;
+
+			float unicodeWidth = static_cast<float>(glyph.position1.x - glyph.position0.x);
+			float unicodeHeight = static_cast<float>(glyph.position1.y - glyph.position0.y);
+
+			vertices[0].position = Vector3f(position.x + glyph.xoffset, position.y + glyph.yoffset, 0.0f);
+			vertices[0].texture  = Vector2f(static_cast<float>(glyph.position0.x) / pageSize, static_cast<float>(glyph.position0.y) / pageSize);
+
+			vertices[1].position = Vector3f(position.x + glyph.xoffset, position.y + unicodeHeight + glyph.yoffset, 0.0f);
+			vertices[1].texture  = Vector2f(static_cast<float>(glyph.position0.x) / pageSize, static_cast<float>(glyph.position1.y) / pageSize);
+
+
+			vertices[2].position = Vector3f(position.x + glyph.xoffset + unicodeWidth, position.y + glyph.yoffset, 0.0f);
+			vertices[2].texture  = Vector2f(static_cast<float>(glyph.position1.x) / pageSize, static_cast<float>(glyph.position0.y) / pageSize);
+
+			vertices[3].position = Vector3f(position.x + glyph.xoffset + unicodeWidth, position.y + glyph.yoffset, 0.0f);
+			vertices[3].texture  = Vector2f(static_cast<float>(glyph.position1.x) / pageSize, static_cast<float>(glyph.position0.y) / pageSize);
+
+
+			vertices[4].position = Vector3f(position.x + glyph.xoffset, position.y + unicodeHeight + glyph.yoffset, 0.0f);
+			vertices[4].texture  = Vector2f(static_cast<float>(glyph.position0.x) / pageSize, static_cast<float>(glyph.position1.y) / pageSize);
+
+			vertices[5].position = Vector3f(position.x + glyph.xoffset + unicodeWidth, position.y + unicodeHeight + glyph.yoffset, 0.0f);
+			vertices[5].texture  = Vector2f(static_cast<float>(glyph.position1.x) / pageSize, static_cast<float>(glyph.position1.y) / pageSize);
+		}
+
+		position.x += glyph.xadvance;
+	}
+
+	return vertexCount;
+}
+
+void GlyphCache::Flush()
+{
+	for (Page& page : pages_)
+	{
+		if (!page.bIsDirty)
+		{
+			continue;
+		}
+
+		int32_t width = page.dirtyMax.x - page.dirtyMin.x;
+		int32_t height = page.dirtyMax.y - page.dirtyMin.y;
+
+#if !defined(HEADLESS_MODE)
+		GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, page.textureID), "failed to bind glyph cache page...");
+
+		// CPU Ʈʿ     ̿  ġ մϴ.
+		GL_ASSERT(glPixelStorei(GL_UNPACK_ALIGNMENT, 1), "failed to set unpack alignment...");
+		GL_ASSERT(glPixelStorei(GL_UNPACK_ROW_LENGTH, pageSize_), "failed to set unpack row length...");
+		GL_ASSERT(glPixelStorei(GL_UNPACK_SKIP_PIXELS, page.dirtyMin.x), "failed to set unpack skip pixels...");
+		GL_ASSERT(glPixelStorei(GL_UNPACK_SKIP_ROWS, page.dirtyMin.y), "failed to set unpack skip rows...");
+
+		GL_ASSERT(glTexSubImage2D(GL_TEXTURE_2D, 0, page.dirtyMin.x, page.dirtyMin.y, width, height, GL_RED, GL_UNSIGNED_BYTE, reinterpret_cast<const void*>(page.bitmap.data())),
+			"failed to update a subset of glyph cache page...");
+
+		GL_ASSERT(glPixelStorei(GL_UNPACK_SKIP_ROWS, 0), "failed to reset unpack skip rows...");
+		GL_ASSERT(glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0), "failed to reset unpack skip pixels...");
+		GL_ASSERT(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0), "failed to reset unpack row length...");
+		GL_ASSERT(glPixelStorei(GL_UNPACK_ALIGNMENT, 4), "failed to reset unpack alignment...");
+
+		GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, 0), "failed to unbind glyph cache page...");
+#endif
+
+		statistics_.countOfUpload++;
+		statistics_.uploadBytes += static_cast<uint64_t>(width) * static_cast<uint64_t>(height);
+
+		page.bIsDirty = false;
+	}
+}
+
+void GlyphCache::Tick()
+{
+	Flush();
+	frame_++;
+}
+
+void GlyphCache::ResetPage(Page& page)
+{
+	stbrp_init_target(&page.packContext, pageSize_, pageSize_, page.nodes.data(), static_cast<int>(page.nodes.size()));
+	std::fill(page.bitmap.begin(), page.bitmap.end(), 0);
+	page.codePoints.clear();
+}
+
+bool GlyphCache::PackRect(Page& page, int32_t width, int32_t height, Vector2i& outPosition)
+{
+	stbrp_rect rect;
+	rect.id = 0;
+	rect.w = width + GLYPH_SPACING;
+	rect.h = height + GLYPH_SPACING;
+
+	if (!stbrp_pack_rects(&page.packContext, &rect, 1))
+	{
+		return false;
+	}
+
+	outPosition = Vector2i(rect.x, rect.y);
+	return true;
+}
+
+int32_t GlyphCache::RecycleLeastRecentlyUsedPage(int32_t width, int32_t height, Vector2i& outPosition)
+{
+	pageOrder_.resize(countOfOpenPage_);
+	for (int32_t index = 0; index < countOfOpenPage_; ++index)
+	{
+		pageOrder_[index] = index;
+	}
+
+	std::sort(pageOrder_.begin(), pageOrder_.end(), [&](int32_t lhs, int32_t rhs) { return pages_[lhs].lastUsedOrder < pages_[rhs].lastUsedOrder; });
+
+	for (const int32_t& pageIndex : pageOrder_)
+	{
+		if (RecyclePage(pages_[pageIndex], width, height, outPosition))
+		{
+			return pageIndex;
+		}
+	}
+
+	return -1;
+}
+
+bool GlyphCache::RecyclePage(Page& page, int32_t width, int32_t height, Vector2i& outPosition)
+{
+	repackRects_.clear();
+	for (std::size_t index = 0; index < page.codePoints.size(); ++index)
+	{
+		const CachedGlyph& cachedGlyph = glyphs_.at(page.codePoints[index]);
+		if (cachedGlyph.lastUsedFrame != frame_)
+		{
+			continue;
+		}
+
+		stbrp_rect rect;
+		rect.id = static_cast<int>(index);
+		rect.w = cachedGlyph.glyph.position1.x - cachedGlyph.glyph.position0.x + GLYPH_SPACING;
+		rect.h = cachedGlyph.glyph.position1.y - cachedGlyph.glyph.position0.y + GLYPH_SPACING;
+		repackRects_.push_back(rect);
+	}
+
+	if (repackRects_.size() == page.codePoints.size())
+	{
+		return false;
+	}
+
+	stbrp_rect newRect;
+	newRect.id = -1;
+	newRect.w = width + GLYPH_SPACING;
+	newRect.h = height + GLYPH_SPACING;
+	repackRects_.push_back(newRect);
+
+	int countOfRect = static_cast<int>(repackRects_.size());
+	stbrp_init_target(&repackContext_, pageSize_, pageSize_, repackNodes_.data(), static_cast<int>(repackNodes_.size()));
+	if (!stbrp_pack_rects(&repackContext_, repackRects_.data(), countOfRect))
+	{
+		return false;
+	}
+
+	repackCodePoints_.swap(page.codePoints);
+	std::copy(page.bitmap.begin(), page.bitmap.end(), repackBitmap_.begin());
+
+	for (const int32_t& codePoint : repackCodePoints_)
+	{
+		if (glyphs_.at(codePoint).lastUsedFrame != frame_)
+		{
+			glyphs_.erase(codePoint);
+			statistics_.countOfEvictedGlyph++;
+		}
+	}
+
+	// ӽ ŷ ¿  Է ٽ ġϹǷ  ŷ  ϴ.
+	ResetPage(page);
+	bool bIsPacked = (stbrp_pack_rects(&page.packContext, repackRects_.data(), countOfRect) != 0);
+	ASSERT(bIsPacked, "failed to repack glyph cache page...");
+
+	for (int32_t index = 0; index < countOfRect - 1; ++index)
+	{
+		const stbrp_rect& rect = repackRects_[index];
+		int32_t codePoint = repackCodePoints_[rect.id];
+		Glyph& glyph = glyphs_.at(codePoint).glyph;
+
+		int32_t glyphWidth = glyph.position1.x - glyph.position0.x;
+		int32_t glyphHeight = glyph.position1.y - glyph.position0.y;
+		for (int32_t y = 0; y < glyphHeight; ++y)
+		{
+			const uint8_t* srcPtr = repackBitmap_.data() + (glyph.position0.y + y) * pageSize_ + glyph.position0.x;
+			std::copy(srcPtr, srcPtr + glyphWidth, page.bitmap.data() + (rect.y + y) * pageSize_ + rect.x);
+		}
+
+		glyph.position0 = Vector2i(rect.x, rect.y);
+		glyph.position1 = Vector2i(rect.x + glyphWidth, rect.y + glyphHeight);
+		page.codePoints.push_back(codePoint);
+	}
+
+	outPosition = Vector2i(repackRects_.back().x, repackRects_.back().y);
+
+	statistics_.countOfEvictedPage++;
+	statistics_.countOfMovedGlyph += static_cast<uint64_t>(countOfRect - 1);
+
+	// ۸ ٽ ġǷ  ü ٽ ϴ.
+	page.bIsDirty = true;
+	page.dirtyMin = Vector2i(0, 0);
+	page.dirtyMax = Vector2i(pageSize_, pageSize_);
+
+	return true;
+}
+
+void GlyphCache::TouchPage(int32_t page)
+{
+	pages_[page].lastUsedOrder = ++order_;
+}
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include <glad/glad.h>
 
 #include "Assertion.h"
+#include "GLStateCache.h"
+#include "GlyphCache.h"
 #include "GlyphShader2D.h"
 #include "TTFont.h"
 
@@ -12,29 +14,29 @@ GlyphShader2D::~GlyphShader2D()
 	}
 }
 
-void GlyphShader2D::Initialize(const std::wstring& vsPath, const std::wstring& fsPath)
+void GlyphShader2D::Initialize(const BufferView& vsSource, const BufferView& fsSource)
 {
 	ASSERT(!bIsInitialized_, "already initialize glyph shader 2d resource...");
 
-	Shader::Initialize(vsPath, fsPath);
+	Shader::Initialize(vsSource, fsSource);
 
 	GL_ASSERT(glGenVertexArrays(1, &vertexArrayObject_), "failed to generate glyph vertex array...");
 	GL_ASSERT(glGenBuffers(1, &vertexBufferObject_), "failed to generate glyph vertex buffer...");
 
-	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind glyph vertex array...");
-	GL_ASSERT(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind glyph vertex buffer...");
-	GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, VertexPositionTexture::GetStride() * vertices_.size(), reinterpret_cast<const void*>(vertices_.data()), GL_DYNAMIC_DRAW),
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(vertexArrayObject_), "failed to bind glyph vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind glyph vertex buffer...");
+	GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, TextLayout::GlyphVertex::GetStride() * vertices_.size(), reinterpret_cast<const void*>(vertices_.data()), GL_DYNAMIC_DRAW),
 		"failed to create a new data store for a glyph buffer object...");
 
-	GL_ASSERT(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, VertexPositionTexture::GetStride(), (void*)(offsetof(VertexPositionTexture, position))),
+	GL_ASSERT(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, TextLayout::GlyphVertex::GetStride(), (void*)(offsetof(TextLayout::GlyphVertex, position))),
 		"failed to specify the location and data format of the array of generic vertex attributes at index...");
 	GL_ASSERT(glEnableVertexAttribArray(0), "failed to enable vertex attrib array...");
 
-	GL_ASSERT(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, VertexPositionTexture::GetStride(), (void*)(offsetof(VertexPositionTexture, texture))),
+	GL_ASSERT(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, TextLayout::GlyphVertex::GetStride(), (void*)(offsetof(TextLayout::GlyphVertex, texture))),
 		"failed to specify the location and data format of the array of generic vertex attributes at index...");
 	GL_ASSERT(glEnableVertexAttribArray(1), "failed to enable vertex attrib array...");
 
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind glyph vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(0), "failed to unbind glyph vertex array...");
 
 	Shader::Bind();
 	orthoLocation_ = GetUniformLocation("ortho");
@@ -48,77 +50,130 @@ void GlyphShader2D::Release()
 
 	Shader::Release();
 
-	GL_ASSERT(glDeleteBuffers(1, &vertexBufferObject_), "failed to delete glyph vertex buffer...");
-	GL_ASSERT(glDeleteVertexArrays(1, &vertexArrayObject_), "failed to delete glyph vertex array object...");
+	GL_ASSERT(GLStateCache::Get().DeleteBuffer(vertexBufferObject_), "failed to delete glyph vertex buffer...");
+	GL_ASSERT(GLStateCache::Get().DeleteVertexArray(vertexArrayObject_), "failed to delete glyph vertex array object...");
 }
 
-void GlyphShader2D::DrawText2D(const Matrix4x4f& ortho, const TTFont* font, const std::wstring& text, const Vector2f& center, const Vector4f& color)
+void GlyphShader2D::DrawText2D(const Matrix4x4f& ortho, const TTFont* font, std::wstring_view text, const Vector2f& center, const Vector4f& color)
 {
 	ASSERT(text.length() <= MAX_STRING_LEN, L"overflow text length for draw %d...", text.length());
 	ASSERT(font != nullptr, "invalid font resource...");
 
 	int32_t vertexCount = UpdateGlyphVertexBuffer(font, text, center);
 
+	// ؽƮ ϴ  GPU ۿ ϴ.
 	const void* bufferPtr = reinterpret_cast<const void*>(vertices_.data());
-	uint32_t bufferByteSize = static_cast<uint32_t>(VertexPositionTexture::GetStride() * vertices_.size());
-	WriteDynamicVertexBuffer(vertexBufferObject_, bufferPtr, bufferByteSize);
+	uint32_t bufferByteSize = static_cast<uint32_t>(TextLayout::GlyphVertex::GetStride() * vertexCount);
+	if (bufferByteSize > 0)
+	{
+		WriteDynamicVertexBuffer(vertexBufferObject_, bufferPtr, bufferByteSize);
+	}
 
 	Shader::Bind();
 
-	GL_ASSERT(glActiveTexture(GL_TEXTURE0), "failed to active glyph texture atlas...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, font->GetGlyphAtlasID()), "failed to bind glyph texture atlas...");
-
-	Shader::SetUniform("ortho", ortho);
-	Shader::SetUniform("glyphColor", color);
+	BindGlyphAtlas(ortho, font, color);
 
-	glBindVertexArray(vertexArrayObject_);
+	GLStateCache::Get().BindVertexArray(vertexArrayObject_);
 	glDrawArrays(GL_TRIANGLES, 0, vertexCount);
-	glBindVertexArray(0);
+	GLStateCache::Get().BindVertexArray(0);
 
 	Shader::Unbind();
 }
 
-uint32_t GlyphShader2D::UpdateGlyphVertexBuffer(const TTFont* font, const std::wstring& text, const Vector2f& center)
+void GlyphShader2D::DrawText2D(const Matrix4x4f& ortho, GlyphCache* glyphCache, std::wstring_view text, const Vector2f& center, const Vector4f& color)
 {
-	float glyphAtlasSize = static_cast<float>(font->GetGlyphAtlasSize());
+	ASSERT(text.length() <= MAX_STRING_LEN, L"overflow text length for draw %d...", text.length());
+	ASSERT(glyphCache != nullptr, "invalid glyph cache resource...");
 
-	float textWidth = 0.0f;
-	float textHeight = 0.0f;
-	font->MeasureText(text, textWidth, textHeight);
+	uint32_t vertexCount = glyphCache->GenerateRequestedGlyphVertices(text, center, vertices_.data(), countOfPageVertices_);
+	if (vertexCount == 0)
+	{
+		return;
+	}
 
-	Vector2f position(center.x - textWidth / 2.0f, center.y + textHeight / 2.0f);
+	const void* bufferPtr = reinterpret_cast<const void*>(vertices_.data());
+	uint32_t bufferByteSize = static_cast<uint32_t>(TextLayout::GlyphVertex::GetStride() * vertexCount);
+	WriteDynamicVertexBuffer(vertexBufferObject_, bufferPtr, bufferByteSize);
+
+	Shader::Bind();
+
+	Shader::SetUniform("ortho", ortho);
+	Shader::SetUniform("glyphColor", color);
+	Shader::SetUniform("bIsSignedDistanceField", false);
+
+	GL_ASSERT(GLStateCache::Get().ActiveTexture(0), "failed to active glyph cache page...");
 
-	int32_t vertexCount = 0;
-	for (const auto& unicode : text)
+	GLStateCache::Get().BindVertexArray(vertexArrayObject_);
+
+	uint32_t firstVertex = 0;
+	for (int32_t page = 0; page < static_cast<int32_t>(countOfPageVertices_.size()); ++page)
 	{
-		const Glyph& glyph = font->GetGlyph(static_cast<int32_t>(unicode));
+		uint32_t countOfVertex = countOfPageVertices_[page];
+		if (countOfVertex == 0)
+		{
+			continue;
+		}
+
+		GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, glyphCache->GetPageTextureID(page)), "failed to bind glyph cache page...");
+		glDrawArrays(GL_TRIANGLES, static_cast<int32_t>(firstVertex), static_cast<int32_t>(countOfVertex));
 
-		float unicodeWidth = static_cast<float>(glyph.position1.x - glyph.position0.x);
-		float unicodeHeight = static_cast<float>(glyph.position1.y - glyph.position0.y);
+		firstVertex += countOfVertex;
+	}
 
-		vertices_[vertexCount + 0].position = Vector3f(position.x + glyph.xoffset, position.y + glyph.yoffset, 0.0f);
-		vertices_[vertexCount + 0].texture  = Vector2f(static_cast<float>(glyph.position0.x) / glyphAtlasSize, static_cast<float>(glyph.position0.y) / glyphAtlasSize);
+	GLStateCache::Get().BindVertexArray(0);
 
-		vertices_[vertexCount + 1].position = Vector3f(position.x + glyph.xoffset, position.y + unicodeHeight + glyph.yoffset, 0.0f);
-		vertices_[vertexCount + 1].texture  = Vector2f(static_cast<float>(glyph.position0.x) / glyphAtlasSize, static_cast<float>(glyph.position1.y) / glyphAtlasSize);
+	Shader::Unbind();
+}
 
+void GlyphShader2D::DrawTextLayout(const Matrix4x4f& ortho, TextLayout& layout, const Vector4f& color)
+{
+	if (layout.GetVertices().empty())
+	{
+		return;
+	}
 
-		vertices_[vertexCount + 2].position = Vector3f(position.x + glyph.xoffset + unicodeWidth, position.y + glyph.yoffset, 0.0f);
-		vertices_[vertexCount + 2].texture  = Vector2f(static_cast<float>(glyph.position1.x) / glyphAtlasSize, static_cast<float>(glyph.position0.y) / glyphAtlasSize);
+	layout.Upload();
 
-		vertices_[vertexCount + 3].position = Vector3f(position.x + glyph.xoffset + unicodeWidth, position.y + glyph.yoffset, 0.0f);
-		vertices_[vertexCount + 3].texture  = Vector2f(static_cast<float>(glyph.position1.x) / glyphAtlasSize, static_cast<float>(glyph.position0.y) / glyphAtlasSize);
+	Shader::Bind();
 
+	BindGlyphAtlas(ortho, layout.GetFont(), color);
 
-		vertices_[vertexCount + 4].position = Vector3f(position.x + glyph.xoffset, position.y + unicodeHeight + glyph.yoffset, 0.0f);
-		vertices_[vertexCount + 4].texture  = Vector2f(static_cast<float>(glyph.position0.x) / glyphAtlasSize, static_cast<float>(glyph.position1.y) / glyphAtlasSize);
+	GLStateCache::Get().BindVertexArray(layout.GetVertexArrayObject());
+	glDrawArrays(GL_TRIANGLES, 0, static_cast<int32_t>(layout.GetVertices().size()));
+	GLStateCache::Get().BindVertexArray(0);
 
-		vertices_[vertexCount + 5].position = Vector3f(position.x + glyph.xoffset + unicodeWidth, position.y + unicodeHeight + glyph.yoffset, 0.0f);
-		vertices_[vertexCount + 5].texture  = Vector2f(static_cast<float>(glyph.position1.x) / glyphAtlasSize, static_cast<float>(glyph.position1.y) / glyphAtlasSize);
+	Shader::Unbind();
+}
+
+void GlyphShader2D::BindGlyphAtlas(const Matrix4x4f& ortho, const TTFont* font, const Vector4f& color)
+{
+	GL_ASSERT(GLStateCache::Get().BindTexture(0, GL_TEXTURE_2D, font->GetGlyphAtlasID()), "failed to bind glyph texture atlas...");
 
-		position.x += glyph.xadvance;
-		vertexCount += 6;
+	Shader::SetUniform("ortho", ortho);
+	Shader::SetUniform("glyphColor", color);
+
+	bool bIsSignedDistanceField = (font->GetType() == GlyphAtlas::EType::SignedDistanceField);
+	Shader::SetUniform("bIsSignedDistanceField", bIsSignedDistanceField);
+
+	if (bIsSignedDistanceField)
+	{
+		// Ÿ  ܰ  128̰, ۸ ؽó Ʋ  ȼ (128 / Ÿ ) մϴ.
+		float distanceScale = (128.0f / static_cast<float>(font->GetDistanceRange())) / 255.0f;
+		float glyphAtlasSize = static_cast<float>(font->GetGlyphAtlasSize());
+		const TextEffect& textEffect = font->GetTextEffect();
+
+		Shader::SetUniform("distanceScale", distanceScale);
+		Shader::SetUniform("outlineColor", textEffect.outlineColor);
+		Shader::SetUniform("outlineThickness", textEffect.outlineThickness);
+		Shader::SetUniform("shadowColor", textEffect.shadowColor);
+		Shader::SetUniform("shadowOffset", textEffect.shadowOffset.x / glyphAtlasSize, textEffect.shadowOffset.y / glyphAtlasSize);
 	}
+}
+
+uint32_t GlyphShader2D::UpdateGlyphVertexBuffer(const TTFont* font, std::wstring_view text, const Vector2f& center)
+{
+	float textWidth = 0.0f;
+	float textHeight = 0.0f;
 
-	return vertexCount;
+	return TextLayout::GenerateGlyphVertices(font, text, center, vertices_.data(), textWidth, textHeight);
 }
\ No newline at end of file
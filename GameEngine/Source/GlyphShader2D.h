@@ -1,10 +1,14 @@
 #pragma once
 
 #include <array>
+#include <string_view>
+#include <vector>
 
 #include "Shader.h"
+#include "TextLayout.h"
 
-class TTFont; // TTFont ϱ   Դϴ.
+class GlyphCache; // GlyphCache ϱ   Դϴ.
+class TTFont;     // TTFont ϱ   Դϴ.
 
 
 /**
@@ -39,13 +43,18 @@ public:
 
 
 	/**
-	 * @brief GLSL ̴ ҽ  ϰ ̴ α׷ մϴ.
+	 * @brief ̴ ο ̴ ҽ ۸ ޴ ʱȭ ޼带  մϴ.
+	 */
+	using Shader::Initialize;
+
+
+	/**
+	 * @brief ޸𸮿 ִ GLSL ̴ ҽ ϰ ̴ α׷ մϴ.
 	 *
-	 * @param vsFile ؽ ̴ Ȯ(.vert)  Դϴ.
-	 * @param fsFile ׸Ʈ ̴ Ȯ(.frag)  Դϴ.
-	 * @param bCheckValid ̴  ȿ ˻ Դϴ. ⺻  trueԴϴ.
+	 * @param vsSource ؽ ̴ ҽ Դϴ.
+	 * @param fsSource ׸Ʈ ̴ ҽ Դϴ.
 	 */
-	virtual void Initialize(const std::wstring& vsPath, const std::wstring& fsPath) override;
+	virtual void Initialize(const BufferView& vsSource, const BufferView& fsSource) override;
 
 
 	/**
@@ -63,140 +72,46 @@ public:
 	 * @param center ؽƮ ߽ ǥԴϴ.
 	 * @param color ؽƮ RGBA Դϴ.
 	 */
-	void DrawText2D(const Matrix4x4f& ortho, const TTFont* font, const std::wstring& text, const Vector2f& center, const Vector4f& color);
+	void DrawText2D(const Matrix4x4f& ortho, const TTFont* font, std::wstring_view text, const Vector2f& center, const Vector4f& color);
+
+
+	/**
+	 * @brief  ۸ ĳ÷ 2D ؽƮ ȭ鿡 ׸ϴ.
+	 *
+	 * @note
+	 * - ۸ ĳ RequestGlyphs ûϰ Flush ؽó  ۸ ׸, ĳÿ  ۸ ǳʶݴϴ.
+	 * - ؽƮ ϴ    ׸ϴ.
+	 *
+	 * @param ortho   Դϴ.
+	 * @param glyphCache  ۸ ĳԴϴ.
+	 * @param text  ؽƮԴϴ.
+	 * @param center ؽƮ ߽ ǥԴϴ.
+	 * @param color ؽƮ RGBA Դϴ.
+	 */
+	void DrawText2D(const Matrix4x4f& ortho, GlyphCache* glyphCache, std::wstring_view text, const Vector2f& center, const Vector4f& color);
+
+
+	/**
+	 * @brief ĳõ ؽƮ ̾ƿ ȭ鿡 ׸ϴ.
+	 *
+	 * @param ortho   Դϴ.
+	 * @param layout ׸ ؽƮ ̾ƿԴϴ. ٽ   ִٸ GPU ۿ  ϴ.
+	 * @param color ؽƮ RGBA Դϴ.
+	 */
+	void DrawTextLayout(const Matrix4x4f& ortho, TextLayout& layout, const Vector4f& color);
 
 
 private:
 	/**
-	 * @brief ؽƮ ׸⸦ ϴ ̴ ο ϴ Դϴ.
+	 * @brief ۸ ؽó Ʋ󽺸 εϰ ؽƮ ׸  ʿ   մϴ.
+	 *
+	 * @note ȣ ִ Ÿ Ʈ Ʈ ܰ ׸ ȿ Բ մϴ.
+	 *
+	 * @param ortho   Դϴ.
+	 * @param font Ʈ ҽԴϴ.
+	 * @param color ؽƮ RGBA Դϴ.
 	 */
-	struct VertexPositionTexture
-	{
-		/**
-		 * @brief ġ ؽó    ⺻ Դϴ.
-		 */
-		VertexPositionTexture() noexcept
-			: position(0.0f, 0.0f, 0.0f)
-			, texture(0.0f, 0.0f) {}
-
-
-		/**
-		 * @brief ġ ؽó    Դϴ.
-		 *
-		 * @param position  ġԴϴ.
-		 * @param st  ؽó ġԴϴ.
-		 */
-		VertexPositionTexture(Vector3f&& position, Vector2f&& st) noexcept
-			: position(position)
-			, texture(st) {}
-
-
-		/**
-		 * @brief ġ ؽó    Դϴ.
-		 *
-		 * @param position  ġԴϴ.
-		 * @param st  ؽó ġԴϴ.
-		 */
-		VertexPositionTexture(const Vector3f& position, const Vector2f& st) noexcept
-			: position(position)
-			, texture(st) {}
-
-
-		/**
-		 * @brief ġ ؽó    Դϴ.
-		 *
-		 * @param x ġ XǥԴϴ.
-		 * @param y ġ YǥԴϴ.
-		 * @param z ġ ZǥԴϴ.
-		 * @param s ؽó ġ SǥԴϴ.
-		 * @param t ؽó ġ TǥԴϴ.
-		 */
-		VertexPositionTexture(
-			float x, float y, float z,
-			float s, float t
-		) noexcept
-			: position(x, y, z)
-			, texture(s, t) {}
-
-
-		/**
-		 * @brief ġ ؽó    Դϴ.
-		 *
-		 * @param instance   νϽԴϴ.
-		 */
-		VertexPositionTexture(VertexPositionTexture&& instance) noexcept
-			: position(instance.position)
-			, texture(instance.texture) {}
-
-
-		/**
-		 * @brief ġ ؽó    Դϴ.
-		 *
-		 * @param instance   νϽԴϴ.
-		 */
-		VertexPositionTexture(const VertexPositionTexture& instance) noexcept
-			: position(instance.position)
-			, texture(instance.texture) {}
-
-
-		/**
-		 * @brief ġ ؽó     Դϴ.
-		 *
-		 * @param instance   νϽԴϴ.
-		 *
-		 * @return  ü ڸ ȯմϴ.
-		 */
-		VertexPositionTexture& operator=(VertexPositionTexture&& instance) noexcept
-		{
-			if (this == &instance) return *this;
-
-			position = instance.position;
-			texture = instance.texture;
-
-			return *this;
-		}
-
-
-		/**
-		 * @brief ġ ؽó     Դϴ.
-		 *
-		 * @param instance   νϽԴϴ.
-		 *
-		 * @return  ü ڸ ȯմϴ.
-		 */
-		VertexPositionTexture& operator=(const VertexPositionTexture& instance) noexcept
-		{
-			if (this == &instance) return *this;
-
-			position = instance.position;
-			texture = instance.texture;
-
-			return *this;
-		}
-
-
-		/**
-		 * @brief  Ʈ   ϴ.
-		 *
-		 * @return  Ʈ (Stride)  ȯմϴ.
-		 */
-		static uint32_t GetStride()
-		{
-			return sizeof(VertexPositionTexture);
-		}
-
-
-		/**
-		 * @brief  ġԴϴ.
-		 */
-		Vector3f position;
-
-
-		/**
-		 * @brief  ؽó ǥԴϴ.
-		 */
-		Vector2f texture;
-	};
+	void BindGlyphAtlas(const Matrix4x4f& ortho, const TTFont* font, const Vector4f& color);
 
 
 	/**
@@ -208,7 +123,7 @@ private:
 	 *
 	 * @return ؽƮ ´ ؽ  ȯմϴ.
 	 */
-	uint32_t UpdateGlyphVertexBuffer(const TTFont* font, const std::wstring& text, const Vector2f& center);
+	uint32_t UpdateGlyphVertexBuffer(const TTFont* font, std::wstring_view text, const Vector2f& center);
 
 
 private:
@@ -232,7 +147,13 @@ private:
 	/**
 	 * @brief  Դϴ.
 	 */
-	std::array<VertexPositionTexture, MAX_VERTEX_SIZE> vertices_;
+	std::array<TextLayout::GlyphVertex, MAX_VERTEX_SIZE> vertices_;
+
+
+	/**
+	 * @brief  ۸ ĳ÷ ׸     Դϴ.
+	 */
+	std::vector<uint32_t> countOfPageVertices_;
 
 
 	/**
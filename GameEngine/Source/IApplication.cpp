@@ -2,6 +2,7 @@
 
 std::wstring IApplication::rootPath_;
 std::wstring IApplication::enginePath_;
+std::wstring IApplication::cookedPath_;
 
 IApplication::IApplication()
 {
@@ -57,6 +58,7 @@ void IApplication::Setup()
 	}
 	
 	enginePath_ = rootPath_ + L"GameEngine/";
+	cookedPath_ = FileUtils::IsValidPath(rootPath_ + L"Cooked/") ? rootPath_ + L"Cooked/" : L"";
 
 	Window::RegisterWindowClass(windowTitle_, InputManager::WindowProc);
 
@@ -71,10 +73,11 @@ void IApplication::Setup()
 
 	RenderManager::Get().SetRenderTargetWindow(window_.get());
 	RenderManager::Get().SetEnableImGui(bIsImGui_);
-	RenderManager::Get().SetShaderPath(enginePath_ + L"Shader/");
+	RenderManager::Get().SetShaderPath(cookedPath_.empty() ? enginePath_ + L"Shader/" : cookedPath_ + L"Shader/");
 
 	InputManager::Get().Startup();
 	AudioManager::Get().Startup();
+	JobSystem::Get().Startup();
 	ResourceManager::Get().Startup();
 	RenderManager::Get().Startup();
 	ObjectManager::Get().Startup();
@@ -115,6 +118,7 @@ void IApplication::Shutdown()
 		SceneManager::Get().Shutdown();
 		ObjectManager::Get().Shutdown();
 		ResourceManager::Get().Shutdown();
+		JobSystem::Get().Shutdown();
 		RenderManager::Get().Shutdown();
 		AudioManager::Get().Shutdown();
 		InputManager::Get().Shutdown();
@@ -142,4 +146,37 @@ void IApplication::SetProperties(const std::wstring& windowTitle, int32_t window
 	bIsImGui_ = bIsImGui;
 	
 	bIsPropertiesSet_ = true;
+}
+
+void IApplication::SetFixedTimestep(float stepRate, int32_t maxStepsPerFrame)
+{
+	ASSERT(stepRate > 0.0f, "invalid fixed step rate %f...", stepRate);
+	ASSERT(maxStepsPerFrame > 0, "invalid max steps per frame %d...", maxStepsPerFrame);
+
+	fixedDeltaSeconds_ = 1.0f / stepRate;
+	maxStepsPerFrame_ = maxStepsPerFrame;
+	accumulatedSeconds_ = 0.0f;
+}
+
+void IApplication::TickScene(IScene* scene, float deltaSeconds)
+{
+	accumulatedSeconds_ += deltaSeconds;
+
+	int32_t countOfStep = 0;
+	while (accumulatedSeconds_ >= fixedDeltaSeconds_ && countOfStep < maxStepsPerFrame_)
+	{
+		scene->FixedTick(fixedDeltaSeconds_);
+
+		accumulatedSeconds_ -= fixedDeltaSeconds_;
+		countOfStep++;
+	}
+
+	// ִ ܰ  Ѿ и ð , ùķ̼   ϰ   и  ϴ.
+	if (accumulatedSeconds_ >= fixedDeltaSeconds_)
+	{
+		accumulatedSeconds_ = std::fmod(accumulatedSeconds_, fixedDeltaSeconds_);
+	}
+
+	scene->SetInterpolationAlpha(accumulatedSeconds_ / fixedDeltaSeconds_);
+	scene->Tick(deltaSeconds);
 }
\ No newline at end of file
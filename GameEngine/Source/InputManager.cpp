@@ -1,6 +1,10 @@
 #include "InputManager.h"
 
 #include "Assertion.h"
+
+#include <cstring>
+
+#if !defined(HEADLESS_MODE)
 #include "CommandLineUtils.h"
 #include "Window.h"
 
@@ -8,13 +12,155 @@
 #include <imgui_impl_opengl3.h>
 #include <imgui_impl_win32.h>
 extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
+#endif
 
 InputManager* inputManagerPtr = nullptr;
 
+/**
+ * @brief Է Ʈ  Ÿ ĺԴϴ.
+ */
+static const uint8_t INPUT_STREAM_MAGIC[] = { 'D', '3', 'I', 'R' };
+
+/**
+ * @brief Է Ʈ  Դϴ.
+ */
+static const uint64_t INPUT_STREAM_VERSION = 1;
+
+/**
+ * @brief Է Ʈ   ƮԴϴ. ٲ ׸ ӿ մϴ.
+ */
+static const uint8_t INPUT_FRAME_DELTA_SECONDS = 0x01;
+static const uint8_t INPUT_FRAME_WINDOW_EVENT = 0x02;
+static const uint8_t INPUT_FRAME_KEYBOARD = 0x04;
+static const uint8_t INPUT_FRAME_CURSOR = 0x08;
+
+/**
+ * @brief ȣ    (LEB128) Է Ʈ ϴ.
+ * 
+ * @param stream   Է ƮԴϴ.
+ * @param value  Դϴ.
+ */
+static void WriteVarUInt(std::vector<uint8_t>& stream, uint64_t value)
+{
+	while (value >= 0x80)
+	{
+		stream.push_back(static_cast<uint8_t>(value | 0x80));
+		value >>= 7;
+	}
+
+	stream.push_back(static_cast<uint8_t>(value));
+}
+
+/**
+ * @brief Է Ʈ  (LEB128) ȣ   нϴ.
+ * 
+ * @param stream   Է ƮԴϴ.
+ * @param offset   ġԴϴ.  ŭ մϴ.
+ * @param outValue  Դϴ.
+ * 
+ * @return  оٸ true, Է Ʈ ߷Ȱų  64Ʈ Ѵ´ٸ false ȯմϴ.
+ */
+static bool ReadVarUInt(const std::vector<uint8_t>& stream, std::size_t& offset, uint64_t& outValue)
+{
+	uint64_t value = 0;
+	for (uint32_t shift = 0; shift < 64; shift += 7)
+	{
+		if (offset >= stream.size())
+		{
+			return false;
+		}
+
+		uint8_t byte = stream[offset++];
+		value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+
+		if (!(byte & 0x80))
+		{
+			outValue = value;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @brief ȣ ִ   ڵ   ̷ Է Ʈ ϴ.
+ *
+ * @param stream   Է ƮԴϴ.
+ * @param value  Դϴ.
+ */
+static void WriteVarInt(std::vector<uint8_t>& stream, int32_t value)
+{
+	WriteVarUInt(stream, (static_cast<uint64_t>(static_cast<uint32_t>(value)) << 1) ^ static_cast<uint64_t>(static_cast<int64_t>(value >> 31)));
+}
+
+/**
+ * @brief Է Ʈ  ڵ ȣ ִ  нϴ.
+ *
+ * @param stream   Է ƮԴϴ.
+ * @param offset   ġԴϴ.  ŭ մϴ.
+ * @param outValue  Դϴ.
+ *
+ * @return  оٸ true, Է Ʈ ߷ȴٸ false ȯմϴ.
+ */
+static bool ReadVarInt(const std::vector<uint8_t>& stream, std::size_t& offset, int32_t& outValue)
+{
+	uint64_t encoded = 0;
+	if (!ReadVarUInt(stream, offset, encoded))
+	{
+		return false;
+	}
+
+	uint32_t value = static_cast<uint32_t>(encoded);
+	outValue = static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+	return true;
+}
+
+/**
+ * @brief   Ʋ   Է Ʈ ϴ.
+ *
+ * @param stream   Է ƮԴϴ.
+ * @param value  Դϴ.
+ * @param byteSize  Ʈ Դϴ.
+ */
+static void WriteFixed(std::vector<uint8_t>& stream, uint64_t value, uint32_t byteSize)
+{
+	for (uint32_t index = 0; index < byteSize; ++index)
+	{
+		stream.push_back(static_cast<uint8_t>(value >> (index * 8)));
+	}
+}
+
+/**
+ * @brief Է Ʈ   Ʋ   нϴ.
+ *
+ * @param stream   Է ƮԴϴ.
+ * @param offset   ġԴϴ.  ŭ մϴ.
+ * @param byteSize  Ʈ Դϴ.
+ * @param outValue  Դϴ.
+ *
+ * @return  оٸ true, Է Ʈ ߷ȴٸ false ȯմϴ.
+ */
+static bool ReadFixed(const std::vector<uint8_t>& stream, std::size_t& offset, uint32_t byteSize, uint64_t& outValue)
+{
+	if (offset > stream.size() || byteSize > stream.size() - offset)
+	{
+		return false;
+	}
+
+	uint64_t value = 0;
+	for (uint32_t index = 0; index < byteSize; ++index)
+	{
+		value |= static_cast<uint64_t>(stream[offset++]) << (index * 8);
+	}
+
+	outValue = value;
+	return true;
+}
+
 void InputManager::Startup()
 {
 	ASSERT(!bIsStartup_, "already startup input manager...");
-	ASSERT(inputControlWindow_ != nullptr, "haven't set the input control window...");
 	ASSERT(!inputManagerPtr, "already setup input manager pointer...");
 
 	std::fill(prevKeyboardState_.begin(), prevKeyboardState_.end(), 0);
@@ -22,6 +168,9 @@ void InputManager::Startup()
 
 	windowEventActions_ = std::unordered_map<std::string, WindowEventAction>();
 
+#if !defined(HEADLESS_MODE)
+	ASSERT(inputControlWindow_ != nullptr, "haven't set the input control window...");
+
 	if (bIsEnableImGui_)
 	{
 		ImGui::CreateContext();
@@ -31,6 +180,7 @@ void InputManager::Startup()
 		io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
 		io.ConfigFlags |= ImGuiConfigFlags_NavEnableSetMousePos;
 	}
+#endif
 
 	inputManagerPtr = this;
 	bIsStartup_ = true;
@@ -40,32 +190,75 @@ void InputManager::Shutdown()
 {
 	ASSERT(bIsStartup_, "not startup before or has already been shutdowned...");
 
+#if !defined(HEADLESS_MODE)
 	if (bIsEnableImGui_)
 	{
 		ImGui::DestroyContext();
 	}
+#endif
 
 	inputManagerPtr = nullptr;
 	inputControlWindow_ = nullptr;
 	bIsStartup_ = false;
 }
 
-void InputManager::Tick()
+void InputManager::Tick(float deltaSeconds)
 {
-	PollWindowEvents();
-	
-	std::copy(currKeyboardState_.begin(), currKeyboardState_.end(), prevKeyboardState_.begin());
-	WINDOWS_ASSERT(GetKeyboardState(currKeyboardState_.data()), "failed to get current keyboard state...");
+	if (bIsRecording_ && bHasPendingFrame_)
+	{
+		WriteInputFrame();
+	}
+
+	deltaSeconds_ = deltaSeconds;
+
+	if (bIsReplaying_)
+	{
+#if !defined(HEADLESS_MODE)
+		PollWindowEvents();
+#endif
+
+		std::copy(currKeyboardState_.begin(), currKeyboardState_.end(), prevKeyboardState_.begin());
+		prevCursorPosition_ = currCursorPosition_;
+
+		if (inputStreamOffset_ >= inputStream_.size())
+		{
+			StopReplay();
+		}
+		else if (!ReadInputFrame())
+		{
+#if defined(DEBUG_MODE) || defined(RELEASE_MODE) || defined(DEVELOPMENT_MODE)
+			DebugPrintF("[InputManager] truncated input stream at byte %zu of %zu, stop replay...\n", inputStreamOffset_, inputStream_.size());
+#endif
+			bHasReplayError_ = true;
+			StopReplay();
+		}
+	}
+	else
+	{
+#if defined(HEADLESS_MODE)
+		std::copy(currKeyboardState_.begin(), currKeyboardState_.end(), prevKeyboardState_.begin());
+		prevCursorPosition_ = currCursorPosition_;
+#else
+		PollWindowEvents();
+
+		std::copy(currKeyboardState_.begin(), currKeyboardState_.end(), prevKeyboardState_.begin());
+		WINDOWS_ASSERT(GetKeyboardState(currKeyboardState_.data()), "failed to get current keyboard state...");
+
+		prevCursorPosition_ = currCursorPosition_;
+		currCursorPosition_ = GetCurrentCursorPosition();
+#endif
+	}
 
-	prevCursorPosition_ = currCursorPosition_;
-	currCursorPosition_ = GetCurrentCursorPosition();
+	bHasPendingFrame_ = bIsRecording_;
 
+#if !defined(HEADLESS_MODE)
 	if (bIsEnableImGui_)
 	{
 		ImGui_ImplOpenGL3_NewFrame();
 		ImGui_ImplWin32_NewFrame();
 		ImGui::NewFrame();
 	}
+#endif
 }
 
 EPressState InputManager::GetVirtualKeyPressState(const EVirtualKey& virtualKey)
@@ -98,6 +291,93 @@ EPressState InputManager::GetVirtualKeyPressState(const EVirtualKey& virtualKey)
 	return pressState;
 }
 
+void InputManager::SetVirtualKeyState(const EVirtualKey& virtualKey, bool bIsPress)
+{
+	currKeyboardState_[static_cast<int32_t>(virtualKey)] = bIsPress ? 0x80 : 0x00;
+}
+
+void InputManager::StartRecording(uint64_t randomSeed)
+{
+	ASSERT(!bIsRecording_, "already recording input stream...");
+	ASSERT(!bIsReplaying_, "can't record input stream while replaying...");
+
+	inputStream_.assign(std::begin(INPUT_STREAM_MAGIC), std::end(INPUT_STREAM_MAGIC));
+	WriteVarUInt(inputStream_, INPUT_STREAM_VERSION);
+	WriteFixed(inputStream_, randomSeed, sizeof(uint64_t));
+
+	inputStreamSeed_ = randomSeed;
+	std::fill(recordKeyboardState_.begin(), recordKeyboardState_.end(), 0);
+	recordCursorPosition_ = Vector2i(0, 0);
+	streamDeltaSeconds_ = 0.0f;
+	frameWindowEvents_.clear();
+
+	bHasPendingFrame_ = false;
+	bIsRecording_ = true;
+}
+
+std::vector<uint8_t> InputManager::StopRecording()
+{
+	ASSERT(bIsRecording_, "not recording input stream...");
+
+	if (bHasPendingFrame_)
+	{
+		WriteInputFrame();
+	}
+
+	std::vector<uint8_t> inputStream = std::move(inputStream_);
+	inputStream_.clear();
+
+	bHasPendingFrame_ = false;
+	bIsRecording_ = false;
+
+	return inputStream;
+}
+
+bool InputManager::StartReplay(const std::vector<uint8_t>& inputStream)
+{
+	ASSERT(!bIsRecording_, "can't replay input stream while recording...");
+	ASSERT(!bIsReplaying_, "already replaying input stream...");
+
+	bHasReplayError_ = false;
+
+	if (inputStream.size() < sizeof(INPUT_STREAM_MAGIC) || std::memcmp(inputStream.data(), INPUT_STREAM_MAGIC, sizeof(INPUT_STREAM_MAGIC)) != 0)
+	{
+		return false;
+	}
+
+	std::size_t offset = sizeof(INPUT_STREAM_MAGIC);
+
+	uint64_t version = 0;
+	if (!ReadVarUInt(inputStream, offset, version) || version != INPUT_STREAM_VERSION)
+	{
+		return false;
+	}
+
+	uint64_t randomSeed = 0;
+	if (!ReadFixed(inputStream, offset, sizeof(uint64_t), randomSeed))
+	{
+		return false;
+	}
+
+	inputStream_ = inputStream;
+	inputStreamOffset_ = offset;
+	inputStreamSeed_ = randomSeed;
+
+	std::fill(currKeyboardState_.begin(), currKeyboardState_.end(), 0);
+	currCursorPosition_ = Vector2i(0, 0);
+	streamDeltaSeconds_ = 0.0f;
+
+	bIsReplaying_ = true;
+	return true;
+}
+
+void InputManager::StopReplay()
+{
+	bIsReplaying_ = false;
+	inputStream_.clear();
+	inputStreamOffset_ = 0;
+}
+
 void InputManager::AddWindowEventAction(const std::string& signature, const EWindowEvent& windowEvent, const std::function<void()>& eventAction, bool bIsActive)
 {
 	ASSERT(windowEventActions_.find(signature) == windowEventActions_.end(), "already bind window event action : %s", signature.c_str());
@@ -135,6 +415,7 @@ void InputManager::ExecuteWindowEventAction(const EWindowEvent& windowEvent)
 	}
 }
 
+#if !defined(HEADLESS_MODE)
 LRESULT InputManager::ProcessWindowMessage(HWND windowHandle, uint32_t message, WPARAM wParam, LPARAM lParam)
 {
 	if (bIsEnableImGui_ && ImGui_ImplWin32_WndProcHandler(windowHandle, message, wParam, lParam))
@@ -213,6 +494,16 @@ LRESULT InputManager::ProcessWindowMessage(HWND windowHandle, uint32_t message,
 		return DefWindowProcW(windowHandle, message, wParam, lParam);
 	}
 
+	if (bIsReplaying_ && windowEvent != EWindowEvent::Close)
+	{
+		return 0;
+	}
+
+	if (bIsRecording_ && windowEvent != EWindowEvent::None)
+	{
+		frameWindowEvents_.push_back(windowEvent);
+	}
+
 	ExecuteWindowEventAction(windowEvent);
 	return 0;
 }
@@ -236,12 +527,144 @@ void InputManager::PollWindowEvents()
 		DispatchMessageW(&msg);
 	}
 }
+#endif
 
 bool InputManager::IsPressKey(const uint8_t* keyBufferPtr, const EVirtualKey& virtualKey) const
 {
 	return (keyBufferPtr[static_cast<int32_t>(virtualKey)] & 0x80);
 }
 
+void InputManager::WriteInputFrame()
+{
+	uint64_t countOfChangeKey = 0;
+	for (int32_t key = 0; key < VIRTUAL_KEY_BUFFER_SIZE; ++key)
+	{
+		countOfChangeKey += (recordKeyboardState_[key] != currKeyboardState_[key]) ? 1 : 0;
+	}
+
+	uint8_t frameHeader = 0;
+	frameHeader |= (std::memcmp(&deltaSeconds_, &streamDeltaSeconds_, sizeof(float)) != 0) ? INPUT_FRAME_DELTA_SECONDS : 0;
+	frameHeader |= !frameWindowEvents_.empty() ? INPUT_FRAME_WINDOW_EVENT : 0;
+	frameHeader |= (countOfChangeKey != 0) ? INPUT_FRAME_KEYBOARD : 0;
+	frameHeader |= (currCursorPosition_.x != recordCursorPosition_.x || currCursorPosition_.y != recordCursorPosition_.y) ? INPUT_FRAME_CURSOR : 0;
+	inputStream_.push_back(frameHeader);
+
+	if (frameHeader & INPUT_FRAME_DELTA_SECONDS)
+	{
+		uint32_t deltaSecondsBits = 0;
+		std::memcpy(&deltaSecondsBits, &deltaSeconds_, sizeof(float));
+		WriteFixed(inputStream_, deltaSecondsBits, sizeof(float));
+
+		streamDeltaSeconds_ = deltaSeconds_;
+	}
+
+	if (frameHeader & INPUT_FRAME_WINDOW_EVENT)
+	{
+		WriteVarUInt(inputStream_, frameWindowEvents_.size());
+		for (const auto& windowEvent : frameWindowEvents_)
+		{
+			WriteVarUInt(inputStream_, static_cast<uint64_t>(windowEvent));
+		}
+
+		frameWindowEvents_.clear();
+	}
+
+	if (frameHeader & INPUT_FRAME_KEYBOARD)
+	{
+		WriteVarUInt(inputStream_, countOfChangeKey);
+		for (int32_t key = 0; key < VIRTUAL_KEY_BUFFER_SIZE; ++key)
+		{
+			if (recordKeyboardState_[key] != currKeyboardState_[key])
+			{
+				inputStream_.push_back(static_cast<uint8_t>(key));
+				inputStream_.push_back(currKeyboardState_[key]);
+			}
+		}
+
+		recordKeyboardState_ = currKeyboardState_;
+	}
+
+	if (frameHeader & INPUT_FRAME_CURSOR)
+	{
+		WriteVarInt(inputStream_, currCursorPosition_.x - recordCursorPosition_.x);
+		WriteVarInt(inputStream_, currCursorPosition_.y - recordCursorPosition_.y);
+
+		recordCursorPosition_ = currCursorPosition_;
+	}
+
+	bHasPendingFrame_ = false;
+}
+
+bool InputManager::ReadInputFrame()
+{
+	uint8_t frameHeader = inputStream_[inputStreamOffset_++];
+
+	if (frameHeader & INPUT_FRAME_DELTA_SECONDS)
+	{
+		uint64_t deltaSecondsBits = 0;
+		if (!ReadFixed(inputStream_, inputStreamOffset_, sizeof(float), deltaSecondsBits))
+		{
+			return false;
+		}
+
+		uint32_t bits = static_cast<uint32_t>(deltaSecondsBits);
+		std::memcpy(&streamDeltaSeconds_, &bits, sizeof(float));
+	}
+
+	deltaSeconds_ = streamDeltaSeconds_;
+
+	if (frameHeader & INPUT_FRAME_WINDOW_EVENT)
+	{
+		uint64_t countOfWindowEvent = 0;
+		if (!ReadVarUInt(inputStream_, inputStreamOffset_, countOfWindowEvent))
+		{
+			return false;
+		}
+
+		for (uint64_t count = 0; count < countOfWindowEvent; ++count)
+		{
+			uint64_t windowEvent = 0;
+			if (!ReadVarUInt(inputStream_, inputStreamOffset_, windowEvent))
+			{
+				return false;
+			}
+
+			ExecuteWindowEventAction(static_cast<EWindowEvent>(windowEvent));
+		}
+	}
+
+	if (frameHeader & INPUT_FRAME_KEYBOARD)
+	{
+		uint64_t countOfChangeKey = 0;
+		if (!ReadVarUInt(inputStream_, inputStreamOffset_, countOfChangeKey) || countOfChangeKey > (inputStream_.size() - inputStreamOffset_) / 2)
+		{
+			return false;
+		}
+
+		for (uint64_t count = 0; count < countOfChangeKey; ++count)
+		{
+			uint8_t key = inputStream_[inputStreamOffset_++];
+			currKeyboardState_[key] = inputStream_[inputStreamOffset_++];
+		}
+	}
+
+	if (frameHeader & INPUT_FRAME_CURSOR)
+	{
+		int32_t deltaX = 0;
+		int32_t deltaY = 0;
+		if (!ReadVarInt(inputStream_, inputStreamOffset_, deltaX) || !ReadVarInt(inputStream_, inputStreamOffset_, deltaY))
+		{
+			return false;
+		}
+
+		currCursorPosition_.x += deltaX;
+		currCursorPosition_.y += deltaY;
+	}
+
+	return true;
+}
+
+#if !defined(HEADLESS_MODE)
 Vector2i InputManager::GetCurrentCursorPosition()
 {
 	POINT cursorPos;
@@ -250,4 +673,5 @@ Vector2i InputManager::GetCurrentCursorPosition()
 	WINDOWS_ASSERT(ScreenToClient(inputControlWindow_->GetHandle(), &cursorPos), "failed to convert screen to client cursor position...");
 
 	return Vector2i(static_cast<int32_t>(cursorPos.x), static_cast<int32_t>(cursorPos.y));
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include <algorithm>
+
+#if !defined(HEADLESS_MODE)
+#include <glad/glad.h>
+#endif
+
+#include "Assertion.h"
+#include "GLStateCache.h"
+#include "InstanceBuffer.h"
+
+
+/**
+ * @brief νϽ Ӽ  ̴ Է ġԴϴ.
+ *
+ * @note  ޽ð 0~2 Է ϹǷ   ġ մϴ. LightInstanced.vert, ShadowMapInstanced.vert ƾ մϴ.
+ */
+static const uint32_t INSTANCE_ATTRIBUTE_LOCATION = 3;
+
+InstanceBuffer::~InstanceBuffer()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void InstanceBuffer::Initialize(uint32_t capacity)
+{
+	ASSERT(!bIsInitialized_, "already initialize instance buffer resource...");
+
+	instances_.reserve(capacity);
+	bufferCapacity_ = std::max<uint32_t>(capacity, 1);
+
+#if !defined(HEADLESS_MODE)
+	GL_ASSERT(glGenBuffers(1, &instanceBufferObject_), "failed to generate instance buffer...");
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, instanceBufferObject_), "failed to bind instance buffer...");
+	GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, bufferCapacity_ * sizeof(Vector4f), nullptr, GL_DYNAMIC_DRAW), "failed to initialize instance buffer...");
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, 0), "failed to unbind instance buffer...");
+#endif
+
+	bIsInitialized_ = true;
+}
+
+void InstanceBuffer::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+#if !defined(HEADLESS_MODE)
+	GL_ASSERT(GLStateCache::Get().DeleteBuffer(instanceBufferObject_), "failed to delete instance buffer...");
+#endif
+
+	bIsInitialized_ = false;
+}
+
+void InstanceBuffer::Upload()
+{
+#if !defined(HEADLESS_MODE)
+	if (instances_.empty())
+	{
+		return;
+	}
+
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, instanceBufferObject_), "failed to bind instance buffer...");
+
+	uint32_t countOfInstance = GetCountOfInstance();
+	if (countOfInstance > bufferCapacity_)
+	{
+		bufferCapacity_ = std::max<uint32_t>(countOfInstance, bufferCapacity_ * 2);
+		GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, bufferCapacity_ * sizeof(Vector4f), nullptr, GL_DYNAMIC_DRAW), "failed to resize instance buffer...");
+	}
+
+	GL_ASSERT(glBufferSubData(GL_ARRAY_BUFFER, 0, countOfInstance * sizeof(Vector4f), instances_.data()), "failed to write instance buffer...");
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, 0), "failed to unbind instance buffer...");
+#endif
+}
+
+#if !defined(HEADLESS_MODE)
+void InstanceBuffer::Attach() const
+{
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, instanceBufferObject_), "failed to bind instance buffer...");
+	GL_ASSERT(glVertexAttribPointer(INSTANCE_ATTRIBUTE_LOCATION, 4, GL_FLOAT, GL_FALSE, sizeof(Vector4f), (void*)(0)), "failed to define an array of instance attribute data");
+	GL_ASSERT(glEnableVertexAttribArray(INSTANCE_ATTRIBUTE_LOCATION), "failed to enable instance attribute array");
+	GL_ASSERT(glVertexAttribDivisor(INSTANCE_ATTRIBUTE_LOCATION, 1), "failed to set instance attribute divisor");
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, 0), "failed to unbind instance buffer...");
+}
+
+void InstanceBuffer::Detach() const
+{
+	GL_ASSERT(glVertexAttribDivisor(INSTANCE_ATTRIBUTE_LOCATION, 0), "failed to reset instance attribute divisor");
+	GL_ASSERT(glDisableVertexAttribArray(INSTANCE_ATTRIBUTE_LOCATION), "failed to disable instance attribute array");
+}
+#endif
\ No newline at end of file
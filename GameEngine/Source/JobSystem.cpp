@@ -0,0 +1,228 @@
+#include "JobSystem.h"
+
+#include "Assertion.h"
+
+/**
+ * @brief  尡 ϴ ۾ ť εԴϴ.   ۾ 尡 ƴ  0 մϴ.
+ */
+static thread_local uint32_t currentWorkerIndex = 0;
+
+void JobSystem::Startup()
+{
+	ASSERT(!bIsStartup_, "already startup job system...");
+
+	if (!bIsSetCountOfWorker_)
+	{
+		uint32_t countOfHardwareThread = std::thread::hardware_concurrency();
+		countOfWorker_ = (countOfHardwareThread > 1) ? countOfHardwareThread - 1 : 0;
+	}
+
+	bIsStop_ = false;
+	countOfQueuedJob_ = 0;
+
+	workQueues_.clear();
+	for (uint32_t index = 0; index <= countOfWorker_; ++index)
+	{
+		workQueues_.push_back(std::make_unique<WorkQueue>());
+	}
+
+	currentWorkerIndex = 0;
+	bIsStartup_ = true;
+
+	for (uint32_t index = 1; index <= countOfWorker_; ++index)
+	{
+		workers_.emplace_back([this, index]() { RunWorker(index); });
+	}
+}
+
+void JobSystem::Shutdown()
+{
+	ASSERT(bIsStartup_, "not startup before or has already been shutdowned...");
+
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex_);
+		bIsStop_ = true;
+	}
+	sleepCondition_.notify_all();
+
+	for (auto& worker : workers_)
+	{
+		worker.join();
+	}
+
+	workers_.clear();
+	workQueues_.clear();
+
+	bIsStartup_ = false;
+}
+
+void JobSystem::SetCountOfWorker(uint32_t countOfWorker)
+{
+	ASSERT(!bIsStartup_, "can't change count of worker after startup job system...");
+
+	countOfWorker_ = countOfWorker;
+	bIsSetCountOfWorker_ = true;
+}
+
+void JobSystem::Schedule(const std::function<void()>& job, JobCounter* counter, const JobCounter* dependency)
+{
+	if (!bIsStartup_ || countOfWorker_ == 0)
+	{
+		ASSERT(!dependency || dependency->IsDone(), "dependency can't be done without worker threads...");
+
+		job();
+		return;
+	}
+
+	if (counter)
+	{
+		counter->count_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	if (dependency)
+	{
+		//    ʾҴٸ īͿ մϴ. ī͸ 0  尡  ؽ  ۾ ť Ƿ ġ ʽϴ.
+		std::lock_guard<std::mutex> lock(dependency->waitingMutex_);
+		if (!dependency->IsDone())
+		{
+			dependency->waitingJobs_.push_back(Job{ job, counter });
+			return;
+		}
+	}
+
+	PushJob(currentWorkerIndex, Job{ job, counter }, true);
+}
+
+void JobSystem::Wait(const JobCounter& counter)
+{
+	while (!counter.IsDone())
+	{
+		if (TryExecuteJob(currentWorkerIndex))
+		{
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(sleepMutex_);
+		sleepCondition_.wait(lock, [&]() { return counter.IsDone() || countOfQueuedJob_.load() > 0; });
+	}
+}
+
+void JobSystem::RunWorker(uint32_t workerIndex)
+{
+	currentWorkerIndex = workerIndex;
+
+	while (!bIsStop_)
+	{
+		if (TryExecuteJob(workerIndex))
+		{
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(sleepMutex_);
+		sleepCondition_.wait(lock, [&]() { return bIsStop_ || countOfQueuedJob_.load() > 0; });
+	}
+}
+
+bool JobSystem::TryExecuteJob(uint32_t workerIndex)
+{
+	Job job;
+	if (!PopJob(workerIndex, job))
+	{
+		return false;
+	}
+
+	job.task();
+
+	if (job.counter)
+	{
+		FinishJob(*job.counter);
+	}
+
+	return true;
+}
+
+void JobSystem::FinishJob(JobCounter& counter)
+{
+	if (counter.count_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+	{
+		return;
+	}
+
+	std::vector<Job> waitingJobs;
+	{
+		std::lock_guard<std::mutex> lock(counter.waitingMutex_);
+		waitingJobs.swap(counter.waitingJobs_);
+	}
+
+	for (auto& waitingJob : waitingJobs)
+	{
+		PushJob(currentWorkerIndex, std::move(waitingJob), true);
+	}
+
+	// Wait  尡  Ȯ    ˸ ġ ʵ, ؽ Ҵ   ϴ.
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex_);
+	}
+	sleepCondition_.notify_all();
+}
+
+bool JobSystem::PopJob(uint32_t workerIndex, Job& outJob)
+{
+	if (countOfQueuedJob_.load() <= 0)
+	{
+		return false;
+	}
+
+	{
+		WorkQueue& workQueue = *workQueues_[workerIndex];
+		std::lock_guard<std::mutex> lock(workQueue.mutex);
+
+		if (!workQueue.jobs.empty())
+		{
+			outJob = std::move(workQueue.jobs.back());
+			workQueue.jobs.pop_back();
+			countOfQueuedJob_.fetch_sub(1);
+			return true;
+		}
+	}
+
+	uint32_t countOfQueue = static_cast<uint32_t>(workQueues_.size());
+	for (uint32_t offset = 1; offset < countOfQueue; ++offset)
+	{
+		WorkQueue& victimQueue = *workQueues_[(workerIndex + offset) % countOfQueue];
+		std::lock_guard<std::mutex> lock(victimQueue.mutex);
+
+		if (!victimQueue.jobs.empty())
+		{
+			outJob = std::move(victimQueue.jobs.front());
+			victimQueue.jobs.pop_front();
+			countOfQueuedJob_.fetch_sub(1);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void JobSystem::PushJob(uint32_t workerIndex, Job&& job, bool bIsBack)
+{
+	{
+		WorkQueue& workQueue = *workQueues_[workerIndex];
+		std::lock_guard<std::mutex> lock(workQueue.mutex);
+
+		if (bIsBack)
+		{
+			workQueue.jobs.push_back(std::move(job));
+		}
+		else
+		{
+			workQueue.jobs.push_front(std::move(job));
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex_);
+		countOfQueuedJob_.fetch_add(1);
+	}
+	sleepCondition_.notify_one();
+}
\ No newline at end of file
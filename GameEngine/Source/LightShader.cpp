@@ -1,48 +1,47 @@
 #include <glad/glad.h>
 
 #include "Assertion.h"
-#include "Camera3D.h"
-#include "Light.h"
+#include "GLStateCache.h"
+#include "InstanceBuffer.h"
 #include "LightShader.h"
-#include "Material.h"
 #include "StaticMesh.h"
 #include "ShadowMap.h"
+#include "UniformBlock.h"
 
 LightShader::~LightShader() {}
 
-void LightShader::SetMaterial(const Material* material)
+void LightShader::Initialize(const BufferView& vsSource, const BufferView& fsSource)
 {
-	SetUniform("material.ambientRGB", material->GetAmbientRGB());
-	SetUniform("material.diffuseRGB", material->GetDiffuseRGB());
-	SetUniform("material.specularRGB", material->GetSpecularRGB());
-	SetUniform("material.shininess", material->GetShininess());
-}
+	ASSERT(!bIsInitialized_, "already initialize light shader resource...");
 
-void LightShader::SetLight(const Light* light)
-{
-	SetUniform("lightView", light->GetViewMatrix());
-	SetUniform("lightProjection", light->GetProjectionMatrix());
-	SetUniform("light.position", light->GetPosition());
-	SetUniform("light.direction", light->GetDirection());
-	SetUniform("light.ambientRGB", light->GetAmbientRGB());
-	SetUniform("light.diffuseRGB", light->GetDiffuseRGB());
-	SetUniform("light.specularRGB", light->GetSpecularRGB());
-}
+	Shader::Initialize(vsSource, fsSource);
 
-void LightShader::SetCamera(const Camera3D* camera)
-{
-	SetUniform("viewPosition", camera->GetEyePosition());
-	SetUniform("view", camera->GetViewMatrix());
-	SetUniform("projection", camera->GetProjectionMatrix());
+	worldHandle_ = GetUniformHandle("world");
+
+	uint32_t frameBlockSize = GetUniformBlockSize("FrameBlock");
+	ASSERT(frameBlockSize == 0 || frameBlockSize == sizeof(FrameUniformBlock), "mismatch frame uniform block size : %d", frameBlockSize);
+
+	uint32_t materialBlockSize = GetUniformBlockSize("MaterialBlock");
+	ASSERT(materialBlockSize == 0 || materialBlockSize == sizeof(MaterialUniformBlock), "mismatch material uniform block size : %d", materialBlockSize);
 }
 
 void LightShader::DrawMesh3D(const Matrix4x4f& world, const StaticMesh* mesh, const ShadowMap* shadowMap)
 {
 	shadowMap->Active(0);
 
-	SetUniform("world", world);
+	SetUniform(worldHandle_, world);
 
-	GL_ASSERT(glBindVertexArray(mesh->GetVertexArrayObject()), "failed to bind static mesh vertex array...");
+	//  ޽ø ̾ ׸   ĳð ε ϵ, ׸ ڿ  迭 Ʈ ε  ʽϴ.
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(mesh->GetVertexArrayObject()), "failed to bind static mesh vertex array...");
 	GL_ASSERT(glDrawElements(GL_TRIANGLES, mesh->GetIndexCount(), GL_UNSIGNED_INT, 0), "failed to draw static mesh...");
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind static mesh vertex array...");
+}
+
+void LightShader::DrawMeshInstanced3D(const StaticMesh* mesh, const InstanceBuffer* instanceBuffer, const ShadowMap* shadowMap)
+{
+	shadowMap->Active(0);
+
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(mesh->GetVertexArrayObject()), "failed to bind static mesh vertex array...");
+	instanceBuffer->Attach();
+	GL_ASSERT(glDrawElementsInstanced(GL_TRIANGLES, mesh->GetIndexCount(), GL_UNSIGNED_INT, 0, instanceBuffer->GetCountOfInstance()), "failed to draw static mesh instances...");
+	instanceBuffer->Detach();
 }
\ No newline at end of file
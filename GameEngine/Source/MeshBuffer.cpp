@@ -0,0 +1,126 @@
+#if !defined(HEADLESS_MODE)
+#include <glad/glad.h>
+#endif
+
+#include "Assertion.h"
+#include "GLStateCache.h"
+#include "MeshBuffer.h"
+
+MeshBuffer::~MeshBuffer()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void MeshBuffer::Initialize(uint32_t vertexCapacity, uint32_t indexCapacity)
+{
+	ASSERT(!bIsInitialized_, "already initialize mesh buffer resource...");
+
+	vertexAllocator_.Reset(vertexCapacity);
+	indexAllocator_.Reset(indexCapacity);
+
+#if !defined(HEADLESS_MODE)
+	GL_ASSERT(glGenVertexArrays(1, &vertexArrayObject_), "failed to generate mesh buffer vertex array object...");
+	GL_ASSERT(glGenBuffers(1, &vertexBufferObject_), "failed to generate mesh buffer vertex buffer...");
+	GL_ASSERT(glGenBuffers(1, &indexBufferObject_), "failed to generate mesh buffer index buffer...");
+
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(vertexArrayObject_), "failed to bind mesh buffer vertex array object...");
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind mesh buffer vertex buffer...");
+	GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCapacity) * Vertex::GetStride(), nullptr, GL_STATIC_DRAW), "failed to initialize mesh buffer vertex buffer...");
+	GL_ASSERT(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferObject_), "failed to bind mesh buffer index buffer...");
+	GL_ASSERT(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indexCapacity) * sizeof(uint32_t), nullptr, GL_STATIC_DRAW), "failed to initialize mesh buffer index buffer...");
+
+	GL_ASSERT(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, Vertex::GetStride(), (void*)(offsetof(Vertex, position))), "failed to define an array of generic vertex attribute data");
+	GL_ASSERT(glEnableVertexAttribArray(0), "failed to enable a generic vertex attribute array");
+
+	GL_ASSERT(glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, Vertex::GetStride(), (void*)(offsetof(Vertex, normal))), "failed to define an array of generic vertex attribute data");
+	GL_ASSERT(glEnableVertexAttribArray(1), "failed to enable a generic vertex attribute array");
+
+	GL_ASSERT(glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, Vertex::GetStride(), (void*)(offsetof(Vertex, texture))), "failed to define an array of generic vertex attribute data");
+	GL_ASSERT(glEnableVertexAttribArray(2), "failed to enable a generic vertex attribute array");
+
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(0), "failed to unbind mesh buffer vertex array object...");
+#endif
+
+	bIsInitialized_ = true;
+}
+
+void MeshBuffer::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+#if !defined(HEADLESS_MODE)
+	GL_ASSERT(GLStateCache::Get().DeleteBuffer(indexBufferObject_), "failed to delete mesh buffer index buffer...");
+	GL_ASSERT(GLStateCache::Get().DeleteBuffer(vertexBufferObject_), "failed to delete mesh buffer vertex buffer...");
+	GL_ASSERT(GLStateCache::Get().DeleteVertexArray(vertexArrayObject_), "failed to delete mesh buffer vertex array object...");
+#endif
+
+	vertexAllocator_.Reset(0);
+	indexAllocator_.Reset(0);
+
+	bIsInitialized_ = false;
+}
+
+bool MeshBuffer::Allocate(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, Allocation& outAllocation)
+{
+	ASSERT(!vertices.empty() && !indices.empty(), "mesh buffer allocation must have vertices and indices...");
+
+	Allocation allocation;
+	allocation.countOfVertex = static_cast<uint32_t>(vertices.size());
+	allocation.countOfIndex = static_cast<uint32_t>(indices.size());
+
+	if (!vertexAllocator_.Allocate(allocation.countOfVertex, allocation.baseVertex))
+	{
+		return false;
+	}
+
+	if (!indexAllocator_.Allocate(allocation.countOfIndex, allocation.firstIndex))
+	{
+		vertexAllocator_.Free(allocation.baseVertex, allocation.countOfVertex);
+		return false;
+	}
+
+#if !defined(HEADLESS_MODE)
+	GLintptr vertexOffset = static_cast<GLintptr>(allocation.baseVertex) * Vertex::GetStride();
+	GLsizeiptr vertexSize = static_cast<GLsizeiptr>(allocation.countOfVertex) * Vertex::GetStride();
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind mesh buffer vertex buffer...");
+	GL_ASSERT(glBufferSubData(GL_ARRAY_BUFFER, vertexOffset, vertexSize, vertices.data()), "failed to write mesh buffer vertex buffer...");
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, 0), "failed to unbind mesh buffer vertex buffer...");
+
+	// ε ۴  迭 Ʈ  Ƿ, ٸ  迭 Ʈ ¸ ٲ ʵ   ϴ.
+	GLintptr indexOffset = static_cast<GLintptr>(allocation.firstIndex) * sizeof(uint32_t);
+	GLsizeiptr indexSize = static_cast<GLsizeiptr>(allocation.countOfIndex) * sizeof(uint32_t);
+	GL_ASSERT(glBindBuffer(GL_COPY_WRITE_BUFFER, indexBufferObject_), "failed to bind mesh buffer index buffer...");
+	GL_ASSERT(glBufferSubData(GL_COPY_WRITE_BUFFER, indexOffset, indexSize, indices.data()), "failed to write mesh buffer index buffer...");
+	GL_ASSERT(glBindBuffer(GL_COPY_WRITE_BUFFER, 0), "failed to unbind mesh buffer index buffer...");
+#endif
+
+	outAllocation = allocation;
+	return true;
+}
+
+void MeshBuffer::Free(const Allocation& allocation)
+{
+	vertexAllocator_.Free(allocation.baseVertex, allocation.countOfVertex);
+	indexAllocator_.Free(allocation.firstIndex, allocation.countOfIndex);
+}
+
+#if !defined(HEADLESS_MODE)
+void MeshBuffer::Bind() const
+{
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(vertexArrayObject_), "failed to bind mesh buffer vertex array object...");
+}
+
+void MeshBuffer::Unbind() const
+{
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(0), "failed to unbind mesh buffer vertex array object...");
+}
+
+void MeshBuffer::Draw(const Allocation& allocation) const
+{
+	const void* indexOffset = reinterpret_cast<const void*>(static_cast<uintptr_t>(allocation.firstIndex) * sizeof(uint32_t));
+	GL_ASSERT(glDrawElementsBaseVertex(GL_TRIANGLES, allocation.countOfIndex, GL_UNSIGNED_INT, indexOffset, static_cast<GLint>(allocation.baseVertex)), "failed to draw mesh buffer elements...");
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <cstring>
+
+#include <stb_image_resize.h>
+
+#include "Assertion.h"
+#include "MipChain.h"
+
+
+/**
+ * @brief ȭ Ӹ ü  ĺ Դϴ. 'MIPS'Դϴ.
+ */
+static const uint32_t MIP_CHAIN_MAGIC = 0x5350494D;
+
+
+/**
+ * @brief ȭ Ӹ ü   Դϴ.
+ */
+static const uint32_t MIP_CHAIN_VERSION = 1;
+
+
+/**
+ * @brief Ӹ ü ִ  Դϴ.
+ */
+static const uint32_t MAX_MIP_LEVEL = 16;
+
+
+/**
+ * @brief Ӹ ü 0  ִ   ũԴϴ.
+ */
+static const int32_t MAX_MIP_SIZE = 1 << (MAX_MIP_LEVEL - 1);
+
+
+/**
+ * @brief ȭ Ӹ ü  Դϴ.
+ *
+ * @note  ڿ   迭   ȼ  ̾ϴ.
+ */
+struct MipChainHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	int32_t channels;
+	uint32_t countOfLevel;
+	uint64_t pixelSize;
+};
+
+void MipChain::Generate(const uint8_t* pixelsPtr, int32_t width, int32_t height, int32_t channels, MipChain& outMipChain)
+{
+	ASSERT(pixelsPtr != nullptr && width > 0 && height > 0, "invalid mip chain source image...");
+	ASSERT(channels == 1 || channels == 3 || channels == 4, "%d is not support image channel...", channels);
+
+	outMipChain.channels = channels;
+	outMipChain.levels.clear();
+
+	uint64_t pixelSize = 0;
+	for (int32_t levelWidth = width, levelHeight = height;; levelWidth = std::max(levelWidth / 2, 1), levelHeight = std::max(levelHeight / 2, 1))
+	{
+		outMipChain.levels.push_back(MipChain::Level{ levelWidth, levelHeight, pixelSize });
+		pixelSize += static_cast<uint64_t>(levelWidth) * static_cast<uint64_t>(levelHeight) * static_cast<uint64_t>(channels);
+
+		if (levelWidth == 1 && levelHeight == 1)
+		{
+			break;
+		}
+	}
+
+	ASSERT(outMipChain.levels.size() <= MAX_MIP_LEVEL, "%d x %d image is too large to generate mip chain...", width, height);
+
+	outMipChain.pixels.resize(static_cast<std::size_t>(pixelSize));
+	std::memcpy(outMipChain.pixels.data(), pixelsPtr, outMipChain.GetLevelSize(0));
+
+	for (std::size_t level = 1; level < outMipChain.levels.size(); ++level)
+	{
+		const Level& source = outMipChain.levels[level - 1];
+		const Level& target = outMipChain.levels[level];
+
+		int32_t result = stbir_resize_uint8(
+			outMipChain.pixels.data() + source.offset, source.width, source.height, 0,
+			outMipChain.pixels.data() + target.offset, target.width, target.height, 0,
+			channels
+		);
+		ASSERT(result != 0, "failed to resize %d mip level...", static_cast<int32_t>(level));
+	}
+}
+
+std::vector<uint8_t> MipChain::Serialize() const
+{
+	MipChainHeader header;
+	header.magic = MIP_CHAIN_MAGIC;
+	header.version = MIP_CHAIN_VERSION;
+	header.channels = channels;
+	header.countOfLevel = static_cast<uint32_t>(levels.size());
+	header.pixelSize = static_cast<uint64_t>(pixels.size());
+
+	std::size_t levelByteSize = sizeof(Level) * levels.size();
+	std::vector<uint8_t> buffer(sizeof(MipChainHeader) + levelByteSize + pixels.size());
+
+	uint8_t* bufferPtr = buffer.data();
+	std::memcpy(bufferPtr, &header, sizeof(MipChainHeader));
+	bufferPtr += sizeof(MipChainHeader);
+
+	std::memcpy(bufferPtr, levels.data(), levelByteSize);
+	bufferPtr += levelByteSize;
+
+	std::memcpy(bufferPtr, pixels.data(), pixels.size());
+
+	return buffer;
+}
+
+bool MipChain::Deserialize(const BufferView& buffer, MipChain& outMipChain)
+{
+	if (buffer.GetSize() < sizeof(MipChainHeader))
+	{
+		return false;
+	}
+
+	MipChainHeader header;
+	std::memcpy(&header, buffer.GetData(), sizeof(MipChainHeader));
+
+	if (header.magic != MIP_CHAIN_MAGIC || header.version != MIP_CHAIN_VERSION)
+	{
+		return false;
+	}
+
+	if ((header.channels != 1 && header.channels != 3 && header.channels != 4) || header.countOfLevel == 0 || header.countOfLevel > MAX_MIP_LEVEL)
+	{
+		return false;
+	}
+
+	std::size_t levelByteSize = sizeof(Level) * static_cast<std::size_t>(header.countOfLevel);
+	if (buffer.GetSize() != sizeof(MipChainHeader) + levelByteSize + header.pixelSize)
+	{
+		return false;
+	}
+
+	const uint8_t* bufferPtr = buffer.GetData() + sizeof(MipChainHeader);
+
+	outMipChain.channels = header.channels;
+	outMipChain.levels.resize(header.countOfLevel);
+	std::memcpy(outMipChain.levels.data(), bufferPtr, levelByteSize);
+	bufferPtr += levelByteSize;
+
+	uint64_t offset = 0;
+	for (std::size_t level = 0; level < outMipChain.levels.size(); ++level)
+	{
+		const Level& mipLevel = outMipChain.levels[level];
+		if (mipLevel.width <= 0 || mipLevel.height <= 0 || mipLevel.width > MAX_MIP_SIZE || mipLevel.height > MAX_MIP_SIZE || mipLevel.offset != offset)
+		{
+			return false;
+		}
+
+		offset += outMipChain.GetLevelSize(level);
+	}
+
+	if (offset != header.pixelSize)
+	{
+		return false;
+	}
+
+	outMipChain.pixels.assign(bufferPtr, bufferPtr + header.pixelSize);
+
+	return true;
+}
+
+std::size_t MipChain::GetLevelSize(std::size_t level) const
+{
+	const Level& mipLevel = levels[level];
+	return static_cast<std::size_t>(mipLevel.width) * static_cast<std::size_t>(mipLevel.height) * static_cast<std::size_t>(channels);
+}
\ No newline at end of file
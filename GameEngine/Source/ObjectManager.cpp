@@ -4,7 +4,11 @@ void ObjectManager::Startup()
 {
 	ASSERT(!bIsStartup_, "already startup object manager...");
 
-	objectCache_ = std::unordered_map<std::string, std::unique_ptr<IObject>>();
+	objectPools_ = std::unordered_map<std::type_index, std::unique_ptr<IObjectPool>>();
+	slots_ = std::vector<ObjectSlot>();
+	freeSlots_ = std::vector<uint32_t>();
+	signatureIndex_ = std::unordered_map<StringId, uint32_t, StringId::Hasher>();
+	pendingDestroys_ = std::vector<uint32_t>();
 
 	bIsStartup_ = true;
 }
@@ -13,30 +17,117 @@ void ObjectManager::Shutdown()
 {
 	ASSERT(bIsStartup_, "not startup before or has already been shutdowned...");
 
-	for (auto& object : objectCache_)
+	FlushDestroyedObjects();
+
+	for (auto& slot : slots_)
 	{
-		object.second->Release();
-		object.second.reset();
+		if (slot.object)
+		{
+			if (slot.object->IsInitialized())
+			{
+				slot.object->Release();
+			}
+
+			slot.pool->Deallocate(slot.object);
+			slot.object = nullptr;
+		}
 	}
 
+	slots_.clear();
+	pendingDestroys_.clear();
+	freeSlots_.clear();
+	signatureIndex_.clear();
+	objectPools_.clear();
+
 	bIsStartup_ = false;
 }
 
-void ObjectManager::DestroyObject(const std::string& signature)
+ObjectHandle ObjectManager::FindHandle(const StringId& id) const
+{
+	auto iter = signatureIndex_.find(id);
+	if (iter == signatureIndex_.end())
+	{
+		return ObjectHandle();
+	}
+
+	return slots_[iter->second].object->GetHandle();
+}
+
+void ObjectManager::DestroyObject(const ObjectHandle& handle)
 {
-	if (IsValidObjectKey(signature))
+	if (!Resolve(handle))
+	{
+		return;
+	}
+
+	ObjectSlot& slot = slots_[handle.index];
+	if (slot.bIsPendingDestroy)
 	{
-		IObject* object = objectCache_.at(signature).get();
-		if (object && object->IsInitialized())
+		return;
+	}
+
+	signatureIndex_.erase(slot.signature);
+
+	slot.bIsPendingDestroy = true;
+	pendingDestroys_.push_back(handle.index);
+}
+
+void ObjectManager::FlushDestroyedObjects()
+{
+	// Ҵ  ߿ ٸ Ʈ  û  Ƿ  ũ⸦ Ź Ȯմϴ.
+	for (std::size_t pending = 0; pending < pendingDestroys_.size(); ++pending)
+	{
+		uint32_t index = pendingDestroys_[pending];
+		IObject* object = slots_[index].object;
+
+		if (object->IsInitialized())
 		{
 			object->Release();
 		}
 
-		objectCache_.erase(signature);
+		ObjectSlot& slot = slots_[index];
+		slot.pool->Deallocate(object);
+		slot.object = nullptr;
+		slot.pool = nullptr;
+		slot.bIsPendingDestroy = false;
+		slot.signature = StringId();
+		slot.generation++;
+
+		freeSlots_.push_back(index);
 	}
+
+	pendingDestroys_.clear();
+}
+
+bool ObjectManager::IsValidObjectKey(const StringId& key) const
+{
+	return signatureIndex_.find(key) != signatureIndex_.end();
 }
 
-bool ObjectManager::IsValidObjectKey(const std::string& key)
+ObjectHandle ObjectManager::AllocateSlot(IObject* object, IObjectPool* pool, const StringId& id)
 {
-	return objectCache_.find(key) != objectCache_.end();
+	uint32_t index = 0;
+	if (freeSlots_.empty())
+	{
+		index = static_cast<uint32_t>(slots_.size());
+		slots_.push_back(ObjectSlot());
+	}
+	else
+	{
+		index = freeSlots_.back();
+		freeSlots_.pop_back();
+	}
+
+	ObjectSlot& slot = slots_[index];
+	slot.object = object;
+	slot.pool = pool;
+	slot.signature = id;
+
+	signatureIndex_.insert({ id, index });
+
+	ObjectHandle handle;
+	handle.index = index;
+	handle.generation = slot.generation;
+
+	return handle;
 }
\ No newline at end of file
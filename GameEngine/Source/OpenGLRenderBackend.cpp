@@ -0,0 +1,102 @@
+#include <glad/glad.h>
+
+#include "Assertion.h"
+#include "GLStateCache.h"
+#include "InstanceBuffer.h"
+#include "OpenGLRenderBackend.h"
+#include "Shader.h"
+#include "StaticMesh.h"
+#include "UniformBlock.h"
+#include "UniformBuffer.h"
+
+void OpenGLRenderBackend::Begin()
+{
+	shader_ = nullptr;
+	materialBlocks_.clear();
+}
+
+void OpenGLRenderBackend::End()
+{
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(0), "failed to unbind static mesh vertex array...");
+
+	if (shader_)
+	{
+		shader_->Unbind();
+		shader_ = nullptr;
+	}
+}
+
+void OpenGLRenderBackend::BindShader(Shader* shader)
+{
+	shader_ = shader;
+	shader_->Bind();
+
+	worldHandle_ = shader_->GetUniformHandle("world");
+}
+
+void OpenGLRenderBackend::BindTexture(uint32_t unit, uint32_t textureID)
+{
+	GL_ASSERT(GLStateCache::Get().BindTexture(unit, GL_TEXTURE_2D, textureID), "failed to bind texture...");
+}
+
+void OpenGLRenderBackend::BindMesh(const StaticMesh* mesh)
+{
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(mesh->GetVertexArrayObject()), "failed to bind static mesh vertex array...");
+}
+
+void OpenGLRenderBackend::BindMeshBuffer(const MeshBuffer* meshBuffer)
+{
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(meshBuffer->GetVertexArrayObject()), "failed to bind mesh buffer vertex array...");
+}
+
+void OpenGLRenderBackend::SetMaterial(const Material* material)
+{
+	ASSERT(materialUniformBuffer_ != nullptr, "not set material uniform buffer...");
+
+	std::unordered_map<const Material*, uint32_t>::iterator materialBlock = materialBlocks_.find(material);
+	if (materialBlock == materialBlocks_.end())
+	{
+		//  ϸ ó ٽ ϴ. glBufferSubData ռ ׸   ڿ ǹǷ  ϴ.
+		if (materialBlocks_.size() >= materialUniformBuffer_->GetCountOfBlock())
+		{
+			materialBlocks_.clear();
+		}
+
+		uint32_t index = static_cast<uint32_t>(materialBlocks_.size());
+		materialUniformBuffer_->SetBlock(index, MaterialUniformBlock::Create(material));
+		materialBlock = materialBlocks_.insert({ material, index }).first;
+	}
+
+	materialUniformBuffer_->Bind(materialBlock->second);
+}
+
+void OpenGLRenderBackend::DrawMesh(const Matrix4x4f& world, uint32_t indexCount)
+{
+	shader_->SetUniform(worldHandle_, world);
+
+	GL_ASSERT(glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, 0), "failed to draw static mesh...");
+}
+
+void OpenGLRenderBackend::DrawMeshInstanced(const InstanceBuffer* instanceBuffer, uint32_t indexCount)
+{
+	instanceBuffer->Attach();
+	GL_ASSERT(glDrawElementsInstanced(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, 0, instanceBuffer->GetCountOfInstance()), "failed to draw static mesh instances...");
+	instanceBuffer->Detach();
+}
+
+void OpenGLRenderBackend::DrawMeshBaseVertex(const Matrix4x4f& world, const MeshBuffer::Allocation& allocation)
+{
+	shader_->SetUniform(worldHandle_, world);
+
+	const void* indexOffset = reinterpret_cast<const void*>(static_cast<uintptr_t>(allocation.firstIndex) * sizeof(uint32_t));
+	GL_ASSERT(glDrawElementsBaseVertex(GL_TRIANGLES, allocation.countOfIndex, GL_UNSIGNED_INT, indexOffset, static_cast<GLint>(allocation.baseVertex)), "failed to draw mesh buffer elements...");
+}
+
+void OpenGLRenderBackend::DrawMeshInstancedBaseVertex(const InstanceBuffer* instanceBuffer, const MeshBuffer::Allocation& allocation)
+{
+	const void* indexOffset = reinterpret_cast<const void*>(static_cast<uintptr_t>(allocation.firstIndex) * sizeof(uint32_t));
+
+	instanceBuffer->Attach();
+	GL_ASSERT(glDrawElementsInstancedBaseVertex(GL_TRIANGLES, allocation.countOfIndex, GL_UNSIGNED_INT, indexOffset, instanceBuffer->GetCountOfInstance(), static_cast<GLint>(allocation.baseVertex)), "failed to draw mesh buffer instances...");
+	instanceBuffer->Detach();
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include <glad/glad.h>
 
 #include "Assertion.h"
+#include "GLStateCache.h"
 #include "PostEffectShader.h"
 #include "Framebuffer.h"
 
@@ -12,11 +13,11 @@ PostEffectShader::~PostEffectShader()
 	}
 }
 
-void PostEffectShader::Initialize(const std::wstring& vsPath, const std::wstring& fsPath)
+void PostEffectShader::Initialize(const BufferView& vsSource, const BufferView& fsSource)
 {
 	ASSERT(!bIsInitialized_, "already initialize post effect shader resource...");
 
-	Shader::Initialize(vsPath, fsPath);
+	Shader::Initialize(vsSource, fsSource);
 
 	vertices_ = {
 		VertexPositionTexture(Vector3f(-1.0f, +1.0f, 0.0f), Vector2f(0.0f, 0.0f)),
@@ -30,8 +31,8 @@ void PostEffectShader::Initialize(const std::wstring& vsPath, const std::wstring
 	GL_ASSERT(glGenVertexArrays(1, &vertexArrayObject_), "failed to generate frame buffer vertex array...");
 	GL_ASSERT(glGenBuffers(1, &vertexBufferObject_), "failed to generate frame buffer vertex buffer...");
 
-	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind frame buffer vertex array...");
-	GL_ASSERT(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind frame buffer vertex buffer...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(vertexArrayObject_), "failed to bind frame buffer vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind frame buffer vertex buffer...");
 	GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, VertexPositionTexture::GetStride() * vertices_.size(), reinterpret_cast<const void*>(vertices_.data()), GL_STATIC_DRAW),
 		"failed to create a new data store for vertex buffer object...");
 
@@ -43,7 +44,7 @@ void PostEffectShader::Initialize(const std::wstring& vsPath, const std::wstring
 		"failed to specify the location and data format of the array of generic vertex attributes at index...");
 	GL_ASSERT(glEnableVertexAttribArray(1), "failed to enable vertex attrib array...");
 
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind frame buffer vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(0), "failed to unbind frame buffer vertex array...");
 }
 
 void PostEffectShader::Release()
@@ -52,15 +53,15 @@ void PostEffectShader::Release()
 
 	Shader::Release();
 
-	GL_ASSERT(glDeleteBuffers(1, &vertexBufferObject_), "failed to delete frame buffer vertex buffer...");
-	GL_ASSERT(glDeleteVertexArrays(1, &vertexArrayObject_), "failed to delete frame buffer vertex array object...");
+	GL_ASSERT(GLStateCache::Get().DeleteBuffer(vertexBufferObject_), "failed to delete frame buffer vertex buffer...");
+	GL_ASSERT(GLStateCache::Get().DeleteVertexArray(vertexArrayObject_), "failed to delete frame buffer vertex array object...");
 }
 
 void PostEffectShader::BlitEffect(Framebuffer* framebuffer)
 {
 	framebuffer->Active(0);
 
-	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind frame buffer vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(vertexArrayObject_), "failed to bind frame buffer vertex array...");
 	GL_ASSERT(glDrawArrays(GL_TRIANGLES, 0, MAX_VERTEX_SIZE), "failed to blit frame buffer...");
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind frame buffer vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(0), "failed to unbind frame buffer vertex array...");
 }
\ No newline at end of file
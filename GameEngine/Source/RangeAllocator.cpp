@@ -0,0 +1,75 @@
+#include <iterator>
+
+#include "Assertion.h"
+#include "RangeAllocator.h"
+
+void RangeAllocator::Reset(uint32_t capacity)
+{
+	capacity_ = capacity;
+	freeSize_ = capacity;
+
+	freeRanges_.clear();
+	if (capacity > 0)
+	{
+		freeRanges_.emplace(0, capacity);
+	}
+}
+
+bool RangeAllocator::Allocate(uint32_t size, uint32_t& outOffset)
+{
+	ASSERT(size > 0, "range allocation size must be greater than zero...");
+
+	for (auto freeRange = freeRanges_.begin(); freeRange != freeRanges_.end(); ++freeRange)
+	{
+		if (freeRange->second < size)
+		{
+			continue;
+		}
+
+		outOffset = freeRange->first;
+
+		uint32_t remainSize = freeRange->second - size;
+		freeRanges_.erase(freeRange);
+
+		if (remainSize > 0)
+		{
+			freeRanges_.emplace(outOffset + size, remainSize);
+		}
+
+		freeSize_ -= size;
+		return true;
+	}
+
+	return false;
+}
+
+void RangeAllocator::Free(uint32_t offset, uint32_t size)
+{
+	ASSERT(size > 0 && offset <= capacity_ && size <= capacity_ - offset, "%u + %u range is out of allocator...", offset, size);
+
+	auto next = freeRanges_.lower_bound(offset);
+	ASSERT(next == freeRanges_.end() || offset + size <= next->first, "%u + %u range overlaps a free range...", offset, size);
+
+	freeSize_ += size;
+
+	if (next != freeRanges_.begin())
+	{
+		auto prev = std::prev(next);
+		ASSERT(prev->first + prev->second <= offset, "%u + %u range overlaps a free range...", offset, size);
+
+		if (prev->first + prev->second == offset)
+		{
+			offset = prev->first;
+			size += prev->second;
+			freeRanges_.erase(prev);
+		}
+	}
+
+	if (next != freeRanges_.end() && offset + size == next->first)
+	{
+		size += next->second;
+		freeRanges_.erase(next);
+	}
+
+	freeRanges_.emplace(offset, size);
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "InstanceBuffer.h"
+#include "RecordingRenderBackend.h"
+
+void RecordingRenderBackend::Begin()
+{
+	Command command;
+	command.type = ECommandType::Begin;
+
+	commands_.push_back(command);
+}
+
+void RecordingRenderBackend::End()
+{
+	Command command;
+	command.type = ECommandType::End;
+
+	commands_.push_back(command);
+}
+
+void RecordingRenderBackend::BindShader(Shader* shader)
+{
+	Command command;
+	command.type = ECommandType::BindShader;
+	command.shader = shader;
+
+	commands_.push_back(command);
+}
+
+void RecordingRenderBackend::BindTexture(uint32_t unit, uint32_t textureID)
+{
+	Command command;
+	command.type = ECommandType::BindTexture;
+	command.unit = unit;
+	command.textureID = textureID;
+
+	commands_.push_back(command);
+}
+
+void RecordingRenderBackend::BindMesh(const StaticMesh* mesh)
+{
+	Command command;
+	command.type = ECommandType::BindMesh;
+	command.mesh = mesh;
+
+	commands_.push_back(command);
+}
+
+void RecordingRenderBackend::BindMeshBuffer(const MeshBuffer* meshBuffer)
+{
+	Command command;
+	command.type = ECommandType::BindMeshBuffer;
+	command.meshBuffer = meshBuffer;
+
+	commands_.push_back(command);
+}
+
+void RecordingRenderBackend::SetMaterial(const Material* material)
+{
+	Command command;
+	command.type = ECommandType::SetMaterial;
+	command.material = material;
+
+	commands_.push_back(command);
+}
+
+void RecordingRenderBackend::DrawMesh(const Matrix4x4f& world, uint32_t indexCount)
+{
+	Command command;
+	command.type = ECommandType::DrawMesh;
+	command.indexCount = indexCount;
+	command.world = world;
+
+	commands_.push_back(command);
+}
+
+void RecordingRenderBackend::DrawMeshInstanced(const InstanceBuffer* instanceBuffer, uint32_t indexCount)
+{
+	Command command;
+	command.type = ECommandType::DrawMeshInstanced;
+	command.indexCount = indexCount;
+	command.instanceBuffer = instanceBuffer;
+	command.countOfInstance = instanceBuffer->GetCountOfInstance();
+
+	commands_.push_back(command);
+}
+
+void RecordingRenderBackend::DrawMeshBaseVertex(const Matrix4x4f& world, const MeshBuffer::Allocation& allocation)
+{
+	Command command;
+	command.type = ECommandType::DrawMeshBaseVertex;
+	command.indexCount = allocation.countOfIndex;
+	command.world = world;
+	command.allocation = allocation;
+
+	commands_.push_back(command);
+}
+
+void RecordingRenderBackend::DrawMeshInstancedBaseVertex(const InstanceBuffer* instanceBuffer, const MeshBuffer::Allocation& allocation)
+{
+	Command command;
+	command.type = ECommandType::DrawMeshInstancedBaseVertex;
+	command.indexCount = allocation.countOfIndex;
+	command.instanceBuffer = instanceBuffer;
+	command.countOfInstance = instanceBuffer->GetCountOfInstance();
+	command.allocation = allocation;
+
+	commands_.push_back(command);
+}
+
+uint32_t RecordingRenderBackend::GetCountOfCommand(const ECommandType& type) const
+{
+	uint32_t count = 0;
+	for (const Command& command : commands_)
+	{
+		if (command.type == type)
+		{
+			count++;
+		}
+	}
+
+	return count;
+}
\ No newline at end of file
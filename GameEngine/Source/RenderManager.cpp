@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <array>
+#include <tuple>
 
 #include <glad/glad_wgl.h>
 #include <glad/glad.h>
@@ -7,11 +9,14 @@
 #include <imgui_impl_win32.h>
 
 #include "Assertion.h"
+#include "AssetPack.h"
 #include "Camera3D.h"
 #include "CommandLineUtils.h"
+#include "GLStateCache.h"
 
 #include "GeometryShader2D.h"
 #include "GeometryShader3D.h"
+#include "GlyphCache.h"
 #include "GlyphShader2D.h"
 #include "LightShader.h"
 #include "MathUtils.h"
@@ -23,6 +28,7 @@
 #include "StaticMesh.h"
 #include "ShadowMap.h"
 #include "ShadowShader.h"
+#include "StringId.h"
 #include "StringUtils.h"
 #include "Texture2D.h"
 #include "TextureShader2D.h"
@@ -36,6 +42,31 @@
 #define FIX_OPENGL_MAJOR_VERSION 4 // OpenGL (4) Դϴ.
 #define FIX_OPENGL_MINOR_VERSION 6 // OpenGL (6) Դϴ.
 
+/**
+ * @brief 2D   ׸ ̴ ĳ ĺԴϴ.
+ */
+static constexpr StringId GEOMETRY_2D_SHADER("Geometry2D");
+
+/**
+ * @brief 3D   ׸ ̴ ĳ ĺԴϴ.
+ */
+static constexpr StringId GEOMETRY_3D_SHADER("Geometry3D");
+
+/**
+ * @brief 2D ؽƮ ׸ ̴ ĳ ĺԴϴ.
+ */
+static constexpr StringId GLYPH_2D_SHADER("Glyph2D");
+
+/**
+ * @brief 2D ؽó ׸ ̴ ĳ ĺԴϴ.
+ */
+static constexpr StringId TEXTURE_2D_SHADER("Texture2D");
+
+/**
+ * @brief ī ڽ ׸ ̴ ĳ ĺԴϴ.
+ */
+static constexpr StringId SKYBOX_SHADER("Skybox");
+
 void RenderManager::Startup()
 {
 	ASSERT(!bIsStartup_, "already startup render manager...");
@@ -79,27 +110,41 @@ void RenderManager::Startup()
 	WINDOWS_ASSERT(wglMakeCurrent(deviceContext_, glRenderContext_), "faild to set opengl context...");
 
 	ASSERT(gladLoadGL(), "failed to load OpenGL function...");
+	GLStateCache::Get().Invalidate();
 
 	SetVsyncMode(bIsEnableVsync_);
 	SetDepthMode(bIsEnableDepth_);
 	SetStencilMode(bIsEnableStencil_);
 	SetAlphaBlendMode(bIsEnableAlphaBlend_);
 
-	shaderCache_ = std::unordered_map<std::wstring, Shader*>();
+	shaderCache_ = std::unordered_map<StringId, Shader*, StringId::Hasher>();
+
+	//  ̴ ̸, ׸Ʈ ̴ ̸, ̴ ҽԴϴ. νϽ ̴  ̴ ٸ ׸Ʈ ̴ մϴ.
+	const std::array<std::tuple<std::wstring, std::wstring, Shader*>, 9> shaders = {
+		std::make_tuple(L"Geometry2D",         L"Geometry2D", ResourceManager::Get().CreateResource<GeometryShader2D>("Geometry2DShader")),
+		std::make_tuple(L"Geometry3D",         L"Geometry3D", ResourceManager::Get().CreateResource<GeometryShader3D>("Geometry3DShader")),
+		std::make_tuple(L"Glyph2D",            L"Glyph2D",    ResourceManager::Get().CreateResource<GlyphShader2D>("Glyph2DShader")),
+		std::make_tuple(L"Texture2D",          L"Texture2D",  ResourceManager::Get().CreateResource<TextureShader2D>("Texture2DShader")),
+		std::make_tuple(L"Skybox",             L"Skybox",     ResourceManager::Get().CreateResource<Shader>("SkyboxShader")),
+		std::make_tuple(L"Light",              L"Light",      ResourceManager::Get().CreateResource<LightShader>("LightShader")),
+		std::make_tuple(L"LightInstanced",     L"Light",      ResourceManager::Get().CreateResource<LightShader>("LightInstancedShader")),
+		std::make_tuple(L"ShadowMap",          L"ShadowMap",  ResourceManager::Get().CreateResource<ShadowShader>("ShadowShader")),
+		std::make_tuple(L"ShadowMapInstanced", L"ShadowMap",  ResourceManager::Get().CreateResource<ShadowShader>("ShadowInstancedShader")),
+	};
 
-	shaderCache_.insert({ L"Geometry2D", ResourceManager::Get().CreateResource<GeometryShader2D>("Geometry2DShader") });
-	shaderCache_.insert({ L"Geometry3D", ResourceManager::Get().CreateResource<GeometryShader3D>("Geometry3DShader") });
-	shaderCache_.insert({ L"Glyph2D",    ResourceManager::Get().CreateResource<GlyphShader2D>("Glyph2DShader")       });
-	shaderCache_.insert({ L"Texture2D",  ResourceManager::Get().CreateResource<TextureShader2D>("Texture2DShader")   });
-	shaderCache_.insert({ L"Skybox",     ResourceManager::Get().CreateResource<Shader>("SkyboxShader")               });
-	shaderCache_.insert({ L"Light",      ResourceManager::Get().CreateResource<LightShader>("LightShader")           });
-	shaderCache_.insert({ L"ShadowMap",  ResourceManager::Get().CreateResource<ShadowShader>("ShadowShader")         });
-	for (auto& shader : shaderCache_)
+	// ̴  OpenGL ؽƮ   忡   Ƿ,  ۾ ؼ ۾  ҽ ε ġ մϴ.
+	for (const auto& shader : shaders)
 	{
-		shader.second->Initialize(
-			StringUtils::PrintF(L"%s%s.vert", shaderPath_.c_str(), shader.first.c_str()),
-			StringUtils::PrintF(L"%s%s.frag", shaderPath_.c_str(), shader.first.c_str())
+		const std::wstring& vsName = std::get<0>(shader);
+		const std::wstring& fsName = std::get<1>(shader);
+		Shader* shaderResource = std::get<2>(shader);
+
+		ResourceManager::Get().LoadAsync(StringUtils::Convert(vsName), shaderResource,
+			[](Shader*) {},
+			[this, vsName, fsName](Shader* resource) { InitializeShader(resource, vsName, fsName); }
 		);
+
+		shaderCache_.insert({ StringId(StringUtils::Convert(vsName)), shaderResource });
 	}
 
 	const std::array<std::wstring, 6> postEffects = {
@@ -113,8 +158,10 @@ void RenderManager::Startup()
 
 	for (const auto& postEffect : postEffects)
 	{
-		PostEffectShader* effect = ResourceManager::Get().CreateResource<PostEffectShader>(StringUtils::Convert(postEffect));
-		effect->Initialize(StringUtils::PrintF(L"%sPostEffect.vert", shaderPath_.c_str()), StringUtils::PrintF(L"%s%s.frag", shaderPath_.c_str(), postEffect.c_str()));
+		ResourceManager::Get().LoadAsync<PostEffectShader>(StringUtils::Convert(postEffect),
+			[](PostEffectShader*) {},
+			[this, postEffect](PostEffectShader* effect) { InitializeShader(effect, L"PostEffect", postEffect); }
+		);
 	}
 	
 	float farZ = 1.0f;
@@ -167,17 +214,42 @@ void RenderManager::BeginFrame(float red, float green, float blue, float alpha,
 
 void RenderManager::EndFrame()
 {
+	FlushGlyphCaches();
+
 	if (bIsEnableImGui_)
 	{
 		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+		// ImGui  ĳø ġ ʰ OpenGL ¸ ٲٹǷ,   ù ȣ  OpenGL մϴ.
+		GLStateCache::Get().Invalidate();
 	}
 
 	WINDOWS_ASSERT(SwapBuffers(deviceContext_), "failed to swap back and front buffer...");
 }
 
+void RenderManager::RegisterGlyphCache(GlyphCache* glyphCache)
+{
+	ASSERT(glyphCache != nullptr, "invalid glyph cache resource...");
+	ASSERT(std::find(glyphCaches_.begin(), glyphCaches_.end(), glyphCache) == glyphCaches_.end(), "already register glyph cache...");
+
+	glyphCaches_.push_back(glyphCache);
+}
+
+void RenderManager::UnregisterGlyphCache(GlyphCache* glyphCache)
+{
+	auto it = std::find(glyphCaches_.begin(), glyphCaches_.end(), glyphCache);
+	ASSERT(it != glyphCaches_.end(), "not register glyph cache...");
+
+	glyphCaches_.erase(it);
+	glyphCacheTexts_.erase(
+		std::remove_if(glyphCacheTexts_.begin(), glyphCacheTexts_.end(), [&](const GlyphCacheText& text) { return text.glyphCache == glyphCache; }),
+		glyphCacheTexts_.end()
+	);
+}
+
 void RenderManager::SetViewport(int32_t x, int32_t y, int32_t width, int32_t height)
 {
-	glViewport(x, y, width, height);
+	GLStateCache::Get().SetViewport(x, y, width, height);
 }
 
 void RenderManager::SetWindowViewport()
@@ -186,7 +258,7 @@ void RenderManager::SetWindowViewport()
 	int32_t windowHeight;
 	renderTargetWindow_->GetSize(windowWidth, windowHeight);
 
-	glViewport(0, 0, windowWidth, windowHeight);
+	GLStateCache::Get().SetViewport(0, 0, windowWidth, windowHeight);
 }
 
 void RenderManager::SetVsyncMode(bool bIsEnable)
@@ -200,11 +272,11 @@ void RenderManager::SetDepthMode(bool bIsEnable)
 	bIsEnableDepth_ = bIsEnable;
 	if (bIsEnableDepth_)
 	{
-		GL_ASSERT(glEnable(GL_DEPTH_TEST), "failed to enable depth test mode...");
+		GL_ASSERT(GLStateCache::Get().SetCapability(GL_DEPTH_TEST, true), "failed to enable depth test mode...");
 	}
 	else
 	{
-		GL_ASSERT(glDisable(GL_DEPTH_TEST), "failed to disable depth test mode...");
+		GL_ASSERT(GLStateCache::Get().SetCapability(GL_DEPTH_TEST, false), "failed to disable depth test mode...");
 	}
 }
 
@@ -213,11 +285,11 @@ void RenderManager::SetStencilMode(bool bIsEnable)
 	bIsEnableStencil_ = bIsEnable;
 	if (bIsEnableStencil_)
 	{
-		GL_ASSERT(glEnable(GL_STENCIL_TEST), "failed to enable stencil test mode...");
+		GL_ASSERT(GLStateCache::Get().SetCapability(GL_STENCIL_TEST, true), "failed to enable stencil test mode...");
 	}
 	else
 	{
-		GL_ASSERT(glDisable(GL_STENCIL_TEST), "failed to disable stencil test mode...");
+		GL_ASSERT(GLStateCache::Get().SetCapability(GL_STENCIL_TEST, false), "failed to disable stencil test mode...");
 	}
 }
 
@@ -226,12 +298,12 @@ void RenderManager::SetAlphaBlendMode(bool bIsEnable)
 	bIsEnableAlphaBlend_ = bIsEnable;
 	if (bIsEnableAlphaBlend_)
 	{
-		GL_ASSERT(glEnable(GL_BLEND), "failed to enable alpha blend mode...");
-		GL_ASSERT(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO), "failed to separate blend func...");
+		GL_ASSERT(GLStateCache::Get().SetCapability(GL_BLEND, true), "failed to enable alpha blend mode...");
+		GL_ASSERT(GLStateCache::Get().SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO), "failed to separate blend func...");
 	}
 	else
 	{
-		GL_ASSERT(glDisable(GL_BLEND), "failed to disable alpha blend mode...");
+		GL_ASSERT(GLStateCache::Get().SetCapability(GL_BLEND, false), "failed to disable alpha blend mode...");
 	}
 }
 
@@ -253,7 +325,7 @@ void RenderManager::RenderPoints2D(const std::vector<Vector2f>& positions, const
 		SetDepthMode(false);
 	}
 
-	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(L"Geometry2D"));
+	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(GEOMETRY_2D_SHADER));
 	shader->DrawPoints2D(screenOrtho_, positions, color, pointSize);
 }
 
@@ -264,7 +336,7 @@ void RenderManager::RenderConnectPoints2D(const std::vector<Vector2f>& positions
 		SetDepthMode(false);
 	}
 
-	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(L"Geometry2D"));
+	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(GEOMETRY_2D_SHADER));
 	shader->DrawConnectPoints2D(screenOrtho_, positions, color);
 }
 
@@ -275,7 +347,7 @@ void RenderManager::RenderLine2D(const Vector2f& fromPosition, const Vector2f& t
 		SetDepthMode(false);
 	}
 
-	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(L"Geometry2D"));
+	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(GEOMETRY_2D_SHADER));
 	shader->DrawLine2D(screenOrtho_, fromPosition, toPosition, color);
 }
 
@@ -286,7 +358,7 @@ void RenderManager::RenderLine2D(const Vector2f& fromPosition, const Vector4f& f
 		SetDepthMode(false);
 	}
 
-	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(L"Geometry2D"));
+	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(GEOMETRY_2D_SHADER));
 	shader->DrawLine2D(screenOrtho_, fromPosition, fromColor, toPosition, toColor);
 }
 
@@ -297,7 +369,7 @@ void RenderManager::RenderTriangle2D(const Vector2f& fromPosition, const Vector2
 		SetDepthMode(false);
 	}
 
-	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(L"Geometry2D"));
+	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(GEOMETRY_2D_SHADER));
 	shader->DrawTriangle2D(screenOrtho_, fromPosition, byPosition, toPosition, color);
 }
 
@@ -308,7 +380,7 @@ void RenderManager::RenderTriangle2D(const Vector2f& fromPosition, const Vector4
 		SetDepthMode(false);
 	}
 
-	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(L"Geometry2D"));
+	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(GEOMETRY_2D_SHADER));
 	shader->DrawTriangle2D(screenOrtho_,
 		fromPosition, fromColor,
 		byPosition, byColor,
@@ -323,7 +395,7 @@ void RenderManager::RenderWireframeTriangle2D(const Vector2f& fromPosition, cons
 		SetDepthMode(false);
 	}
 
-	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(L"Geometry2D"));
+	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(GEOMETRY_2D_SHADER));
 	shader->DrawWireframeTriangle2D(screenOrtho_, fromPosition, byPosition, toPosition, color);
 }
 
@@ -334,7 +406,7 @@ void RenderManager::RenderWireframeTriangle2D(const Vector2f& fromPosition, cons
 		SetDepthMode(false);
 	}
 
-	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(L"Geometry2D"));
+	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(GEOMETRY_2D_SHADER));
 	shader->DrawWireframeTriangle2D(screenOrtho_, fromPosition, fromColor, byPosition, byColor, toPosition, toColor);
 }
 
@@ -345,7 +417,7 @@ void RenderManager::RenderRectangle2D(const Vector2f& center, float width, float
 		SetDepthMode(false);
 	}
 
-	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(L"Geometry2D"));
+	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(GEOMETRY_2D_SHADER));
 	shader->DrawRectangle2D(screenOrtho_, center, width, height, rotate, color);
 }
 
@@ -356,7 +428,7 @@ void RenderManager::RenderWireframeRectangle2D(const Vector2f& center, float wid
 		SetDepthMode(false);
 	}
 
-	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(L"Geometry2D"));
+	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(GEOMETRY_2D_SHADER));
 	shader->DrawWireframeRectangle2D(screenOrtho_, center, width, height, rotate, color);
 }
 
@@ -367,7 +439,7 @@ void RenderManager::RenderCircle2D(const Vector2f& center, float radius, const V
 		SetDepthMode(false);
 	}
 
-	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(L"Geometry2D"));
+	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(GEOMETRY_2D_SHADER));
 	shader->DrawCircle2D(screenOrtho_, center, radius, color, sliceCount);
 }
 
@@ -378,7 +450,7 @@ void RenderManager::RenderWireframeCircle2D(const Vector2f& center, float radius
 		SetDepthMode(false);
 	}
 
-	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(L"Geometry2D"));
+	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(GEOMETRY_2D_SHADER));
 	shader->DrawWireframeCircle2D(screenOrtho_, center, radius, color, sliceCount);
 }
 
@@ -389,7 +461,7 @@ void RenderManager::RenderEllipse2D(const Vector2f& center, float xAxis, float y
 		SetDepthMode(false);
 	}
 
-	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(L"Geometry2D"));
+	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(GEOMETRY_2D_SHADER));
 	shader->DrawEllipse2D(screenOrtho_, center, xAxis, yAxis, color, sliceCount);
 }
 
@@ -400,7 +472,7 @@ void RenderManager::RenderWireframeEllipse2D(const Vector2f& center, float xAxis
 		SetDepthMode(false);
 	}
 
-	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(L"Geometry2D"));
+	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(GEOMETRY_2D_SHADER));
 	shader->DrawWireframeEllipse2D(screenOrtho_, center, xAxis, yAxis, color, sliceCount);
 }
 
@@ -411,7 +483,7 @@ void RenderManager::RenderTexture2D(const Texture2D* texture, const Vector2f& ce
 		SetDepthMode(false);
 	}
 
-	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(L"Texture2D"));
+	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(TEXTURE_2D_SHADER));
 	shader->DrawTexture2D(screenOrtho_, texture, center, width, height, rotate, transparent);
 }
 
@@ -422,7 +494,7 @@ void RenderManager::RenderTexture2D(const Texture2D* texture, float transparent)
 		SetDepthMode(false);
 	}
 
-	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(L"Texture2D"));
+	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(TEXTURE_2D_SHADER));
 	shader->DrawTexture2D(texture, transparent);
 }
 
@@ -433,7 +505,7 @@ void RenderManager::RenderHorizonScrollTexture2D(const Texture2D* texture, float
 		SetDepthMode(false);
 	}
 
-	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(L"Texture2D"));
+	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(TEXTURE_2D_SHADER));
 	shader->DrawHorizonScrollTexture2D(texture, rate, transparent);
 }
 
@@ -444,7 +516,7 @@ void RenderManager::RenderHorizonScrollTexture2D(const Texture2D* texture, const
 		SetDepthMode(false);
 	}
 
-	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(L"Texture2D"));
+	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(TEXTURE_2D_SHADER));
 	shader->DrawHorizonScrollTexture2D(screenOrtho_, texture, center, width, height, rotate, rate, transparent);
 }
 
@@ -455,7 +527,7 @@ void RenderManager::RenderVerticalScrollTexture2D(const Texture2D* texture, floa
 		SetDepthMode(false);
 	}
 
-	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(L"Texture2D"));
+	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(TEXTURE_2D_SHADER));
 	shader->DrawVerticalScrollTexture2D(texture, rate, transparent);
 }
 
@@ -466,7 +538,7 @@ void RenderManager::RenderVerticalScrollTexture2D(const Texture2D* texture, cons
 		SetDepthMode(false);
 	}
 
-	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(L"Texture2D"));
+	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(TEXTURE_2D_SHADER));
 	shader->DrawVerticalScrollTexture2D(screenOrtho_, texture, center, width, height, rotate, rate, transparent);
 }
 
@@ -477,7 +549,7 @@ void RenderManager::RenderOutlineTexture2D(const Texture2D* texture, const Vecto
 		SetDepthMode(false);
 	}
 
-	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(L"Texture2D"));
+	TextureShader2D* shader = reinterpret_cast<TextureShader2D*>(shaderCache_.at(TEXTURE_2D_SHADER));
 	shader->DrawOutlineTexture2D(screenOrtho_, texture, center, width, height, rotate, outline, transparent);
 }
 
@@ -488,21 +560,43 @@ void RenderManager::RenderGrid2D(float minX, float maxX, float strideX, float mi
 		SetDepthMode(false);
 	}
 
-	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(L"Geometry2D"));
+	GeometryShader2D* shader = reinterpret_cast<GeometryShader2D*>(shaderCache_.at(GEOMETRY_2D_SHADER));
 	shader->DrawGrid2D(screenOrtho_, minX, maxX, strideX, minY, maxY, strideY, color);
 }
 
-void RenderManager::RenderText2D(const TTFont* font, const std::wstring& text, const Vector2f& center, const Vector4f& color)
+void RenderManager::RenderText2D(const TTFont* font, std::wstring_view text, const Vector2f& center, const Vector4f& color)
 {
 	if (bIsEnableDepth_)
 	{
 		SetDepthMode(false);
 	}
 
-	GlyphShader2D* shader = reinterpret_cast<GlyphShader2D*>(shaderCache_.at(L"Glyph2D"));
+	GlyphShader2D* shader = reinterpret_cast<GlyphShader2D*>(shaderCache_.at(GLYPH_2D_SHADER));
 	shader->DrawText2D(screenOrtho_, font, text, center, color);
 }
 
+void RenderManager::RenderText2D(GlyphCache* glyphCache, std::wstring_view text, const Vector2f& center, const Vector4f& color)
+{
+	ASSERT(std::find(glyphCaches_.begin(), glyphCaches_.end(), glyphCache) != glyphCaches_.end(), "not register glyph cache...");
+
+	//   ٸ ؽƮ  ٽ ص ǥ µ, ۸  ûϰ  EndFrame մϴ.
+	glyphCache->RequestGlyphs(text);
+
+	glyphCacheTexts_.push_back(GlyphCacheText{ glyphCache, glyphCacheTextBuffer_.size(), text.size(), center, color });
+	glyphCacheTextBuffer_.append(text);
+}
+
+void RenderManager::RenderTextLayout(TextLayout& layout, const Vector4f& color)
+{
+	if (bIsEnableDepth_)
+	{
+		SetDepthMode(false);
+	}
+
+	GlyphShader2D* shader = reinterpret_cast<GlyphShader2D*>(shaderCache_.at(GLYPH_2D_SHADER));
+	shader->DrawTextLayout(screenOrtho_, layout, color);
+}
+
 void RenderManager::RenderPoints3D(const Camera3D* camera, const std::vector<Vector3f>& positions, const Vector4f& color)
 {
 	if (!bIsEnableDepth_)
@@ -510,7 +604,7 @@ void RenderManager::RenderPoints3D(const Camera3D* camera, const std::vector<Vec
 		SetDepthMode(true);
 	}
 
-	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(L"Geometry3D"));
+	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(GEOMETRY_3D_SHADER));
 	shader->DrawPoints3D(camera->GetViewMatrix(), camera->GetProjectionMatrix(), positions, color);
 }
 
@@ -521,7 +615,7 @@ void RenderManager::RenderConnectPoints3D(const Camera3D* camera, const std::vec
 		SetDepthMode(true);
 	}
 
-	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(L"Geometry3D"));
+	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(GEOMETRY_3D_SHADER));
 	shader->DrawConnectPoints3D(camera->GetViewMatrix(), camera->GetProjectionMatrix(), positions, color);
 }
 
@@ -532,7 +626,7 @@ void RenderManager::RenderLine3D(const Camera3D* camera, const Vector3f& fromPos
 		SetDepthMode(true);
 	}
 
-	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(L"Geometry3D"));
+	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(GEOMETRY_3D_SHADER));
 	shader->DrawLine3D(camera->GetViewMatrix(), camera->GetProjectionMatrix(), fromPosition, toPosition, color);
 }
 
@@ -543,7 +637,7 @@ void RenderManager::RenderLine3D(const Camera3D* camera, const Vector3f& fromPos
 		SetDepthMode(true);
 	}
 
-	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(L"Geometry3D"));
+	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(GEOMETRY_3D_SHADER));
 	shader->DrawLine3D(camera->GetViewMatrix(), camera->GetProjectionMatrix(), fromPosition, fromColor, toPosition, toColor);
 }
 
@@ -554,7 +648,7 @@ void RenderManager::RenderQuad3D(const Matrix4x4f& world, const Camera3D* camera
 		SetDepthMode(true);
 	}
 	
-	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(L"Geometry3D"));
+	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(GEOMETRY_3D_SHADER));
 	shader->DrawQuad3D(world, camera->GetViewMatrix(), camera->GetProjectionMatrix(), width, height, color);
 }
 
@@ -565,7 +659,7 @@ void RenderManager::RenderHorizonDividQuad3D(const Matrix4x4f& world, const Came
 		SetDepthMode(true);
 	}
 
-	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(L"Geometry3D"));
+	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(GEOMETRY_3D_SHADER));
 	shader->DrawHorizonDividQuad3D(world, camera->GetViewMatrix(), camera->GetProjectionMatrix(), width, height, rate, color, bgColor);
 }
 
@@ -576,7 +670,7 @@ void RenderManager::RenderVerticalDividQuad3D(const Matrix4x4f& world, const Cam
 		SetDepthMode(true);
 	}
 
-	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(L"Geometry3D"));
+	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(GEOMETRY_3D_SHADER));
 	shader->DrawVerticalDividQuad3D(world, camera->GetViewMatrix(), camera->GetProjectionMatrix(), width, height, rate, color, bgColor);
 }
 
@@ -587,7 +681,7 @@ void RenderManager::RenderAxisAlignedBoundingBox3D(const Camera3D* camera, const
 		SetDepthMode(true);
 	}
 
-	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(L"Geometry3D"));
+	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(GEOMETRY_3D_SHADER));
 	shader->DrawAxisAlignedBoundingBox3D(camera->GetViewMatrix(), camera->GetProjectionMatrix(), center, extents, color);
 }
 
@@ -598,7 +692,7 @@ void RenderManager::RenderWireframeSphere3D(const Camera3D* camera, const Vector
 		SetDepthMode(true);
 	}
 
-	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(L"Geometry3D"));
+	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(GEOMETRY_3D_SHADER));
 	shader->DrawWireframeSphere3D(camera->GetViewMatrix(), camera->GetProjectionMatrix(), center, radius, color, sliceCount);
 }
 
@@ -609,7 +703,7 @@ void RenderManager::RenderGrid3D(const Camera3D* camera, float minX, float maxX,
 		SetDepthMode(true);
 	}
 
-	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(L"Geometry3D"));
+	GeometryShader3D* shader = reinterpret_cast<GeometryShader3D*>(shaderCache_.at(GEOMETRY_3D_SHADER));
 	shader->DrawGrid3D(camera->GetViewMatrix(), camera->GetProjectionMatrix(), minX, maxX, strideX, minZ, maxZ, strideZ, color);
 }
 
@@ -620,19 +714,70 @@ void RenderManager::RenderSkybox3D(const Camera3D* camera, const Skybox* skybox)
 		SetDepthMode(true);
 	}
 
-	Shader* shader = reinterpret_cast<Shader*>(shaderCache_.at(L"Skybox"));
+	Shader* shader = reinterpret_cast<Shader*>(shaderCache_.at(SKYBOX_SHADER));
 	shader->Bind();
-	GL_ASSERT(glDepthFunc(GL_LEQUAL), "failed to set depth test GL_LEQUAL function...");
+	GL_ASSERT(GLStateCache::Get().SetDepthFunc(GL_LEQUAL), "failed to set depth test GL_LEQUAL function...");
 
 	shader->SetUniform("view", camera->GetViewMatrix());
 	shader->SetUniform("projection", camera->GetProjectionMatrix());
 
 	skybox->Active(0);
 
-	GL_ASSERT(glBindVertexArray(skybox->GetVertexArrayObject()), "failed to bind skybox vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(skybox->GetVertexArrayObject()), "failed to bind skybox vertex array...");
 	GL_ASSERT(glDrawArrays(GL_TRIANGLES, 0, skybox->GetVertexCount()), "failed to draw skybox...");
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind skybox vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(0), "failed to unbind skybox vertex array...");
 
-	GL_ASSERT(glDepthFunc(GL_LESS), "failed to set depth test GL_LESS function...");
+	GL_ASSERT(GLStateCache::Get().SetDepthFunc(GL_LESS), "failed to set depth test GL_LESS function...");
 	shader->Unbind();
+}
+
+void RenderManager::InitializeShader(Shader* shader, const std::wstring& vsName, const std::wstring& fsName)
+{
+	if (assetPack_ == nullptr)
+	{
+		std::wstring vsPath = StringUtils::PrintF(L"%ls%ls.vert", shaderPath_.c_str(), vsName.c_str());
+		std::wstring fsPath = StringUtils::PrintF(L"%ls%ls.frag", shaderPath_.c_str(), fsName.c_str());
+
+		shader->Initialize(vsPath, fsPath);
+		return;
+	}
+
+	std::vector<uint8_t> vsDecompressBuffer;
+	std::vector<uint8_t> fsDecompressBuffer;
+	BufferView vsSource = assetPack_->Read("Shader/" + StringUtils::Convert(vsName) + ".vert", vsDecompressBuffer);
+	BufferView fsSource = assetPack_->Read("Shader/" + StringUtils::Convert(fsName) + ".frag", fsDecompressBuffer);
+
+	shader->Initialize(vsSource, fsSource);
+}
+
+void RenderManager::FlushGlyphCaches()
+{
+	//   Ͷ  ۸ ĳø   ؽó ϴ.
+	for (GlyphCache* glyphCache : glyphCaches_)
+	{
+		glyphCache->Flush();
+	}
+
+	if (!glyphCacheTexts_.empty())
+	{
+		if (bIsEnableDepth_)
+		{
+			SetDepthMode(false);
+		}
+
+		GlyphShader2D* shader = reinterpret_cast<GlyphShader2D*>(shaderCache_.at(GLYPH_2D_SHADER));
+		for (const GlyphCacheText& glyphCacheText : glyphCacheTexts_)
+		{
+			std::wstring_view text(glyphCacheTextBuffer_.data() + glyphCacheText.textOffset, glyphCacheText.textLength);
+			shader->DrawText2D(screenOrtho_, glyphCacheText.glyphCache, text, glyphCacheText.center, glyphCacheText.color);
+		}
+
+		glyphCacheTexts_.clear();
+		glyphCacheTextBuffer_.clear();
+	}
+
+	for (GlyphCache* glyphCache : glyphCaches_)
+	{
+		glyphCache->Tick();
+	}
 }
\ No newline at end of file
@@ -0,0 +1,272 @@
+#include "Assertion.h"
+#include "IRenderBackend.h"
+#include "InstanceBuffer.h"
+#include "RenderQueue.h"
+#include "StaticMesh.h"
+
+
+/**
+ * @brief  Ű ̴, ؽó, ޽, Ƽ  ε ϴ Ʈ Դϴ.
+ */
+static const uint32_t SORT_KEY_INDEX_BITS = 12;
+
+
+/**
+ * @brief  ť     ִ ̴, ؽó, ޽, Ƽ  ִ Դϴ.
+ */
+static const uint32_t MAX_SORT_KEY_INDEX = 1 << SORT_KEY_INDEX_BITS;
+
+
+/**
+ * @brief  Ű Ƽ ε  ƮԴϴ.  8Ʈ  Ӵϴ.
+ */
+static const uint32_t MATERIAL_KEY_SHIFT = 8;
+
+
+/**
+ * @brief  Ű ޽ ε  ƮԴϴ.
+ */
+static const uint32_t MESH_KEY_SHIFT = MATERIAL_KEY_SHIFT + SORT_KEY_INDEX_BITS;
+
+
+/**
+ * @brief  Ű ؽó ε  ƮԴϴ.
+ */
+static const uint32_t TEXTURE_KEY_SHIFT = MESH_KEY_SHIFT + SORT_KEY_INDEX_BITS;
+
+
+/**
+ * @brief  Ű ̴ ε  ƮԴϴ.
+ */
+static const uint32_t SHADER_KEY_SHIFT = TEXTURE_KEY_SHIFT + SORT_KEY_INDEX_BITS;
+
+
+/**
+ * @brief  Ű  н  ƮԴϴ.  8Ʈ մϴ.
+ */
+static const uint32_t PASS_KEY_SHIFT = 56;
+
+
+/**
+ * @brief  Ŀ   óϴ ڸ Ʈ Դϴ.
+ */
+static const uint32_t RADIX_BITS = 8;
+
+
+/**
+ * @brief   Ŷ Դϴ.
+ */
+static const uint32_t RADIX_BUCKET_SIZE = 1 << RADIX_BITS;
+
+void RenderQueue::Clear()
+{
+	packets_.clear();
+	sortKeys_.clear();
+	sortedIndices_.clear();
+	bIsSorted_ = true;
+
+	shaderIndices_.clear();
+	textureIndices_.clear();
+	meshIndices_.clear();
+	materialIndices_.clear();
+}
+
+void RenderQueue::Add(const DrawPacket& packet)
+{
+	ASSERT(packet.shader != nullptr && (packet.mesh != nullptr || packet.meshBuffer != nullptr), "draw packet must have shader and mesh...");
+
+	uint64_t sortKey = 0;
+	sortKey |= static_cast<uint64_t>(packet.pass) << PASS_KEY_SHIFT;
+	sortKey |= GetDenseIndex<const Shader*>(shaderIndices_, packet.shader) << SHADER_KEY_SHIFT;
+	sortKey |= GetDenseIndex<uint32_t>(textureIndices_, packet.textureID) << TEXTURE_KEY_SHIFT;
+	sortKey |= GetDenseIndex<const void*>(meshIndices_, GetVertexSource(packet)) << MESH_KEY_SHIFT;
+	sortKey |= GetDenseIndex<const Material*>(materialIndices_, packet.material) << MATERIAL_KEY_SHIFT;
+
+	packets_.push_back(packet);
+	sortKeys_.push_back(sortKey);
+	bIsSorted_ = false;
+}
+
+RenderQueue::Statistics RenderQueue::Submit(IRenderBackend& backend, ERenderPass pass)
+{
+	Statistics statistics;
+
+	const std::vector<uint32_t>& sortedIndices = GetSortedIndices();
+
+	const Shader* currentShader = nullptr;
+	uint32_t currentTextureID = 0;
+	const void* currentVertexSource = nullptr;
+	const Material* currentMaterial = nullptr;
+
+	backend.Begin();
+
+	for (uint32_t index : sortedIndices)
+	{
+		const DrawPacket& packet = packets_[index];
+		if (packet.pass != pass)
+		{
+			continue;
+		}
+
+		if (packet.shader != currentShader)
+		{
+			backend.BindShader(packet.shader);
+			currentShader = packet.shader;
+			currentMaterial = nullptr; // Ƽ  ̴  ؾ մϴ.
+			statistics.countOfShaderChange++;
+		}
+
+		if (packet.textureID != 0 && packet.textureID != currentTextureID)
+		{
+			backend.BindTexture(0, packet.textureID);
+			currentTextureID = packet.textureID;
+			statistics.countOfTextureChange++;
+		}
+
+		const void* vertexSource = GetVertexSource(packet);
+		if (vertexSource != currentVertexSource)
+		{
+			if (packet.meshBuffer)
+			{
+				backend.BindMeshBuffer(packet.meshBuffer);
+			}
+			else
+			{
+				backend.BindMesh(packet.mesh);
+			}
+
+			currentVertexSource = vertexSource;
+			statistics.countOfMeshChange++;
+		}
+
+		if (packet.material != nullptr && packet.material != currentMaterial)
+		{
+			backend.SetMaterial(packet.material);
+			currentMaterial = packet.material;
+			statistics.countOfMaterialChange++;
+		}
+
+		if (packet.instanceBuffer)
+		{
+			if (packet.meshBuffer)
+			{
+				backend.DrawMeshInstancedBaseVertex(packet.instanceBuffer, packet.allocation);
+			}
+			else
+			{
+				backend.DrawMeshInstanced(packet.instanceBuffer, packet.mesh->GetIndexCount());
+			}
+
+			statistics.countOfInstance += packet.instanceBuffer->GetCountOfInstance();
+		}
+		else
+		{
+			if (packet.meshBuffer)
+			{
+				backend.DrawMeshBaseVertex(packet.world, packet.allocation);
+			}
+			else
+			{
+				backend.DrawMesh(packet.world, packet.mesh->GetIndexCount());
+			}
+
+			statistics.countOfInstance++;
+		}
+
+		statistics.countOfDraw++;
+	}
+
+	backend.End();
+
+	return statistics;
+}
+
+const std::vector<uint32_t>& RenderQueue::GetSortedIndices()
+{
+	if (!bIsSorted_)
+	{
+		Sort();
+	}
+
+	return sortedIndices_;
+}
+
+const void* RenderQueue::GetVertexSource(const DrawPacket& packet)
+{
+	if (packet.meshBuffer)
+	{
+		return packet.meshBuffer;
+	}
+
+	return packet.mesh;
+}
+
+template <typename T>
+uint64_t RenderQueue::GetDenseIndex(std::unordered_map<T, uint32_t>& indices, T key)
+{
+	auto it = indices.find(key);
+	if (it != indices.end())
+	{
+		return static_cast<uint64_t>(it->second);
+	}
+
+	uint32_t index = static_cast<uint32_t>(indices.size());
+	ASSERT(index < MAX_SORT_KEY_INDEX, "render queue sort key index overflow...");
+
+	indices.insert({ key, index });
+	return static_cast<uint64_t>(index);
+}
+
+void RenderQueue::Sort()
+{
+	uint32_t countOfPacket = static_cast<uint32_t>(packets_.size());
+
+	sortedIndices_.resize(countOfPacket);
+	scratchIndices_.resize(countOfPacket);
+
+	for (uint32_t index = 0; index < countOfPacket; ++index)
+	{
+		sortedIndices_[index] = index;
+	}
+
+	for (uint32_t shift = 0; shift < 64; shift += RADIX_BITS)
+	{
+		uint32_t bucketOffsets[RADIX_BUCKET_SIZE] = { 0, };
+		for (uint32_t index = 0; index < countOfPacket; ++index)
+		{
+			bucketOffsets[(sortKeys_[index] >> shift) & (RADIX_BUCKET_SIZE - 1)]++;
+		}
+
+		bool bIsSingleBucket = false;
+		for (uint32_t bucket = 0; bucket < RADIX_BUCKET_SIZE; ++bucket)
+		{
+			if (bucketOffsets[bucket] == countOfPacket)
+			{
+				bIsSingleBucket = true;
+				break;
+			}
+		}
+
+		if (bIsSingleBucket)
+		{
+			continue;
+		}
+
+		uint32_t offset = 0;
+		for (uint32_t bucket = 0; bucket < RADIX_BUCKET_SIZE; ++bucket)
+		{
+			uint32_t countOfBucket = bucketOffsets[bucket];
+			bucketOffsets[bucket] = offset;
+			offset += countOfBucket;
+		}
+
+		for (uint32_t index : sortedIndices_)
+		{
+			scratchIndices_[bucketOffsets[(sortKeys_[index] >> shift) & (RADIX_BUCKET_SIZE - 1)]++] = index;
+		}
+
+		sortedIndices_.swap(scratchIndices_);
+	}
+
+	bIsSorted_ = true;
+}
\ No newline at end of file
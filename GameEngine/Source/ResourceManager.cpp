@@ -6,7 +6,8 @@ void ResourceManager::Startup()
 {
 	ASSERT(!bIsStartup_, "already startup resource manager...");
 
-	resourceCache_ = std::unordered_map<std::string, std::unique_ptr<IResource>>();
+	resourceCache_ = std::unordered_map<StringId, std::unique_ptr<IResource>, StringId::Hasher>();
+	loadRecords_.clear();
 
 	bIsStartup_ = true;
 }
@@ -15,6 +16,9 @@ void ResourceManager::Shutdown()
 {
 	ASSERT(bIsStartup_, "not startup before or has already been shutdowned...");
 
+	// ۾ 尡  ҽ  ʵ  ε  ϴ.
+	WaitAsyncLoads();
+
 	for (auto& resource : resourceCache_)
 	{
 		resource.second->Release();
@@ -24,21 +28,81 @@ void ResourceManager::Shutdown()
 	bIsStartup_ = false;
 }
 
-void ResourceManager::DestroyResource(const std::string& signature)
+void ResourceManager::DestroyResource(const StringId& id)
 {
-	if (IsValidResourceKey(signature))
+	auto iter = resourceCache_.find(id);
+	if (iter != resourceCache_.end())
 	{
-		IResource* resource = resourceCache_.at(signature).get();
+		IResource* resource = iter->second.get();
 		if (resource && resource->IsInitialized())
 		{
 			resource->Release();
 		}
 
-		resourceCache_.erase(signature);
+		resourceCache_.erase(iter);
 	}
 }
 
-bool ResourceManager::IsValidResourceKey(const std::string& key)
+bool ResourceManager::IsValidResourceKey(const StringId& key)
 {
 	return resourceCache_.find(key) != resourceCache_.end();
+}
+
+uint32_t ResourceManager::FinalizeAsyncLoads()
+{
+	//  ۾ ȿ ٸ ҽ ٸ  Ƿ, ť   ű  մϴ.
+	std::vector<std::shared_ptr<LoadTask>> finalizingTasks;
+	{
+		std::lock_guard<std::mutex> lock(finalizeMutex_);
+		finalizingTasks.swap(finalizeTasks_);
+	}
+
+	for (const std::shared_ptr<LoadTask>& task : finalizingTasks)
+	{
+		auto startTime = std::chrono::steady_clock::now();
+		task->finalize();
+		auto endTime = std::chrono::steady_clock::now();
+
+		task->finalize = nullptr;
+		task->bIsFinalized = true;
+
+		LoadRecord record;
+		record.name = task->name;
+		record.loadSeconds = task->loadSeconds;
+		record.finalizeSeconds = std::chrono::duration<double>(endTime - startTime).count();
+		record.readySeconds = std::chrono::duration<double>(endTime - loadStartTime_).count();
+		loadRecords_.push_back(record);
+	}
+
+	return static_cast<uint32_t>(finalizingTasks.size());
+}
+
+void ResourceManager::WaitAsyncLoads()
+{
+	//  ۾  ε   Ƿ,  ũ⸦ Ź ٽ Ȯմϴ.
+	for (std::size_t index = 0; index < pendingLoadTasks_.size(); ++index)
+	{
+		std::shared_ptr<LoadTask> task = pendingLoadTasks_[index];
+		WaitAsyncLoad(*task);
+	}
+
+	pendingLoadTasks_.clear();
+}
+
+void ResourceManager::PushFinalizeTask(const std::shared_ptr<LoadTask>& task)
+{
+	std::lock_guard<std::mutex> lock(finalizeMutex_);
+	finalizeTasks_.push_back(task);
+}
+
+void ResourceManager::WaitAsyncLoad(const LoadTask& task)
+{
+	while (!task.bIsFinalized)
+	{
+		//  ҽ   ۾ 带 ͼ,   ҽ ε尡 и ʵ մϴ.
+		if (FinalizeAsyncLoads() == 0)
+		{
+			JobSystem::Get().Wait(task.counter);
+		}
+	}
 }
\ No newline at end of file
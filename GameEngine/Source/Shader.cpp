@@ -2,6 +2,7 @@
 
 #include "Assertion.h"
 #include "FileUtils.h"
+#include "GLStateCache.h"
 #include "Shader.h"
 #include "StringUtils.h"
 
@@ -15,21 +16,33 @@ Shader::~Shader()
 
 void Shader::Initialize(const std::wstring& vsPath, const std::wstring& fsPath)
 {
-	ASSERT(!bIsInitialized_, "already initialize shader resource...");
+	std::vector<uint8_t> vsSourceBuffer = FileUtils::ReadBufferFromFile(vsPath);
+	std::vector<uint8_t> fsSourceBuffer = FileUtils::ReadBufferFromFile(fsPath);
 
-	uniformLocationCache_ = std::map<std::string, uint32_t>();
-	
+	Initialize(BufferView(vsSourceBuffer), BufferView(fsSourceBuffer));
+}
+
+void Shader::Initialize(const std::wstring& vsPath, const std::wstring& gsPath, const std::wstring& fsPath)
+{
 	std::vector<uint8_t> vsSourceBuffer = FileUtils::ReadBufferFromFile(vsPath);
+	std::vector<uint8_t> gsSourceBuffer = FileUtils::ReadBufferFromFile(gsPath);
 	std::vector<uint8_t> fsSourceBuffer = FileUtils::ReadBufferFromFile(fsPath);
 
-	std::string vsSource(vsSourceBuffer.begin(), vsSourceBuffer.end());
-	std::string fsSource(fsSourceBuffer.begin(), fsSourceBuffer.end());
+	Initialize(BufferView(vsSourceBuffer), BufferView(gsSourceBuffer), BufferView(fsSourceBuffer));
+}
+
+void Shader::Initialize(const BufferView& vsSource, const BufferView& fsSource)
+{
+	ASSERT(!bIsInitialized_, "already initialize shader resource...");
 
+	uniformLocations_.clear();
+	uniformBlockSizes_.clear();
+	
 	uint32_t vsID = CreateAndCompileShader(EType::Vertex, vsSource);
-	ASSERT(vsID != 0, L"failed to create and compile %s...", vsPath.c_str());
+	ASSERT(vsID != 0, "failed to create and compile vertex shader...");
 	
 	uint32_t fsID = CreateAndCompileShader(EType::Fragment, fsSource);
-	ASSERT(fsID != 0, L"failed to create and compile %s...", fsPath.c_str());
+	ASSERT(fsID != 0, "failed to create and compile fragment shader...");
 
 	programID_ = glCreateProgram();
 	ASSERT(programID_ != 0, "failed to create shader program...");
@@ -51,31 +64,26 @@ void Shader::Initialize(const std::wstring& vsPath, const std::wstring& fsPath)
 	GL_ASSERT(glDeleteShader(vsID), "invalid delete %d shader...", vsID);
 	GL_ASSERT(glDeleteShader(fsID), "invalid delete %d shader...", fsID);
 
+	ReflectProgram();
+
 	bIsInitialized_ = true;
 }
 
-void Shader::Initialize(const std::wstring& vsPath, const std::wstring& gsPath, const std::wstring& fsPath)
+void Shader::Initialize(const BufferView& vsSource, const BufferView& gsSource, const BufferView& fsSource)
 {
 	ASSERT(!bIsInitialized_, "already initialize shader resource...");
 
-	uniformLocationCache_ = std::map<std::string, uint32_t>();
-
-	std::vector<uint8_t> vsSourceBuffer = FileUtils::ReadBufferFromFile(vsPath);
-	std::vector<uint8_t> gsSourceBuffer = FileUtils::ReadBufferFromFile(gsPath);
-	std::vector<uint8_t> fsSourceBuffer = FileUtils::ReadBufferFromFile(fsPath);
-
-	std::string vsSource(vsSourceBuffer.begin(), vsSourceBuffer.end());
-	std::string gsSource(gsSourceBuffer.begin(), gsSourceBuffer.end());
-	std::string fsSource(fsSourceBuffer.begin(), fsSourceBuffer.end());
+	uniformLocations_.clear();
+	uniformBlockSizes_.clear();
 
 	uint32_t vsID = CreateAndCompileShader(EType::Vertex, vsSource);
-	ASSERT(vsID != 0, L"failed to create and compile %s...", vsPath.c_str());
+	ASSERT(vsID != 0, "failed to create and compile vertex shader...");
 
 	uint32_t gsID = CreateAndCompileShader(EType::Geometry, gsSource);
-	ASSERT(gsID != 0, L"failed to create and compile %s...", gsPath.c_str());
+	ASSERT(gsID != 0, "failed to create and compile geometry shader...");
 
 	uint32_t fsID = CreateAndCompileShader(EType::Fragment, fsSource);
-	ASSERT(fsID != 0, L"failed to create and compile %s...", fsPath.c_str());
+	ASSERT(fsID != 0, "failed to create and compile fragment shader...");
 
 	programID_ = glCreateProgram();
 	ASSERT(programID_ != 0, "failed to create shader program...");
@@ -99,6 +107,8 @@ void Shader::Initialize(const std::wstring& vsPath, const std::wstring& gsPath,
 	GL_ASSERT(glDeleteShader(gsID), "invalid delete %d shader...", gsID);
 	GL_ASSERT(glDeleteShader(fsID), "invalid delete %d shader...", fsID);
 
+	ReflectProgram();
+
 	bIsInitialized_ = true;
 }
 
@@ -108,7 +118,7 @@ void Shader::Release()
 
 	if (programID_ != 0)
 	{
-		GL_ASSERT(glDeleteProgram(programID_), "failed to delete shader program : %d", programID_);
+		GL_ASSERT(GLStateCache::Get().DeleteProgram(programID_), "failed to delete shader program : %d", programID_);
 	}
 
 	bIsInitialized_ = false;
@@ -116,324 +126,181 @@ void Shader::Release()
 
 void Shader::Bind()
 {
-	GL_ASSERT(glUseProgram(programID_), "failed to bind shader program...");
+	GL_ASSERT(GLStateCache::Get().UseProgram(programID_), "failed to bind shader program...");
 }
 
 void Shader::Unbind()
 {
-	GL_ASSERT(glUseProgram(0), "failed to unbind shader program...");
+	GL_ASSERT(GLStateCache::Get().UseProgram(0), "failed to unbind shader program...");
 }
 
 void Shader::SetUniform(const std::string& name, bool value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniform1i(location, static_cast<int32_t>(value)), "failed to set bool type uniform value : %d", static_cast<int32_t>(value));
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, int32_t value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniform1i(location, static_cast<int32_t>(value)), "faild to set int type uniform value : %d", static_cast<int32_t>(value));
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, float value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniform1f(location, value), "failed to set float type uniform value : %f", value);
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, const Vector2f& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	const float* valuePtr = value.GetPtr();
-	GL_ASSERT(glUniform2fv(location, 1, valuePtr), "failed to set Vector2f type uniform value : (%f, %f)", value.x, value.y);
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, float x, float y)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniform2f(location, x, y), "failed to set Vector2f type uniform value : (%f, %f)", x, y);
+	SetUniform(GetUniformHandle(name), Vector2f(x, y));
 }
 
 void Shader::SetUniform(const std::string& name, const Vector2i& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	const int32_t* valuePtr = value.GetPtr();
-	GL_ASSERT(glUniform2iv(location, 1, valuePtr), "failed to set Vector2i type uniform value : (%d, %d)", value.x, value.y);
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, int32_t x, int32_t y)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniform2i(location, x, y), "failed to set Vector2i type uniform value : (%d, %d)", x, y);
+	SetUniform(GetUniformHandle(name), Vector2i(x, y));
 }
 
 void Shader::SetUniform(const std::string& name, const Vector3f& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	const float* valuePtr = value.GetPtr();
-	GL_ASSERT(glUniform3fv(location, 1, valuePtr), "failed to set Vector3f type uniform value : (%f, %f, %f)", value.x, value.y, value.z);
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, float x, float y, float z)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniform3f(location, x, y, z), "failed to set Vector3f type uniform value : (%f, %f, %f)", x, y, z);
+	SetUniform(GetUniformHandle(name), Vector3f(x, y, z));
 }
 
 void Shader::SetUniform(const std::string& name, const Vector3i& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	const int32_t* valuePtr = value.GetPtr();
-	GL_ASSERT(glUniform3iv(location, 1, valuePtr), "failed to set Vector3i type uniform value : (%d, %d, %d)", value.x, value.y, value.z);
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, int32_t x, int32_t y, int32_t z)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniform3i(location, x, y, z), "failed to set Vector3i type uniform value : (%d, %d, %d)", x, y, z);
+	SetUniform(GetUniformHandle(name), Vector3i(x, y, z));
 }
 
 void Shader::SetUniform(const std::string& name, const Vector4f& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	const float* valuePtr = value.GetPtr();
-	GL_ASSERT(glUniform4fv(location, 1, valuePtr), "failed to set Vector4f type uniform value : (%f, %f, %f, %f)", value.x, value.y, value.z, value.w);
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, float x, float y, float z, float w)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniform4f(location, x, y, z, w), "failed to set Vector4f type uniform value : (%f, %f, %f, %f)", x, y, z, w);
+	SetUniform(GetUniformHandle(name), Vector4f(x, y, z, w));
 }
 
 void Shader::SetUniform(const std::string& name, const Vector4i& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	const int32_t* valuePtr = value.GetPtr();
-	GL_ASSERT(glUniform4iv(location, 1, valuePtr), "failed to set Vector4i type uniform value : (%d, %d, %d, %d)", value.x, value.y, value.z, value.w);
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, int32_t x, int32_t y, int32_t z, int32_t w)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniform4i(location, x, y, z, w), "failed to set Vector4i type uniform value : (%d, %d, %d, %d)", x, y, z, w);
+	SetUniform(GetUniformHandle(name), Vector4i(x, y, z, w));
 }
 
 void Shader::SetUniform(const std::string& name, const Matrix2x2f& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniformMatrix2fv(location, 1, GL_FALSE, value.GetPtr()), "failed to set Matrix2x2f type uniform value...");
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, const Matrix3x3f& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
-	{
-		location = uniformLocation->second;
-	}
-
-	GL_ASSERT(glUniformMatrix3fv(location, 1, GL_FALSE, value.GetPtr()), "failed to set Matrix3x3f type uniform value...");
+	SetUniform(GetUniformHandle(name), value);
 }
 
 void Shader::SetUniform(const std::string& name, const Matrix4x4f& value)
 {
-	int32_t location = -1;
-	std::map<std::string, uint32_t>::iterator uniformLocation = uniformLocationCache_.find(name);
-	if (uniformLocation == uniformLocationCache_.end())
-	{
-		location = GetUniformLocation(name);
-		uniformLocationCache_.insert({ name, location });
-	}
-	else
+	SetUniform(GetUniformHandle(name), value);
+}
+
+void Shader::SetUniform(const UniformHandle& handle, bool value)
+{
+	GL_ASSERT(glUniform1i(handle.location, static_cast<int32_t>(value)), "failed to set bool type uniform value : %d", static_cast<int32_t>(value));
+}
+
+void Shader::SetUniform(const UniformHandle& handle, int32_t value)
+{
+	GL_ASSERT(glUniform1i(handle.location, value), "faild to set int type uniform value : %d", value);
+}
+
+void Shader::SetUniform(const UniformHandle& handle, float value)
+{
+	GL_ASSERT(glUniform1f(handle.location, value), "failed to set float type uniform value : %f", value);
+}
+
+void Shader::SetUniform(const UniformHandle& handle, const Vector2f& value)
+{
+	GL_ASSERT(glUniform2fv(handle.location, 1, value.GetPtr()), "failed to set Vector2f type uniform value : (%f, %f)", value.x, value.y);
+}
+
+void Shader::SetUniform(const UniformHandle& handle, const Vector2i& value)
+{
+	GL_ASSERT(glUniform2iv(handle.location, 1, value.GetPtr()), "failed to set Vector2i type uniform value : (%d, %d)", value.x, value.y);
+}
+
+void Shader::SetUniform(const UniformHandle& handle, const Vector3f& value)
+{
+	GL_ASSERT(glUniform3fv(handle.location, 1, value.GetPtr()), "failed to set Vector3f type uniform value : (%f, %f, %f)", value.x, value.y, value.z);
+}
+
+void Shader::SetUniform(const UniformHandle& handle, const Vector3i& value)
+{
+	GL_ASSERT(glUniform3iv(handle.location, 1, value.GetPtr()), "failed to set Vector3i type uniform value : (%d, %d, %d)", value.x, value.y, value.z);
+}
+
+void Shader::SetUniform(const UniformHandle& handle, const Vector4f& value)
+{
+	GL_ASSERT(glUniform4fv(handle.location, 1, value.GetPtr()), "failed to set Vector4f type uniform value : (%f, %f, %f, %f)", value.x, value.y, value.z, value.w);
+}
+
+void Shader::SetUniform(const UniformHandle& handle, const Vector4i& value)
+{
+	GL_ASSERT(glUniform4iv(handle.location, 1, value.GetPtr()), "failed to set Vector4i type uniform value : (%d, %d, %d, %d)", value.x, value.y, value.z, value.w);
+}
+
+void Shader::SetUniform(const UniformHandle& handle, const Matrix2x2f& value)
+{
+	GL_ASSERT(glUniformMatrix2fv(handle.location, 1, GL_FALSE, value.GetPtr()), "failed to set Matrix2x2f type uniform value...");
+}
+
+void Shader::SetUniform(const UniformHandle& handle, const Matrix3x3f& value)
+{
+	GL_ASSERT(glUniformMatrix3fv(handle.location, 1, GL_FALSE, value.GetPtr()), "failed to set Matrix3x3f type uniform value...");
+}
+
+void Shader::SetUniform(const UniformHandle& handle, const Matrix4x4f& value)
+{
+	GL_ASSERT(glUniformMatrix4fv(handle.location, 1, GL_FALSE, value.GetPtr()), "failed to set Matrix4x4f type uniform value...");
+}
+
+UniformHandle Shader::GetUniformHandle(const std::string& name) const
+{
+	UniformHandle handle;
+
+	std::unordered_map<std::string, int32_t>::const_iterator uniformLocation = uniformLocations_.find(name);
+	if (uniformLocation != uniformLocations_.end())
 	{
-		location = uniformLocation->second;
+		handle.location = uniformLocation->second;
 	}
 
-	GL_ASSERT(glUniformMatrix4fv(location, 1, GL_FALSE, value.GetPtr()), "failed to set Matrix4x4f type uniform value...");
+	return handle;
+}
+
+uint32_t Shader::GetUniformBlockSize(const std::string& blockName) const
+{
+	std::unordered_map<std::string, uint32_t>::const_iterator uniformBlockSize = uniformBlockSizes_.find(blockName);
+	return uniformBlockSize != uniformBlockSizes_.end() ? uniformBlockSize->second : 0;
 }
 
 int32_t Shader::GetUniformLocation(const std::string& uniformName)
@@ -445,7 +312,7 @@ void Shader::WriteDynamicVertexBuffer(uint32_t vertexBufferID, const void* verte
 {
 	ASSERT(vertexPtr != nullptr, "invalid vertex buffer pointer...");
 
-	GL_ASSERT(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferID), "failed to dynamic vertex buffer...");
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, vertexBufferID), "failed to dynamic vertex buffer...");
 	void* bufferPtr = glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY);
 	ASSERT(bufferPtr != nullptr, "failed to map the entire data store of a specified buffer object into the client's address space...");
 	
@@ -453,10 +320,10 @@ void Shader::WriteDynamicVertexBuffer(uint32_t vertexBufferID, const void* verte
 	GLboolean bSuccssed = glUnmapBuffer(GL_ARRAY_BUFFER);
 	ASSERT(bSuccssed, "failed to unmap the entire data store of a specified buffer object into the client's address space...");
 
-	GL_ASSERT(glBindBuffer(GL_ARRAY_BUFFER, 0), "failed to unbind dynamic vertex buffer...");
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, 0), "failed to unbind dynamic vertex buffer...");
 }
 
-uint32_t Shader::CreateAndCompileShader(const EType& type, const std::string& source)
+uint32_t Shader::CreateAndCompileShader(const EType& type, const BufferView& source)
 {
 	uint32_t shaderType = 0;
 	switch (type)
@@ -478,11 +345,12 @@ uint32_t Shader::CreateAndCompileShader(const EType& type, const std::string& so
 		break;
 	}
 
-	const char* sourcePtr = source.c_str();
+	const char* sourcePtr = reinterpret_cast<const char*>(source.GetData());
+	int32_t sourceLength = static_cast<int32_t>(source.GetSize());
 	uint32_t shaderID = glCreateShader(shaderType);
 	ASSERT(shaderID != 0, "failed to create %s shader", type == EType::Vertex ? "Vertex" : "Fragment");
 
-	GL_ASSERT(glShaderSource(shaderID, 1, &sourcePtr, nullptr), "failed to set source code in shader...");
+	GL_ASSERT(glShaderSource(shaderID, 1, &sourcePtr, &sourceLength), "failed to set source code in shader...");
 	GL_ASSERT(glCompileShader(shaderID), "failed to compile %s shader...", type == EType::Vertex ? "Vertex" : "Fragment");
 
 	int32_t success;
@@ -496,4 +364,58 @@ uint32_t Shader::CreateAndCompileShader(const EType& type, const std::string& so
 	}
 
 	return shaderID;
+}
+
+void Shader::ReflectProgram()
+{
+	static const GLenum uniformProperties[] = { GL_NAME_LENGTH, GL_LOCATION, };
+	static const GLenum uniformBlockProperties[] = { GL_NAME_LENGTH, GL_BUFFER_DATA_SIZE, };
+
+	int32_t countOfUniform = 0;
+	GL_ASSERT(glGetProgramInterfaceiv(programID_, GL_UNIFORM, GL_ACTIVE_RESOURCES, &countOfUniform), "failed to get count of active uniform...");
+
+	std::string name;
+	for (int32_t index = 0; index < countOfUniform; ++index)
+	{
+		int32_t values[2] = { 0, -1, };
+		GL_ASSERT(glGetProgramResourceiv(programID_, GL_UNIFORM, index, 2, uniformProperties, 2, nullptr, values), "failed to get active uniform properties...");
+
+		int32_t nameLength = values[0];
+		int32_t location = values[1];
+		if (location < 0) //    ġ Ƿ  ۷θ մϴ.
+		{
+			continue;
+		}
+
+		name.resize(static_cast<std::size_t>(nameLength));
+		GL_ASSERT(glGetProgramResourceName(programID_, GL_UNIFORM, index, nameLength, nullptr, &name[0]), "failed to get active uniform name...");
+		name.resize(static_cast<std::size_t>(nameLength - 1)); // ̸ ̿  ڰ ԵǾ ֽϴ.
+
+		uniformLocations_.insert({ name, location });
+
+		// 迭  "name[0]" ǹǷ, glGetUniformLocationó "name"ε ã  ְ մϴ.
+		std::size_t arraySuffix = name.rfind("[0]");
+		if (arraySuffix != std::string::npos && arraySuffix + 3 == name.size())
+		{
+			uniformLocations_.insert({ name.substr(0, arraySuffix), location });
+		}
+	}
+
+	int32_t countOfUniformBlock = 0;
+	GL_ASSERT(glGetProgramInterfaceiv(programID_, GL_UNIFORM_BLOCK, GL_ACTIVE_RESOURCES, &countOfUniformBlock), "failed to get count of active uniform block...");
+
+	for (int32_t index = 0; index < countOfUniformBlock; ++index)
+	{
+		int32_t values[2] = { 0, 0, };
+		GL_ASSERT(glGetProgramResourceiv(programID_, GL_UNIFORM_BLOCK, index, 2, uniformBlockProperties, 2, nullptr, values), "failed to get active uniform block properties...");
+
+		int32_t nameLength = values[0];
+		uint32_t blockSize = static_cast<uint32_t>(values[1]);
+
+		name.resize(static_cast<std::size_t>(nameLength));
+		GL_ASSERT(glGetProgramResourceName(programID_, GL_UNIFORM_BLOCK, index, nameLength, nullptr, &name[0]), "failed to get active uniform block name...");
+		name.resize(static_cast<std::size_t>(nameLength - 1));
+
+		uniformBlockSizes_.insert({ name, blockSize });
+	}
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include <glad/glad.h>
 
 #include "Assertion.h"
+#include "GLStateCache.h"
 #include "ShadowMap.h"
 
 ShadowMap::~ShadowMap()
@@ -19,10 +20,10 @@ void ShadowMap::Initialize(uint32_t shadowWidth, uint32_t shadowHeight)
 	float border[] = { 1.0f, 1.0f, 1.0f, 1.0f };
 
 	GL_ASSERT(glGenFramebuffers(1, &shadowMapFBO_), "failed to generate shaodw map framebuffer...");
-	GL_ASSERT(glBindFramebuffer(GL_FRAMEBUFFER, shadowMapFBO_), "failed to bind shadow map framebuffer...");
+	GL_ASSERT(GLStateCache::Get().BindFramebuffer(shadowMapFBO_), "failed to bind shadow map framebuffer...");
 
 	GL_ASSERT(glGenTextures(1, &shadowMapID_), "filed to generate shadow map texture...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, shadowMapID_), "failed to bind shadow map texture...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, shadowMapID_), "failed to bind shadow map texture...");
 	GL_ASSERT(glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, shadowWidth, shadowHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr), "failed to allows elements of an image array to be read by shaders...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST), "failed to set texture object min filter...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST), "failed to set texture object mag filter...");
@@ -37,7 +38,7 @@ void ShadowMap::Initialize(uint32_t shadowWidth, uint32_t shadowHeight)
 	GLenum state = glCheckFramebufferStatus(GL_FRAMEBUFFER);
 	ASSERT(state == GL_FRAMEBUFFER_COMPLETE, "not complete framebuffer state : %x...", static_cast<int32_t>(state));
 
-	GL_ASSERT(glBindFramebuffer(GL_FRAMEBUFFER, 0), "failed to unbind shadow map framebuffer...");
+	GL_ASSERT(GLStateCache::Get().BindFramebuffer(0), "failed to unbind shadow map framebuffer...");
 
 	bIsInitialized_ = true;
 }
@@ -46,8 +47,8 @@ void ShadowMap::Release()
 {
 	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
 
-	GL_ASSERT(glDeleteTextures(1, &shadowMapID_), "failed to delete shaodw map texture...");
-	GL_ASSERT(glDeleteFramebuffers(1, &shadowMapFBO_), "failed to delete shadow map framebuffer...");
+	GL_ASSERT(GLStateCache::Get().DeleteTexture(shadowMapID_), "failed to delete shaodw map texture...");
+	GL_ASSERT(GLStateCache::Get().DeleteFramebuffer(shadowMapFBO_), "failed to delete shadow map framebuffer...");
 
 	bIsInitialized_ = false;
 }
@@ -63,7 +64,7 @@ void ShadowMap::Bind()
 	if (!bIsBind_)
 	{
 		bIsBind_ = true;
-		GL_ASSERT(glBindFramebuffer(GL_FRAMEBUFFER, shadowMapFBO_), "failed to bind shadow map framebuffer...");
+		GL_ASSERT(GLStateCache::Get().BindFramebuffer(shadowMapFBO_), "failed to bind shadow map framebuffer...");
 	}
 }
 
@@ -72,12 +73,11 @@ void ShadowMap::Unbind()
 	if (bIsBind_)
 	{
 		bIsBind_ = false;
-		GL_ASSERT(glBindFramebuffer(GL_FRAMEBUFFER, 0), "failed to unbind shadow map framebuffer...");
+		GL_ASSERT(GLStateCache::Get().BindFramebuffer(0), "failed to unbind shadow map framebuffer...");
 	}
 }
 
 void ShadowMap::Active(uint32_t unit) const
 {
-	GL_ASSERT(glActiveTexture(GL_TEXTURE0 + unit), "failed to active %d texture unit...", (GL_TEXTURE0 + unit));
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, shadowMapID_), "failed to bind shadow map texture...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(unit, GL_TEXTURE_2D, shadowMapID_), "failed to bind shadow map texture...");
 }
\ No newline at end of file
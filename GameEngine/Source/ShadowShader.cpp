@@ -1,23 +1,39 @@
 #include <glad/glad.h>
 
 #include "Assertion.h"
-#include "Light.h"
+#include "GLStateCache.h"
+#include "InstanceBuffer.h"
 #include "StaticMesh.h"
 #include "ShadowShader.h"
+#include "UniformBlock.h"
 
 ShadowShader::~ShadowShader() {}
 
-void ShadowShader::SetLight(const Light* light)
+void ShadowShader::Initialize(const BufferView& vsSource, const BufferView& fsSource)
 {
-	SetUniform("lightView", light->GetViewMatrix());
-	SetUniform("lightProjection", light->GetProjectionMatrix());
+	ASSERT(!bIsInitialized_, "already initialize shadow shader resource...");
+
+	Shader::Initialize(vsSource, fsSource);
+
+	worldHandle_ = GetUniformHandle("world");
+
+	uint32_t frameBlockSize = GetUniformBlockSize("FrameBlock");
+	ASSERT(frameBlockSize == 0 || frameBlockSize == sizeof(FrameUniformBlock), "mismatch frame uniform block size : %d", frameBlockSize);
 }
 
 void ShadowShader::DrawMesh3D(const Matrix4x4f& world, const StaticMesh* mesh)
 {
-	SetUniform("world", world);
+	SetUniform(worldHandle_, world);
 
-	GL_ASSERT(glBindVertexArray(mesh->GetVertexArrayObject()), "failed to bind static mesh vertex array...");
+	//  ޽ø ̾ ׸   ĳð ε ϵ, ׸ ڿ  迭 Ʈ ε  ʽϴ.
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(mesh->GetVertexArrayObject()), "failed to bind static mesh vertex array...");
 	GL_ASSERT(glDrawElements(GL_TRIANGLES, mesh->GetIndexCount(), GL_UNSIGNED_INT, 0), "failed to draw static mesh...");
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind static mesh vertex array...");
+}
+
+void ShadowShader::DrawMeshInstanced3D(const StaticMesh* mesh, const InstanceBuffer* instanceBuffer)
+{
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(mesh->GetVertexArrayObject()), "failed to bind static mesh vertex array...");
+	instanceBuffer->Attach();
+	GL_ASSERT(glDrawElementsInstanced(GL_TRIANGLES, mesh->GetIndexCount(), GL_UNSIGNED_INT, 0, instanceBuffer->GetCountOfInstance()), "failed to draw static mesh instances...");
+	instanceBuffer->Detach();
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <stb_image.h>
 
 #include "Assertion.h"
+#include "GLStateCache.h"
 #include "Skybox.h"
 #include "FileUtils.h"
 #include "StringUtils.h"
@@ -51,17 +52,16 @@ void Skybox::Release()
 {
 	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
 
-	GL_ASSERT(glDeleteTextures(1, &cubeMapID_), "failed to delete cube map texture object...");
-	GL_ASSERT(glDeleteBuffers(1, &vertexBufferObject_), "failed to delete skybox vertex buffer object...");
-	GL_ASSERT(glDeleteVertexArrays(1, &vertexArrayObject_), "failed to delete skybox vertex array object...");
+	GL_ASSERT(GLStateCache::Get().DeleteTexture(cubeMapID_), "failed to delete cube map texture object...");
+	GL_ASSERT(GLStateCache::Get().DeleteBuffer(vertexBufferObject_), "failed to delete skybox vertex buffer object...");
+	GL_ASSERT(GLStateCache::Get().DeleteVertexArray(vertexArrayObject_), "failed to delete skybox vertex array object...");
 
 	bIsInitialized_ = false;
 }
 
 void Skybox::Active(uint32_t unit) const
 {
-	GL_ASSERT(glActiveTexture(GL_TEXTURE0 + unit), "failed to active %d texture unit...", (GL_TEXTURE0 + unit));
-	GL_ASSERT(glBindTexture(GL_TEXTURE_CUBE_MAP, cubeMapID_), "failed to bind cube map texture...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(unit, GL_TEXTURE_CUBE_MAP, cubeMapID_), "failed to bind cube map texture...");
 }
 
 std::wstring Skybox::GetCubemapExtension(const std::vector<std::wstring>& resourcePaths)
@@ -86,7 +86,7 @@ uint32_t Skybox::CreateNonCompressionCubemap(const std::vector<std::wstring>& re
 {
 	uint32_t cubeMapID;
 	GL_ASSERT(glGenTextures(1, &cubeMapID), "failed to generate texture object...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_CUBE_MAP, cubeMapID), "failed to bind texture object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_CUBE_MAP, cubeMapID), "failed to bind texture object...");
 
 	for (std::size_t index = 0; index < resourcePaths.size(); ++index)
 	{
@@ -109,7 +109,7 @@ uint32_t Skybox::CreateNonCompressionCubemap(const std::vector<std::wstring>& re
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE), "failed to set texture object warp t...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE), "failed to set texture object warp r...");
 
-	GL_ASSERT(glBindTexture(GL_TEXTURE_CUBE_MAP, 0), "failed to unbind texture object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_CUBE_MAP, 0), "failed to unbind texture object...");
 
 	return cubeMapID;
 }
@@ -118,7 +118,7 @@ uint32_t Skybox::CreateAstcCompressionCubemap(const std::vector<std::wstring>& r
 {
 	uint32_t cubeMapID;
 	GL_ASSERT(glGenTextures(1, &cubeMapID), "failed to generate texture object...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_CUBE_MAP, cubeMapID), "failed to bind texture object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_CUBE_MAP, cubeMapID), "failed to bind texture object...");
 
 	for (std::size_t index = 0; index < resourcePaths.size(); ++index)
 	{
@@ -148,7 +148,7 @@ uint32_t Skybox::CreateAstcCompressionCubemap(const std::vector<std::wstring>& r
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE), "failed to set texture object warp t...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE), "failed to set texture object warp r...");
 
-	GL_ASSERT(glBindTexture(GL_TEXTURE_CUBE_MAP, 0), "failed to unbind texture object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_CUBE_MAP, 0), "failed to unbind texture object...");
 
 	return cubeMapID;
 }
@@ -157,7 +157,7 @@ uint32_t Skybox::CreateDxtCompressionCubemap(const std::vector<std::wstring>& re
 {
 	uint32_t cubeMapID;
 	GL_ASSERT(glGenTextures(1, &cubeMapID), "failed to generate texture object...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_CUBE_MAP, cubeMapID), "failed to bind texture object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_CUBE_MAP, cubeMapID), "failed to bind texture object...");
 
 	for (std::size_t index = 0; index < resourcePaths.size(); ++index)
 	{
@@ -194,7 +194,7 @@ uint32_t Skybox::CreateDxtCompressionCubemap(const std::vector<std::wstring>& re
 		}
 	}
 
-	GL_ASSERT(glBindTexture(GL_TEXTURE_CUBE_MAP, 0), "failed to unbind texture object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_CUBE_MAP, 0), "failed to unbind texture object...");
 
 	return cubeMapID;
 }
@@ -248,12 +248,12 @@ void Skybox::CreateSkyboxVertexObject()
 
 	GL_ASSERT(glGenVertexArrays(1, &vertexArrayObject_), "failed to generate skybox vertex array...");
 	GL_ASSERT(glGenBuffers(1, &vertexBufferObject_), "failed to generate skybox vertex buffer...");
-	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind skybox vertex array...");
-	GL_ASSERT(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind skybox vertex buffer...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(vertexArrayObject_), "failed to bind skybox vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind skybox vertex buffer...");
 	GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, sizeof(float) * static_cast<uint32_t>(vertices.size()), vertices.data(), GL_STATIC_DRAW), "failed to create a new data store for a skybox vertex buffer object...");
 
 	GL_ASSERT(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)(0)), "failed to specify the location and data format of the array of generic vertex attributes at index...");
 	GL_ASSERT(glEnableVertexAttribArray(0), "failed to enable vertex attrib array...");
 
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind skybox vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(0), "failed to unbind skybox vertex array...");
 }
\ No newline at end of file
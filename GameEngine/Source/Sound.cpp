@@ -22,6 +22,19 @@ void Sound::Initialize(const std::wstring& path)
 	bIsInitialized_ = true;
 }
 
+void Sound::Initialize(const BufferView& buffer)
+{
+	ASSERT(!bIsInitialized_, "already initialize sound resource...");
+
+	decoder_ = std::make_unique<ma_decoder>();
+	ASSERT(ma_decoder_init_memory(buffer.GetData(), buffer.GetSize(), nullptr, decoder_.get()) == MA_SUCCESS, "failed to initialize sound decoder from memory...");
+
+	sound_ = std::make_unique<ma_sound>();
+	ASSERT(ma_sound_init_from_data_source(AudioManager::Get().GetAudioEngine(), decoder_.get(), 0, nullptr, sound_.get()) == MA_SUCCESS, "failed to initialize sound from memory...");
+
+	bIsInitialized_ = true;
+}
+
 void Sound::Release()
 {
 	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
@@ -29,6 +42,12 @@ void Sound::Release()
 	ma_sound_uninit(sound_.get());
 	sound_.reset();
 
+	if (decoder_)
+	{
+		ma_decoder_uninit(decoder_.get());
+		decoder_.reset();
+	}
+
 	bIsInitialized_ = false;
 }
 
@@ -0,0 +1,86 @@
+#include <limits>
+
+#include "Assertion.h"
+#include "MathUtils.h"
+#include "StaticBatch.h"
+#include "StaticMesh.h"
+
+void StaticBatch::Add(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, const Matrix4x4f& world, const Material* material)
+{
+	Batch* batch = nullptr;
+	for (auto& candidate : batches_)
+	{
+		if (candidate.material == material)
+		{
+			batch = &candidate;
+			break;
+		}
+	}
+
+	if (!batch)
+	{
+		batches_.push_back(Batch());
+		batch = &batches_.back();
+		batch->material = material;
+	}
+
+	std::size_t baseVertex = batch->vertices.size();
+	ASSERT(baseVertex + vertices.size() <= static_cast<std::size_t>(std::numeric_limits<uint32_t>::max()), "static batch has too many vertices...");
+
+	batch->vertices.reserve(baseVertex + vertices.size());
+	for (const auto& vertex : vertices)
+	{
+		batch->vertices.push_back(Vertex(TransformPosition(vertex.position, world), TransformNormal(vertex.normal, world), vertex.texture));
+	}
+
+	batch->indices.reserve(batch->indices.size() + indices.size());
+	for (const auto& index : indices)
+	{
+		ASSERT(index < vertices.size(), "%u index is out of static mesh vertices...", index);
+		batch->indices.push_back(static_cast<uint32_t>(baseVertex) + index);
+	}
+
+	batch->countOfMesh++;
+}
+
+void StaticBatch::Add(const StaticMesh* mesh, const Matrix4x4f& world, const Material* material)
+{
+	ASSERT(mesh != nullptr, "static batch mesh is null...");
+	Add(mesh->GetVertices(), mesh->GetIndices(), world, material);
+}
+
+Vector3f StaticBatch::TransformPosition(const Vector3f& position, const Matrix4x4f& world)
+{
+	return Vector3f(
+		position.x * world.m[0][0] + position.y * world.m[1][0] + position.z * world.m[2][0] + world.m[3][0],
+		position.x * world.m[0][1] + position.y * world.m[1][1] + position.z * world.m[2][1] + world.m[3][1],
+		position.x * world.m[0][2] + position.y * world.m[1][2] + position.z * world.m[2][2] + world.m[3][2]
+	);
+}
+
+Vector3f StaticBatch::TransformNormal(const Vector3f& normal, const Matrix4x4f& world)
+{
+	Vector3f row0(world.m[0][0], world.m[0][1], world.m[0][2]);
+	Vector3f row1(world.m[1][0], world.m[1][1], world.m[1][2]);
+	Vector3f row2(world.m[2][0], world.m[2][1], world.m[2][2]);
+
+	// μ       ̸, ġ Ŀ Ľ  Ͱ ϴ.
+	Vector3f cofactor0 = MathUtils::CrossProduct(row1, row2);
+	Vector3f cofactor1 = MathUtils::CrossProduct(row2, row0);
+	Vector3f cofactor2 = MathUtils::CrossProduct(row0, row1);
+
+	float sign = MathUtils::DotProduct(row0, cofactor0) < 0.0f ? -1.0f : 1.0f;
+
+	Vector3f transformed(
+		sign * (normal.x * cofactor0.x + normal.y * cofactor1.x + normal.z * cofactor2.x),
+		sign * (normal.x * cofactor0.y + normal.y * cofactor1.y + normal.z * cofactor2.y),
+		sign * (normal.x * cofactor0.z + normal.y * cofactor1.z + normal.z * cofactor2.z)
+	);
+
+	if (MathUtils::LengthSquare(transformed) <= 0.0f)
+	{
+		return Vector3f(0.0f, 0.0f, 0.0f);
+	}
+
+	return MathUtils::Normalize(transformed);
+}
\ No newline at end of file
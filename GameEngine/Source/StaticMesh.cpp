@@ -1,6 +1,9 @@
+#if !defined(HEADLESS_MODE)
 #include <glad/glad.h>
+#endif
 
 #include "Assertion.h"
+#include "GLStateCache.h"
 #include "StaticMesh.h"
 
 StaticMesh::~StaticMesh()
@@ -16,7 +19,10 @@ void StaticMesh::Initialize(const std::vector<Vertex>& vertices, const std::vect
 	ASSERT(!bIsInitialized_, "already initialize static mesh resource...");
 
 	indexCount_ = static_cast<uint32_t>(indices.size());
+	vertices_ = vertices;
+	indices_ = indices;
 
+#if !defined(HEADLESS_MODE)
 	const void* vertexBufferPtr = reinterpret_cast<const void*>(vertices.data());
 	uint32_t vertexBufferSize = static_cast<uint32_t>(vertices.size()) * Vertex::GetStride();
 
@@ -34,7 +40,8 @@ void StaticMesh::Initialize(const std::vector<Vertex>& vertices, const std::vect
 	GL_ASSERT(glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, Vertex::GetStride(), (void*)(offsetof(Vertex, texture))), "failed to define an array of generic vertex attribute data");
 	GL_ASSERT(glEnableVertexAttribArray(2), "failed to enable a generic vertex attribute array");
 
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind static mesh vertex array object...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(0), "failed to unbind static mesh vertex array object...");
+#endif
 
 	bIsInitialized_ = true;
 }
@@ -43,22 +50,29 @@ void StaticMesh::Release()
 {
 	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
 
-	GL_ASSERT(glDeleteBuffers(1, &indexBufferObject_), "failed to delete static mesh index buffer...");
-	GL_ASSERT(glDeleteBuffers(1, &vertexBufferObject_), "failed to delete static mesh vertex buffer...");
-	GL_ASSERT(glDeleteVertexArrays(1, &vertexArrayObject_), "failed to delete static mesh vertex array object...");
+#if !defined(HEADLESS_MODE)
+	GL_ASSERT(GLStateCache::Get().DeleteBuffer(indexBufferObject_), "failed to delete static mesh index buffer...");
+	GL_ASSERT(GLStateCache::Get().DeleteBuffer(vertexBufferObject_), "failed to delete static mesh vertex buffer...");
+	GL_ASSERT(GLStateCache::Get().DeleteVertexArray(vertexArrayObject_), "failed to delete static mesh vertex array object...");
+#endif
+
+	vertices_.clear();
+	indices_.clear();
 
 	bIsInitialized_ = false;
 }
 
+#if !defined(HEADLESS_MODE)
 void StaticMesh::SetupMesh(const void* vertexBufferPtr, uint32_t vertexBufferSize, const void* indexBufferPtr, uint32_t indexBufferSize)
 {
 	GL_ASSERT(glGenVertexArrays(1, &vertexArrayObject_), "failed to generate static mesh vertex array object...");
 	GL_ASSERT(glGenBuffers(1, &vertexBufferObject_), "failed to generate static mesh vertex buffer...");
 	GL_ASSERT(glGenBuffers(1, &indexBufferObject_), "failed to generate static mesh index buffer...");
 
-	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind static mesh vertex array object...");
-	GL_ASSERT(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind static mesh vertex buffer...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(vertexArrayObject_), "failed to bind static mesh vertex array object...");
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind static mesh vertex buffer...");
 	GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, vertexBufferSize, vertexBufferPtr, GL_STATIC_DRAW), "failed to initialize static mesh vertex buffer...");
 	GL_ASSERT(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferObject_), "failed to bind static mesh index buffer...");
 	GL_ASSERT(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBufferSize, indexBufferPtr, GL_STATIC_DRAW), "failed to initialize static mesh index buffer...");
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include "StringId.h"
+
+#if defined(DEBUG_MODE)
+
+#include <mutex>
+#include <unordered_map>
+
+#include "Assertion.h"
+
+/**
+ * @brief ĺڿ  ڿ  ̺ ϴ.
+ *
+ * @note  ʱȭ   ϱ  Լ    մϴ.
+ */
+static std::unordered_map<StringId, std::string, StringId::Hasher>& GetReverseTable()
+{
+	static std::unordered_map<StringId, std::string, StringId::Hasher> reverseTable;
+	return reverseTable;
+}
+
+/**
+ * @brief  ̺  ȣϴ ؽ ϴ.
+ */
+static std::mutex& GetReverseTableMutex()
+{
+	static std::mutex reverseTableMutex;
+	return reverseTableMutex;
+}
+
+StringId StringId::Register(std::string_view string)
+{
+	StringId id(string);
+
+	std::lock_guard<std::mutex> lock(GetReverseTableMutex());
+	auto result = GetReverseTable().insert({ id, std::string(string) });
+	if (!result.second)
+	{
+		const std::string& registered = result.first->second;
+		ASSERT(registered == string, "string id collision %s and %s...", registered.c_str(), std::string(string).c_str());
+	}
+
+	return id;
+}
+
+std::string StringId::FindString(const StringId& id)
+{
+	std::lock_guard<std::mutex> lock(GetReverseTableMutex());
+	auto iter = GetReverseTable().find(id);
+	return (iter == GetReverseTable().end()) ? std::string() : iter->second;
+}
+
+#endif
\ No newline at end of file
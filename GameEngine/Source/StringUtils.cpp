@@ -1,15 +1,211 @@
 #include "StringUtils.h"
 
 #include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstdio>
+#include <cwchar>
+#include <cwctype>
+
+/**
+ * @brief 帶   char ڿ Դϴ.
+ */
+static thread_local char charBuffer[StringUtils::STRING_BUFFER_SIZE];
+
+/**
+ * @brief 帶   wchar_t ڿ Դϴ.
+ */
+static thread_local wchar_t wcharBuffer[StringUtils::STRING_BUFFER_SIZE];
+
+/**
+ * @brief ߸ Ʈ̳ ڵ Ʈ  ڵ ü Դϴ.
+ */
+static const char32_t REPLACEMENT_CHARACTER = 0xFFFD;
+
+/**
+ * @brief UTF-8 Ʈ ڵ Ʈ ϳ нϴ.
+ *
+ * @param current  ġԴϴ.  Ʈ ŭ ̵մϴ.
+ * @param end Ʈ Դϴ.
+ *
+ * @return  ڵ Ʈ ȯմϴ. ߸ Ʈ̶ ü ڸ ȯմϴ.
+ */
+static char32_t DecodeUtf8(const unsigned char*& current, const unsigned char* end)
+{
+	unsigned char lead = *current++;
+	if (lead < 0x80)
+	{
+		return static_cast<char32_t>(lead);
+	}
+
+	int32_t countOfTrail = 0;
+	char32_t codePoint = 0;
+	char32_t minCodePoint = 0;
+
+	if ((lead & 0xE0) == 0xC0)
+	{
+		countOfTrail = 1;
+		codePoint = lead & 0x1F;
+		minCodePoint = 0x80;
+	}
+	else if ((lead & 0xF0) == 0xE0)
+	{
+		countOfTrail = 2;
+		codePoint = lead & 0x0F;
+		minCodePoint = 0x800;
+	}
+	else if ((lead & 0xF8) == 0xF0)
+	{
+		countOfTrail = 3;
+		codePoint = lead & 0x07;
+		minCodePoint = 0x10000;
+	}
+	else
+	{
+		return REPLACEMENT_CHARACTER;
+	}
+
+	for (int32_t trail = 0; trail < countOfTrail; ++trail)
+	{
+		if (current == end || (*current & 0xC0) != 0x80)
+		{
+			return REPLACEMENT_CHARACTER;
+		}
+
+		codePoint = (codePoint << 6) | (*current++ & 0x3F);
+	}
+
+	//  ǥ(overlong), ΰƮ , ڵ     ߸ ƮԴϴ.
+	if (codePoint < minCodePoint || (0xD800 <= codePoint && codePoint <= 0xDFFF) || codePoint > 0x10FFFF)
+	{
+		return REPLACEMENT_CHARACTER;
+	}
+
+	return codePoint;
+}
+
+/**
+ * @brief ڵ Ʈ ϳ UTF-8 Ʈ ڿ ڿ ߰մϴ.
+ *
+ * @param codePoint ߰ ڵ ƮԴϴ.
+ * @param outText Ʈ ߰ ڿԴϴ.
+ */
+static void EncodeUtf8(char32_t codePoint, std::string& outText)
+{
+	if (codePoint < 0x80)
+	{
+		outText.push_back(static_cast<char>(codePoint));
+	}
+	else if (codePoint < 0x800)
+	{
+		outText.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+		outText.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+	}
+	else if (codePoint < 0x10000)
+	{
+		outText.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+		outText.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+		outText.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+	}
+	else
+	{
+		outText.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+		outText.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+		outText.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+		outText.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+	}
+}
+
+/**
+ * @brief Ư ڿ  ؽƮ   ȸ иմϴ.
+ *
+ * @param text и  ڿԴϴ.
+ * @param delimiter и   ڿԴϴ.
+ * @param outTokens и   Դϴ.
+ */
+template <typename TChar>
+static void SplitLinear(std::basic_string_view<TChar> text, std::basic_string_view<TChar> delimiter, std::vector<std::basic_string_view<TChar>>& outTokens)
+{
+	outTokens.clear();
+
+	if (delimiter.empty())
+	{
+		outTokens.push_back(text);
+		return;
+	}
+
+	std::size_t begin = 0;
+	std::size_t position = 0;
+	while ((position = text.find(delimiter, begin)) != std::basic_string_view<TChar>::npos)
+	{
+		outTokens.push_back(text.substr(begin, position - begin));
+		begin = position + delimiter.length();
+	}
+
+	outTokens.push_back(text.substr(begin));
+}
+
+std::size_t StringUtils::FormatTo(char* buffer, std::size_t bufferSize, const char* format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	std::size_t size = VFormatTo(buffer, bufferSize, format, args);
+	va_end(args);
+
+	return size;
+}
+
+std::size_t StringUtils::FormatTo(wchar_t* buffer, std::size_t bufferSize, const wchar_t* format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	std::size_t size = VFormatTo(buffer, bufferSize, format, args);
+	va_end(args);
+
+	return size;
+}
+
+std::size_t StringUtils::VFormatTo(char* buffer, std::size_t bufferSize, const char* format, va_list args)
+{
+	if (bufferSize == 0)
+	{
+		return 0;
+	}
+
+	int32_t size = std::vsnprintf(buffer, bufferSize, format, args);
+	if (size < 0)
+	{
+		buffer[0] = '\0';
+		return 0;
+	}
+
+	return std::min<std::size_t>(static_cast<std::size_t>(size), bufferSize - 1);
+}
 
-char charBuffer[StringUtils::STRING_BUFFER_SIZE];
-wchar_t wcharBuffer[StringUtils::STRING_BUFFER_SIZE];
+std::size_t StringUtils::VFormatTo(wchar_t* buffer, std::size_t bufferSize, const wchar_t* format, va_list args)
+{
+	if (bufferSize == 0)
+	{
+		return 0;
+	}
+
+	buffer[0] = L'\0';
+	int32_t size = std::vswprintf(buffer, bufferSize, format, args);
+	if (size >= 0)
+	{
+		return static_cast<std::size_t>(size);
+	}
+
+	// vswprintf ڿ ߸  ȯϹǷ ۸ ݰ   ̸ ϴ.
+	buffer[bufferSize - 1] = L'\0';
+	return std::wcslen(buffer);
+}
 
 std::string StringUtils::PrintF(const char* format, ...)
 {
 	va_list args;
 	va_start(args, format);
-	int32_t size = vsnprintf(charBuffer, STRING_BUFFER_SIZE, format, args);
+	std::size_t size = VFormatTo(charBuffer, STRING_BUFFER_SIZE, format, args);
 	va_end(args);
 
 	return std::string(charBuffer, size);
@@ -19,7 +215,7 @@ std::wstring StringUtils::PrintF(const wchar_t* format, ...)
 {
 	va_list args;
 	va_start(args, format);
-	int32_t size = _vsnwprintf_s(wcharBuffer, STRING_BUFFER_SIZE, format, args);
+	std::size_t size = VFormatTo(wcharBuffer, STRING_BUFFER_SIZE, format, args);
 	va_end(args);
 
 	return std::wstring(wcharBuffer, size);
@@ -27,73 +223,117 @@ std::wstring StringUtils::PrintF(const wchar_t* format, ...)
 
 std::vector<std::string> StringUtils::Split(const std::string& text, const std::string& delimiter)
 {
-	std::vector<std::string> tokens;
-	std::size_t position = 0ULL;
-	std::string remain = text;
-
-	while ((position = remain.find(delimiter)) != std::string::npos)
-	{
-		tokens.push_back(remain.substr(0, position));
-		remain.erase(0, position + delimiter.length());
-	}
+	std::vector<std::string_view> views;
+	Split(std::string_view(text), std::string_view(delimiter), views);
 
-	tokens.push_back(remain);
-	return tokens;
+	return std::vector<std::string>(views.begin(), views.end());
 }
 
 std::vector<std::wstring> StringUtils::Split(const std::wstring& text, const std::wstring& delimiter)
 {
-	std::vector<std::wstring> tokens;
-	std::size_t position = 0ULL;
-	std::wstring remain = text;
+	std::vector<std::wstring_view> views;
+	Split(std::wstring_view(text), std::wstring_view(delimiter), views);
 
-	while ((position = remain.find(delimiter)) != std::string::npos)
-	{
-		tokens.push_back(remain.substr(0, position));
-		remain.erase(0, position + delimiter.length());
-	}
+	return std::vector<std::wstring>(views.begin(), views.end());
+}
 
-	tokens.push_back(remain);
-	return tokens;
+void StringUtils::Split(std::string_view text, std::string_view delimiter, std::vector<std::string_view>& outTokens)
+{
+	SplitLinear(text, delimiter, outTokens);
+}
+
+void StringUtils::Split(std::wstring_view text, std::wstring_view delimiter, std::vector<std::wstring_view>& outTokens)
+{
+	SplitLinear(text, delimiter, outTokens);
 }
 
 std::wstring StringUtils::Convert(const std::string& text)
 {
-	std::size_t size = std::mbstowcs(wcharBuffer, text.c_str(), STRING_BUFFER_SIZE);
-	return std::wstring(wcharBuffer, size);
+	std::wstring convert;
+	convert.reserve(text.size());
+
+	const unsigned char* current = reinterpret_cast<const unsigned char*>(text.data());
+	const unsigned char* end = current + text.size();
+	while (current < end)
+	{
+		char32_t codePoint = DecodeUtf8(current, end);
+
+		if constexpr (sizeof(wchar_t) == 2)
+		{
+			if (codePoint >= 0x10000)
+			{
+				codePoint -= 0x10000;
+				convert.push_back(static_cast<wchar_t>(0xD800 + (codePoint >> 10)));
+				convert.push_back(static_cast<wchar_t>(0xDC00 + (codePoint & 0x3FF)));
+				continue;
+			}
+		}
+
+		convert.push_back(static_cast<wchar_t>(codePoint));
+	}
+
+	return convert;
 }
 
 std::string StringUtils::Convert(const std::wstring& text)
 {
-	std::size_t size = std::wcstombs(charBuffer, text.c_str(), STRING_BUFFER_SIZE);
-	return std::string(charBuffer, size);
+	std::string convert;
+	convert.reserve(text.size());
+
+	for (std::size_t index = 0; index < text.size(); ++index)
+	{
+		char32_t codePoint = static_cast<char32_t>(text[index]);
+
+		if constexpr (sizeof(wchar_t) == 2)
+		{
+			codePoint &= 0xFFFF;
+			if (0xD800 <= codePoint && codePoint <= 0xDBFF && index + 1 < text.size())
+			{
+				char32_t low = static_cast<char32_t>(text[index + 1]) & 0xFFFF;
+				if (0xDC00 <= low && low <= 0xDFFF)
+				{
+					codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+					++index;
+				}
+			}
+		}
+
+		if ((0xD800 <= codePoint && codePoint <= 0xDFFF) || codePoint > 0x10FFFF)
+		{
+			codePoint = REPLACEMENT_CHARACTER;
+		}
+
+		EncodeUtf8(codePoint, convert);
+	}
+
+	return convert;
 }
 
 std::string StringUtils::ToLower(const std::string& text)
 {
 	std::string lower = text;
-	std::transform(lower.begin(), lower.end(), lower.begin(), std::tolower);
+	std::transform(lower.begin(), lower.end(), lower.begin(), [](char character) { return static_cast<char>(std::tolower(static_cast<unsigned char>(character))); });
 	return lower;
 }
 
 std::wstring StringUtils::ToLower(const std::wstring& text)
 {
 	std::wstring lower = text;
-	std::transform(lower.begin(), lower.end(), lower.begin(), std::tolower);
+	std::transform(lower.begin(), lower.end(), lower.begin(), [](wchar_t character) { return static_cast<wchar_t>(std::towlower(static_cast<wint_t>(character))); });
 	return lower;
 }
 
 std::string StringUtils::ToUpper(const std::string& text)
 {
 	std::string upper = text;
-	std::transform(upper.begin(), upper.end(), upper.begin(), std::toupper);
+	std::transform(upper.begin(), upper.end(), upper.begin(), [](char character) { return static_cast<char>(std::toupper(static_cast<unsigned char>(character))); });
 	return upper;
 }
 
 std::wstring StringUtils::ToUpper(const std::wstring& text)
 {
 	std::wstring upper = text;
-	std::transform(upper.begin(), upper.end(), upper.begin(), std::toupper);
+	std::transform(upper.begin(), upper.end(), upper.begin(), [](wchar_t character) { return static_cast<wchar_t>(std::towupper(static_cast<wint_t>(character))); });
 	return upper;
 }
 
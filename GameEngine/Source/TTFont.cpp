@@ -1,10 +1,29 @@
+#if !defined(HEADLESS_MODE)
 #include <glad/glad.h>
-#include <stb_rect_pack.h>
-#include <stb_truetype.h>
+#endif
 
 #include "Assertion.h"
+#include "GLStateCache.h"
+#include "StringUtils.h"
 #include "TTFont.h"
+
+#if !defined(HEADLESS_MODE)
 #include "FileUtils.h"
+#endif
+
+
+/**
+ * @brief Ʈ ũ⿡  ȣ ִ Ÿ Ÿ  Դϴ.
+ *
+ * @note Ÿ   β ܰ  ׸ڸ ׸  , ۸ 簢  Ŀϴ.
+ */
+static const float SIGNED_DISTANCE_FIELD_RANGE_RATIO = 0.125f;
+
+
+/**
+ * @brief ȣ ִ Ÿ ּ Ÿ Դϴ.
+ */
+static const int32_t MIN_SIGNED_DISTANCE_FIELD_RANGE = 2;
 
 TTFont::~TTFont()
 {
@@ -14,30 +33,136 @@ TTFont::~TTFont()
 	}
 }
 
-void TTFont::Initialize(const std::wstring& path, int32_t beginCodePoint, int32_t endCodePoint, float fontSize)
+#if !defined(HEADLESS_MODE)
+void TTFont::Initialize(const std::wstring& path, int32_t beginCodePoint, int32_t endCodePoint, float fontSize, const GlyphAtlas::EType& type)
 {
 	ASSERT(!bIsInitialized_, "already initialize true type font resource...");
 
-	beginCodePoint_ = beginCodePoint;
-	endCodePoint_ = endCodePoint;
+	Initialize(LoadGlyphAtlas(path, beginCodePoint, endCodePoint, fontSize, type));
+}
 
+GlyphAtlas TTFont::LoadGlyphAtlas(const std::wstring& path, int32_t beginCodePoint, int32_t endCodePoint, float fontSize, const GlyphAtlas::EType& type)
+{
 	std::vector<uint8_t> buffer = FileUtils::ReadBufferFromFile(path);
 
-	stbtt_fontinfo info;
-	const unsigned char* bufferPtr = reinterpret_cast<const unsigned char*>(&buffer[0]);
-	ASSERT((stbtt_InitFont(&info, bufferPtr, stbtt_GetFontOffsetForIndex(bufferPtr, 0)) != 0), "failed to initialize stb_truetype...");
+	std::wstring bakedPath = GetBakedGlyphAtlasPath(path, fontSize, type);
+	std::vector<uint8_t> bakedBuffer = FileUtils::IsValidPath(bakedPath) ? FileUtils::ReadBufferFromFile(bakedPath) : std::vector<uint8_t>();
+
+	GlyphAtlas glyphAtlas;
+	if (!LoadGlyphAtlasFromBuffer(buffer, bakedBuffer, beginCodePoint, endCodePoint, fontSize, type, glyphAtlas))
+	{
+		FileUtils::WriteBufferToFile(bakedPath, glyphAtlas.Serialize());
+	}
+
+	return glyphAtlas;
+}
+#endif
 
-	std::shared_ptr<uint8_t[]> glyphAtlasBitmap = GenerateGlyphAtlasBitmap(buffer, beginCodePoint_, endCodePoint_, fontSize, glyphs_, glyphAtlasSize_);
-	glyphAtlasID_ = CreateGlyphAtlasFromBitmap(glyphAtlasBitmap, glyphAtlasSize_);
+bool TTFont::LoadGlyphAtlasFromBuffer(const BufferView& buffer, const BufferView& bakedBuffer, int32_t beginCodePoint, int32_t endCodePoint, float fontSize, const GlyphAtlas::EType& type, GlyphAtlas& outGlyphAtlas)
+{
+	int32_t distanceRange = (type == GlyphAtlas::EType::SignedDistanceField) ? GetSignedDistanceFieldRange(fontSize) : 0;
+	uint64_t sourceHash = GlyphAtlas::ComputeSourceHash(buffer, beginCodePoint, endCodePoint, fontSize, type, distanceRange);
+
+	if (!bakedBuffer.IsEmpty() && GlyphAtlas::Deserialize(bakedBuffer, sourceHash, outGlyphAtlas))
+	{
+		return true;
+	}
 
+	if (type == GlyphAtlas::EType::SignedDistanceField)
+	{
+		GlyphAtlas::PackSignedDistanceField(buffer, beginCodePoint, endCodePoint, fontSize, distanceRange, outGlyphAtlas);
+	}
+	else
+	{
+		GlyphAtlas::Pack(buffer, beginCodePoint, endCodePoint, fontSize, outGlyphAtlas);
+	}
+
+	return false;
+}
+
+void TTFont::Initialize(const GlyphAtlas& glyphAtlas)
+{
+	ASSERT(!bIsInitialized_, "already initialize true type font resource...");
+	ASSERT(glyphAtlas.beginCodePoint <= glyphAtlas.endCodePoint, "invalid code point range %d ~ %d...", glyphAtlas.beginCodePoint, glyphAtlas.endCodePoint);
+	ASSERT(glyphAtlas.glyphs.size() == static_cast<std::size_t>(glyphAtlas.endCodePoint - glyphAtlas.beginCodePoint + 1), "glyph count does not match code point range...");
+
+	beginCodePoint_ = glyphAtlas.beginCodePoint;
+	endCodePoint_ = glyphAtlas.endCodePoint;
+	glyphAtlasSize_ = glyphAtlas.glyphAtlasSize;
+	ascent_ = glyphAtlas.ascent;
+	descent_ = glyphAtlas.descent;
+	lineGap_ = glyphAtlas.lineGap;
+	glyphs_ = glyphAtlas.glyphs;
+	type_ = glyphAtlas.type;
+	distanceRange_ = glyphAtlas.distanceRange;
+	fontSize_ = glyphAtlas.fontSize;
+	scale_ = 1.0f;
+
+#if !defined(HEADLESS_MODE)
+	ASSERT(glyphAtlas.bitmap.size() == static_cast<std::size_t>(glyphAtlasSize_ * glyphAtlasSize_), "invalid glyph atlas bitmap...");
+	glyphAtlasID_ = CreateGlyphAtlasFromBitmap(glyphAtlas.bitmap.data(), glyphAtlasSize_);
+#endif
+
+	bIsAtlasOwner_ = true;
 	bIsInitialized_ = true;
 }
 
+void TTFont::Initialize(const TTFont* atlasFont, float fontSize)
+{
+	ASSERT(!bIsInitialized_, "already initialize true type font resource...");
+	ASSERT(atlasFont != nullptr && atlasFont->IsInitialized(), "invalid atlas font resource...");
+	ASSERT(atlasFont->type_ == GlyphAtlas::EType::SignedDistanceField, "only signed distance field font can share glyph atlas...");
+	ASSERT(fontSize > 0.0f, "invalid font size %f...", fontSize);
+
+	beginCodePoint_ = atlasFont->beginCodePoint_;
+	endCodePoint_ = atlasFont->endCodePoint_;
+	glyphAtlasSize_ = atlasFont->glyphAtlasSize_;
+	glyphs_ = atlasFont->glyphs_;
+	glyphAtlasID_ = atlasFont->glyphAtlasID_;
+	type_ = atlasFont->type_;
+	distanceRange_ = atlasFont->distanceRange_;
+	fontSize_ = fontSize;
+	scale_ = fontSize / atlasFont->fontSize_;
+	ascent_ = atlasFont->ascent_ * scale_;
+	descent_ = atlasFont->descent_ * scale_;
+	lineGap_ = atlasFont->lineGap_ * scale_;
+	textEffect_ = atlasFont->textEffect_;
+
+	bIsAtlasOwner_ = false;
+	bIsInitialized_ = true;
+}
+
+int32_t TTFont::GetSignedDistanceFieldRange(float fontSize)
+{
+	int32_t distanceRange = static_cast<int32_t>(fontSize * SIGNED_DISTANCE_FIELD_RANGE_RATIO + 0.5f);
+	return (distanceRange < MIN_SIGNED_DISTANCE_FIELD_RANGE) ? MIN_SIGNED_DISTANCE_FIELD_RANGE : distanceRange;
+}
+
+std::wstring TTFont::GetBakedGlyphAtlasPath(const std::wstring& path, float fontSize, const GlyphAtlas::EType& type)
+{
+	std::size_t lastSlash = path.find_last_of(L"/\\");
+	std::size_t offset = path.rfind(L'.');
+	if (offset == std::wstring::npos || (lastSlash != std::wstring::npos && offset < lastSlash))
+	{
+		offset = path.size();
+	}
+
+	const wchar_t* format = (type == GlyphAtlas::EType::SignedDistanceField) ? L"_%g_sdf.atlas" : L"_%g.atlas";
+	return path.substr(0, offset) + StringUtils::PrintF(format, static_cast<double>(fontSize));
+}
+
 void TTFont::Release()
 {
 	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
 
-	GL_ASSERT(glDeleteTextures(1, &glyphAtlasID_), "failed to delete true type font glyph atlas...");
+#if !defined(HEADLESS_MODE)
+	if (bIsAtlasOwner_)
+	{
+		GL_ASSERT(GLStateCache::Get().DeleteTexture(glyphAtlasID_), "failed to delete true type font glyph atlas...");
+	}
+#endif
+
+	glyphAtlasID_ = 0;
 
 	bIsInitialized_ = false;
 }
@@ -54,7 +179,7 @@ bool TTFont::IsValidCodePoint(int32_t codePoint) const
 	return (beginCodePoint_ <= codePoint) && (codePoint <= endCodePoint_);
 }
 
-void TTFont::MeasureText(const std::wstring& text, float& outWidth, float& outHeight) const
+void TTFont::MeasureText(std::wstring_view text, float& outWidth, float& outHeight) const
 {
 	int32_t textHeight = -1;
 	int32_t textWidth = 0;
@@ -63,8 +188,10 @@ void TTFont::MeasureText(const std::wstring& text, float& outWidth, float& outHe
 	{
 		const Glyph& glyph = GetGlyph(static_cast<int32_t>(unicode));
 
-		int32_t currentWidth = static_cast<int32_t>(glyph.xadvance);
-		int32_t currentHeight = glyph.position1.y - glyph.position0.y;
+		int32_t currentWidth = static_cast<int32_t>(glyph.xadvance * scale_);
+		// ȣ ִ Ÿ ۸ 簢 Ʒ Ÿ ŭ  Ƿ, ؽƮ ̿ մϴ.
+		int32_t glyphHeight = (glyph.position1.y - glyph.position0.y > 0) ? (glyph.position1.y - glyph.position0.y - 2 * distanceRange_) : 0;
+		int32_t currentHeight = static_cast<int32_t>(static_cast<float>(glyphHeight) * scale_);
 
 		textWidth += currentWidth;
 
@@ -78,80 +205,25 @@ void TTFont::MeasureText(const std::wstring& text, float& outWidth, float& outHe
 	outHeight = static_cast<float>(textHeight);
 }
 
-std::shared_ptr<uint8_t[]> TTFont::GenerateGlyphAtlasBitmap(const std::vector<uint8_t>& buffer, int32_t beginCodePoint, int32_t endCodePoint, float fontSize, std::vector<Glyph>& outGlyphs, int32_t& outGlyphAtlasSize)
-{
-	std::vector<stbtt_packedchar> packedchars(endCodePoint - beginCodePoint + 1);
-	outGlyphs.resize(endCodePoint - beginCodePoint + 1);
-
-	int32_t success = 0;
-	stbtt_pack_context packContext;
-	std::shared_ptr<uint8_t[]> bitmap = nullptr;
-
-	for (int32_t size = 16; size < 8192; size *= 2)
-	{
-		bitmap = std::make_unique<uint8_t[]>(size * size);
-		success = stbtt_PackBegin(&packContext, bitmap.get(), size, size, 0, 1, nullptr);
-		stbtt_PackSetOversampling(&packContext, 1, 1);
-
-		success = stbtt_PackFontRange(
-			&packContext,
-			reinterpret_cast<const unsigned char*>(&buffer[0]),
-			0,
-			fontSize,
-			beginCodePoint,
-			static_cast<int>(packedchars.size()),
-			&packedchars[0]
-		);
-
-		if (success)
-		{
-			stbtt_PackEnd(&packContext);
-			outGlyphAtlasSize = size;
-			break;
-		}
-		else
-		{
-			stbtt_PackEnd(&packContext);
-			bitmap.reset();
-		}
-	}
-
-	for (std::size_t index = 0; index < packedchars.size(); ++index)
-	{
-		outGlyphs[index].codePoint = static_cast<int32_t>(index + beginCodePoint);
-
-		outGlyphs[index].position0 = Vector2i(packedchars[index].x0, packedchars[index].y0);
-		outGlyphs[index].position1 = Vector2i(packedchars[index].x1, packedchars[index].y1);
-
-		outGlyphs[index].xoffset = packedchars[index].xoff;
-		outGlyphs[index].yoffset = packedchars[index].yoff;
-
-		outGlyphs[index].xoffset2 = packedchars[index].xoff2;
-		outGlyphs[index].yoffset2 = packedchars[index].yoff2;
-
-		outGlyphs[index].xadvance = packedchars[index].xadvance;
-	}
-
-	return bitmap;
-}
-
-uint32_t TTFont::CreateGlyphAtlasFromBitmap(const std::shared_ptr<uint8_t[]>& bitmap, const int32_t& glyphAtlasSize)
+#if !defined(HEADLESS_MODE)
+uint32_t TTFont::CreateGlyphAtlasFromBitmap(const uint8_t* bitmap, const int32_t& glyphAtlasSize)
 {
 	uint32_t textureAtlas;
 	GL_ASSERT(glGenTextures(1, &textureAtlas), "failed to generate true type font glyph atlas...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, textureAtlas), "failed to bind glyph atlas object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, textureAtlas), "failed to bind glyph atlas object...");
 
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE), "failed to set glyph atlas object warp s...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE), "failed to set glyph atlas object warp t...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR), "failed to set glyph atlas object min filter...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR), "failed to set glyph atlas object mag filter...");
 
-	const void* bufferPtr = reinterpret_cast<const void*>(&bitmap[0]);
+	const void* bufferPtr = reinterpret_cast<const void*>(bitmap);
 	GL_ASSERT(glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, glyphAtlasSize, glyphAtlasSize, 0, GL_RED, GL_UNSIGNED_BYTE, bufferPtr),
 		"failed to allows elements of an image array to be read by shaders...");
 	GL_ASSERT(glGenerateMipmap(GL_TEXTURE_2D), "failed to generate glyph atlas mipmap...");
 
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, 0), "failed to unbind glyph atlas object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, 0), "failed to unbind glyph atlas object...");
 
 	return textureAtlas;
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include <cstddef>
+
+#if !defined(HEADLESS_MODE)
+#include <glad/glad.h>
+#endif
+
+#include "Assertion.h"
+#include "GLStateCache.h"
+#include "TextLayout.h"
+#include "TTFont.h"
+
+TextLayout::~TextLayout()
+{
+	Release();
+}
+
+bool TextLayout::Update(const TTFont* font, std::wstring_view text, const Vector2f& center)
+{
+	ASSERT(font != nullptr, "invalid font resource...");
+
+	if (font_ == font && center_.x == center.x && center_.y == center.y && text_ == text)
+	{
+		return false;
+	}
+
+	font_ = font;
+	text_.assign(text.data(), text.size());
+	center_ = center;
+
+	vertices_.resize(text_.size() * 6);
+	uint32_t vertexCount = GenerateGlyphVertices(font_, text_, center_, vertices_.data(), width_, height_);
+	vertices_.resize(vertexCount);
+
+	bIsDirty_ = true;
+	countOfBuild_++;
+
+	return true;
+}
+
+void TextLayout::Upload()
+{
+	if (!bIsDirty_)
+	{
+		return;
+	}
+
+#if !defined(HEADLESS_MODE)
+	if (vertexArrayObject_ == 0)
+	{
+		GL_ASSERT(glGenVertexArrays(1, &vertexArrayObject_), "failed to generate text layout vertex array...");
+		GL_ASSERT(glGenBuffers(1, &vertexBufferObject_), "failed to generate text layout vertex buffer...");
+
+		GL_ASSERT(GLStateCache::Get().BindVertexArray(vertexArrayObject_), "failed to bind text layout vertex array...");
+		GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind text layout vertex buffer...");
+
+		GL_ASSERT(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, GlyphVertex::GetStride(), (void*)(offsetof(GlyphVertex, position))),
+			"failed to specify the location and data format of the array of generic vertex attributes at index...");
+		GL_ASSERT(glEnableVertexAttribArray(0), "failed to enable vertex attrib array...");
+
+		GL_ASSERT(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, GlyphVertex::GetStride(), (void*)(offsetof(GlyphVertex, texture))),
+			"failed to specify the location and data format of the array of generic vertex attributes at index...");
+		GL_ASSERT(glEnableVertexAttribArray(1), "failed to enable vertex attrib array...");
+
+		GL_ASSERT(GLStateCache::Get().BindVertexArray(0), "failed to unbind text layout vertex array...");
+	}
+
+	uint32_t vertexCount = static_cast<uint32_t>(vertices_.size());
+	const void* bufferPtr = reinterpret_cast<const void*>(vertices_.data());
+
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind text layout vertex buffer...");
+	if (vertexCount > vertexBufferCapacity_)
+	{
+		GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, GlyphVertex::GetStride() * vertexCount, bufferPtr, GL_STATIC_DRAW),
+			"failed to create a new data store for a text layout buffer object...");
+		vertexBufferCapacity_ = vertexCount;
+	}
+	else if (vertexCount > 0)
+	{
+		GL_ASSERT(glBufferSubData(GL_ARRAY_BUFFER, 0, GlyphVertex::GetStride() * vertexCount, bufferPtr),
+			"failed to update a subset of a text layout buffer object...");
+	}
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, 0), "failed to unbind text layout vertex buffer...");
+#endif
+
+	bIsDirty_ = false;
+}
+
+void TextLayout::Release()
+{
+#if !defined(HEADLESS_MODE)
+	if (vertexArrayObject_ != 0)
+	{
+		GL_ASSERT(GLStateCache::Get().DeleteBuffer(vertexBufferObject_), "failed to delete text layout vertex buffer...");
+		GL_ASSERT(GLStateCache::Get().DeleteVertexArray(vertexArrayObject_), "failed to delete text layout vertex array object...");
+	}
+#endif
+
+	vertexArrayObject_ = 0;
+	vertexBufferObject_ = 0;
+	vertexBufferCapacity_ = 0;
+
+	font_ = nullptr;
+	text_.clear();
+	vertices_.clear();
+	width_ = 0.0f;
+	height_ = 0.0f;
+	bIsDirty_ = false;
+}
+
+uint32_t TextLayout::GenerateGlyphVertices(const TTFont* font, std::wstring_view text, const Vector2f& center, GlyphVertex* outVertices, float& outWidth, float& outHeight)
+{
+	float glyphAtlasSize = static_cast<float>(font->GetGlyphAtlasSize());
+	float scale = font->GetScale();
+
+	font->MeasureText(text, outWidth, outHeight);
+
+	Vector2f position(center.x - outWidth / 2.0f, center.y + outHeight / 2.0f);
+
+	uint32_t vertexCount = 0;
+	for (const auto& unicode : text)
+	{
+		const Glyph& glyph = font->GetGlyph(static_cast<int32_t>(unicode));
+
+		float unicodeWidth = static_cast<float>(glyph.position1.x - glyph.position0.x) * scale;
+		float unicodeHeight = static_cast<float>(glyph.position1.y - glyph.position0.y) * scale;
+		float xoffset = glyph.xoffset * scale;
+		float yoffset = glyph.yoffset * scale;
+
+		outVertices[vertexCount + 0].position = Vector3f(position.x + xoffset, position.y + yoffset, 0.0f);
+		outVertices[vertexCount + 0].texture  = Vector2f(static_cast<float>(glyph.position0.x) / glyphAtlasSize, static_cast<float>(glyph.position0.y) / glyphAtlasSize);
+
+		outVertices[vertexCount + 1].position = Vector3f(position.x + xoffset, position.y + unicodeHeight + yoffset, 0.0f);
+		outVertices[vertexCount + 1].texture  = Vector2f(static_cast<float>(glyph.position0.x) / glyphAtlasSize, static_cast<float>(glyph.position1.y) / glyphAtlasSize);
+
+
+		outVertices[vertexCount + 2].position = Vector3f(position.x + xoffset + unicodeWidth, position.y + yoffset, 0.0f);
+		outVertices[vertexCount + 2].texture  = Vector2f(static_cast<float>(glyph.position1.x) / glyphAtlasSize, static_cast<float>(glyph.position0.y) / glyphAtlasSize);
+
+		outVertices[vertexCount + 3].position = Vector3f(position.x + xoffset + unicodeWidth, position.y + yoffset, 0.0f);
+		outVertices[vertexCount + 3].texture  = Vector2f(static_cast<float>(glyph.position1.x) / glyphAtlasSize, static_cast<float>(glyph.position0.y) / glyphAtlasSize);
+
+
+		outVertices[vertexCount + 4].position = Vector3f(position.x + xoffset, position.y + unicodeHeight + yoffset, 0.0f);
+		outVertices[vertexCount + 4].texture  = Vector2f(static_cast<float>(glyph.position0.x) / glyphAtlasSize, static_cast<float>(glyph.position1.y) / glyphAtlasSize);
+
+		outVertices[vertexCount + 5].position = Vector3f(position.x + xoffset + unicodeWidth, position.y + unicodeHeight + yoffset, 0.0f);
+		outVertices[vertexCount + 5].texture  = Vector2f(static_cast<float>(glyph.position1.x) / glyphAtlasSize, static_cast<float>(glyph.position1.y) / glyphAtlasSize);
+
+		position.x += glyph.xadvance * scale;
+		vertexCount += 6;
+	}
+
+	return vertexCount;
+}
\ No newline at end of file
@@ -4,8 +4,10 @@
 #include <glad/glad.h>
 
 #include "Assertion.h"
+#include "GLStateCache.h"
 #include "Texture2D.h"
 #include "FileUtils.h"
+#include "MipChain.h"
 #include "StringUtils.h"
 #include "TextureUtils.h"
 
@@ -18,6 +20,12 @@ Texture2D::~Texture2D()
 }
 
 void Texture2D::Initialize(const std::wstring& path)
+{
+	std::vector<uint8_t> buffer = FileUtils::ReadBufferFromFile(path);
+	Initialize(path, buffer);
+}
+
+void Texture2D::Initialize(const std::wstring& path, const BufferView& buffer)
 {
 	ASSERT(!bIsInitialized_, "already initialize 2d texture resource...");
 	ASSERT(TextureUtils::IsSupportExtension(path), L"%s is not support extension...", path.c_str());
@@ -25,15 +33,19 @@ void Texture2D::Initialize(const std::wstring& path)
 	std::wstring extension = StringUtils::ToLower(FileUtils::GetFileExtension(path));
 	if (extension == L"astc")
 	{
-		textureID_ = CreateAstcCompressionTexture(path);
+		textureID_ = CreateAstcCompressionTexture(path, buffer);
 	}
 	else if (extension == L"dds")
 	{
-		textureID_ = CreateDxtCompressionTexture(path);
+		textureID_ = CreateDxtCompressionTexture(path, buffer);
+	}
+	else if (extension == L"mips")
+	{
+		textureID_ = CreateMipChainTexture(path, buffer);
 	}
 	else
 	{
-		textureID_ = CreateNonCompressionTexture(path);
+		textureID_ = CreateNonCompressionTexture(path, buffer);
 	}
 
 	bIsInitialized_ = true;
@@ -43,49 +55,48 @@ void Texture2D::Release()
 {
 	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
 
-	GL_ASSERT(glDeleteTextures(1, &textureID_), "failed to delete texture object...");
+	GL_ASSERT(GLStateCache::Get().DeleteTexture(textureID_), "failed to delete texture object...");
 
 	bIsInitialized_ = false;
 }
 
 void Texture2D::Active(uint32_t unit) const
 {
-	GL_ASSERT(glActiveTexture(GL_TEXTURE0 + unit), "failed to active %d texture unit...", (GL_TEXTURE0 + unit));
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, textureID_), "failed to bind texture...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(unit, GL_TEXTURE_2D, textureID_), "failed to bind texture...");
 }
 
-uint32_t Texture2D::CreateNonCompressionTexture(const std::wstring& path)
+uint32_t Texture2D::CreateNonCompressionTexture(const std::wstring& path, const BufferView& buffer)
 {
 	int32_t width;
 	int32_t height;
 	int32_t channels;
-	std::vector<uint8_t> buffer;
-	TextureUtils::LoadImageFromFile(path, width, height, channels, buffer);
+	std::vector<uint8_t> pixels;
+	TextureUtils::LoadImageFromBuffer(path, buffer, width, height, channels, pixels);
 
 	GLenum format = TextureUtils::FindTextureFormatFromChannel(channels);
 	ASSERT(format != 0xFFFF, "%d is not support image channel...", channels);
 
 	uint32_t textureID;
 	GL_ASSERT(glGenTextures(1, &textureID), "failed to generate texture object...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, textureID), "failed to bind texture object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, textureID), "failed to bind texture object...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE), "failed to set texture object warp s...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE), "failed to set texture object warp t...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR), "failed to set texture object min filter...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR), "failed to set texture object mag filter...");
-	GL_ASSERT(glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, buffer.data()), "failed to allows elements of an image array to be read by shaders...");
+	GL_ASSERT(glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, pixels.data()), "failed to allows elements of an image array to be read by shaders...");
 	GL_ASSERT(glGenerateMipmap(GL_TEXTURE_2D), "failed to generate texture mipmap...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, 0), "failed to unbind texture object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, 0), "failed to unbind texture object...");
 	
 	return textureID;
 }
 
-uint32_t Texture2D::CreateAstcCompressionTexture(const std::wstring& path)
+uint32_t Texture2D::CreateAstcCompressionTexture(const std::wstring& path, const BufferView& buffer)
 {
-	std::vector<uint8_t> astcData;
-	EAstcBlockSize blockSize = EAstcBlockSize::None;
-	TextureUtils::LoadAstcFromFile(path, astcData, blockSize);
+	EAstcBlockSize blockSize = TextureUtils::FindAstcBlockSizeFromFile(path);
+	ASSERT(blockSize != EAstcBlockSize::None, L"%s can't find astc block size...", path.c_str());
+	ASSERT(buffer.GetSize() >= sizeof(AstcFileHeader), L"%s is too small to be astc file...", path.c_str());
 
-	AstcFileHeader* astcDataPtr = reinterpret_cast<AstcFileHeader*>(astcData.data());
+	const AstcFileHeader* astcDataPtr = reinterpret_cast<const AstcFileHeader*>(buffer.GetData());
 
 	int32_t xsize = astcDataPtr->xsize[0] + (astcDataPtr->xsize[1] << 8) + (astcDataPtr->xsize[2] << 16);
 	int32_t ysize = astcDataPtr->ysize[0] + (astcDataPtr->ysize[1] << 8) + (astcDataPtr->ysize[2] << 16);
@@ -99,36 +110,35 @@ uint32_t Texture2D::CreateAstcCompressionTexture(const std::wstring& path)
 
 	uint32_t textureID;
 	GL_ASSERT(glGenTextures(1, &textureID), "failed to generate texture object...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, textureID), "failed to bind texture object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, textureID), "failed to bind texture object...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE), "failed to set texture object warp s...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE), "failed to set texture object warp t...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR), "failed to set texture object min filter...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR), "failed to set texture object mag filter...");
 	GL_ASSERT(glCompressedTexImage2D(GL_TEXTURE_2D, 0, compressionFormat, xsize, ysize, 0, byteToRead, reinterpret_cast<const void*>(&astcDataPtr[1])), "failed to compress texture...");
 	GL_ASSERT(glGenerateMipmap(GL_TEXTURE_2D), "failed to generate texture mipmap...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, 0), "failed to unbind texture object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, 0), "failed to unbind texture object...");
 
 	return textureID;
 }
 
-uint32_t Texture2D::CreateDxtCompressionTexture(const std::wstring& path)
+uint32_t Texture2D::CreateDxtCompressionTexture(const std::wstring& path, const BufferView& buffer)
 {
-	std::vector<uint8_t> dxtData;
 	GLenum format;
 	uint32_t blockSize;
-	TextureUtils::LoadDxtFromFile(path, dxtData, format, blockSize);
+	TextureUtils::FindDxtFormatFromBuffer(path, buffer, format, blockSize);
 
-	DDSFileHeader* dxtDataPtr = reinterpret_cast<DDSFileHeader*>(dxtData.data());
+	const DDSFileHeader* dxtDataPtr = reinterpret_cast<const DDSFileHeader*>(buffer.GetData());
 	uint32_t width = dxtDataPtr->dwWidth;
 	uint32_t height = dxtDataPtr->dwHeight;
 	uint32_t linearSize = dxtDataPtr->dwPitchOrLinearSize;
 	uint32_t mipMapCount = dxtDataPtr->dwMipMapCount;
 	uint32_t bufferSize = mipMapCount > 1 ? linearSize * 2 : linearSize;
-	uint8_t* bufferPtr = reinterpret_cast<uint8_t*>(&dxtDataPtr[1]);
+	const uint8_t* bufferPtr = reinterpret_cast<const uint8_t*>(&dxtDataPtr[1]);
 
 	uint32_t textureID;
 	GL_ASSERT(glGenTextures(1, &textureID), "failed to generate texture object...");
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, textureID), "failed to bind texture object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, textureID), "failed to bind texture object...");
 	GL_ASSERT(glPixelStorei(GL_UNPACK_ALIGNMENT, 1), "failed to set pixel storage modes...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE), "failed to set texture object warp s...");
 	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE), "failed to set texture object warp t...");
@@ -151,7 +161,40 @@ uint32_t Texture2D::CreateDxtCompressionTexture(const std::wstring& path)
 		height /= 2;
 	}
 
-	GL_ASSERT(glBindTexture(GL_TEXTURE_2D, 0), "failed to unbind texture object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, 0), "failed to unbind texture object...");
+
+	return textureID;
+}
+
+uint32_t Texture2D::CreateMipChainTexture(const std::wstring& path, const BufferView& buffer)
+{
+	MipChain mipChain;
+	ASSERT(MipChain::Deserialize(buffer, mipChain), L"%s is invalid mip chain file...", path.c_str());
+
+	GLenum format = TextureUtils::FindTextureFormatFromChannel(mipChain.channels);
+	ASSERT(format != 0xFFFF, "%d is not support image channel...", mipChain.channels);
+
+	int32_t maxLevel = static_cast<int32_t>(mipChain.levels.size()) - 1;
+
+	uint32_t textureID;
+	GL_ASSERT(glGenTextures(1, &textureID), "failed to generate texture object...");
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, textureID), "failed to bind texture object...");
+	GL_ASSERT(glPixelStorei(GL_UNPACK_ALIGNMENT, 1), "failed to set pixel storage modes...");
+	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE), "failed to set texture object warp s...");
+	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE), "failed to set texture object warp t...");
+	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR), "failed to set texture object min filter...");
+	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR), "failed to set texture object mag filter...");
+	GL_ASSERT(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, maxLevel), "failed to set texture object max level...");
+
+	for (std::size_t level = 0; level < mipChain.levels.size(); ++level)
+	{
+		const MipChain::Level& mipLevel = mipChain.levels[level];
+		const uint8_t* pixelsPtr = mipChain.pixels.data() + mipLevel.offset;
+
+		GL_ASSERT(glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), format, mipLevel.width, mipLevel.height, 0, format, GL_UNSIGNED_BYTE, pixelsPtr), "failed to allows elements of an image array to be read by shaders...");
+	}
+
+	GL_ASSERT(GLStateCache::Get().BindTexture(GL_TEXTURE_2D, 0), "failed to unbind texture object...");
 
 	return textureID;
 }
\ No newline at end of file
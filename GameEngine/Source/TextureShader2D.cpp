@@ -1,6 +1,7 @@
 #include <glad/glad.h>
 
 #include "Assertion.h"
+#include "GLStateCache.h"
 #include "MathUtils.h"
 #include "Texture2D.h"
 #include "TextureShader2D.h"
@@ -13,17 +14,17 @@ TextureShader2D::~TextureShader2D()
 	}
 }
 
-void TextureShader2D::Initialize(const std::wstring& vsPath, const std::wstring& fsPath)
+void TextureShader2D::Initialize(const BufferView& vsSource, const BufferView& fsSource)
 {
 	ASSERT(!bIsInitialized_, "already initialize texture shader 2d resource...");
 
-	Shader::Initialize(vsPath, fsPath);
+	Shader::Initialize(vsSource, fsSource);
 
 	GL_ASSERT(glGenVertexArrays(1, &vertexArrayObject_), "failed to generate 2d texture vertex array...");
 	GL_ASSERT(glGenBuffers(1, &vertexBufferObject_), "failed to generate 2d texture vertex buffer...");
 
-	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind 2d texture vertex array...");
-	GL_ASSERT(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind 2d texture vertex buffer...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(vertexArrayObject_), "failed to bind 2d texture vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindBuffer(GL_ARRAY_BUFFER, vertexBufferObject_), "failed to bind 2d texture vertex buffer...");
 	GL_ASSERT(glBufferData(GL_ARRAY_BUFFER, VertexPositionTexture::GetStride() * vertices_.size(), reinterpret_cast<const void*>(vertices_.data()), GL_DYNAMIC_DRAW),
 		"failed to create a new data store for a 2d texture buffer object...");
 
@@ -35,7 +36,7 @@ void TextureShader2D::Initialize(const std::wstring& vsPath, const std::wstring&
 		"failed to specify the location and data format of the array of generic vertex attributes at index...");
 	GL_ASSERT(glEnableVertexAttribArray(1), "failed to enable vertex attrib array...");
 
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind 2d texture vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(0), "failed to unbind 2d texture vertex array...");
 }
 
 void TextureShader2D::Release()
@@ -44,8 +45,8 @@ void TextureShader2D::Release()
 
 	Shader::Release();
 
-	GL_ASSERT(glDeleteBuffers(1, &vertexBufferObject_), "failed to delete 2d texture vertex buffer...");
-	GL_ASSERT(glDeleteVertexArrays(1, &vertexArrayObject_), "failed to delete 2d texture vertex array object...");
+	GL_ASSERT(GLStateCache::Get().DeleteBuffer(vertexBufferObject_), "failed to delete 2d texture vertex buffer...");
+	GL_ASSERT(GLStateCache::Get().DeleteVertexArray(vertexArrayObject_), "failed to delete 2d texture vertex array object...");
 }
 
 void TextureShader2D::DrawTexture2D(const Matrix4x4f& ortho, const Texture2D* texture, const Vector2f& center, float width, float height, float rotate, float transparent)
@@ -234,9 +235,9 @@ void TextureShader2D::DrawTexture2D(const Matrix4x4f& transform, const Matrix4x4
 	Shader::SetUniform("transparent", transparent);
 	Shader::SetUniform("outlineRGBA", outline);
 
-	GL_ASSERT(glBindVertexArray(vertexArrayObject_), "failed to bind 2d texture vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(vertexArrayObject_), "failed to bind 2d texture vertex array...");
 	GL_ASSERT(glDrawArrays(GL_TRIANGLES, 0, vertexCount), "failed to draw 2d texture...");
-	GL_ASSERT(glBindVertexArray(0), "failed to unbind 2d texture vertex array...");
+	GL_ASSERT(GLStateCache::Get().BindVertexArray(0), "failed to unbind 2d texture vertex array...");
 
 	Shader::Unbind();
 }
\ No newline at end of file
@@ -26,7 +26,7 @@ std::unordered_map<EAstcBlockSize, std::wstring> blockSizeMaps = {
 	{ EAstcBlockSize::ASTC_12x12, L"12x12" },
 };
 
-std::array<std::wstring, 7> supportExtensions = {
+std::array<std::wstring, 8> supportExtensions = {
 	L"jpeg",
 	L"jpg",
 	L"png",
@@ -34,6 +34,7 @@ std::array<std::wstring, 7> supportExtensions = {
 	L"bmp",
 	L"astc", //  
 	L"dds",  //  
+	L"mips", //  Ŀ ̸  Ӹ ü
 };
 
 bool TextureUtils::IsSupportExtension(const std::wstring& path)
@@ -90,12 +91,10 @@ EAstcBlockSize TextureUtils::FindAstcBlockSizeFromFile(const std::wstring& path)
 	return EAstcBlockSize::None;
 }
 
-void TextureUtils::LoadImageFromFile(const std::wstring& path, int32_t& outWidth, int32_t& outHeight, int32_t& outChannels, std::vector<uint8_t>& outBuffer)
+void TextureUtils::LoadImageFromBuffer(const std::wstring& path, const BufferView& buffer, int32_t& outWidth, int32_t& outHeight, int32_t& outChannels, std::vector<uint8_t>& outBuffer)
 {
-	std::string convertPath = StringUtils::Convert(path);
-
-	uint8_t* bufferPtr = stbi_load(convertPath.c_str(), &outWidth, &outHeight, &outChannels, 0);
-	ASSERT(bufferPtr != nullptr, "failed to load %s image file...", convertPath.c_str());
+	uint8_t* bufferPtr = stbi_load_from_memory(buffer.GetData(), static_cast<int32_t>(buffer.GetSize()), &outWidth, &outHeight, &outChannels, 0);
+	ASSERT(bufferPtr != nullptr, L"failed to load %s image file...", path.c_str());
 
 	std::size_t bufferSize = static_cast<std::size_t>(outWidth * outHeight * outChannels);
 	outBuffer.resize(bufferSize);
@@ -106,18 +105,10 @@ void TextureUtils::LoadImageFromFile(const std::wstring& path, int32_t& outWidth
 	bufferPtr = nullptr;
 }
 
-void TextureUtils::LoadAstcFromFile(const std::wstring& path, std::vector<uint8_t>& outAstcBuffer, EAstcBlockSize& outBlockSize)
-{
-	outBlockSize = FindAstcBlockSizeFromFile(path);
-	ASSERT(outBlockSize != EAstcBlockSize::None, L"%s can't find astc block size...", path.c_str());
-
-	outAstcBuffer = FileUtils::ReadBufferFromFile(path);
-}
-
-void TextureUtils::LoadDxtFromFile(const std::wstring& path, std::vector<uint8_t>& outDxtBuffer, uint32_t& outFormat, uint32_t& outBlockSize)
+void TextureUtils::FindDxtFormatFromBuffer(const std::wstring& path, const BufferView& buffer, uint32_t& outFormat, uint32_t& outBlockSize)
 {
-	outDxtBuffer = FileUtils::ReadBufferFromFile(path);
-	DDSFileHeader* dxtDataPtr = reinterpret_cast<DDSFileHeader*>(outDxtBuffer.data());
+	ASSERT(buffer.GetSize() >= sizeof(DDSFileHeader), L"%s is too small to be dds file...", path.c_str());
+	const DDSFileHeader* dxtDataPtr = reinterpret_cast<const DDSFileHeader*>(buffer.GetData());
 
 	std::string ddsFileCode;
 	for (std::size_t index = 0; index < 4; ++index)
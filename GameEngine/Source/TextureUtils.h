@@ -7,6 +7,8 @@
 #include <string>
 #include <vector>
 
+#include "BufferView.h"
+
 
 #define FOURCC_DXT1 0x31545844
 #define FOURCC_DXT3 0x33545844
@@ -109,6 +111,7 @@ public:
 	 * -   ASTC DXT(S3TC)  մϴ.
 	 * - ASTC    ݵ astcenc.exe ̿ؼ  ̿ մϴ.
 	 * - DXT    ݵ texconv.exe ̿ؼ  ̿ մϴ.
+	 * - Ӹ ü (.mips) ݵ AssetCooker  ̿ մϴ.
 	 */
 	static bool IsSupportExtension(const std::wstring& path);
 
@@ -143,9 +146,10 @@ public:
 
 
 	/**
-	 * @brief ̹  εմϴ.
+	 * @brief ޸𸮿 ִ ̹   ڵմϴ.
 	 * 
-	 * @param path ̹  Դϴ.
+	 * @param path ̹  Դϴ.  ޽ մϴ.
+	 * @param buffer ̹  Դϴ.
 	 * @param outWidth ̹  ũԴϴ.
 	 * @param outHeight ̹  ũԴϴ.
 	 * @param outChannels ̹ ȼ üԴϴ.
@@ -153,28 +157,14 @@ public:
 	 * 
 	 * @note ̹  .jpeg, .jpg, .png, .tga, .bmp  մϴ.
 	 */
-	static void LoadImageFromFile(const std::wstring& path, int32_t& outWidth, int32_t& outHeight, int32_t& outChannels, std::vector<uint8_t>& outBuffer);
-
-
-	/**
-	 * @brief ASTC  ؽó  εմϴ.
-	 * 
-	 * @param path ASTC  ؽó  Դϴ.
-	 * @param outAstcBuffer ASTC  ؽó  Դϴ.
-	 * @param outBlockSize ASTC  ؽó   ũԴϴ.
-	 * 
-	 * @note 
-	 * -  ̸ ο ݵ   ũⰡ ־ մϴ.
-	 * - ex. example_4x4.astc, example_6x6.astc
-	 * - ݵ astcenc.exe Ϸ  ̿ մϴ.
-	 */
-	static void LoadAstcFromFile(const std::wstring& path, std::vector<uint8_t>& outAstcBuffer, EAstcBlockSize& outBlockSize);
+	static void LoadImageFromBuffer(const std::wstring& path, const BufferView& buffer, int32_t& outWidth, int32_t& outHeight, int32_t& outChannels, std::vector<uint8_t>& outBuffer);
 
 
 	/**
-	 * @brief DXT  ؽó  εմϴ.
+	 * @brief ޸𸮿 ִ DXT  ؽó    ãϴ.
 	 * 
-	 * @param path DXT  ؽó  Դϴ.
+	 * @param path DXT  ؽó  Դϴ.  ޽ մϴ.
+	 * @param buffer DXT  ؽó  Դϴ.
 	 * @param outFormat DXT  ؽó Դϴ.
 	 * @param outBlockSize DXT  ؽó  ũԴϴ.
 	 * 
@@ -183,5 +173,5 @@ public:
 	 * - ex. example_dxt1.dds, example_dxt3.dds
 	 * - ݵ texconv.exe Ϸ  ̿ մϴ.
 	 */
-	static void LoadDxtFromFile(const std::wstring& path, std::vector<uint8_t>& outDxtBuffer, uint32_t& outFormat, uint32_t& outBlockSize);
+	static void FindDxtFormatFromBuffer(const std::wstring& path, const BufferView& buffer, uint32_t& outFormat, uint32_t& outBlockSize);
 };
\ No newline at end of file
@@ -29,6 +29,15 @@ void Transform::SetProperties(const Vector3f& location, const Vector3f& rotate,
 	ComputeWorldMatrix();
 }
 
+Transform Transform::Interpolate(const Transform& start, const Transform& end, float t)
+{
+	return Transform(
+		MathUtils::Lerp(start.location_, end.location_, t),
+		MathUtils::Lerp(start.rotate_, end.rotate_, t),
+		MathUtils::Lerp(start.scale_, end.scale_, t)
+	);
+}
+
 void Transform::ComputeWorldMatrix()
 {
 	Matrix4x4f transform = MathUtils::CreateTranslation(location_);
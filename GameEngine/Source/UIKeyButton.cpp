@@ -66,7 +66,8 @@ void UIKeyButton::Render()
 	renderManager.RenderWireframeRectangle2D(center_, width_, height_, 0.0f, outlineColor_);
 	if (font_ && !text_.empty())
 	{
-		renderManager.RenderText2D(font_, text_, center_, textColor_);
+		textLayout_.Update(font_, text_, center_);
+		renderManager.RenderTextLayout(textLayout_, textColor_);
 	}
 }
 
@@ -74,5 +75,7 @@ void UIKeyButton::Release()
 {
 	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
 
+	textLayout_.Release();
+
 	bIsInitialized_ = false;
 }
\ No newline at end of file
@@ -72,7 +72,8 @@ void UIMouseButton::Render()
 	renderManager.RenderWireframeRectangle2D(center_, width_, height_, 0.0f, outlineColor_);
 	if (font_ && !text_.empty())
 	{
-		renderManager.RenderText2D(font_, text_, center_, textColor_);
+		textLayout_.Update(font_, text_, center_);
+		renderManager.RenderTextLayout(textLayout_, textColor_);
 	}
 }
 
@@ -80,6 +81,8 @@ void UIMouseButton::Release()
 {
 	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
 
+	textLayout_.Release();
+
 	bIsInitialized_ = false;
 }
 
@@ -41,7 +41,8 @@ void UIPanel::Render()
 
 	if (font_ && !text_.empty())
 	{
-		renderManager.RenderText2D(font_, text_, center_, textColor_);
+		textLayout_.Update(font_, text_, center_);
+		renderManager.RenderTextLayout(textLayout_, textColor_);
 	}
 }
 
@@ -49,5 +50,7 @@ void UIPanel::Release()
 {
 	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
 
+	textLayout_.Release();
+
 	bIsInitialized_ = false;
 }
\ No newline at end of file
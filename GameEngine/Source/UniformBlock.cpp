@@ -0,0 +1,42 @@
+#include "Camera3D.h"
+#include "Light.h"
+#include "Material.h"
+#include "UniformBlock.h"
+
+FrameUniformBlock FrameUniformBlock::Create(const Camera3D* camera, const Light* light)
+{
+	FrameUniformBlock block;
+
+	block.view = camera->GetViewMatrix();
+	block.projection = camera->GetProjectionMatrix();
+	block.lightViewProjection = light->GetViewMatrix() * light->GetProjectionMatrix();
+	block.viewPosition = camera->GetEyePosition();
+	block.padding0 = 0.0f;
+
+	block.light.position = light->GetPosition();
+	block.light.padding0 = 0.0f;
+	block.light.direction = light->GetDirection();
+	block.light.padding1 = 0.0f;
+	block.light.ambientRGB = light->GetAmbientRGB();
+	block.light.padding2 = 0.0f;
+	block.light.diffuseRGB = light->GetDiffuseRGB();
+	block.light.padding3 = 0.0f;
+	block.light.specularRGB = light->GetSpecularRGB();
+	block.light.padding4 = 0.0f;
+
+	return block;
+}
+
+MaterialUniformBlock MaterialUniformBlock::Create(const Material* material)
+{
+	MaterialUniformBlock block;
+
+	block.ambientRGB = material->GetAmbientRGB();
+	block.padding0 = 0.0f;
+	block.diffuseRGB = material->GetDiffuseRGB();
+	block.padding1 = 0.0f;
+	block.specularRGB = material->GetSpecularRGB();
+	block.shininess = material->GetShininess();
+
+	return block;
+}
\ No newline at end of file
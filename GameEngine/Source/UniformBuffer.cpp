@@ -0,0 +1,94 @@
+#if !defined(HEADLESS_MODE)
+#include <glad/glad.h>
+#endif
+
+#include "Assertion.h"
+#include "UniformBuffer.h"
+
+
+/**
+ * @brief GPU     ϴ     Դϴ.
+ *
+ * @note OpenGL  ϴ ִ̹Ƿ,   ϸ   ȿմϴ.
+ */
+static const uint32_t DEFAULT_OFFSET_ALIGNMENT = 256;
+
+UniformBuffer::~UniformBuffer()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void UniformBuffer::Initialize(uint32_t binding, uint32_t blockSize, uint32_t countOfBlock)
+{
+	ASSERT(!bIsInitialized_, "already initialize uniform buffer resource...");
+	ASSERT(blockSize > 0 && countOfBlock > 0, "uniform buffer must have at least one block...");
+
+	uint32_t alignment = DEFAULT_OFFSET_ALIGNMENT;
+
+#if !defined(HEADLESS_MODE)
+	GLint offsetAlignment = 0;
+	GL_ASSERT(glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment), "failed to get uniform buffer offset alignment...");
+	if (offsetAlignment > 0)
+	{
+		alignment = static_cast<uint32_t>(offsetAlignment);
+	}
+#endif
+
+	binding_ = binding;
+	blockSize_ = blockSize;
+	blockStride_ = GetAlignedSize(blockSize, alignment);
+	countOfBlock_ = countOfBlock;
+
+#if !defined(HEADLESS_MODE)
+	//   ε glBindBufferRange Բ ٲٹǷ,  ĳø ġ ʰ  εմϴ.
+	GL_ASSERT(glGenBuffers(1, &uniformBufferObject_), "failed to generate uniform buffer...");
+	GL_ASSERT(glBindBuffer(GL_UNIFORM_BUFFER, uniformBufferObject_), "failed to bind uniform buffer...");
+	GL_ASSERT(glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(blockStride_) * countOfBlock_, nullptr, GL_DYNAMIC_DRAW), "failed to initialize uniform buffer...");
+	GL_ASSERT(glBindBuffer(GL_UNIFORM_BUFFER, 0), "failed to unbind uniform buffer...");
+#endif
+
+	bIsInitialized_ = true;
+}
+
+void UniformBuffer::Release()
+{
+	ASSERT(bIsInitialized_, "not initialized before or has already been released...");
+
+#if !defined(HEADLESS_MODE)
+	GL_ASSERT(glDeleteBuffers(1, &uniformBufferObject_), "failed to delete uniform buffer...");
+#endif
+
+	bIsInitialized_ = false;
+}
+
+void UniformBuffer::SetBlock(uint32_t index, const void* data)
+{
+	ASSERT(index < countOfBlock_, "out of range uniform buffer block index...");
+
+#if !defined(HEADLESS_MODE)
+	GLintptr offset = static_cast<GLintptr>(index) * blockStride_;
+	GL_ASSERT(glBindBuffer(GL_UNIFORM_BUFFER, uniformBufferObject_), "failed to bind uniform buffer...");
+	GL_ASSERT(glBufferSubData(GL_UNIFORM_BUFFER, offset, blockSize_, data), "failed to write uniform buffer...");
+	GL_ASSERT(glBindBuffer(GL_UNIFORM_BUFFER, 0), "failed to unbind uniform buffer...");
+#else
+	(void)(data);
+#endif
+}
+
+void UniformBuffer::Bind(uint32_t index) const
+{
+	ASSERT(index < countOfBlock_, "out of range uniform buffer block index...");
+
+#if !defined(HEADLESS_MODE)
+	GLintptr offset = static_cast<GLintptr>(index) * blockStride_;
+	GL_ASSERT(glBindBufferRange(GL_UNIFORM_BUFFER, binding_, uniformBufferObject_, offset, blockSize_), "failed to bind uniform buffer range...");
+#endif
+}
+
+uint32_t UniformBuffer::GetAlignedSize(uint32_t blockSize, uint32_t alignment)
+{
+	return ((blockSize + alignment - 1) / alignment) * alignment;
+}
\ No newline at end of file
@@ -53,7 +53,7 @@ bool CreateMinidumpFile(const std::wstring& path, EXCEPTION_POINTERS* exceptionP
 LONG WINAPI DetectApplicationCrash(EXCEPTION_POINTERS* exceptionPtr)
 {
 	std::wstring systemTime = GameTimer::GetCurrentSystemTime();
-	std::wstring minidumpPath = StringUtils::PrintF(L"%sWindows-%s-Minidump.dmp", crashInfoSavePath.c_str(), systemTime.c_str());
+	std::wstring minidumpPath = StringUtils::PrintF(L"%lsWindows-%ls-Minidump.dmp", crashInfoSavePath.c_str(), systemTime.c_str());
 
 	CreateMinidumpFile(minidumpPath, exceptionPtr);
 
@@ -68,7 +68,7 @@ void WindowsCrashUtils::RegisterWindowsExceptionFilter()
 	WINDOWS_ASSERT(GetModuleFileNameW(nullptr, bufferPtr, StringUtils::STRING_BUFFER_SIZE), "failed to get execute file name...");
 	ASSERT(SUCCEEDED(PathCchRemoveFileSpec(bufferPtr, StringUtils::STRING_BUFFER_SIZE)), "failed to remove execute file name...");
 
-	crashInfoSavePath = StringUtils::PrintF(L"%s\\Crash\\", bufferPtr);
+	crashInfoSavePath = StringUtils::PrintF(L"%ls\\Crash\\", bufferPtr);
 	if (!PathFileExistsW(crashInfoSavePath.c_str()))
 	{
 		WINDOWS_ASSERT(CreateDirectoryW(crashInfoSavePath.c_str(), nullptr), "failed to create %s directory...", crashInfoSavePath.c_str());